@@ -1,11 +1,353 @@
 #include "calculation_orchestrator.h"
+#include "pmf_table_cache.h"
 #include "../validators/parameter_validator.h"
 #include "../../core/distributions/lib/distribution_interface.h"
+#include "../../core/math/decimal_parser.h"
+#include "../../core/math/decimal_format.h"
+#include "../../../src/common/cache/budget.h"
+#include "../../../src/common/cache/service.h"
+#include "../../../src/common/cache/sync.h"
+#include "../../../src/common/cache/tier.h"
+#include "../../../src/common/cache/trace.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 
+/**
+ * @brief Cached result record, also the cache page size
+ */
+typedef struct {
+    int32_t distribution;
+    uint32_t param_count;
+    double parameters[MAX_PARAMETERS];
+    double input_value;
+    double pdf_result;
+    double cdf_result;
+} orchestrator_cached_result_t;
+
+static cache_service_t result_cache;
+static int result_cache_enabled = 0;
+static cache_lock_t result_cache_lock = CACHE_LOCK_INITIALIZER;
+// The "calc.results" budget account, registered on first enable
+static int result_budget_account = -1;
+static cache_lock_t result_budget_lock = CACHE_LOCK_INITIALIZER;
+// Flash-backed second level, guarded by result_cache_lock
+static cache_tier_t result_tier;
+static int result_tier_open = 0;
+
+// Progressive refinements waiting for orchestrator_run_refinements, oldest at refinement_head
+static calculation_request_t refinement_requests[ORCHESTRATOR_REFINEMENT_QUEUE_LEN];
+static uint32_t refinement_tickets[ORCHESTRATOR_REFINEMENT_QUEUE_LEN];
+static size_t refinement_head = 0;
+static size_t refinement_count = 0;
+static uint32_t refinement_next_ticket = 0;
+static cache_lock_t refinement_lock = CACHE_LOCK_INITIALIZER;
+
+/**
+ * @brief Fold -0.0 into 0.0 so equal values share a key
+ */
+static double orchestrator_canonical_value(double value) {
+    return value == 0.0 ? 0.0 : value;
+}
+
+/**
+ * @brief Fill a cache record's key fields from a request
+ * Parameters past param_count are zeroed so stale slots never split a key.
+ */
+static void orchestrator_fill_record_key(const calculation_request_t* request, orchestrator_cached_result_t* record) {
+    memset(record, 0, sizeof(*record));
+    record->distribution = (int32_t)request->distribution;
+    record->param_count = request->param_count <= MAX_PARAMETERS ? request->param_count : MAX_PARAMETERS;
+    for (uint32_t i = 0; i < record->param_count; i++) {
+        record->parameters[i] = orchestrator_canonical_value(request->parameters[i]);
+    }
+    record->input_value = orchestrator_canonical_value(request->input_value);
+}
+
+/**
+ * @brief Mix a 64-bit value into an FNV-1a hash, least significant byte first
+ */
+static uint32_t orchestrator_hash_u64(uint32_t hash, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        hash ^= (uint32_t)(value & 0xff);
+        hash *= 16777619u;
+        value >>= 8;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hash the key fields of a cache record
+ */
+static uint32_t orchestrator_record_hash(const orchestrator_cached_result_t* record) {
+    uint32_t hash = 2166136261u;
+    uint64_t bits;
+    
+    hash = orchestrator_hash_u64(hash, (uint64_t)(uint32_t)record->distribution);
+    hash = orchestrator_hash_u64(hash, record->param_count);
+    for (uint32_t i = 0; i < record->param_count; i++) {
+        memcpy(&bits, &record->parameters[i], sizeof(bits));
+        hash = orchestrator_hash_u64(hash, bits);
+    }
+    memcpy(&bits, &record->input_value, sizeof(bits));
+    return orchestrator_hash_u64(hash, bits);
+}
+
+/**
+ * @brief Stable 32-bit key for a calculation request
+ * FNV-1a over the distribution, parameter count, canonicalized parameters and
+ * input value as little-endian IEEE-754 bits, so the key is the same on every
+ * platform and build.
+ * @param request Calculation request
+ * @return Hash of the request, 0 for NULL
+ */
+uint32_t orchestrator_request_hash(const calculation_request_t* request) {
+    orchestrator_cached_result_t record;
+    
+    if (!request) {
+        return 0;
+    }
+    
+    orchestrator_fill_record_key(request, &record);
+    return orchestrator_record_hash(&record);
+}
+
+/**
+ * @brief Budget usage callback: bytes the result cache holds
+ */
+static size_t orchestrator_result_budget_usage(void* context) {
+    size_t usage = 0;
+    
+    (void)context;
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled) {
+        usage = page_cache_reserved_bytes(&result_cache.cache);
+    }
+    cache_lock_release(&result_cache_lock);
+    
+    return usage;
+}
+
+/**
+ * @brief Budget trim callback: hand committed result segments back
+ */
+static size_t orchestrator_result_budget_trim(void* context, size_t bytes_wanted) {
+    size_t freed = 0;
+    
+    (void)context;
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled) {
+        freed = cache_service_trim(&result_cache, bytes_wanted);
+    }
+    cache_lock_release(&result_cache_lock);
+    
+    return freed;
+}
+
+/**
+ * @brief Enable the result cache, or resize it and drop its entries
+ * @param capacity_entries Maximum number of cached results
+ * @return 0 on success, -1 if the cache could not be allocated
+ */
+int orchestrator_enable_result_cache(size_t capacity_entries) {
+    int rc;
+    
+    // Outside result_cache_lock: the budget takes it from its callbacks
+    cache_lock_acquire(&result_budget_lock);
+    if (result_budget_account < 0) {
+        result_budget_account = cache_budget_register("calc.results", CACHE_BUDGET_CLASS_RESULTS,
+                                                      orchestrator_result_budget_usage,
+                                                      orchestrator_result_budget_trim, NULL);
+    }
+    cache_lock_release(&result_budget_lock);
+    
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled) {
+        cache_service_shutdown(&result_cache);
+        result_cache_enabled = 0;
+    }
+    // Lazy, so the budget can take segments back and an idle cache costs only its index
+    rc = cache_service_init_ex(&result_cache, capacity_entries, sizeof(orchestrator_cached_result_t),
+                               PAGE_CACHE_INIT_LAZY);
+    result_cache_enabled = (rc == 0);
+    if (result_cache_enabled && result_tier_open) {
+        cache_service_set_tier(&result_cache, &result_tier);
+    }
+    cache_lock_release(&result_cache_lock);
+    
+    return rc == 0 ? 0 : -1;
+}
+
+/**
+ * @brief Disable the result cache and free its memory
+ */
+void orchestrator_disable_result_cache(void) {
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled) {
+        cache_service_shutdown(&result_cache);
+        result_cache_enabled = 0;
+    }
+    cache_lock_release(&result_cache_lock);
+}
+
+/**
+ * @brief Open the result tier and attach it to the result cache
+ * @param path Tier file, created if missing
+ * @param max_bytes Size cap of the file
+ * @return 0 on success, -1 on error
+ */
+int orchestrator_attach_result_tier(const char* path, size_t max_bytes) {
+    int rc = -1;
+    
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled && !result_tier_open &&
+        cache_tier_open(&result_tier, path, sizeof(orchestrator_cached_result_t), max_bytes) == 0) {
+        result_tier_open = 1;
+        cache_service_set_tier(&result_cache, &result_tier);
+        rc = 0;
+    }
+    cache_lock_release(&result_cache_lock);
+    
+    return rc;
+}
+
+/**
+ * @brief Persist the cached results, then close the result tier
+ */
+void orchestrator_detach_result_tier(void) {
+    cache_lock_acquire(&result_cache_lock);
+    if (result_tier_open) {
+        if (result_cache_enabled) {
+            cache_service_persist(&result_cache);
+            cache_service_set_tier(&result_cache, NULL);
+        }
+        cache_tier_close(&result_tier);
+        result_tier_open = 0;
+    }
+    cache_lock_release(&result_cache_lock);
+}
+
+/**
+ * @brief Drop every cached result in O(1)
+ * @return 0 on success, -1 if the cache is disabled
+ */
+int orchestrator_invalidate_result_cache(void) {
+    int rc = -1;
+    
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled) {
+        rc = cache_service_invalidate(&result_cache, NULL);
+    }
+    cache_lock_release(&result_cache_lock);
+    
+    return rc;
+}
+
+/**
+ * @brief Look a request up in the result cache
+ * @return 1 and fills result on a hit, 0 otherwise
+ */
+static int orchestrator_lookup_result(const calculation_request_t* request, calculation_result_t* result) {
+    orchestrator_cached_result_t key;
+    orchestrator_cached_result_t record;
+    size_t record_len = sizeof(record);
+    int hit = 0;
+    
+    orchestrator_fill_record_key(request, &key);
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled &&
+        cache_service_get(&result_cache, orchestrator_record_hash(&key), (uint8_t*)&record, &record_len) == 0 &&
+        record_len == sizeof(record)) {
+        // A hash collision stores a different request under the same key
+        hit = memcmp(&key, &record, offsetof(orchestrator_cached_result_t, pdf_result)) == 0;
+    }
+    cache_lock_release(&result_cache_lock);
+    
+    if (hit) {
+        result->pdf_result = record.pdf_result;
+        result->cdf_result = record.cdf_result;
+        result->success = 1;
+        result->error_message = NULL;
+        result->from_cache = 1;
+    }
+    
+    return hit;
+}
+
+/**
+ * @brief Store a successful result in the result cache
+ */
+static void orchestrator_store_result(const calculation_request_t* request, const calculation_result_t* result) {
+    orchestrator_cached_result_t record;
+    
+    orchestrator_fill_record_key(request, &record);
+    record.pdf_result = result->pdf_result;
+    record.cdf_result = result->cdf_result;
+    
+    cache_lock_acquire(&result_cache_lock);
+    if (result_cache_enabled) {
+        cache_service_set(&result_cache, orchestrator_record_hash(&record), (const uint8_t*)&record, sizeof(record));
+    }
+    cache_lock_release(&result_cache_lock);
+    
+    cache_budget_poll();
+}
+
+/**
+ * @brief Seed the result cache with the newest results from history
+ * @param history History restored at launch
+ * @param max_entries Most results to insert
+ * @return Number of results inserted
+ */
+size_t orchestrator_warm_result_cache(const calculation_history_t* history, size_t max_entries) {
+    int enabled;
+    
+    cache_lock_acquire(&result_cache_lock);
+    enabled = result_cache_enabled;
+    cache_lock_release(&result_cache_lock);
+    if (!history || max_entries == 0 || !enabled) {
+        return 0;
+    }
+    
+    size_t count = history_get_count(history);
+    if (count > max_entries) {
+        count = max_entries;
+    }
+    
+    size_t inserted = 0;
+    for (size_t i = count; i-- > 0;) {
+        const calculation_entry_t* entry = history_get_entry(history, (uint8_t)i);
+        const distribution_model_t* model = entry ? get_distribution_model((distribution_type_t)entry->distribution_type) : NULL;
+        if (!model || !isfinite(entry->pdf_result) || !isfinite(entry->cdf_result)) {
+            continue;
+        }
+        
+        // History keeps no parameter count; the model's is the only one that validates
+        calculation_request_t request;
+        memset(&request, 0, sizeof(request));
+        request.distribution = (distribution_type_t)entry->distribution_type;
+        request.param_count = model->param_count;
+        memcpy(request.parameters, entry->parameters, sizeof(request.parameters));
+        request.input_value = entry->input_value;
+        
+        // Only results the calculation path would itself have cached
+        if (orchestrator_validate_calculation_request(&request) != CALC_SUCCESS ||
+            orchestrator_validate_input_value(request.input_value, request.distribution) != 0) {
+            continue;
+        }
+        
+        calculation_result_t result;
+        memset(&result, 0, sizeof(result));
+        result.pdf_result = entry->pdf_result;
+        result.cdf_result = entry->cdf_result;
+        orchestrator_store_result(&request, &result);
+        inserted++;
+    }
+    
+    return inserted;
+}
+
 /**
  * @brief Main calculation orchestration function using application state
  * @param state Application state containing distribution and parameters
@@ -49,20 +391,19 @@ int orchestrator_calculate(app_state_t* state, double input_value, calculation_r
 }
 
 /**
- * @brief Calculate PDF and CDF using a calculation request
- * @param request Calculation request with distribution and parameters
- * @param result Pointer to store calculation results
- * @return 0 on success, negative error code on failure
+ * @brief Body of orchestrator_calculate_with_request, inside its trace span
  */
-int orchestrator_calculate_with_request(const calculation_request_t* request, calculation_result_t* result) {
-    if (!request || !result) {
-        return CALC_ERROR_STATE_INVALID;
-    }
+static int orchestrator_calculate_untraced(const calculation_request_t* request, calculation_result_t* result) {
     
     // Initialize result
     memset(result, 0, sizeof(calculation_result_t));
     result->input_value = request->input_value;
     
+    // Only validated, successful results are ever cached
+    if (orchestrator_lookup_result(request, result)) {
+        return CALC_SUCCESS;
+    }
+    
     // Validate calculation request
     int validation_result = orchestrator_validate_calculation_request(request);
     if (validation_result != CALC_SUCCESS) {
@@ -79,14 +420,13 @@ int orchestrator_calculate_with_request(const calculation_request_t* request, ca
         return CALC_ERROR_INVALID_DISTRIBUTION;
     }
     
-    // Validate parameters using distribution's validator
-    if (dist->validate_params) {
-        double* params = (double*)request->parameters;
-        if (dist->validate_params(params, request->param_count) != 0) {
-            result->success = 0;
-            result->error_message = "Invalid parameters for distribution";
-            return CALC_ERROR_INVALID_PARAMETERS;
-        }
+    // Preparing runs the distribution's validator once; the prepared kernels
+    // then evaluate without re-checking parameters on the PDF and CDF calls
+    distribution_prepared_t prepared;
+    if (distribution_prepare_with(dist, (double*)request->parameters, request->param_count, &prepared) != 0) {
+        result->success = 0;
+        result->error_message = "Invalid parameters for distribution";
+        return CALC_ERROR_INVALID_PARAMETERS;
     }
     
     // Validate input value for this distribution
@@ -96,37 +436,481 @@ int orchestrator_calculate_with_request(const calculation_request_t* request, ca
         return CALC_ERROR_INVALID_INPUT;
     }
     
+    // A discrete parameter set is looked up in its PMF table, built on first use
+    int from_table = pmf_table_cache_point(&prepared, request->input_value, &result->pdf_result,
+                                           &result->cdf_result, NULL) == 0;
+    
     // Perform PDF calculation
-    if (dist->pdf) {
-        double* params = (double*)request->parameters;
-        result->pdf_result = dist->pdf(request->input_value, params, request->param_count);
+    if (!from_table) {
+        result->pdf_result = prepared.pdf(&prepared, request->input_value);
+    }
+    
+    // Check for calculation errors (NaN, infinity)
+    if (isnan(result->pdf_result) || isinf(result->pdf_result)) {
+        result->success = 0;
+        result->error_message = "PDF calculation failed";
+        return CALC_ERROR_CALCULATION_FAILED;
+    }
+    
+    // Perform CDF calculation
+    if (!from_table) {
+        result->cdf_result = prepared.cdf(&prepared, request->input_value);
+    }
+    
+    // Check for calculation errors (NaN, infinity)
+    if (isnan(result->cdf_result) || isinf(result->cdf_result)) {
+        result->success = 0;
+        result->error_message = "CDF calculation failed";
+        return CALC_ERROR_CALCULATION_FAILED;
+    }
+    
+    result->success = 1;
+    result->error_message = NULL;
+    orchestrator_store_result(request, result);
+    return CALC_SUCCESS;
+}
+
+/**
+ * @brief Calculate PDF and CDF using a calculation request
+ * @param request Calculation request with distribution and parameters
+ * @param result Pointer to store calculation results
+ * @return 0 on success, negative error code on failure
+ */
+int orchestrator_calculate_with_request(const calculation_request_t* request, calculation_result_t* result) {
+    if (!request || !result) {
+        return CALC_ERROR_STATE_INVALID;
+    }
+    
+    CACHE_TRACE_BEGIN(CACHE_TRACE_SPAN_CALCULATE, request->distribution);
+    int calc_result = orchestrator_calculate_untraced(request, result);
+    CACHE_TRACE_END(CACHE_TRACE_SPAN_CALCULATE, request->distribution);
+    
+    return calc_result;
+}
+
+/**
+ * @brief Record a failed batch slot
+ */
+static void orchestrator_batch_fail(calculation_result_t* result, int* error_code, calculation_error_t error,
+                                    const char* message) {
+    result->success = 0;
+    result->error_message = message;
+    if (error_code) {
+        *error_code = error;
+    }
+}
+
+/**
+ * @brief Do two requests share a distribution and parameter set
+ * Compared as cache keys, so -0.0 and 0.0 and unused slots match.
+ */
+static int orchestrator_same_parameters(const calculation_request_t* a, const calculation_request_t* b) {
+    orchestrator_cached_result_t key_a;
+    orchestrator_cached_result_t key_b;
+    
+    if (a->distribution != b->distribution || a->param_count != b->param_count) {
+        return 0;
+    }
+    
+    orchestrator_fill_record_key(a, &key_a);
+    orchestrator_fill_record_key(b, &key_b);
+    return memcmp(key_a.parameters, key_b.parameters, sizeof(key_a.parameters)) == 0;
+}
+
+/**
+ * @brief Evaluate one chunk of a group through the prepared batch kernels
+ */
+static void orchestrator_batch_chunk(const distribution_prepared_t* prepared, const calculation_request_t* requests,
+                                     calculation_result_t* results, int* error_codes,
+                                     const size_t* slots, const double* x, size_t count) {
+    double pdf[DISTRIBUTION_BATCH_CHUNK];
+    double cdf[DISTRIBUTION_BATCH_CHUNK];
+    
+    if (pmf_table_cache_points(prepared, x, pdf, cdf, count) != 0) {
+        distribution_prepared_pdf_batch(prepared, x, pdf, count);
+        distribution_prepared_cdf_batch(prepared, x, cdf, count);
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        size_t slot = slots[i];
+        int* error_code = error_codes ? &error_codes[slot] : NULL;
         
-        // Check for calculation errors (NaN, infinity)
-        if (isnan(result->pdf_result) || isinf(result->pdf_result)) {
-            result->success = 0;
-            result->error_message = "PDF calculation failed";
-            return CALC_ERROR_CALCULATION_FAILED;
+        results[slot].pdf_result = pdf[i];
+        results[slot].cdf_result = cdf[i];
+        if (isnan(pdf[i]) || isinf(pdf[i])) {
+            orchestrator_batch_fail(&results[slot], error_code, CALC_ERROR_CALCULATION_FAILED, "PDF calculation failed");
+        } else if (isnan(cdf[i]) || isinf(cdf[i])) {
+            orchestrator_batch_fail(&results[slot], error_code, CALC_ERROR_CALCULATION_FAILED, "CDF calculation failed");
+        } else {
+            results[slot].success = 1;
+            if (error_code) {
+                *error_code = CALC_SUCCESS;
+            }
+            orchestrator_store_result(&requests[slot], &results[slot]);
+        }
+    }
+}
+
+/**
+ * @brief Calculate PDF and CDF for many requests at once
+ * Requests are grouped by distribution and parameter set: each group is
+ * validated and prepared once, and its inputs go through the prepared batch
+ * kernels DISTRIBUTION_BATCH_CHUNK at a time. Result cache hits are served
+ * first and successful results are stored, as for single requests. A failed
+ * request only fails its own slot.
+ * @param requests Array of count requests
+ * @param count Number of requests
+ * @param results Array of count results, filled in request order
+ * @param error_codes Optional array of count calculation_error_t codes (may be NULL)
+ * @return Number of successful results, or 0 if the arrays are invalid
+ */
+size_t orchestrator_calculate_batch(const calculation_request_t* requests, size_t count,
+                                    calculation_result_t* results, int* error_codes) {
+    if (!requests || !results || count == 0) {
+        return 0;
+    }
+    
+    // Grouping needs a done mark per request; without one, fall back to single calls
+    uint8_t* done = (uint8_t*)calloc(count, sizeof(uint8_t));
+    if (!done) {
+        size_t succeeded = 0;
+        for (size_t i = 0; i < count; i++) {
+            int rc = orchestrator_calculate_with_request(&requests[i], &results[i]);
+            if (error_codes) {
+                error_codes[i] = rc;
+            }
+            succeeded += (rc == CALC_SUCCESS);
         }
+        return succeeded;
     }
     
-    // Perform CDF calculation
-    if (dist->cdf) {
-        double* params = (double*)request->parameters;
-        result->cdf_result = dist->cdf(request->input_value, params, request->param_count);
+    for (size_t i = 0; i < count; i++) {
+        memset(&results[i], 0, sizeof(results[i]));
+        results[i].input_value = requests[i].input_value;
+        if (orchestrator_lookup_result(&requests[i], &results[i])) {
+            done[i] = 1;
+            if (error_codes) {
+                error_codes[i] = CALC_SUCCESS;
+            }
+        }
+    }
+    
+    for (size_t first = 0; first < count; first++) {
+        if (done[first]) {
+            continue;
+        }
+        
+        // The first pending request stands for its whole group
+        const calculation_request_t* leader = &requests[first];
+        calculation_error_t group_error = CALC_SUCCESS;
+        const char* group_message = NULL;
+        distribution_prepared_t prepared;
         
-        // Check for calculation errors (NaN, infinity)
-        if (isnan(result->cdf_result) || isinf(result->cdf_result)) {
-            result->success = 0;
-            result->error_message = "CDF calculation failed";
-            return CALC_ERROR_CALCULATION_FAILED;
+        int validation_result = orchestrator_validate_calculation_request(leader);
+        if (validation_result != CALC_SUCCESS) {
+            group_error = (calculation_error_t)validation_result;
+            group_message = orchestrator_get_error_message(group_error);
+        } else if (distribution_prepare_with(get_distribution(leader->distribution), (double*)leader->parameters,
+                                             leader->param_count, &prepared) != 0) {
+            group_error = CALC_ERROR_INVALID_PARAMETERS;
+            group_message = "Invalid parameters for distribution";
+        }
+        
+        size_t slots[DISTRIBUTION_BATCH_CHUNK];
+        double x[DISTRIBUTION_BATCH_CHUNK];
+        size_t pending = 0;
+        for (size_t i = first; i < count; i++) {
+            if (done[i] || !orchestrator_same_parameters(leader, &requests[i])) {
+                continue;
+            }
+            done[i] = 1;
+            
+            int* error_code = error_codes ? &error_codes[i] : NULL;
+            if (group_error != CALC_SUCCESS) {
+                orchestrator_batch_fail(&results[i], error_code, group_error, group_message);
+                continue;
+            }
+            if (orchestrator_validate_input_value(requests[i].input_value, requests[i].distribution) != 0) {
+                orchestrator_batch_fail(&results[i], error_code, CALC_ERROR_INVALID_INPUT,
+                                        "Invalid input value for distribution");
+                continue;
+            }
+            
+            slots[pending] = i;
+            x[pending++] = requests[i].input_value;
+            if (pending == DISTRIBUTION_BATCH_CHUNK) {
+                orchestrator_batch_chunk(&prepared, requests, results, error_codes, slots, x, pending);
+                pending = 0;
+            }
+        }
+        if (pending > 0) {
+            orchestrator_batch_chunk(&prepared, requests, results, error_codes, slots, x, pending);
         }
     }
+    free(done);
     
+    size_t succeeded = 0;
+    for (size_t i = 0; i < count; i++) {
+        succeeded += (results[i].success != 0);
+    }
+    return succeeded;
+}
+
+/**
+ * @brief Validate a request's distribution and parameters and prepare a handle
+ * @return CALC_SUCCESS or the calculation_error_t describing the failure
+ */
+static int orchestrator_prepare_request(const calculation_request_t* request, distribution_prepared_t* prepared) {
+    int validation_result = orchestrator_validate_calculation_request(request);
+    if (validation_result != CALC_SUCCESS) {
+        return validation_result;
+    }
+    
+    const distribution_t* dist = get_distribution(request->distribution);
+    if (!dist) {
+        return CALC_ERROR_INVALID_DISTRIBUTION;
+    }
+    
+    if (distribution_prepare_with(dist, (double*)request->parameters, request->param_count, prepared) != 0) {
+        return CALC_ERROR_INVALID_PARAMETERS;
+    }
+    
+    return CALC_SUCCESS;
+}
+
+/**
+ * @brief Survival function P(X > x) for a request
+ * @param request Calculation request; input_value is x
+ * @param survival Receives the probability
+ * @return CALC_SUCCESS or error code
+ */
+int orchestrator_calculate_sf(const calculation_request_t* request, double* survival) {
+    distribution_prepared_t prepared;
+    
+    if (!request || !survival) {
+        return CALC_ERROR_STATE_INVALID;
+    }
+    
+    int prepare_result = orchestrator_prepare_request(request, &prepared);
+    if (prepare_result != CALC_SUCCESS) {
+        return prepare_result;
+    }
+    
+    if (orchestrator_validate_input_value(request->input_value, request->distribution) != 0) {
+        return CALC_ERROR_INVALID_INPUT;
+    }
+    
+    if (pmf_table_cache_point(&prepared, request->input_value, NULL, NULL, survival) != 0) {
+        *survival = distribution_prepared_sf(&prepared, request->input_value);
+    }
+    return isnan(*survival) ? CALC_ERROR_CALCULATION_FAILED : CALC_SUCCESS;
+}
+
+/**
+ * @brief Interval probability P(lower < X <= upper) for a request
+ * @param request Calculation request; input_value is not used
+ * @param lower Exclusive lower bound
+ * @param upper Inclusive upper bound, not below lower
+ * @param probability Receives the probability
+ * @return CALC_SUCCESS or error code
+ */
+int orchestrator_calculate_interval(const calculation_request_t* request, double lower, double upper,
+                                    double* probability) {
+    distribution_prepared_t prepared;
+    
+    if (!request || !probability) {
+        return CALC_ERROR_STATE_INVALID;
+    }
+    
+    int prepare_result = orchestrator_prepare_request(request, &prepared);
+    if (prepare_result != CALC_SUCCESS) {
+        return prepare_result;
+    }
+    
+    if (isnan(lower) || isnan(upper) || upper < lower) {
+        return CALC_ERROR_INVALID_INPUT;
+    }
+    
+    if (pmf_table_cache_interval(&prepared, lower, upper, probability) != 0) {
+        *probability = distribution_prepared_interval(&prepared, lower, upper);
+    }
+    return isnan(*probability) ? CALC_ERROR_CALCULATION_FAILED : CALC_SUCCESS;
+}
+
+/**
+ * @brief Queue the exact calculation of a previewed request
+ * @return Its ticket (shared with an identical pending request), or 0 if the queue is full
+ */
+static uint32_t orchestrator_queue_refinement(const calculation_request_t* request) {
+    uint32_t ticket = 0;
+    
+    cache_lock_acquire(&refinement_lock);
+    for (size_t i = 0; i < refinement_count; i++) {
+        size_t slot = (refinement_head + i) % ORCHESTRATOR_REFINEMENT_QUEUE_LEN;
+        if (orchestrator_same_parameters(&refinement_requests[slot], request) &&
+            refinement_requests[slot].input_value == request->input_value) {
+            ticket = refinement_tickets[slot];
+            break;
+        }
+    }
+    
+    if (ticket == 0 && refinement_count < ORCHESTRATOR_REFINEMENT_QUEUE_LEN) {
+        size_t slot = (refinement_head + refinement_count) % ORCHESTRATOR_REFINEMENT_QUEUE_LEN;
+        
+        // 0 means "no refinement", so the counter skips it when it wraps
+        if (++refinement_next_ticket == 0) {
+            refinement_next_ticket = 1;
+        }
+        ticket = refinement_next_ticket;
+        refinement_requests[slot] = *request;
+        refinement_tickets[slot] = ticket;
+        refinement_count++;
+    }
+    cache_lock_release(&refinement_lock);
+    
+    return ticket;
+}
+
+/**
+ * @brief Answer a request at once, previewing its CDF when the exact one is expensive
+ * @param request Calculation request
+ * @param result Receives the exact result, or a provisional one
+ * @param ticket Receives the refinement ticket, 0 when result is final
+ * @return CALC_SUCCESS or error code
+ */
+int orchestrator_calculate_progressive(const calculation_request_t* request, calculation_result_t* result,
+                                       uint32_t* ticket) {
+    distribution_prepared_t prepared;
+    double preview;
+    
+    if (!request || !result || !ticket) {
+        return CALC_ERROR_STATE_INVALID;
+    }
+    
+    *ticket = 0;
+    memset(result, 0, sizeof(calculation_result_t));
+    result->input_value = request->input_value;
+    
+    if (orchestrator_lookup_result(request, result)) {
+        return CALC_SUCCESS;
+    }
+    
+    // Invalid, cheap and preview-less requests are answered exactly, errors included
+    if (orchestrator_prepare_request(request, &prepared) != CALC_SUCCESS ||
+        orchestrator_validate_input_value(request->input_value, request->distribution) != 0 ||
+        distribution_cdf_cost(request->distribution, request->parameters, request->input_value) <
+            ORCHESTRATOR_PREVIEW_MIN_COST ||
+        distribution_cdf_preview(request->distribution, request->parameters, request->input_value, &preview) != 0) {
+        return orchestrator_calculate_with_request(request, result);
+    }
+    
+    // The PDF is a closed form on the prepared handle, so only the CDF is previewed
+    result->pdf_result = prepared.pdf(&prepared, request->input_value);
+    if (isnan(result->pdf_result) || isinf(result->pdf_result) ||
+        (*ticket = orchestrator_queue_refinement(request)) == 0) {
+        return orchestrator_calculate_with_request(request, result);
+    }
+    
+    result->cdf_result = preview;
     result->success = 1;
     result->error_message = NULL;
+    result->provisional = 1;
     return CALC_SUCCESS;
 }
 
+/**
+ * @brief Run queued refinements, oldest first
+ * @param tickets Receives the ticket of each refined result
+ * @param results Receives the exact results
+ * @param capacity Most refinements to run in this call
+ * @return Number of refinements run
+ */
+size_t orchestrator_run_refinements(uint32_t* tickets, calculation_result_t* results, size_t capacity) {
+    size_t done = 0;
+    
+    if (!tickets || !results) {
+        return 0;
+    }
+    
+    while (done < capacity) {
+        calculation_request_t request;
+        
+        cache_lock_acquire(&refinement_lock);
+        if (refinement_count == 0) {
+            cache_lock_release(&refinement_lock);
+            break;
+        }
+        request = refinement_requests[refinement_head];
+        tickets[done] = refinement_tickets[refinement_head];
+        refinement_head = (refinement_head + 1) % ORCHESTRATOR_REFINEMENT_QUEUE_LEN;
+        refinement_count--;
+        cache_lock_release(&refinement_lock);
+        
+        orchestrator_calculate_with_request(&request, &results[done]);
+        done++;
+    }
+    
+    return done;
+}
+
+/**
+ * @brief Number of refinements waiting in the queue
+ */
+size_t orchestrator_pending_refinements(void) {
+    size_t count;
+    
+    cache_lock_acquire(&refinement_lock);
+    count = refinement_count;
+    cache_lock_release(&refinement_lock);
+    
+    return count;
+}
+
+/**
+ * @brief Drop every queued refinement, e.g. when the page that asked goes away
+ */
+void orchestrator_cancel_refinements(void) {
+    cache_lock_acquire(&refinement_lock);
+    refinement_head = 0;
+    refinement_count = 0;
+    cache_lock_release(&refinement_lock);
+}
+
+/**
+ * @brief Set up a resumable calculation; no work happens until the first step
+ * @param job Job state
+ * @param request Calculation request, copied
+ */
+void orchestrator_job_init(orchestrator_job_t* job, const calculation_request_t* request) {
+    if (!job || !request) {
+        return;
+    }
+    
+    memset(job, 0, sizeof(orchestrator_job_t));
+    job->request = *request;
+    job->result.input_value = request->input_value;
+    job->code = CALC_ERROR_STATE_INVALID;
+}
+
+/**
+ * @brief Run a calculation job
+ * @param task orchestrator_job_t state
+ * @param max_units Unused: the calculation finishes in one step
+ * @return 1, as the result is final after the first step
+ */
+int orchestrator_job_step(void* task, uint64_t max_units) {
+    orchestrator_job_t* job = (orchestrator_job_t*)task;
+    
+    (void)max_units;
+    if (!job || job->finished) {
+        return 1;
+    }
+    
+    job->code = orchestrator_calculate_with_request(&job->request, &job->result);
+    job->finished = 1;
+    return 1;
+}
+
 /**
  * @brief Validate a calculation request
  * @param request Calculation request to validate
@@ -175,6 +959,15 @@ int orchestrator_process_input(const char* input_str, double* value) {
         return -1;
     }
     
+    // Plain decimals take the exact fast path; other strtod forms fall through
+    decimal_parse_status_t status = decimal_parse(input_str, strlen(input_str), value);
+    if (status == DECIMAL_PARSE_OK) {
+        return 0;
+    }
+    if (status == DECIMAL_PARSE_RANGE) {
+        return -1;  // Number too large
+    }
+    
     char* endptr;
     *value = strtod(input_str, &endptr);
     
@@ -245,14 +1038,14 @@ void orchestrator_format_result(const calculation_result_t* result, char* buffer
     if (orchestrator_should_use_scientific(result->pdf_result)) {
         orchestrator_format_scientific(result->pdf_result, pdf_str, sizeof(pdf_str));
     } else {
-        snprintf(pdf_str, sizeof(pdf_str), "%.4f", result->pdf_result);
+        decimal_format_fixed(result->pdf_result, 4, pdf_str, sizeof(pdf_str));
     }
     
     // Format CDF result
     if (orchestrator_should_use_scientific(result->cdf_result)) {
         orchestrator_format_scientific(result->cdf_result, cdf_str, sizeof(cdf_str));
     } else {
-        snprintf(cdf_str, sizeof(cdf_str), "%.4f", result->cdf_result);
+        decimal_format_fixed(result->cdf_result, 4, cdf_str, sizeof(cdf_str));
     }
     
     snprintf(buffer, buffer_size, "PDF: %s\\nCDF: %s", pdf_str, cdf_str);
@@ -269,7 +1062,7 @@ void orchestrator_format_scientific(double value, char* buffer, size_t buffer_si
         return;
     }
     
-    snprintf(buffer, buffer_size, "%.2e", value);
+    decimal_format_scientific(value, 2, buffer, buffer_size);
 }
 
 /**
@@ -1,6 +1,7 @@
 #ifndef CALCULATION_ORCHESTRATOR_H
 #define CALCULATION_ORCHESTRATOR_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "../../models/state/app_state.h"
 #include "../../core/distributions/lib/distribution_interface.h"
@@ -14,6 +15,8 @@ typedef struct {
     double input_value;
     int success;
     const char* error_message;
+    int from_cache;  // 1 when served by the result cache
+    int provisional; // 1 for a progressive preview whose refined result is queued
 } calculation_result_t;
 
 /**
@@ -45,6 +48,99 @@ int orchestrator_calculate(app_state_t* state, double input_value, calculation_r
 int orchestrator_calculate_with_request(const calculation_request_t* request, calculation_result_t* result);
 int orchestrator_validate_calculation_request(const calculation_request_t* request);
 
+/**
+ * @brief Batch calculation
+ * Fills results[i] (and error_codes[i], if not NULL) for every request,
+ * preparing each distinct distribution and parameter set once and sending
+ * its inputs through the batched kernels. Errors are per request and never
+ * abort the batch. Returns the number of successful results.
+ */
+size_t orchestrator_calculate_batch(const calculation_request_t* requests, size_t count,
+                                    calculation_result_t* results, int* error_codes);
+
+/**
+ * @brief Tail and interval probabilities
+ * orchestrator_calculate_sf gives P(X > input_value), without the
+ * cancellation of 1 - CDF in the upper tail. orchestrator_calculate_interval
+ * gives P(lower < X <= upper) and ignores input_value; either bound may be
+ * infinite. Both validate and prepare once and bypass the result cache.
+ */
+int orchestrator_calculate_sf(const calculation_request_t* request, double* survival);
+int orchestrator_calculate_interval(const calculation_request_t* request, double lower, double upper,
+                                    double* probability);
+
+/**
+ * @brief Progressive evaluation
+ * orchestrator_calculate_progressive always answers at once. Cached, cheap,
+ * invalid and preview-less requests get their exact result and ticket 0.
+ * When distribution_cdf_cost reaches ORCHESTRATOR_PREVIEW_MIN_COST, the
+ * answer holds the exact PDF and a distribution_cdf_preview CDF, flagged
+ * provisional, and the exact calculation is queued under a nonzero ticket
+ * (an identical pending request shares its ticket). The host drains the
+ * queue from its idle hook with orchestrator_run_refinements, on the same
+ * thread, as with cache_service_run_prefetch; each refined result also
+ * lands in the result cache.
+ */
+#define ORCHESTRATOR_PREVIEW_MIN_COST 256.0
+#define ORCHESTRATOR_REFINEMENT_QUEUE_LEN 8
+
+int orchestrator_calculate_progressive(const calculation_request_t* request, calculation_result_t* result,
+                                       uint32_t* ticket);
+size_t orchestrator_run_refinements(uint32_t* tickets, calculation_result_t* results, size_t capacity);
+size_t orchestrator_pending_refinements(void);
+void orchestrator_cancel_refinements(void);
+
+/**
+ * @brief Calculation job for job_scheduler.h
+ * orchestrator_job_step has the job_step_fn signature, so calculations queue
+ * by priority alongside the resumable simulations. Every distribution's CDF
+ * is a closed form, an incomplete beta or gamma, or a short tail sum from
+ * the mode, so the job finishes in its first step through
+ * orchestrator_calculate_with_request. Once a step returns 1, code and
+ * result are final, and a successful result is in the result cache.
+ */
+typedef struct {
+    calculation_request_t request;
+    calculation_result_t result;
+    int finished;
+    int code;        // CALC_SUCCESS or error code once finished
+} orchestrator_job_t;
+
+void orchestrator_job_init(orchestrator_job_t* job, const calculation_request_t* request);
+int orchestrator_job_step(void* job, uint64_t max_units);
+
+/**
+ * @brief Opt-in result cache
+ * Successful results are kept in a native cache_service_t keyed by
+ * orchestrator_request_hash and checked against the full request on a hit.
+ * Invalidation bumps the cache generation, so it costs O(1) whatever the size.
+ */
+int orchestrator_enable_result_cache(size_t capacity_entries);
+void orchestrator_disable_result_cache(void);
+int orchestrator_invalidate_result_cache(void);
+uint32_t orchestrator_request_hash(const calculation_request_t* request);
+
+/**
+ * @brief Persistent second level for the result cache
+ * Results the cache evicts are kept in a slotted file of at most max_bytes
+ * at path and read back on a miss before recomputing, so they survive a
+ * restart. Attach after orchestrator_enable_result_cache; the tier stays
+ * attached across re-enables until detached. Detaching writes every cached
+ * result to the file first, so call it before the app exits.
+ * @return 0 on success, -1 if the cache is disabled or the file cannot be opened
+ */
+int orchestrator_attach_result_tier(const char* path, size_t max_bytes);
+void orchestrator_detach_result_tier(void);
+
+/**
+ * @brief Startup warm-up: seed the result cache from persisted history
+ * Inserts the newest max_entries history results whose request still
+ * validates, oldest first so the most recent stay freshest in the clock.
+ * Call after history_manager_load and orchestrator_enable_result_cache.
+ * @return Number of results inserted (0 if the cache is disabled)
+ */
+size_t orchestrator_warm_result_cache(const calculation_history_t* history, size_t max_entries);
+
 /**
  * @brief Input processing functions
  */
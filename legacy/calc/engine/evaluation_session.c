@@ -0,0 +1,194 @@
+#include "evaluation_session.h"
+#include "pmf_table_cache.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Initialize an empty session; everything starts dirty
+ * @param session Pointer to session structure
+ */
+void evaluation_session_init(evaluation_session_t* session) {
+    if (!session) {
+        return;
+    }
+    
+    memset(session, 0, sizeof(*session));
+    session->distribution = DIST_COUNT;
+    session->dirty = EVALUATION_DIRTY_ALL;
+}
+
+/**
+ * @brief Free the session's series buffer
+ * @param session Pointer to session structure
+ */
+void evaluation_session_destroy(evaluation_session_t* session) {
+    if (!session) {
+        return;
+    }
+    
+    free(session->series);
+    evaluation_session_init(session);
+}
+
+/**
+ * @brief Mirror the state's distribution and parameters
+ * @param session Pointer to session structure
+ * @param state Application state being edited
+ * @return 1 if they changed, 0 if not, -1 on invalid arguments
+ */
+int evaluation_session_sync(evaluation_session_t* session, const app_state_t* state) {
+    if (!session || !state || state->parameter_count > MAX_PARAMETERS) {
+        return -1;
+    }
+    
+    distribution_type_t distribution = (distribution_type_t)state->current_distribution;
+    if (distribution == session->distribution && state->parameter_count == session->param_count &&
+        memcmp(state->current_parameters, session->parameters, state->parameter_count * sizeof(double)) == 0) {
+        return 0;
+    }
+    
+    session->distribution = distribution;
+    session->param_count = state->parameter_count;
+    memset(session->parameters, 0, sizeof(session->parameters));
+    memcpy(session->parameters, state->current_parameters, state->parameter_count * sizeof(double));
+    
+    // Both cached points belong to the old parameters
+    session->current.valid = 0;
+    session->previous.valid = 0;
+    session->dirty = EVALUATION_DIRTY_ALL;
+    return 1;
+}
+
+/**
+ * @brief Set the evaluation point; only the point depends on it
+ * @param session Pointer to session structure
+ * @param x New input value
+ * @return 0 on success, -1 for a NULL session
+ */
+int evaluation_session_set_x(evaluation_session_t* session, double x) {
+    if (!session) {
+        return -1;
+    }
+    
+    if (x != session->x || !session->current.valid) {
+        session->x = x;
+        session->dirty |= EVALUATION_DIRTY_POINT;
+    }
+    return 0;
+}
+
+/**
+ * @brief Prepare the handle if the parameters changed
+ * @return 0 on success, -1 if the parameters are invalid
+ */
+static int evaluation_session_ensure_handle(evaluation_session_t* session) {
+    if (!(session->dirty & EVALUATION_DIRTY_HANDLE)) {
+        return 0;
+    }
+    
+    if (distribution_prepare(session->distribution, session->parameters, session->param_count,
+                             &session->prepared) != 0) {
+        return -1;
+    }
+    session->stats.prepares++;
+    session->dirty &= ~EVALUATION_DIRTY_HANDLE;
+    return 0;
+}
+
+/**
+ * @brief Evaluate the point at session->x, reusing the last two points where possible
+ */
+static void evaluation_session_evaluate_point(evaluation_session_t* session) {
+    const distribution_prepared_t* prepared = &session->prepared;
+    evaluation_point_t point;
+    double x = session->x;
+    
+    if (session->previous.valid && session->previous.x == x) {
+        // Stepping back to where the user just was
+        point = session->previous;
+        session->stats.point_reuses++;
+    } else if (pmf_table_cache_point(prepared, x, &point.pdf, &point.cdf, NULL) == 0) {
+        // The parameters' PMF table, shared with the orchestrator and charts
+        point.x = x;
+        point.valid = 1;
+        session->stats.table_lookups++;
+    } else {
+        point.x = x;
+        point.pdf = prepared->pdf(prepared, x);
+        point.cdf = prepared->cdf(prepared, x);
+        point.valid = 1;
+        session->stats.point_evaluations++;
+    }
+    
+    if (session->current.valid) {
+        session->previous = session->current;
+    }
+    session->current = point;
+}
+
+/**
+ * @brief PDF/PMF and CDF at the session's x
+ * @param session Pointer to session structure
+ * @param pdf Receives the PDF/PMF (may be NULL)
+ * @param cdf Receives the CDF (may be NULL)
+ * @return 0 on success, -1 if the parameters are invalid
+ */
+int evaluation_session_point(evaluation_session_t* session, double* pdf, double* cdf) {
+    if (!session || evaluation_session_ensure_handle(session) != 0) {
+        return -1;
+    }
+    
+    if ((session->dirty & EVALUATION_DIRTY_POINT) || !session->current.valid) {
+        evaluation_session_evaluate_point(session);
+        session->dirty &= ~EVALUATION_DIRTY_POINT;
+    }
+    
+    if (pdf) *pdf = session->current.pdf;
+    if (cdf) *cdf = session->current.cdf;
+    return 0;
+}
+
+/**
+ * @brief Chart samples of [x_min, x_max], filled only when the parameters or range changed
+ * @param session Pointer to session structure
+ * @param x_min First sample point
+ * @param x_max Last sample point
+ * @param count Number of samples
+ * @param values Receives the session-owned samples
+ * @return 0 on success, -1 on invalid parameters, range or allocation failure
+ */
+int evaluation_session_series(evaluation_session_t* session, double x_min, double x_max, size_t count,
+                              const double** values) {
+    if (!session || !values || count == 0 || evaluation_session_ensure_handle(session) != 0) {
+        return -1;
+    }
+    
+    if (!(session->dirty & EVALUATION_DIRTY_SERIES) && session->series_count == count &&
+        session->series_min == x_min && session->series_max == x_max) {
+        *values = session->series;
+        return 0;
+    }
+    
+    if (count > session->series_capacity) {
+        double* grown = (double*)realloc(session->series, count * sizeof(double));
+        if (!grown) {
+            return -1;
+        }
+        session->series = grown;
+        session->series_capacity = count;
+    }
+    
+    if (pmf_table_cache_series(&session->prepared, x_min, x_max, count, session->series) != 0 &&
+        distribution_prepared_series(&session->prepared, x_min, x_max, count, session->series) != 0) {
+        session->series_count = 0;
+        return -1;
+    }
+    session->series_count = count;
+    session->series_min = x_min;
+    session->series_max = x_max;
+    session->dirty &= ~EVALUATION_DIRTY_SERIES;
+    session->stats.series_fills++;
+    
+    *values = session->series;
+    return 0;
+}
@@ -0,0 +1,96 @@
+#ifndef EVALUATION_SESSION_H
+#define EVALUATION_SESSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../../models/state/app_state.h"
+#include "../../core/distributions/lib/distribution_interface.h"
+
+/**
+ * @brief Derived values a session keeps, as dirty bits
+ * The dependency graph is parameters -> handle -> {point, series}, plus
+ * x -> point and range -> series; a change marks only what depends on it.
+ */
+#define EVALUATION_DIRTY_HANDLE 0x01
+#define EVALUATION_DIRTY_POINT 0x02
+#define EVALUATION_DIRTY_SERIES 0x04
+#define EVALUATION_DIRTY_ALL (EVALUATION_DIRTY_HANDLE | EVALUATION_DIRTY_POINT | EVALUATION_DIRTY_SERIES)
+
+/**
+ * @brief One evaluated point
+ */
+typedef struct {
+    double x;
+    double pdf;
+    double cdf;
+    int valid;
+} evaluation_point_t;
+
+/**
+ * @brief Work counters, for checking that an edit redid only what it had to
+ */
+typedef struct {
+    uint32_t prepares;
+    uint32_t point_evaluations;
+    uint32_t point_reuses;   // points served from the previous evaluation
+    uint32_t table_lookups;  // points served from the shared PMF table cache
+    uint32_t series_fills;
+} evaluation_session_stats_t;
+
+/**
+ * @brief Incremental evaluation session for one distribution page
+ * Mirrors the distribution and parameters of an app_state_t and caches the
+ * prepared handle, the current and previous point and a chart series.
+ * Editing x alone re-evaluates the point only; a discrete point is read
+ * from the pmf_table_cache table of the parameters when it has one, and
+ * moving back to the previous x reuses it outright. A parameter change
+ * drops the handle and everything derived from it.
+ */
+typedef struct {
+    distribution_type_t distribution;
+    double parameters[MAX_PARAMETERS];
+    uint8_t param_count;
+    uint32_t dirty;
+    
+    distribution_prepared_t prepared;
+    double x;
+    evaluation_point_t current;
+    evaluation_point_t previous;
+    
+    double* series;
+    size_t series_capacity;
+    size_t series_count;
+    double series_min;
+    double series_max;
+    
+    evaluation_session_stats_t stats;
+} evaluation_session_t;
+
+/**
+ * @brief Session lifecycle
+ */
+void evaluation_session_init(evaluation_session_t* session);
+void evaluation_session_destroy(evaluation_session_t* session);
+
+/**
+ * @brief Inputs
+ * evaluation_session_sync copies the state's distribution and parameters,
+ * invalidating dependents only if they differ; it returns 1 if they changed,
+ * 0 if not and -1 on invalid arguments. evaluation_session_set_x returns 0,
+ * or -1 for a NULL session.
+ */
+int evaluation_session_sync(evaluation_session_t* session, const app_state_t* state);
+int evaluation_session_set_x(evaluation_session_t* session, double x);
+
+/**
+ * @brief Outputs, recomputed only when dirty
+ * evaluation_session_point returns 0 with the PDF/PMF and CDF at x, or -1 if
+ * the parameters are invalid. evaluation_session_series returns the cached
+ * distribution_prepared_series samples of [x_min, x_max] through values
+ * (owned by the session, valid until the next change), or -1 on error.
+ */
+int evaluation_session_point(evaluation_session_t* session, double* pdf, double* cdf);
+int evaluation_session_series(evaluation_session_t* session, double x_min, double x_max, size_t count,
+                              const double** values);
+
+#endif // EVALUATION_SESSION_H
@@ -0,0 +1,579 @@
+#include "expression_engine.h"
+#include "../../core/math/decimal_parser.h"
+#include "../../core/math/math_utils.h"
+#include <math.h>
+#include <string.h>
+
+// Integer results below this are rounded to the integer they approximate
+#define EXPRESSION_MAX_EXACT_INTEGER 9007199254740992.0
+
+typedef enum {
+    EXPR_TOKEN_LITERAL,
+    EXPR_TOKEN_ANS,
+    EXPR_TOKEN_FUNCTION,
+    EXPR_TOKEN_PUNCT
+} expression_token_kind_t;
+
+typedef struct {
+    expression_token_kind_t kind;
+    uint8_t op;
+    char punct;
+    double value;
+    size_t end;
+    size_t scan_end;
+} expression_token_t;
+
+/**
+ * @brief Arity and binding of each operation
+ * Precedence only matters for the operators the parser stacks; higher binds tighter.
+ */
+typedef struct {
+    uint8_t arity;
+    uint8_t precedence;
+    uint8_t right_associative;
+} expression_op_info_t;
+
+static const expression_op_info_t expression_ops[EXPR_OP_COUNT] = {
+    [EXPR_OP_CONST] = {0, 0, 0},
+    [EXPR_OP_ANS] = {0, 0, 0},
+    [EXPR_OP_ADD] = {2, 1, 0},
+    [EXPR_OP_SUB] = {2, 1, 0},
+    [EXPR_OP_MUL] = {2, 2, 0},
+    [EXPR_OP_DIV] = {2, 2, 0},
+    [EXPR_OP_MOD] = {2, 2, 0},
+    [EXPR_OP_NEG] = {1, 3, 1},
+    [EXPR_OP_POW] = {2, 4, 1},
+    [EXPR_OP_FACTORIAL] = {1, 0, 0},
+    [EXPR_OP_NCR] = {2, 0, 0},
+    [EXPR_OP_NPR] = {2, 0, 0},
+    [EXPR_OP_GAMMA] = {1, 0, 0},
+    [EXPR_OP_LGAMMA] = {1, 0, 0},
+    [EXPR_OP_ERF] = {1, 0, 0},
+    [EXPR_OP_ERFC] = {1, 0, 0},
+    [EXPR_OP_SQRT] = {1, 0, 0},
+    [EXPR_OP_LN] = {1, 0, 0},
+    [EXPR_OP_LOG10] = {1, 0, 0},
+    [EXPR_OP_EXP] = {1, 0, 0},
+    [EXPR_OP_ABS] = {1, 0, 0},
+    [EXPR_OP_LPAREN] = {0, 0, 0},
+};
+
+typedef struct {
+    const char* name;
+    expression_token_kind_t kind;
+    uint8_t op;
+    double value;
+} expression_name_t;
+
+static const expression_name_t expression_names[] = {
+    {"pi", EXPR_TOKEN_LITERAL, EXPR_OP_CONST, 3.14159265358979323846},
+    {"e", EXPR_TOKEN_LITERAL, EXPR_OP_CONST, 2.71828182845904523536},
+    {"ans", EXPR_TOKEN_ANS, EXPR_OP_ANS, 0.0},
+    {"ncr", EXPR_TOKEN_FUNCTION, EXPR_OP_NCR, 0.0},
+    {"npr", EXPR_TOKEN_FUNCTION, EXPR_OP_NPR, 0.0},
+    {"gamma", EXPR_TOKEN_FUNCTION, EXPR_OP_GAMMA, 0.0},
+    {"lgamma", EXPR_TOKEN_FUNCTION, EXPR_OP_LGAMMA, 0.0},
+    {"erf", EXPR_TOKEN_FUNCTION, EXPR_OP_ERF, 0.0},
+    {"erfc", EXPR_TOKEN_FUNCTION, EXPR_OP_ERFC, 0.0},
+    {"sqrt", EXPR_TOKEN_FUNCTION, EXPR_OP_SQRT, 0.0},
+    {"ln", EXPR_TOKEN_FUNCTION, EXPR_OP_LN, 0.0},
+    {"log", EXPR_TOKEN_FUNCTION, EXPR_OP_LOG10, 0.0},
+    {"exp", EXPR_TOKEN_FUNCTION, EXPR_OP_EXP, 0.0},
+    {"abs", EXPR_TOKEN_FUNCTION, EXPR_OP_ABS, 0.0},
+};
+
+static int expression_is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static int expression_is_letter(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static int expression_is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/**
+ * @brief Round to the nearest integer when x is an integer's approximation
+ * The log-factorial and Lanczos paths land within a few ulps of exact
+ * factorials and binomials.
+ */
+static double expression_round_integer(double x) {
+    return (fabs(x) < EXPRESSION_MAX_EXACT_INTEGER) ? nearbyint(x) : x;
+}
+
+static int expression_is_count(double x) {
+    return x >= 0.0 && x <= 2147483647.0 && x == floor(x);
+}
+
+/**
+ * @brief Apply op to its arguments, shared by the evaluator and constant folding
+ */
+static double expression_apply(uint8_t op, const double* args) {
+    switch (op) {
+        case EXPR_OP_ADD: return args[0] + args[1];
+        case EXPR_OP_SUB: return args[0] - args[1];
+        case EXPR_OP_MUL: return args[0] * args[1];
+        case EXPR_OP_DIV: return args[0] / args[1];
+        case EXPR_OP_MOD: return fmod(args[0], args[1]);
+        case EXPR_OP_POW: return pow(args[0], args[1]);
+        case EXPR_OP_NEG: return -args[0];
+        case EXPR_OP_FACTORIAL:
+            if (!(args[0] >= 0.0)) return NAN;
+            return (args[0] == floor(args[0])) ? expression_round_integer(gamma_function(args[0] + 1.0))
+                                               : gamma_function(args[0] + 1.0);
+        case EXPR_OP_NCR:
+            if (!expression_is_count(args[0]) || !expression_is_count(args[1])) return NAN;
+            return expression_round_integer(exp(log_combination((int)args[0], (int)args[1])));
+        case EXPR_OP_NPR:
+            if (!expression_is_count(args[0]) || !expression_is_count(args[1])) return NAN;
+            if (args[1] > args[0]) return 0.0;
+            return expression_round_integer(exp(log_factorial((int)args[0]) - log_factorial((int)(args[0] - args[1]))));
+        case EXPR_OP_GAMMA:
+            // Positive integers take the factorial's rounding, so gamma(n) == (n - 1)!; the rest are poles
+            if (args[0] == floor(args[0])) {
+                return (args[0] > 0.0) ? expression_round_integer(gamma_function(args[0])) : NAN;
+            }
+            return gamma_function(args[0]);
+        case EXPR_OP_LGAMMA: return log_gamma_function(args[0]);
+        case EXPR_OP_ERF: return error_function(args[0]);
+        case EXPR_OP_ERFC: return complementary_error_function(args[0]);
+        case EXPR_OP_SQRT: return sqrt(args[0]);
+        case EXPR_OP_LN: return log(args[0]);
+        case EXPR_OP_LOG10: return log10(args[0]);
+        case EXPR_OP_EXP: return exp(args[0]);
+        case EXPR_OP_ABS: return fabs(args[0]);
+        default: return NAN;
+    }
+}
+
+/**
+ * @brief Lex the token starting at pos, which is not whitespace
+ * Numbers are [digits][.digits][e[+-]digits] with at least one digit; an
+ * 'e' not followed by an exponent ends the number, unless the text ends
+ * there, which is incomplete.
+ */
+static expression_status_t expression_lex(const char* text, size_t length, size_t pos, expression_token_t* token) {
+    size_t i = pos;
+
+    if (expression_is_digit(text[i]) || text[i] == '.') {
+        while (i < length && expression_is_digit(text[i])) i++;
+        if (i < length && text[i] == '.') {
+            i++;
+            while (i < length && expression_is_digit(text[i])) i++;
+        }
+        token->scan_end = i + 1;
+
+        if (i < length && (text[i] == 'e' || text[i] == 'E')) {
+            size_t j = i + 1;
+
+            if (j < length && (text[j] == '+' || text[j] == '-')) j++;
+            token->scan_end = j + 1;
+            if (j < length && expression_is_digit(text[j])) {
+                while (j < length && expression_is_digit(text[j])) j++;
+                token->scan_end = j + 1;
+                i = j;
+            } else if (j >= length) {
+                // "1e" or "1e-" at the end is an exponent still being typed
+                return EXPRESSION_INCOMPLETE;
+            }
+        }
+
+        token->kind = EXPR_TOKEN_LITERAL;
+        token->op = EXPR_OP_CONST;
+        token->end = i;
+        return decimal_parse(text + pos, i - pos, &token->value) == DECIMAL_PARSE_OK ? EXPRESSION_OK
+                                                                                     : EXPRESSION_SYNTAX;
+    }
+
+    if (expression_is_letter(text[i])) {
+        while (i < length && expression_is_letter(text[i])) i++;
+        token->end = i;
+        token->scan_end = i + 1;
+
+        for (size_t n = 0; n < sizeof(expression_names) / sizeof(expression_names[0]); n++) {
+            if (strlen(expression_names[n].name) == i - pos && strncmp(expression_names[n].name, text + pos, i - pos) == 0) {
+                token->kind = expression_names[n].kind;
+                token->op = expression_names[n].op;
+                token->value = expression_names[n].value;
+                return EXPRESSION_OK;
+            }
+        }
+
+        // A name cut short by the end of the text is still being typed
+        for (size_t n = 0; i == length && n < sizeof(expression_names) / sizeof(expression_names[0]); n++) {
+            if (strncmp(expression_names[n].name, text + pos, i - pos) == 0) {
+                return EXPRESSION_INCOMPLETE;
+            }
+        }
+        return EXPRESSION_SYNTAX;
+    }
+
+    token->kind = EXPR_TOKEN_PUNCT;
+    token->punct = text[i];
+    token->end = i + 1;
+    token->scan_end = i + 1;
+    return strchr("+-*/%^!(),", text[i]) ? EXPRESSION_OK : EXPRESSION_SYNTAX;
+}
+
+static expression_status_t expression_emit(expression_t* expression, expression_checkpoint_t* state,
+                                           uint8_t op, uint8_t operand) {
+    if (state->rpn_count >= EXPRESSION_MAX_TOKENS) {
+        return EXPRESSION_TOO_LARGE;
+    }
+
+    expression->rpn[state->rpn_count].op = op;
+    expression->rpn[state->rpn_count].operand = operand;
+    state->rpn_count++;
+    return EXPRESSION_OK;
+}
+
+static expression_status_t expression_push(expression_t* expression, expression_checkpoint_t* state,
+                                           uint8_t op, uint8_t call, uint8_t argc, int16_t parent) {
+    if (state->node_count >= EXPRESSION_MAX_TOKENS) {
+        return EXPRESSION_TOO_LARGE;
+    }
+
+    expression_node_t* node = &expression->nodes[state->node_count];
+    node->op = op;
+    node->call = call;
+    node->argc = argc;
+    node->parent = parent;
+    state->top = (int16_t)state->node_count;
+    state->node_count++;
+    return EXPRESSION_OK;
+}
+
+/**
+ * @brief Pop stacked operators into the postfix form down to the innermost open parenthesis
+ * @return EXPRESSION_OK, with state->top at the parenthesis or -1 if none is open
+ */
+static expression_status_t expression_unwind(expression_t* expression, expression_checkpoint_t* state) {
+    while (state->top >= 0 && expression->nodes[state->top].op != EXPR_OP_LPAREN) {
+        expression_status_t status = expression_emit(expression, state, expression->nodes[state->top].op, 0);
+
+        if (status != EXPRESSION_OK) {
+            return status;
+        }
+        state->top = expression->nodes[state->top].parent;
+    }
+    return EXPRESSION_OK;
+}
+
+/**
+ * @brief Feed one token to the shunting-yard parser
+ */
+static expression_status_t expression_accept(expression_t* expression, expression_checkpoint_t* state,
+                                             const expression_token_t* token) {
+    expression_status_t status;
+
+    if (state->pending_call != EXPR_OP_COUNT && !(token->kind == EXPR_TOKEN_PUNCT && token->punct == '(')) {
+        return EXPRESSION_SYNTAX;
+    }
+
+    switch (token->kind) {
+        case EXPR_TOKEN_LITERAL:
+            if (!state->expect_operand) return EXPRESSION_SYNTAX;
+            if (state->literal_count >= EXPRESSION_MAX_LITERALS) return EXPRESSION_TOO_LARGE;
+            expression->literals[state->literal_count] = token->value;
+            status = expression_emit(expression, state, EXPR_OP_CONST, (uint8_t)state->literal_count);
+            state->literal_count++;
+            state->expect_operand = 0;
+            return status;
+        case EXPR_TOKEN_ANS:
+            if (!state->expect_operand) return EXPRESSION_SYNTAX;
+            state->expect_operand = 0;
+            return expression_emit(expression, state, EXPR_OP_ANS, 0);
+        case EXPR_TOKEN_FUNCTION:
+            if (!state->expect_operand) return EXPRESSION_SYNTAX;
+            state->pending_call = token->op;
+            return EXPRESSION_OK;
+        case EXPR_TOKEN_PUNCT:
+            break;
+    }
+
+    const expression_node_t* open;
+    uint8_t op;
+
+    switch (token->punct) {
+        case '(':
+            if (!state->expect_operand) return EXPRESSION_SYNTAX;
+            status = expression_push(expression, state, EXPR_OP_LPAREN,
+                                     (state->pending_call != EXPR_OP_COUNT) ? state->pending_call : EXPR_OP_LPAREN,
+                                     1, state->top);
+            state->pending_call = EXPR_OP_COUNT;
+            return status;
+        case ',':
+            if (state->expect_operand) return EXPRESSION_SYNTAX;
+            if ((status = expression_unwind(expression, state)) != EXPRESSION_OK) return status;
+            if (state->top < 0) return EXPRESSION_SYNTAX;
+            open = &expression->nodes[state->top];
+            if (open->call == EXPR_OP_LPAREN) return EXPRESSION_SYNTAX;
+            if (open->argc >= expression_ops[open->call].arity) return EXPRESSION_ARITY;
+            // Entries are immutable: the count goes up in a copy that replaces it
+            status = expression_push(expression, state, EXPR_OP_LPAREN, open->call, (uint8_t)(open->argc + 1),
+                                     open->parent);
+            state->expect_operand = 1;
+            return status;
+        case ')':
+            if (state->expect_operand) return EXPRESSION_SYNTAX;
+            if ((status = expression_unwind(expression, state)) != EXPRESSION_OK) return status;
+            if (state->top < 0) return EXPRESSION_UNBALANCED;
+            open = &expression->nodes[state->top];
+            state->top = open->parent;
+            if (open->call == EXPR_OP_LPAREN) return EXPRESSION_OK;
+            if (open->argc != expression_ops[open->call].arity) return EXPRESSION_ARITY;
+            return expression_emit(expression, state, open->call, 0);
+        case '!':
+            if (state->expect_operand) return EXPRESSION_SYNTAX;
+            return expression_emit(expression, state, EXPR_OP_FACTORIAL, 0);
+        case '+':
+        case '-':
+            if (state->expect_operand) {
+                // Unary plus is dropped; unary minus waits on the stack for its operand
+                return (token->punct == '-') ? expression_push(expression, state, EXPR_OP_NEG, 0, 0, state->top)
+                                             : EXPRESSION_OK;
+            }
+            op = (token->punct == '+') ? EXPR_OP_ADD : EXPR_OP_SUB;
+            break;
+        case '*': op = EXPR_OP_MUL; break;
+        case '/': op = EXPR_OP_DIV; break;
+        case '%': op = EXPR_OP_MOD; break;
+        case '^': op = EXPR_OP_POW; break;
+        default: return EXPRESSION_SYNTAX;
+    }
+
+    if (state->expect_operand) {
+        return EXPRESSION_SYNTAX;
+    }
+
+    const expression_op_info_t* info = &expression_ops[op];
+    while (state->top >= 0 && expression->nodes[state->top].op != EXPR_OP_LPAREN) {
+        const expression_op_info_t* stacked = &expression_ops[expression->nodes[state->top].op];
+
+        if (stacked->precedence < info->precedence ||
+            (stacked->precedence == info->precedence && info->right_associative)) {
+            break;
+        }
+        if ((status = expression_emit(expression, state, expression->nodes[state->top].op, 0)) != EXPRESSION_OK) {
+            return status;
+        }
+        state->top = expression->nodes[state->top].parent;
+    }
+
+    state->expect_operand = 1;
+    return expression_push(expression, state, op, 0, 0, state->top);
+}
+
+/**
+ * @brief Append one postfix operation to the program, folding it if its operands are constants
+ * is_constant mirrors the evaluation stack. Constant operands are always
+ * the last instructions emitted and the last constants appended, so a fold
+ * drops both and appends the result.
+ */
+static expression_status_t expression_compile_op(expression_t* expression, uint8_t* is_constant, uint8_t op,
+                                                 uint8_t operand) {
+    expression_program_t* program = &expression->program;
+    uint8_t arity = expression_ops[op].arity;
+    uint16_t depth = program->stack_depth;
+
+    if (op == EXPR_OP_CONST || op == EXPR_OP_ANS) {
+        if (depth >= EXPRESSION_STACK_SIZE) {
+            return EXPRESSION_TOO_LARGE;
+        }
+        if (op == EXPR_OP_CONST) {
+            program->constants[program->constant_count] = expression->literals[operand];
+            operand = (uint8_t)program->constant_count++;
+        }
+        program->code[program->code_count].op = op;
+        program->code[program->code_count].operand = operand;
+        program->code_count++;
+        is_constant[program->stack_depth++] = (op == EXPR_OP_CONST);
+        return EXPRESSION_OK;
+    }
+
+    uint8_t foldable = 1;
+    for (uint8_t i = 0; i < arity; i++) {
+        foldable &= is_constant[depth - arity + i];
+    }
+
+    if (foldable) {
+        double value = expression_apply(op, &program->constants[program->constant_count - arity]);
+
+        program->code_count = (uint16_t)(program->code_count - arity);
+        program->constant_count = (uint16_t)(program->constant_count - arity);
+        program->constants[program->constant_count] = value;
+        program->code[program->code_count].op = EXPR_OP_CONST;
+        program->code[program->code_count].operand = (uint8_t)program->constant_count++;
+        expression->stats.folds++;
+    } else {
+        program->code[program->code_count].op = op;
+        program->code[program->code_count].operand = 0;
+        is_constant[depth - arity] = 0;
+    }
+    program->code_count++;
+    program->stack_depth = (uint16_t)(depth - arity + 1);
+    return EXPRESSION_OK;
+}
+
+/**
+ * @brief Compile the postfix form plus the operators still stacked at the end
+ * Open parentheses are closed; a function whose argument list is still
+ * short leaves the expression incomplete.
+ */
+static expression_status_t expression_compile(expression_t* expression, const expression_checkpoint_t* state) {
+    expression_program_t* program = &expression->program;
+    uint8_t is_constant[EXPRESSION_STACK_SIZE];
+    uint16_t max_depth = 0;
+    expression_status_t status;
+
+    program->code_count = 0;
+    program->constant_count = 0;
+    program->stack_depth = 0;
+
+    for (uint16_t i = 0; i < state->rpn_count; i++) {
+        status = expression_compile_op(expression, is_constant, expression->rpn[i].op, expression->rpn[i].operand);
+        if (status != EXPRESSION_OK) return status;
+        if (program->stack_depth > max_depth) max_depth = program->stack_depth;
+    }
+
+    for (int16_t top = state->top; top >= 0; top = expression->nodes[top].parent) {
+        const expression_node_t* node = &expression->nodes[top];
+        uint8_t op = (node->op == EXPR_OP_LPAREN) ? node->call : node->op;
+
+        if (op == EXPR_OP_LPAREN) continue;
+        if (node->op == EXPR_OP_LPAREN && node->argc != expression_ops[op].arity) return EXPRESSION_INCOMPLETE;
+        status = expression_compile_op(expression, is_constant, op, 0);
+        if (status != EXPRESSION_OK) return status;
+    }
+
+    // The operators only lower the depth the operands reached
+    program->stack_depth = max_depth;
+    return EXPRESSION_OK;
+}
+
+void expression_init(expression_t* expression) {
+    if (!expression) {
+        return;
+    }
+
+    memset(expression, 0, sizeof(*expression));
+    expression->checkpoints[0].top = -1;
+    expression->checkpoints[0].expect_operand = 1;
+    expression->checkpoints[0].pending_call = EXPR_OP_COUNT;
+    expression->checkpoint_count = 1;
+    expression->status = EXPRESSION_EMPTY;
+}
+
+expression_status_t expression_update(expression_t* expression, const char* text, size_t length) {
+    if (!expression || (!text && length > 0)) {
+        return EXPRESSION_SYNTAX;
+    }
+
+    expression->stats.updates++;
+    expression->program.code_count = 0;
+    expression->error_offset = 0;
+
+    if (length > EXPRESSION_MAX_LENGTH) {
+        expression->status = EXPRESSION_TOO_LARGE;
+        expression->error_offset = EXPRESSION_MAX_LENGTH;
+        // Nothing of the old parse carries over past a rejected text
+        expression->length = 0;
+        expression->checkpoint_count = 1;
+        return expression->status;
+    }
+
+    // Resume from the last checkpoint whose token the edit leaves untouched
+    size_t prefix = 0;
+    while (prefix < length && prefix < expression->length && text[prefix] == expression->text[prefix]) {
+        prefix++;
+    }
+    uint16_t kept = 1;
+    while (kept < expression->checkpoint_count && expression->checkpoints[kept].scan_end <= prefix) {
+        kept++;
+    }
+    expression->stats.tokens_reused += (uint32_t)(kept - 1);
+
+    if (length > 0) {
+        memcpy(expression->text, text, length);
+    }
+    expression->length = (uint16_t)length;
+    expression->checkpoint_count = kept;
+
+    expression_checkpoint_t state = expression->checkpoints[kept - 1];
+    size_t pos = state.text_end;
+    expression_status_t status = EXPRESSION_OK;
+
+    while (1) {
+        while (pos < length && expression_is_space(text[pos])) pos++;
+        if (pos >= length) break;
+
+        expression_token_t token;
+        status = expression_lex(text, length, pos, &token);
+        if (status == EXPRESSION_OK) {
+            status = (expression->checkpoint_count > EXPRESSION_MAX_TOKENS) ? EXPRESSION_TOO_LARGE
+                                                                            : expression_accept(expression, &state, &token);
+        }
+        if (status != EXPRESSION_OK) {
+            expression->error_offset = pos;
+            break;
+        }
+        expression->stats.tokens_lexed++;
+
+        pos = token.end;
+        state.text_end = (uint16_t)token.end;
+        state.scan_end = (uint16_t)token.scan_end;
+        expression->checkpoints[expression->checkpoint_count++] = state;
+    }
+
+    if (status == EXPRESSION_OK) {
+        if (expression->checkpoint_count == 1) {
+            status = EXPRESSION_EMPTY;
+        } else if (state.expect_operand || state.pending_call != EXPR_OP_COUNT) {
+            status = EXPRESSION_INCOMPLETE;
+            expression->error_offset = length;
+        } else {
+            status = expression_compile(expression, &state);
+            if (status != EXPRESSION_OK) {
+                expression->program.code_count = 0;
+                expression->error_offset = length;
+            }
+        }
+    }
+
+    expression->status = status;
+    return status;
+}
+
+expression_status_t expression_evaluate(const expression_t* expression, double ans, double* result) {
+    double stack[EXPRESSION_STACK_SIZE];
+    size_t depth = 0;
+
+    if (!expression || !result) {
+        return EXPRESSION_SYNTAX;
+    }
+    if (expression->status != EXPRESSION_OK) {
+        return expression->status;
+    }
+
+    const expression_program_t* program = &expression->program;
+    for (uint16_t i = 0; i < program->code_count; i++) {
+        uint8_t op = program->code[i].op;
+
+        if (op == EXPR_OP_CONST) {
+            stack[depth++] = program->constants[program->code[i].operand];
+        } else if (op == EXPR_OP_ANS) {
+            stack[depth++] = ans;
+        } else {
+            uint8_t arity = expression_ops[op].arity;
+
+            depth -= arity;
+            stack[depth] = expression_apply(op, &stack[depth]);
+            depth++;
+        }
+    }
+
+    *result = stack[0];
+    return EXPRESSION_OK;
+}
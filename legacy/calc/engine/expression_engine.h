@@ -0,0 +1,169 @@
+#ifndef EXPRESSION_ENGINE_H
+#define EXPRESSION_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Longest expression accepted, in bytes
+#define EXPRESSION_MAX_LENGTH 128
+
+// Tokens, and so parser checkpoints and bytecode instructions, per expression
+#define EXPRESSION_MAX_TOKENS 128
+
+// Numbers and named constants per expression
+#define EXPRESSION_MAX_LITERALS 64
+
+// Evaluation stack; deeper programs are rejected when compiled
+#define EXPRESSION_STACK_SIZE 32
+
+typedef enum {
+    EXPRESSION_OK = 0,
+    EXPRESSION_EMPTY = 1,        // nothing but whitespace
+    EXPRESSION_INCOMPLETE = 2,   // a valid prefix: ends on an operator, a function name or a short argument list
+    EXPRESSION_SYNTAX = 3,       // unknown character or name, or a token where it cannot go
+    EXPRESSION_UNBALANCED = 4,   // ')' with no '(' open
+    EXPRESSION_ARITY = 5,        // too many arguments to a function
+    EXPRESSION_TOO_LARGE = 6     // past a length, token, literal or stack depth cap
+} expression_status_t;
+
+/**
+ * @brief Bytecode operations
+ * CONST pushes constants[operand] and ANS the value passed to
+ * expression_evaluate; every other operation pops its arity and pushes one
+ * result. NCR and NPR go through log_combination and the log-factorial
+ * cache, FACTORIAL and GAMMA through the Lanczos gamma. All of them round
+ * results at integer arguments to the nearest integer, so gamma(n) == (n - 1)!;
+ * GAMMA is NaN at its poles 0, -1, -2, ...
+ */
+typedef enum {
+    EXPR_OP_CONST = 0,
+    EXPR_OP_ANS,
+    EXPR_OP_ADD,
+    EXPR_OP_SUB,
+    EXPR_OP_MUL,
+    EXPR_OP_DIV,
+    EXPR_OP_MOD,
+    EXPR_OP_POW,
+    EXPR_OP_NEG,
+    EXPR_OP_FACTORIAL,
+    EXPR_OP_NCR,
+    EXPR_OP_NPR,
+    EXPR_OP_GAMMA,
+    EXPR_OP_LGAMMA,
+    EXPR_OP_ERF,
+    EXPR_OP_ERFC,
+    EXPR_OP_SQRT,
+    EXPR_OP_LN,
+    EXPR_OP_LOG10,
+    EXPR_OP_EXP,
+    EXPR_OP_ABS,
+    EXPR_OP_LPAREN,   // parser only: an open parenthesis or argument list
+    EXPR_OP_COUNT
+} expression_op_t;
+
+typedef struct {
+    uint8_t op;
+    uint8_t operand;
+} expression_instruction_t;
+
+/**
+ * @brief Compiled program
+ * Subexpressions without ans are folded to constants when compiled, so a
+ * purely numeric expression is a single CONST.
+ */
+typedef struct {
+    expression_instruction_t code[EXPRESSION_MAX_TOKENS];
+    double constants[EXPRESSION_MAX_LITERALS];
+    uint16_t code_count;
+    uint16_t constant_count;
+    uint16_t stack_depth;
+} expression_program_t;
+
+/**
+ * @brief Operator stack entry; entries are never changed once pushed,
+ * so a checkpoint restores the stack by its top index alone
+ */
+typedef struct {
+    uint8_t op;
+    uint8_t call;      // function applied when an EXPR_OP_LPAREN closes, EXPR_OP_LPAREN for plain parentheses
+    uint8_t argc;
+    int16_t parent;    // entry below, -1 at the bottom
+} expression_node_t;
+
+/**
+ * @brief Parser state after one token
+ * scan_end is one past the last byte the lexer looked at for the token, so
+ * the checkpoint holds for any text that agrees with the old one up to there.
+ */
+typedef struct {
+    uint16_t text_end;
+    uint16_t scan_end;
+    uint16_t rpn_count;
+    uint16_t literal_count;
+    uint16_t node_count;
+    int16_t top;
+    uint8_t expect_operand;
+    uint8_t pending_call;    // function name waiting for its '(', EXPR_OP_COUNT for none
+} expression_checkpoint_t;
+
+typedef struct {
+    uint32_t updates;
+    uint32_t tokens_lexed;
+    uint32_t tokens_reused;   // tokens kept from the previous text
+    uint32_t folds;
+} expression_stats_t;
+
+/**
+ * @brief Incrementally parsed expression
+ * A shunting-yard parser leaves a checkpoint after every token. An update
+ * resumes from the last checkpoint the edit did not reach, so appending or
+ * deleting at the end re-lexes only the last token or two, then recompiles
+ * the postfix form into bytecode. Unclosed parentheses are closed at the
+ * end, so a live result shows while typing "sqrt(2".
+ *
+ * Grammar: + - (binary and unary), * / % (fmod), ^ (right-associative,
+ * above unary minus), postfix !, parentheses, decimal numbers with an
+ * optional exponent, the constants pi and e, ans, and the functions
+ * ncr(n, k), npr(n, k), gamma, lgamma, erf, erfc, sqrt, ln, log (base 10),
+ * exp and abs.
+ */
+typedef struct {
+    char text[EXPRESSION_MAX_LENGTH];
+    uint16_t length;
+
+    expression_instruction_t rpn[EXPRESSION_MAX_TOKENS];
+    double literals[EXPRESSION_MAX_LITERALS];
+    expression_node_t nodes[EXPRESSION_MAX_TOKENS];
+    expression_checkpoint_t checkpoints[EXPRESSION_MAX_TOKENS + 1];
+    uint16_t checkpoint_count;
+
+    expression_program_t program;
+    expression_status_t status;
+    size_t error_offset;
+
+    expression_stats_t stats;
+} expression_t;
+
+void expression_init(expression_t* expression);
+
+/**
+ * @brief Replace the text and recompile, reusing the parse of the common prefix
+ * @return The new status; error_offset locates the failing token
+ */
+expression_status_t expression_update(expression_t* expression, const char* text, size_t length);
+
+/**
+ * @brief Run the compiled program on a fixed stack, without allocating
+ * @return EXPRESSION_OK with the value (IEEE: 1/0 is infinite) in result, or the status of the last update
+ */
+expression_status_t expression_evaluate(const expression_t* expression, double ans, double* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EXPRESSION_ENGINE_H
@@ -0,0 +1,235 @@
+#include "job_scheduler.h"
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief Monotonic clock in microseconds
+ */
+static uint64_t job_scheduler_now_us(void) {
+    struct timespec ts;
+    
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+/**
+ * @brief Take a job out of its slot and release its task
+ */
+static void job_scheduler_remove(job_entry_t* job) {
+    job_release_fn release = job->release;
+    void* task = job->task;
+    
+    // Clear first, so a release callback may submit again
+    memset(job, 0, sizeof(*job));
+    if (release) {
+        release(task);
+    }
+}
+
+/**
+ * @brief Initialize an empty scheduler
+ * @param scheduler Pointer to scheduler structure
+ */
+void job_scheduler_init(job_scheduler_t* scheduler) {
+    if (!scheduler) {
+        return;
+    }
+    
+    memset(scheduler, 0, sizeof(*scheduler));
+    scheduler->next_id = 1;
+}
+
+/**
+ * @brief Cancel every job
+ * @param scheduler Pointer to scheduler structure
+ */
+void job_scheduler_shutdown(job_scheduler_t* scheduler) {
+    if (!scheduler) {
+        return;
+    }
+    
+    for (size_t i = 0; i < JOB_SCHEDULER_MAX_JOBS; i++) {
+        if (scheduler->jobs[i].id != 0) {
+            job_scheduler_remove(&scheduler->jobs[i]);
+        }
+    }
+}
+
+/**
+ * @brief Queue a task in a free slot
+ * @param scheduler Pointer to scheduler structure
+ * @param priority Priority class
+ * @param owner Caller's tag for job_scheduler_cancel_owner
+ * @param step Step callback
+ * @param release Release callback, may be NULL
+ * @param task Task state passed to both callbacks
+ * @return Job id, or 0 if full or invalid
+ */
+uint32_t job_scheduler_submit(job_scheduler_t* scheduler, job_priority_t priority, uint32_t owner,
+                              job_step_fn step, job_release_fn release, void* task) {
+    if (!scheduler || !step || (unsigned)priority >= JOB_PRIORITY_COUNT) {
+        return 0;
+    }
+    
+    for (size_t i = 0; i < JOB_SCHEDULER_MAX_JOBS; i++) {
+        job_entry_t* job = &scheduler->jobs[i];
+        if (job->id != 0) {
+            continue;
+        }
+        
+        job->id = scheduler->next_id;
+        job->owner = owner;
+        job->priority = priority;
+        job->step = step;
+        job->release = release;
+        job->task = task;
+        job->sequence = scheduler->next_sequence++;
+        
+        // 0 marks a free slot, so the id counter skips it when it wraps
+        if (++scheduler->next_id == 0) {
+            scheduler->next_id = 1;
+        }
+        return job->id;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Cancel one job
+ * @param scheduler Pointer to scheduler structure
+ * @param id Job id from job_scheduler_submit
+ * @return 0 on success, -1 if no such job is queued
+ */
+int job_scheduler_cancel(job_scheduler_t* scheduler, uint32_t id) {
+    if (!scheduler || id == 0) {
+        return -1;
+    }
+    
+    for (size_t i = 0; i < JOB_SCHEDULER_MAX_JOBS; i++) {
+        if (scheduler->jobs[i].id == id) {
+            job_scheduler_remove(&scheduler->jobs[i]);
+            return 0;
+        }
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief Cancel every job with an owner, e.g. when its page goes away
+ * @param scheduler Pointer to scheduler structure
+ * @param owner Owner tag given at submit
+ * @return Number of jobs cancelled
+ */
+size_t job_scheduler_cancel_owner(job_scheduler_t* scheduler, uint32_t owner) {
+    size_t cancelled = 0;
+    
+    if (!scheduler) {
+        return 0;
+    }
+    
+    for (size_t i = 0; i < JOB_SCHEDULER_MAX_JOBS; i++) {
+        if (scheduler->jobs[i].id != 0 && scheduler->jobs[i].owner == owner) {
+            job_scheduler_remove(&scheduler->jobs[i]);
+            cancelled++;
+        }
+    }
+    
+    return cancelled;
+}
+
+/**
+ * @brief Count queued jobs
+ * @param scheduler Pointer to scheduler structure
+ * @param priority Priority class, or JOB_PRIORITY_COUNT for all
+ * @return Number of queued jobs
+ */
+size_t job_scheduler_pending(const job_scheduler_t* scheduler, job_priority_t priority) {
+    size_t count = 0;
+    
+    if (!scheduler) {
+        return 0;
+    }
+    
+    for (size_t i = 0; i < JOB_SCHEDULER_MAX_JOBS; i++) {
+        const job_entry_t* job = &scheduler->jobs[i];
+        if (job->id != 0 && (priority == JOB_PRIORITY_COUNT || job->priority == priority)) {
+            count++;
+        }
+    }
+    
+    return count;
+}
+
+/**
+ * @brief Pick the next job: highest class first, least recently stepped within it
+ * @return Slot index, or JOB_SCHEDULER_MAX_JOBS when nothing is queued
+ */
+static size_t job_scheduler_next(const job_scheduler_t* scheduler) {
+    size_t best = JOB_SCHEDULER_MAX_JOBS;
+    
+    for (size_t i = 0; i < JOB_SCHEDULER_MAX_JOBS; i++) {
+        const job_entry_t* job = &scheduler->jobs[i];
+        if (job->id == 0) {
+            continue;
+        }
+        
+        if (best == JOB_SCHEDULER_MAX_JOBS || job->priority < scheduler->jobs[best].priority ||
+            (job->priority == scheduler->jobs[best].priority && job->sequence < scheduler->jobs[best].sequence)) {
+            best = i;
+        }
+    }
+    
+    return best;
+}
+
+/**
+ * @brief Run slices until the budget is spent or the queue is empty
+ * @param scheduler Pointer to scheduler structure
+ * @param budget_us Time budget in microseconds; one slice always runs
+ * @param slice_units Units per step, 0 for the default
+ * @param on_complete Called for each finished job before its release, may be NULL
+ * @param context Passed to on_complete
+ * @return Number of jobs that finished
+ */
+size_t job_scheduler_run(job_scheduler_t* scheduler, uint64_t budget_us, uint64_t slice_units,
+                         job_complete_fn on_complete, void* context) {
+    size_t finished = 0;
+    
+    if (!scheduler) {
+        return 0;
+    }
+    
+    uint64_t start = job_scheduler_now_us();
+    if (slice_units == 0) {
+        slice_units = JOB_SCHEDULER_DEFAULT_SLICE;
+    }
+    
+    for (;;) {
+        size_t slot = job_scheduler_next(scheduler);
+        if (slot == JOB_SCHEDULER_MAX_JOBS) {
+            break;
+        }
+        
+        job_entry_t* job = &scheduler->jobs[slot];
+        if (job->step(job->task, slice_units)) {
+            if (on_complete) {
+                on_complete(context, job->id, job->owner, job->task);
+            }
+            job_scheduler_remove(job);
+            finished++;
+        } else {
+            // To the back of its class
+            job->sequence = scheduler->next_sequence++;
+        }
+        
+        if (job_scheduler_now_us() - start >= budget_us) {
+            break;
+        }
+    }
+    
+    return finished;
+}
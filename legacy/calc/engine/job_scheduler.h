@@ -0,0 +1,103 @@
+#ifndef JOB_SCHEDULER_H
+#define JOB_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Jobs one scheduler holds at a time
+#define JOB_SCHEDULER_MAX_JOBS 16
+
+// Work units handed to a step when the caller passes a slice of 0
+#define JOB_SCHEDULER_DEFAULT_SLICE 256
+
+typedef enum {
+    JOB_PRIORITY_INTERACTIVE = 0,  // the result on screen
+    JOB_PRIORITY_CHART = 1,        // chart series and other visible extras
+    JOB_PRIORITY_PREFETCH = 2,     // speculative work nobody is waiting for
+    JOB_PRIORITY_COUNT
+} job_priority_t;
+
+/**
+ * @brief Resumable task callbacks
+ * step does at most max_units of work (terms, iterations, trials; the task
+ * decides) and returns 1 once the task is complete, 0 while it has more.
+ * release, which may be NULL, runs exactly once when the job leaves the
+ * scheduler, finished or cancelled.
+ */
+typedef int (*job_step_fn)(void* task, uint64_t max_units);
+typedef void (*job_release_fn)(void* task);
+
+// Called for a finished job before its task is released
+typedef void (*job_complete_fn)(void* context, uint32_t id, uint32_t owner, void* task);
+
+typedef struct {
+    uint32_t id;             // 0 for a free slot
+    uint32_t owner;          // caller's tag, e.g. the page, for job_scheduler_cancel_owner
+    job_priority_t priority;
+    job_step_fn step;
+    job_release_fn release;
+    void* task;
+    uint64_t sequence;       // submission order, for round robin within a class
+} job_entry_t;
+
+/**
+ * @brief Cooperative scheduler for long calculations
+ * Nothing runs on its own: the host calls job_scheduler_run from its event
+ * loop with a time budget, and the scheduler steps jobs one slice at a time
+ * until the budget is spent. A class only runs while every higher class is
+ * empty; within a class, jobs take turns one slice each. Not thread-safe;
+ * drive it from the thread that submits.
+ */
+typedef struct {
+    job_entry_t jobs[JOB_SCHEDULER_MAX_JOBS];
+    uint32_t next_id;
+    uint64_t next_sequence;
+} job_scheduler_t;
+
+/**
+ * @brief Scheduler lifecycle
+ * job_scheduler_shutdown cancels every job, releasing its task.
+ */
+void job_scheduler_init(job_scheduler_t* scheduler);
+void job_scheduler_shutdown(job_scheduler_t* scheduler);
+
+/**
+ * @brief Queue a task
+ * @return Job id (never 0), or 0 if the scheduler is full or arguments are invalid;
+ *         on 0 the task is not released
+ */
+uint32_t job_scheduler_submit(job_scheduler_t* scheduler, job_priority_t priority, uint32_t owner,
+                              job_step_fn step, job_release_fn release, void* task);
+
+/**
+ * @brief Cancellation
+ * job_scheduler_cancel returns 0, or -1 for an unknown id;
+ * job_scheduler_cancel_owner returns how many jobs it cancelled.
+ */
+int job_scheduler_cancel(job_scheduler_t* scheduler, uint32_t id);
+size_t job_scheduler_cancel_owner(job_scheduler_t* scheduler, uint32_t owner);
+
+/**
+ * @brief Jobs still queued in a class, or in all classes for JOB_PRIORITY_COUNT
+ */
+size_t job_scheduler_pending(const job_scheduler_t* scheduler, job_priority_t priority);
+
+/**
+ * @brief Step jobs until budget_us microseconds have passed or nothing is left
+ * At least one slice runs per call, so a budget of 0 means exactly one.
+ * @param slice_units Units per step, 0 for JOB_SCHEDULER_DEFAULT_SLICE
+ * @param on_complete Called for each finished job, may be NULL
+ * @return Number of jobs that finished
+ */
+size_t job_scheduler_run(job_scheduler_t* scheduler, uint64_t budget_us, uint64_t slice_units,
+                         job_complete_fn on_complete, void* context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JOB_SCHEDULER_H
@@ -1,4 +1,8 @@
+#include "native_plugin_interface.h"
 #include "calculation_orchestrator.h"
+#include "../../core/math/decimal_format.h"
+#include <ctype.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -7,23 +11,219 @@
 // This file provides the bridge between JavaScript and C functions
 
 /**
- * @brief Native plugin entry point for statistical calculations
- * @param method The method name to call (should be "orchestrator_calculate_with_request")
- * @param params JSON string containing the calculation request
- * @return JSON string containing the calculation result
+ * @brief Find the value of a top-level key in a flat JSON object
+ * @param json JSON text
+ * @param key Key name without quotes
+ * @return Pointer to the first character of the value, or NULL if absent
  */
-const char* orchestrator_calculate_with_request_plugin(const char* params_json) {
-    if (!params_json) {
-        return "{\"success\": 0, \"error_message\": \"Invalid parameters\"}";
+static const char* plugin_find_value(const char* json, const char* key) {
+    size_t key_len = strlen(key);
+    const char* cursor = json;
+    
+    while ((cursor = strchr(cursor, '"')) != NULL) {
+        cursor++;
+        if (strncmp(cursor, key, key_len) == 0 && cursor[key_len] == '"') {
+            cursor += key_len + 1;
+            while (isspace((unsigned char)*cursor)) cursor++;
+            if (*cursor != ':') continue;
+            cursor++;
+            while (isspace((unsigned char)*cursor)) cursor++;
+            return cursor;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief Parse a numeric JSON field
+ * @return 0 on success, -1 if the key is missing or not a number
+ */
+static int plugin_parse_number(const char* json, const char* key, double* value) {
+    const char* cursor = plugin_find_value(json, key);
+    char* end;
+    
+    if (!cursor) return -1;
+    
+    *value = strtod(cursor, &end);
+    return end == cursor ? -1 : 0;
+}
+
+/**
+ * @brief Parse a JSON array of numbers into params
+ * @return 0 on success, -1 if the key is missing, malformed or too long
+ */
+static int plugin_parse_parameters(const char* json, const char* key, double* params, uint8_t* count) {
+    const char* cursor = plugin_find_value(json, key);
+    char* end;
+    
+    if (!cursor || *cursor != '[') return -1;
+    cursor++;
+    
+    *count = 0;
+    while (isspace((unsigned char)*cursor)) cursor++;
+    if (*cursor == ']') return 0;
+    
+    for (;;) {
+        if (*count >= MAX_PARAMETERS) return -1;
+        
+        params[*count] = strtod(cursor, &end);
+        if (end == cursor) return -1;
+        (*count)++;
+        
+        cursor = end;
+        while (isspace((unsigned char)*cursor)) cursor++;
+        if (*cursor == ']') return 0;
+        if (*cursor != ',') return -1;
+        cursor++;
+    }
+}
+
+/**
+ * @brief Parse the distribution and parameters of a JSON request
+ * @return 0 on success, -1 if either is missing or malformed
+ */
+static int plugin_parse_request(const char* params_json, calculation_request_t* request) {
+    double distribution;
+    
+    memset(request, 0, sizeof(*request));
+    if (!params_json ||
+        plugin_parse_number(params_json, "distribution", &distribution) != 0 ||
+        distribution < 0 || distribution >= DIST_COUNT ||
+        plugin_parse_parameters(params_json, "parameters", request->parameters, &request->param_count) != 0) {
+        return -1;
+    }
+    request->distribution = (distribution_type_t)distribution;
+    return 0;
+}
+
+/**
+ * @brief Run a JSON calculation request into a caller-supplied buffer
+ * Request: {"distribution": <distribution_type_t>, "parameters": [...], "input_value": x}
+ * @param params_json JSON string containing the calculation request
+ * @param buffer Buffer for the JSON result
+ * @param buffer_size Size of the buffer
+ * @return buffer
+ */
+const char* native_plugin_calculate_json(const char* params_json, char* buffer, size_t buffer_size) {
+    calculation_request_t request;
+    calculation_result_t result;
+    char pdf_text[DECIMAL_FORMAT_SHORTEST_MAX];
+    char cdf_text[DECIMAL_FORMAT_SHORTEST_MAX];
+    
+    if (plugin_parse_request(params_json, &request) != 0 ||
+        plugin_parse_number(params_json, "input_value", &request.input_value) != 0) {
+        snprintf(buffer, buffer_size, "{\"success\": 0, \"error_message\": \"Invalid parameters\"}");
+        return buffer;
+    }
+    
+    if (orchestrator_calculate_with_request(&request, &result) != CALC_SUCCESS || !result.success) {
+        snprintf(buffer, buffer_size,
+                 "{\"success\": 0, \"error_message\": \"%s\"}",
+                 result.error_message ? result.error_message : "Calculation failed");
+        return buffer;
+    }
+    
+    decimal_format_shortest(result.pdf_result, pdf_text, sizeof(pdf_text));
+    decimal_format_shortest(result.cdf_result, cdf_text, sizeof(cdf_text));
+    snprintf(buffer, buffer_size,
+             "{\"success\": 1, \"pdf_result\": %s, \"cdf_result\": %s, \"from_cache\": %d, \"error_message\": null}",
+             pdf_text, cdf_text, result.from_cache);
+    
+    return buffer;
+}
+
+/**
+ * @brief Write a probability result, or the orchestrator's error for code
+ */
+static const char* plugin_write_probability(int code, double probability, char* buffer, size_t buffer_size) {
+    char text[DECIMAL_FORMAT_SHORTEST_MAX];
+    
+    if (code != CALC_SUCCESS) {
+        snprintf(buffer, buffer_size, "{\"success\": 0, \"error_message\": \"%s\"}",
+                 orchestrator_get_error_message((calculation_error_t)code));
+        return buffer;
     }
     
-    // For now, return a simple test response to verify the connection
-    // In a full implementation, you would parse the JSON params and call the C functions
-    static char result_json[512];
-    snprintf(result_json, sizeof(result_json), 
-             "{\"success\": 1, \"pdf_result\": 0.246, \"cdf_result\": 0.623, \"error_message\": null}");
+    decimal_format_shortest(probability, text, sizeof(text));
+    snprintf(buffer, buffer_size, "{\"success\": 1, \"probability\": %s, \"error_message\": null}", text);
+    return buffer;
+}
+
+/**
+ * @brief Run a JSON survival function request into a caller-supplied buffer
+ * Request: {"distribution": <distribution_type_t>, "parameters": [...], "input_value": x}
+ * @param params_json JSON string containing the request
+ * @param buffer Buffer for the JSON result
+ * @param buffer_size Size of the buffer
+ * @return buffer
+ */
+const char* native_plugin_sf_json(const char* params_json, char* buffer, size_t buffer_size) {
+    calculation_request_t request;
+    double survival = 0.0;
+    
+    if (plugin_parse_request(params_json, &request) != 0 ||
+        plugin_parse_number(params_json, "input_value", &request.input_value) != 0) {
+        return plugin_write_probability(CALC_ERROR_INVALID_PARAMETERS, 0.0, buffer, buffer_size);
+    }
+    
+    int code = orchestrator_calculate_sf(&request, &survival);
+    return plugin_write_probability(code, survival, buffer, buffer_size);
+}
+
+/**
+ * @brief Run a JSON interval request into a caller-supplied buffer
+ * Request: {"distribution": <distribution_type_t>, "parameters": [...], "lower": a, "upper": b}
+ * A missing bound is unbounded, since JSON has no infinity.
+ * @param params_json JSON string containing the request
+ * @param buffer Buffer for the JSON result
+ * @param buffer_size Size of the buffer
+ * @return buffer
+ */
+const char* native_plugin_interval_json(const char* params_json, char* buffer, size_t buffer_size) {
+    calculation_request_t request;
+    double lower = -INFINITY;
+    double upper = INFINITY;
+    double probability = 0.0;
+    
+    if (plugin_parse_request(params_json, &request) != 0 ||
+        (plugin_find_value(params_json, "lower") && plugin_parse_number(params_json, "lower", &lower) != 0) ||
+        (plugin_find_value(params_json, "upper") && plugin_parse_number(params_json, "upper", &upper) != 0)) {
+        return plugin_write_probability(CALC_ERROR_INVALID_PARAMETERS, 0.0, buffer, buffer_size);
+    }
     
-    return result_json;
+    int code = orchestrator_calculate_interval(&request, lower, upper, &probability);
+    return plugin_write_probability(code, probability, buffer, buffer_size);
+}
+
+/**
+ * @brief Native plugin entry point for statistical calculations
+ * @param params_json JSON string containing the calculation request
+ * @return JSON string containing the calculation result; the buffer is reused by the next call
+ */
+const char* orchestrator_calculate_with_request_plugin(const char* params_json) {
+    static char result_json[NATIVE_PLUGIN_RESULT_LENGTH];
+    return native_plugin_calculate_json(params_json, result_json, sizeof(result_json));
+}
+
+/**
+ * @brief Native plugin entry point for P(X > x)
+ * @param params_json JSON string containing the request
+ * @return JSON result; the buffer is reused by the next call
+ */
+const char* orchestrator_calculate_sf_plugin(const char* params_json) {
+    static char result_json[NATIVE_PLUGIN_RESULT_LENGTH];
+    return native_plugin_sf_json(params_json, result_json, sizeof(result_json));
+}
+
+/**
+ * @brief Native plugin entry point for P(a < X <= b)
+ * @param params_json JSON string containing the request
+ * @return JSON result; the buffer is reused by the next call
+ */
+const char* orchestrator_calculate_interval_plugin(const char* params_json) {
+    static char result_json[NATIVE_PLUGIN_RESULT_LENGTH];
+    return native_plugin_interval_json(params_json, result_json, sizeof(result_json));
 }
 
 /**
@@ -46,13 +246,10 @@ void cleanup_statistical_calculator_plugin(void) {
 
 // Plugin export table for QuickApp
 // This structure tells QuickApp which functions are available
-typedef struct {
-    const char* name;
-    void* function;
-} plugin_function_t;
-
 static plugin_function_t plugin_functions[] = {
     {"orchestrator_calculate_with_request", (void*)orchestrator_calculate_with_request_plugin},
+    {"orchestrator_calculate_sf", (void*)orchestrator_calculate_sf_plugin},
+    {"orchestrator_calculate_interval", (void*)orchestrator_calculate_interval_plugin},
     {"initialize", (void*)initialize_statistical_calculator_plugin},
     {"cleanup", (void*)cleanup_statistical_calculator_plugin},
     {NULL, NULL} // Terminator
@@ -1,17 +1,48 @@
 #ifndef NATIVE_PLUGIN_INTERFACE_H
 #define NATIVE_PLUGIN_INTERFACE_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Buffer size that fits any calculation result JSON
+ */
+#define NATIVE_PLUGIN_RESULT_LENGTH 256
+
 /**
  * @brief Native plugin entry point for statistical calculations
+ * Request: {"distribution": <distribution_type_t>, "parameters": [...], "input_value": x}
+ * Result: {"success": 1, "pdf_result": ..., "cdf_result": ..., "from_cache": 0|1, "error_message": null}
  * @param params_json JSON string containing the calculation request
- * @return JSON string containing the calculation result
+ * @return JSON string containing the calculation result, in a buffer reused by the next call
  */
 const char* orchestrator_calculate_with_request_plugin(const char* params_json);
 
+/**
+ * @brief Reentrant form of orchestrator_calculate_with_request_plugin
+ * @param params_json JSON string containing the calculation request
+ * @param buffer Buffer for the result, NATIVE_PLUGIN_RESULT_LENGTH bytes suffice
+ * @param buffer_size Size of the buffer
+ * @return buffer
+ */
+const char* native_plugin_calculate_json(const char* params_json, char* buffer, size_t buffer_size);
+
+/**
+ * @brief Native plugin entry points for tail and interval probabilities
+ * Survival request: {"distribution": ..., "parameters": [...], "input_value": x}
+ * Interval request: {"distribution": ..., "parameters": [...], "lower": a, "upper": b},
+ * where a missing bound is unbounded.
+ * Result: {"success": 1, "probability": ..., "error_message": null}
+ * The _json forms write into a caller-supplied buffer of NATIVE_PLUGIN_RESULT_LENGTH bytes.
+ */
+const char* orchestrator_calculate_sf_plugin(const char* params_json);
+const char* orchestrator_calculate_interval_plugin(const char* params_json);
+const char* native_plugin_sf_json(const char* params_json, char* buffer, size_t buffer_size);
+const char* native_plugin_interval_json(const char* params_json, char* buffer, size_t buffer_size);
+
 /**
  * @brief Plugin initialization function
  */
@@ -0,0 +1,362 @@
+#include "pmf_table_cache.h"
+#include "../../../src/common/cache/budget.h"
+#include "../../../src/common/cache/service.h"
+#include "../../../src/common/cache/sync.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Page header; pmf, cdf and sf follow, count doubles each
+ * count 0 records a parameter set that has no table.
+ */
+typedef struct {
+    int32_t distribution;
+    uint32_t param_count;
+    double parameters[MAX_PARAMETERS];
+    int32_t k_min;
+    uint32_t count;
+    double lower_mass;
+    double upper_mass;
+} pmf_table_page_t;
+
+#define PMF_TABLE_PAGE_SIZE (sizeof(pmf_table_page_t) + 3 * DISTRIBUTION_TABLE_MAX_ENTRIES * sizeof(double))
+
+/**
+ * @brief Reads a table; returns 0 if it answered the query
+ */
+typedef int (*pmf_table_visit_fn)(const distribution_table_t* table, void* context);
+
+static cache_service_t table_cache;
+static int table_cache_enabled = 0;
+static cache_lock_t table_cache_lock = CACHE_LOCK_INITIALIZER;
+// The "calc.tables" budget account, registered on first enable
+static int table_budget_account = -1;
+static cache_lock_t table_budget_lock = CACHE_LOCK_INITIALIZER;
+
+/**
+ * @brief Budget usage callback: bytes the table cache holds
+ */
+static size_t pmf_table_budget_usage(void* context) {
+    size_t usage = 0;
+    
+    (void)context;
+    cache_lock_acquire(&table_cache_lock);
+    if (table_cache_enabled) {
+        usage = page_cache_reserved_bytes(&table_cache.cache);
+    }
+    cache_lock_release(&table_cache_lock);
+    
+    return usage;
+}
+
+/**
+ * @brief Budget trim callback: hand committed table segments back
+ */
+static size_t pmf_table_budget_trim(void* context, size_t bytes_wanted) {
+    size_t freed = 0;
+    
+    (void)context;
+    cache_lock_acquire(&table_cache_lock);
+    if (table_cache_enabled) {
+        freed = cache_service_trim(&table_cache, bytes_wanted);
+    }
+    cache_lock_release(&table_cache_lock);
+    
+    return freed;
+}
+
+/**
+ * @brief Enable the table cache, or resize it and drop its tables
+ * @param capacity_tables Maximum number of cached tables
+ * @return 0 on success, -1 if the cache could not be allocated
+ */
+int pmf_table_cache_enable(size_t capacity_tables) {
+    int rc;
+    
+    // Outside table_cache_lock: the budget takes it from its callbacks
+    cache_lock_acquire(&table_budget_lock);
+    if (table_budget_account < 0) {
+        table_budget_account = cache_budget_register("calc.tables", CACHE_BUDGET_CLASS_TABLES,
+                                                     pmf_table_budget_usage, pmf_table_budget_trim, NULL);
+    }
+    cache_lock_release(&table_budget_lock);
+    
+    cache_lock_acquire(&table_cache_lock);
+    if (table_cache_enabled) {
+        cache_service_shutdown(&table_cache);
+        table_cache_enabled = 0;
+    }
+    // Lazy, so short tables take small slabs and an idle cache costs only its index
+    rc = cache_service_init_ex(&table_cache, capacity_tables, PMF_TABLE_PAGE_SIZE, PAGE_CACHE_INIT_LAZY);
+    table_cache_enabled = (rc == 0);
+    cache_lock_release(&table_cache_lock);
+    
+    return rc == 0 ? 0 : -1;
+}
+
+/**
+ * @brief Disable the table cache and free its memory
+ */
+void pmf_table_cache_disable(void) {
+    cache_lock_acquire(&table_cache_lock);
+    if (table_cache_enabled) {
+        cache_service_shutdown(&table_cache);
+        table_cache_enabled = 0;
+    }
+    cache_lock_release(&table_cache_lock);
+}
+
+/**
+ * @brief Mix a 64-bit value into an FNV-1a hash, least significant byte first
+ */
+static uint32_t pmf_table_hash_u64(uint32_t hash, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        hash ^= (uint32_t)(value & 0xff);
+        hash *= 16777619u;
+        value >>= 8;
+    }
+    return hash;
+}
+
+/**
+ * @brief Fill a page header's key fields from a discrete handle
+ * -0.0 is folded into 0.0 and unused parameter slots are zeroed, so equal
+ * parameter sets share a key.
+ * @return 0 on success, -1 for continuous or unknown handles
+ */
+static int pmf_table_fill_key(const distribution_prepared_t* prepared, pmf_table_page_t* key) {
+    distribution_type_t type = distribution_prepared_type(prepared);
+    const distribution_model_t* model = get_distribution_model(type);
+    
+    if (!model || model->category != DISTRIBUTION_DISCRETE ||
+        prepared->param_count < 0 || prepared->param_count > MAX_PARAMETERS) {
+        return -1;
+    }
+    
+    memset(key, 0, sizeof(*key));
+    key->distribution = (int32_t)type;
+    key->param_count = (uint32_t)prepared->param_count;
+    for (uint32_t i = 0; i < key->param_count; i++) {
+        key->parameters[i] = prepared->params[i] == 0.0 ? 0.0 : prepared->params[i];
+    }
+    return 0;
+}
+
+/**
+ * @brief FNV-1a over the key fields of a page header, as little-endian IEEE-754 bits
+ */
+static uint32_t pmf_table_key_hash(const pmf_table_page_t* key) {
+    uint32_t hash = 2166136261u;
+    uint64_t bits;
+    
+    hash = pmf_table_hash_u64(hash, (uint64_t)(uint32_t)key->distribution);
+    hash = pmf_table_hash_u64(hash, key->param_count);
+    for (uint32_t i = 0; i < key->param_count; i++) {
+        memcpy(&bits, &key->parameters[i], sizeof(bits));
+        hash = pmf_table_hash_u64(hash, bits);
+    }
+    return hash;
+}
+
+/**
+ * @brief Table view of a page whose arrays start at values
+ */
+static void pmf_table_view(const pmf_table_page_t* header, const double* values, distribution_table_t* table) {
+    table->k_min = header->k_min;
+    table->count = header->count;
+    table->lower_mass = header->lower_mass;
+    table->upper_mass = header->upper_mass;
+    table->pmf = values;
+    table->cdf = values + header->count;
+    table->sf = values + 2 * (size_t)header->count;
+}
+
+/**
+ * @brief Run visit on the cached table of a handle, building and storing it on a miss
+ * A hit is read in place from the pinned page under the cache lock; a miss is
+ * built outside it into scratch, answered from there and then stored.
+ * @return The visit's result, or -1 if there is no table
+ */
+static int pmf_table_cache_visit(const distribution_prepared_t* prepared, pmf_table_visit_fn visit, void* context) {
+    pmf_table_page_t key;
+    pmf_table_page_t header;
+    distribution_table_t table;
+    const uint8_t* data;
+    size_t data_len;
+    int found = 0;
+    int rc = -1;
+    
+    if (!prepared || pmf_table_fill_key(prepared, &key) != 0) {
+        return -1;
+    }
+    uint32_t page_id = pmf_table_key_hash(&key);
+    
+    cache_lock_acquire(&table_cache_lock);
+    if (!table_cache_enabled) {
+        cache_lock_release(&table_cache_lock);
+        return -1;
+    }
+    if (cache_service_acquire(&table_cache, page_id, &data, &data_len) == 0) {
+        memcpy(&header, data, data_len < sizeof(header) ? data_len : sizeof(header));
+        // A hash collision stores a different parameter set under the same key
+        if (data_len >= sizeof(header) &&
+            memcmp(&key, &header, offsetof(pmf_table_page_t, k_min)) == 0 &&
+            data_len == sizeof(header) + 3 * (size_t)header.count * sizeof(double)) {
+            found = 1;
+            if (header.count > 0) {
+                pmf_table_view(&header, (const double*)(data + sizeof(header)), &table);
+                rc = visit(&table, context);
+            }
+        }
+        cache_service_release(&table_cache, page_id);
+    }
+    cache_lock_release(&table_cache_lock);
+    
+    if (found) {
+        return rc;
+    }
+    
+    uint8_t* page = (uint8_t*)malloc(PMF_TABLE_PAGE_SIZE);
+    if (!page) {
+        return -1;
+    }
+    
+    header = key;
+    if (distribution_table_build(prepared, (double*)(page + sizeof(header)), DISTRIBUTION_TABLE_MAX_ENTRIES,
+                                 &table) == 0) {
+        header.k_min = (int32_t)table.k_min;
+        header.count = (uint32_t)table.count;
+        header.lower_mass = table.lower_mass;
+        header.upper_mass = table.upper_mass;
+        rc = visit(&table, context);
+    }
+    memcpy(page, &header, sizeof(header));
+    
+    cache_lock_acquire(&table_cache_lock);
+    if (table_cache_enabled) {
+        cache_service_set(&table_cache, page_id, page, sizeof(header) + 3 * (size_t)header.count * sizeof(double));
+    }
+    cache_lock_release(&table_cache_lock);
+    free(page);
+    
+    cache_budget_poll();
+    return rc;
+}
+
+typedef struct {
+    double x;
+    double* pmf;
+    double* cdf;
+    double* sf;
+} pmf_table_point_query_t;
+
+static int pmf_table_visit_point(const distribution_table_t* table, void* context) {
+    pmf_table_point_query_t* query = (pmf_table_point_query_t*)context;
+    
+    return distribution_table_point(table, query->x, query->pmf, query->cdf, query->sf);
+}
+
+/**
+ * @brief PMF, CDF and survival function at x from the handle's table
+ * @param prepared Prepared handle
+ * @param x Value at which to evaluate
+ * @param pmf Receives P(X = x) (may be NULL)
+ * @param cdf Receives P(X <= x) (may be NULL)
+ * @param sf Receives P(X > x) (may be NULL)
+ * @return 0 if the table answered, -1 to fall back to the kernels
+ */
+int pmf_table_cache_point(const distribution_prepared_t* prepared, double x, double* pmf, double* cdf, double* sf) {
+    pmf_table_point_query_t query = { x, pmf, cdf, sf };
+    
+    return pmf_table_cache_visit(prepared, pmf_table_visit_point, &query);
+}
+
+typedef struct {
+    const double* x;
+    double* pmf;
+    double* cdf;
+    size_t count;
+} pmf_table_points_query_t;
+
+static int pmf_table_visit_points(const distribution_table_t* table, void* context) {
+    pmf_table_points_query_t* query = (pmf_table_points_query_t*)context;
+    
+    for (size_t i = 0; i < query->count; i++) {
+        if (distribution_table_point(table, query->x[i], &query->pmf[i], &query->cdf[i], NULL) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief PMF and CDF at count values from the handle's table, with one lookup
+ * @param prepared Prepared handle
+ * @param x Array of count values
+ * @param pmf Output array of count PMF values
+ * @param cdf Output array of count CDF values
+ * @param count Number of values
+ * @return 0 if the table answered every value, -1 to fall back to the kernels for all of them
+ */
+int pmf_table_cache_points(const distribution_prepared_t* prepared, const double* x, double* pmf, double* cdf,
+                           size_t count) {
+    pmf_table_points_query_t query = { x, pmf, cdf, count };
+    
+    if (!x || !pmf || !cdf) {
+        return -1;
+    }
+    
+    return pmf_table_cache_visit(prepared, pmf_table_visit_points, &query);
+}
+
+typedef struct {
+    double a;
+    double b;
+    double* probability;
+} pmf_table_interval_query_t;
+
+static int pmf_table_visit_interval(const distribution_table_t* table, void* context) {
+    pmf_table_interval_query_t* query = (pmf_table_interval_query_t*)context;
+    
+    return distribution_table_interval(table, query->a, query->b, query->probability);
+}
+
+/**
+ * @brief Interval probability P(a < X <= b) from the handle's table
+ * @return 0 if the table answered, -1 to fall back to the kernels
+ */
+int pmf_table_cache_interval(const distribution_prepared_t* prepared, double a, double b, double* probability) {
+    pmf_table_interval_query_t query = { a, b, probability };
+    
+    return pmf_table_cache_visit(prepared, pmf_table_visit_interval, &query);
+}
+
+typedef struct {
+    double x_min;
+    double x_max;
+    size_t count;
+    double* out;
+} pmf_table_series_query_t;
+
+static int pmf_table_visit_series(const distribution_table_t* table, void* context) {
+    pmf_table_series_query_t* query = (pmf_table_series_query_t*)context;
+    
+    return distribution_table_series(table, query->x_min, query->x_max, query->count, query->out);
+}
+
+/**
+ * @brief PMF at count unit-spaced integers from x_min, copied from the handle's table
+ * @return 0 if the table answered, -1 to fall back to distribution_prepared_series
+ */
+int pmf_table_cache_series(const distribution_prepared_t* prepared, double x_min, double x_max, size_t count,
+                           double* out) {
+    pmf_table_series_query_t query = { x_min, x_max, count, out };
+    
+    // Anything but consecutive integers is not worth building a table for
+    if (count == 0 || floor(x_min) != x_min || (count > 1 && x_max - x_min != (double)(count - 1))) {
+        return -1;
+    }
+    
+    return pmf_table_cache_visit(prepared, pmf_table_visit_series, &query);
+}
@@ -0,0 +1,32 @@
+#ifndef PMF_TABLE_CACHE_H
+#define PMF_TABLE_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../../core/distributions/lib/distribution_interface.h"
+
+/**
+ * @brief Shared cache of discrete PMF tables
+ * The first query for a discrete distribution and parameter set builds its
+ * distribution_table_build table into a page of a lazily committed page
+ * cache; later queries for the same parameters, from any caller, are served
+ * by indexing the pinned page in place. Parameter sets whose support does not
+ * fit DISTRIBUTION_TABLE_MAX_ENTRIES points are remembered too, so they fail
+ * fast. The pages count against the "calc.tables" budget account, and
+ * enable sizes the cache in tables and drops what it held.
+ *
+ * Every query returns 0 when the table answered it and -1 when the caller
+ * should evaluate the kernels instead: the cache is disabled, the handle is
+ * continuous, the support is too wide, or x lies in a left-out tail.
+ */
+int pmf_table_cache_enable(size_t capacity_tables);
+void pmf_table_cache_disable(void);
+
+int pmf_table_cache_point(const distribution_prepared_t* prepared, double x, double* pmf, double* cdf, double* sf);
+int pmf_table_cache_points(const distribution_prepared_t* prepared, const double* x, double* pmf, double* cdf,
+                           size_t count);
+int pmf_table_cache_interval(const distribution_prepared_t* prepared, double a, double b, double* probability);
+int pmf_table_cache_series(const distribution_prepared_t* prepared, double x_min, double x_max, size_t count,
+                           double* out);
+
+#endif // PMF_TABLE_CACHE_H
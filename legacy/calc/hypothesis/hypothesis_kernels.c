@@ -0,0 +1,946 @@
+#include "hypothesis_kernels.h"
+#include "../../core/math/math_utils.h"
+#include "../../core/math/special_functions.h"
+#include "../../core/math/vector_math.h"
+#include "../../core/distributions/lib/distribution_interface.h"
+#include "../../core/constants/statistical_constants.h"
+#include "../../core/constants/statistical_tables.h"
+#include <math.h>
+#include <stdlib.h>
+
+// Residual mean square below which the fit is treated as exact (as in hypothesis_engine.js)
+#define HYPOTHESIS_EXACT_FIT_EPSILON 1e-10
+
+// Centered sums of squares below this fraction of the raw sum are rounding residue
+#define HYPOTHESIS_CANCELLATION_EPSILON 1e-12
+
+/**
+ * @brief Reset running moments
+ */
+void hypothesis_moments_init(hypothesis_moments_t* moments) {
+    if (!moments) return;
+    
+    moments->n = 0;
+    moments->mean = 0.0;
+    moments->m2 = 0.0;
+}
+
+/**
+ * @brief Add one observation (Welford's update)
+ */
+void hypothesis_moments_push(hypothesis_moments_t* moments, double x) {
+    if (!moments) return;
+    
+    moments->n++;
+    double delta = x - moments->mean;
+    moments->mean += delta / (double)moments->n;
+    moments->m2 += delta * (x - moments->mean);
+}
+
+/**
+ * @brief Sample variance, NAN for fewer than two observations
+ */
+double hypothesis_moments_variance(const hypothesis_moments_t* moments) {
+    if (!moments || moments->n < 2) return NAN;
+    
+    return moments->m2 / (double)(moments->n - 1);
+}
+
+/**
+ * @brief Reset running paired moments
+ */
+void hypothesis_comoments_init(hypothesis_comoments_t* moments) {
+    if (!moments) return;
+    
+    moments->n = 0;
+    moments->mean_x = 0.0;
+    moments->mean_y = 0.0;
+    moments->m2_x = 0.0;
+    moments->m2_y = 0.0;
+    moments->c_xy = 0.0;
+}
+
+/**
+ * @brief Add one (x, y) point
+ * The co-moment uses the x deviation from the old mean and the y deviation
+ * from the new one, which keeps the update exact for any order of points.
+ */
+void hypothesis_comoments_push(hypothesis_comoments_t* moments, double x, double y) {
+    if (!moments) return;
+    
+    moments->n++;
+    double inv_n = 1.0 / (double)moments->n;
+    double dx = x - moments->mean_x;
+    double dy = y - moments->mean_y;
+    
+    moments->mean_x += dx * inv_n;
+    moments->mean_y += dy * inv_n;
+    moments->m2_x += dx * (x - moments->mean_x);
+    moments->m2_y += dy * (y - moments->mean_y);
+    moments->c_xy += dx * (y - moments->mean_y);
+}
+
+/**
+ * @brief One-pass moments of the finite values in data
+ */
+int hypothesis_sample_moments(const double* data, size_t count, hypothesis_moments_t* out) {
+    if (!out || (!data && count > 0)) return -1;
+    
+    hypothesis_moments_init(out);
+    if (count == 0) return 0;
+    
+    // Common case: vectorized two-pass mean and squared deviations
+    if (vector_all_finite(data, count)) {
+        out->n = count;
+        out->mean = vector_sum(data, count) / (double)count;
+        out->m2 = vector_sum_squares(data, count, out->mean);
+        return 0;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        if (is_finite_number(data[i])) {
+            hypothesis_moments_push(out, data[i]);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Mark every field of a result as not produced
+ */
+static void hypothesis_result_clear(hypothesis_result_t* result) {
+    result->statistic = NAN;
+    result->df = NAN;
+    result->df2 = NAN;
+    result->p_two_tail = NAN;
+    result->p_left = NAN;
+    result->p_right = NAN;
+    result->lower_ci = NAN;
+    result->upper_ci = NAN;
+    result->mean_diff = NAN;
+    result->s_diff = NAN;
+}
+
+/**
+ * @brief Sample size and spread checks shared by the summary-statistic tests
+ * NAN spreads pass, as they do in hypothesis_engine.js.
+ */
+static hypothesis_error_t hypothesis_check_size(double n) {
+    if (n <= 0.0) return HYPOTHESIS_ERROR_N_NOT_POSITIVE;
+    if (!is_finite_number(n) || floor(n) != n) return HYPOTHESIS_ERROR_N_NOT_INTEGER;
+    return HYPOTHESIS_SUCCESS;
+}
+
+static hypothesis_error_t hypothesis_check_s(double n, double s) {
+    hypothesis_error_t error = hypothesis_check_size(n);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    if (s < 0.0) return HYPOTHESIS_ERROR_INVALID_S;
+    return HYPOTHESIS_SUCCESS;
+}
+
+static hypothesis_error_t hypothesis_check_sigma(double n, double sigma) {
+    hypothesis_error_t error = hypothesis_check_size(n);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    if (sigma <= 0.0) return HYPOTHESIS_ERROR_INVALID_SIGMA;
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Standard normal tail probabilities of z
+ * Each tail comes from erfc directly, so small p-values keep full precision.
+ */
+static void hypothesis_normal_tails(double z, hypothesis_result_t* result) {
+    result->p_left = 0.5 * complementary_error_function(-z / M_SQRT2);
+    result->p_right = 0.5 * complementary_error_function(z / M_SQRT2);
+    result->p_two_tail = complementary_error_function(fabs(z) / M_SQRT2);
+}
+
+/**
+ * @brief Student's t tail probabilities of t with df degrees of freedom
+ * P(|T| > |t|) = I_{df/(df+t^2)}(df/2, 1/2); for |t| < sqrt(df) the
+ * complementary form in t^2/(df+t^2) is evaluated so neither argument is
+ * formed as 1 - x.
+ */
+static void hypothesis_t_tails(double t, double df, hypothesis_result_t* result) {
+    if (isnan(t) || !(df > 0.0)) {
+        result->p_two_tail = NAN;
+        result->p_left = NAN;
+        result->p_right = NAN;
+        return;
+    }
+    
+    double two_tail;
+    double central;
+    
+    if (isinf(t)) {
+        two_tail = 0.0;
+        central = 1.0;
+    } else {
+        double t2 = t * t;
+        if (t2 < df) {
+            central = incomplete_beta_evaluate(0.5, df / 2.0, t2 / (df + t2), NAN, NULL, &two_tail);
+        } else {
+            two_tail = incomplete_beta_evaluate(df / 2.0, 0.5, df / (df + t2), NAN, NULL, &central);
+        }
+    }
+    
+    double tail = 0.5 * two_tail;
+    double body = 0.5 + 0.5 * central;
+    
+    result->p_two_tail = two_tail;
+    result->p_left = (t < 0.0) ? tail : body;
+    result->p_right = (t < 0.0) ? body : tail;
+}
+
+/**
+ * @brief Two-sided standard normal and t critical values for alpha
+ */
+static double hypothesis_normal_critical(double alpha) {
+    double params[2] = {0.0, 1.0};
+    return distribution_quantile(DIST_NORMAL, params, 2, 1.0 - alpha / 2.0);
+}
+
+static double hypothesis_t_critical(double df, double alpha) {
+    // Integral df within the dense table are exact O(1) lookups at the standard levels
+    if (df >= 1.0 && df <= CRITICAL_TABLE_MAX_DF && df == floor(df)) {
+        return calculate_t_critical((int)df, alpha);
+    }
+    return distribution_quantile(DIST_T_DISTRIBUTION, &df, 1, 1.0 - alpha / 2.0);
+}
+
+/**
+ * @brief One-sample Z-test, H0: mu = mu0
+ */
+hypothesis_error_t hypothesis_z_test_one_sample(double mean, double n, double sigma, double mu0,
+                                                double alpha, hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    hypothesis_error_t error = hypothesis_check_sigma(n, sigma);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    
+    double se = sigma / sqrt(n);
+    double margin = hypothesis_normal_critical(alpha) * se;
+    
+    result->statistic = (mean - mu0) / se;
+    hypothesis_normal_tails(result->statistic, result);
+    result->lower_ci = mean - margin;
+    result->upper_ci = mean + margin;
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Two-sample Z-test, H0: mu1 - mu2 = diff
+ */
+hypothesis_error_t hypothesis_z_test_two_sample(double mean1, double n1, double sigma1,
+                                                double mean2, double n2, double sigma2,
+                                                double diff, double alpha, hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    hypothesis_error_t error = hypothesis_check_sigma(n1, sigma1);
+    if (error == HYPOTHESIS_SUCCESS) error = hypothesis_check_sigma(n2, sigma2);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    
+    double se = sqrt(sigma1 * sigma1 / n1 + sigma2 * sigma2 / n2);
+    double mean_diff = mean1 - mean2;
+    double margin = hypothesis_normal_critical(alpha) * se;
+    
+    result->statistic = (mean_diff - diff) / se;
+    hypothesis_normal_tails(result->statistic, result);
+    result->lower_ci = mean_diff - margin;
+    result->upper_ci = mean_diff + margin;
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief One-sample t-test, H0: mu = mu0
+ */
+hypothesis_error_t hypothesis_t_test_one_sample(double mean, double n, double s, double mu0,
+                                                double alpha, hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    hypothesis_error_t error = hypothesis_check_s(n, s);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    if (n <= 1.0) return HYPOTHESIS_ERROR_N_TOO_SMALL;
+    
+    double se = s / sqrt(n);
+    double df = n - 1.0;
+    double margin = hypothesis_t_critical(df, alpha) * se;
+    
+    result->statistic = (mean - mu0) / se;
+    result->df = df;
+    hypothesis_t_tails(result->statistic, df, result);
+    result->lower_ci = mean - margin;
+    result->upper_ci = mean + margin;
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Standard error and degrees of freedom of the two-sample t statistic
+ * Pooled variance for equal_variances, otherwise Welch–Satterthwaite.
+ */
+static void hypothesis_two_sample_t_design(double n1, double s1, double n2, double s2, int equal_variances,
+                                           double* se, double* df) {
+    if (equal_variances) {
+        double pooled = ((n1 - 1.0) * s1 * s1 + (n2 - 1.0) * s2 * s2) / (n1 + n2 - 2.0);
+        *se = sqrt(pooled * (1.0 / n1 + 1.0 / n2));
+        *df = n1 + n2 - 2.0;
+    } else {
+        double v1 = s1 * s1 / n1;
+        double v2 = s2 * s2 / n2;
+        *se = sqrt(v1 + v2);
+        *df = (v1 + v2) * (v1 + v2) / (v1 * v1 / (n1 - 1.0) + v2 * v2 / (n2 - 1.0));
+    }
+}
+
+/**
+ * @brief Independent two-sample t-test, H0: mu1 - mu2 = diff
+ */
+hypothesis_error_t hypothesis_t_test_two_sample(double mean1, double n1, double s1,
+                                                double mean2, double n2, double s2,
+                                                int equal_variances, double diff, double alpha,
+                                                hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    hypothesis_error_t error = hypothesis_check_s(n1, s1);
+    if (error == HYPOTHESIS_SUCCESS) error = hypothesis_check_s(n2, s2);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    if (n1 <= 1.0 || n2 <= 1.0) return HYPOTHESIS_ERROR_SAMPLES_TOO_SMALL;
+    
+    double se;
+    double df;
+    hypothesis_two_sample_t_design(n1, s1, n2, s2, equal_variances, &se, &df);
+    
+    double mean_diff = mean1 - mean2;
+    double margin = hypothesis_t_critical(df, alpha) * se;
+    
+    result->statistic = (mean_diff - diff) / se;
+    result->df = df;
+    hypothesis_t_tails(result->statistic, df, result);
+    result->lower_ci = mean_diff - margin;
+    result->upper_ci = mean_diff + margin;
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Two-sided critical values already computed within one summary
+ * df is INFINITY for the normal reference distribution.
+ */
+typedef struct {
+    double df;
+    size_t count;
+    double alpha[HYPOTHESIS_SUMMARY_MAX_LEVELS + 2];
+    double value[HYPOTHESIS_SUMMARY_MAX_LEVELS + 2];
+} hypothesis_critical_memo_t;
+
+static double hypothesis_memo_critical(hypothesis_critical_memo_t* memo, double alpha) {
+    for (size_t i = 0; i < memo->count; i++) {
+        // 1 - 0.95 and 0.05 differ in the last bits
+        if (fabs(memo->alpha[i] - alpha) <= 1e-12 * alpha) return memo->value[i];
+    }
+    
+    double value = isinf(memo->df) ? hypothesis_normal_critical(alpha) : hypothesis_t_critical(memo->df, alpha);
+    if (memo->count < HYPOTHESIS_SUMMARY_MAX_LEVELS + 2) {
+        memo->alpha[memo->count] = alpha;
+        memo->value[memo->count] = value;
+        memo->count++;
+    }
+    return value;
+}
+
+/**
+ * @brief CDF of the reference distribution (normal for df = INFINITY, else t)
+ */
+static double hypothesis_reference_cdf(double x, double df) {
+    if (isinf(df)) return 0.5 * complementary_error_function(-x / M_SQRT2);
+    
+    hypothesis_result_t tails;
+    hypothesis_t_tails(x, df, &tails);
+    return tails.p_left;
+}
+
+/**
+ * @brief Estimate, standard error, df and effect-size scale of a summary request
+ */
+static hypothesis_error_t hypothesis_summary_design(const hypothesis_summary_request_t* request, double* estimate,
+                                                    double* se, double* df, double* scale) {
+    double n1 = request->n1;
+    double n2 = request->n2;
+    double a = request->spread1;
+    double b = request->spread2;
+    hypothesis_error_t error;
+    
+    switch (request->kind) {
+        case HYPOTHESIS_SUMMARY_Z_ONE_SAMPLE:
+            if ((error = hypothesis_check_sigma(n1, a)) != HYPOTHESIS_SUCCESS) return error;
+            *estimate = request->mean1;
+            *se = a / sqrt(n1);
+            *df = INFINITY;
+            *scale = a;
+            return HYPOTHESIS_SUCCESS;
+        case HYPOTHESIS_SUMMARY_Z_TWO_SAMPLE:
+            if ((error = hypothesis_check_sigma(n1, a)) != HYPOTHESIS_SUCCESS) return error;
+            if ((error = hypothesis_check_sigma(n2, b)) != HYPOTHESIS_SUCCESS) return error;
+            *estimate = request->mean1 - request->mean2;
+            *se = sqrt(a * a / n1 + b * b / n2);
+            *df = INFINITY;
+            *scale = sqrt((a * a + b * b) / 2.0);
+            return HYPOTHESIS_SUCCESS;
+        case HYPOTHESIS_SUMMARY_T_ONE_SAMPLE:
+            if ((error = hypothesis_check_s(n1, a)) != HYPOTHESIS_SUCCESS) return error;
+            if (n1 <= 1.0) return HYPOTHESIS_ERROR_N_TOO_SMALL;
+            *estimate = request->mean1;
+            *se = a / sqrt(n1);
+            *df = n1 - 1.0;
+            *scale = a;
+            return HYPOTHESIS_SUCCESS;
+        case HYPOTHESIS_SUMMARY_T_POOLED:
+        case HYPOTHESIS_SUMMARY_T_WELCH: {
+            int pooled = request->kind == HYPOTHESIS_SUMMARY_T_POOLED;
+            if ((error = hypothesis_check_s(n1, a)) != HYPOTHESIS_SUCCESS) return error;
+            if ((error = hypothesis_check_s(n2, b)) != HYPOTHESIS_SUCCESS) return error;
+            if (n1 <= 1.0 || n2 <= 1.0) return HYPOTHESIS_ERROR_SAMPLES_TOO_SMALL;
+            *estimate = request->mean1 - request->mean2;
+            hypothesis_two_sample_t_design(n1, a, n2, b, pooled, se, df);
+            *scale = pooled ? sqrt(((n1 - 1.0) * a * a + (n2 - 1.0) * b * b) / (n1 + n2 - 2.0))
+                            : sqrt((a * a + b * b) / 2.0);
+            return HYPOTHESIS_SUCCESS;
+        }
+        default:
+            return HYPOTHESIS_ERROR_INVALID_DATA;
+    }
+}
+
+hypothesis_error_t hypothesis_summary(const hypothesis_summary_request_t* request, hypothesis_summary_t* summary) {
+    if (!request || !summary) return HYPOTHESIS_ERROR_NULL_POINTER;
+    
+    hypothesis_result_clear(&summary->test);
+    summary->estimate = NAN;
+    summary->standard_error = NAN;
+    summary->p_value = NAN;
+    summary->reject = 0;
+    summary->critical_value = NAN;
+    summary->level_count = 0;
+    summary->effect_size = NAN;
+    summary->power = NAN;
+    
+    double alpha = request->alpha;
+    int one_sided = request->tail == HYPOTHESIS_TAIL_LEFT || request->tail == HYPOTHESIS_TAIL_RIGHT;
+    if (!(alpha > 0.0 && alpha < (one_sided ? 0.5 : 1.0))) return HYPOTHESIS_ERROR_INVALID_DATA;
+    if (!one_sided && request->tail != HYPOTHESIS_TAIL_TWO) return HYPOTHESIS_ERROR_INVALID_DATA;
+    if (request->level_count > HYPOTHESIS_SUMMARY_MAX_LEVELS) return HYPOTHESIS_ERROR_INVALID_DATA;
+    for (size_t i = 0; i < request->level_count; i++) {
+        if (!(request->levels[i] > 0.0 && request->levels[i] < 1.0)) return HYPOTHESIS_ERROR_INVALID_DATA;
+    }
+    
+    double estimate, se, df, scale;
+    hypothesis_error_t error = hypothesis_summary_design(request, &estimate, &se, &df, &scale);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    
+    hypothesis_result_t* test = &summary->test;
+    double shift = (estimate - request->null_value) / se;
+    test->statistic = shift;
+    if (isinf(df)) {
+        hypothesis_normal_tails(shift, test);
+    } else {
+        test->df = df;
+        hypothesis_t_tails(shift, df, test);
+    }
+    
+    hypothesis_critical_memo_t memo;
+    memo.df = df;
+    memo.count = 0;
+    
+    double margin = hypothesis_memo_critical(&memo, alpha) * se;
+    test->lower_ci = estimate - margin;
+    test->upper_ci = estimate + margin;
+    
+    for (size_t i = 0; i < request->level_count; i++) {
+        double level_margin = hypothesis_memo_critical(&memo, 1.0 - request->levels[i]) * se;
+        summary->levels[i] = request->levels[i];
+        summary->lower[i] = estimate - level_margin;
+        summary->upper[i] = estimate + level_margin;
+    }
+    summary->level_count = request->level_count;
+    
+    // The two-sided critical value at 2 alpha is the one-sided one at alpha
+    double critical = hypothesis_memo_critical(&memo, one_sided ? 2.0 * alpha : alpha);
+    
+    switch (request->tail) {
+        case HYPOTHESIS_TAIL_LEFT:
+            summary->p_value = test->p_left;
+            summary->critical_value = -critical;
+            summary->power = hypothesis_reference_cdf(-shift - critical, df);
+            break;
+        case HYPOTHESIS_TAIL_RIGHT:
+            summary->p_value = test->p_right;
+            summary->critical_value = critical;
+            summary->power = hypothesis_reference_cdf(shift - critical, df);
+            break;
+        default:
+            summary->p_value = test->p_two_tail;
+            summary->critical_value = critical;
+            summary->power = hypothesis_reference_cdf(shift - critical, df) +
+                             hypothesis_reference_cdf(-shift - critical, df);
+            break;
+    }
+    
+    summary->estimate = estimate;
+    summary->standard_error = se;
+    summary->reject = summary->p_value < alpha;
+    summary->effect_size = (estimate - request->null_value) / scale;
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Paired t-test, H0: mean difference is 0
+ */
+hypothesis_error_t hypothesis_t_test_paired(const double* sample1, const double* sample2, size_t count,
+                                            double alpha, hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    if (!sample1 || !sample2 || count <= 1) return HYPOTHESIS_ERROR_INVALID_SAMPLES;
+    
+    double* diffs = (double*)malloc(count * sizeof(double));
+    if (!diffs) return HYPOTHESIS_ERROR_OUT_OF_MEMORY;
+    
+    hypothesis_moments_t moments;
+    vector_difference(sample1, sample2, diffs, count);
+    hypothesis_sample_moments(diffs, count, &moments);
+    free(diffs);
+    
+    double s = sqrt(hypothesis_moments_variance(&moments));
+    hypothesis_error_t error = hypothesis_t_test_one_sample(moments.mean, (double)moments.n, s, 0.0,
+                                                            alpha, result);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    
+    result->mean_diff = moments.mean;
+    result->s_diff = s;
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Two-sample F-test, H0: sigma1^2 = sigma2^2
+ * CDF of F(df1, df2) at f is I_x(df1/2, df2/2) with x = df1 f / (df1 f + df2);
+ * above x = 1/2 the mirrored form in 1 - x = df2 / (df1 f + df2) is used.
+ */
+hypothesis_error_t hypothesis_f_test_two_sample(double s1, double n1, double s2, double n2,
+                                                hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    hypothesis_error_t error = hypothesis_check_s(n1, s1);
+    if (error == HYPOTHESIS_SUCCESS) error = hypothesis_check_s(n2, s2);
+    if (error != HYPOTHESIS_SUCCESS) return error;
+    if (n1 <= 1.0 || n2 <= 1.0) return HYPOTHESIS_ERROR_SAMPLES_TOO_SMALL;
+    
+    double f = (s1 * s1) / (s2 * s2);
+    double df1 = n1 - 1.0;
+    double df2 = n2 - 1.0;
+    double cdf;
+    double upper;
+    
+    if (isnan(f)) {
+        cdf = NAN;
+        upper = NAN;
+    } else if (isinf(f)) {
+        cdf = 1.0;
+        upper = 0.0;
+    } else {
+        double denominator = df1 * f + df2;
+        double x = df1 * f / denominator;
+        if (x <= 0.5) {
+            cdf = incomplete_beta_evaluate(df1 / 2.0, df2 / 2.0, x, NAN, NULL, &upper);
+        } else {
+            upper = incomplete_beta_evaluate(df2 / 2.0, df1 / 2.0, df2 / denominator, NAN, NULL, &cdf);
+        }
+    }
+    
+    result->statistic = f;
+    result->df = df1;
+    result->df2 = df2;
+    result->p_left = cdf;
+    result->p_right = upper;
+    result->p_two_tail = 2.0 * fmin(cdf, upper);
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Chi-square upper tail Q(df/2, chi/2) into a result
+ */
+static void hypothesis_chi_square_finish(double chi_square, double df, hypothesis_result_t* result) {
+    result->statistic = chi_square;
+    result->df = df;
+    result->p_right = regularized_upper_gamma(df / 2.0, chi_square / 2.0);
+}
+
+/**
+ * @brief Chi-square goodness of fit
+ */
+hypothesis_error_t hypothesis_chi_square_goodness_of_fit(const double* observed, const double* expected,
+                                                         size_t count, hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    if (!observed || !expected || count < 2) return HYPOTHESIS_ERROR_INVALID_DATA;
+    
+    double total = 0.0;
+    double expected_total = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        total += observed[i];
+        expected_total += expected[i];
+    }
+    
+    // Probabilities are scaled to counts, counts to the observed total
+    double scale = 1.0;
+    if (fabs(expected_total - 1.0) < 0.01 && fabs(expected_total - total) > 1.0) {
+        scale = total;
+    } else if (fabs(expected_total - total) > 1.0) {
+        scale = total / expected_total;
+    }
+    
+    double chi_square = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        double e = expected[i] * scale;
+        if (e <= 0.0) return HYPOTHESIS_ERROR_EXPECTED_ZERO;
+        double d = observed[i] - e;
+        chi_square += d * d / e;
+    }
+    
+    hypothesis_chi_square_finish(chi_square, (double)(count - 1), result);
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Chi-square test of independence
+ * Row and column totals are gathered in one pass over the table; cells with
+ * a zero expected count are left out of the statistic.
+ */
+hypothesis_error_t hypothesis_chi_square_independence(const double* observed, size_t rows, size_t cols,
+                                                      hypothesis_result_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    hypothesis_result_clear(result);
+    
+    if (!observed || rows < 2 || cols < 2) return HYPOTHESIS_ERROR_INVALID_MATRIX;
+    
+    double* col_totals = (double*)calloc(cols, sizeof(double));
+    double grand_total = 0.0;
+    
+    if (!col_totals) return HYPOTHESIS_ERROR_OUT_OF_MEMORY;
+    
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+            double value = observed[i * cols + j];
+            if (value < 0.0) {
+                free(col_totals);
+                return HYPOTHESIS_ERROR_NEGATIVE_VALUE;
+            }
+            col_totals[j] += value;
+            grand_total += value;
+        }
+    }
+    
+    double chi_square = 0.0;
+    for (size_t i = 0; i < rows; i++) {
+        const double* row = observed + i * cols;
+        double row_total = 0.0;
+    
+        for (size_t j = 0; j < cols; j++) {
+            row_total += row[j];
+        }
+        for (size_t j = 0; j < cols; j++) {
+            double e = row_total * col_totals[j] / grand_total;
+            if (e > 0.0) {
+                double d = row[j] - e;
+                chi_square += d * d / e;
+            }
+        }
+    }
+    
+    free(col_totals);
+    hypothesis_chi_square_finish(chi_square, (double)((rows - 1) * (cols - 1)), result);
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Regression from accumulated moments
+ */
+hypothesis_error_t hypothesis_regression_from_moments(const hypothesis_comoments_t* moments, double alpha,
+                                                      hypothesis_regression_t* result) {
+    if (!moments || !result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    if (moments->n <= 2) return HYPOTHESIS_ERROR_TOO_FEW_POINTS;
+    if (moments->m2_x == 0.0) return HYPOTHESIS_ERROR_ZERO_VARIANCE_X;
+    
+    double sxx = moments->m2_x;
+    double syy = moments->m2_y;
+    double sxy = moments->c_xy;
+    double df = (double)(moments->n - 2);
+    double slope = sxy / sxx;
+    
+    result->slope = slope;
+    result->intercept = moments->mean_y - slope * moments->mean_x;
+    // A constant y still has a fitted line, but its correlation is reported as 0
+    result->r = (syy == 0.0) ? 0.0 : sxy / sqrt(sxx * syy);
+    result->r_squared = result->r * result->r;
+    result->df = df;
+    result->lower_ci_slope = NAN;
+    result->upper_ci_slope = NAN;
+    result->has_ci = 0;
+    
+    double mse = fmax(0.0, syy - slope * sxy) / df;
+    
+    if (mse <= HYPOTHESIS_EXACT_FIT_EPSILON) {
+        int flat = fabs(slope) <= HYPOTHESIS_EXACT_FIT_EPSILON;
+        result->t = flat ? 0.0 : INFINITY;
+        result->p_two_tail = flat ? 1.0 : 0.0;
+        return HYPOTHESIS_SUCCESS;
+    }
+    
+    hypothesis_result_t tails;
+    double se_slope = sqrt(mse / sxx);
+    double margin = hypothesis_t_critical(df, alpha) * se_slope;
+    
+    result->t = slope / se_slope;
+    hypothesis_t_tails(result->t, df, &tails);
+    result->p_two_tail = tails.p_two_tail;
+    result->lower_ci_slope = slope - margin;
+    result->upper_ci_slope = slope + margin;
+    result->has_ci = 1;
+    
+    return HYPOTHESIS_SUCCESS;
+}
+
+/**
+ * @brief Simple linear regression t-test for the slope, H0: beta1 = 0
+ */
+hypothesis_error_t hypothesis_linear_regression(const double* x, const double* y, size_t count,
+                                                double alpha, hypothesis_regression_t* result) {
+    if (!result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    if (!x || !y || count <= 2) return HYPOTHESIS_ERROR_TOO_FEW_POINTS;
+    
+    if (!vector_all_finite(x, count) || !vector_all_finite(y, count)) {
+        return HYPOTHESIS_ERROR_NON_FINITE_POINT;
+    }
+    
+    // Two-pass centered sums from the vectorized reductions
+    hypothesis_comoments_t moments;
+    moments.n = count;
+    moments.mean_x = vector_sum(x, count) / (double)count;
+    moments.mean_y = vector_sum(y, count) / (double)count;
+    moments.m2_x = vector_sum_squares(x, count, moments.mean_x);
+    moments.m2_y = vector_sum_squares(y, count, moments.mean_y);
+    moments.c_xy = vector_sum_products(x, y, count, moments.mean_x, moments.mean_y);
+    
+    return hypothesis_regression_from_moments(&moments, alpha, result);
+}
+
+/**
+ * @brief Neumaier step: add value, keeping the rounding error of the addition
+ */
+static void hypothesis_sum_add(hypothesis_sum_t* sum, double value) {
+    double total = sum->sum + value;
+    
+    if (fabs(sum->sum) >= fabs(value)) {
+        sum->compensation += (sum->sum - total) + value;
+    } else {
+        sum->compensation += (value - total) + sum->sum;
+    }
+    sum->sum = total;
+}
+
+static double hypothesis_sum_value(const hypothesis_sum_t* sum) {
+    return sum->sum + sum->compensation;
+}
+
+/**
+ * @brief Fold a shifted point into the sums with the given sign (+1 add, -1 remove)
+ */
+static void hypothesis_accumulator_apply(hypothesis_regression_accumulator_t* acc, double x, double y,
+                                         double sign) {
+    double dx = x - acc->shift_x;
+    double dy = y - acc->shift_y;
+    
+    hypothesis_sum_add(&acc->sum_x, sign * dx);
+    hypothesis_sum_add(&acc->sum_y, sign * dy);
+    hypothesis_sum_add(&acc->sum_xx, sign * dx * dx);
+    hypothesis_sum_add(&acc->sum_xy, sign * dx * dy);
+    hypothesis_sum_add(&acc->sum_yy, sign * dy * dy);
+}
+
+/**
+ * @brief Reset an online regression accumulator
+ */
+void hypothesis_accumulator_init(hypothesis_regression_accumulator_t* acc) {
+    if (!acc) return;
+    
+    acc->n = 0;
+    acc->shift_x = 0.0;
+    acc->shift_y = 0.0;
+    acc->sum_x = (hypothesis_sum_t){0.0, 0.0};
+    acc->sum_y = (hypothesis_sum_t){0.0, 0.0};
+    acc->sum_xx = (hypothesis_sum_t){0.0, 0.0};
+    acc->sum_xy = (hypothesis_sum_t){0.0, 0.0};
+    acc->sum_yy = (hypothesis_sum_t){0.0, 0.0};
+}
+
+/**
+ * @brief Add one point; the first point of an empty accumulator becomes the shift
+ */
+int hypothesis_accumulator_add(hypothesis_regression_accumulator_t* acc, double x, double y) {
+    if (!acc || !is_finite_number(x) || !is_finite_number(y)) return -1;
+    
+    if (acc->n == 0) {
+        acc->shift_x = x;
+        acc->shift_y = y;
+    }
+    hypothesis_accumulator_apply(acc, x, y, 1.0);
+    acc->n++;
+    
+    return 0;
+}
+
+/**
+ * @brief Remove one previously added point
+ * Emptying the accumulator resets it, dropping any residue and the old shift.
+ */
+int hypothesis_accumulator_remove(hypothesis_regression_accumulator_t* acc, double x, double y) {
+    if (!acc || acc->n == 0 || !is_finite_number(x) || !is_finite_number(y)) return -1;
+    
+    if (acc->n == 1) {
+        hypothesis_accumulator_init(acc);
+        return 0;
+    }
+    hypothesis_accumulator_apply(acc, x, y, -1.0);
+    acc->n--;
+    
+    return 0;
+}
+
+/**
+ * @brief Replace a previously added point with (x, y)
+ */
+int hypothesis_accumulator_replace(hypothesis_regression_accumulator_t* acc, double old_x, double old_y,
+                                   double x, double y) {
+    if (!acc || !is_finite_number(x) || !is_finite_number(y)) return -1;
+    if (hypothesis_accumulator_remove(acc, old_x, old_y) != 0) return -1;
+    
+    return hypothesis_accumulator_add(acc, x, y);
+}
+
+/**
+ * @brief Centered sum of products from raw shifted sums, clamped at zero for squares
+ */
+static double hypothesis_centered(const hypothesis_sum_t* sum_ab, const hypothesis_sum_t* sum_a,
+                                  const hypothesis_sum_t* sum_b, double n, int square) {
+    double raw = hypothesis_sum_value(sum_ab);
+    double centered = raw - hypothesis_sum_value(sum_a) * hypothesis_sum_value(sum_b) / n;
+    
+    if (square && centered <= HYPOTHESIS_CANCELLATION_EPSILON * raw) {
+        return 0.0;
+    }
+    return centered;
+}
+
+/**
+ * @brief Fit the accumulated points
+ */
+hypothesis_error_t hypothesis_accumulator_fit(const hypothesis_regression_accumulator_t* acc, double alpha,
+                                              hypothesis_regression_t* result) {
+    if (!acc || !result) return HYPOTHESIS_ERROR_NULL_POINTER;
+    
+    double n = (double)acc->n;
+    hypothesis_comoments_t moments;
+    
+    moments.n = acc->n;
+    if (acc->n == 0) {
+        return HYPOTHESIS_ERROR_TOO_FEW_POINTS;
+    }
+    moments.mean_x = acc->shift_x + hypothesis_sum_value(&acc->sum_x) / n;
+    moments.mean_y = acc->shift_y + hypothesis_sum_value(&acc->sum_y) / n;
+    moments.m2_x = hypothesis_centered(&acc->sum_xx, &acc->sum_x, &acc->sum_x, n, 1);
+    moments.m2_y = hypothesis_centered(&acc->sum_yy, &acc->sum_y, &acc->sum_y, n, 1);
+    moments.c_xy = hypothesis_centered(&acc->sum_xy, &acc->sum_x, &acc->sum_y, n, 0);
+    
+    return hypothesis_regression_from_moments(&moments, alpha, result);
+}
+
+/**
+ * @brief hypothesis_engine.js error name for a status code
+ */
+const char* hypothesis_error_code(hypothesis_error_t error) {
+    switch (error) {
+        case HYPOTHESIS_SUCCESS:
+            return NULL;
+        case HYPOTHESIS_ERROR_N_NOT_POSITIVE:
+        case HYPOTHESIS_ERROR_N_NOT_INTEGER:
+        case HYPOTHESIS_ERROR_N_TOO_SMALL:
+        case HYPOTHESIS_ERROR_SAMPLES_TOO_SMALL:
+            return "invalid_n";
+        case HYPOTHESIS_ERROR_INVALID_S:
+            return "invalid_s";
+        case HYPOTHESIS_ERROR_INVALID_SIGMA:
+            return "invalid_sigma";
+        case HYPOTHESIS_ERROR_INVALID_SAMPLES:
+            return "invalid_samples";
+        case HYPOTHESIS_ERROR_EXPECTED_ZERO:
+            return "expected_zero";
+        case HYPOTHESIS_ERROR_INVALID_MATRIX:
+            return "invalid_matrix";
+        case HYPOTHESIS_ERROR_NEGATIVE_VALUE:
+            return "negative_value";
+        case HYPOTHESIS_ERROR_ZERO_VARIANCE_X:
+            return "zero_variance_x";
+        default:
+            return "invalid_data";
+    }
+}
+
+/**
+ * @brief hypothesis_engine.js error message for a status code
+ */
+const char* hypothesis_error_message(hypothesis_error_t error) {
+    switch (error) {
+        case HYPOTHESIS_ERROR_N_NOT_POSITIVE:
+            return "Sample size must be > 0";
+        case HYPOTHESIS_ERROR_N_NOT_INTEGER:
+            return "Sample size must be an integer";
+        case HYPOTHESIS_ERROR_N_TOO_SMALL:
+            return "Sample size must be > 1 for t-test";
+        case HYPOTHESIS_ERROR_SAMPLES_TOO_SMALL:
+            return "Sample sizes must be > 1";
+        case HYPOTHESIS_ERROR_INVALID_S:
+            return "Standard deviation must be >= 0";
+        case HYPOTHESIS_ERROR_INVALID_SIGMA:
+            return "Sigma must be > 0";
+        case HYPOTHESIS_ERROR_INVALID_SAMPLES:
+            return "Samples must be same length and > 1";
+        case HYPOTHESIS_ERROR_TOO_FEW_POINTS:
+            return "Need at least 3 points for regression";
+        case HYPOTHESIS_ERROR_NON_FINITE_POINT:
+            return "All X and Y values must be valid numbers";
+        case HYPOTHESIS_ERROR_INVALID_MATRIX:
+            return "Matrix must be at least 2x2";
+        case HYPOTHESIS_ERROR_NEGATIVE_VALUE:
+            return "Observed counts cannot be negative";
+        case HYPOTHESIS_ERROR_ZERO_VARIANCE_X:
+            return "X values must vary";
+        case HYPOTHESIS_ERROR_NULL_POINTER:
+            return "Null pointer error";
+        case HYPOTHESIS_ERROR_OUT_OF_MEMORY:
+            return "Out of memory";
+        default:
+            return NULL;
+    }
+}
@@ -0,0 +1,302 @@
+#ifndef HYPOTHESIS_KERNELS_H
+#define HYPOTHESIS_KERNELS_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hypothesis test status codes
+ * Several codes share one JS error name (see hypothesis_error_code) and differ
+ * only in the message, matching hypothesis_engine.js.
+ */
+typedef enum {
+    HYPOTHESIS_SUCCESS = 0,
+    HYPOTHESIS_ERROR_N_NOT_POSITIVE,
+    HYPOTHESIS_ERROR_N_NOT_INTEGER,
+    HYPOTHESIS_ERROR_N_TOO_SMALL,        // one-sample t-test needs n > 1
+    HYPOTHESIS_ERROR_SAMPLES_TOO_SMALL,  // two-sample tests need n1, n2 > 1
+    HYPOTHESIS_ERROR_INVALID_S,
+    HYPOTHESIS_ERROR_INVALID_SIGMA,
+    HYPOTHESIS_ERROR_INVALID_SAMPLES,
+    HYPOTHESIS_ERROR_INVALID_DATA,
+    HYPOTHESIS_ERROR_TOO_FEW_POINTS,
+    HYPOTHESIS_ERROR_NON_FINITE_POINT,
+    HYPOTHESIS_ERROR_EXPECTED_ZERO,
+    HYPOTHESIS_ERROR_INVALID_MATRIX,
+    HYPOTHESIS_ERROR_NEGATIVE_VALUE,
+    HYPOTHESIS_ERROR_ZERO_VARIANCE_X,
+    HYPOTHESIS_ERROR_NULL_POINTER,
+    HYPOTHESIS_ERROR_OUT_OF_MEMORY
+} hypothesis_error_t;
+
+/**
+ * @brief Running sample moments (Welford)
+ * One pass, no stored samples; m2 is the sum of squared deviations from the
+ * running mean, which stays accurate where sum(x^2) - n*mean^2 cancels.
+ */
+typedef struct {
+    size_t n;
+    double mean;
+    double m2;
+} hypothesis_moments_t;
+
+/**
+ * @brief Running paired moments for regression
+ * c_xy is the sum of (x - mean_x)(y - mean_y), updated like m2.
+ */
+typedef struct {
+    size_t n;
+    double mean_x;
+    double mean_y;
+    double m2_x;
+    double m2_y;
+    double c_xy;
+} hypothesis_comoments_t;
+
+/**
+ * @brief Result of a Z, t, F or chi-square test
+ * Fields a test does not produce are NAN: chi-square tests fill statistic, df
+ * and p_right only, F tests leave the intervals unset, and mean_diff/s_diff
+ * are set by the paired t-test alone.
+ */
+typedef struct {
+    double statistic;   // z, t, F or chi-square
+    double df;          // t/chi-square degrees of freedom, F numerator df
+    double df2;         // F denominator df
+    double p_two_tail;
+    double p_left;
+    double p_right;     // also the chi-square p-value
+    double lower_ci;
+    double upper_ci;
+    double mean_diff;
+    double s_diff;
+} hypothesis_result_t;
+
+/**
+ * @brief Simple linear regression and slope t-test
+ * has_ci is 0 (and the slope interval NAN) when the residuals vanish.
+ */
+typedef struct {
+    double intercept;
+    double slope;
+    double r;
+    double r_squared;
+    double t;
+    double df;
+    double p_two_tail;
+    double lower_ci_slope;
+    double upper_ci_slope;
+    int has_ci;
+} hypothesis_regression_t;
+
+/**
+ * @brief Compensated (Neumaier) running sum
+ * The value is sum + compensation; compensation collects the low-order bits
+ * each addition rounds away, so long add/remove sequences do not drift.
+ */
+typedef struct {
+    double sum;
+    double compensation;
+} hypothesis_sum_t;
+
+/**
+ * @brief Online regression accumulator
+ * Keeps n and the sums of x, y, x^2, xy and y^2 so a single point can be
+ * added, removed or replaced in O(1) and the fit derived on demand. Points
+ * are summed relative to the first one added (shift_x, shift_y), which keeps
+ * sum(x^2) - sum(x)^2/n from cancelling for data far from the origin.
+ */
+typedef struct {
+    size_t n;
+    double shift_x;
+    double shift_y;
+    hypothesis_sum_t sum_x;
+    hypothesis_sum_t sum_y;
+    hypothesis_sum_t sum_xx;
+    hypothesis_sum_t sum_xy;
+    hypothesis_sum_t sum_yy;
+} hypothesis_regression_accumulator_t;
+
+// Running moments
+void hypothesis_moments_init(hypothesis_moments_t* moments);
+void hypothesis_moments_push(hypothesis_moments_t* moments, double x);
+double hypothesis_moments_variance(const hypothesis_moments_t* moments);  // sample (n - 1) variance
+void hypothesis_comoments_init(hypothesis_comoments_t* moments);
+void hypothesis_comoments_push(hypothesis_comoments_t* moments, double x, double y);
+
+/**
+ * @brief Sample moments of data, skipping non-finite values
+ * All-finite data takes the vectorized two-pass path (vector_math.h); any
+ * non-finite value falls back to streaming Welford updates.
+ * @return 0 on success, -1 if data or out is NULL with a non-zero count
+ */
+int hypothesis_sample_moments(const double* data, size_t count, hypothesis_moments_t* out);
+
+/**
+ * @brief Tests from summary statistics
+ * n is a double so non-integral sizes from the UI are rejected rather than
+ * truncated. alpha sets the (1 - alpha) confidence interval.
+ */
+hypothesis_error_t hypothesis_z_test_one_sample(double mean, double n, double sigma, double mu0,
+                                                double alpha, hypothesis_result_t* result);
+hypothesis_error_t hypothesis_z_test_two_sample(double mean1, double n1, double sigma1,
+                                                double mean2, double n2, double sigma2,
+                                                double diff, double alpha, hypothesis_result_t* result);
+hypothesis_error_t hypothesis_t_test_one_sample(double mean, double n, double s, double mu0,
+                                                double alpha, hypothesis_result_t* result);
+
+/**
+ * @brief Independent two-sample t-test
+ * @param equal_variances 1 for the pooled test, 0 for Welch's test with
+ *        Welch–Satterthwaite degrees of freedom
+ */
+hypothesis_error_t hypothesis_t_test_two_sample(double mean1, double n1, double s1,
+                                                double mean2, double n2, double s2,
+                                                int equal_variances, double diff, double alpha,
+                                                hypothesis_result_t* result);
+
+/**
+ * @brief Alternative hypothesis, as picked on tail_type_select
+ */
+typedef enum {
+    HYPOTHESIS_TAIL_TWO = 0,
+    HYPOTHESIS_TAIL_LEFT,
+    HYPOTHESIS_TAIL_RIGHT
+} hypothesis_tail_t;
+
+/**
+ * @brief Summary-statistic tests hypothesis_summary covers
+ */
+typedef enum {
+    HYPOTHESIS_SUMMARY_Z_ONE_SAMPLE = 0,
+    HYPOTHESIS_SUMMARY_Z_TWO_SAMPLE,
+    HYPOTHESIS_SUMMARY_T_ONE_SAMPLE,
+    HYPOTHESIS_SUMMARY_T_POOLED,
+    HYPOTHESIS_SUMMARY_T_WELCH
+} hypothesis_summary_kind_t;
+
+// Confidence levels one hypothesis_summary call can report
+#define HYPOTHESIS_SUMMARY_MAX_LEVELS 4
+
+/**
+ * @brief Inputs of hypothesis_summary
+ * spread is sigma for the Z tests and s for the t tests; the second sample is
+ * ignored by one-sample kinds. null_value is mu0 or the hypothesized
+ * difference. levels are two-sided confidence levels such as 0.95.
+ */
+typedef struct {
+    hypothesis_summary_kind_t kind;
+    double mean1;
+    double n1;
+    double spread1;
+    double mean2;
+    double n2;
+    double spread2;
+    double null_value;
+    hypothesis_tail_t tail;
+    double alpha;
+    size_t level_count;
+    double levels[HYPOTHESIS_SUMMARY_MAX_LEVELS];
+} hypothesis_summary_request_t;
+
+/**
+ * @brief Everything a Z or t result page shows
+ * test holds what the single test function returns (interval at 1 - alpha).
+ * p_value and reject follow the requested tail. effect_size is Cohen's d
+ * against null_value. power is the chance of rejecting at alpha if the true
+ * effect equals the observed one.
+ */
+typedef struct {
+    hypothesis_result_t test;
+    double estimate;           // mean or mean difference
+    double standard_error;
+    double p_value;
+    int reject;
+    double critical_value;     // rejection threshold on the statistic's scale, for the tail at alpha
+    size_t level_count;
+    double levels[HYPOTHESIS_SUMMARY_MAX_LEVELS];
+    double lower[HYPOTHESIS_SUMMARY_MAX_LEVELS];
+    double upper[HYPOTHESIS_SUMMARY_MAX_LEVELS];
+    double effect_size;
+    double power;
+} hypothesis_summary_t;
+
+/**
+ * @brief Statistic, tail p-value, intervals at several levels, effect size and
+ * power from one set of moments
+ * The standard error and degrees of freedom are formed once and each distinct
+ * critical value is computed once, then shared by the intervals, the decision
+ * and the power. t-test power uses the shifted central t, which is close to
+ * the noncentral t for the moderate effects and sizes entered on the band.
+ * @return the error the matching single test would return, or
+ *         HYPOTHESIS_ERROR_INVALID_DATA for an invalid alpha or level
+ */
+hypothesis_error_t hypothesis_summary(const hypothesis_summary_request_t* request, hypothesis_summary_t* summary);
+
+/**
+ * @brief Paired t-test on sample1[i] - sample2[i]
+ * Pairs whose difference is not finite are skipped. The differences are
+ * formed in a temporary buffer, so HYPOTHESIS_ERROR_OUT_OF_MEMORY is possible.
+ */
+hypothesis_error_t hypothesis_t_test_paired(const double* sample1, const double* sample2, size_t count,
+                                            double alpha, hypothesis_result_t* result);
+
+// F-test for equal variances from sample standard deviations
+hypothesis_error_t hypothesis_f_test_two_sample(double s1, double n1, double s2, double n2,
+                                                hypothesis_result_t* result);
+
+/**
+ * @brief Chi-square goodness of fit
+ * expected may hold counts or probabilities; probabilities (sum near 1) and
+ * counts whose total differs from the observed total are rescaled to it.
+ */
+hypothesis_error_t hypothesis_chi_square_goodness_of_fit(const double* observed, const double* expected,
+                                                         size_t count, hypothesis_result_t* result);
+
+// Chi-square test of independence on a row-major rows x cols table
+hypothesis_error_t hypothesis_chi_square_independence(const double* observed, size_t rows, size_t cols,
+                                                      hypothesis_result_t* result);
+
+// Least-squares fit of y on x with a t-test and (1 - alpha) interval for the slope
+hypothesis_error_t hypothesis_linear_regression(const double* x, const double* y, size_t count,
+                                                double alpha, hypothesis_regression_t* result);
+
+/**
+ * @brief Regression from accumulated moments, for callers that stream points
+ * @return HYPOTHESIS_ERROR_TOO_FEW_POINTS for fewer than 3 points
+ */
+hypothesis_error_t hypothesis_regression_from_moments(const hypothesis_comoments_t* moments, double alpha,
+                                                      hypothesis_regression_t* result);
+
+/**
+ * @brief Online regression accumulator updates
+ * @return 0 on success, -1 for a non-finite point (or removing from an empty
+ *         accumulator), leaving the accumulator unchanged
+ * Removing a point that was never added corrupts the sums; callers track
+ * which points they added.
+ */
+void hypothesis_accumulator_init(hypothesis_regression_accumulator_t* acc);
+int hypothesis_accumulator_add(hypothesis_regression_accumulator_t* acc, double x, double y);
+int hypothesis_accumulator_remove(hypothesis_regression_accumulator_t* acc, double x, double y);
+int hypothesis_accumulator_replace(hypothesis_regression_accumulator_t* acc, double old_x, double old_y,
+                                   double x, double y);
+
+/**
+ * @brief Fit of the accumulated points, same results as hypothesis_linear_regression
+ * X variation below the rounding left by removals counts as zero variance.
+ */
+hypothesis_error_t hypothesis_accumulator_fit(const hypothesis_regression_accumulator_t* acc, double alpha,
+                                              hypothesis_regression_t* result);
+
+// hypothesis_engine.js error name ("invalid_n", ...) and message (NULL where the JS has none)
+const char* hypothesis_error_code(hypothesis_error_t error);
+const char* hypothesis_error_message(hypothesis_error_t error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HYPOTHESIS_KERNELS_H
@@ -0,0 +1,339 @@
+#include "monte_carlo.h"
+#include "../../../src/common/cache/sync.h"
+#include <math.h>
+#include <string.h>
+
+#define POKER_RANK_MASKS (1 << POKER_RANK_COUNT)
+
+/**
+ * @brief splitmix64 step, used only to expand seeds
+ */
+static uint64_t sim_splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t sim_rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * @brief Seed the generator from a 64-bit value
+ */
+void sim_rng_seed(sim_rng_t* rng, uint64_t seed) {
+    if (!rng) return;
+
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = sim_splitmix64(&seed);
+    }
+}
+
+/**
+ * @brief Next 64-bit output (xoshiro256**)
+ */
+uint64_t sim_rng_next(sim_rng_t* rng) {
+    uint64_t* s = rng->s;
+    uint64_t result = sim_rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = sim_rotl(s[3], 45);
+
+    return result;
+}
+
+double sim_rng_uniform(sim_rng_t* rng) {
+    return (double)(sim_rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+uint32_t sim_rng_bounded(sim_rng_t* rng, uint32_t bound) {
+    if (bound == 0) return 0;
+
+    uint64_t m = (sim_rng_next(rng) >> 32) * (uint64_t)bound;
+    uint32_t low = (uint32_t)m;
+
+    if (low < bound) {
+        uint32_t threshold = (uint32_t)(-bound) % bound;
+        while (low < threshold) {
+            m = (sim_rng_next(rng) >> 32) * (uint64_t)bound;
+            low = (uint32_t)m;
+        }
+    }
+
+    return (uint32_t)(m >> 32);
+}
+
+void sim_rng_fill_uniform(sim_rng_t* rng, double* out, size_t count) {
+    if (!rng || !out) return;
+
+    for (size_t i = 0; i < count; i++) {
+        out[i] = sim_rng_uniform(rng);
+    }
+}
+
+/**
+ * @brief Population count (SWAR)
+ */
+static int sim_popcount64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+}
+
+/**
+ * @brief Index of the lowest set bit (de Bruijn multiply), x must be non-zero
+ */
+static int sim_ctz64(uint64_t x) {
+    static const uint8_t debruijn_index[64] = {
+        0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+        62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+        63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+        46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6
+    };
+
+    return debruijn_index[((x & (~x + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+/**
+ * @brief Quantize p to the fixed-point probability sim_bernoulli_word takes
+ */
+uint64_t sim_bernoulli_fixed(double p) {
+    if (!(p > 0.0)) return 0;
+    if (p >= 1.0) return (uint64_t)1 << SIM_BERNOULLI_BITS;
+
+    return (uint64_t)llround(ldexp(p, SIM_BERNOULLI_BITS));
+}
+
+uint64_t sim_bernoulli_word(sim_rng_t* rng, uint64_t p_fixed) {
+    if (p_fixed == 0) return 0;
+    if (p_fixed >= (uint64_t)1 << SIM_BERNOULLI_BITS) return ~(uint64_t)0;
+
+    // Bits of p below the lowest set one cannot change the outcome
+    int skip = sim_ctz64(p_fixed);
+    uint64_t bits = p_fixed >> skip;
+    uint64_t word = 0;
+
+    // From the least significant digit of p up: a 1 digit ORs a fresh word in, a 0 digit ANDs it
+    for (int i = skip; i < SIM_BERNOULLI_BITS; i++, bits >>= 1) {
+        uint64_t r = sim_rng_next(rng);
+        word = (bits & 1) ? (word | r) : (word & r);
+    }
+
+    return word;
+}
+
+int sim_coin_init(sim_coin_t* sim, double p, uint64_t trials, uint64_t seed) {
+    if (!sim || isnan(p) || p < 0.0 || p > 1.0) return -1;
+
+    memset(sim, 0, sizeof(*sim));
+    sim_rng_seed(&sim->rng, seed);
+    sim->p_fixed = sim_bernoulli_fixed(p);
+    sim->trials_total = trials;
+    sim->run_face = -1;
+
+    return 0;
+}
+
+/**
+ * @brief Extend the open run with length flips of face
+ */
+static void sim_coin_extend_run(sim_coin_t* sim, int face, uint64_t length) {
+    if (face == sim->run_face) {
+        sim->run_length += length;
+    } else {
+        sim->run_face = face;
+        sim->run_length = length;
+    }
+
+    uint64_t* longest = face ? &sim->longest_heads_run : &sim->longest_tails_run;
+    if (sim->run_length > *longest) {
+        *longest = sim->run_length;
+    }
+}
+
+uint64_t sim_coin_step(sim_coin_t* sim, uint64_t max_trials) {
+    if (!sim || sim->trials_done >= sim->trials_total) return 0;
+
+    uint64_t remaining = sim->trials_total - sim->trials_done;
+    uint64_t todo = max_trials < remaining ? max_trials : remaining;
+    uint64_t done = 0;
+
+    while (done < todo) {
+        int width = (todo - done) < 64 ? (int)(todo - done) : 64;
+        uint64_t word = sim_bernoulli_word(&sim->rng, sim->p_fixed);
+
+        if (width < 64) {
+            word &= ((uint64_t)1 << width) - 1;
+        }
+        sim->heads += (uint64_t)sim_popcount64(word);
+
+        // Walk the word run by run: ctz finds where the current face ends
+        int pos = 0;
+        while (pos < width) {
+            uint64_t tail = word >> pos;
+            int face = (int)(tail & 1);
+            int available = width - pos;
+            uint64_t change = face ? ~tail : tail;
+
+            if (available < 64) {
+                change |= (uint64_t)1 << available;
+            }
+            int length = change ? sim_ctz64(change) : 64;
+            if (length > available) length = available;
+
+            sim_coin_extend_run(sim, face, (uint64_t)length);
+            pos += length;
+        }
+
+        done += (uint64_t)width;
+    }
+
+    sim->trials_done += done;
+    return done;
+}
+
+// Highest straight in each rank mask (rank of its top card + 1, 0 for none) and its bit count
+static uint8_t poker_straight_table[POKER_RANK_MASKS];
+static uint8_t poker_bit_count_table[POKER_RANK_MASKS];
+static int poker_tables_ready = 0;
+static cache_lock_t poker_tables_lock = CACHE_LOCK_INITIALIZER;
+
+/**
+ * @brief Build the rank-mask tables once
+ */
+static void poker_tables_init(void) {
+    cache_lock_acquire(&poker_tables_lock);
+    if (!poker_tables_ready) {
+        for (int mask = 0; mask < POKER_RANK_MASKS; mask++) {
+            // The ace also plays low, below the deuce, for the wheel
+            uint32_t ranks = ((uint32_t)mask << 1) | ((uint32_t)mask >> (POKER_RANK_COUNT - 1) & 1u);
+            uint32_t runs = ranks & (ranks >> 1) & (ranks >> 2) & (ranks >> 3) & (ranks >> 4);
+            uint8_t high = 0;
+
+            for (int bit = POKER_RANK_COUNT; bit >= 0; bit--) {
+                if (runs & (1u << bit)) {
+                    high = (uint8_t)(bit + 4);
+                    break;
+                }
+            }
+            poker_straight_table[mask] = high;
+            poker_bit_count_table[mask] = (uint8_t)sim_popcount64((uint64_t)mask);
+        }
+        poker_tables_ready = 1;
+    }
+    cache_lock_release(&poker_tables_lock);
+}
+
+poker_category_t poker_evaluate(const uint8_t* cards, int count) {
+    uint32_t suit_masks[POKER_SUIT_COUNT] = {0, 0, 0, 0};
+    uint32_t seen = 0;      // ranks held at least once
+    uint32_t twice = 0;     // at least twice
+    uint32_t thrice = 0;    // at least three times
+    uint32_t four = 0;
+
+    if (!cards || count < POKER_MIN_HAND || count > POKER_MAX_HAND) return POKER_HIGH_CARD;
+
+    if (!poker_tables_ready) {
+        poker_tables_init();
+    }
+
+    for (int i = 0; i < count; i++) {
+        int rank = cards[i] / POKER_SUIT_COUNT;
+        uint32_t bit = 1u << rank;
+
+        suit_masks[cards[i] % POKER_SUIT_COUNT] |= bit;
+        four |= thrice & bit;
+        thrice |= twice & bit;
+        twice |= seen & bit;
+        seen |= bit;
+    }
+
+    int flush_suit = -1;
+    for (int s = 0; s < POKER_SUIT_COUNT; s++) {
+        if (poker_bit_count_table[suit_masks[s]] >= 5) {
+            flush_suit = s;
+        }
+    }
+
+    if (flush_suit >= 0 && poker_straight_table[suit_masks[flush_suit]]) return POKER_STRAIGHT_FLUSH;
+    if (four) return POKER_FOUR_OF_A_KIND;
+    // Two sets of trips also make a full house; twice includes the trips ranks
+    if (thrice && poker_bit_count_table[twice] >= 2) return POKER_FULL_HOUSE;
+    if (flush_suit >= 0) return POKER_FLUSH;
+    if (poker_straight_table[seen]) return POKER_STRAIGHT;
+    if (thrice) return POKER_THREE_OF_A_KIND;
+    if (poker_bit_count_table[twice] >= 2) return POKER_TWO_PAIR;
+    if (twice) return POKER_PAIR;
+
+    return POKER_HIGH_CARD;
+}
+
+const char* poker_category_name(poker_category_t category) {
+    switch (category) {
+        case POKER_HIGH_CARD:
+            return "high_card";
+        case POKER_PAIR:
+            return "pair";
+        case POKER_TWO_PAIR:
+            return "two_pair";
+        case POKER_THREE_OF_A_KIND:
+            return "three_of_a_kind";
+        case POKER_STRAIGHT:
+            return "straight";
+        case POKER_FLUSH:
+            return "flush";
+        case POKER_FULL_HOUSE:
+            return "full_house";
+        case POKER_FOUR_OF_A_KIND:
+            return "four_of_a_kind";
+        case POKER_STRAIGHT_FLUSH:
+            return "straight_flush";
+        default:
+            return "unknown";
+    }
+}
+
+int sim_poker_init(sim_poker_t* sim, int hand_size, uint64_t trials, uint64_t seed) {
+    if (!sim || hand_size < POKER_MIN_HAND || hand_size > POKER_MAX_HAND) return -1;
+
+    memset(sim, 0, sizeof(*sim));
+    sim_rng_seed(&sim->rng, seed);
+    for (int i = 0; i < POKER_DECK_SIZE; i++) {
+        sim->deck[i] = (uint8_t)i;
+    }
+    sim->hand_size = hand_size;
+    sim->trials_total = trials;
+    poker_tables_init();
+
+    return 0;
+}
+
+uint64_t sim_poker_step(sim_poker_t* sim, uint64_t max_trials) {
+    if (!sim || sim->trials_done >= sim->trials_total) return 0;
+
+    uint64_t remaining = sim->trials_total - sim->trials_done;
+    uint64_t todo = max_trials < remaining ? max_trials : remaining;
+    uint8_t* deck = sim->deck;
+
+    for (uint64_t t = 0; t < todo; t++) {
+        // Partial Fisher–Yates: only the dealt prefix is shuffled
+        for (int i = 0; i < sim->hand_size; i++) {
+            int j = i + (int)sim_rng_bounded(&sim->rng, (uint32_t)(POKER_DECK_SIZE - i));
+            uint8_t card = deck[i];
+            deck[i] = deck[j];
+            deck[j] = card;
+        }
+        sim->category_counts[poker_evaluate(deck, sim->hand_size)]++;
+    }
+
+    sim->trials_done += todo;
+    return todo;
+}
@@ -0,0 +1,126 @@
+#ifndef MONTE_CARLO_H
+#define MONTE_CARLO_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bernoulli probabilities are quantized to multiples of 2^-SIM_BERNOULLI_BITS
+#define SIM_BERNOULLI_BITS 32
+
+#define POKER_DECK_SIZE 52
+#define POKER_RANK_COUNT 13
+#define POKER_SUIT_COUNT 4
+#define POKER_MIN_HAND 5
+#define POKER_MAX_HAND 7
+
+/**
+ * @brief xoshiro256** generator state
+ * Never all zero; sim_rng_seed expands any 64-bit seed with splitmix64.
+ */
+typedef struct {
+    uint64_t s[4];
+} sim_rng_t;
+
+void sim_rng_seed(sim_rng_t* rng, uint64_t seed);
+uint64_t sim_rng_next(sim_rng_t* rng);
+
+// Uniform double in [0, 1) with 53 random bits
+double sim_rng_uniform(sim_rng_t* rng);
+
+// Unbiased integer in [0, bound) (Lemire's multiply-shift with rejection), 0 for bound 0
+uint32_t sim_rng_bounded(sim_rng_t* rng, uint32_t bound);
+
+// Batched draws: count uniforms into out
+void sim_rng_fill_uniform(sim_rng_t* rng, double* out, size_t count);
+
+/**
+ * @brief 64 independent Bernoulli draws at once, one per bit
+ * Bit-sliced comparison of random words against the binary expansion of p:
+ * p = 1/2 costs one generator call per 64 flips, and no p needs more than
+ * SIM_BERNOULLI_BITS calls.
+ * @param p_fixed p * 2^SIM_BERNOULLI_BITS, from sim_bernoulli_fixed
+ */
+uint64_t sim_bernoulli_word(sim_rng_t* rng, uint64_t p_fixed);
+uint64_t sim_bernoulli_fixed(double p);
+
+/**
+ * @brief Chunked coin-flip run
+ * Heads are 1 bits. Runs carry across words and chunks, so the streaks are
+ * those of one continuous sequence of trials_total flips.
+ */
+typedef struct {
+    sim_rng_t rng;
+    uint64_t p_fixed;
+    uint64_t trials_total;
+    uint64_t trials_done;
+    uint64_t heads;
+    uint64_t longest_heads_run;
+    uint64_t longest_tails_run;
+    uint64_t run_length;  // length of the run still open at trials_done
+    int run_face;         // 1 heads, 0 tails
+} sim_coin_t;
+
+/**
+ * @brief Set up a run of trials flips with heads probability p
+ * @return 0 on success, -1 for p outside [0, 1]
+ */
+int sim_coin_init(sim_coin_t* sim, double p, uint64_t trials, uint64_t seed);
+
+// Flip up to max_trials more coins; returns how many were flipped (0 once finished)
+uint64_t sim_coin_step(sim_coin_t* sim, uint64_t max_trials);
+
+/**
+ * @brief Poker hand categories, weakest first
+ * Royal flushes count as straight flushes.
+ */
+typedef enum {
+    POKER_HIGH_CARD = 0,
+    POKER_PAIR,
+    POKER_TWO_PAIR,
+    POKER_THREE_OF_A_KIND,
+    POKER_STRAIGHT,
+    POKER_FLUSH,
+    POKER_FULL_HOUSE,
+    POKER_FOUR_OF_A_KIND,
+    POKER_STRAIGHT_FLUSH,
+    POKER_CATEGORY_COUNT
+} poker_category_t;
+
+/**
+ * @brief Best category among count cards (5 to 7)
+ * Cards are rank * POKER_SUIT_COUNT + suit, rank 0 = deuce .. 12 = ace.
+ * Straights and rank multiplicities come from lookup tables over 13-bit rank
+ * masks, built once on first use.
+ */
+poker_category_t poker_evaluate(const uint8_t* cards, int count);
+const char* poker_category_name(poker_category_t category);
+
+/**
+ * @brief Chunked poker deal
+ * Each trial is a partial Fisher–Yates shuffle of hand_size cards from the
+ * deck, whose order persists between deals.
+ */
+typedef struct {
+    sim_rng_t rng;
+    uint8_t deck[POKER_DECK_SIZE];
+    int hand_size;
+    uint64_t trials_total;
+    uint64_t trials_done;
+    uint64_t category_counts[POKER_CATEGORY_COUNT];
+} sim_poker_t;
+
+/**
+ * @return 0 on success, -1 for a hand size outside POKER_MIN_HAND..POKER_MAX_HAND
+ */
+int sim_poker_init(sim_poker_t* sim, int hand_size, uint64_t trials, uint64_t seed);
+uint64_t sim_poker_step(sim_poker_t* sim, uint64_t max_trials);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MONTE_CARLO_H
@@ -0,0 +1,312 @@
+#include "resampling.h"
+#include "../../core/math/vector_math.h"
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+// Arrays after the header start on an 8-byte boundary
+#define RESAMPLE_HEADER_SIZE ((sizeof(resample_state_t) + 7) & ~(size_t)7)
+
+static double* resample_values(resample_state_t* state) {
+    return (double*)(void*)((uint8_t*)state + RESAMPLE_HEADER_SIZE);
+}
+
+// Permutation index order, after the values
+static uint32_t* resample_order(resample_state_t* state) {
+    return (uint32_t*)(void*)(resample_values(state) + state->n1 + state->n2);
+}
+
+// Bootstrap statistics, after the values
+static double* resample_statistics(resample_state_t* state) {
+    return resample_values(state) + state->n1 + state->n2;
+}
+
+size_t resample_state_size(resample_kind_t kind, size_t n1, size_t n2, uint64_t max_resamples) {
+    if (n1 > UINT32_MAX || n2 > UINT32_MAX - n1 || max_resamples == 0) return 0;
+
+    size_t total = n1 + n2;
+    size_t size = RESAMPLE_HEADER_SIZE;
+
+    if (total > (SIZE_MAX - size) / sizeof(double)) return 0;
+    size += total * sizeof(double);
+
+    if (kind == RESAMPLE_PERMUTATION) {
+        if (total > (SIZE_MAX - size) / sizeof(uint32_t)) return 0;
+        size += total * sizeof(uint32_t);
+    } else if (kind == RESAMPLE_BOOTSTRAP) {
+        if (max_resamples > (SIZE_MAX - size) / sizeof(double)) return 0;
+        size += (size_t)max_resamples * sizeof(double);
+    } else {
+        return 0;
+    }
+
+    return size;
+}
+
+int resample_state_valid(const resample_state_t* state, size_t size) {
+    if (!state || size < RESAMPLE_HEADER_SIZE) return 0;
+    if (state->kind != RESAMPLE_BOOTSTRAP && state->kind != RESAMPLE_PERMUTATION) return 0;
+    if (state->kind == RESAMPLE_PERMUTATION && (state->n1 < 2 || state->n2 < 2)) return 0;
+    if (state->n1 < 2 || state->resamples_done > state->max_resamples) return 0;
+
+    return resample_state_size(state->kind, state->n1, state->n2, state->max_resamples) == size;
+}
+
+/**
+ * @brief Mean of a sample, 0 for an empty one
+ */
+static double resample_mean(const double* values, size_t count) {
+    return count ? vector_sum(values, count) / (double)count : 0.0;
+}
+
+int resample_init(resample_state_t* state, size_t size, resample_kind_t kind,
+                  const double* sample1, size_t n1, const double* sample2, size_t n2,
+                  uint64_t max_resamples, double alpha, uint64_t seed) {
+    if (!state || !sample1 || n1 < 2 || (n2 > 0 && !sample2)) return -1;
+    if (kind == RESAMPLE_PERMUTATION && (n2 < 2 || !(alpha > 0.0 && alpha < 1.0))) return -1;
+    if (size == 0 || size != resample_state_size(kind, n1, n2, max_resamples)) return -1;
+    if (!vector_all_finite(sample1, n1) || !vector_all_finite(sample2, n2)) return -1;
+
+    memset(state, 0, RESAMPLE_HEADER_SIZE);
+    state->kind = kind;
+    sim_rng_seed(&state->rng, seed);
+    state->n1 = (uint32_t)n1;
+    state->n2 = (uint32_t)n2;
+    state->max_resamples = max_resamples;
+    state->mean1 = resample_mean(sample1, n1);
+    state->mean2 = resample_mean(sample2, n2);
+    state->observed = n2 ? state->mean1 - state->mean2 : state->mean1;
+    state->alpha = alpha;
+
+    // Centered copies: resample sums stay small, so differences of them do not cancel
+    double* values = resample_values(state);
+    double center1 = state->mean1;
+    double center2 = state->mean2;
+    if (kind == RESAMPLE_PERMUTATION) {
+        // Permuted groups mix both samples, so both share the pooled center
+        center1 = center2 = (state->mean1 * (double)n1 + state->mean2 * (double)n2) / (double)(n1 + n2);
+    }
+    for (size_t i = 0; i < n1; i++) {
+        values[i] = sample1[i] - center1;
+    }
+    for (size_t i = 0; i < n2; i++) {
+        values[n1 + i] = sample2[i] - center2;
+    }
+
+    if (kind == RESAMPLE_PERMUTATION) {
+        uint32_t* order = resample_order(state);
+        for (size_t i = 0; i < n1 + n2; i++) {
+            order[i] = (uint32_t)i;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Sum of count values drawn with replacement from values
+ */
+static double resample_draw_sum(sim_rng_t* rng, const double* values, uint32_t count) {
+    double sums[2] = {0.0, 0.0};
+
+    for (uint32_t i = 0; i < count; i++) {
+        sums[i & 1] += values[sim_rng_bounded(rng, count)];
+    }
+    return sums[0] + sums[1];
+}
+
+/**
+ * @brief One bootstrap resample: mean, or difference of means, of index draws
+ */
+static void resample_bootstrap_once(resample_state_t* state) {
+    const double* values = resample_values(state);
+    double shift = resample_draw_sum(&state->rng, values, state->n1) / state->n1;
+
+    if (state->n2) {
+        shift -= resample_draw_sum(&state->rng, values + state->n1, state->n2) / state->n2;
+    }
+    resample_statistics(state)[state->resamples_done] = state->observed + shift;
+}
+
+/**
+ * @brief One permutation: partial Fisher–Yates of the smaller group's size
+ * The shuffled prefix is the smaller group and the rest the other, so a
+ * permutation costs min(n1, n2) swaps. The pooled centered values sum to
+ * (almost) zero, so the other group's sum is minus the prefix sum.
+ */
+static void resample_permutation_once(resample_state_t* state) {
+    const double* values = resample_values(state);
+    uint32_t* order = resample_order(state);
+    uint32_t total = state->n1 + state->n2;
+    uint32_t k = state->n1 <= state->n2 ? state->n1 : state->n2;
+    double prefix = 0.0;
+
+    for (uint32_t i = 0; i < k; i++) {
+        uint32_t j = i + sim_rng_bounded(&state->rng, total - i);
+        uint32_t index = order[j];
+        order[j] = order[i];
+        order[i] = index;
+        prefix += values[index];
+    }
+
+    double rest = -prefix;
+    double sum1 = state->n1 <= state->n2 ? prefix : rest;
+    double sum2 = state->n1 <= state->n2 ? rest : prefix;
+    double diff = sum1 / state->n1 - sum2 / state->n2;
+
+    // Relative slack so ties with the observed split are not lost to rounding
+    if (fabs(diff) >= fabs(state->observed) * (1.0 - 1e-12)) {
+        state->extreme_count++;
+    }
+}
+
+/**
+ * @brief Wilson score interval for count successes out of trials
+ */
+static void resample_wilson(uint64_t count, uint64_t trials, double z, double* lower, double* upper) {
+    double m = (double)trials;
+    double p = (double)count / m;
+    double z2 = z * z;
+    double denominator = 1.0 + z2 / m;
+    double center = (p + z2 / (2.0 * m)) / denominator;
+    double half = z / denominator * sqrt(p * (1.0 - p) / m + z2 / (4.0 * m * m));
+
+    *lower = fmax(0.0, center - half);
+    *upper = fmin(1.0, center + half);
+}
+
+static int resample_decided(const resample_state_t* state) {
+    double lower, upper;
+
+    if (state->resamples_done < RESAMPLE_MIN_DECISION) return 0;
+    resample_wilson(state->extreme_count, state->resamples_done, RESAMPLE_DECISION_Z, &lower, &upper);
+    return upper < state->alpha || lower > state->alpha;
+}
+
+static double resample_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+int resample_finished(const resample_state_t* state) {
+    return !state || state->decided || state->resamples_done >= state->max_resamples;
+}
+
+uint64_t resample_step(resample_state_t* state, uint64_t max_resamples, double budget_ms) {
+    if (resample_finished(state)) return 0;
+
+    uint64_t remaining = state->max_resamples - state->resamples_done;
+    uint64_t todo = max_resamples < remaining ? max_resamples : remaining;
+    uint64_t draws_per_resample = state->kind == RESAMPLE_PERMUTATION
+        ? (state->n1 <= state->n2 ? state->n1 : state->n2)
+        : (uint64_t)state->n1 + state->n2;
+    double deadline = budget_ms > 0.0 ? resample_now_ms() + budget_ms : 0.0;
+    uint64_t work = 0;
+    uint64_t done = 0;
+
+    while (done < todo) {
+        if (state->kind == RESAMPLE_PERMUTATION) {
+            resample_permutation_once(state);
+        } else {
+            resample_bootstrap_once(state);
+        }
+        state->resamples_done++;
+        done++;
+
+        if (state->kind == RESAMPLE_PERMUTATION && state->resamples_done % RESAMPLE_DECISION_STRIDE == 0 &&
+            resample_decided(state)) {
+            state->decided = 1;
+            break;
+        }
+
+        work += draws_per_resample;
+        if (deadline > 0.0 && work >= RESAMPLE_CLOCK_WORK) {
+            work = 0;
+            if (resample_now_ms() >= deadline) break;
+        }
+    }
+
+    return done;
+}
+
+int resample_p_value(const resample_state_t* state, double* p_value, double* lower, double* upper) {
+    if (!state || state->kind != RESAMPLE_PERMUTATION || state->resamples_done == 0) return -1;
+
+    double lo, hi;
+    resample_wilson(state->extreme_count, state->resamples_done, RESAMPLE_DECISION_Z, &lo, &hi);
+
+    if (p_value) *p_value = (double)(state->extreme_count + 1) / (double)(state->resamples_done + 1);
+    if (lower) *lower = lo;
+    if (upper) *upper = hi;
+    return 0;
+}
+
+/**
+ * @brief k-th smallest of values[0..count) (Hoare quickselect, reorders values)
+ */
+static double resample_select(double* values, size_t count, size_t k) {
+    size_t left = 0;
+    size_t right = count - 1;
+
+    while (left < right) {
+        double pivot = values[left + (right - left) / 2];
+        size_t i = left;
+        size_t j = right;
+
+        while (i <= j) {
+            while (values[i] < pivot) i++;
+            while (values[j] > pivot) j--;
+            if (i <= j) {
+                double t = values[i];
+                values[i] = values[j];
+                values[j] = t;
+                i++;
+                if (j == 0) break;
+                j--;
+            }
+        }
+
+        if (k <= j) right = j;
+        else if (k >= i) left = i;
+        else break;
+    }
+
+    return values[k];
+}
+
+/**
+ * @brief Type 7 (linear) sample quantile; values is reordered
+ */
+static double resample_quantile(double* values, size_t count, double q) {
+    double h = (count - 1) * q;
+    size_t lo = (size_t)floor(h);
+    double value = resample_select(values, count, lo);
+
+    if (lo + 1 >= count || h == (double)lo) return value;
+
+    // After selecting lo everything above it is >= values[lo]; the next order statistic is their minimum
+    double next = values[lo + 1];
+    for (size_t i = lo + 2; i < count; i++) {
+        if (values[i] < next) next = values[i];
+    }
+    return value + (h - (double)lo) * (next - value);
+}
+
+int resample_bootstrap_interval(resample_state_t* state, double level, double* lower, double* upper,
+                                double* standard_error) {
+    if (!state || state->kind != RESAMPLE_BOOTSTRAP || state->resamples_done < 2) return -1;
+    if (!(level > 0.0 && level < 1.0)) return -1;
+
+    double* statistics = resample_statistics(state);
+    size_t count = (size_t)state->resamples_done;
+    double tail = (1.0 - level) / 2.0;
+
+    if (standard_error) {
+        double mean = vector_sum(statistics, count) / (double)count;
+        *standard_error = sqrt(vector_sum_squares(statistics, count, mean) / (double)(count - 1));
+    }
+    if (lower) *lower = resample_quantile(statistics, count, tail);
+    if (upper) *upper = resample_quantile(statistics, count, 1.0 - tail);
+    return 0;
+}
@@ -0,0 +1,101 @@
+#ifndef RESAMPLING_H
+#define RESAMPLING_H
+
+#include "monte_carlo.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Permutation runs may stop early only after this many resamples
+#define RESAMPLE_MIN_DECISION 200
+
+// Wilson interval on the permutation p-value used for early stopping (99%)
+#define RESAMPLE_DECISION_Z 2.5758293035489004
+
+// Resamples between early-stopping checks
+#define RESAMPLE_DECISION_STRIDE 32
+
+// Index draws between clock reads when running against a time budget
+#define RESAMPLE_CLOCK_WORK 4096
+
+typedef enum {
+    RESAMPLE_BOOTSTRAP = 0,    // mean (one sample) or mean1 - mean2 (two independent samples)
+    RESAMPLE_PERMUTATION = 1   // two-sided permutation test of mean1 - mean2
+} resample_kind_t;
+
+/**
+ * @brief Resampling run, followed in the same allocation by its arrays
+ * The samples are copied once at init, centered on their means, and then only
+ * indices are drawn: a bootstrap resample sums values at random indices and a
+ * permutation shuffles an index array over the pooled data, so no resample
+ * copies data. Everything lives in one resample_state_size() block so a JS
+ * ArrayBuffer can own it; the header holds no pointers.
+ */
+typedef struct {
+    resample_kind_t kind;
+    sim_rng_t rng;
+    uint32_t n1;
+    uint32_t n2;                // 0 for a one-sample bootstrap
+    uint64_t max_resamples;
+    uint64_t resamples_done;
+    double mean1;
+    double mean2;
+    double observed;            // mean1, or mean1 - mean2
+    double alpha;               // permutation decision level
+    uint64_t extreme_count;     // permutations with |diff| >= |observed|
+    int decided;                // permutation stopped early: p-value interval clear of alpha
+} resample_state_t;
+
+/**
+ * @brief Bytes needed for a run, or 0 for invalid sizes
+ * Bootstrap runs need max_resamples statistic slots for the percentile interval.
+ */
+size_t resample_state_size(resample_kind_t kind, size_t n1, size_t n2, uint64_t max_resamples);
+
+/**
+ * @brief Set up a run in a block of size bytes from resample_state_size
+ * Both permutation samples, and a bootstrap's first sample, need at least 2
+ * values, all finite.
+ * @return 0 on success, -1 for invalid arguments
+ */
+int resample_init(resample_state_t* state, size_t size, resample_kind_t kind,
+                  const double* sample1, size_t n1, const double* sample2, size_t n2,
+                  uint64_t max_resamples, double alpha, uint64_t seed);
+
+// 1 if the header is consistent with a block of size bytes (for state handed back by JS)
+int resample_state_valid(const resample_state_t* state, size_t size);
+
+/**
+ * @brief Run up to max_resamples more, stopping early once budget_ms of wall
+ * time has passed (budget_ms <= 0: no limit)
+ * @return resamples run by this call
+ */
+uint64_t resample_step(resample_state_t* state, uint64_t max_resamples, double budget_ms);
+
+// 1 once every resample has run or a permutation has been decided early
+int resample_finished(const resample_state_t* state);
+
+/**
+ * @brief Permutation p-value (count + 1) / (resamples + 1) and the Wilson
+ * interval on the underlying exceedance rate
+ * @return 0 on success, -1 for bootstrap runs or before any resample
+ */
+int resample_p_value(const resample_state_t* state, double* p_value, double* lower, double* upper);
+
+/**
+ * @brief Bootstrap percentile interval at the given level (e.g. 0.95) and the
+ * bootstrap standard error
+ * Reorders the stored statistics, which is harmless while the run continues.
+ * @return 0 on success, -1 for permutation runs or fewer than 2 resamples
+ */
+int resample_bootstrap_interval(resample_state_t* state, double level, double* lower, double* upper,
+                                double* standard_error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RESAMPLING_H
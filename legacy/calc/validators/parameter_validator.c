@@ -1,5 +1,6 @@
 #include "parameter_validator.h"
 #include "../../models/distributions/distribution_registry.h"
+#include "../../core/math/math_utils.h"
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
@@ -18,13 +19,6 @@ void clear_validation_result(validation_result_t* result) {
     result->has_suggestion = 0;
 }
 
-/**
- * @brief Check if a number is finite (not NaN or infinite)
- */
-int is_finite_number(double value) {
-    return isfinite(value);
-}
-
 /**
  * @brief Check if a number is positive
  */
@@ -46,20 +40,19 @@ validation_result_t validate_parameter_count(distribution_type_t distribution, u
     validation_result_t result;
     clear_validation_result(&result);
     
-    if (!registry_is_valid_distribution_type(distribution)) {
+    const distribution_model_t* model = registry_get_distribution_model(distribution);
+    if (!model) {
         result.error_code = VALIDATION_ERROR_UNKNOWN_DISTRIBUTION;
         snprintf(result.error_message, MAX_ERROR_MESSAGE_LENGTH,
                 "Unknown distribution type: %d", distribution);
         return result;
     }
     
-    uint8_t expected_count = registry_get_parameter_count(distribution);
-    if (provided_count != expected_count) {
+    if (provided_count != model->param_count) {
         result.error_code = VALIDATION_ERROR_INVALID_COUNT;
-        const char* dist_name = registry_get_distribution_name(distribution);
         snprintf(result.error_message, MAX_ERROR_MESSAGE_LENGTH,
                 "%s distribution requires %d parameters, but %d provided",
-                dist_name, expected_count, provided_count);
+                model->name, model->param_count, provided_count);
     }
     
     return result;
@@ -177,6 +170,19 @@ validation_result_t validate_mathematical_constraints(distribution_type_t distri
             }
             break;
             
+        case DIST_UNIFORM:
+            // Uniform bounds must be ordered
+            if (param_count >= 2 && parameters[0] >= parameters[1]) {
+                result.error_code = VALIDATION_ERROR_MATHEMATICAL_CONSTRAINT;
+                generate_constraint_error_message(distribution,
+                    "Lower bound must be less than upper bound",
+                    result.error_message, MAX_ERROR_MESSAGE_LENGTH);
+                result.invalid_parameter_index = 1;
+                result.suggested_value = parameters[0] + 1.0;
+                result.has_suggestion = 1;
+            }
+            break;
+            
         default:
             // No additional constraints for other distributions
             break;
@@ -194,19 +200,19 @@ validation_result_t validate_single_parameter(distribution_type_t distribution,
     validation_result_t result;
     clear_validation_result(&result);
     
-    if (!registry_is_valid_distribution_type(distribution)) {
+    const distribution_model_t* model = registry_get_distribution_model(distribution);
+    if (!model) {
         result.error_code = VALIDATION_ERROR_UNKNOWN_DISTRIBUTION;
         snprintf(result.error_message, MAX_ERROR_MESSAGE_LENGTH,
                 "Unknown distribution type: %d", distribution);
         return result;
     }
     
-    uint8_t param_count = registry_get_parameter_count(distribution);
-    if (param_index >= param_count) {
+    if (param_index >= model->param_count) {
         result.error_code = VALIDATION_ERROR_INVALID_COUNT;
         snprintf(result.error_message, MAX_ERROR_MESSAGE_LENGTH,
                 "Parameter index %d is invalid for distribution with %d parameters",
-                param_index, param_count);
+                param_index, model->param_count);
         return result;
     }
     
@@ -259,20 +265,18 @@ void generate_range_error_message(distribution_type_t distribution,
                                 size_t message_size) {
     if (!message) return;
     
-    const char* dist_name = registry_get_distribution_name(distribution);
-    const char** param_names = registry_get_parameter_names(distribution);
-    const double* range = registry_get_parameter_ranges(distribution, param_index);
+    const distribution_model_t* model = registry_get_distribution_model(distribution);
     
-    if (!dist_name || !param_names || !range) {
+    if (!model || !model->param_names || param_index >= model->param_count) {
         snprintf(message, message_size, "Parameter validation error");
         return;
     }
     
-    const char* param_name = param_names[param_index];
+    const double* range = model->param_ranges[param_index];
     
     snprintf(message, message_size,
             "%s parameter '%s' (%.3f) must be between %.3f and %.3f",
-            dist_name, param_name, value, range[0], range[1]);
+            model->name, model->param_names[param_index], value, range[0], range[1]);
 }
 
 /**
@@ -103,7 +103,6 @@ int has_parameter_suggestion(distribution_type_t distribution,
  */
 const char* get_validation_error_description(validation_error_t error_code);
 void clear_validation_result(validation_result_t* result);
-int is_finite_number(double value);
 int is_positive_number(double value);
 int is_probability_value(double value);
 
@@ -0,0 +1,637 @@
+#include "statistical_constants.h"
+#include "../math/math_utils.h"
+#include "../math/special_functions.h"
+#include "../math/vector_math.h"
+#include "../distributions/lib/normal_distribution.h"
+#include "../distributions/lib/exponential_distribution.h"
+#include "../distributions/lib/chi_square_distribution.h"
+#include "../distributions/lib/t_distribution.h"
+#include "../distributions/lib/f_distribution.h"
+#include "../distributions/lib/gamma_distribution.h"
+#include "../distributions/lib/beta_distribution.h"
+#include "../distributions/lib/weibull_distribution.h"
+#include "../distributions/lib/rayleigh_distribution.h"
+#include "../distributions/lib/pareto_distribution.h"
+#include "../distributions/lib/uniform_distribution.h"
+#include "../distributions/lib/geometric_distribution.h"
+#include "../distributions/lib/hypergeometric_distribution.h"
+#include "../distributions/lib/binomial_distribution.h"
+#include "../distributions/lib/negative_binomial_distribution.h"
+#include "../distributions/lib/poisson_distribution.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Host benchmark driver
+// Usage: benchmark_runner [points] [iterations] [name-filter]
+// Prints ns/call (avg, min, max over sweeps) and mean/max error against a
+// long double reference for every distribution, math_utils and
+// special_functions kernel, followed by the statistical_constants suite.
+// Exits 1 when any kernel is above its error threshold. Built, with
+// statistical_benchmarks.c, by the benchmark_runner target of the top-level
+// CMakeLists.txt.
+
+#define DEFAULT_ITERATIONS 20
+
+/**
+ * A distribution under test with its long double reference PDF and CDF
+ */
+typedef struct {
+    const distribution_t* (*get)(void);
+    double params[MAX_PARAMETERS];
+    int param_count;
+    long double (*pdf_reference)(long double x, const double* p);
+    long double (*cdf_reference)(long double x, const double* p);
+} distribution_case_t;
+
+/**
+ * A named grid benchmark
+ */
+typedef struct {
+    const char* name;
+    benchmark_kernel_t kernel;
+    benchmark_reference_t reference;
+    const void* context;
+    double min_value;
+    double max_value;
+    int integer_grid;  // evaluate on every integer in [min, max] instead of the configured grid
+    double error_threshold;
+} benchmark_case_t;
+
+/**
+ * A named batch benchmark (one call per sweep over the whole grid)
+ */
+typedef struct {
+    const char* name;
+    benchmark_batch_kernel_t kernel;
+    benchmark_reference_t reference;
+    const void* context;
+    double min_value;
+    double max_value;
+    double error_threshold;
+} benchmark_batch_case_t;
+
+/**
+ * Long double reference densities and distribution functions
+ */
+static long double normal_pdf_reference(long double x, const double* p) {
+    long double z = (x - p[0]) / p[1];
+    return expl(-0.5L * z * z) / (p[1] * sqrtl(2.0L * STAT_PI));
+}
+
+static long double normal_cdf_reference(long double x, const double* p) {
+    return 0.5L * erfcl(-(x - p[0]) / (p[1] * sqrtl(2.0L)));
+}
+
+static long double exponential_pdf_reference(long double x, const double* p) {
+    return (x < 0.0L) ? 0.0L : p[0] * expl(-p[0] * x);
+}
+
+static long double exponential_cdf_reference(long double x, const double* p) {
+    return (x < 0.0L) ? 0.0L : -expm1l(-p[0] * x);
+}
+
+static long double chi_square_pdf_reference(long double x, const double* p) {
+    long double half_k = p[0] / 2.0L;
+    if (x <= 0.0L) return 0.0L;
+    return expl((half_k - 1.0L) * logl(x) - x / 2.0L - half_k * logl(2.0L) - lgammal(half_k));
+}
+
+static long double chi_square_cdf_reference(long double x, const double* p) {
+    return benchmark_reference_gamma_p(p[0] / 2.0L, x / 2.0L);
+}
+
+static long double t_pdf_reference(long double x, const double* p) {
+    long double nu = p[0];
+    return expl(lgammal((nu + 1.0L) / 2.0L) - lgammal(nu / 2.0L) - 0.5L * logl(nu * STAT_PI) -
+                (nu + 1.0L) / 2.0L * log1pl(x * x / nu));
+}
+
+static long double t_cdf_reference(long double x, const double* p) {
+    long double nu = p[0];
+    long double tail = 0.5L * benchmark_reference_beta_i(nu / 2.0L, 0.5L, nu / (nu + x * x));
+    return (x < 0.0L) ? tail : 1.0L - tail;
+}
+
+static long double f_pdf_reference(long double x, const double* p) {
+    long double d1 = p[0];
+    long double d2 = p[1];
+    if (x <= 0.0L) return 0.0L;
+    return expl(lgammal((d1 + d2) / 2.0L) - lgammal(d1 / 2.0L) - lgammal(d2 / 2.0L) +
+                d1 / 2.0L * logl(d1 / d2) + (d1 / 2.0L - 1.0L) * logl(x) -
+                (d1 + d2) / 2.0L * log1pl(d1 * x / d2));
+}
+
+static long double f_cdf_reference(long double x, const double* p) {
+    if (x <= 0.0L) return 0.0L;
+    return benchmark_reference_beta_i(p[0] / 2.0L, p[1] / 2.0L, p[0] * x / (p[0] * x + p[1]));
+}
+
+static long double gamma_pdf_reference(long double x, const double* p) {
+    if (x <= 0.0L) return 0.0L;
+    return expl((p[0] - 1.0L) * logl(x) - x / p[1] - lgammal(p[0]) - p[0] * logl(p[1]));
+}
+
+static long double gamma_cdf_reference(long double x, const double* p) {
+    return benchmark_reference_gamma_p(p[0], x / p[1]);
+}
+
+static long double beta_pdf_reference(long double x, const double* p) {
+    if (x <= 0.0L || x >= 1.0L) return 0.0L;
+    return expl((p[0] - 1.0L) * logl(x) + (p[1] - 1.0L) * log1pl(-x) -
+                lgammal(p[0]) - lgammal(p[1]) + lgammal((long double)p[0] + p[1]));
+}
+
+static long double beta_cdf_reference(long double x, const double* p) {
+    return benchmark_reference_beta_i(p[0], p[1], x);
+}
+
+static long double weibull_pdf_reference(long double x, const double* p) {
+    if (x < 0.0L) return 0.0L;
+    long double u = x / p[1];
+    return (p[0] / p[1]) * powl(u, p[0] - 1.0L) * expl(-powl(u, p[0]));
+}
+
+static long double weibull_cdf_reference(long double x, const double* p) {
+    return (x < 0.0L) ? 0.0L : -expm1l(-powl(x / p[1], p[0]));
+}
+
+static long double rayleigh_pdf_reference(long double x, const double* p) {
+    long double s2 = (long double)p[0] * p[0];
+    return (x < 0.0L) ? 0.0L : x / s2 * expl(-x * x / (2.0L * s2));
+}
+
+static long double rayleigh_cdf_reference(long double x, const double* p) {
+    long double s2 = (long double)p[0] * p[0];
+    return (x < 0.0L) ? 0.0L : -expm1l(-x * x / (2.0L * s2));
+}
+
+static long double pareto_pdf_reference(long double x, const double* p) {
+    if (x < p[0]) return 0.0L;
+    return p[1] * powl(p[0], p[1]) / powl(x, p[1] + 1.0L);
+}
+
+static long double pareto_cdf_reference(long double x, const double* p) {
+    return (x < p[0]) ? 0.0L : 1.0L - powl(p[0] / x, p[1]);
+}
+
+static long double uniform_pdf_reference(long double x, const double* p) {
+    return (x < p[0] || x > p[1]) ? 0.0L : 1.0L / ((long double)p[1] - p[0]);
+}
+
+static long double uniform_cdf_reference(long double x, const double* p) {
+    if (x < p[0]) return 0.0L;
+    if (x > p[1]) return 1.0L;
+    return (x - p[0]) / ((long double)p[1] - p[0]);
+}
+
+static long double log_choose_reference(long double n, long double k) {
+    return lgammal(n + 1.0L) - lgammal(k + 1.0L) - lgammal(n - k + 1.0L);
+}
+
+static long double geometric_pdf_reference(long double k, const double* p) {
+    return (k < 1.0L) ? 0.0L : p[0] * powl(1.0L - p[0], k - 1.0L);
+}
+
+static long double geometric_cdf_reference(long double k, const double* p) {
+    return (k < 1.0L) ? 0.0L : -expm1l(floorl(k) * log1pl(-p[0]));
+}
+
+static long double hypergeometric_pdf_reference(long double k, const double* p) {
+    long double N = p[0];
+    long double K = p[1];
+    long double n = p[2];
+    if (k < 0.0L || k > n || k > K || n - k > N - K) return 0.0L;
+    return expl(log_choose_reference(K, k) + log_choose_reference(N - K, n - k) - log_choose_reference(N, n));
+}
+
+static long double binomial_pdf_reference(long double k, const double* p) {
+    if (k < 0.0L || k > p[0]) return 0.0L;
+    return expl(log_choose_reference(p[0], k) + k * logl(p[1]) + (p[0] - k) * log1pl(-p[1]));
+}
+
+static long double negative_binomial_pdf_reference(long double k, const double* p) {
+    if (k < 0.0L) return 0.0L;
+    return expl(lgammal(k + p[0]) - lgammal(k + 1.0L) - lgammal(p[0]) + p[0] * logl(p[1]) + k * log1pl(-p[1]));
+}
+
+static long double poisson_pdf_reference(long double k, const double* p) {
+    if (k < 0.0L) return 0.0L;
+    return expl(k * logl(p[0]) - p[0] - lgammal(k + 1.0L));
+}
+
+/**
+ * Discrete CDF reference: long double sum of the reference PMF
+ */
+static long double discrete_cdf_reference(long double (*pdf_reference)(long double, const double*),
+                                          long double x, const double* p) {
+    long double sum = 0.0L;
+    for (long double k = 0.0L; k <= floorl(x); k += 1.0L) {
+        sum += pdf_reference(k, p);
+    }
+    return sum;
+}
+
+static long double hypergeometric_cdf_reference(long double x, const double* p) {
+    return discrete_cdf_reference(hypergeometric_pdf_reference, x, p);
+}
+
+static long double binomial_cdf_reference(long double x, const double* p) {
+    return discrete_cdf_reference(binomial_pdf_reference, x, p);
+}
+
+static long double negative_binomial_cdf_reference(long double x, const double* p) {
+    return discrete_cdf_reference(negative_binomial_pdf_reference, x, p);
+}
+
+static long double poisson_cdf_reference(long double x, const double* p) {
+    return discrete_cdf_reference(poisson_pdf_reference, x, p);
+}
+
+/**
+ * Grid kernels for distribution_case_t contexts
+ */
+static double distribution_pdf_kernel(double x, const void* context) {
+    const distribution_case_t* c = context;
+    return c->get()->pdf(x, (double*)c->params, c->param_count);
+}
+
+static double distribution_cdf_kernel(double x, const void* context) {
+    const distribution_case_t* c = context;
+    return c->get()->cdf(x, (double*)c->params, c->param_count);
+}
+
+static void distribution_pdf_batch_kernel(const double* x, double* out, size_t count, const void* context) {
+    const distribution_case_t* c = context;
+    c->get()->pdf_batch(x, out, count, (double*)c->params, c->param_count);
+}
+
+static void distribution_cdf_batch_kernel(const double* x, double* out, size_t count, const void* context) {
+    const distribution_case_t* c = context;
+    c->get()->cdf_batch(x, out, count, (double*)c->params, c->param_count);
+}
+
+// Prepared-handle sweeps; the handle is built once per sweep
+static void distribution_prepared_sweep(const double* x, double* out, size_t count, const void* context,
+                                        distribution_precision_t precision, int cdf) {
+    const distribution_case_t* c = context;
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare_with(c->get(), (double*)c->params, c->param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return;
+    }
+    
+    distribution_prepared_set_precision(&prepared, precision);
+    if (cdf) {
+        distribution_prepared_cdf_batch(&prepared, x, out, count);
+    } else {
+        distribution_prepared_pdf_batch(&prepared, x, out, count);
+    }
+}
+
+static void prepared_pdf_double_kernel(const double* x, double* out, size_t count, const void* context) {
+    distribution_prepared_sweep(x, out, count, context, DISTRIBUTION_PRECISION_DOUBLE, 0);
+}
+
+static void prepared_pdf_float_kernel(const double* x, double* out, size_t count, const void* context) {
+    distribution_prepared_sweep(x, out, count, context, DISTRIBUTION_PRECISION_FLOAT, 0);
+}
+
+static void prepared_cdf_double_kernel(const double* x, double* out, size_t count, const void* context) {
+    distribution_prepared_sweep(x, out, count, context, DISTRIBUTION_PRECISION_DOUBLE, 1);
+}
+
+static void prepared_cdf_float_kernel(const double* x, double* out, size_t count, const void* context) {
+    distribution_prepared_sweep(x, out, count, context, DISTRIBUTION_PRECISION_FLOAT, 1);
+}
+
+static long double distribution_pdf_reference(double x, const void* context) {
+    const distribution_case_t* c = context;
+    return c->pdf_reference(x, c->params);
+}
+
+static long double distribution_cdf_reference(double x, const void* context) {
+    const distribution_case_t* c = context;
+    return c->cdf_reference(x, c->params);
+}
+
+/**
+ * Grid kernels and references for math_utils and special_functions
+ */
+static double gamma_function_kernel(double x, const void* context) { (void)context; return gamma_function(x); }
+static long double gamma_function_reference(double x, const void* context) { (void)context; return tgammal(x); }
+
+static double log_gamma_kernel(double x, const void* context) { (void)context; return log_gamma_function(x); }
+static long double log_gamma_reference(double x, const void* context) { (void)context; return lgammal(x); }
+
+static double factorial_kernel(double x, const void* context) { (void)context; return factorial((int)x); }
+static long double factorial_reference(double x, const void* context) { (void)context; return expl(lgammal(x + 1.0L)); }
+
+static double log_factorial_kernel(double x, const void* context) { (void)context; return log_factorial((int)x); }
+static long double log_factorial_reference(double x, const void* context) { (void)context; return lgammal(x + 1.0L); }
+
+static double log_combination_kernel(double k, const void* context) {
+    return log_combination(*(const int*)context, (int)k);
+}
+
+static long double log_combination_reference(double k, const void* context) {
+    return log_choose_reference(*(const int*)context, k);
+}
+
+static double error_function_kernel(double x, const void* context) { (void)context; return error_function(x); }
+static long double error_function_reference(double x, const void* context) { (void)context; return erfl(x); }
+
+static double erfc_kernel(double x, const void* context) { (void)context; return complementary_error_function(x); }
+static long double erfc_reference(double x, const void* context) { (void)context; return erfcl(x); }
+
+/**
+ * vector_math batch kernels and the libm loops they replace
+ */
+static void vector_exp_kernel(const double* x, double* out, size_t count, const void* context) { (void)context; vector_exp(x, out, count); }
+static void vector_log_kernel(const double* x, double* out, size_t count, const void* context) { (void)context; vector_log(x, out, count); }
+static void vector_erf_kernel(const double* x, double* out, size_t count, const void* context) { (void)context; vector_erf(x, out, count); }
+static void vector_erfc_kernel(const double* x, double* out, size_t count, const void* context) { (void)context; vector_erfc(x, out, count); }
+
+static void libm_exp_kernel(const double* x, double* out, size_t count, const void* context) {
+    (void)context;
+    for (size_t i = 0; i < count; i++) out[i] = exp(x[i]);
+}
+
+static void libm_log_kernel(const double* x, double* out, size_t count, const void* context) {
+    (void)context;
+    for (size_t i = 0; i < count; i++) out[i] = log(x[i]);
+}
+
+static void libm_erf_kernel(const double* x, double* out, size_t count, const void* context) {
+    (void)context;
+    for (size_t i = 0; i < count; i++) out[i] = erf(x[i]);
+}
+
+static void libm_erfc_kernel(const double* x, double* out, size_t count, const void* context) {
+    (void)context;
+    for (size_t i = 0; i < count; i++) out[i] = erfc(x[i]);
+}
+
+static long double exp_reference(double x, const void* context) { (void)context; return expl(x); }
+static long double log_reference(double x, const void* context) { (void)context; return logl(x); }
+
+static double inverse_erf_kernel(double x, const void* context) { (void)context; return inverse_error_function(x); }
+
+static long double inverse_erf_reference(double x, const void* context) {
+    (void)context;
+    long double low = -7.0L;
+    long double high = 7.0L;
+    for (int i = 0; i < 200; i++) {
+        long double middle = 0.5L * (low + high);
+        if (erfl(middle) < x) low = middle; else high = middle;
+    }
+    return 0.5L * (low + high);
+}
+
+static double log_beta_kernel(double a, const void* context) {
+    return log_beta_function(a, *(const double*)context);
+}
+
+static long double log_beta_reference(double a, const void* context) {
+    long double b = *(const double*)context;
+    return lgammal(a) + lgammal(b) - lgammal(a + b);
+}
+
+static double incomplete_beta_kernel(double x, const void* context) {
+    const double* ab = context;
+    return regularized_incomplete_beta(ab[0], ab[1], x);
+}
+
+static long double incomplete_beta_reference(double x, const void* context) {
+    const double* ab = context;
+    return benchmark_reference_beta_i(ab[0], ab[1], x);
+}
+
+static double lower_gamma_kernel(double x, const void* context) {
+    return regularized_lower_gamma(*(const double*)context, x);
+}
+
+static long double lower_gamma_reference(double x, const void* context) {
+    return benchmark_reference_gamma_p(*(const double*)context, x);
+}
+
+static double upper_gamma_kernel(double x, const void* context) {
+    return regularized_upper_gamma(*(const double*)context, x);
+}
+
+static long double upper_gamma_reference(double x, const void* context) {
+    return 1.0L - benchmark_reference_gamma_p(*(const double*)context, x);
+}
+
+// Distributions under test, one parameter set each
+static const distribution_case_t normal_case = {get_normal_distribution, {1.5, 2.0}, 2, normal_pdf_reference, normal_cdf_reference};
+static const distribution_case_t exponential_case = {get_exponential_distribution, {0.7}, 1, exponential_pdf_reference, exponential_cdf_reference};
+static const distribution_case_t chi_square_case = {get_chi_square_distribution, {3.0}, 1, chi_square_pdf_reference, chi_square_cdf_reference};
+static const distribution_case_t t_case = {get_t_distribution, {5.0}, 1, t_pdf_reference, t_cdf_reference};
+static const distribution_case_t f_case = {get_f_distribution, {4.0, 9.0}, 2, f_pdf_reference, f_cdf_reference};
+static const distribution_case_t gamma_case = {get_gamma_distribution, {2.5, 1.5}, 2, gamma_pdf_reference, gamma_cdf_reference};
+static const distribution_case_t beta_case = {get_beta_distribution, {2.0, 3.0}, 2, beta_pdf_reference, beta_cdf_reference};
+static const distribution_case_t weibull_case = {get_weibull_distribution, {1.5, 2.0}, 2, weibull_pdf_reference, weibull_cdf_reference};
+static const distribution_case_t rayleigh_case = {get_rayleigh_distribution, {1.5}, 1, rayleigh_pdf_reference, rayleigh_cdf_reference};
+static const distribution_case_t pareto_case = {get_pareto_distribution, {1.0, 3.0}, 2, pareto_pdf_reference, pareto_cdf_reference};
+static const distribution_case_t uniform_case = {get_uniform_distribution, {-1.0, 3.0}, 2, uniform_pdf_reference, uniform_cdf_reference};
+static const distribution_case_t geometric_case = {get_geometric_distribution, {0.3}, 1, geometric_pdf_reference, geometric_cdf_reference};
+static const distribution_case_t hypergeometric_case = {get_hypergeometric_distribution, {50.0, 20.0, 10.0}, 3, hypergeometric_pdf_reference, hypergeometric_cdf_reference};
+static const distribution_case_t binomial_case = {get_binomial_distribution, {100.0, 0.4}, 2, binomial_pdf_reference, binomial_cdf_reference};
+static const distribution_case_t negative_binomial_case = {get_negative_binomial_distribution, {4.0, 0.35}, 2, negative_binomial_pdf_reference, negative_binomial_cdf_reference};
+static const distribution_case_t poisson_case = {get_poisson_distribution, {45.0}, 1, poisson_pdf_reference, poisson_cdf_reference};
+
+// Fixed second arguments for two-argument kernels
+static const int log_combination_n = 100;
+static const double log_beta_b = 2.5;
+static const double incomplete_beta_ab[2] = {2.5, 4.0};
+static const double incomplete_gamma_a = 3.5;
+
+#define PDF_CASE(name, c, lo, hi, integer) \
+    {name " pdf", distribution_pdf_kernel, distribution_pdf_reference, &c, lo, hi, integer, STAT_BENCHMARK_ERROR_THRESHOLD}
+#define CDF_CASE(name, c, lo, hi, integer) \
+    {name " cdf", distribution_cdf_kernel, distribution_cdf_reference, &c, lo, hi, integer, STAT_BENCHMARK_ERROR_THRESHOLD}
+
+static const benchmark_case_t benchmark_cases[] = {
+    PDF_CASE("normal", normal_case, -8.0, 10.0, 0),
+    CDF_CASE("normal", normal_case, -8.0, 10.0, 0),
+    PDF_CASE("exponential", exponential_case, 0.0, 12.0, 0),
+    CDF_CASE("exponential", exponential_case, 0.0, 12.0, 0),
+    PDF_CASE("chi_square", chi_square_case, 0.01, 20.0, 0),
+    CDF_CASE("chi_square", chi_square_case, 0.01, 20.0, 0),
+    PDF_CASE("t", t_case, -6.0, 6.0, 0),
+    CDF_CASE("t", t_case, -6.0, 6.0, 0),
+    PDF_CASE("f", f_case, 0.01, 8.0, 0),
+    CDF_CASE("f", f_case, 0.01, 8.0, 0),
+    PDF_CASE("gamma", gamma_case, 0.01, 15.0, 0),
+    CDF_CASE("gamma", gamma_case, 0.01, 15.0, 0),
+    PDF_CASE("beta", beta_case, 0.001, 0.999, 0),
+    CDF_CASE("beta", beta_case, 0.001, 0.999, 0),
+    PDF_CASE("weibull", weibull_case, 0.0, 8.0, 0),
+    CDF_CASE("weibull", weibull_case, 0.0, 8.0, 0),
+    PDF_CASE("rayleigh", rayleigh_case, 0.0, 8.0, 0),
+    CDF_CASE("rayleigh", rayleigh_case, 0.0, 8.0, 0),
+    PDF_CASE("pareto", pareto_case, 1.0, 20.0, 0),
+    CDF_CASE("pareto", pareto_case, 1.0, 20.0, 0),
+    PDF_CASE("uniform", uniform_case, -2.0, 4.0, 0),
+    CDF_CASE("uniform", uniform_case, -2.0, 4.0, 0),
+    PDF_CASE("geometric", geometric_case, 0.0, 40.0, 1),
+    CDF_CASE("geometric", geometric_case, 0.0, 40.0, 1),
+    PDF_CASE("hypergeometric", hypergeometric_case, 0.0, 10.0, 1),
+    CDF_CASE("hypergeometric", hypergeometric_case, 0.0, 10.0, 1),
+    PDF_CASE("binomial", binomial_case, 0.0, 100.0, 1),
+    CDF_CASE("binomial", binomial_case, 0.0, 100.0, 1),
+    PDF_CASE("negative_binomial", negative_binomial_case, 0.0, 40.0, 1),
+    CDF_CASE("negative_binomial", negative_binomial_case, 0.0, 40.0, 1),
+    PDF_CASE("poisson", poisson_case, 0.0, 90.0, 1),
+    CDF_CASE("poisson", poisson_case, 0.0, 90.0, 1),
+    
+    {"gamma_function", gamma_function_kernel, gamma_function_reference, NULL, 0.1, 20.0, 0, 1e-12},
+    {"log_gamma_function", log_gamma_kernel, log_gamma_reference, NULL, 0.1, 100.0, 0, 1e-12},
+    {"factorial", factorial_kernel, factorial_reference, NULL, 0.0, 170.0, 1, 1e-12},
+    {"log_factorial", log_factorial_kernel, log_factorial_reference, NULL, 0.0, 1000.0, 1, 1e-12},
+    {"log_combination(100,k)", log_combination_kernel, log_combination_reference, &log_combination_n, 0.0, 100.0, 1, 1e-12},
+    {"error_function", error_function_kernel, error_function_reference, NULL, -5.0, 5.0, 0, STAT_BENCHMARK_ERROR_THRESHOLD},
+    {"complementary_error_function", erfc_kernel, erfc_reference, NULL, -5.0, 5.0, 0, STAT_BENCHMARK_ERROR_THRESHOLD},
+    {"inverse_error_function", inverse_erf_kernel, inverse_erf_reference, NULL, -0.999, 0.999, 0, STAT_BENCHMARK_ERROR_THRESHOLD},
+    {"log_beta_function(a,2.5)", log_beta_kernel, log_beta_reference, &log_beta_b, 0.1, 20.0, 0, 1e-12},
+    {"incomplete_beta(2.5,4,x)", incomplete_beta_kernel, incomplete_beta_reference, incomplete_beta_ab, 0.0, 1.0, 0, 1e-12},
+    {"lower_gamma(3.5,x)", lower_gamma_kernel, lower_gamma_reference, &incomplete_gamma_a, 0.0, 20.0, 0, 1e-12},
+    {"upper_gamma(3.5,x)", upper_gamma_kernel, upper_gamma_reference, &incomplete_gamma_a, 0.0, 40.0, 0, 1e-12}
+};
+
+#define BATCH_PDF_CASE(name, c, lo, hi) \
+    {name " pdf_batch", distribution_pdf_batch_kernel, distribution_pdf_reference, &c, lo, hi, STAT_BENCHMARK_ERROR_THRESHOLD}
+#define BATCH_CDF_CASE(name, c, lo, hi) \
+    {name " cdf_batch", distribution_cdf_batch_kernel, distribution_cdf_reference, &c, lo, hi, STAT_BENCHMARK_ERROR_THRESHOLD}
+
+// Double and float prepared sweeps side by side; both must meet the 1e-6 display threshold
+#define PRECISION_PDF_CASES(name, c, lo, hi) \
+    {name " pdf double", prepared_pdf_double_kernel, distribution_pdf_reference, &c, lo, hi, STAT_BENCHMARK_ERROR_THRESHOLD}, \
+    {name " pdf float", prepared_pdf_float_kernel, distribution_pdf_reference, &c, lo, hi, STAT_BENCHMARK_ERROR_THRESHOLD}
+#define PRECISION_CDF_CASES(name, c, lo, hi) \
+    {name " cdf double", prepared_cdf_double_kernel, distribution_cdf_reference, &c, lo, hi, STAT_BENCHMARK_ERROR_THRESHOLD}, \
+    {name " cdf float", prepared_cdf_float_kernel, distribution_cdf_reference, &c, lo, hi, STAT_BENCHMARK_ERROR_THRESHOLD}
+
+static const benchmark_batch_case_t benchmark_batch_cases[] = {
+    {"vector_exp", vector_exp_kernel, exp_reference, NULL, -700.0, 700.0, 1e-15},
+    {"libm exp", libm_exp_kernel, exp_reference, NULL, -700.0, 700.0, 1e-15},
+    {"vector_log", vector_log_kernel, log_reference, NULL, 1e-3, 1e3, 1e-15},
+    {"libm log", libm_log_kernel, log_reference, NULL, 1e-3, 1e3, 1e-15},
+    {"vector_erf", vector_erf_kernel, error_function_reference, NULL, -6.0, 6.0, 1e-15},
+    {"libm erf", libm_erf_kernel, error_function_reference, NULL, -6.0, 6.0, 1e-15},
+    {"vector_erfc", vector_erfc_kernel, erfc_reference, NULL, -6.0, 26.0, 1e-15},
+    {"libm erfc", libm_erfc_kernel, erfc_reference, NULL, -6.0, 26.0, 1e-15},
+    BATCH_PDF_CASE("normal", normal_case, -8.0, 10.0),
+    BATCH_CDF_CASE("normal", normal_case, -8.0, 10.0),
+    BATCH_PDF_CASE("exponential", exponential_case, 0.0, 12.0),
+    BATCH_CDF_CASE("exponential", exponential_case, 0.0, 12.0),
+    PRECISION_PDF_CASES("normal", normal_case, -8.0, 10.0),
+    PRECISION_CDF_CASES("normal", normal_case, -8.0, 10.0),
+    PRECISION_PDF_CASES("exponential", exponential_case, 0.0, 12.0),
+    PRECISION_CDF_CASES("exponential", exponential_case, 0.0, 12.0),
+    PRECISION_PDF_CASES("chi_square", chi_square_case, 0.01, 20.0),
+    PRECISION_PDF_CASES("t", t_case, -6.0, 6.0),
+    PRECISION_PDF_CASES("f", f_case, 0.01, 8.0),
+    PRECISION_PDF_CASES("gamma", gamma_case, 0.01, 15.0),
+    PRECISION_PDF_CASES("beta", beta_case, 0.001, 0.999),
+    PRECISION_PDF_CASES("weibull", weibull_case, 0.0, 8.0),
+    PRECISION_CDF_CASES("weibull", weibull_case, 0.0, 8.0),
+    PRECISION_PDF_CASES("rayleigh", rayleigh_case, 0.0, 8.0),
+    PRECISION_CDF_CASES("rayleigh", rayleigh_case, 0.0, 8.0),
+    PRECISION_PDF_CASES("pareto", pareto_case, 1.0, 20.0),
+    PRECISION_CDF_CASES("pareto", pareto_case, 1.0, 20.0),
+    PRECISION_PDF_CASES("uniform", uniform_case, -2.0, 4.0),
+    PRECISION_CDF_CASES("uniform", uniform_case, -2.0, 4.0)
+};
+
+/**
+ * Print one result row
+ */
+static void print_result(const char* name, const benchmark_result_t* result, const performance_metrics_t* metrics) {
+    printf("%-32s %10.1f ", name, result->calculation_time_ns);
+    
+    if (metrics) {
+        printf("%10.1f %10.1f ", metrics->min_time_ns, metrics->max_time_ns);
+    } else {
+        printf("%10s %10s ", "-", "-");
+    }
+    
+    printf("%12.3e %12.3e  %s\n", result->accuracy_error, result->max_error,
+           result->passed_accuracy_threshold ? "PASS" : "FAIL");
+}
+
+int main(int argc, char** argv) {
+    int points = (argc > 1) ? atoi(argv[1]) : STAT_BENCHMARK_DEFAULT_POINTS;
+    int iterations = (argc > 2) ? atoi(argv[2]) : DEFAULT_ITERATIONS;
+    const char* filter = (argc > 3) ? argv[3] : NULL;
+    int failures = 0;
+    
+    if (points <= 0 || iterations <= 0) {
+        fprintf(stderr, "usage: %s [points] [iterations] [name-filter]\n", argv[0]);
+        return 2;
+    }
+    
+    printf("%-32s %10s %10s %10s %12s %12s  %s\n", "kernel", "ns/call", "min", "max", "mean_err", "max_err", "status");
+    
+    for (size_t i = 0; i < sizeof(benchmark_cases) / sizeof(benchmark_cases[0]); i++) {
+        const benchmark_case_t* c = &benchmark_cases[i];
+        
+        if (filter && !strstr(c->name, filter)) {
+            continue;
+        }
+        
+        benchmark_grid_t grid = {c->min_value, c->max_value, points, iterations, c->error_threshold};
+        if (c->integer_grid) {
+            grid.points = (int)(c->max_value - c->min_value) + 1;
+        }
+        
+        performance_metrics_t metrics;
+        benchmark_result_t result = benchmark_kernel_on_grid(c->kernel, c->reference, c->context, &grid, &metrics);
+        print_result(c->name, &result, &metrics);
+        
+        if (!result.passed_accuracy_threshold) failures++;
+    }
+    
+    printf("batch kernels (vector_math backend: %s)\n", vector_math_backend());
+    
+    for (size_t i = 0; i < sizeof(benchmark_batch_cases) / sizeof(benchmark_batch_cases[0]); i++) {
+        const benchmark_batch_case_t* c = &benchmark_batch_cases[i];
+        
+        if (filter && !strstr(c->name, filter)) {
+            continue;
+        }
+        
+        benchmark_grid_t grid = {c->min_value, c->max_value, points, iterations, c->error_threshold};
+        performance_metrics_t metrics;
+        benchmark_result_t result = benchmark_batch_kernel_on_grid(c->kernel, c->reference, c->context, &grid, &metrics);
+        print_result(c->name, &result, &metrics);
+        
+        if (!result.passed_accuracy_threshold) failures++;
+    }
+    
+    if (!filter || strstr("statistical_constants", filter)) {
+        benchmark_result_t result;
+        
+        result = benchmark_factorial_approximation(170, iterations);
+        print_result("calculate_factorial", &result, NULL);
+        if (!result.passed_accuracy_threshold) failures++;
+        
+        result = benchmark_normal_cdf_approximation(-8.0, 8.0, iterations);
+        print_result("calculate_normal_cdf", &result, NULL);
+        if (!result.passed_accuracy_threshold) failures++;
+        
+        result = benchmark_critical_values_approximation(30, iterations);
+        print_result("calculate_t/chi_square_critical", &result, NULL);
+        if (!result.passed_accuracy_threshold) failures++;
+        
+        result = benchmark_gamma_approximation(0.1, 20.0, iterations);
+        print_result("lanczos_gamma_approximation", &result, NULL);
+        if (!result.passed_accuracy_threshold) failures++;
+    }
+    
+    printf("%d kernel(s) above their error threshold\n", failures);
+    return failures > 0 ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,271 @@
+#include "statistical_tables.h"
+#include <stdio.h>
+#include <math.h>
+
+// Generator for statistical_tables.c
+// Usage: generate_statistical_tables [output-file]   (stdout by default)
+// The host build runs it into the build tree and checks the copy in this
+// directory against that output.
+// Values are computed in long double and printed with 17 significant digits,
+// so every entry is the correctly rounded double (or within one ulp of it).
+
+static void print_table(const char* name, const char* size, const char* comment, long double* values, int count) {
+    printf("// %s\n", comment);
+    printf("const double %s[%s] = {\n", name, size);
+    
+    for (int i = 0; i < count; i++) {
+        if (i % 4 == 0) printf("    ");
+        printf("%.17e", (double)values[i]);
+        if (i < count - 1) printf(",");
+        if (i % 4 == 3 || i == count - 1) printf("\n");
+        else printf(" ");
+    }
+    
+    printf("};\n");
+}
+
+#define GEN_MAX_ITERATIONS 100000
+#define GEN_EPSILON 1e-21L
+#define GEN_TINY 1e-4000L
+#define GEN_BISECTIONS 256
+
+static const double gen_alpha_levels[CRITICAL_ALPHA_COUNT] = {0.10, 0.05, 0.025, 0.01, 0.005, 0.001};
+static const double gen_anchor_df[CRITICAL_ANCHOR_COUNT] = {150, 200, 300, 500, 1000};
+static const double gen_f_df1[F_TABLE_DF1_COUNT] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 15, 20, 24, 30, 40, 50, 60, 80, 100, 120
+};
+static const double gen_f_df2[F_TABLE_DF2_COUNT] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 35, 40, 50, 60, 80, 100, 120
+};
+
+// Lentz continued fraction for the incomplete beta function
+static long double gen_beta_cf(long double a, long double b, long double x) {
+    long double c = 1.0L;
+    long double d = 1.0L - (a + b) * x / (a + 1.0L);
+    if (fabsl(d) < GEN_TINY) d = GEN_TINY;
+    d = 1.0L / d;
+    long double h = d;
+    
+    for (int m = 1; m < GEN_MAX_ITERATIONS; m++) {
+        long double m2 = 2.0L * m;
+        long double an = m * (b - m) * x / ((a + m2 - 1.0L) * (a + m2));
+        d = 1.0L + an * d;
+        if (fabsl(d) < GEN_TINY) d = GEN_TINY;
+        c = 1.0L + an / c;
+        if (fabsl(c) < GEN_TINY) c = GEN_TINY;
+        d = 1.0L / d;
+        h *= d * c;
+        
+        an = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0L));
+        d = 1.0L + an * d;
+        if (fabsl(d) < GEN_TINY) d = GEN_TINY;
+        c = 1.0L + an / c;
+        if (fabsl(c) < GEN_TINY) c = GEN_TINY;
+        d = 1.0L / d;
+        long double del = d * c;
+        h *= del;
+        if (fabsl(del - 1.0L) < GEN_EPSILON) break;
+    }
+    
+    return h;
+}
+
+// Regularized incomplete beta I_x(a, b)
+static long double gen_beta_i(long double a, long double b, long double x) {
+    if (x <= 0.0L) return 0.0L;
+    if (x >= 1.0L) return 1.0L;
+    
+    long double front = expl(a * logl(x) + b * log1pl(-x) - lgammal(a) - lgammal(b) + lgammal(a + b));
+    
+    if (x < (a + 1.0L) / (a + b + 2.0L)) {
+        return front * gen_beta_cf(a, b, x) / a;
+    }
+    return 1.0L - front * gen_beta_cf(b, a, 1.0L - x) / b;
+}
+
+// Regularized lower incomplete gamma P(a, x)
+static long double gen_gamma_p(long double a, long double x) {
+    if (x <= 0.0L) return 0.0L;
+    
+    long double front = expl(a * logl(x) - x - lgammal(a));
+    
+    if (x < a + 1.0L) {
+        long double term = 1.0L / a;
+        long double sum = term;
+        for (int n = 1; n < GEN_MAX_ITERATIONS; n++) {
+            term *= x / (a + n);
+            sum += term;
+            if (fabsl(term) < fabsl(sum) * GEN_EPSILON) break;
+        }
+        return front * sum;
+    }
+    
+    long double b = x + 1.0L - a;
+    long double c = 1.0L / GEN_TINY;
+    long double d = 1.0L / b;
+    long double h = d;
+    for (int i = 1; i < GEN_MAX_ITERATIONS; i++) {
+        long double an = -i * (i - a);
+        b += 2.0L;
+        d = an * d + b;
+        if (fabsl(d) < GEN_TINY) d = GEN_TINY;
+        c = b + an / c;
+        if (fabsl(c) < GEN_TINY) c = GEN_TINY;
+        d = 1.0L / d;
+        long double del = d * c;
+        h *= del;
+        if (fabsl(del - 1.0L) < GEN_EPSILON) break;
+    }
+    return 1.0L - front * h;
+}
+
+// z with Φ(-z) = tail
+static long double gen_normal_upper(long double tail) {
+    long double low = 0.0L;
+    long double high = 40.0L;
+    
+    for (int i = 0; i < GEN_BISECTIONS; i++) {
+        long double middle = 0.5L * (low + high);
+        if (0.5L * erfcl(middle / sqrtl(2.0L)) > tail) low = middle;
+        else high = middle;
+    }
+    return 0.5L * (low + high);
+}
+
+// Chi-square quantile with lower-tail probability p
+static long double gen_chi_square_quantile(long double df, long double p) {
+    long double low = 0.0L;
+    long double high = df + 10.0L;
+    
+    while (gen_gamma_p(df / 2.0L, high / 2.0L) < p) high *= 2.0L;
+    for (int i = 0; i < GEN_BISECTIONS; i++) {
+        long double middle = 0.5L * (low + high);
+        if (gen_gamma_p(df / 2.0L, middle / 2.0L) < p) low = middle;
+        else high = middle;
+    }
+    return 0.5L * (low + high);
+}
+
+// Two-sided t critical value: I_w(ν/2, 1/2) = alpha with w = ν/(ν+t²)
+static long double gen_t_critical(long double df, long double alpha) {
+    if (df == 0.0L) return gen_normal_upper(alpha / 2.0L);
+    
+    long double low = 0.0L;
+    long double high = 1.0L;
+    for (int i = 0; i < GEN_BISECTIONS; i++) {
+        long double middle = 0.5L * (low + high);
+        if (gen_beta_i(df / 2.0L, 0.5L, middle) < alpha) low = middle;
+        else high = middle;
+    }
+    long double w = 0.5L * (low + high);
+    return sqrtl(df * (1.0L - w) / w);
+}
+
+// Upper-tail F critical value
+static long double gen_f_critical(long double df1, long double df2, long double alpha) {
+    // P(F > f) = I_w(df2/2, df1/2) with w = df2/(df2 + df1 f)
+    long double low = 0.0L;
+    long double high = 1.0L;
+    for (int i = 0; i < GEN_BISECTIONS; i++) {
+        long double middle = 0.5L * (low + high);
+        if (gen_beta_i(df2 / 2.0L, df1 / 2.0L, middle) < alpha) low = middle;
+        else high = middle;
+    }
+    long double w = 0.5L * (low + high);
+    return df2 * (1.0L - w) / (df1 * w);
+}
+
+int main(int argc, char** argv) {
+    static long double values[F_TABLE_DF1_COUNT * F_TABLE_DF2_COUNT * CRITICAL_ALPHA_COUNT];
+    
+    if (argc > 1 && !freopen(argv[1], "w", stdout)) {
+        perror(argv[1]);
+        return 1;
+    }
+    
+    printf("// Generated by generate_statistical_tables.c - do not edit\n\n");
+    printf("#include \"statistical_tables.h\"\n\n");
+    
+    for (int i = 0; i < NORMAL_TABLE_SIZE; i++) {
+        long double z = (long double)i / NORMAL_TABLE_STEPS_PER_UNIT;
+        values[i] = 0.5L * erfcl(z / sqrtl(2.0L));
+    }
+    print_table("normal_cdf_table", "NORMAL_TABLE_SIZE", "Φ(-z) for z = i / NORMAL_TABLE_STEPS_PER_UNIT", values, NORMAL_TABLE_SIZE);
+    printf("\n");
+    
+    for (int i = 0; i < NORMAL_TABLE_SIZE; i++) {
+        long double z = (long double)i / NORMAL_TABLE_STEPS_PER_UNIT;
+        values[i] = expl(-0.5L * z * z) / sqrtl(2.0L * 3.14159265358979323846264338327950288L);
+    }
+    print_table("normal_pdf_table", "NORMAL_TABLE_SIZE", "φ(z) for z = i / NORMAL_TABLE_STEPS_PER_UNIT", values, NORMAL_TABLE_SIZE);
+    printf("\n");
+    
+    for (int n = 0; n < LOG_FACTORIAL_TABLE_SIZE; n++) {
+        values[n] = lgammal((long double)n + 1.0L);
+    }
+    print_table("log_factorial_table", "LOG_FACTORIAL_TABLE_SIZE", "log(n!)", values, LOG_FACTORIAL_TABLE_SIZE);
+    printf("\n");
+    
+    for (int k = 1; k <= HALF_INTEGER_LOG_GAMMA_TABLE_SIZE; k++) {
+        values[k - 1] = lgammal((long double)k / 2.0L);
+    }
+    print_table("half_integer_log_gamma_table", "HALF_INTEGER_LOG_GAMMA_TABLE_SIZE", "log(Γ(k/2)) at index k - 1", values, HALF_INTEGER_LOG_GAMMA_TABLE_SIZE);
+    printf("\n");
+    
+    for (int a = 0; a < CRITICAL_ALPHA_COUNT; a++) {
+        values[a] = gen_alpha_levels[a];
+    }
+    print_table("critical_alpha_levels", "CRITICAL_ALPHA_COUNT", "Standard significance levels", values, CRITICAL_ALPHA_COUNT);
+    printf("\n");
+    
+    static long double row_df[CRITICAL_TABLE_ROWS];
+    for (int row = 0; row < CRITICAL_TABLE_ROWS; row++) {
+        if (row < CRITICAL_TABLE_MAX_DF) row_df[row] = row + 1;
+        else if (row < CRITICAL_TABLE_MAX_DF + CRITICAL_ANCHOR_COUNT) row_df[row] = gen_anchor_df[row - CRITICAL_TABLE_MAX_DF];
+        else row_df[row] = 0.0L;
+    }
+    print_table("critical_table_df", "CRITICAL_TABLE_ROWS", "df of each critical-value row, 0 for ∞", row_df, CRITICAL_TABLE_ROWS);
+    printf("\n");
+    
+    for (int row = 0; row < CRITICAL_TABLE_ROWS; row++) {
+        for (int a = 0; a < CRITICAL_ALPHA_COUNT; a++) {
+            values[CRITICAL_INDEX(row, a)] = gen_t_critical(row_df[row], gen_alpha_levels[a]);
+        }
+    }
+    print_table("t_critical_table", "CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT", "t(1 - α/2, df) at [row][alpha]", values, CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT);
+    printf("\n");
+    
+    for (int row = 0; row < CRITICAL_TABLE_ROWS; row++) {
+        for (int a = 0; a < CRITICAL_ALPHA_COUNT; a++) {
+            long double alpha = gen_alpha_levels[a];
+            values[CRITICAL_INDEX(row, a)] = row_df[row] == 0.0L ? gen_normal_upper(alpha)
+                                                                 : gen_chi_square_quantile(row_df[row], 1.0L - alpha);
+        }
+    }
+    print_table("chi_square_critical_table", "CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT", "χ²(1 - α, df) at [row][alpha]; z(1 - α) in the ∞ row", values, CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT);
+    printf("\n");
+    
+    for (int i = 0; i < F_TABLE_DF1_COUNT; i++) {
+        values[i] = gen_f_df1[i];
+    }
+    print_table("f_table_df1", "F_TABLE_DF1_COUNT", "F table numerator df", values, F_TABLE_DF1_COUNT);
+    printf("\n");
+    
+    for (int j = 0; j < F_TABLE_DF2_COUNT; j++) {
+        values[j] = gen_f_df2[j];
+    }
+    print_table("f_table_df2", "F_TABLE_DF2_COUNT", "F table denominator df", values, F_TABLE_DF2_COUNT);
+    printf("\n");
+    
+    for (int i = 0; i < F_TABLE_DF1_COUNT; i++) {
+        for (int j = 0; j < F_TABLE_DF2_COUNT; j++) {
+            for (int a = 0; a < CRITICAL_ALPHA_COUNT; a++) {
+                values[F_CRITICAL_INDEX(i, j, a)] = gen_f_critical(gen_f_df1[i], gen_f_df2[j], gen_alpha_levels[a]);
+            }
+        }
+    }
+    print_table("f_critical_table", "F_TABLE_DF1_COUNT * F_TABLE_DF2_COUNT * CRITICAL_ALPHA_COUNT", "F(1 - α; df1, df2) at [df1][df2][alpha]", values, F_TABLE_DF1_COUNT * F_TABLE_DF2_COUNT * CRITICAL_ALPHA_COUNT);
+    
+    return 0;
+}
\ No newline at end of file
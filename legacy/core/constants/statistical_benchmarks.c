@@ -0,0 +1,571 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "statistical_constants.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Convergence settings for the long double references
+#define REFERENCE_EPSILON 1e-19L
+#define REFERENCE_MAX_ITERATIONS 100000
+#define REFERENCE_TINY 1e-300L
+
+// Significance levels covered by the critical value benchmark
+static const double benchmark_alpha_levels[] = {0.10, 0.05, 0.025, 0.01, 0.005};
+
+// Prevents the timed loops from being optimized away
+static volatile double benchmark_sink;
+
+/**
+ * Monotonic wall clock in nanoseconds
+ */
+static double benchmark_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * Process CPU time in nanoseconds
+ */
+static double benchmark_cpu_ns(void) {
+    return (double)clock() * (1e9 / CLOCKS_PER_SEC);
+}
+
+/**
+ * Mixed absolute/relative error of a value against its reference
+ */
+static double benchmark_error(double value, long double reference) {
+    if (isnan(value) && isnan((double)reference)) return 0.0;
+    if (isnan(value) || isnan((double)reference)) return INFINITY;
+    if (isinf(value) || isinf((double)reference)) {
+        return (value == (double)reference) ? 0.0 : INFINITY;
+    }
+    
+    long double scale = fabsl(reference) > 1.0L ? fabsl(reference) : 1.0L;
+    return (double)(fabsl((long double)value - reference) / scale);
+}
+
+/**
+ * Point i of an evenly spaced grid
+ */
+static double benchmark_grid_point(const benchmark_grid_t* grid, int i) {
+    if (grid->points <= 1) return grid->min_value;
+    return grid->min_value + (grid->max_value - grid->min_value) * i / (grid->points - 1);
+}
+
+/**
+ * Empty result for invalid benchmark requests
+ */
+static benchmark_result_t benchmark_empty_result(void) {
+    benchmark_result_t result = {0};
+    result.passed_accuracy_threshold = false;
+    return result;
+}
+
+/**
+ * Accumulate one sub-benchmark into a combined result
+ */
+static void benchmark_merge(benchmark_result_t* total, const benchmark_result_t* part) {
+    int count = total->test_count + part->test_count;
+    
+    if (count > 0) {
+        total->calculation_time_ns = (total->calculation_time_ns * total->test_count +
+                                      part->calculation_time_ns * part->test_count) / count;
+        total->cpu_cycles = (total->cpu_cycles * total->test_count + part->cpu_cycles * part->test_count) / count;
+        total->accuracy_error = (total->accuracy_error * total->test_count +
+                                 part->accuracy_error * part->test_count) / count;
+    }
+    
+    if (part->max_error > total->max_error) {
+        total->max_error = part->max_error;
+    }
+    
+    total->passed_accuracy_threshold = (total->test_count == 0 || total->passed_accuracy_threshold) &&
+                                       part->passed_accuracy_threshold;
+    total->test_count = count;
+}
+
+/**
+ * Benchmark a kernel over an evenly spaced grid
+ * One untimed pass measures accuracy against the reference, then every timed
+ * sweep evaluates the whole grid and contributes one ns/call sample.
+ */
+benchmark_result_t benchmark_kernel_on_grid(benchmark_kernel_t kernel, benchmark_reference_t reference,
+                                            const void* context, const benchmark_grid_t* grid,
+                                            performance_metrics_t* metrics) {
+    benchmark_result_t result = benchmark_empty_result();
+    
+    if (metrics) {
+        *metrics = (performance_metrics_t){0};
+    }
+    
+    if (!kernel || !grid || grid->points <= 0 || grid->iterations <= 0) {
+        return result;
+    }
+    
+    // Accuracy pass
+    double error_sum = 0.0;
+    double max_error = 0.0;
+    int successful = 0;
+    int failed = 0;
+    
+    for (int i = 0; i < grid->points; i++) {
+        double x = benchmark_grid_point(grid, i);
+        double value = kernel(x, context);
+        
+        if (isnan(value) && !(reference && isnan((double)reference(x, context)))) {
+            failed++;
+        } else {
+            successful++;
+        }
+        
+        if (reference) {
+            double error = benchmark_error(value, reference(x, context));
+            error_sum += error;
+            if (error > max_error) max_error = error;
+        }
+    }
+    
+    // Timing pass
+    double total_ns = 0.0;
+    double min_ns = INFINITY;
+    double max_ns = 0.0;
+    double cpu_start = benchmark_cpu_ns();
+    
+    for (int iteration = 0; iteration < grid->iterations; iteration++) {
+        double sum = 0.0;
+        double start = benchmark_now_ns();
+        
+        for (int i = 0; i < grid->points; i++) {
+            sum += kernel(benchmark_grid_point(grid, i), context);
+        }
+        
+        double per_call = (benchmark_now_ns() - start) / grid->points;
+        benchmark_sink = sum;
+        
+        total_ns += per_call * grid->points;
+        if (per_call < min_ns) min_ns = per_call;
+        if (per_call > max_ns) max_ns = per_call;
+    }
+    
+    double cpu_ns = benchmark_cpu_ns() - cpu_start;
+    int calls = grid->points * grid->iterations;
+    
+    result.calculation_time_ns = total_ns / calls;
+    result.cpu_cycles = result.calculation_time_ns * STAT_BENCHMARK_CPU_MHZ / 1000.0;
+    result.accuracy_error = error_sum / grid->points;
+    result.max_error = max_error;
+    result.test_count = calls;
+    result.passed_accuracy_threshold = (max_error <= grid->error_threshold);
+    
+    if (metrics) {
+        metrics->total_time_ns = total_ns;
+        metrics->avg_time_per_call_ns = result.calculation_time_ns;
+        metrics->min_time_ns = min_ns;
+        metrics->max_time_ns = max_ns;
+        metrics->cpu_utilization_percent = (total_ns > 0.0) ? 100.0 * cpu_ns / total_ns : 0.0;
+        metrics->successful_calculations = successful * grid->iterations;
+        metrics->failed_calculations = failed * grid->iterations;
+    }
+    
+    return result;
+}
+
+/**
+ * Benchmark a batch kernel over an evenly spaced grid
+ * Every timed sweep is a single call over the whole grid; ns/call is per value.
+ */
+benchmark_result_t benchmark_batch_kernel_on_grid(benchmark_batch_kernel_t kernel, benchmark_reference_t reference,
+                                                  const void* context, const benchmark_grid_t* grid,
+                                                  performance_metrics_t* metrics) {
+    benchmark_result_t result = benchmark_empty_result();
+    
+    if (metrics) {
+        *metrics = (performance_metrics_t){0};
+    }
+    
+    if (!kernel || !grid || grid->points <= 0 || grid->iterations <= 0) {
+        return result;
+    }
+    
+    double* x = malloc(2 * (size_t)grid->points * sizeof(double));
+    if (!x) {
+        return result;
+    }
+    double* out = x + grid->points;
+    
+    for (int i = 0; i < grid->points; i++) {
+        x[i] = benchmark_grid_point(grid, i);
+    }
+    
+    // Accuracy pass
+    double error_sum = 0.0;
+    double max_error = 0.0;
+    int successful = 0;
+    int failed = 0;
+    
+    kernel(x, out, (size_t)grid->points, context);
+    for (int i = 0; i < grid->points; i++) {
+        if (isnan(out[i]) && !(reference && isnan((double)reference(x[i], context)))) {
+            failed++;
+        } else {
+            successful++;
+        }
+        
+        if (reference) {
+            double error = benchmark_error(out[i], reference(x[i], context));
+            error_sum += error;
+            if (error > max_error) max_error = error;
+        }
+    }
+    
+    // Timing pass
+    double total_ns = 0.0;
+    double min_ns = INFINITY;
+    double max_ns = 0.0;
+    double cpu_start = benchmark_cpu_ns();
+    
+    for (int iteration = 0; iteration < grid->iterations; iteration++) {
+        double start = benchmark_now_ns();
+        
+        kernel(x, out, (size_t)grid->points, context);
+        
+        double per_call = (benchmark_now_ns() - start) / grid->points;
+        benchmark_sink = out[iteration % grid->points];
+        
+        total_ns += per_call * grid->points;
+        if (per_call < min_ns) min_ns = per_call;
+        if (per_call > max_ns) max_ns = per_call;
+    }
+    
+    double cpu_ns = benchmark_cpu_ns() - cpu_start;
+    int calls = grid->points * grid->iterations;
+    free(x);
+    
+    result.calculation_time_ns = total_ns / calls;
+    result.cpu_cycles = result.calculation_time_ns * STAT_BENCHMARK_CPU_MHZ / 1000.0;
+    result.accuracy_error = error_sum / grid->points;
+    result.max_error = max_error;
+    result.test_count = calls;
+    result.passed_accuracy_threshold = (max_error <= grid->error_threshold);
+    
+    if (metrics) {
+        metrics->total_time_ns = total_ns;
+        metrics->avg_time_per_call_ns = result.calculation_time_ns;
+        metrics->min_time_ns = min_ns;
+        metrics->max_time_ns = max_ns;
+        metrics->cpu_utilization_percent = (total_ns > 0.0) ? 100.0 * cpu_ns / total_ns : 0.0;
+        metrics->successful_calculations = successful * grid->iterations;
+        metrics->failed_calculations = failed * grid->iterations;
+    }
+    
+    return result;
+}
+
+/**
+ * Regularized lower incomplete gamma P(a,x) in long double
+ * Series for x < a + 1, modified Lentz continued fraction otherwise.
+ */
+long double benchmark_reference_gamma_p(long double a, long double x) {
+    if (x <= 0.0L) return 0.0L;
+    if (isinf((double)x)) return 1.0L;
+    
+    long double front = expl(a * logl(x) - x - lgammal(a));
+    
+    if (x < a + 1.0L) {
+        long double term = 1.0L / a;
+        long double sum = term;
+        for (int n = 1; n < REFERENCE_MAX_ITERATIONS; n++) {
+            term *= x / (a + n);
+            sum += term;
+            if (fabsl(term) < fabsl(sum) * REFERENCE_EPSILON) break;
+        }
+        return front * sum;
+    }
+    
+    long double b = x + 1.0L - a;
+    long double c = 1.0L / REFERENCE_TINY;
+    long double d = 1.0L / b;
+    long double h = d;
+    for (int i = 1; i < REFERENCE_MAX_ITERATIONS; i++) {
+        long double an = -i * (i - a);
+        b += 2.0L;
+        d = an * d + b;
+        if (fabsl(d) < REFERENCE_TINY) d = REFERENCE_TINY;
+        c = b + an / c;
+        if (fabsl(c) < REFERENCE_TINY) c = REFERENCE_TINY;
+        d = 1.0L / d;
+        long double del = d * c;
+        h *= del;
+        if (fabsl(del - 1.0L) < REFERENCE_EPSILON) break;
+    }
+    
+    return 1.0L - front * h;
+}
+
+/**
+ * Continued fraction for the long double incomplete beta reference
+ */
+static long double benchmark_reference_beta_cf(long double a, long double b, long double x) {
+    long double qab = a + b;
+    long double qap = a + 1.0L;
+    long double qam = a - 1.0L;
+    long double c = 1.0L;
+    long double d = 1.0L - qab * x / qap;
+    
+    if (fabsl(d) < REFERENCE_TINY) d = REFERENCE_TINY;
+    d = 1.0L / d;
+    long double h = d;
+    
+    for (int m = 1; m < REFERENCE_MAX_ITERATIONS; m++) {
+        int m2 = 2 * m;
+        long double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1.0L + aa * d;
+        if (fabsl(d) < REFERENCE_TINY) d = REFERENCE_TINY;
+        c = 1.0L + aa / c;
+        if (fabsl(c) < REFERENCE_TINY) c = REFERENCE_TINY;
+        d = 1.0L / d;
+        h *= d * c;
+        
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1.0L + aa * d;
+        if (fabsl(d) < REFERENCE_TINY) d = REFERENCE_TINY;
+        c = 1.0L + aa / c;
+        if (fabsl(c) < REFERENCE_TINY) c = REFERENCE_TINY;
+        d = 1.0L / d;
+        long double del = d * c;
+        h *= del;
+        if (fabsl(del - 1.0L) < REFERENCE_EPSILON) break;
+    }
+    
+    return h;
+}
+
+/**
+ * Regularized incomplete beta I_x(a,b) in long double
+ */
+long double benchmark_reference_beta_i(long double a, long double b, long double x) {
+    if (x <= 0.0L) return 0.0L;
+    if (x >= 1.0L) return 1.0L;
+    
+    long double front = expl(a * logl(x) + b * log1pl(-x) - lgammal(a) - lgammal(b) + lgammal(a + b));
+    
+    if (x < (a + 1.0L) / (a + b + 2.0L)) {
+        return front * benchmark_reference_beta_cf(a, b, x) / a;
+    }
+    
+    return 1.0L - front * benchmark_reference_beta_cf(b, a, 1.0L - x) / b;
+}
+
+/**
+ * Kernels and references for the statistical_constants benchmarks
+ */
+static double benchmark_factorial_kernel(double x, const void* context) {
+    (void)context;
+    return calculate_factorial((int)x);
+}
+
+static long double benchmark_factorial_reference(double x, const void* context) {
+    (void)context;
+    return expl(lgammal((long double)x + 1.0L));
+}
+
+static double benchmark_normal_cdf_kernel(double z, const void* context) {
+    (void)context;
+    return calculate_normal_cdf(z);
+}
+
+static long double benchmark_normal_cdf_reference(double z, const void* context) {
+    (void)context;
+    return 0.5L * erfcl(-(long double)z / sqrtl(2.0L));
+}
+
+static double benchmark_gamma_kernel(double x, const void* context) {
+    (void)context;
+    return lanczos_gamma_approximation(x);
+}
+
+static long double benchmark_gamma_reference(double x, const void* context) {
+    (void)context;
+    return tgammal((long double)x);
+}
+
+static double benchmark_chi_square_critical_kernel(double df, const void* context) {
+    return calculate_chi_square_critical((int)df, *(const double*)context);
+}
+
+static double benchmark_t_critical_kernel(double df, const void* context) {
+    return calculate_t_critical((int)df, *(const double*)context);
+}
+
+/**
+ * Upper-tail chi-square critical value by bisection on the reference P
+ */
+static long double benchmark_chi_square_critical_reference(double df, const void* context) {
+    long double alpha = *(const double*)context;
+    long double half_df = (long double)df / 2.0L;
+    long double low = 0.0L;
+    long double high = 1.0L;
+    
+    while (1.0L - benchmark_reference_gamma_p(half_df, high / 2.0L) > alpha) {
+        high *= 2.0L;
+    }
+    
+    for (int i = 0; i < 200; i++) {
+        long double middle = 0.5L * (low + high);
+        if (1.0L - benchmark_reference_gamma_p(half_df, middle / 2.0L) > alpha) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    
+    return 0.5L * (low + high);
+}
+
+/**
+ * Two-sided t critical value: solve I_w(ν/2, 1/2) = alpha for w = ν/(ν+t²)
+ */
+static long double benchmark_t_critical_reference(double df, const void* context) {
+    long double alpha = *(const double*)context;
+    long double nu = (long double)df;
+    long double low = 0.0L;
+    long double high = 1.0L;
+    
+    for (int i = 0; i < 200; i++) {
+        long double middle = 0.5L * (low + high);
+        if (benchmark_reference_beta_i(nu / 2.0L, 0.5L, middle) < alpha) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    
+    long double w = 0.5L * (low + high);
+    return sqrtl(nu * (1.0L - w) / w);
+}
+
+/**
+ * Benchmark calculate_factorial for n = 0..max_n (capped at 170, the double range)
+ */
+benchmark_result_t benchmark_factorial_approximation(int max_n, int iterations) {
+    if (max_n > 170) max_n = 170;
+    if (max_n < 0) return benchmark_empty_result();
+    
+    benchmark_grid_t grid = {0.0, (double)max_n, max_n + 1, iterations, 1e-12};
+    return benchmark_kernel_on_grid(benchmark_factorial_kernel, benchmark_factorial_reference, NULL, &grid, NULL);
+}
+
+/**
+ * Benchmark calculate_normal_cdf on [z_min, z_max]
+ */
+benchmark_result_t benchmark_normal_cdf_approximation(double z_min, double z_max, int iterations) {
+    benchmark_grid_t grid = {z_min, z_max, STAT_BENCHMARK_DEFAULT_POINTS, iterations, STAT_BENCHMARK_ERROR_THRESHOLD};
+    return benchmark_kernel_on_grid(benchmark_normal_cdf_kernel, benchmark_normal_cdf_reference, NULL, &grid, NULL);
+}
+
+/**
+ * Benchmark chi-square and t critical values for df = 1..max_df at the
+ * common significance levels; the result aggregates every (kind, alpha) grid
+ */
+benchmark_result_t benchmark_critical_values_approximation(int max_df, int iterations) {
+    benchmark_result_t total = benchmark_empty_result();
+    
+    if (max_df < 1) return total;
+    
+    benchmark_grid_t grid = {1.0, (double)max_df, max_df, iterations, 1e-3};
+    int levels = (int)(sizeof(benchmark_alpha_levels) / sizeof(benchmark_alpha_levels[0]));
+    
+    for (int i = 0; i < levels; i++) {
+        const double* alpha = &benchmark_alpha_levels[i];
+        benchmark_result_t chi_square = benchmark_kernel_on_grid(benchmark_chi_square_critical_kernel,
+                                                                 benchmark_chi_square_critical_reference,
+                                                                 alpha, &grid, NULL);
+        benchmark_result_t t = benchmark_kernel_on_grid(benchmark_t_critical_kernel,
+                                                        benchmark_t_critical_reference,
+                                                        alpha, &grid, NULL);
+        benchmark_merge(&total, &chi_square);
+        benchmark_merge(&total, &t);
+    }
+    
+    return total;
+}
+
+/**
+ * Benchmark lanczos_gamma_approximation on [min_val, max_val]
+ */
+benchmark_result_t benchmark_gamma_approximation(double min_val, double max_val, int iterations) {
+    benchmark_grid_t grid = {min_val, max_val, STAT_BENCHMARK_DEFAULT_POINTS, iterations, 1e-12};
+    return benchmark_kernel_on_grid(benchmark_gamma_kernel, benchmark_gamma_reference, NULL, &grid, NULL);
+}
+
+/**
+ * Time individual calls of a calculation
+ */
+performance_metrics_t monitor_calculation_performance(void (*calc_function)(void), int iterations) {
+    performance_metrics_t metrics = {0};
+    
+    if (!calc_function || iterations <= 0) {
+        return metrics;
+    }
+    
+    metrics.min_time_ns = INFINITY;
+    double cpu_start = benchmark_cpu_ns();
+    
+    for (int i = 0; i < iterations; i++) {
+        double start = benchmark_now_ns();
+        calc_function();
+        double elapsed = benchmark_now_ns() - start;
+        
+        metrics.total_time_ns += elapsed;
+        if (elapsed < metrics.min_time_ns) metrics.min_time_ns = elapsed;
+        if (elapsed > metrics.max_time_ns) metrics.max_time_ns = elapsed;
+    }
+    
+    double cpu_ns = benchmark_cpu_ns() - cpu_start;
+    
+    metrics.avg_time_per_call_ns = metrics.total_time_ns / iterations;
+    metrics.cpu_utilization_percent = (metrics.total_time_ns > 0.0) ? 100.0 * cpu_ns / metrics.total_time_ns : 0.0;
+    metrics.successful_calculations = iterations;
+    metrics.failed_calculations = 0;
+    
+    return metrics;
+}
+
+/**
+ * CPU time as a percentage of wall time while the calculation runs
+ * The calculation is repeated until at least 10 ms of wall time has passed,
+ * since clock() resolution is too coarse for a single fast call.
+ */
+double measure_cpu_utilization_during_calculation(void (*calc_function)(void)) {
+    if (!calc_function) {
+        return 0.0;
+    }
+    
+    double wall_start = benchmark_now_ns();
+    double cpu_start = benchmark_cpu_ns();
+    double wall_ns;
+    
+    do {
+        calc_function();
+        wall_ns = benchmark_now_ns() - wall_start;
+    } while (wall_ns < 1e7);
+    
+    return 100.0 * (benchmark_cpu_ns() - cpu_start) / wall_ns;
+}
+
+/**
+ * Check measured metrics against the per-call budget
+ */
+bool validate_performance_requirements(const performance_metrics_t* metrics) {
+    if (!metrics) {
+        return false;
+    }
+    
+    return metrics->failed_calculations == 0 &&
+           metrics->avg_time_per_call_ns <= STAT_PERFORMANCE_MAX_AVG_TIME_NS;
+}
\ No newline at end of file
@@ -1,27 +1,13 @@
 #include "statistical_constants.h"
+#include "statistical_tables.h"
+#include "../math/math_utils.h"
+#include "../distributions/lib/distribution_interface.h"
+#include "../../../src/common/cache/budget.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
 
-// Structure for essential critical values lookup
-typedef struct {
-    double alpha_levels[5];
-    double chi_square_1df[5];
-    double chi_square_2df[5];
-    double t_1df[5];
-    double t_2df[5];
-} essential_critical_values_t;
-
-// Essential critical values for common significance levels
-const essential_critical_values_t essential_critical_values = {
-    .alpha_levels = {0.10, 0.05, 0.025, 0.01, 0.005},
-    .chi_square_1df = {2.7055, 3.8415, 5.0239, 6.6349, 7.8794},
-    .chi_square_2df = {4.6052, 5.9915, 7.3778, 9.2103, 10.5966},
-    .t_1df = {3.0777, 6.3138, 12.7062, 31.8205, 63.6567},
-    .t_2df = {1.8856, 2.9200, 4.3027, 6.9646, 9.9248}
-};
-
 // Small factorial cache for very fast lookup (0! to 12!)
 const double small_factorial_cache[SMALL_FACTORIAL_CACHE_SIZE] = {
     1.0,                    // 0!
@@ -56,16 +42,13 @@ double calculate_factorial(int n) {
 }
 
 /**
- * High-performance log factorial using optimized Stirling's approximation
+ * High-performance log factorial using the shared log-factorial cache
+ * Falls back to Stirling's series beyond the cache
  */
 double calculate_log_factorial(int n) {
     if (n < 0) return NAN;
-    if (n < SMALL_FACTORIAL_CACHE_SIZE) {
-        return log(small_factorial_cache[n]);
-    }
-    if (n < 20) {
-        // Use Lanczos for small-medium values
-        return log(lanczos_gamma_approximation(n + 1.0));
+    if (n < LOG_FACTORIAL_CACHE_SIZE) {
+        return log_factorial(n);
     }
     // Use optimized Stirling's approximation for large values
     return stirling_log_factorial_approximation(n);
@@ -73,12 +56,209 @@ double calculate_log_factorial(int n) {
 
 /**
  * Stirling's approximation for log(n!)
- * log(n!) ≈ n*log(n) - n + 0.5*log(2*π*n)
+ * log(n!) ≈ n*log(n) - n + 0.5*log(2*π*n) + 1/(12n) - 1/(360n³) + 1/(1260n⁵)
  */
-double stirling_log_factorial(int n) {
+double stirling_log_factorial_approximation(int n) {
     if (n <= 0) return 0.0;
     double dn = (double)n;
-    return dn * log(dn) - dn + 0.5 * log(2.0 * STAT_PI * dn);
+    double inv = 1.0 / dn;
+    double inv2 = inv * inv;
+    double series = inv * (1.0 / 12.0 - inv2 * (1.0 / 360.0 - inv2 / 1260.0));
+    return dn * log(dn) - dn + 0.5 * log(2.0 * STAT_PI * dn) + series;
+}
+
+/**
+ * Lanczos approximation of the gamma function (g = 7, 9 coefficients)
+ * Uses the reflection formula for z < 0.5
+ */
+double lanczos_gamma_approximation(double z) {
+    static const double coefficients[9] = {
+        0.99999999999980993,
+        676.5203681218851,
+        -1259.1392167224028,
+        771.32342877765313,
+        -176.61502916214059,
+        12.507343278686905,
+        -0.13857109526572012,
+        9.9843695780195716e-6,
+        1.5056327351493116e-7
+    };
+    
+    if (z < 0.5) {
+        // Reflection formula: Γ(z)Γ(1-z) = π/sin(πz)
+        return STAT_PI / (sin(STAT_PI * z) * lanczos_gamma_approximation(1.0 - z));
+    }
+    
+    z -= 1.0;
+    double x = coefficients[0];
+    for (int i = 1; i < 9; i++) {
+        x += coefficients[i] / (z + i);
+    }
+    
+    double t = z + 7.5;
+    
+    // Split so t^(z + 0.5) does not overflow before exp(-t) scales it back, up to 170!
+    double half_power = pow(t, 0.5 * (z + 0.5));
+    return STAT_SQRT_2PI * half_power * exp(-t) * half_power * x;
+}
+
+/**
+ * Lower normal tail Φ(-z) for 0 <= z < NORMAL_TABLE_Z_MAX
+ * Quintic Hermite interpolation between table points, using Φ'(-z) = -φ(z)
+ * and Φ''(-z) = zφ(z), so only the CDF and PDF tables are needed.
+ * Relative error stays below 1e-10 even at the far end of the table.
+ */
+static double normal_lower_tail_from_table(double z) {
+    double position = z * NORMAL_TABLE_STEPS_PER_UNIT;
+    int i = (int)position;
+    double t = position - i;
+    double h = 1.0 / NORMAL_TABLE_STEPS_PER_UNIT;
+    double z0 = i * h;
+    double z1 = z0 + h;
+    
+    double f0 = normal_cdf_table[i];
+    double f1 = normal_cdf_table[i + 1];
+    double d0 = -normal_pdf_table[i] * h;
+    double d1 = -normal_pdf_table[i + 1] * h;
+    double s0 = z0 * normal_pdf_table[i] * h * h;
+    double s1 = z1 * normal_pdf_table[i + 1] * h * h;
+    
+    // Quintic Hermite basis in Horner form
+    double t2 = t * t;
+    double t3 = t2 * t;
+    double u = 1.0 - t;
+    double u2 = u * u;
+    double u3 = u2 * u;
+    double h0 = u3 * (1.0 + 3.0 * t + 6.0 * t2);
+    double h1 = u3 * t * (1.0 + 3.0 * t);
+    double h2 = 0.5 * u3 * t2;
+    double h5 = t3 * (1.0 + 3.0 * u + 6.0 * u2);
+    double h4 = -t3 * u * (1.0 + 3.0 * u);
+    double h3 = 0.5 * t3 * u2;
+    
+    return f0 * h0 + d0 * h1 + s0 * h2 + f1 * h5 + d1 * h4 + s1 * h3;
+}
+
+/**
+ * Standard normal CDF entry point
+ * Table-driven inside ±NORMAL_TABLE_Z_MAX; erfc only beyond it
+ */
+double calculate_normal_cdf(double z) {
+    if (isnan(z)) return NAN;
+    
+    double a = fabs(z);
+    double tail;
+    
+    if (a < NORMAL_TABLE_Z_MAX) {
+        tail = normal_lower_tail_from_table(a);
+    } else {
+        tail = 0.5 * erfc(a / STAT_SQRT_2);
+    }
+    
+    return (z < 0.0) ? tail : 1.0 - tail;
+}
+
+/**
+ * Chi-square upper-tail critical value for significance level alpha
+ */
+double calculate_chi_square_critical(int df, double alpha) {
+    return fast_chi_square_critical(df, alpha);
+}
+
+/**
+ * Two-sided t critical value for significance level alpha
+ */
+double calculate_t_critical(int df, double alpha) {
+    return fast_t_critical(df, alpha);
+}
+
+/**
+ * Index of alpha in critical_alpha_levels, or -1 off the standard levels
+ */
+static int critical_alpha_index(double alpha) {
+    for (int i = 0; i < CRITICAL_ALPHA_COUNT; i++) {
+        if (fabs(alpha - critical_alpha_levels[i]) < 1e-6) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Bracket df among increasing table df (0 for ∞, only as the last entry) for
+ * linear interpolation in 1/df; sets *index and returns the weight of entry
+ * *index + 1. df must not exceed the last finite entry unless ∞ follows it.
+ */
+static double critical_df_position(const double* table_df, int count, double df, int* index) {
+    int i = 0;
+    
+    while (i < count - 2 && table_df[i + 1] != 0.0 && table_df[i + 1] <= df) {
+        i++;
+    }
+    *index = i;
+    
+    if (df <= table_df[i]) return 0.0;
+    
+    double inv_low = 1.0 / table_df[i];
+    double inv_high = table_df[i + 1] == 0.0 ? 0.0 : 1.0 / table_df[i + 1];
+    return (inv_low - 1.0 / df) / (inv_low - inv_high);
+}
+
+/**
+ * Position past the dense rows, bracketing from the df = CRITICAL_TABLE_MAX_DF row on
+ */
+static double critical_large_df_position(double df, int* row) {
+    const int first = CRITICAL_TABLE_MAX_DF - 1;
+    double weight = critical_df_position(critical_table_df + first, CRITICAL_TABLE_ROWS - first, df, row);
+    
+    *row += first;
+    return weight;
+}
+
+/**
+ * Wilson–Hilferty normalization of a chi-square quantile and its inverse
+ * The normalized value tends to z(1 - α) as df grows, so it interpolates
+ * far better in 1/df than the quantile itself.
+ */
+static double chi_square_normalized(double x, double df) {
+    double h = 2.0 / (9.0 * df);
+    return (cbrt(x / df) - 1.0 + h) / sqrt(h);
+}
+
+static double chi_square_from_normalized(double w, double df) {
+    double h = 2.0 / (9.0 * df);
+    double term = 1.0 - h + w * sqrt(h);
+    return df * term * term * term;
+}
+
+/**
+ * Upper-tail F critical value for significance level alpha
+ * Exact on the table grid; between grid df, bilinear in (1/df1, 1/df2), the
+ * classic harmonic interpolation for F tables (within 0.1%). Other alpha
+ * levels and df past CRITICAL_TABLE_MAX_DF, where F - 1 shrinks like
+ * sqrt(1/df) and no longer interpolates, go to the quantile engine.
+ */
+double calculate_f_critical(int df1, int df2, double alpha) {
+    if (df1 <= 0 || df2 <= 0 || alpha <= 0.0 || alpha >= 1.0) return NAN;
+    
+    int a = critical_alpha_index(alpha);
+    if (a < 0 || df1 > CRITICAL_TABLE_MAX_DF || df2 > CRITICAL_TABLE_MAX_DF) {
+        double params[2] = {(double)df1, (double)df2};
+        return distribution_quantile(DIST_F_DISTRIBUTION, params, 2, 1.0 - alpha);
+    }
+    
+    int i, j;
+    double u = critical_df_position(f_table_df1, F_TABLE_DF1_COUNT, (double)df1, &i);
+    double v = critical_df_position(f_table_df2, F_TABLE_DF2_COUNT, (double)df2, &j);
+    
+    double f00 = f_critical_table[F_CRITICAL_INDEX(i, j, a)];
+    if (u == 0.0 && v == 0.0) return f00;
+    
+    double f01 = f_critical_table[F_CRITICAL_INDEX(i, j + 1, a)];
+    double f10 = f_critical_table[F_CRITICAL_INDEX(i + 1, j, a)];
+    double f11 = f_critical_table[F_CRITICAL_INDEX(i + 1, j + 1, a)];
+    
+    return (1.0 - u) * ((1.0 - v) * f00 + v * f01) + u * ((1.0 - v) * f10 + v * f11);
 }
 
 /**
@@ -117,27 +297,35 @@ double normal_cdf_approximation(double z) {
 }
 
 /**
- * Chi-square critical value approximation
+ * Chi-square upper-tail critical value
+ * Exact table entries for df <= CRITICAL_TABLE_MAX_DF at the standard alpha
+ * levels; larger df interpolate the Wilson–Hilferty normalized value in 1/df
+ * between anchors. Other alpha levels go to the quantile engine.
  */
 double fast_chi_square_critical(int df, double alpha) {
-    // Check essential table first for common cases
-    if (df == 1) {
-        for (int i = 0; i < 5; i++) {
-            if (fabs(alpha - essential_critical_values.alpha_levels[i]) < 1e-6) {
-                return essential_critical_values.chi_square_1df[i];
-            }
-        }
+    if (df <= 0 || alpha <= 0.0 || alpha >= 1.0) return NAN;
+    
+    int a = critical_alpha_index(alpha);
+    if (a < 0) {
+        double params[1] = {(double)df};
+        return distribution_quantile(DIST_CHI_SQUARE, params, 1, 1.0 - alpha);
     }
-    if (df == 2) {
-        for (int i = 0; i < 5; i++) {
-            if (fabs(alpha - essential_critical_values.alpha_levels[i]) < 1e-6) {
-                return essential_critical_values.chi_square_2df[i];
-            }
-        }
+    if (df <= CRITICAL_TABLE_MAX_DF) {
+        return chi_square_critical_table[CRITICAL_INDEX(df - 1, a)];
     }
     
-    // Use approximation for other cases
-    return chi_square_critical_approximation(df, alpha);
+    int row;
+    double x = (double)df;
+    double weight = critical_large_df_position(x, &row);
+    double low_df = critical_table_df[row];
+    double w_low = chi_square_normalized(chi_square_critical_table[CRITICAL_INDEX(row, a)], low_df);
+    if (weight == 0.0) return chi_square_critical_table[CRITICAL_INDEX(row, a)];
+    
+    double high_df = critical_table_df[row + 1];
+    double high_value = chi_square_critical_table[CRITICAL_INDEX(row + 1, a)];
+    double w_high = high_df == 0.0 ? high_value : chi_square_normalized(high_value, high_df);
+    
+    return chi_square_from_normalized(w_low + weight * (w_high - w_low), x);
 }
 
 /**
@@ -161,27 +349,29 @@ double chi_square_critical_approximation(int df, double alpha) {
 }
 
 /**
- * t-distribution critical value approximation
+ * Two-sided t critical value
+ * Exact table entries for df <= CRITICAL_TABLE_MAX_DF at the standard alpha
+ * levels; larger df interpolate in 1/df between anchors down to z at df = ∞.
+ * Other alpha levels go to the quantile engine.
  */
 double fast_t_critical(int df, double alpha) {
-    // Check essential table first for common cases
-    if (df == 1) {
-        for (int i = 0; i < 5; i++) {
-            if (fabs(alpha - essential_critical_values.alpha_levels[i]) < 1e-6) {
-                return essential_critical_values.t_1df[i];
-            }
-        }
+    if (df <= 0 || alpha <= 0.0 || alpha >= 1.0) return NAN;
+    
+    int a = critical_alpha_index(alpha);
+    if (a < 0) {
+        double params[1] = {(double)df};
+        return distribution_quantile(DIST_T_DISTRIBUTION, params, 1, 1.0 - alpha / 2.0);
     }
-    if (df == 2) {
-        for (int i = 0; i < 5; i++) {
-            if (fabs(alpha - essential_critical_values.alpha_levels[i]) < 1e-6) {
-                return essential_critical_values.t_2df[i];
-            }
-        }
+    if (df <= CRITICAL_TABLE_MAX_DF) {
+        return t_critical_table[CRITICAL_INDEX(df - 1, a)];
     }
     
-    // Use approximation for other cases
-    return t_critical_approximation(df, alpha);
+    int row;
+    double weight = critical_large_df_position((double)df, &row);
+    double low = t_critical_table[CRITICAL_INDEX(row, a)];
+    if (weight == 0.0) return low;
+    
+    return low + weight * (t_critical_table[CRITICAL_INDEX(row + 1, a)] - low);
 }
 
 /**
@@ -254,4 +444,25 @@ double rational_approximation(double t) {
     
     return t - ((c[2] * t + c[1]) * t + c[0]) / 
                (((d[2] * t + d[1]) * t + d[0]) * t + 1.0);
-}
\ No newline at end of file
+}
+
+/**
+ * Bring native memory back under the budget limit, if one is set
+ */
+void optimize_memory_usage(void) {
+    cache_budget_enforce();
+}
+
+/**
+ * Native memory in use across every budget account, in bytes
+ */
+size_t get_current_memory_usage(void) {
+    return cache_budget_usage();
+}
+
+/**
+ * Drop every memoised calculation result the budget can reach
+ */
+void cleanup_calculation_cache(void) {
+    cache_budget_trim_class(CACHE_BUDGET_CLASS_RESULTS, SIZE_MAX);
+}
@@ -48,6 +48,15 @@ double rational_chebyshev_approximation(double x, const double* coeffs, int n);
 double inverse_normal_cdf_beasley_springer(double p);
 double error_function_abramowitz_stegun(double x);
 
+// Table-assisted fast paths and the approximations they fall back to
+double fast_normal_cdf(double z);
+double normal_cdf_approximation(double z);
+double fast_chi_square_critical(int df, double alpha);
+double chi_square_critical_approximation(int df, double alpha);
+double fast_t_critical(int df, double alpha);
+double t_critical_approximation(int df, double alpha);
+double inverse_normal_cdf(double p);
+
 // Utility functions for efficient computation
 double fast_exp_approximation(double x);
 double fast_log_approximation(double x);
@@ -74,12 +83,52 @@ typedef struct {
     int failed_calculations;
 } performance_metrics_t;
 
+// Benchmark defaults
+#define STAT_BENCHMARK_DEFAULT_POINTS 1001
+#define STAT_BENCHMARK_ERROR_THRESHOLD 1e-6
+
+// Nominal core clock used to convert ns to cycles; 0 leaves cpu_cycles unset
+#ifndef STAT_BENCHMARK_CPU_MHZ
+#define STAT_BENCHMARK_CPU_MHZ 0
+#endif
+
+// Per-call budget checked by validate_performance_requirements (one 60 Hz frame)
+#define STAT_PERFORMANCE_MAX_AVG_TIME_NS 16000000.0
+
 // Comprehensive performance benchmarking
 benchmark_result_t benchmark_factorial_approximation(int max_n, int iterations);
 benchmark_result_t benchmark_normal_cdf_approximation(double z_min, double z_max, int iterations);
 benchmark_result_t benchmark_critical_values_approximation(int max_df, int iterations);
 benchmark_result_t benchmark_gamma_approximation(double min_val, double max_val, int iterations);
 
+// Grid benchmarking of an arbitrary kernel against a long double reference
+typedef double (*benchmark_kernel_t)(double x, const void* context);
+typedef long double (*benchmark_reference_t)(double x, const void* context);
+
+typedef struct {
+    double min_value;
+    double max_value;
+    int points;              // evenly spaced grid points, including both ends
+    int iterations;          // timed sweeps over the grid
+    double error_threshold;  // max error for passed_accuracy_threshold
+} benchmark_grid_t;
+
+// Errors are absolute below 1 and relative above, i.e. |v - ref| / max(1, |ref|)
+benchmark_result_t benchmark_kernel_on_grid(benchmark_kernel_t kernel, benchmark_reference_t reference,
+                                            const void* context, const benchmark_grid_t* grid,
+                                            performance_metrics_t* metrics);
+
+// Same measurement for a batch kernel that fills count outputs per call
+typedef void (*benchmark_batch_kernel_t)(const double* x, double* out, size_t count, const void* context);
+
+benchmark_result_t benchmark_batch_kernel_on_grid(benchmark_batch_kernel_t kernel, benchmark_reference_t reference,
+                                                  const void* context, const benchmark_grid_t* grid,
+                                                  performance_metrics_t* metrics);
+
+// High-precision references shared by the benchmarks
+long double benchmark_reference_gamma_p(long double a, long double x);
+long double benchmark_reference_beta_i(long double a, long double b, long double x);
+
 // Real-time performance monitoring
 performance_metrics_t monitor_calculation_performance(void (*calc_function)(void), int iterations);
 double measure_cpu_utilization_during_calculation(void (*calc_function)(void));
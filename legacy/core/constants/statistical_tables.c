@@ -0,0 +1,2219 @@
+// Generated by generate_statistical_tables.c - do not edit
+
+#include "statistical_tables.h"
+
+// Φ(-z) for z = i / NORMAL_TABLE_STEPS_PER_UNIT
+const double normal_cdf_table[NORMAL_TABLE_SIZE] = {
+    5.00000000000000000e-01, 4.93766780500110303e-01, 4.87535082565622890e-01, 4.81306426647761465e-01,
+    4.75082330970752753e-01, 4.68864310421724495e-01, 4.62653875444673290e-01, 4.56452530939848500e-01,
+    4.50261775169887080e-01, 4.44083098674026566e-01, 4.37917983191705162e-01, 4.31767900596846166e-01,
+    4.25634311844102831e-01, 4.19518665928320100e-01, 4.13422398858449058e-01, 4.07346932647122573e-01,
+    4.01293674317076299e-01, 3.95264014925570561e-01, 3.89259328607937272e-01, 3.83280971641345336e-01,
+    3.77330281529842937e-01, 3.71408576111700750e-01, 3.65517152690042701e-01, 3.59657287187711283e-01,
+    3.53830233327276200e-01, 3.48037221837052324e-01, 3.42279459683950904e-01, 3.36558129333944356e-01,
+    3.30874388040879208e-01, 3.25229367164327376e-01, 3.19624171517117639e-01, 3.14059878743142340e-01,
+    3.08537538725986882e-01, 3.03058173028879219e-01, 2.97622774366407883e-01, 2.92232306108408280e-01,
+    2.86887701816365193e-01, 2.81589864812630764e-01, 2.76339667782705911e-01, 2.71137952410783478e-01,
+    2.65985529048700542e-01, 2.60883176418397755e-01, 2.55831641347933902e-01, 2.50831638541054225e-01,
+    2.45883850380261448e-01, 2.40988926763292782e-01, 2.36147484972854454e-01, 2.31360109579422268e-01,
+    2.26627352376868207e-01, 2.21949732350628620e-01, 2.17327735678085637e-01, 2.12761815760789563e-01,
+    2.08252393288108961e-01, 2.03799856331853019e-01, 1.99404560471372755e-01, 1.95066828948607940e-01,
+    1.90786952852510627e-01, 1.86565191332240671e-01, 1.82401771838494320e-01, 1.78296890392294627e-01,
+    1.74250711880542364e-01, 1.70263370377595397e-01, 1.66334969492118484e-01, 1.62465582738418629e-01,
+    1.58655253931457046e-01, 1.54903997604706800e-01, 1.51211799450003626e-01, 1.47578616778519606e-01,
+    1.44004379001970939e-01, 1.40488988133156800e-01, 1.37032319304911610e-01, 1.33634221306541928e-01,
+    1.30294517136808868e-01, 1.27013004572508192e-01, 1.23789456751694407e-01, 1.20623622770589412e-01,
+    1.17515228293214147e-01, 1.14463976172779092e-01, 1.11469547083870538e-01, 1.08531600164470970e-01,
+    1.05649773666855254e-01, 1.02823685616409505e-01, 1.00052934477425859e-01, 9.73370998249343533e-02,
+    9.46757430216425833e-02, 9.20684078990644528e-02, 8.95146214419316466e-02, 8.70138944749947602e-02,
+    8.45657223513357204e-02, 8.21695856413288406e-02, 7.98249508214052411e-02, 7.75312709617927698e-02,
+    7.52879864124234022e-02, 7.30945254862192806e-02, 7.09503051389902967e-02, 6.88547316451973562e-02,
+    6.68072012688580713e-02, 6.48071009288952310e-02, 6.28538088582518695e-02, 6.09466952561215497e-02,
+    5.90851229326675442e-02, 5.72684479456299148e-02, 5.54960202282456586e-02, 5.37671842079332427e-02,
+    5.20812794152195474e-02, 5.04376410824139212e-02, 4.88356007315612281e-02, 4.72744867512327471e-02,
+    4.57536249617411100e-02, 4.42723391683925785e-02, 4.28299517024171156e-02, 4.14257839492439550e-02,
+    4.00591568638170928e-02, 3.87293914726719590e-02, 3.74358093625212079e-02, 3.61777331551233969e-02,
+    3.49544869682347423e-02, 3.37653968624692311e-02, 3.26097912739178458e-02, 3.14870014324020661e-02,
+    3.03963617652613753e-02, 2.93372102865978521e-02, 2.83088889719243647e-02, 2.73107441181853934e-02,
+    2.63421266891414596e-02, 2.54023926461296422e-02, 2.44909032642332755e-02, 2.36070254339140542e-02,
+    2.27501319481792086e-02, 2.19196017753749070e-02, 2.11148203177152841e-02, 2.03351796556734341e-02,
+    1.95800787783774570e-02, 1.88489238001701628e-02, 1.81411281635062774e-02, 1.74561128283749097e-02,
+    1.67933064484488137e-02, 1.61521455341744474e-02, 1.55320746030288490e-02, 1.49325463171804795e-02,
+    1.43530216088016555e-02, 1.37929697932896861e-02, 1.32518686706629002e-02, 1.27292046154057550e-02,
+    1.22244726550447026e-02, 1.17371765377431835e-02, 1.12668287892100632e-02, 1.08129507592211530e-02,
+    1.03750726580580047e-02, 9.95273358317214259e-03, 9.54548153638615574e-03, 9.15287343194568295e-03,
+    8.77447509573836201e-03, 8.40986125599725749e-03, 8.05861552580703494e-03, 7.72033037773148332e-03,
+    7.39460711088069707e-03, 7.08105581073539044e-03, 6.77929530204456066e-03, 6.48895309511090222e-03,
+    6.20966532577613486e-03, 5.94107668941572589e-03, 5.68284036924937043e-03, 5.43461795927012350e-03,
+    5.19607938209116441e-03, 4.96690280200498806e-03, 4.74677453354523885e-03, 4.53538894583654408e-03,
+    4.33244836301255841e-03, 4.13766296097700052e-03, 3.95075066077680854e-03, 3.77143701885065833e-03,
+    3.59945511440996728e-03, 3.43454543420326558e-03, 3.27645575490834434e-03, 3.12494102339000912e-03,
+    2.97976323505455684e-03, 2.84069131052525417e-03, 2.70750097085618261e-03, 2.57997461149482186e-03,
+    2.45790117519668764e-03, 2.34107602408824104e-03, 2.22930081106717526e-03, 2.12238335072203457e-03,
+    2.02013748994600171e-03, 1.92238297841255826e-03, 1.82894533907364655e-03, 1.73965573883389803e-03,
+    1.65435085954750735e-03, 1.57287276947738947e-03, 1.49506879534940245e-03, 1.42079139512763701e-03,
+    1.34989803163009458e-03, 1.28225104709748920e-03, 1.21771753882143809e-03, 1.15616923593194680e-03,
+    1.09748237743786470e-03, 1.04153759160787959e-03, 9.88219776773658449e-04, 9.37417983630904768e-04,
+    8.89025299108432026e-04, 8.42938731869810631e-04, 7.99059099506770846e-04, 7.57290917478318126e-04,
+    7.17542289844450682e-04, 6.79724801838465565e-04, 6.43753414317093384e-04, 6.09546360123123577e-04,
+    5.77025042390767002e-04, 5.46113934819748067e-04, 5.16740483940035522e-04, 4.88835013385196995e-04,
+    4.62330630188604317e-04, 4.37163133113121073e-04, 4.13270923021469240e-04, 3.90594915291198866e-04,
+    3.69078454275067330e-04, 3.48667229804676090e-04, 3.29309195732407293e-04, 3.10954490504045914e-04,
+    2.93555359751971083e-04, 2.77066080896436163e-04, 2.61442889740243797e-04, 2.46643909040041704e-04,
+    2.32629079035525044e-04, 2.19360089916023263e-04, 2.06800316202268916e-04, 1.94914753019593564e-04,
+    1.83669954237363734e-04, 1.73033972448157706e-04, 1.62976300758983615e-04, 1.53467816365752247e-04,
+    1.44480725881235761e-04, 1.35988512385864314e-04, 1.27965884169932892e-04, 1.20388725135105255e-04,
+    1.13234046822507169e-04, 1.06479942034194732e-04, 1.00105540014358891e-04, 9.40909631562833281e-05,
+    8.84172852008038683e-05, 8.30664908918206081e-05, 7.80214370542855481e-05, 7.32658150600245292e-05,
+    6.87841146467492041e-05, 6.45615890556700803e-05, 6.05842214532302056e-05, 5.68386926026393576e-05,
+    5.33123497510963441e-05, 4.99931766988389719e-05, 4.68697650164552149e-05, 4.39312863772211890e-05,
+    4.11674659715993534e-05, 3.85685569714310875e-05, 3.61253160117886132e-05, 3.38289796589094234e-05,
+    3.16712418331199243e-05, 2.96442321561608211e-05, 2.77404951928533113e-05, 2.59529705575892107e-05,
+    2.42749738566888484e-05, 2.27001784382446518e-05, 2.12225979216547618e-05, 1.98365694796474337e-05,
+    1.85367378462019938e-05, 1.73180400243836174e-05, 1.61756906687261736e-05, 1.51051681174178076e-05,
+    1.41022010501668016e-05, 1.31627557482489688e-05, 1.22830239338614514e-05, 1.14594111665297446e-05,
+    1.06885257749344204e-05, 9.96716830314000263e-06, 9.29232145082002154e-06, 8.66114048767848438e-06,
+    8.07094412286807648e-06, 7.51920581079857975e-06, 7.00354547531467936e-06, 6.52172163479969744e-06,
+    6.07162391133059912e-06, 5.65126590756903811e-06, 5.25877843562301578e-06, 4.89240308265341552e-06,
+    4.55048609852892217e-06, 4.23147259135130549e-06, 3.93390101718053949e-06, 3.65639795078540561e-06,
+    3.39767312473006025e-06, 3.15651472458020467e-06, 2.93178492847404156e-06, 2.72241567975291170e-06,
+    2.52740468178442120e-06, 2.34581160453691365e-06, 2.17675449287836358e-06, 2.01940636697513747e-06,
+    1.87299200555670945e-06, 1.73678490319134561e-06, 1.61010439308509145e-06, 1.49231292727226125e-06,
+    1.38281350641009184e-06, 1.28104725172350196e-06, 1.18649111196809665e-06, 1.09865569859087597e-06,
+    1.01708324256870317e-06, 9.41345666694677816e-07, 8.71042767362315195e-07, 8.05800500167081686e-07,
+    7.45269363904583457e-07, 6.89122877794768870e-07, 6.37056147002111614e-07, 5.88784511753122948e-07,
+    5.44042275574916347e-07, 5.02581508392168216e-07, 4.64170920424898258e-07, 4.28594803026288787e-07,
+    3.95652032788493956e-07, 3.65155135425303875e-07, 3.36929406113853883e-07, 3.10812083143544874e-07,
+    2.86651571879193912e-07, 2.64306716197400143e-07, 2.43646114700411412e-07, 2.24547479150643429e-07,
+    2.06897032701649734e-07, 1.90588945627991232e-07, 1.75524806377319630e-07, 1.61613125883280540e-07,
+    1.48768873187766283e-07, 1.36913040525806279e-07, 1.25972236126172513e-07, 1.15878303075791477e-07,
+    1.06567962686479493e-07, 9.79824808885407953e-08, 9.00673562575625520e-08, 8.27720283584853510e-08,
+    7.60496051648871451e-08, 6.98566083815588775e-08, 6.41527355650294975e-08, 5.89006379998701885e-08,
+    5.40657133485222812e-08, 4.96159121491941044e-08, 4.55215572901987188e-08, 4.17551756400915273e-08,
+    3.82913410612442819e-08, 3.51065280801853266e-08, 3.21789755312655646e-08, 2.94885595310926542e-08,
+    2.70166751798230684e-08, 2.47461264219220193e-08, 2.26610235334969100e-08, 2.07466877358812505e-08,
+    1.89895624658877179e-08, 1.73771308621528848e-08, 1.58978390543495773e-08, 1.45410248678300003e-08,
+    1.32968515805638899e-08, 1.21562463921279163e-08, 1.11108432860589998e-08, 1.01529299871752305e-08,
+    9.27539873456082199e-09, 8.47170060887001839e-09, 7.73580316949026438e-09, 7.06215117297525834e-09,
+    6.44563015906951000e-09, 5.88153270465032099e-09, 5.36552715906113464e-09, 4.89362868664976874e-09,
+    4.46217245390161166e-09, 4.06778880941477131e-09, 3.70738031514235730e-09, 3.37810049686563265e-09,
+    3.07733419079767758e-09, 2.80267937158549138e-09, 2.55193035481248800e-09, 2.32306227443452107e-09,
+    2.11421674244084716e-09, 1.92368860444498610e-09, 1.74991371090604442e-09, 1.59145762928397198e-09,
+    1.44700522766635681e-09, 1.31535106529226762e-09, 1.19539052996167365e-09, 1.08611166657723135e-09,
+    9.86587645037698091e-10, 8.95969819406841483e-10, 8.13481333735334024e-10, 7.38411233131663547e-10,
+    6.70109041676529396e-10, 6.07979771567645723e-10, 5.51479330481603842e-10, 5.00110296558936236e-10,
+    4.53418032669528438e-10, 4.10987113709057335e-10, 3.72438042623571710e-10, 3.37424232668402334e-10,
+    3.05629235088426603e-10, 2.76764192967893934e-10, 2.50565503447577699e-10, 2.26792671852495361e-10,
+    2.05226342521893885e-10, 1.85666492291248208e-10, 1.67930773649858585e-10, 1.51852995593062212e-10,
+    1.37281731110513230e-10, 1.24079041106513884e-10, 1.12119305339734415e-10, 1.01288151702280352e-10,
+    9.14814758360860992e-11, 8.26045437119065414e-11, 7.45711703763479573e-11, 6.73029686087960617e-11,
+    6.07286617259023915e-11, 5.47834552294089993e-11, 4.94084624162552734e-11, 4.45501794606615333e-11,
+    4.01600058385911779e-11, 3.61938062978597315e-11, 3.26115108842378222e-11, 2.93767498170937236e-11,
+    2.64565202692144922e-11, 2.38208823460828817e-11, 2.14426817816025365e-11, 1.92972970714810009e-11,
+    1.73624089535205695e-11, 1.56177903171585120e-11, 1.40451147838793825e-11, 1.26277823466491966e-11,
+    1.13507605912738354e-11, 1.02004401464694556e-11, 9.16450312329253903e-12, 8.23180340919006795e-12,
+    7.39225777801782162e-12, 6.63674686560426644e-12, 5.95702514142689469e-12, 5.34563908128829497e-12,
+    4.79585281405897819e-12, 4.30158057808132802e-12, 3.85732538015499265e-12, 3.45812330256526772e-12,
+    3.09949295175721540e-12, 2.77738958635449329e-12, 2.48816350260069156e-12, 2.22852229226460151e-12,
+    1.99549662187784898e-12, 1.78640921312052219e-12, 1.59884673247442696e-12, 1.43063432414234175e-12,
+    1.27981254388583496e-12, 1.14461647304853554e-12, 1.02345681177620156e-12, 9.14902768475883182e-13,
+    8.17666579017660493e-13, 7.30589504206051992e-13, 6.52629167755666847e-13, 5.82848109508576446e-13,
+    5.20403440031678100e-13, 4.64537493125053965e-13, 4.14569382243317663e-13, 3.69887375460374429e-13,
+    3.29942011466515480e-13, 2.94239886241919733e-13, 2.62338046563452251e-13, 2.33838932428053301e-13,
+    2.08385815867206946e-13, 1.85658688529851614e-13, 1.65370554868568340e-13, 1.47264091815221125e-13,
+    1.31108639513353072e-13, 1.16697491018408152e-13, 1.03845451913278658e-13, 9.23866435432151254e-14,
+    8.21725260758433764e-14, 7.30701198618103271e-14, 6.49604056303237481e-14, 5.77368859206394641e-14,
+    5.13042918427866892e-14, 4.55774207943821401e-14, 4.04800921497419469e-14, 3.59442091958504296e-14,
+    3.19089167291089635e-14, 2.83198447581186447e-14, 2.51284296910203944e-14, 2.22913052302048220e-14,
+    1.97697559607748542e-14, 1.75292273095141602e-14, 1.55388861751212750e-14, 1.37712270943297428e-14,
+    1.22017193178992341e-14, 1.08084906304657487e-14, 9.57204416354512994e-15, 8.47500482582825955e-15,
+    7.50189231313361237e-15, 6.63891796548285129e-15, 5.87380301390340560e-15, 5.19561600761004938e-15,
+    4.59462743577859540e-15, 4.06217975955876654e-15, 3.59057125141832937e-15, 3.17295220230363439e-15,
+    2.80323220419683349e-15, 2.47599734803524181e-15, 2.18643629607068024e-15, 1.93027429488644793e-15,
+    1.70371429163287329e-15, 1.50338440265256410e-15, 1.32629106150472290e-15, 1.16977724333282072e-15,
+    1.03148522533621705e-15, 9.09323399512584276e-16, 8.01436704474057919e-16, 7.06180288583302071e-16,
+    6.22096057427178387e-16
+};
+
+// φ(z) for z = i / NORMAL_TABLE_STEPS_PER_UNIT
+const double normal_pdf_table[NORMAL_TABLE_SIZE] = {
+    3.98942280401432703e-01, 3.98893584364825304e-01, 3.98747531915966680e-01, 3.98504229994225911e-01,
+    3.98163856686886586e-01, 3.97726661011910232e-01, 3.97192962614323797e-01, 3.96563151376750855e-01,
+    3.95837686944749467e-01, 3.95017098167767033e-01, 3.94101982456662336e-01, 3.93093005058889333e-01,
+    3.91990898252571884e-01, 3.90796460460837547e-01, 3.89510555287908955e-01, 3.88134110478582650e-01,
+    3.86668116802849182e-01, 3.85113626867532866e-01, 3.83471753856944542e-01, 3.81743670204658159e-01,
+    3.79930606198627729e-01, 3.78033848521967752e-01, 3.76054738731819327e-01, 3.73994671678817947e-01,
+    3.71855093869768893e-01, 3.69637501776218069e-01, 3.67343440091685791e-01, 3.64974499940401653e-01,
+    3.62532317040445196e-01, 3.60018569824256840e-01, 3.57434977519537289e-01, 3.54783298193602381e-01,
+    3.52065326764299469e-01, 3.49282892980628867e-01, 3.46437859376240442e-01, 3.43532119198999508e-01,
+    3.40567594319830691e-01, 3.37546233124058292e-01, 3.34470008388465745e-01, 3.31340915147291970e-01,
+    3.28160968550375021e-01, 3.24932201716635782e-01, 3.21656663586075253e-01, 3.18336416773429387e-01,
+    3.14973535426593287e-01, 3.11570103092886908e-01, 3.08128210596190055e-01, 3.04649953927924433e-01,
+    3.01137432154804430e-01, 2.97592745346219267e-01, 2.94017992524042426e-01, 2.90415269637594842e-01,
+    2.86786667566414466e-01, 2.83134270153404977e-01, 2.79460152270854412e-01, 2.75766377921727091e-01,
+    2.72054998378543522e-01, 2.68328050362066861e-01, 2.64587554261921098e-01, 2.60835512401163594e-01,
+    2.57073907346734687e-01, 2.53304700267601768e-01, 2.49529829342308301e-01, 2.45751208217531991e-01,
+    2.41970724519143338e-01, 2.38190238417148037e-01, 2.34411581245781764e-01, 2.30636554179915299e-01,
+    2.26866926968812638e-01, 2.23104436728172539e-01, 2.19350786791269264e-01, 2.15607645619895871e-01,
+    2.11876645775699451e-01, 2.08159382952386673e-01, 2.04457415069165427e-01, 2.00772261425680054e-01,
+    1.97105401918587303e-01, 1.93458276319814410e-01, 1.89832283616434977e-01, 1.86228781411995142e-01,
+    1.82649085389021915e-01, 1.79094468832346837e-01, 1.75566162212781901e-01, 1.72065352830591656e-01,
+    1.68593184518115113e-01, 1.65150757400803316e-01, 1.61739127715854331e-01, 1.58359307687546497e-01,
+    1.55012265458293191e-01, 1.51698925074367885e-01, 1.48420166525177893e-01, 1.45176825834898521e-01,
+    1.41969695205215518e-01, 1.38799523207864622e-01, 1.35667015025601412e-01, 1.32572832740182500e-01,
+    1.29517595665891716e-01, 1.26501880727100391e-01, 1.23526222878310860e-01, 1.20591115565096718e-01,
+    1.17697011224320039e-01, 1.14844321821978124e-01, 1.12033419427007466e-01, 1.09264636819351932e-01,
+    1.06538268130585062e-01, 1.03854569515363176e-01, 1.01213759851976379e-01, 9.86160214702583443e-02,
+    9.60615009051133534e-02, 9.35503096739197376e-02, 9.10825250760733673e-02, 8.86581910129419365e-02,
+    8.62773188265115176e-02, 8.39398881550205839e-02, 8.16458478038929736e-02, 7.93951166303008826e-02,
+    7.71875844397107158e-02, 7.50231128927896229e-02, 7.29015364210772732e-02, 7.08226631498569958e-02,
+    6.87862758266919033e-02, 6.67921327541254467e-02, 6.48399687250812290e-02, 6.29294959595344400e-02,
+    6.10604050410663429e-02, 5.92323658519537527e-02, 5.74450285054876816e-02, 5.56980242742582884e-02,
+    5.39909665131880490e-02, 5.23234515761403021e-02, 5.06950597249766696e-02, 4.91053560299840805e-02,
+    4.75538912606396219e-02, 4.60402027657299401e-02, 4.45638153418902727e-02, 4.31242420896772310e-02,
+    4.17209852563386052e-02, 4.03535370644921634e-02, 3.90213805259750149e-02, 3.77239902401734495e-02,
+    3.64608331761921353e-02, 3.52313694382696274e-02, 3.40350530138949364e-02, 3.28713325041272500e-02,
+    3.17396518356674179e-02, 3.06394509542757612e-02, 2.95701664991759802e-02, 2.85312324581290348e-02,
+    2.75220808029044660e-02, 2.65421421049188387e-02, 2.55908461308523814e-02, 2.46676224180952565e-02,
+    2.37719008299138029e-02, 2.29031120902652777e-02, 2.20606882982261367e-02, 2.12440634220344877e-02,
+    2.04526737727813955e-02, 1.96859584578187308e-02, 1.89433598139826034e-02, 1.82243238207616919e-02,
+    1.75283004935685369e-02, 1.68547442572992631e-02, 1.62031143003932253e-02, 1.55728749096286975e-02,
+    1.49634957859139453e-02, 1.43744523413548968e-02, 1.38052259779010370e-02, 1.32553043478903058e-02,
+    1.27241815968314326e-02, 1.22113585887785887e-02, 1.17163431146682546e-02, 1.12386500840019384e-02,
+    1.07778017002709038e-02, 1.03333276205301652e-02, 9.90476509953910726e-03, 9.49165911889470262e-03,
+    9.09356250159105289e-03, 8.71003601244526443e-03, 8.34064844483515568e-03, 7.98497669419844999e-03,
+    7.64260581874640164e-03, 7.31312908784699164e-03, 6.99614801853411239e-03, 6.69127240059949439e-03,
+    6.39812031072355646e-03, 6.11631811609999500e-03, 5.84550046800669416e-03, 5.58531028577257706e-03,
+    5.33539873158631484e-03, 5.09542517658841468e-03, 4.86505715868317239e-03, 4.64397033250132235e-03,
+    4.43184841193800753e-03, 4.22838310568393605e-03, 4.03327404616035494e-03, 3.84622871226076657e-03,
+    3.66696234629422611e-03, 3.49519786551652761e-03, 3.33066576862678636e-03, 3.17310403759774907e-03,
+    3.02225803519875613e-03, 2.87788039856060615e-03, 2.73973092912169680e-03, 2.60757647928475935e-03,
+    2.48119083610329975e-03, 2.36035460230652611e-03, 2.24485507496112804e-03, 2.13448612205778673e-03,
+    2.02904805729976767e-03, 1.92834751336040493e-03, 1.83219731386575395e-03, 1.74041634434818869e-03,
+    1.65282942240625795e-03, 1.56926716729574329e-03, 1.48956586916655707e-03, 1.41356735814994364e-03,
+    1.34111887349037755e-03, 1.27207293290663125e-03, 1.20628720235671266e-03, 1.14362436637177318e-03,
+    1.08395199911465179e-03, 1.02714243630949286e-03, 9.73072648179830078e-04, 9.21624113523703253e-04,
+    8.72682695045760046e-04, 8.26138516057903683e-04, 7.81885838651886936e-04, 7.39822943439329053e-04,
+    6.99852010946942727e-04, 6.61879004747318515e-04, 6.25813556398412824e-04, 5.91568852257939241e-04,
+    5.59061522232164867e-04, 5.28211530512158185e-04, 4.98942068344345856e-04, 4.71179448876278063e-04,
+    4.44853004112810290e-04, 4.19894984012454773e-04, 3.96240457748448698e-04, 3.73827217154124459e-04,
+    3.52595682367445407e-04, 3.32488809685081222e-04, 3.13452001632148606e-04, 2.95433019249714346e-04,
+    2.78381896598362086e-04, 2.62250857472541544e-04, 2.46994234317055939e-04, 2.32568389333887720e-04,
+    2.18931637764612099e-04, 2.06044173330896410e-04, 1.93867995813025050e-04, 1.82366840744018155e-04,
+    1.71506111194723494e-04, 1.61252811623246198e-04, 1.51575483760237121e-04, 1.42444144499878948e-04,
+    1.33830225764885341e-04, 1.25706516312455686e-04, 1.18047105446899669e-04, 1.10827328603557370e-04,
+    1.04023714767683900e-04, 9.76139356911383423e-05, 9.15767568690081059e-05, 8.58919902377061319e-05,
+    8.05404485555941417e-05, 7.55039014268039542e-05, 7.07650329286463049e-05, 6.63074008028055774e-05,
+    6.21153971704161681e-05, 5.81742107310941574e-05, 5.44697904060538230e-05, 5.09888103855653618e-05,
+    4.77186365412049450e-05, 4.46472941636046498e-05, 4.17634369867246578e-05, 3.90563174600381971e-05,
+    3.65157582304372771e-05, 3.41321247961300927e-05, 3.18962992953049509e-05, 2.97996553928776611e-05,
+    2.78340342292148789e-05, 2.59917213953323888e-05, 2.42654248997011396e-05, 2.26482540924515105e-05,
+    2.11336995134454750e-05, 1.97156136313836989e-05, 1.83881924418276210e-05, 1.71459578927426539e-05,
+    1.59837411069054746e-05, 1.48966663712635493e-05, 1.38801358640864346e-05, 1.29298150915041007e-05,
+    1.20416190057854946e-05, 1.12116987784691819e-05, 1.04364292022153806e-05, 9.71239669600365521e-06,
+    9.03638788905137171e-06, 8.40537875957359944e-06, 7.81652430524411914e-06, 7.26714872294850811e-06,
+    6.75473607614295618e-06, 6.27692142884543651e-06, 5.83148242598851717e-06, 5.41633130055441415e-06,
+    5.02950728859244539e-06, 4.66916943388603764e-06, 4.33358976469047334e-06, 4.02114682560310975e-06,
+    3.73031954825449345e-06, 3.45968144512127778e-06, 3.20789511135986404e-06, 2.97370702014299489e-06,
+    2.75594259754997213e-06, 2.55350156361460080e-06, 2.36535352667332684e-06, 2.19053381867926970e-06,
+    2.02813955965596406e-06, 1.87732593995766961e-06, 1.73730270948109402e-06, 1.60733086343648083e-06,
+    1.48671951473429768e-06, 1.37482294347739884e-06, 1.27103781446771544e-06, 1.17480055404141849e-06,
+    1.08558487793732721e-06, 1.00289946228034177e-06, 9.26285750125084750e-07, 8.55315886355027207e-07,
+    7.89590774069399335e-07, 7.28738245914448232e-07, 6.72411344127366520e-07, 6.20286703360802534e-07,
+    5.72063030643556398e-07, 5.27459677109181044e-07, 4.86215296389059284e-07, 4.48086584820418200e-07,
+    4.12847098862999838e-07, 3.80286145351032176e-07, 3.50207740430065062e-07, 3.22429633241456219e-07,
+    2.96782390621128548e-07, 2.73108539273979989e-07, 2.51261762071318772e-07, 2.31106145296216449e-07,
+    2.12515473831028805e-07, 1.95372571442808302e-07, 1.79568683476225534e-07, 1.65002899410202720e-07,
+    1.51581612874024482e-07, 1.39218016851498136e-07, 1.27831631928055263e-07, 1.17347865555775983e-07,
+    1.07697600425432761e-07, 9.88168101430342613e-08, 9.06462005112459134e-08, 8.31308748137012591e-08,
+    7.62200215928260252e-08, 6.98666234995922168e-08, 6.40271858768168666e-08, 5.86614838164232975e-08,
+    5.37323265056914998e-08, 4.92053377481314028e-08, 4.50487516114019656e-08, 4.12332222178512697e-08,
+    3.77316467529388526e-08, 3.45190008231884665e-08, 3.15721853485663886e-08, 2.88698842244415188e-08,
+    2.63924320357057320e-08, 2.41216911503584298e-08, 2.20409375620237860e-08, 2.01347548906028123e-08,
+    1.83889359876902120e-08, 1.67903916286273769e-08, 1.53270658062321012e-08, 1.39878571724519789e-08,
+    1.27625462035364411e-08, 1.16417276919115171e-08, 1.06167481938671531e-08, 9.67964808651949544e-09,
+    8.82310791037702080e-09, 8.04039869530155877e-09, 7.32533598779196541e-09, 6.67223731640372740e-09,
+    6.07588284982328526e-09, 5.53147901870854296e-09, 5.03462488795109409e-09, 4.58128108057175011e-09,
+    4.16774106808677129e-09, 3.79060465493234518e-09, 3.44675349646127439e-09, 3.13332850117741417e-09,
+    2.84770897829682094e-09, 2.58749340146359432e-09, 2.35048166854476031e-09, 2.13465874592145588e-09,
+    1.93817959362030904e-09, 1.75935527502435174e-09, 1.59664016180010990e-09, 1.44862015110796413e-09,
+    1.31400181815588380e-09, 1.19160243273997433e-09, 1.08034077361509353e-09, 9.79228679379705791e-10,
+    8.87363279064327263e-10, 8.03919849804180815e-10, 7.28145252874524437e-10, 6.59351902990804152e-10,
+    5.96912229143432211e-10, 5.40253588365588342e-10, 4.88853596737956626e-10, 4.42235844631706997e-10,
+    3.99965965694356997e-10, 3.61648031405565304e-10, 3.26921245183749754e-10, 2.95456912021239679e-10,
+    2.66955661476285192e-10, 2.41144903564770023e-10, 2.17776498682383297e-10, 1.96624624158147261e-10,
+    1.77483821400852390e-10, 1.60167208858841304e-10, 1.44504847177936869e-10, 1.30342244018857794e-10,
+    1.17538986990502964e-10, 1.05967494074874022e-10, 9.55118717686155297e-11, 8.60668719502797085e-11,
+    7.75369392062159797e-11, 6.98353410158671273e-11, 6.28833738133392788e-11, 5.66096385102326703e-11,
+    5.09493795884368355e-11, 4.58438823542201984e-11, 4.12399233895589569e-11, 3.70892696461132412e-11,
+    3.33482220042278180e-11, 2.99771994662748109e-11, 2.69403604728568994e-11, 2.42052581239735867e-11,
+    2.17425263571896666e-11, 1.95255943829588086e-11, 1.75304269052371299e-11, 1.57352878649385564e-11,
+    1.41205256360854797e-11, 1.26683777810376734e-11, 1.13627936331813005e-11, 1.01892731240770915e-11,
+    9.13472040836459364e-12, 8.18731096467920200e-12, 7.33637096536774059e-12, 6.57226781272392903e-12,
+    5.88631083558074738e-12, 5.27066122810596180e-12, 4.71825039320842050e-12, 4.22270592668329716e-12,
+    3.77828454566409021e-12, 3.37981132662371381e-12, 3.02262467455172160e-12, 2.70252649646724347e-12,
+    2.41573709951054122e-12, 2.15885437686093821e-12, 1.92881688399645963e-12, 1.72287044365446383e-12,
+    1.53853795056127502e-12, 1.37359207683740603e-12, 1.22603060619680752e-12, 1.09405414986736246e-12,
+    9.76046019770804278e-13, 8.70554055101776355e-13, 7.76274217210714214e-13, 6.92035784782104772e-13,
+    6.16787996853805713e-13, 5.49588005377649837e-13, 4.89590011898548660e-13, 4.36035474640490959e-13,
+    3.88244282935522031e-13, 3.45606805609632002e-13, 3.07576728733153715e-13, 2.73664606131140043e-13,
+    2.43432053302900960e-13, 2.16486521984932910e-13, 1.92476598567696592e-13, 1.71087774998762520e-13,
+    1.52038645722649562e-13, 1.35077488666794703e-13, 1.19979192325081783e-13, 1.06542494653148341e-13,
+    9.45875028078652200e-14, 8.39534657684713112e-14, 7.44967745975744402e-14, 6.60891675627755068e-14,
+    5.86161195678728240e-14, 5.19753973581608609e-14, 4.60757637870038795e-14, 4.08358160786124395e-14,
+    3.61829445111251730e-14, 3.20523992895619314e-14, 2.83864545934780266e-14, 2.51336598814871668e-14,
+    2.22481695253855831e-14, 1.96891427405265416e-14, 1.74202065855563928e-14, 1.54089755319727334e-14,
+    1.36266217597700488e-14, 1.20474909265632631e-14, 1.06487586902471518e-14, 9.41012374510111153e-15,
+    8.31353356339409393e-15, 7.34293942361358353e-15, 6.48407765662649695e-15, 5.72427435617369115e-15,
+    5.05227108353689194e-15
+};
+
+// log(n!)
+const double log_factorial_table[LOG_FACTORIAL_TABLE_SIZE] = {
+    0.00000000000000000e+00, 0.00000000000000000e+00, 6.93147180559945286e-01, 1.79175946922805496e+00,
+    3.17805383034794575e+00, 4.78749174278204581e+00, 6.57925121201010121e+00, 8.52516136106541467e+00,
+    1.06046029027452509e+01, 1.28018274800814691e+01, 1.51044125730755159e+01, 1.75023078458738865e+01,
+    1.99872144956618847e+01, 2.25521638531234245e+01, 2.51912211827386798e+01, 2.78992713838408903e+01,
+    3.06718601060806719e+01, 3.35050734501368908e+01, 3.63954452080330526e+01, 3.93398841871994946e+01,
+    4.23356164607534851e+01, 4.53801388984769076e+01, 4.84711813518352272e+01, 5.16066755677643769e+01,
+    5.47847293981123187e+01, 5.80036052229805179e+01, 6.12617017610020014e+01, 6.45575386270063376e+01,
+    6.78897431371815401e+01, 7.12570389671680147e+01, 7.46582363488301581e+01, 7.80922235533153071e+01,
+    8.15579594561150429e+01, 8.50544670175815156e+01, 8.85808275421976816e+01, 9.21361756036870929e+01,
+    9.57196945421432019e+01, 9.93306124547874276e+01, 1.02968198614513810e+02, 1.06631760260643460e+02,
+    1.10320639714757391e+02, 1.14034211781461707e+02, 1.17771881399745070e+02, 1.21533081515438639e+02,
+    1.25317271149356898e+02, 1.29123933639127216e+02, 1.32952575035616320e+02, 1.36802722637326355e+02,
+    1.40673923648234251e+02, 1.44565743946344895e+02, 1.48477766951773020e+02, 1.52409592584497346e+02,
+    1.56360836303078798e+02, 1.60331128216630901e+02, 1.64320112263195170e+02, 1.68327445448427653e+02,
+    1.72352797139162789e+02, 1.76395848406997345e+02, 1.80456291417543781e+02, 1.84533828861449479e+02,
+    1.88628173423671598e+02, 1.92739047287844897e+02, 1.96866181672890008e+02, 2.01009316399281516e+02,
+    2.05168199482641199e+02, 2.09342586752536846e+02, 2.13532241494563266e+02, 2.17736934113954220e+02,
+    2.21956441819130333e+02, 2.26190548323727597e+02, 2.30439043565776956e+02, 2.34701723442818263e+02,
+    2.38978389561834319e+02, 2.43268849002982705e+02, 2.47572914096186878e+02, 2.51890402209723192e+02,
+    2.56221135550009535e+02, 2.60564940971863223e+02, 2.64921649798552778e+02, 2.69291097651019811e+02,
+    2.73673124285693689e+02, 2.78067573440366118e+02, 2.82474292687630395e+02, 2.86893133295426992e+02,
+    2.91323950094270288e+02, 2.95766601350760652e+02, 3.00220948647014154e+02, 3.04686856765668722e+02,
+    3.09164193580146900e+02, 3.13652829949879049e+02, 3.18152639620209300e+02, 3.22663499126726151e+02,
+    3.27185287703775202e+02, 3.31717887196928473e+02, 3.36261181979198454e+02, 3.40815058870799021e+02,
+    3.45379407062266864e+02, 3.49954118040770254e+02, 3.54539085519440789e+02, 3.59134205369575398e+02,
+    3.63739375555563470e+02, 3.68354496072404743e+02, 3.72979468885689016e+02, 3.77614197873918670e+02,
+    3.82258588773060012e+02, 3.86912549123217559e+02, 3.91575988217329609e+02, 3.96248817051791548e+02,
+    4.00930948278915764e+02, 4.05622296161144902e+02, 4.10322776526937332e+02, 4.15032306728249637e+02,
+    4.19750805599544719e+02, 4.24478193418257092e+02, 4.29214391866651567e+02, 4.33959323995014813e+02,
+    4.38712914186121168e+02, 4.43475088120918940e+02, 4.48245772745384613e+02, 4.53024896238496126e+02,
+    4.57812387981278164e+02, 4.62608178526874894e+02, 4.67412199571608198e+02, 4.72224383926980579e+02,
+    4.77044665492585636e+02, 4.81872979229887960e+02, 4.86709261136839416e+02, 4.91553448223298005e+02,
+    4.96405478487217636e+02, 5.01265290891579298e+02, 5.06132825342034891e+02, 5.11008022665236012e+02,
+    5.15890824587822408e+02, 5.20781173716044123e+02, 5.25679013515995052e+02, 5.30584288294433463e+02,
+    5.35496943180169524e+02, 5.40416924105997623e+02, 5.45344177791154834e+02, 5.50278651724285510e+02,
+    5.55220294146894844e+02, 5.60169054037272986e+02, 5.65124881094874354e+02, 5.70087725725134192e+02,
+    5.75057539024710195e+02, 5.80034272767130801e+02, 5.85017879388839106e+02, 5.90008311975617858e+02,
+    5.95005524249382006e+02, 6.00009470555327425e+02, 6.05020105849423658e+02, 6.10037385686238622e+02,
+    6.15061266207084941e+02, 6.20091704128477318e+02, 6.25128656730890953e+02, 6.30172081847810205e+02,
+    6.35221937855059764e+02, 6.40278183660407990e+02, 6.45340778693435027e+02, 6.50409682895655237e+02,
+    6.55484856710889062e+02, 6.60566261075873513e+02, 6.65653857411105946e+02, 6.70747607611912713e+02,
+    6.75847474039736881e+02, 6.80953419513637414e+02, 6.86065407301994014e+02, 6.91183401114410799e+02,
+    6.96307365093814042e+02, 7.01437263808737043e+02, 7.06573062245787355e+02, 7.11714725802289990e+02,
+    7.16862220279103440e+02, 7.22015511873601213e+02, 7.27174567172815728e+02, 7.32339353146739313e+02,
+    7.37509837141777439e+02, 7.42685986874351215e+02, 7.47867770424643368e+02, 7.53055156230484158e+02,
+    7.58248113081374299e+02, 7.63446610112640087e+02, 7.68650616799716886e+02, 7.73860102952558350e+02,
+    7.79075038710167291e+02, 7.84295394535245691e+02, 7.89521141208958852e+02, 7.94752249825813465e+02,
+    7.99988691788643450e+02, 8.05230438803703009e+02, 8.10477462875863580e+02, 8.15729736303910158e+02,
+    8.20987231675937892e+02, 8.26249921864842804e+02, 8.31517780023906198e+02, 8.36790779582469895e+02,
+    8.42068894241700377e+02, 8.47352097970438422e+02, 8.52640365001132977e+02, 8.57933669825857464e+02,
+    8.63231987192405427e+02, 8.68535292100464517e+02, 8.73843559797865737e+02, 8.79156765776907491e+02,
+    8.84474885770751712e+02, 8.89797895749890131e+02, 8.95125771918679789e+02, 9.00458490711945160e+02,
+    9.05796028791646449e+02, 9.11138363043611207e+02, 9.16485470574328701e+02, 9.21837328707804772e+02,
+    9.27193914982476826e+02, 9.32555207148186241e+02, 9.37921183163208070e+02, 9.43291821191335771e+02,
+    9.48667099599019934e+02, 9.54046996952560335e+02, 9.59431492015349477e+02, 9.64820563745165941e+02,
+    9.70214191291518318e+02, 9.75612353993036095e+02, 9.81015031374908290e+02, 9.86422203146368474e+02,
+    9.91833849198223447e+02, 9.97249949600427954e+02, 1.00267048459970022e+03, 1.00809543461718158e+03,
+    1.01352478024613606e+03, 1.01895850224969024e+03, 1.02439658155861343e+03, 1.02983899926913523e+03,
+    1.03528573664080159e+03, 1.04073677509436720e+03, 1.04619209620972492e+03, 1.05165168172386916e+03,
+    1.05711551352889478e+03, 1.06258357367002986e+03, 1.06805584434370144e+03, 1.07353230789563281e+03,
+    1.07901294681897480e+03, 1.08449774375246557e+03, 1.08998668147862213e+03, 1.09547974292196272e+03,
+    1.10097691114725603e+03, 1.10647816935780065e+03, 1.11198350089373298e+03, 1.11749288923036102e+03,
+    1.12300631797652591e+03, 1.12852377087299078e+03, 1.13404523179085299e+03, 1.13957068472998481e+03,
+    1.14510011381749609e+03, 1.15063350330622370e+03, 1.15617083757324212e+03, 1.16171210111840060e+03,
+    1.16725727856288017e+03, 1.17280635464777538e+03, 1.17835931423269699e+03, 1.18391614229439665e+03,
+    1.18947682392541219e+03, 1.19504134433273475e+03, 1.20060968883649593e+03, 1.20618184286867358e+03,
+    1.21175779197182010e+03, 1.21733752179780618e+03, 1.22292101810658801e+03, 1.22850826676498809e+03,
+    1.23409925374549903e+03, 1.23969396512510093e+03, 1.24529238708409912e+03, 1.25089450590497904e+03,
+    1.25650030797127488e+03, 1.26210977976645995e+03, 1.26772290787284805e+03, 1.27333967897051457e+03,
+    1.27896007983623167e+03, 1.28458409734241900e+03, 1.29021171845610957e+03, 1.29584293023793111e+03,
+    1.30147771984110022e+03, 1.30711607451043392e+03, 1.31275798158137218e+03, 1.31840342847901547e+03,
+    1.32405240271717662e+03, 1.32970489189744512e+03, 1.33536088370826496e+03, 1.34102036592402465e+03,
+    1.34668332640416065e+03, 1.35234975309227298e+03, 1.35801963401525359e+03, 1.36369295728242514e+03,
+    1.36936971108469334e+03, 1.37504988369371040e+03, 1.38073346346104904e+03, 1.38642043881738891e+03,
+    1.39211079827171307e+03, 1.39780453041051578e+03, 1.40350162389702109e+03, 1.40920206747041175e+03,
+    1.41490584994506798e+03, 1.42061296020981695e+03, 1.42632338722719169e+03, 1.43203712003270107e+03,
+    1.43775414773410739e+03, 1.44347445951071472e+03, 1.44919804461266722e+03, 1.45492489236025426e+03,
+    1.46065499214322790e+03, 1.46638833342012572e+03, 1.47212490571760486e+03, 1.47786469862978402e+03,
+    1.48360770181759358e+03, 1.48935390500813378e+03, 1.49510329799404190e+03, 1.50085587063286766e+03,
+    1.50661161284645459e+03, 1.51237051462033173e+03, 1.51813256600311206e+03, 1.52389775710589674e+03,
+    1.52966607810169057e+03, 1.53543751922482056e+03, 1.54121207077036502e+03, 1.54698972309358760e+03,
+    1.55277046660938004e+03, 1.55855429179170983e+03, 1.56434118917307637e+03, 1.57013114934397368e+03,
+    1.57592416295235785e+03, 1.58172022070312323e+03, 1.58751931335758377e+03, 1.59332143173296072e+03,
+    1.59912656670187721e+03, 1.60493470919185779e+03, 1.61074585018483435e+03, 1.61655998071665954e+03,
+    1.62237709187662267e+03, 1.62819717480697500e+03, 1.63402022070245812e+03, 1.63984622080983854e+03,
+    1.64567516642744863e+03, 1.65150704890473230e+03, 1.65734185964179483e+03, 1.66317959008896082e+03,
+    1.66902023174633428e+03, 1.67486377616336563e+03, 1.68071021493842318e+03, 1.68655953971837016e+03,
+    1.69241174219814457e+03, 1.69826681412034714e+03, 1.70412474727483050e+03, 1.70998553349829626e+03,
+    1.71584916467389439e+03, 1.72171563273082779e+03, 1.72758492964396146e+03, 1.73345704743343686e+03,
+    1.73933197816428901e+03, 1.74520971394606863e+03, 1.75109024693246920e+03, 1.75697356932095749e+03,
+    1.76285967335240775e+03, 1.76874855131074059e+03, 1.77464019552256650e+03, 1.78053459835683134e+03,
+    1.78643175222446803e+03, 1.79233164957805047e+03, 1.79823428291145183e+03, 1.80413964475950638e+03,
+    1.81004772769767533e+03, 1.81595852434171593e+03, 1.82187202734735411e+03, 1.82778822940996156e+03,
+    1.83370712326423472e+03, 1.83962870168387849e+03, 1.84555295748129311e+03, 1.85147988350726359e+03,
+    1.85740947265065347e+03, 1.86334171783810143e+03, 1.86927661203372099e+03, 1.87521414823880332e+03,
+    1.88115431949152389e+03, 1.88709711886665059e+03, 1.89304253947525717e+03, 1.89899057446443771e+03,
+    1.90494121701702556e+03, 1.91089446035131323e+03, 1.91685029772077814e+03, 1.92280872241380780e+03,
+    1.92876972775343120e+03, 1.93473330709704965e+03, 1.94069945383617323e+03, 1.94666816139615867e+03,
+    1.95263942323594915e+03, 1.95861323284781838e+03, 1.96458958375711632e+03, 1.97056846952201749e+03,
+    1.97654988373327183e+03, 1.98253382001395903e+03, 1.98852027201924352e+03, 1.99450923343613340e+03,
+    2.00050069798324148e+03, 2.00649465941054791e+03, 2.01249111149916689e+03, 2.01849004806111361e+03,
+    2.02449146293907484e+03, 2.03049535000618130e+03, 2.03650170316578306e+03, 2.04251051635122576e+03,
+    2.04852178352562987e+03, 2.05453549868167283e+03, 2.06055165584137103e+03, 2.06657024905586741e+03,
+    2.07259127240521684e+03, 2.07861471999817786e+03, 2.08464058597200301e+03, 2.09066886449223375e+03,
+    2.09669954975249493e+03, 2.10273263597429377e+03, 2.10876811740681842e+03, 2.11480598832674059e+03,
+    2.12084624303801820e+03, 2.12688887587170075e+03, 2.13293388118573648e+03, 2.13898125336478279e+03,
+    2.14503098682001473e+03, 2.15108307598893907e+03, 2.15713751533520872e+03, 2.16319429934843720e+03,
+    2.16925342254401903e+03, 2.17531487946294692e+03, 2.18137866467163485e+03, 2.18744477276173848e+03,
+    2.19351319834998230e+03, 2.19958393607798507e+03, 2.20565698061208559e+03, 2.21173232664317402e+03,
+    2.21780996888652317e+03, 2.22388990208161886e+03, 2.22997212099199533e+03, 2.23605662040507013e+03,
+    2.24214339513198274e+03, 2.24823244000742943e+03, 2.25432374988950733e+03, 2.26041731965955250e+03,
+    2.26651314422198448e+03, 2.27261121850415066e+03, 2.27871153745617084e+03, 2.28481409605078443e+03,
+    2.29091888928319941e+03, 2.29702591217094187e+03, 2.30313515975370592e+03, 2.30924662709320864e+03,
+    2.31536030927304091e+03, 2.32147620139852415e+03, 2.32759429859656530e+03, 2.33371459601551624e+03,
+    2.33983708882503061e+03, 2.34596177221592507e+03, 2.35208864140003925e+03, 2.35821769161009979e+03,
+    2.36434891809958253e+03, 2.37048231614257929e+03, 2.37661788103366098e+03, 2.38275560808774753e+03,
+    2.38889549263997378e+03, 2.39503753004556074e+03, 2.40118171567968648e+03, 2.40732804493735557e+03,
+    2.41347651323327318e+03, 2.41962711600171951e+03, 2.42577984869642341e+03, 2.43193470679044003e+03,
+    2.43809168577602532e+03, 2.44425078116451732e+03, 2.45041198848621252e+03, 2.45657530329024712e+03,
+    2.46274072114447836e+03, 2.46890823763536673e+03, 2.47507784836785822e+03, 2.48124954896526924e+03,
+    2.48742333506917112e+03, 2.49359920233927687e+03, 2.49977714645332753e+03, 2.50595716310698026e+03,
+    2.51213924801369694e+03, 2.51832339690463414e+03, 2.52450960552853485e+03, 2.53069786965161757e+03,
+    2.53688818505747031e+03, 2.54308054754694558e+03, 2.54927495293804986e+03, 2.55547139706584449e+03,
+    2.56166987578233693e+03, 2.56787038495637944e+03, 2.57407292047356759e+03, 2.58027747823613618e+03,
+    2.58648405416286096e+03, 2.59269264418895773e+03, 2.59890324426598227e+03, 2.60511585036173392e+03,
+    2.61133045846015602e+03, 2.61754706456124086e+03, 2.62376566468093279e+03, 2.62998625485103230e+03,
+    2.63620883111910371e+03, 2.64243338954837918e+03, 2.64865992621766645e+03, 2.65488843722125785e+03,
+    2.66111891866883616e+03, 2.66735136668538689e+03, 2.67358577741110503e+03, 2.67982214700130908e+03,
+    2.68606047162634832e+03, 2.69230074747151912e+03, 2.69854297073697444e+03, 2.70478713763763790e+03,
+    2.71103324440311962e+03, 2.71728128727762805e+03, 2.72353126251988760e+03, 2.72978316640305320e+03,
+    2.73603699521462886e+03, 2.74229274525638220e+03, 2.74855041284426488e+03, 2.75480999430832981e+03,
+    2.76107148599265065e+03, 2.76733488425524229e+03, 2.77360018546798028e+03, 2.77986738601652178e+03,
+    2.78613648230022773e+03, 2.79240747073208604e+03, 2.79868034773863246e+03, 2.80495510975987418e+03,
+    2.81123175324921567e+03, 2.81751027467338190e+03, 2.82379067051234188e+03, 2.83007293725923773e+03,
+    2.83635707142030878e+03, 2.84264306951481740e+03, 2.84893092807497942e+03, 2.85522064364588823e+03,
+    2.86151221278544654e+03, 2.86780563206429315e+03, 2.87410089806573296e+03, 2.88039800738566692e+03,
+    2.88669695663252287e+03, 2.89299774242718604e+03, 2.89930036140293078e+03, 2.90560481020535281e+03,
+    2.91191108549230103e+03, 2.91821918393381020e+03, 2.92452910221203683e+03, 2.93084083702118960e+03,
+    2.93715438506746705e+03, 2.94346974306898937e+03, 2.94978690775573659e+03, 2.95610587586948304e+03,
+    2.96242664416373373e+03, 2.96874920940366064e+03, 2.97507356836604231e+03, 2.98139971783919736e+03,
+    2.98772765462292637e+03, 2.99405737552844903e+03, 3.00038887737834284e+03, 3.00672215700648258e+03,
+    3.01305721125798073e+03, 3.01939403698912702e+03, 3.02573263106733020e+03, 3.03207299037105804e+03,
+    3.03841511178977908e+03, 3.04475899222390535e+03, 3.05110462858473420e+03, 3.05745201779439003e+03,
+    3.06380115678576976e+03, 3.07015204250248462e+03, 3.07650467189880419e+03, 3.08285904193960141e+03,
+    3.08921514960029754e+03, 3.09557299186680530e+03, 3.10193256573547797e+03, 3.10829386821305070e+03,
+    3.11465689631659143e+03, 3.12102164707344309e+03, 3.12738811752117454e+03, 3.13375630470752503e+03,
+    3.14012620569035334e+03, 3.14649781753758543e+03, 3.15287113732716216e+03, 3.15924616214699017e+03,
+    3.16562288909488916e+03, 3.17200131527854046e+03, 3.17838143781544022e+03, 3.18476325383284620e+03,
+    3.19114676046773047e+03, 3.19753195486672803e+03, 3.20391883418609086e+03, 3.21030739559163658e+03,
+    3.21669763625870155e+03, 3.22308955337209454e+03, 3.22948314412604486e+03, 3.23587840572416053e+03,
+    3.24227533537937643e+03, 3.24867393031391202e+03, 3.25507418775922042e+03, 3.26147610495594790e+03,
+    3.26787967915388253e+03, 3.27428490761191324e+03, 3.28069178759798297e+03, 3.28710031638904229e+03,
+    3.29351049127100850e+03, 3.29992230953871831e+03, 3.30633576849588553e+03, 3.31275086545505746e+03,
+    3.31916759773756939e+03, 3.32558596267350595e+03, 3.33200595760165288e+03, 3.33842757986945935e+03,
+    3.34485082683299288e+03, 3.35127569585689844e+03, 3.35770218431435615e+03, 3.36413028958704081e+03,
+    3.37056000906507961e+03, 3.37699134014701349e+03, 3.38342428023975253e+03, 3.38985882675854009e+03,
+    3.39629497712690954e+03, 3.40273272877664567e+03, 3.40917207914774599e+03, 3.41561302568837891e+03,
+    3.42205556585484692e+03, 3.42849969711154745e+03, 3.43494541693093288e+03, 3.44139272279347415e+03,
+    3.44784161218762119e+03, 3.45429208260976520e+03, 3.46074413156420269e+03, 3.46719775656309503e+03,
+    3.47365295512643524e+03, 3.48010972478200756e+03, 3.48656806306535236e+03, 3.49302796751972983e+03,
+    3.49948943569608355e+03, 3.50595246515300414e+03, 3.51241705345669425e+03, 3.51888319818093169e+03,
+    3.52535089690703626e+03, 3.53182014722383201e+03, 3.53829094672761448e+03, 3.54476329302211525e+03,
+    3.55123718371846780e+03, 3.55771261643517164e+03, 3.56418958879806132e+03, 3.57066809844027011e+03,
+    3.57714814300219678e+03, 3.58362972013147328e+03, 3.59011282748293024e+03, 3.59659746271856557e+03,
+    3.60308362350750940e+03, 3.60957130752599414e+03, 3.61606051245731942e+03, 3.62255123599182207e+03,
+    3.62904347582684250e+03, 3.63553722966669420e+03, 3.64203249522263104e+03, 3.64852927021281721e+03,
+    3.65502755236229359e+03, 3.66152733940294956e+03, 3.66802862907348981e+03, 3.67453141911940520e+03,
+    3.68103570729294188e+03, 3.68754149135307034e+03, 3.69404876906545542e+03, 3.70055753820242717e+03,
+    3.70706779654294996e+03, 3.71357954187259475e+03, 3.72009277198350719e+03, 3.72660748467437952e+03,
+    3.73312367775042276e+03, 3.73964134902333490e+03, 3.74616049631127544e+03, 3.75268111743883401e+03,
+    3.75920321023700399e+03, 3.76572677254315386e+03, 3.77225180220099719e+03, 3.77877829706056809e+03,
+    3.78530625497819028e+03, 3.79183567381645253e+03, 3.79836655144417864e+03, 3.80489888573640110e+03,
+    3.81143267457433421e+03, 3.81796791584534776e+03, 3.82450460744293923e+03, 3.83104274726670701e+03,
+    3.83758233322232445e+03, 3.84412336322151441e+03, 3.85066583518202106e+03, 3.85720974702758622e+03,
+    3.86375509668792029e+03, 3.87030188209868084e+03, 3.87685010120144352e+03, 3.88339975194367707e+03,
+    3.88995083227872055e+03, 3.89650334016575516e+03, 3.90305727356978105e+03, 3.90961263046159183e+03,
+    3.91616940881774963e+03, 3.92272760662056180e+03, 3.92928722185805509e+03, 3.93584825252395194e+03,
+    3.94241069661764550e+03, 3.94897455214417778e+03, 3.95553981711421284e+03, 3.96210648954401631e+03,
+    3.96867456745542813e+03, 3.97524404887584251e+03, 3.98181493183818202e+03, 3.98838721438087623e+03,
+    3.99496089454783669e+03, 4.00153597038843645e+03, 4.00811243995748464e+03, 4.01469030131520549e+03,
+    4.02126955252721564e+03, 4.02785019166450047e+03, 4.03443221680339366e+03, 4.04101562602555214e+03,
+    4.04760041741793793e+03, 4.05418658907279269e+03, 4.06077413908761764e+03, 4.06736306556515092e+03,
+    4.07395336661334750e+03, 4.08054504034535648e+03, 4.08713808487949882e+03, 4.09373249833924865e+03,
+    4.10032827885320967e+03, 4.10692542455509647e+03, 4.11352393358371137e+03, 4.12012380408292393e+03,
+    4.12672503420165231e+03, 4.13332762209384236e+03, 4.13993156591844217e+03, 4.14653686383939112e+03,
+    4.15314351402558896e+03, 4.15975151465088493e+03, 4.16636086389405227e+03, 4.17297155993877004e+03,
+    4.17958360097360310e+03, 4.18619698519198300e+03, 4.19281171079218620e+03, 4.19942777597731947e+03,
+    4.20604517895529352e+03, 4.21266391793881121e+03, 4.21928399114534113e+03, 4.22590539679710582e+03,
+    4.23252813312105536e+03, 4.23915219834885556e+03, 4.24577759071686341e+03, 4.25240430846611252e+03,
+    4.25903234984229221e+03, 4.26566171309572928e+03, 4.27229239648137172e+03, 4.27892439825876772e+03,
+    4.28555771669204751e+03, 4.29219235004990969e+03, 4.29882829660559582e+03, 4.30546555463688037e+03,
+    4.31210412242604707e+03, 4.31874399825987348e+03, 4.32538518042961368e+03, 4.33202766723098102e+03,
+    4.33867145696412899e+03, 4.34531654793363487e+03, 4.35196293844848242e+03, 4.35861062682204556e+03,
+    4.36525961137207014e+03, 4.37190989042065758e+03, 4.37856146229424758e+03, 4.38521432532360086e+03,
+    4.39186847784378460e+03, 4.39852391819415152e+03, 4.40518064471832986e+03, 4.41183865576420067e+03,
+    4.41849794968388505e+03, 4.42515852483372419e+03, 4.43182037957426928e+03, 4.43848351227026069e+03,
+    4.44514792129061061e+03, 4.45181360500839310e+03, 4.45848056180082222e+03, 4.46514879004924023e+03,
+    4.47181828813909760e+03, 4.47848905445994387e+03, 4.48516108740540494e+03, 4.49183438537317215e+03,
+    4.49850894676498683e+03, 4.50518476998662209e+03, 4.51186185344786918e+03, 4.51854019556252297e+03,
+    4.52521979474836735e+03, 4.53190064942715799e+03, 4.53858275802460776e+03, 4.54526611897037401e+03,
+    4.55195073069804130e+03, 4.55863659164511046e+03, 4.56532370025297678e+03, 4.57201205496692364e+03,
+    4.57870165423610251e+03, 4.58539249651352111e+03, 4.59208458025602795e+03, 4.59877790392429779e+03,
+    4.60547246598281890e+03, 4.61216826489987670e+03, 4.61886529914754374e+03, 4.62556356720165877e+03,
+    4.63226306754182042e+03, 4.63896379865136805e+03, 4.64566575901737087e+03, 4.65236894713061156e+03,
+    4.65907336148557624e+03, 4.66577900058043633e+03, 4.67248586291703850e+03, 4.67919394700089197e+03,
+    4.68590325134115028e+03, 4.69261377445060225e+03, 4.69932551484565829e+03, 4.70603847104633587e+03,
+    4.71275264157624497e+03, 4.71946802496257988e+03, 4.72618461973610101e+03, 4.73290242443112493e+03,
+    4.73962143758550974e+03, 4.74634165774064513e+03, 4.75306308344143599e+03, 4.75978571323629149e+03,
+    4.76650954567711233e+03, 4.77323457931927896e+03, 4.77996081272163792e+03, 4.78668824444648908e+03,
+    4.79341687305957385e+03, 4.80014669713006333e+03, 4.80687771523054471e+03, 4.81360992593701212e+03,
+    4.82034332782884940e+03, 4.82707791948882277e+03, 4.83381369950306453e+03, 4.84055066646106661e+03,
+    4.84728881895566246e+03, 4.85402815558301972e+03, 4.86076867494262660e+03, 4.86751037563727823e+03,
+    4.87425325627307029e+03, 4.88099731545938175e+03, 4.88774255180886576e+03, 4.89448896393743962e+03,
+    4.90123655046426848e+03, 4.90798531001175979e+03, 4.91473524120554885e+03, 4.92148634267448597e+03,
+    4.92823861305062746e+03, 4.93499205096922469e+03, 4.94174665506871315e+03, 4.94850242399069703e+03,
+    4.95525935637994462e+03, 4.96201745088437292e+03, 4.96877670615503666e+03, 4.97553712084611925e+03,
+    4.98229869361492365e+03, 4.98906142312185602e+03, 4.99582530803041846e+03, 5.00259034700719894e+03,
+    5.00935653872185867e+03, 5.01612388184712472e+03, 5.02289237505877281e+03, 5.02966201703562547e+03,
+    5.03643280645953473e+03, 5.04320474201537399e+03, 5.04997782239102980e+03, 5.05675204627738731e+03,
+    5.06352741236832389e+03, 5.07030391936069555e+03, 5.07708156595433047e+03, 5.08386035085201638e+03,
+    5.09064027275948865e+03, 5.09742133038542488e+03, 5.10420352244143123e+03, 5.11098684764203517e+03,
+    5.11777130470467273e+03, 5.12455689234968122e+03, 5.13134360930028561e+03, 5.13813145428259577e+03,
+    5.14492042602558740e+03, 5.15171052326110112e+03, 5.15850174472382787e+03, 5.16529408915129898e+03,
+    5.17208755528387883e+03, 5.17888214186475489e+03, 5.18567784763992859e+03, 5.19247467135820352e+03,
+    5.19927261177117816e+03, 5.20607166763323676e+03, 5.21287183770153933e+03, 5.21967312073601079e+03,
+    5.22647551549933542e+03, 5.23327902075694328e+03, 5.24008363527700658e+03, 5.24688935783042325e+03,
+    5.25369618719081518e+03, 5.26050412213451546e+03, 5.26731316144055836e+03, 5.27412330389067301e+03,
+    5.28093454826927518e+03, 5.28774689336345182e+03, 5.29456033796296288e+03, 5.30137488086022313e+03,
+    5.30819052085029762e+03, 5.31500725673089255e+03, 5.32182508730234622e+03, 5.32864401136762172e+03,
+    5.33546402773229602e+03, 5.34228513520455272e+03, 5.34910733259517292e+03, 5.35593061871752889e+03,
+    5.36275499238757220e+03, 5.36958045242382741e+03, 5.37640699764738383e+03, 5.38323462688188647e+03,
+    5.39006333895352873e+03, 5.39689313269104059e+03, 5.40372400692568681e+03, 5.41055596049125324e+03,
+    5.41738899222403870e+03, 5.42422310096285310e+03, 5.43105828554900017e+03, 5.43789454482627752e+03,
+    5.44473187764096292e+03, 5.45157028284180979e+03, 5.45840975928003900e+03, 5.46525030580932798e+03,
+    5.47209192128580526e+03, 5.47893460456804405e+03, 5.48577835451704959e+03, 5.49262316999625818e+03,
+    5.49946904987152266e+03, 5.50631599301110782e+03, 5.51316399828568410e+03, 5.52001306456831753e+03,
+    5.52686319073446248e+03, 5.53371437566195709e+03, 5.54056661823100876e+03, 5.54741991732419501e+03,
+    5.55427427182644988e+03, 5.56112968062505934e+03, 5.56798614260965405e+03, 5.57484365667219936e+03,
+    5.58170222170699071e+03, 5.58856183661064551e+03, 5.59542250028209310e+03, 5.60228421162257382e+03,
+    5.60914696953562543e+03, 5.61601077292707851e+03, 5.62287562070504919e+03, 5.62974151177993281e+03,
+    5.63660844506439480e+03, 5.64347641947336524e+03, 5.65034543392403066e+03, 5.65721548733582858e+03,
+    5.66408657863043936e+03, 5.67095870673177797e+03, 5.67783187056599127e+03, 5.68470606906144440e+03,
+    5.69158130114872074e+03, 5.69845756576061103e+03, 5.70533486183210880e+03, 5.71221318830040036e+03,
+    5.71909254410486028e+03, 5.72597292818704682e+03, 5.73285433949068920e+03, 5.73973677696168670e+03,
+    5.74662023954810047e+03, 5.75350472620014261e+03, 5.76039023587017800e+03, 5.76727676751270792e+03,
+    5.77416432008437278e+03, 5.78105289254393847e+03, 5.78794248385229275e+03, 5.79483309297243977e+03,
+    5.80172471886949188e+03, 5.80861736051066418e+03, 5.81551101686526727e+03, 5.82240568690469991e+03,
+    5.82930136960244818e+03, 5.83619806393407089e+03, 5.84309576887719959e+03, 5.84999448341152947e+03,
+    5.85689420651881483e+03, 5.86379493718285994e+03, 5.87069667438951637e+03, 5.87759941712667478e+03,
+    5.88450316438425943e+03, 5.89140791515422097e+03, 5.89831366843053274e+03, 5.90522042320918081e+03,
+    5.91212817848816303e+03, 5.91903693326747816e+03, 5.92594668654912311e+03, 5.93285743733708568e+03,
+    5.93976918463733728e+03, 5.94668192745783017e+03, 5.95359566480849026e+03, 5.96051039570120884e+03,
+    5.96742611914983991e+03, 5.97434283417019378e+03, 5.98126053978002892e+03, 5.98817923499904919e+03,
+    5.99509891884889657e+03, 6.00201959035314485e+03, 6.00894124853729591e+03, 6.01586389242877249e+03,
+    6.02278752105691092e+03, 6.02971213345295928e+03, 6.03663772865007013e+03, 6.04356430568329233e+03,
+    6.05049186358957104e+03, 6.05742040140773497e+03, 6.06434991817849914e+03, 6.07128041294445029e+03
+};
+
+// log(Γ(k/2)) at index k - 1
+const double half_integer_log_gamma_table[HALF_INTEGER_LOG_GAMMA_TABLE_SIZE] = {
+    5.72364942924700082e-01, 0.00000000000000000e+00, -1.20782237635245218e-01, 0.00000000000000000e+00,
+    2.84682870472919181e-01, 6.93147180559945286e-01, 1.20097360234707429e+00, 1.79175946922805496e+00,
+    2.45373657084244234e+00, 3.17805383034794575e+00, 3.95781396761871651e+00, 4.78749174278204581e+00,
+    5.66256205985714178e+00, 6.57925121201010121e+00, 7.53436423675873268e+00, 8.52516136106541467e+00,
+    9.54926725730099690e+00, 1.06046029027452509e+01, 1.16893334207972686e+01, 1.28018274800814691e+01,
+    1.39406252194037634e+01, 1.51044125730755159e+01, 1.62920004765672424e+01, 1.75023078458738865e+01,
+    1.87343475119364449e+01, 1.99872144956618847e+01, 2.12600761562447005e+01, 2.25521638531234245e+01,
+    2.38627658416890860e+01, 2.51912211827386798e+01, 2.65369144911156134e+01, 2.78992713838408903e+01,
+    2.92777545150408152e+01, 3.06718601060806719e+01, 3.20811148959473513e+01, 3.35050734501368908e+01,
+    3.49433157768768154e+01, 3.63954452080330526e+01, 3.78610865089610940e+01, 3.93398841871994946e+01,
+    4.08315009745307975e+01, 4.23356164607534851e+01, 4.38519258606751592e+01, 4.53801388984769076e+01,
+    4.69199787958087811e+01, 4.84711813518352272e+01, 5.00334941050191517e+01, 5.16066755677643769e+01,
+    5.31904945261692674e+01, 5.47847293981123187e+01, 5.63891676437199436e+01, 5.80036052229805179e+01,
+    5.96278460958843297e+01, 6.12617017610020014e+01, 6.29049908288765067e+01, 6.45575386270063376e+01,
+    6.62191768335490281e+01, 6.78897431371815401e+01, 6.95690809208236374e+01, 7.12570389671680147e+01,
+    7.29534711841694019e+01, 7.46582363488301581e+01, 7.63711978677827688e+01, 7.80922235533153071e+01,
+    7.98211854136143586e+01, 8.15579594561150429e+01, 8.33024255029500580e+01, 8.50544670175815156e+01,
+    8.68139709417810792e+01, 8.85808275421976816e+01, 9.03549302658183819e+01, 9.21361756036870929e+01,
+    9.39244629622997564e+01, 9.57196945421432019e+01, 9.75217752228882091e+01, 9.93306124547874276e+01,
+    1.01146116155864576e+02, 1.02968198614513810e+02, 1.04796774397158302e+02, 1.06631760260643460e+02,
+    1.08473075069065388e+02, 1.10320639714757391e+02, 1.12174377043177884e+02, 1.14034211781461707e+02,
+    1.15900070470414533e+02, 1.17771881399745070e+02, 1.19649574546344908e+02, 1.21533081515438639e+02,
+    1.23422335484439543e+02, 1.25317271149356898e+02, 1.27217824673611730e+02, 1.29123933639127216e+02,
+    1.31035536999568649e+02, 1.32952575035616320e+02, 1.34874989312161944e+02, 1.36802722637326355e+02,
+    1.38735719023202535e+02, 1.40673923648234251e+02, 1.42617282821145977e+02, 1.44565743946344895e+02,
+    1.46519255490720639e+02, 1.48477766951773020e+02, 1.50441228827001936e+02, 1.52409592584497346e+02,
+    1.54382810634671642e+02, 1.56360836303078798e+02, 1.58343623804269214e+02, 1.60331128216630901e+02,
+    1.62323305458171177e+02, 1.64320112263195170e+02, 1.66321506159840368e+02, 1.68327445448427653e+02,
+    1.70337889180592754e+02, 1.72352797139162789e+02, 1.74372129818745151e+02, 1.76395848406997345e+02,
+    1.78423914766548450e+02, 1.80456291417543781e+02, 1.82492941520786275e+02, 1.84533828861449479e+02,
+    1.86578917833337840e+02, 1.88628173423671598e+02, 1.90681561198374652e+02, 1.92739047287844897e+02,
+    1.94800598373187114e+02, 1.96866181672890008e+02, 1.98935764929929491e+02, 2.01009316399281516e+02,
+    2.03086804835828133e+02, 2.05168199482641199e+02, 2.07253470059629848e+02, 2.09342586752536846e+02,
+    2.11435520202271050e+02, 2.13532241494563266e+02, 2.15632722149932874e+02, 2.17736934113954220e+02,
+    2.19844849747811338e+02, 2.21956441819130333e+02, 2.24071683493079519e+02, 2.26190548323727597e+02,
+    2.28313010245650275e+02, 2.30439043565776956e+02, 2.32568622955468499e+02, 2.34701723442818263e+02,
+    2.36838320405168446e+02, 2.38978389561834319e+02, 2.41121906967029076e+02, 2.43268849002982705e+02,
+    2.45419192373247881e+02, 2.47572914096186878e+02, 2.49729991498633382e+02, 2.51890402209723192e+02,
+    2.54054124154888370e+02, 2.56221135550009535e+02, 2.58391414895720857e+02, 2.60564940971863223e+02,
+    2.62741692832080162e+02, 2.64921649798552778e+02, 2.67104791456868554e+02, 2.69291097651019811e+02,
+    2.71480548478528817e+02, 2.73673124285693689e+02, 2.75868805662953321e+02, 2.78067573440366118e+02,
+    2.80269408683200140e+02, 2.82474292687630395e+02, 2.84682206976540783e+02, 2.86893133295426992e+02,
+    2.89107053608397621e+02, 2.91323950094270288e+02, 2.93543805142760732e+02, 2.95766601350760652e+02,
+    2.97992321518703420e+02, 3.00220948647014154e+02, 3.02452465932641246e+02, 3.04686856765668722e+02,
+    3.06924104726004828e+02, 3.09164193580146900e+02, 3.11407107278018714e+02, 3.13652829949879049e+02,
+    3.15901345903299557e+02, 3.18152639620209300e+02, 3.20406695754005398e+02, 3.22663499126726151e+02,
+    3.24923034726286915e+02, 3.27185287703775202e+02, 3.29450243370805254e+02, 3.31717887196928473e+02,
+    3.33988204807099919e+02, 3.36261181979198454e+02, 3.38536804641599588e+02, 3.40815058870799021e+02,
+    3.43095930889086276e+02, 3.45379407062266864e+02, 3.47665473897431241e+02, 3.49954118040770254e+02,
+    3.52245326275435048e+02, 3.54539085519440789e+02, 3.56835382823613088e+02, 3.59134205369575398e+02,
+    3.61435540467777628e+02, 3.63739375555563470e+02, 3.66045698195276771e+02, 3.68354496072404743e+02,
+    3.70665756993758578e+02, 3.72979468885689016e+02, 3.75295619792337050e+02, 3.77614197873918670e+02,
+    3.79935191405042474e+02, 3.82258588773060012e+02, 3.84584378476447341e+02, 3.86912549123217559e+02,
+    3.89243089429363465e+02, 3.91575988217329609e+02, 3.93911234414512933e+02, 3.96248817051791548e+02,
+    3.98588725262080686e+02, 4.00930948278915764e+02, 4.03275475435061196e+02, 4.05622296161144902e+02,
+    4.07971399984317713e+02, 4.10322776526937332e+02, 4.12676415505275543e+02, 4.15032306728249637e+02,
+    4.17390440096175723e+02, 4.19750805599544719e+02, 4.22113393317820169e+02, 4.24478193418257092e+02,
+    4.26845196154741643e+02, 4.29214391866651567e+02, 4.31585770977735933e+02, 4.33959323995014813e+02,
+    4.36335041507697781e+02, 4.38712914186121168e+02, 4.41092932780703563e+02, 4.43475088120918940e+02,
+    4.45859371114287740e+02, 4.48245772745384613e+02, 4.50634284074862933e+02, 4.53024896238496126e+02,
+    4.55417600446234530e+02, 4.57812387981278164e+02, 4.60209250199165240e+02, 4.62608178526874894e+02,
+    4.65009164461945829e+02, 4.67412199571608198e+02, 4.69817275491930616e+02, 4.72224383926980579e+02,
+    4.74633516647998647e+02, 4.77044665492585636e+02, 4.79457822363903404e+02, 4.81872979229887960e+02,
+    4.84290128122475210e+02, 4.86709261136839416e+02, 4.89130370430642813e+02, 4.91553448223298005e+02
+};
+
+// Standard significance levels
+const double critical_alpha_levels[CRITICAL_ALPHA_COUNT] = {
+    1.00000000000000006e-01, 5.00000000000000028e-02, 2.50000000000000014e-02, 1.00000000000000002e-02,
+    5.00000000000000010e-03, 1.00000000000000002e-03
+};
+
+// df of each critical-value row, 0 for ∞
+const double critical_table_df[CRITICAL_TABLE_ROWS] = {
+    1.00000000000000000e+00, 2.00000000000000000e+00, 3.00000000000000000e+00, 4.00000000000000000e+00,
+    5.00000000000000000e+00, 6.00000000000000000e+00, 7.00000000000000000e+00, 8.00000000000000000e+00,
+    9.00000000000000000e+00, 1.00000000000000000e+01, 1.10000000000000000e+01, 1.20000000000000000e+01,
+    1.30000000000000000e+01, 1.40000000000000000e+01, 1.50000000000000000e+01, 1.60000000000000000e+01,
+    1.70000000000000000e+01, 1.80000000000000000e+01, 1.90000000000000000e+01, 2.00000000000000000e+01,
+    2.10000000000000000e+01, 2.20000000000000000e+01, 2.30000000000000000e+01, 2.40000000000000000e+01,
+    2.50000000000000000e+01, 2.60000000000000000e+01, 2.70000000000000000e+01, 2.80000000000000000e+01,
+    2.90000000000000000e+01, 3.00000000000000000e+01, 3.10000000000000000e+01, 3.20000000000000000e+01,
+    3.30000000000000000e+01, 3.40000000000000000e+01, 3.50000000000000000e+01, 3.60000000000000000e+01,
+    3.70000000000000000e+01, 3.80000000000000000e+01, 3.90000000000000000e+01, 4.00000000000000000e+01,
+    4.10000000000000000e+01, 4.20000000000000000e+01, 4.30000000000000000e+01, 4.40000000000000000e+01,
+    4.50000000000000000e+01, 4.60000000000000000e+01, 4.70000000000000000e+01, 4.80000000000000000e+01,
+    4.90000000000000000e+01, 5.00000000000000000e+01, 5.10000000000000000e+01, 5.20000000000000000e+01,
+    5.30000000000000000e+01, 5.40000000000000000e+01, 5.50000000000000000e+01, 5.60000000000000000e+01,
+    5.70000000000000000e+01, 5.80000000000000000e+01, 5.90000000000000000e+01, 6.00000000000000000e+01,
+    6.10000000000000000e+01, 6.20000000000000000e+01, 6.30000000000000000e+01, 6.40000000000000000e+01,
+    6.50000000000000000e+01, 6.60000000000000000e+01, 6.70000000000000000e+01, 6.80000000000000000e+01,
+    6.90000000000000000e+01, 7.00000000000000000e+01, 7.10000000000000000e+01, 7.20000000000000000e+01,
+    7.30000000000000000e+01, 7.40000000000000000e+01, 7.50000000000000000e+01, 7.60000000000000000e+01,
+    7.70000000000000000e+01, 7.80000000000000000e+01, 7.90000000000000000e+01, 8.00000000000000000e+01,
+    8.10000000000000000e+01, 8.20000000000000000e+01, 8.30000000000000000e+01, 8.40000000000000000e+01,
+    8.50000000000000000e+01, 8.60000000000000000e+01, 8.70000000000000000e+01, 8.80000000000000000e+01,
+    8.90000000000000000e+01, 9.00000000000000000e+01, 9.10000000000000000e+01, 9.20000000000000000e+01,
+    9.30000000000000000e+01, 9.40000000000000000e+01, 9.50000000000000000e+01, 9.60000000000000000e+01,
+    9.70000000000000000e+01, 9.80000000000000000e+01, 9.90000000000000000e+01, 1.00000000000000000e+02,
+    1.01000000000000000e+02, 1.02000000000000000e+02, 1.03000000000000000e+02, 1.04000000000000000e+02,
+    1.05000000000000000e+02, 1.06000000000000000e+02, 1.07000000000000000e+02, 1.08000000000000000e+02,
+    1.09000000000000000e+02, 1.10000000000000000e+02, 1.11000000000000000e+02, 1.12000000000000000e+02,
+    1.13000000000000000e+02, 1.14000000000000000e+02, 1.15000000000000000e+02, 1.16000000000000000e+02,
+    1.17000000000000000e+02, 1.18000000000000000e+02, 1.19000000000000000e+02, 1.20000000000000000e+02,
+    1.50000000000000000e+02, 2.00000000000000000e+02, 3.00000000000000000e+02, 5.00000000000000000e+02,
+    1.00000000000000000e+03, 0.00000000000000000e+00
+};
+
+// t(1 - α/2, df) at [row][alpha]
+const double t_critical_table[CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT] = {
+    6.31375151467504292e+00, 1.27062047361747048e+01, 2.54516995793570793e+01, 6.36567411628715831e+01,
+    1.27321336468872147e+02, 6.36619248768719558e+02, 2.91998558035372557e+00, 4.30265272974946367e+00,
+    6.20534681657069420e+00, 9.92484320091829275e+00, 1.40890472755552949e+01, 3.15990545764436206e+01,
+    2.35336343480182375e+00, 3.18244630528370953e+00, 4.17653484610449865e+00, 5.84090930973335709e+00,
+    7.45331850515062566e+00, 1.29239786366874831e+01, 2.13184678632665037e+00, 2.77644510519779431e+00,
+    3.49540593251643772e+00, 4.60409487134999296e+00, 5.59756836707545880e+00, 8.61030158137927515e+00,
+    2.01504837333302422e+00, 2.57058183563631548e+00, 3.16338144974860525e+00, 4.03214298355522782e+00,
+    4.77334060485552225e+00, 6.86882662588110993e+00, 1.94318028051530312e+00, 2.44691185114497012e+00,
+    2.96868668415346226e+00, 3.70742802132477989e+00, 4.31682710363337296e+00, 5.95881617881875947e+00,
+    1.89457860509000731e+00, 2.36462425159278533e+00, 2.84124424858820834e+00, 3.49948329735049413e+00,
+    4.02933717764248467e+00, 5.40788252086172516e+00, 1.85954803753089837e+00, 2.30600413520416669e+00,
+    2.75152359606305197e+00, 3.35538733133339528e+00, 3.83251868534434292e+00, 5.04130543337336778e+00,
+    1.83311293265623720e+00, 2.26215716279820533e+00, 2.68501084681645530e+00, 3.24983554159212629e+00,
+    3.68966239230423065e+00, 4.78091258593113899e+00, 1.81246112281167648e+00, 2.22813885198627482e+00,
+    2.63376691571159816e+00, 3.16927267261695134e+00, 3.58140620209065652e+00, 4.58689385870263600e+00,
+    1.79588481870404415e+00, 2.20098516009163969e+00, 2.59309268253936231e+00, 3.10580651553928089e+00,
+    3.49661417325367152e+00, 4.43697933823444934e+00, 1.78228755564932007e+00, 2.17881282966722889e+00,
+    2.56003295935924546e+00, 3.05453958939290215e+00, 3.42844424229225275e+00, 4.31779128360618447e+00,
+    1.77093339598687294e+00, 2.16036865646279264e+00, 2.53263781466094828e+00, 3.01227583871657822e+00,
+    3.37246794101097924e+00, 4.22083172770712078e+00, 1.76131013577489215e+00, 2.14478668791780391e+00,
+    2.50956941149332424e+00, 2.97684273437083480e+00, 3.32569581783802404e+00, 4.14045411273820285e+00,
+    1.75305035569257339e+00, 2.13144954555977550e+00, 2.48987970347989096e+00, 2.94671288347523896e+00,
+    3.28603857094622409e+00, 4.07276519590379138e+00, 1.74588367627624996e+00, 2.11990529922125459e+00,
+    2.47287832246157180e+00, 2.92078162242510020e+00, 3.25199287438287898e+00, 4.01499632718405586e+00,
+    1.73960672607507294e+00, 2.10981557783331697e+00, 2.45805072037928429e+00, 2.89823051967741874e+00,
+    3.22244991135746384e+00, 3.96512627211903146e+00, 1.73406360661753878e+00, 2.10092204024103868e+00,
+    2.44500561651494275e+00, 2.87844047273860815e+00, 3.19657422225522003e+00, 3.92164582508515958e+00,
+    1.72913281152136955e+00, 2.09302405440830963e+00, 2.43344021137496913e+00, 2.86093460646497899e+00,
+    3.17372453079231587e+00, 3.88340585259208293e+00, 1.72471824292078724e+00, 2.08596344726586480e+00,
+    2.42311653987340758e+00, 2.84533970978610862e+00, 3.15340053290645272e+00, 3.84951627493082738e+00,
+    1.72074290281187858e+00, 2.07961384472768041e+00, 2.41384501659899930e+00, 2.83135955802304995e+00,
+    3.13520624540626880e+00, 3.81927716427446251e+00, 1.71714437438024281e+00, 2.07387306790402626e+00,
+    2.40547274626193408e+00, 2.81875606060014361e+00, 3.11882420686073436e+00, 3.79213067169839091e+00,
+    1.71387152774704798e+00, 2.06865761041904861e+00, 2.39787506465710898e+00, 2.80733568376999898e+00,
+    3.10399696314088169e+00, 3.76762680431178065e+00, 1.71088207990942842e+00, 2.06389856162802587e+00,
+    2.39094931512946740e+00, 2.79693950477445608e+00, 3.09051354871699235e+00, 3.74539861929005236e+00,
+    1.70814076125189929e+00, 2.05953855275329767e+00, 2.38461020080468833e+00, 2.78743581367697058e+00,
+    3.07819946054352256e+00, 3.72514394972865004e+00, 1.70561791975927313e+00, 2.05552943864287307e+00,
+    2.37878626623558720e+00, 2.77871453332968299e+00, 3.06690911643055664e+00, 3.70661174348091071e+00,
+    1.70328844572212712e+00, 2.05183051648028547e+00, 2.37341720091260777e+00, 2.77068295712221202e+00,
+    3.05652010885650460e+00, 3.68959171345923620e+00, 1.70113093426593154e+00, 2.04840714179524497e+00,
+    2.36845174916874424e+00, 2.76326245546144467e+00, 3.04692877505303583e+00, 3.67390640070127628e+00,
+    1.69912702653349768e+00, 2.04522964213270431e+00, 2.36384607320830931e+00, 2.75638590367060532e+00,
+    3.03804674484917481e+00, 3.65940501946633301e+00, 1.69726088659395780e+00, 2.04227245630123821e+00,
+    2.35956245870092918e+00, 2.74999565356722542e+00, 3.02979822364824258e+00, 3.64595863504202189e+00,
+    1.69551878254586552e+00, 2.03951344639640864e+00, 2.35556828215991221e+00, 2.74404191929426933e+00,
+    3.02211783430968461e+00, 3.63345634975833098e+00, 1.69388874838371062e+00, 2.03693334346010202e+00,
+    2.35183518037636885e+00, 2.73848148201218811e+00, 3.01494888835450281e+00, 3.62180225986749527e+00,
+    1.69236030903034451e+00, 2.03451529744933879e+00, 2.34833837725747774e+00, 2.73327664235083612e+00,
+    3.00824199012327931e+00, 3.61091300765442824e+00, 1.69092425518685485e+00, 2.03224450931771905e+00,
+    2.34505613434518034e+00, 2.72839436707072025e+00, 3.00195390145407481e+00, 3.60071579738640812e+00,
+    1.68957245778026577e+00, 2.03010792825034336e+00, 2.34196929930103837e+00, 2.72380558920809168e+00,
+    2.99604661190179211e+00, 3.59114677581077801e+00, 1.68829771411681628e+00, 2.02809400098045112e+00,
+    2.33906093257474579e+00, 2.71948463045000777e+00, 2.99048657238427884e+00, 3.58214970145633682e+00,
+    1.68709361959626358e+00, 2.02619246302910971e+00, 2.33631599690978353e+00, 2.71540872154998825e+00,
+    2.98524405971617313e+00, 3.57367484444520578e+00, 1.68595446016673733e+00, 2.02439416391196980e+00,
+    2.33372109768746316e+00, 2.71155760191308248e+00, 2.98029264668682270e+00, 3.56567807158023431e+00,
+    1.68487512171122522e+00, 2.02269092003676132e+00, 2.33126426465882153e+00, 2.70791318351766197e+00,
+    2.97560875779298728e+00, 3.55812008133273228e+00, 1.68385101333565257e+00, 2.02107539030627326e+00,
+    2.32893476756911477e+00, 2.70445926743316223e+00, 2.97117129490607246e+00, 3.55096576086331117e+00,
+    1.68287800213270833e+00, 2.01954097044137582e+00, 2.32672295969143406e+00, 2.70118130357852237e+00,
+    2.96696132036509486e+00, 3.54418364297158295e+00, 1.68195235746753413e+00, 2.01808170281844479e+00,
+    2.32462014446321197e+00, 2.69806618621998462e+00, 2.96296178747870398e+00, 3.53774544532742974e+00,
+    1.68107070320251961e+00, 2.01669219922782439e+00, 2.32261846134238503e+00, 2.69510207915767541e+00,
+    2.95915731036693197e+00, 3.53162567780805103e+00, 1.68022997657211692e+00, 2.01536757444376358e+00,
+    2.32071078772826045e+00, 2.69227826569302220e+00, 2.95553396660507062e+00, 3.52580130648717560e+00,
+    1.67942739265235486e+00, 2.01410338888084661e+00, 2.31889065437034070e+00, 2.68958501937464289e+00,
+    2.95207912734441846e+00, 3.52025146497109809e+00, 1.67866041355686524e+00, 2.01289559891942904e+00,
+    2.31715217215001701e+00, 2.68701349224221619e+00, 2.94878131054989145e+00, 3.51495720548180524e+00,
+    1.67792672164186096e+00, 2.01174051372976592e+00, 2.31548996849072619e+00, 2.68455561786652463e+00,
+    2.94563005376732745e+00, 3.50990128344947827e+00, 1.67722419612433904e+00, 2.01063475762423227e+00,
+    2.31389913195133090e+00, 2.68220402695021587e+00, 2.94261580345546747e+00, 3.50506797047020280e+00,
+    1.67655089261685397e+00, 2.00957523712923969e+00, 2.31237516380015640e+00, 2.67995197363155224e+00,
+    2.93972981842092818e+00, 3.50044289136736664e+00, 1.67590502516309758e+00, 2.00855911210076110e+00,
+    2.31091393556490354e+00, 2.67779327094084429e+00, 2.93696408530376241e+00, 3.49601288181113912e+00,
+    1.67528495042491032e+00, 2.00758377031583590e+00, 2.30951165171557582e+00, 2.67572223411064769e+00,
+    2.93431124439548396e+00, 3.49176586353390306e+00, 1.67468915372602556e+00, 2.00664680506168835e+00,
+    2.30816481677072494e+00, 2.67373363064721969e+00, 2.93176452434571067e+00, 3.48769073465718993e+00,
+    1.67411623670310084e+00, 2.00574599531786912e+00, 2.30687020622726680e+00, 2.67182263624100402e+00,
+    2.92931768453959451e+00, 3.48377727303844820e+00, 1.67356490635216137e+00, 2.00487928818805683e+00,
+    2.30562484080527730e+00, 2.66998479573489167e+00, 2.92696496411516360e+00, 3.48001605087027643e+00,
+    1.67303396528991177e+00, 2.00404478328914593e+00, 2.30442596357503415e+00, 2.66821598848619379e+00,
+    2.92470103674502280e+00, 3.47639835903359007e+00, 1.67252230307557759e+00, 2.00324071884787225e+00,
+    2.30327101959694236e+00, 2.66651239755606362e+00, 2.92252097043630910e+00, 3.47291613992990778e+00,
+    1.67202888846095310e+00, 2.00246545929100739e+00, 2.30215763775809723e+00, 2.66487048224197176e+00,
+    2.92042019171115230e+00, 3.46956192770478289e+00, 1.67155276245485918e+00, 2.00171748414523609e+00,
+    2.30108361453391019e+00, 2.66328695353765843e+00, 2.91839445362082506e+00, 3.46632879493101109e+00,
+    1.67109303210389504e+00, 2.00099537808826788e+00, 2.30004689944093066e+00, 2.66175875216296731e+00,
+    2.91643980712340323e+00, 3.46321030495194204e+00, 1.67064886490463649e+00, 2.00029782201426043e+00,
+    2.29904558197889974e+00, 2.66028302885503720e+00, 2.91455257541950008e+00, 3.46020046919635593e+00,
+    1.67021948377373741e+00, 1.99962358499493975e+00, 2.29807787988718237e+00, 2.65885712665392626e+00,
+    2.91272933089553776e+00, 3.45729370887041165e+00, 1.66980416251201147e+00, 1.99897151703337883e+00,
+    2.29714212856378408e+00, 2.65747856495115631e+00, 2.91096687437068979e+00, 3.45448482051202133e+00,
+    1.66940222170681318e+00, 1.99834054252074145e+00, 2.29623677151487815e+00, 2.65614502509986172e+00,
+    2.90926221638342275e+00, 3.45176894496099829e+00, 1.66901302502409021e+00, 1.99772965431769300e+00,
+    2.29536035171962904e+00, 2.65485433741108512e+00, 2.90761256028760418e+00, 3.44914153935637291e+00,
+    1.66863597584755263e+00, 1.99713790839200400e+00, 2.29451150380959978e+00, 2.65360446938292505e+00,
+    2.90601528695730327e+00, 3.44659835182197050e+00, 1.66827051422763284e+00, 1.99656441895231196e+00,
+    2.29368894697448278e+00, 2.65239351502831600e+00, 2.90446794092451110e+00, 3.44413539854400863e+00,
+    1.66791611410742502e+00, 1.99600835402529664e+00, 2.29289147851666808e+00, 2.65121968518365758e+00,
+    2.90296821779559355e+00, 3.44174894298119805e+00, 1.66757228079670838e+00, 1.99546893142984394e+00,
+    2.29211796798646361e+00, 2.65008129869472953e+00, 2.90151395281097857e+00, 3.43943547697949992e+00,
+    1.66723854866855326e+00, 1.99494541510723788e+00, 2.29136735183784523e+00, 2.64897677438862633e+00,
+    2.90010311042872981e+00, 3.43719170359108839e+00, 1.66691447905595669e+00, 1.99443711177118654e+00,
+    2.29063862855162759e+00, 2.64790462375115121e+00, 2.89873377482668726e+00, 3.43501452142081520e+00,
+    1.66659965832853385e+00, 1.99394336784562576e+00, 2.28993085417905506e+00, 2.64686344423839204e+00,
+    2.89740414123006440e+00, 3.43290101034409956e+00, 1.66629369613153533e+00, 1.99346356666187230e+00,
+    2.28924313826412407e+00, 2.64585191315932589e+00, 2.89611250798200537e+00, 3.43084841845812560e+00,
+    1.66599622377143164e+00, 1.99299712588985511e+00, 2.28857464010762079e+00, 2.64486878207338227e+00,
+    2.89485726928390852e+00, 3.42885415014389050e+00, 1.66570689273402350e+00, 1.99254349518093266e+00,
+    2.28792456533992095e+00, 2.64391287165308997e+00, 2.89363690854044453e+00, 3.42691575513035884e+00,
+    1.66542537332256324e+00, 1.99210215400224211e+00, 2.28729216277319525e+00, 2.64298306696739349e+00,
+    2.89244999225131316e+00, 3.42503091846395424e+00, 1.66515135340469489e+00, 1.99167260964466442e+00,
+    2.28667672150679646e+00, 2.64207831314599195e+00, 2.89129516439806133e+00, 3.42319745129716679e+00,
+    1.66488453725820551e+00, 1.99125439538838500e+00, 2.28607756826239195e+00, 2.64119761138927212e+00,
+    2.89017114127977193e+00, 3.42141328241930598e+00, 1.66462464450661529e+00, 1.99084706881169082e+00,
+    2.28549406492784390e+00, 2.64034001529212681e+00, 2.88907670675631323e+00, 3.41967645046057545e+00,
+    1.66437140913655091e+00, 1.99045021023012891e+00, 2.28492560629100927e+00, 2.63950462745322056e+00,
+    2.88801070786210889e+00, 3.41798509670785888e+00, 1.66412457858966745e+00, 1.99006342125444613e+00,
+    2.28437161794654253e+00, 2.63869059634418290e+00, 2.88697205075719809e+00, 3.41633745847694614e+00,
+    1.66388391292260063e+00, 1.98968632345690288e+00, 2.28383155436049323e+00, 2.63789711341577648e+00,
+    2.88595969698571375e+00, 3.41473186299158149e+00, 1.66364918402907724e+00, 1.98931855713657257e+00,
+    2.28330489707898554e+00, 2.63712341042037446e+00, 2.88497266001488484e+00, 3.41316672172468705e+00,
+    1.66342017491888505e+00, 1.98895978017516284e+00, 2.28279115306862979e+00, 2.63636875693212280e+00,
+    2.88401000203034386e+00, 3.41164052516157090e+00, 1.66319667904890967e+00, 1.98860966697570918e+00,
+    2.28228985317749045e+00, 2.63563245804796109e+00, 2.88307083096585215e+00, 3.41015183794886134e+00,
+    1.66297849970190459e+00, 1.98826790747722204e+00, 2.28180055070652799e+00, 2.63491385225430585e+00,
+    2.88215429774769882e+00, 3.40869929439643382e+00, 1.66276544940907089e+00, 1.98793420623902062e+00,
+    2.28132282008236320e+00, 2.63421230944563423e+00, 2.88125959373587204e+00, 3.40728159430272504e+00,
+    1.66255734941287781e+00, 1.98760828158907099e+00, 2.28085625562308492e+00, 2.63352722908249648e+00,
+    2.88038594834582007e+00, 3.40589749907663730e+00, 1.66235402916689612e+00, 1.98728986483116965e+00,
+    2.28040047038957461e+00, 2.63285803847764521e+00, 2.87953262683609790e+00, 3.40454582813174511e+00,
+    1.66215532586970038e+00, 1.98697869950628148e+00, 2.27995509511552008e+00, 2.63220419120000892e+00,
+    2.87869892824855844e+00, 3.40322545553075750e+00, 1.66196108403016196e+00, 1.98667454070376825e+00,
+    2.27951977720989252e+00, 2.63156516558715881e+00, 2.87788418348896213e+00, 3.40193530686020917e+00,
+    1.66177115506169515e+00, 1.98637715441861817e+00, 2.27909417982623586e+00, 2.63094046335776444e+00,
+    2.87708775353695767e+00, 3.40067435631716330e+00, 1.66158539690323370e+00, 1.98608631695113025e+00,
+    2.27867798099359575e+00, 2.63032960831628859e+00, 2.87630902777538244e+00, 3.39944162399133676e+00,
+    1.66140367366489894e+00, 1.98580181434582337e+00, 2.27827087280438567e+00, 2.62973214514283482e+00,
+    2.87554742242969619e+00, 3.39823617332752548e+00, 1.66122585529651201e+00, 1.98552344186660434e+00,
+    2.27787256065487842e+00, 2.62914763826170539e+00, 2.87480237910918257e+00, 3.39705710875453537e+00,
+    1.66105181727724149e+00, 1.98525100350549821e+00, 2.27748276253439430e+00, 2.62857567078274323e+00,
+    2.87407336344224928e+00, 3.39590357346800520e+00, 1.66088144032483820e+00, 1.98498431152245747e+00,
+    2.27710120835957675e+00, 2.62801584351006978e+00, 2.87335986379882913e+00, 3.39477474735560047e+00,
+    1.66071461012302479e+00, 1.98472318601398467e+00, 2.27672763935045541e+00, 2.62746777401325238e+00,
+    2.87266139009346189e+00, 3.39366984505402547e+00, 1.66055121706573372e+00, 1.98446745450848172e+00,
+    2.27636180744527028e+00, 2.62693109575637385e+00, 2.87197747266317460e+00, 3.39258811412818817e+00,
+    1.66039115601699083e+00, 1.98421695158641742e+00, 2.27600347475127318e+00, 2.62640545728082753e+00,
+    2.87130766121476633e+00, 3.39152883336365063e+00, 1.66023432608533938e+00, 1.98397151852355225e+00,
+    2.27565241302895593e+00, 2.62589052143801771e+00, 2.87065152383653777e+00, 3.39049131116422986e+00,
+    1.66008063041178699e+00, 1.98373100295560612e+00, 2.27530840320735184e+00, 2.62538596466844121e+00,
+    2.87000864606991257e+00, 3.38947488404727260e+00, 1.65992997597033876e+00, 1.98349525856287978e+00,
+    2.27497123492825226e+00, 2.62489147632391262e+00, 2.86937863003675853e+00, 3.38847891522972589e+00,
+    1.65978227338025497e+00, 1.98326414477345692e+00, 2.27464070611734037e+00, 2.62440675802995615e+00,
+    2.86876109361854237e+00, 3.38750279329868098e+00, 1.65963743672923725e+00, 1.98303752648372589e+00,
+    2.27431662258041234e+00, 2.62393152308560529e+00, 2.86815566968377489e+00, 3.38654593096055923e+00,
+    1.65949538340680425e+00, 1.98281527379504818e+00, 2.27399879762298518e+00, 2.62346549589808387e+00,
+    2.86756200536045025e+00, 3.38560776386356421e+00, 1.65935603394718556e+00, 1.98259726176550055e+00,
+    2.27368705169172847e+00, 2.62300841145002073e+00, 2.86697976135046106e+00, 3.38468774948844731e+00,
+    1.65921931188109717e+00, 1.98238337017569122e+00, 2.27338121203626997e+00, 2.62256001479703382e+00,
+    2.86640861128318880e+00, 3.38378536610300484e+00, 1.65908514359582493e+00, 1.98217348330772714e+00,
+    2.27308111239004607e+00, 2.62212006059368941e+00, 2.86584824110568182e+00, 3.38290011177607397e+00,
+    1.65895345820307516e+00, 1.98196748973648251e+00, 2.27278659266894323e+00, 2.62168831264597824e+00,
+    2.86529834850702558e+00, 3.38203150344712222e+00, 1.65882418741409210e+00, 1.98176528213237235e+00,
+    2.27249749868659867e+00, 2.62126454348859550e+00, 2.86475864237469668e+00, 3.38117907604779822e+00,
+    1.65869726542158391e+00, 1.98156675707490093e+00, 2.27221368188528583e+00, 2.62084853398543771e+00,
+    2.86422884228083774e+00, 3.38034238167209677e+00, 1.65857262878802558e+00, 1.98137181487630598e+00,
+    2.27193499908140240e+00, 2.62044007295184223e+00, 2.86370867799655482e+00, 3.37952098879202723e+00,
+    1.65845021633994083e+00, 1.98118035941466109e+00, 2.27166131222464474e+00, 2.62003895679719667e+00,
+    2.86319788903247074e+00, 3.37871448151589826e+00, 1.65832996906779484e+00, 1.98099229797585741e+00,
+    2.27139248817001604e+00, 2.61964498918665400e+00, 2.86269622420388714e+00, 3.37792245888654641e+00,
+    1.65821183003115014e+00, 1.98080754110390989e+00, 2.27112839846187820e+00, 2.61925798072077143e+00,
+    2.86220344121904136e+00, 3.37714453421701633e+00, 1.65809574426876782e+00, 1.98062600245909004e+00,
+    2.27086891912931366e+00, 2.61887774863197009e+00, 2.86171930628902915e+00, 3.37638033446138719e+00,
+    1.65798165871335712e+00, 1.98044759868340270e+00, 2.27061393049210913e+00, 2.61850411649680037e+00,
+    2.86124359375808179e+00, 3.37562949961859049e+00, 1.65786952211069094e+00, 1.98027224927297452e+00,
+    2.27036331697672367e+00, 2.61813691396305748e+00, 2.86077608575296827e+00, 3.37489168216722080e+00,
+    1.65775928494283331e+00, 1.98009987645693997e+00, 2.27011696694164922e+00, 2.61777597649085925e+00,
+    2.86031657185037513e+00, 3.37416654652947834e+00, 1.65765089935523569e+00, 1.97993040508244089e+00,
+    2.26987477251160819e+00, 2.61742114510686585e+00, 2.85986484876120040e+00, 3.37345376856250034e+00,
+    1.65507550018717531e+00, 1.97590533089662057e+00, 2.26412508095826936e+00, 2.60900256586553825e+00,
+    2.84915243066331580e+00, 3.35656898174244356e+00, 1.65250810091087752e+00, 1.97189622363390926e+00,
+    2.25840318392699624e+00, 2.60063443619155787e+00, 2.83851368826246642e+00, 3.33983540627567832e+00,
+    1.64994867393763411e+00, 1.96790301126108691e+00, 2.25270892778126219e+00, 2.59231641084779252e+00,
+    2.82794804468393757e+00, 3.32325151297418753e+00, 1.64790685392951142e+00, 1.96471983746736778e+00,
+    2.24817332157040006e+00, 2.58569783514194196e+00, 2.81954777610759333e+00, 3.31009115152266986e+00,
+    1.64637881728546587e+00, 1.96233908082640829e+00, 2.24478311501939176e+00, 2.58075469806595104e+00,
+    2.81327786048554573e+00, 3.30028264842391295e+00, 1.64485362695147264e+00, 1.95996398454005427e+00,
+    2.24140272760494552e+00, 2.57582930354890083e+00, 2.80703376834380425e+00, 3.29052673149189490e+00
+};
+
+// χ²(1 - α, df) at [row][alpha]; z(1 - α) in the ∞ row
+const double chi_square_critical_table[CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT] = {
+    2.70554345409541463e+00, 3.84145882069412581e+00, 5.02388618731488901e+00, 6.63489660102121537e+00,
+    7.87943857662241687e+00, 1.08275661706627329e+01, 4.60517018598809091e+00, 5.99146454710798171e+00,
+    7.37775890822787250e+00, 9.21034037197618183e+00, 1.05966347330960726e+01, 1.38155105579642736e+01,
+    6.25138863117032351e+00, 7.81472790325118005e+00, 9.34840360449614849e+00, 1.13448667301443713e+01,
+    1.28381564665986510e+01, 1.62662361962381325e+01, 7.77944033973485816e+00, 9.48772903678115576e+00,
+    1.11432867818777979e+01, 1.32767041359876252e+01, 1.48602590005602444e+01, 1.84668269529031726e+01,
+    9.23635689978111785e+00, 1.10704976935163533e+01, 1.28325019940300287e+01, 1.50862724693889909e+01,
+    1.67496023436390438e+01, 2.05150056524328797e+01, 1.06446406756684198e+01, 1.25915872437439802e+01,
+    1.44493753354479217e+01, 1.68118938297709306e+01, 1.85475841785110909e+01, 2.24577444848253265e+01,
+    1.20170366237805286e+01, 1.40671404493401688e+01, 1.60127642746293226e+01, 1.84753069065823645e+01,
+    2.02777398749626236e+01, 2.43218863478568537e+01, 1.33615661365117280e+01, 1.55073130558654544e+01,
+    1.75345461394846502e+01, 2.00902350296632335e+01, 2.19549549906595303e+01, 2.61244815583761429e+01,
+    1.46836565732598370e+01, 1.69189776046204514e+01, 1.90227677986416346e+01, 2.16659943334619243e+01,
+    2.35893507812573873e+01, 2.78771648712565749e+01, 1.59871791721052610e+01, 1.83070380532751464e+01,
+    2.04831773508073951e+01, 2.32092511589543591e+01, 2.51881795719711725e+01, 2.95882984450744182e+01,
+    1.72750085175000727e+01, 1.96751375726824946e+01, 2.19200492610212088e+01, 2.47249703113182839e+01,
+    2.67568489164696359e+01, 3.12641336202399920e+01, 1.85493477867032439e+01, 2.10260698174830658e+01,
+    2.33366641586453376e+01, 2.62169673055358494e+01, 2.82995188220460285e+01, 3.29094904073602166e+01,
+    1.98119293071275600e+01, 2.23620324948269413e+01, 2.47356048849315400e+01, 2.76882496104570492e+01,
+    2.98194712236532240e+01, 3.45281789748708903e+01, 2.10641442129970571e+01, 2.36847913048405800e+01,
+    2.61189480450373708e+01, 2.91412377406727963e+01, 3.13193496225952899e+01, 3.61232736803981425e+01,
+    2.23071295815786890e+01, 2.49957901397286300e+01, 2.74883928634429822e+01, 3.05779141668924943e+01,
+    3.28013206457918471e+01, 3.76972982183538292e+01, 2.35418289230961122e+01, 2.62962276048642387e+01,
+    2.88453507234047599e+01, 3.19999269088151799e+01, 3.42671865378266958e+01, 3.92523547907684787e+01,
+    2.47690353439014501e+01, 2.75871116382753243e+01, 3.01910091216398051e+01, 3.34086636050046195e+01,
+    3.57184656590046075e+01, 4.07902167069025197e+01, 2.59894230826372130e+01, 2.88692994303926334e+01,
+    3.15263784403866296e+01, 3.48053057347050725e+01, 3.71564514566067459e+01, 4.23123963316799632e+01,
+    2.72035710293568265e+01, 3.01435272056461585e+01, 3.28523268617297077e+01, 3.61908691292700553e+01,
+    3.85822565549342400e+01, 4.38201959645175307e+01, 2.84119805843056312e+01, 3.14104328442309253e+01,
+    3.41696069028383391e+01, 3.75662347866250528e+01, 3.99968463129386436e+01, 4.53147466181258594e+01,
+    2.96150894361827319e+01, 3.26705733409173078e+01, 3.54788759057272571e+01, 3.89321726835160646e+01,
+    4.14010647714176017e+01, 4.67970380415613150e+01, 3.08132823439530341e+01, 3.39244384714437999e+01,
+    3.67807120840355566e+01, 4.02893604375938637e+01, 4.27956549993085389e+01, 4.82679422908351725e+01,
+    3.20068996817042972e+01, 3.51724616269080599e+01, 3.80756272503558080e+01, 4.16383981188584755e+01,
+    4.41812752499711010e+01, 4.97282324664314928e+01, 3.31962442886281792e+01, 3.64150285018073134e+01,
+    3.93640770266039155e+01, 4.29798201393516379e+01, 4.55585119365305857e+01, 5.11785977773773908e+01,
+    3.43815870175529525e+01, 3.76524841334827798e+01, 4.06464691202751993e+01, 4.43141048962191633e+01,
+    4.69278901600807501e+01, 5.26196557761728414e+01, 3.55631712719234585e+01, 3.88851386598300408e+01,
+    4.19231700963539140e+01, 4.56416826662831525e+01, 4.82898823324568411e+01, 5.40519623885766407e+01,
+    3.67412167477976439e+01, 4.01132720694136253e+01, 4.31945109661560451e+01, 4.69629421247514429e+01,
+    4.96449152989942348e+01, 5.54760202057452076e+01, 3.79159225446970680e+01, 4.13371381514273963e+01,
+    4.44607918363177532e+01, 4.82782357703154972e+01, 5.09933762684994534e+01, 5.68922853933536032e+01,
+    3.90874697706939571e+01, 4.25569678042926824e+01, 4.57222858041745397e+01, 4.95878844728988284e+01,
+    5.23356177859336213e+01, 5.83011734897949268e+01, 4.02560237387117965e+01, 4.37729718257421894e+01,
+    4.69792422436711590e+01, 5.08921813115170920e+01, 5.36719619302405917e+01, 5.97030643044299296e+01,
+    4.14217358297852130e+01, 4.49853432803651359e+01, 4.82318895944519568e+01, 5.21913948331919286e+01,
+    5.50027038800238941e+01, 6.10983060810581193e+01, 4.25847450829808380e+01, 4.61942595202784716e+01,
+    4.94804377429716880e+01, 5.34857718362353651e+01, 5.63281149597109021e+01, 6.24872190570884953e+01,
+    4.37451795594341917e+01, 4.73998839190809207e+01, 5.07250800662812296e+01, 5.47755397601103482e+01,
+    5.76484452558585403e+01, 6.38700985223449607e+01, 4.49031575185199401e+01, 4.86023673672941925e+01,
+    5.19659951951219057e+01, 5.60609087477890782e+01, 5.89639258755193936e+01, 6.52472174609424371e+01,
+    4.60587884368366929e+01, 4.98018495682018667e+01, 5.32033485420564958e+01, 5.73420734338592482e+01,
+    6.02747709047810432e+01, 6.66188288437010812e+01, 4.72121738949373650e+01, 5.09984601657106467e+01,
+    5.44372936318132190e+01, 5.86192145016870541e+01, 6.15811791147572620e+01, 6.79851676260242357e+01,
+    4.83634083521943339e+01, 5.21923197301028736e+01, 5.56679732642611000e+01, 5.98925000450868978e+01,
+    6.28833354537411680e+01, 6.93464524962412128e+01, 4.95125798265755606e+01, 5.33835406229692992e+01,
+    5.68955205350559794e+01, 6.11620867636896861e+01, 6.41814123574062165e+01, 7.07028874115050030e+01,
+    5.06597704932137347e+01, 5.45722277589417359e+01, 5.81200597346862651e+01, 6.24281210161848961e+01,
+    6.54755709034680109e+01, 7.20546629519877797e+01, 5.18050572133175180e+01, 5.57584792788870303e+01,
+    5.93417071431711989e+01, 6.36907397515644647e+01, 6.67659618328039244e+01, 7.34019575189910398e+01,
+    5.29485120030820298e+01, 5.69423871468241032e+01, 6.05605717348437551e+01, 6.49500713352111774e+01,
+    6.80527264554416007e+01, 7.47449383984237699e+01, 5.40902024507124040e+01, 5.81240376808680281e+01,
+    6.17767558053491967e+01, 6.62062362839932490e+01, 6.93359974569004009e+01, 7.60837627077000462e+01,
+    5.52301920884089057e+01, 5.93035120268998099e+01, 6.29903555311019758e+01, 6.74593479223258328e+01,
+    7.06158996179663632e+01, 7.74185782413139378e+01, 5.63685407251187485e+01, 6.04808865823364386e+01,
+    6.42014614698867803e+01, 6.87095129693453970e+01, 7.18925504589991675e+01, 7.87495242280430148e+01,
+    5.75053047449959891e+01, 6.16562333762795660e+01, 6.54101590099995747e+01, 6.99568320658381992e+01,
+    7.31660608182250485e+01, 8.00767320108190290e+01, 5.86405373757917161e+01, 6.28296204114081789e+01,
+    6.66165287742504830e+01, 7.12014002483115434e+01, 7.44365353721017016e+01, 8.14003256587100168e+01,
+    5.97742889307959544e+01, 6.40011119722180268e+01, 6.78206469842524768e+01, 7.24433073765482476e+01,
+    7.57040731046947570e+01, 8.27204225191240283e+01, 6.09066070274483664e+01, 6.51707689035698365e+01,
+    6.90225857896660813e+01, 7.36826385201057548e+01, 7.69687677320445829e+01, 8.40371337172234831e+01,
+    6.20375367853096620e+01, 6.63386488629688102e+01, 7.02224135664345255e+01, 7.49194743084782004e+01,
+    7.82307080866899298e+01, 8.53505646085931033e+01, 6.31671210057263153e+01, 6.75048065495412004e+01,
+    7.14201951875064083e+01, 7.61538912490127160e+01, 7.94899784668289016e+01, 8.66608151904031416e+01,
+    6.42954003352158452e+01, 6.86692939122857950e+01, 7.26159922690857798e+01, 7.73859620161372561e+01,
+    8.07466589540132418e+01, 8.79679804756286501e+01, 6.54224134143397720e+01, 6.98321603398481301e+01,
+    7.38098633950607450e+01, 7.86157557150024786e+01, 8.20008257027753729e+01, 8.92721508343044690e+01,
+    6.65481970136092542e+01, 7.09934528337822854e+01, 7.50018643219286076e+01, 7.98433381222514669e+01,
+    8.32525512051611543e+01, 9.05734123052986604e+01, 6.76727861577774945e+01, 7.21532161670230892e+01,
+    7.61920481662500464e+01, 8.10687719062971013e+01, 8.45019045327764502e+01, 9.18718468816600904e+01,
+    6.87962142397093146e+01, 7.33114930290832518e+01, 7.73804655764191409e+01, 8.22921168291996707e+01,
+    8.57489515586410249e+01, 9.31675327722285402e+01, 6.99185131248763696e+01, 7.44683241593093754e+01,
+    7.85671648903241930e+01, 8.35134299319894069e+01, 8.69937551608717285e+01, 9.44605446418780588e+01,
+    7.10397132474043218e+01, 7.56237484693760678e+01, 7.97521922802903731e+01, 8.47327657050638265e+01,
+    8.82363754099821165e+01, 9.57509538324894436e+01, 7.21598436984921534e+01, 7.67778031560614806e+01,
+    8.09355918865363861e+01, 8.59501762451034637e+01, 8.94768697413810372e+01, 9.70388285665088119e+01,
+    7.32789323079308303e+01, 7.79305238052304219e+01, 8.21174059402382994e+01, 8.71657113997875683e+01,
+    9.07152931144757844e+01, 9.83242341347416016e+01, 7.43970057193685932e+01, 7.90819444878487303e+01,
+    8.32976748771731934e+01, 8.83794189014493270e+01, 9.19516981596297285e+01, 9.96072330698493715e+01,
+    7.55140894598991821e+01, 8.02320978487627201e+01, 8.44764374428090719e+01, 8.95913444906870495e+01,
+    9.31861353140890714e+01, 1.00887885306858294e+02, 7.66302080044877414e+01, 8.13810151888990987e+01,
+    8.56537307896153379e+01, 9.08015320308386862e+01, 9.44186529478744632e+01, 1.02166248331848763e+02,
+    7.77453848356948924e+01, 8.25287265414717979e+01, 8.68295905672861181e+01, 9.20100236141319954e+01,
+    9.56492974805284462e+01, 1.03442377319873131e+02, 7.88596424991116010e+01, 8.36752607427209796e+01,
+    8.80040510064975194e+01, 9.32168596602384127e+01, 9.68781134895179292e+01, 1.04716325263040574e+02,
+    7.99730026548754580e+01, 8.48206454976566704e+01, 8.91771449967561836e+01, 9.44220790078850314e+01,
+    9.81051438110094267e+01, 1.05988143089612862e+02, 8.10854861256016477e+01, 8.59649074412309631e+01,
+    9.03489041588409378e+01, 9.56257190001128947e+01, 9.93304296336631580e+01, 1.07257879774870617e+02,
+    8.21971129410289905e+01, 8.71080721953219381e+01, 9.15193589122895332e+01, 9.68278155637123206e+01,
+    1.00554010586028099e+02, 1.08525582444434761e+02, 8.33079023796519067e+01, 8.82501644218741319e+01,
+    9.26885385383385767e+01, 9.80284032833140913e+01, 1.01775924818063885e+02, 1.09791296470661720e+02,
+    8.44178730075835944e+01, 8.93912078725079766e+01, 9.38564712386853870e+01, 9.92275154705694717e+01,
+    1.02996209077264794e+02, 1.11055065562671501e+02, 8.55270427148718824e+01, 9.05312254348806675e+01,
+    9.50231841904061838e+01, 1.00425184228811347e+02, 1.04214898779816679e+02, 1.12316931850515672e+02,
+    8.66354287494692130e+01, 9.16702391760548494e+01, 9.61887035973332161e+01, 1.01621440513551988e+02,
+    1.05432028077177051e+02, 1.13576935963944820e+02, 8.77430477490390359e+01, 9.28082703831077112e+01,
+    9.73530547381661222e+01, 1.02816314189140684e+02, 1.06647629918433495e+02, 1.14835117106193252e+02,
+    8.88499157707649374e+01, 9.39453396011922450e+01, 9.85162620115678038e+01, 1.04009834081874985e+02,
+    1.07861736108762784e+02, 1.16091513123161008e+02, 8.99560483193135383e+01, 9.50814666692432553e+01,
+    9.96783489784723855e+01, 1.05202028029833102e+02, 1.09074377364284899e+02, 1.17346160568339243e+02,
+    9.10614603730889769e+01, 9.62166707535038483e+01, 1.00839338401813379e+02, 1.06392922929671784e+02,
+    1.10285583363579931e+02, 1.18599094763795264e+02, 9.21661664089050134e+01, 9.73509703790329581e+01,
+    1.01999252283861665e+02, 1.07582544780612267e+02, 1.11495382796112835e+02, 1.19850349857505208e+02,
+    9.32701804251896078e+01, 9.84843834593404353e+01, 1.03158111901346601e+02, 1.08770918725818305e+02,
+    1.12703803407789906e+02, 1.21099958877298661e+02, 9.43735159638273728e+01, 9.96169273242838500e+01,
+    1.04315937838519233e+02, 1.09958069091352755e+02, 1.13910872043851867e+02, 1.22347953781656742e+02,
+    9.54761861307362238e+01, 1.00748618746350331e+02, 1.05472750018303046e+02, 1.11144019422883758e+02,
+    1.15116614689291666e+02, 1.23594365507585010e+02, 9.65782036152670145e+01, 1.01879473965435878e+02,
+    1.06628567731665711e+02, 1.12328792520297313e+02, 1.16321056506969171e+02, 1.24839224015764799e+02,
+    9.76795807085070322e+01, 1.03009508712226179e+02, 1.07783409665334517e+02, 1.13512410470360550e+02,
+    1.17524221873581482e+02, 1.26082558333169487e+02, 9.87803293205625010e+01, 1.04138738230273873e+02,
+    1.08937293927968156e+02, 1.14694894677568030e+02, 1.18726134413634142e+02, 1.27324396593317900e+02,
+    9.98804609968885302e+01, 1.05267177296860339e+02, 1.10090238074888759e+02, 1.15876265893293336e+02,
+    1.19926817031547799e+02, 1.28564766074322733e+02, 1.00979986933730103e+02, 1.06394840242722509e+02,
+    1.11242259131469822e+02, 1.17056544243358232e+02, 1.21126291942023528e+02, 1.29803693234880143e+02,
+    1.02078917992732499e+02, 1.07521740970719463e+02, 1.12393373615268146e+02, 1.18235749254123178e+02,
+    1.22324580698781304e+02, 1.31041203748334965e+02, 1.03177264714774950e+02, 1.08647892973507609e+02,
+    1.13543597556981311e+02, 1.19413899877195036e+02, 1.23521704221776560e+02, 1.32277322534945910e+02,
+    1.04275037333077705e+02, 1.09773309350287960e+02, 1.14692946520306094e+02, 1.20591014512840545e+02,
+    1.24717682822992359e+02, 1.33512073792465685e+02, 1.05372245785628365e+02, 1.10898002822684475e+02,
+    1.15841435620767271e+02, 1.21767111032187358e+02, 1.25912536230897345e+02, 1.34745481025142311e+02,
+    1.06468899726970321e+02, 1.12021985749807868e+02, 1.16989079543581411e+02, 1.22942206798288595e+02,
+    1.27106283613652664e+02, 1.35977567071240401e+02, 1.07565008539392792e+02, 1.13145270142555404e+02,
+    1.18135892560615488e+02, 1.24116318686121261e+02, 1.28298943601145453e+02, 1.37208354129173216e+02,
+    1.08660581343559244e+02, 1.14267867677193550e+02, 1.19281888546495651e+02, 1.25289463101583678e+02,
+    1.29490534305920420e+02, 1.38437863782331050e+02, 1.09755627008608286e+02, 1.15389789708266846e+02,
+    1.20427080993917627e+02, 1.26461655999552548e+02, 1.30681073343076179e+02, 1.39666117022683608e+02,
+    1.10850154161758539e+02, 1.16511047280873555e+02, 1.21571483028206785e+02, 1.27632912901055860e+02,
+    1.31870577849188436e+02, 1.40893134273230572e+02, 1.11944171197447133e+02, 1.17631651142345547e+02,
+    1.22715107421171993e+02, 1.28803248909614211e+02, 1.33059064500317277e+02, 1.42118935409367538e+02,
+    1.13037686286029000e+02, 1.18751611753367371e+02, 1.23857966604295058e+02, 1.29972678726798762e+02,
+    1.34246549529152361e+02, 1.43343539779231293e+02, 1.14130707382062752e+02, 1.19870939298567137e+02,
+    1.25000072681293929e+02, 1.31141216667051992e+02, 1.35433048741345999e+02, 1.44566966223082829e+02,
+    1.15223242232206601e+02, 1.20989643696609576e+02, 1.26141437440095970e+02, 1.32308876671812612e+02,
+    1.36618577531080462e+02, 1.45789233091783899e+02, 1.16315298382746747e+02, 1.22107734609819431e+02,
+    1.27282072364254532e+02, 1.33475672322984934e+02, 1.37803150895913035e+02, 1.47010358264417647e+02,
+    1.17406883186778899e+02, 1.23225221453361812e+02, 1.28421988643840308e+02, 1.34641616855789124e+02,
+    1.38986783450939498e+02, 1.48230359165101703e+02, 1.18498003811062105e+02, 1.24342113404004081e+02,
+    1.29561197185836591e+02, 1.35806723171026789e+02, 1.40169489442313647e+02, 1.49449252779038716e+02,
+    1.19588667242563204e+02, 1.25458419408482385e+02, 1.30699708624065948e+02, 1.36971003846794048e+02,
+    1.41351282760158483e+02, 1.50667055667845460e+02, 1.20678880294708620e+02, 1.26574148191494331e+02,
+    1.31837533328673629e+02, 1.38134471149672663e+02, 1.42532176950902169e+02, 1.51883783984200733e+02,
+    1.21768649613359457e+02, 1.27689308263338248e+02, 1.32974681415191895e+02, 1.39297137045426467e+02,
+    1.43712185229069604e+02, 1.53099453485847789e+02, 1.22857981682524681e+02, 1.28803907927217665e+02,
+    1.34111162753207566e+02, 1.40459013209230648e+02, 1.44891320488558961e+02, 1.54314079548986399e+02,
+    1.23946882829826151e+02, 1.29917955286228931e+02, 1.35246986974653765e+02, 1.41620111035457711e+02,
+    1.46069595313430312e+02, 1.55527677181086403e+02, 1.25035359231728833e+02, 1.31031458250048701e+02,
+    1.36382163481745778e+02, 1.42780441647043830e+02, 1.47247021988231694e+02, 1.56740261033153104e+02,
+    1.26123416918548159e+02, 1.32144424541336633e+02, 1.37516701454579277e+02, 1.43940015904457169e+02,
+    1.48423612507887043e+02, 1.57951845411472817e+02, 1.27211061779246108e+02, 1.33256861701868189e+02,
+    1.38650609858408501e+02, 1.45098844414289033e+02, 1.49599378587168189e+02, 1.59162444288865629e+02,
+    1.28298299566026827e+02, 1.34368777098411215e+02, 1.39783897450620543e+02, 1.46256937537486294e+02,
+    1.50774331669772067e+02, 1.60372071315469753e+02, 1.29385135898741993e+02, 1.35480177928359524e+02,
+    1.40916572787421416e+02, 1.47414305397244220e+02, 1.51948482937023527e+02, 1.61580739829081807e+02,
+    1.30471576269115218e+02, 1.36591071225135011e+02, 1.42048644230247817e+02, 1.48570957886575741e+02,
+    1.53121843316221657e+02, 1.62788462865074507e+02, 1.31557626044794802e+02, 1.37701463863370719e+02,
+    1.43180119951918755e+02, 1.49726904675574019e+02, 1.54294423488648306e+02, 1.63995253165913311e+02,
+    1.32643290473243184e+02, 1.38811362563884700e+02, 1.44311007942539476e+02, 1.50882155218382621e+02,
+    1.55466233897254284e+02, 1.65201123190291270e+02, 1.33728574685470818e+02, 1.39920773898455735e+02,
+    1.45441316015169889e+02, 1.52036718759888231e+02, 1.56637284754040024e+02, 1.66406085121900531e+02,
+    1.34813483699622481e+02, 1.41029704294409726e+02, 1.46571051811269001e+02, 1.53190604342148902e+02,
+    1.57807586047144525e+02, 1.67610150877858615e+02, 1.35898022424422578e+02, 1.42138160039026474e+02,
+    1.47700222805925648e+02, 1.54343820810570548e+02, 1.58977147547657097e+02, 1.68813332116805213e+02,
+    1.36982195662486589e+02, 1.43246147283774860e+02, 1.48828836312886324e+02, 1.55496376819843732e+02,
+    1.60145978816164870e+02, 1.70015640246685649e+02, 1.38066008113504637e+02, 1.44353672048385079e+02,
+    1.49956899489389144e+02, 1.56648280839651846e+02, 1.61314089209048433e+02, 1.71217086432235277e+02,
+    1.39149464377303389e+02, 1.45460740224764834e+02, 1.51084419340813128e+02, 1.57799541160161709e+02,
+    1.62481487884537529e+02, 1.72417681602179215e+02, 1.40232568956791795e+02, 1.46567357580767435e+02,
+    1.52211402725151544e+02, 1.58950165897306221e+02, 1.63648183808537595e+02, 1.73617436456160164e+02,
+    1.72581210136248274e+02, 1.79580634154180530e+02, 1.85800447003793266e+02, 1.93207686385510584e+02,
+    1.98360205998645426e+02, 2.09264604774800745e+02, 2.26021047719688937e+02, 2.33994268892324925e+02,
+    2.41057895506310928e+02, 2.49445122981441614e+02, 2.55264155451523152e+02, 2.67540527822757213e+02,
+    3.31788519724539185e+02, 3.41395112108768728e+02, 3.49874468829915259e+02, 3.59906425950334892e+02,
+    3.66844446134908708e+02, 3.81425248520411515e+02, 5.40930308209816758e+02, 5.53126808934256928e+02,
+    5.63851529344285154e+02, 5.76492812511654506e+02, 5.85206616824898788e+02, 6.03446005795177598e+02,
+    1.05772390138161404e+03, 1.07467944880344089e+03, 1.08953091277491353e+03, 1.10696899435221735e+03,
+    1.11894806632319160e+03, 1.14391709261967912e+03, 1.28155156554460037e+00, 1.64485362695147264e+00,
+    1.95996398454005427e+00, 2.32634787404084120e+00, 2.57582930354890083e+00, 3.09023230616781364e+00
+};
+
+// F table numerator df
+const double f_table_df1[F_TABLE_DF1_COUNT] = {
+    1.00000000000000000e+00, 2.00000000000000000e+00, 3.00000000000000000e+00, 4.00000000000000000e+00,
+    5.00000000000000000e+00, 6.00000000000000000e+00, 7.00000000000000000e+00, 8.00000000000000000e+00,
+    9.00000000000000000e+00, 1.00000000000000000e+01, 1.20000000000000000e+01, 1.50000000000000000e+01,
+    2.00000000000000000e+01, 2.40000000000000000e+01, 3.00000000000000000e+01, 4.00000000000000000e+01,
+    5.00000000000000000e+01, 6.00000000000000000e+01, 8.00000000000000000e+01, 1.00000000000000000e+02,
+    1.20000000000000000e+02
+};
+
+// F table denominator df
+const double f_table_df2[F_TABLE_DF2_COUNT] = {
+    1.00000000000000000e+00, 2.00000000000000000e+00, 3.00000000000000000e+00, 4.00000000000000000e+00,
+    5.00000000000000000e+00, 6.00000000000000000e+00, 7.00000000000000000e+00, 8.00000000000000000e+00,
+    9.00000000000000000e+00, 1.00000000000000000e+01, 1.10000000000000000e+01, 1.20000000000000000e+01,
+    1.30000000000000000e+01, 1.40000000000000000e+01, 1.50000000000000000e+01, 1.60000000000000000e+01,
+    1.70000000000000000e+01, 1.80000000000000000e+01, 1.90000000000000000e+01, 2.00000000000000000e+01,
+    2.10000000000000000e+01, 2.20000000000000000e+01, 2.30000000000000000e+01, 2.40000000000000000e+01,
+    2.50000000000000000e+01, 2.60000000000000000e+01, 2.70000000000000000e+01, 2.80000000000000000e+01,
+    2.90000000000000000e+01, 3.00000000000000000e+01, 3.50000000000000000e+01, 4.00000000000000000e+01,
+    5.00000000000000000e+01, 6.00000000000000000e+01, 8.00000000000000000e+01, 1.00000000000000000e+02,
+    1.20000000000000000e+02
+};
+
+// F(1 - α; df1, df2) at [df1][df2][alpha]
+const double f_critical_table[F_TABLE_DF1_COUNT * F_TABLE_DF2_COUNT * CRITICAL_ALPHA_COUNT] = {
+    3.98634581890613973e+01, 1.61447638797588468e+02, 6.47789011477845293e+02, 4.05218069547682899e+03,
+    1.62107227202197519e+04, 4.05284067902848881e+05, 8.52631578947368318e+00, 1.85128205128205110e+01,
+    3.85063291139240462e+01, 9.85025125628140614e+01, 1.98501253132832062e+02, 9.98500250125062507e+02,
+    5.53831945626223821e+00, 1.01279644860139335e+01, 1.74434433207251267e+01, 3.41162215645298019e+01,
+    5.55519567392207492e+01, 1.67029223801554451e+02, 4.54477072037126639e+00, 7.70864742217679133e+00,
+    1.22178626330711069e+01, 2.11976895843913091e+01, 3.13327716240838186e+01, 7.41372933223024404e+01,
+    4.06041994687206653e+00, 6.60789097370336886e+00, 1.00069821966135883e+01, 1.62581770398336545e+01,
+    2.27847805299624824e+01, 4.71807792164132778e+01, 3.77594960258353218e+00, 5.98737760727370372e+00,
+    8.81310062867007815e+00, 1.37450225333041711e+01, 1.86349962426636964e+01, 3.55074902529522021e+01,
+    3.58942809086479819e+00, 5.59144785122073973e+00, 8.07266888013557349e+00, 1.22463833484350850e+01,
+    1.62355580911319066e+01, 2.92451933594417675e+01, 3.45791890388501555e+00, 5.31765507157871653e+00,
+    7.57088209969174919e+00, 1.12586241432726464e+01, 1.46881994735135297e+01, 2.54147604725598342e+01,
+    3.36030302387155011e+00, 5.11735502919922691e+00, 7.20928324752201810e+00, 1.05614310473953878e+01,
+    1.36136085691841764e+01, 2.28571251543147724e+01, 3.28501532170376276e+00, 4.96460274373071453e+00,
+    6.93672816629698552e+00, 1.00442892733965934e+01, 1.28264703843734189e+01, 2.10395952710039573e+01,
+    3.22520228205165704e+00, 4.84433567494362105e+00, 6.72412966023918646e+00, 9.64603411196624982e+00,
+    1.22263106765984571e+01, 1.96867856479194145e+01, 3.17654893102242797e+00, 4.74722534672251673e+00,
+    6.55376875300565676e+00, 9.33021210316855942e+00, 1.17542299225068998e+01, 1.86433215687855451e+01,
+    3.13620509302159833e+00, 4.66719273182685068e+00, 6.41425430025058319e+00, 9.07380572851566569e+00,
+    1.13735400131468332e+01, 1.78154204736190813e+01, 3.10221339438336852e+00, 4.60010993666942269e+00,
+    6.29793863110294971e+00, 8.86159266517642763e+00, 1.10602526727853228e+01, 1.71433602596906987e+01,
+    3.07318554959385848e+00, 4.54307716526697458e+00, 6.19950093780111100e+00, 8.68311681763895749e+00,
+    1.07980494897463029e+01, 1.65874163409652517e+01, 3.04810981108787349e+00, 4.49399847766635752e+00,
+    6.11512719770035673e+00, 8.53096528589619929e+00, 1.05754576550370203e+01, 1.61201955073014567e+01,
+    3.02623156140563410e+00, 4.45132177246813399e+00, 6.04201334395711864e+00, 8.39974014518964118e+00,
+    1.03841834312077257e+01, 1.57222263538485674e+01, 3.00697659179542587e+00, 4.41387341917056730e+00,
+    5.97805246478961472e+00, 8.28541955509966144e+00, 1.02180867583865655e+01, 1.53793059774078635e+01,
+    2.98990027987979579e+00, 4.38074969233179878e+00, 5.92163126233665427e+00, 8.18494682246892502e+00,
+    1.00725273973529053e+01, 1.50808410159464419e+01, 2.97465301746376776e+00, 4.35124350332929044e+00,
+    5.87149376580807569e+00, 8.09595806408569629e+00, 9.94393492093470144e+00, 1.48187755509573122e+01,
+    2.96095613757744980e+00, 4.32479374318304455e+00, 5.82664776415982200e+00, 8.01659694680848034e+00,
+    9.82951820123447106e+00, 1.45868780575483772e+01, 2.94858480246571553e+00, 4.30094950177765778e+00,
+    5.78629913300893062e+00, 7.94538572917003982e+00, 9.72706443330048742e+00, 1.43802550312356896e+01,
+    2.93735561362200048e+00, 4.27934430914464858e+00, 5.74980482570433526e+00, 7.88113364136836747e+00,
+    9.63479714718781466e+00, 1.41950117365686008e+01, 2.92711749135521160e+00, 4.25967727269023388e+00,
+    5.71663862751807006e+00, 7.82287059336798052e+00, 9.55127399480329764e+00, 1.40280108173798315e+01,
+    2.91774486025021806e+00, 4.24169905027714833e+00, 5.68636580978177530e+00, 7.76979841536899496e+00,
+    9.47531191889043356e+00, 1.38766974461999677e+01, 2.90913248820395065e+00, 4.22520127312748528e+00,
+    5.65862410043104536e+00, 7.72125445773759900e+00, 9.40593152844485658e+00, 1.37389706169105974e+01,
+    2.90119152933049929e+00, 4.21000846835975562e+00, 5.63310920958783701e+00, 7.67668404888748501e+00,
+    9.34231517584417936e+00, 1.36130870120270622e+01, 2.89384645551648134e+00, 4.19597181855776569e+00,
+    5.60956368814048378e+00, 7.63561939776281218e+00, 9.28377496024619298e+00, 1.34975882411138084e+01,
+    2.88703265229656525e+00, 4.18296428905826989e+00, 5.58776825782234354e+00, 7.59766324995401998e+00,
+    9.22972802388866853e+00, 1.33912450964953926e+01, 2.88069451716170777e+00, 4.17087678576669330e+00,
+    5.56753499651077455e+00, 7.56247609463863046e+00, 9.17967727602204597e+00, 1.32930143684374826e+01,
+    2.85465509008964835e+00, 4.12133820034490039e+00, 5.48482019886859629e+00, 7.41911688780124035e+00,
+    8.97629530068820891e+00, 1.28963351654161471e+01, 2.83535423511150420e+00, 4.08474573330165569e+00,
+    5.42393715159220680e+00, 7.31409992920511787e+00, 8.82785886367382844e+00, 1.26093578348235553e+01,
+    2.80865765336692252e+00, 4.03430970680299783e+00, 5.34032321758807171e+00, 7.17057680189606561e+00,
+    8.62575803836416632e+00, 1.22221060697894259e+01, 2.79106762980715040e+00, 4.00119137675499381e+00,
+    5.28561058801669770e+00, 7.07710579361413039e+00, 8.49461671488444026e+00, 1.19729872870266814e+01,
+    2.76931061306623860e+00, 3.96035242061495119e+00, 5.21835368887970485e+00, 6.96268806323521883e+00,
+    8.33460762185322324e+00, 1.16713616301927203e+01, 2.75637801751204092e+00, 3.93614298631265003e+00,
+    5.17859390492450888e+00, 6.89530103057802535e+00, 8.24064017130503501e+00, 1.14954313310801393e+01,
+    2.74780650413322158e+00, 3.92012440896991832e+00, 5.15233148288462584e+00, 6.85089345085253765e+00,
+    8.17882695317992514e+00, 1.13801903286285366e+01, 4.94999999999999929e+01, 1.99499999999999972e+02,
+    7.99499999999999886e+02, 4.99950000000000000e+03, 1.99995000000000000e+04, 4.99999500000000000e+05,
+    9.00000000000000000e+00, 1.90000000000000000e+01, 3.90000000000000000e+01, 9.90000000000000000e+01,
+    1.99000000000000000e+02, 9.99000000000000000e+02, 5.46238325041916806e+00, 9.55209449592115867e+00,
+    1.60441064292771962e+01, 3.08165203504782568e+01, 4.97992784003009064e+01, 1.48500000000000000e+02,
+    4.32455532033675816e+00, 6.94427190999915833e+00, 1.06491106406735163e+01, 1.80000000000000000e+01,
+    2.62842712474619020e+01, 6.12455532033675851e+01, 3.77971607877395011e+00, 5.78613504334996698e+00,
+    8.43362073943278112e+00, 1.32739336120048304e+01, 1.83138301850468288e+01, 3.71223298115278340e+01,
+    3.46330407009565100e+00, 5.14325284978471942e+00, 7.25985568006018145e+00, 1.09247665008383361e+01,
+    1.45441064292771962e+01, 2.70000000000000000e+01, 3.25744205109137530e+00, 4.73741412777588344e+00,
+    6.54152029709565142e+00, 9.54657802110228992e+00, 1.24039567483676976e+01, 2.16889985550403210e+01,
+    3.11311764015569103e+00, 4.45897010752451273e+00, 6.05946743746348293e+00, 8.64911064067351809e+00,
+    1.10424123723455736e+01, 1.84936530076139647e+01, 3.00645241740026448e+00, 4.25649472909374893e+00,
+    5.71470538638305836e+00, 8.02151730993205980e+00, 1.01067135615907659e+01, 1.63871497512575033e+01,
+    2.92446596230556732e+00, 4.10282101513040143e+00, 5.45639552591273258e+00, 7.55943215754790021e+00,
+    9.42699905907213598e+00, 1.49053585276748617e+01, 2.85951095624113538e+00, 3.98229795709448542e+00,
+    5.25588931192072817e+00, 7.20571335045737893e+00, 8.91224975684987086e+00, 1.38115545381832217e+01,
+    2.80679560573241726e+00, 3.88529383465239420e+00, 5.09586716578394228e+00, 6.92660814019130200e+00,
+    8.50962705073174419e+00, 1.29736659610102762e+01, 2.76316735696948745e+00, 3.80556525297805726e+00,
+    4.96526572290434398e+00, 6.70096453588078234e+00, 8.18648856100082156e+00, 1.23127298106588814e+01,
+    2.72646846061196335e+00, 3.73889183244073697e+00, 4.85669786067516807e+00, 6.51488410218275149e+00,
+    7.92164181573689152e+00, 1.17788705669580800e+01, 2.69517293158894189e+00, 3.68232034367324168e+00,
+    4.76504828388820645e+00, 6.35887348066718161e+00, 7.70075862402317224e+00, 1.13391482363218508e+01,
+    2.66817145730659222e+00, 3.63372346759162923e+00, 4.68666540109794649e+00, 6.22623528031138207e+00,
+    7.51381957989486171e+00, 1.09709896452932423e+01, 2.64463846808329617e+00, 3.59153056847508179e+00,
+    4.61887432751439686e+00, 6.11211371579788221e+00, 7.35361608369793895e+00, 1.06584381902457217e+01,
+    2.62394698513395497e+00, 3.55455714566178882e+00, 4.55967171265200832e+00, 6.01290483480052895e+00,
+    7.21483407588969960e+00, 1.03899122102869530e+01, 2.60561236417977105e+00, 3.52189326057882690e+00,
+    4.50752799516868130e+00, 5.92587902229285746e+00, 7.09347284845181836e+00, 1.01568117705905010e+01,
+    2.58925411794167193e+00, 3.49282847673563301e+00, 4.46125549591924742e+00, 5.84893192461113465e+00,
+    6.98646464634247266e+00, 9.95262314968879558e+00, 2.57456938971784499e+00, 3.46680011154241763e+00,
+    4.41991816642085400e+00, 5.78041568824255769e+00, 6.89141878196955027e+00, 9.77232615327412724e+00,
+    2.56131413386272744e+00, 3.44335677936672324e+00, 4.38276843946680561e+00, 5.71902191248227076e+00,
+    6.80644531204072578e+00, 9.61199165146422452e+00, 2.54928951346310795e+00, 3.42213220786117889e+00,
+    4.34920215470742733e+00, 5.66369876809603934e+00, 6.73003091707949164e+00, 9.46850200998707336e+00,
+    2.53833190354306115e+00, 3.40282610535019492e+00, 4.31872580745245038e+00, 5.61359121146483453e+00,
+    6.66094984767822140e+00, 9.33935292046707310e+00, 2.52830543271766128e+00, 3.38518996144917006e+00,
+    4.29093236699631131e+00, 5.56799713432409416e+00, 6.59819892779188955e+00, 9.22251035936719354e+00,
+    2.51909634228767443e+00, 3.36901635949544431e+00, 4.26548316136889749e+00, 5.52633471393897580e+00,
+    6.54094937780714325e+00, 9.11630563808365579e+00, 2.51060866655854120e+00, 3.35413082852919775e+00,
+    4.24209412653372908e+00, 5.48811776842070120e+00, 6.48851060078230102e+00, 9.01935725220079298e+00,
+    2.50276088711022249e+00, 3.34038555823775862e+00, 4.22052524212473745e+00, 5.45293692122392670e+00,
+    6.44030261127836035e+00, 8.93051189735689732e+00, 2.49548331423546266e+00, 3.32765449857206042e+00,
+    4.20057232525098723e+00, 5.42044504030731211e+00, 6.39583479740939520e+00, 8.84879939963362006e+00,
+    2.48871601769747608e+00, 3.31582950101352214e+00, 4.18206059099611416e+00, 5.39034586317788467e+00,
+    6.35468938478607726e+00, 8.77339788691670286e+00, 2.46093616739811427e+00, 3.26742352474249786e+00,
+    4.10649561920049777e+00, 5.26794129593954974e+00, 6.18784087649754078e+00, 8.46968130693239196e+00,
+    2.44036908603926861e+00, 3.23172699283084564e+00, 4.05099207593669952e+00, 5.17850823588334386e+00,
+    6.06642641126126669e+00, 8.25075089245508586e+00, 2.41195490357962505e+00, 3.18260985204277524e+00,
+    3.97493086013865815e+00, 5.05661086543532257e+00, 5.90161721317501620e+00, 7.95641846391017715e+00,
+    2.39325486983128943e+00, 3.15041131058272894e+00, 3.92526544420495505e+00, 4.97743203539495216e+00,
+    5.79499075411480824e+00, 7.76776235382501667e+00, 2.37014900709155496e+00, 3.11076616608045908e+00,
+    3.86432908497445560e+00, 4.88073817207853722e+00, 5.66523965666775453e+00, 7.54008909748073730e+00,
+    2.35642740254497651e+00, 3.08729589274893090e+00, 3.82836692687105673e+00, 4.82390980715925100e+00,
+    5.58922306812267067e+00, 7.40768107484413729e+00, 2.34733823011015064e+00, 3.07177940465868504e+00,
+    3.80463818018714095e+00, 4.78650973966257887e+00, 5.53929272195250810e+00, 7.32110725811780583e+00,
+    5.35932446586712956e+01, 2.15707345369609101e+02, 8.64162972163529730e+02, 5.40335201373854579e+03,
+    2.16147413985688800e+04, 5.40379201647996204e+05, 9.16179016817973491e+00, 1.91642921275112919e+01,
+    3.91654945640136560e+01, 9.91662013744715694e+01, 1.99166434604685577e+02, 9.99166620347207868e+02,
+    5.39077328032978276e+00, 9.27662815314480760e+00, 1.54391823787472902e+01, 2.94566951267546493e+01,
+    4.74672282528919709e+01, 1.41108461204539140e+02, 4.19086043887224413e+00, 6.59138211642558147e+00,
+    9.97919853224388653e+00, 1.66943692371750814e+01, 2.42591198902626317e+01, 5.61771884894634042e+01,
+    3.61947741253958943e+00, 5.40945131805649115e+00, 7.76358948201854826e+00, 1.20599536916519874e+01,
+    1.65297704604982734e+01, 3.32024631848769118e+01, 3.28876156345824100e+00, 4.75706266308941572e+00,
+    6.59879852195647310e+00, 9.77953824092327650e+00, 1.29166013230126495e+01, 2.37033086499108485e+01,
+    3.07407199390900088e+00, 4.34683139990781786e+00, 5.88981916720325582e+00, 8.45128505307998878e+00,
+    1.08824474913476248e+01, 1.87722698150989906e+01, 2.92379628831377980e+00, 4.06618055135116219e+00,
+    5.41596233956023809e+00, 7.59099194759885432e+00, 9.59647499149693495e+00, 1.58294895815206704e+01,
+    2.81286299718238819e+00, 3.86254835762476523e+00, 5.07811865222871273e+00, 6.99191722223346535e+00,
+    8.71705528405813901e+00, 1.39018031910331423e+01, 2.72767314116506920e+00, 3.70826481904684435e+00,
+    4.82562149340540802e+00, 6.55231255751521147e+00, 8.08074665269088399e+00, 1.25527453889437286e+01,
+    2.66022868376531285e+00, 3.58743370242049542e+00, 4.63002496182934387e+00, 6.21672981153865223e+00,
+    7.60043267519808552e+00, 1.15611258499970599e+01, 2.60552492083067788e+00, 3.49029481949760578e+00,
+    4.47418480963774901e+00, 5.95254468154586824e+00, 7.22576441359092936e+00, 1.08042043777204526e+01,
+    2.56027289819033887e+00, 3.41053364462784758e+00, 4.34717808270985273e+00, 5.73938028277337775e+00,
+    6.92575505935337254e+00, 1.02089355886411326e+01, 2.52222359753477754e+00, 3.34388867811891322e+00,
+    4.24172763035918976e+00, 5.56388583969374562e+00, 6.68035269441793478e+00, 9.72936631462993873e+00,
+    2.48978773387781516e+00, 3.28738210463651193e+00, 4.15280403006287635e+00, 5.41696485781842085e+00,
+    6.47603896337405160e+00, 9.33525358483929502e+00, 2.46181075324354470e+00, 3.23887151745358581e+00,
+    4.07682306196248057e+00, 5.29221404552094743e+00, 6.30338458337182495e+00, 9.00593685556037649e+00,
+    2.43743391457984204e+00, 3.19677684094334413e+00, 4.01116311807388026e+00, 5.18499991729522058e+00,
+    6.15562073869479409e+00, 8.72685203612592097e+00, 2.41600537717794106e+00, 3.15990758980072517e+00,
+    3.95386336494896851e+00, 5.09188952041401244e+00, 6.02776759729007061e+00, 8.48745452828306313e+00,
+    2.39702150344995335e+00, 3.12735000511340022e+00, 3.90342849182294405e+00, 5.01028684361960419e+00,
+    5.91608286766277658e+00, 8.27993210617640152e+00, 2.38008705106960683e+00, 3.09839121214077995e+00,
+    3.85869866627321567e+00, 4.93819338231053884e+00, 5.81770166270889000e+00, 8.09837978658340241e+00,
+    2.36488752983563222e+00, 3.07246698639687699e+00, 3.81876068059136831e+00, 4.87404619700069563e+00,
+    5.73039472984624343e+00, 7.93825504515983749e+00, 2.35116960007934539e+00, 3.04912498865241144e+00,
+    3.78288585914206132e+00, 4.81660577781605781e+00, 5.65240216050903221e+00, 7.79600870321115291e+00,
+    2.33872691170117220e+00, 3.02799838233219898e+00, 3.75048578952193834e+00, 4.76487675937441058e+00,
+    5.58231652981548798e+00, 7.66882905003215232e+00, 2.32738970121198374e+00, 3.00878657044736153e+00,
+    3.72108019091511055e+00, 4.71805080749580075e+00, 5.51899918266493561e+00, 7.55446081027801775e+00,
+    2.31701703333883335e+00, 2.99124090954995259e+00, 3.69427321314315504e+00, 4.67546478232591411e+00,
+    5.46151922272600387e+00, 7.45107470270893479e+00, 2.30749093524252746e+00, 2.97515396397339282e+00,
+    3.66973569766867280e+00, 4.63656962433434838e+00, 5.40910835058122164e+00, 7.35717189179527598e+00,
+    2.29871190607198095e+00, 2.96035131841128862e+00, 3.64719172375227885e+00, 4.60090689466228664e+00,
+    5.36112695889102753e+00, 7.27151294680398674e+00, 2.29059543999741200e+00, 2.94668526601726599e+00,
+    3.62640828044846630e+00, 4.56809086367957473e+00, 5.31703834934961961e+00, 7.19306430073386061e+00,
+    2.28306930567571076e+00, 2.93402988966417233e+00, 3.60718724981432848e+00, 4.53779467776113332e+00,
+    5.27638889391655486e+00, 7.12095739484288881e+00, 2.27607139696830751e+00, 2.92227719064503866e+00,
+    3.58935912035185867e+00, 4.50973956245906482e+00, 5.23879260409363390e+00, 7.05445714659111633e+00,
+    2.24735015200921717e+00, 2.87418748350085096e+00, 3.51663104087968659e+00, 4.39574909467510277e+00,
+    5.08649758576897337e+00, 6.78696951674881888e+00, 2.22609157557687753e+00, 2.83874539802064252e+00,
+    3.46325965953484394e+00, 4.31256921249214376e+00, 4.97584099815415293e+00, 6.59453997766178279e+00,
+    2.19672975730503506e+00, 2.79000840640220149e+00, 3.39018878031185311e+00, 4.19934344600549814e+00,
+    4.82586925448938775e+00, 6.33637056966754209e+00, 2.17741094493784715e+00, 2.75807829584258313e+00,
+    3.34251972652912555e+00, 4.12589193079566563e+00, 4.72899121476460582e+00, 6.17123078444597528e+00,
+    2.15354588527919866e+00, 2.71878498163493987e+00, 3.28408125970792719e+00, 4.03629672572250087e+00,
+    4.61126656448186800e+00, 5.97230473150633046e+00, 2.13937624096062962e+00, 2.69553425488813936e+00,
+    3.24961884751657104e+00, 3.98369531388089104e+00, 4.54238188983708735e+00, 5.85680692962758531e+00,
+    2.12999144497697879e+00, 2.68016756985024029e+00, 3.22689025533082585e+00, 3.94909979252077870e+00,
+    4.49717148355740992e+00, 5.78136831674751939e+00, 5.58329611225130122e+01, 2.24583240626250756e+02,
+    8.99583310178037777e+02, 5.62458332962944678e+03, 2.24995833324073938e+04, 5.62499583333296236e+05,
+    9.24341649025256906e+00, 1.92467943448089613e+01, 3.92484176581314941e+01, 9.92493718553309918e+01,
+    1.99249686716300005e+02, 9.99249937468730423e+02, 5.34264447848146862e+00, 9.11718225324642262e+00,
+    1.51009789320459369e+01, 2.87098983872981925e+01, 4.61946223300927841e+01, 1.37100362721510947e+02,
+    4.10724954225052219e+00, 6.38823290869587090e+00, 9.60452988472286329e+00, 1.59770248525576744e+01,
+    2.31545014379014411e+01, 5.34358291227604667e+01, 3.52019624553412402e+00, 5.19216777280392439e+00,
+    7.38788575126775360e+00, 1.13919280713497653e+01, 1.55560598045466332e+01, 3.10850055717537899e+01,
+    3.18076286505832018e+00, 4.53367695027524498e+00, 6.22716116435764278e+00, 9.14830103022785224e+00,
+    1.20275302934088160e+01, 2.19235413616763317e+01, 2.96053408873509571e+00, 4.12031172689763459e+00,
+    5.52259434530855220e+00, 7.84664506254660044e+00, 1.00504912475345485e+01, 1.71979937756840258e+01,
+    2.80642570613764120e+00, 3.83785335455589838e+00, 5.05263221736351387e+00, 7.00607662295558864e+00,
+    8.80512952500288293e+00, 1.43915845143823748e+01, 2.69268006250234126e+00, 3.63308851141908118e+00,
+    4.71807845812819338e+00, 6.42208545815319987e+00, 7.95588513210108417e+00, 1.25603187395907394e+01,
+    2.60533643134858073e+00, 3.47804969076523030e+00, 4.46834157822528155e+00, 5.99433866162936457e+00,
+    7.34280573709273909e+00, 1.12827515121315454e+01, 2.53618823220683165e+00, 3.35669002113259385e+00,
+    4.27507159633661438e+00, 5.66830021287877184e+00, 6.88089093951188602e+00, 1.03461159651694192e+01,
+    2.48010209357267897e+00, 3.25916672690124987e+00, 4.12120861852344156e+00, 5.41195143447313942e+00,
+    6.52113874605845023e+00, 9.63272610279253527e+00, 2.43370534094074120e+00, 3.17911705254018750e+00,
+    3.99589755349416809e+00, 5.20533018941624359e+00, 6.23345630751327384e+00, 9.07273830866100006e+00,
+    2.39469210420601986e+00, 3.11224984796138937e+00, 3.89191443776571333e+00, 5.03537797332943793e+00,
+    5.99840651092376653e+00, 8.62231963738263474e+00, 2.36143311586946369e+00, 3.05556827590659452e+00,
+    3.80427134184101279e+00, 4.89320958932158057e+00, 5.80290686148270485e+00, 8.25268374470154953e+00,
+    2.33274486935362546e+00, 3.00691727992434554e+00, 3.72941654559304858e+00, 4.77257799972321273e+00,
+    5.63784524444637825e+00, 7.94420227109888888e+00, 2.30774713299584544e+00, 2.96470811004107881e+00,
+    3.66475409103620953e+00, 4.66896760195141436e+00, 5.49668891405820315e+00, 7.68306208921354816e+00,
+    2.28577177241806284e+00, 2.92774417280718424e+00, 3.60834357189543509e+00, 4.57903596659845036e+00,
+    5.37463724287823030e+00, 7.45927751480421808e+00, 2.26630256748803838e+00, 2.89510730750784218e+00,
+    3.55870609858558229e+00, 4.50025769890669913e+00, 5.26808635275427140e+00, 7.26546060034929830e+00,
+    2.24893440177304216e+00, 2.86608140201565842e+00, 3.51469516225840994e+00, 4.43069016143777539e+00,
+    5.17427991448808022e+00, 7.09603406732251685e+00, 2.23334492577724708e+00, 2.84009980747538382e+00,
+    3.47540846205264842e+00, 4.36881517407819064e+00, 5.09107498751422138e+00, 6.94671241124686656e+00,
+    2.21927446493124947e+00, 2.81670833964025347e+00, 3.44012632634102422e+00, 4.31342949695958300e+00,
+    5.01678113202957743e+00, 6.81415080165914411e+00, 2.20651150510032412e+00, 2.79553873736138803e+00,
+    3.40826783495205810e+00, 4.26356745945749793e+00, 4.95004745438202320e+00, 6.69570199385951881e+00,
+    2.19488203032552098e+00, 2.77628928925147767e+00, 3.37935898773912058e+00, 4.21844526735626690e+00,
+    4.88978176315037594e+00, 6.58924454282064076e+00, 2.18424157125815821e+00, 2.75871046971763301e+00,
+    3.35300923614829882e+00, 4.17742023464564038e+00, 4.83509169844529474e+00, 6.49305915706316839e+00,
+    2.17446919343144218e+00, 2.74259413722185919e+00, 3.32889392588097399e+00, 4.13996048369501146e+00,
+    4.78524118783144203e+00, 6.40573821826026268e+00, 2.16546289513097401e+00, 2.72776530603398815e+00,
+    3.30674098617346379e+00, 4.10562211308335012e+00, 4.73961777943386320e+00, 6.32611857134968680e+00,
+    2.15713604396101699e+00, 2.71407580414507832e+00, 3.28632071546611515e+00, 4.07403177491960999e+00,
+    4.69770781692505146e+00, 6.25323091522370600e+00, 2.14941458864781021e+00, 2.70139933192326653e+00,
+    3.26743785559113675e+00, 4.04487322608457234e+00, 4.65907734990170486e+00, 6.18626121623725300e+00,
+    2.14223485628849941e+00, 2.68962757369141814e+00, 3.24992537856340347e+00, 4.01787683658752393e+00,
+    4.62335729460482714e+00, 6.12452095047872103e+00, 2.11276510463933320e+00, 2.64146518612856696e+00,
+    3.17850503509123294e+00, 3.90824092806367407e+00, 4.47875196828106503e+00, 5.87640153796762643e+00,
+    2.09094999885991761e+00, 2.60597494912386729e+00, 3.12611416809360421e+00, 3.82829354940487310e+00,
+    4.37377545575633953e+00, 5.69813414374460514e+00, 2.06081565353971641e+00, 2.55717914997635898e+00,
+    3.05441497405266960e+00, 3.71954519188080868e+00, 4.23163204281444205e+00, 5.45928316443461270e+00,
+    2.04098589764888105e+00, 2.52521510198287880e+00, 3.00765936840466575e+00, 3.64904749109499793e+00,
+    4.13989373025775276e+00, 5.30670155809819999e+00, 2.01648649412241143e+00, 2.48588493774886743e+00,
+    2.95036120175377503e+00, 3.56310963440749928e+00, 4.02850597428082136e+00, 5.12312262091091508e+00,
+    2.00193845084894706e+00, 2.46261492591164100e+00, 2.91658201358639646e+00, 3.51268406360498586e+00,
+    3.96337719140362577e+00, 5.01665039658380252e+00, 1.99230227247235225e+00, 2.44723651146929910e+00,
+    2.89430845587415453e+00, 3.47953138957774621e+00, 3.92065164296583690e+00, 4.94715418504945159e+00,
+    5.72400771323514235e+01, 2.30161878110106699e+02, 9.21847903299709287e+02, 5.76364955415571421e+03,
+    2.30557982322376920e+04, 5.76404555831924314e+05, 9.29262634632167561e+00, 1.92964096520172497e+01,
+    3.92982277754033191e+01, 9.92992964778641181e+01, 1.99299649122242784e+02, 9.99299929964977991e+02,
+    5.30915701949683339e+00, 9.01345516752258646e+00, 1.48848229206419713e+01, 2.82370808377550588e+01,
+    4.53916457134714975e+01, 1.34580021957488327e+02, 4.05057906898747078e+00, 6.25605650216088804e+00,
+    9.36447081580829455e+00, 1.55218575444252451e+01, 2.24564255409194935e+01, 5.17115685613262670e+01,
+    3.45298224803790488e+00, 5.05032905763264672e+00, 7.14638182873283423e+00, 1.09670206509079957e+01,
+    1.49396054599122294e+01, 2.97523985773161321e+01, 3.10751166663893086e+00, 4.38737418740612917e+00,
+    5.98756512604693114e+00, 8.74589525601991902e+00, 1.14636956594962509e+01, 2.08026639594567051e+01,
+    2.88334449567821283e+00, 3.97152315061134331e+00, 5.28523685150427980e+00, 7.46043549298926578e+00,
+    9.52205882351948496e+00, 1.62058003237019008e+01, 2.72644691539052575e+00, 3.68749866634002821e+00,
+    4.81727555526553441e+00, 6.63182516450959358e+00, 8.30179884507165511e+00, 1.34846894472492949e+01,
+    2.61061255002997017e+00, 3.48165865390152396e+00, 4.48441131418503591e+00, 6.05694071411867085e+00,
+    7.47115810851096107e+00, 1.17136673115662848e+01, 2.52164068620962345e+00, 3.32583453041301214e+00,
+    4.23608566818863430e+00, 5.63632618766907889e+00, 6.87236675701348698e+00, 1.04807224680978948e+01,
+    2.45118434297480059e+00, 3.20387426272962150e+00, 4.04399822206868986e+00, 5.31600891860849423e+00,
+    6.42174548103477427e+00, 9.57837504106741555e+00, 2.39402225684223247e+00, 3.10587523908412422e+00,
+    3.89113393390238871e+00, 5.06434311114291624e+00, 6.07113170191844187e+00, 8.89210920746491595e+00,
+    2.34672375511130316e+00, 3.02543830009825809e+00, 3.76667405523332954e+00, 4.86162120790680063e+00,
+    5.79098869904667879e+00, 8.35408826260126425e+00, 2.30694305140072276e+00, 2.95824891312219673e+00,
+    3.66342311398308906e+00, 4.69496357939771691e+00, 5.56226117326690694e+00, 7.92180735838270866e+00,
+    2.27302244786757157e+00, 2.90129453623615818e+00, 3.57641534927906202e+00, 4.55561398465300726e+00,
+    5.37213686997909878e+00, 7.56739197817755027e+00, 2.24375760368383403e+00, 2.85240916508198739e+00,
+    3.50211633550587820e+00, 4.43742049553960083e+00, 5.21170001699705754e+00, 7.27185948645956781e+00,
+    2.21825264878412032e+00, 2.80999617452959694e+00, 3.43794370091009638e+00, 4.33593908318307530e+00,
+    5.07456379152343562e+00, 7.02186626553638948e+00, 2.19582746752374058e+00, 2.77285315299783086e+00,
+    3.38196780587524293e+00, 4.24788215023173699e+00, 4.95603818397052454e+00, 6.80777586700329973e+00,
+    2.17595649656504575e+00, 2.74005754168534521e+00, 3.33271837280472560e+00, 4.17076698061480755e+00,
+    4.85260464217248355e+00, 6.62246530615952800e+00, 2.15822722016842583e+00, 2.71088983720969123e+00,
+    3.28905584568040821e+00, 4.10268463058473287e+00, 4.76157367515320651e+00, 6.46056184970736069e+00,
+    2.14231134886674823e+00, 2.68478073017484764e+00, 3.25008358767809646e+00, 4.04214386117412250e+00,
+    4.68085542172561908e+00, 6.31794033915000863e+00, 2.12794438184793799e+00, 2.66127391711803662e+00,
+    3.21508658098901501e+00, 3.98796322312694684e+00, 4.60880211620041891e+00, 6.19138337019891427e+00,
+    2.11491084122425876e+00, 2.63999942605299598e+00, 3.18348776023578184e+00, 3.93919485474119302e+00,
+    4.54409755547549921e+00, 6.07834620938947623e+00, 2.10303342400755877e+00, 2.62065414786288731e+00,
+    3.15481634253311460e+00, 3.89506965481708534e+00, 4.48567803270719789e+00, 5.97679079286843429e+00,
+    2.09216491108067260e+00, 2.60298740278706342e+00, 3.12868448362949758e+00, 3.85495716466300387e+00,
+    4.43267479089291161e+00, 5.88506632969027699e+00, 2.08218204931930062e+00, 2.58679008706259150e+00,
+    3.10476981750297565e+00, 3.81833576278989595e+00, 4.38437147876929689e+00, 5.80182198946436056e+00,
+    2.07298086765609479e+00, 2.57188640578415395e+00, 3.08280222170542784e+00, 3.78477021324144403e+00,
+    4.34017224838025317e+00, 5.72594208632260404e+00, 2.06447304988195590e+00, 2.55812750111080955e+00,
+    3.06255366320679734e+00, 3.75389453883085400e+00, 4.29957752112970670e+00, 5.65649730084771019e+00,
+    2.05658309622864799e+00, 2.54538648794854527e+00, 3.04383032055835612e+00, 3.72539880480220864e+00,
+    4.26216535994232704e+00, 5.59270751031551505e+00, 2.04924608068576841e+00, 2.53355454755927090e+00,
+    3.02646640921588528e+00, 3.69901881141257149e+00, 4.22757699424911149e+00, 5.53391313845015809e+00,
+    2.01912439255369369e+00, 2.48514322137300780e+00, 2.95565809350915876e+00, 3.59191355895147613e+00,
+    4.08760497489550367e+00, 5.29777526949068811e+00, 1.99681976979383879e+00, 2.44946642638871026e+00,
+    2.90372232049415313e+00, 3.51383983313736969e+00, 3.98604571050502532e+00, 5.12826342466233864e+00,
+    1.96599885602908175e+00, 2.40040912709928733e+00, 2.83265407599141339e+00, 3.40767950503013717e+00,
+    3.84860446108192500e+00, 4.90134818983182541e+00, 1.94571032780652442e+00, 2.36827023570107054e+00,
+    2.78631480414974009e+00, 3.33888442244953154e+00, 3.75994847987142311e+00, 4.75652075004263075e+00,
+    1.92063596281150217e+00, 2.32872058860786701e+00, 2.72953188743260045e+00, 3.25504929774503582e+00,
+    3.65235548826032907e+00, 4.58241280631787351e+00, 1.90574201344576788e+00, 2.30531824167522625e+00,
+    2.69605895805812379e+00, 3.20587177142300161e+00, 3.58947292570752508e+00, 4.48150772951361720e+00,
+    1.89587479772432244e+00, 2.28985128314358333e+00, 2.67398832284031318e+00, 3.17354547515233332e+00,
+    3.54823222501250246e+00, 4.41567580729781817e+00, 5.82044164305558596e+01, 2.33986000356266175e+02,
+    9.37111083448202635e+02, 5.85898610668619949e+03, 2.34371111100049238e+04, 5.85937111111066886e+05,
+    9.32553045463929031e+00, 1.93295340151540280e+01, 3.93314579624102763e+01, 9.93325888654034088e+01,
+    1.99332962034111745e+02, 9.99333259222198876e+02, 5.28473156008055156e+00, 8.94064512077038032e+00,
+    1.47347184130391593e+01, 2.79106573576960315e+01, 4.48384683343173123e+01, 1.32847468902081658e+02,
+    4.00974931267394474e+00, 6.16313228268863433e+00, 9.19731107936621406e+00, 1.52068648611575306e+01,
+    2.19745792538314717e+01, 5.05250219491326504e+01, 3.40450658498496761e+00, 4.95028806869432003e+00,
+    6.97770185853556768e+00, 1.06722547924343392e+01, 1.45132630061240331e+01, 2.88343609840252064e+01,
+    3.05455068245892081e+00, 4.28386571382264059e+00, 5.81975657896078058e+00, 8.46612534047689813e+00,
+    1.10730389103971625e+01, 2.00296547218827250e+01, 2.82739227103129531e+00, 3.86596885312384630e+00,
+    5.11859661338410810e+00, 7.19140478520400350e+00, 9.15533592051179035e+00, 1.55208404433873000e+01,
+    2.66833472364645052e+00, 3.58058031976146163e+00, 4.65169553730046381e+00, 6.37068073023920167e+00,
+    7.95199224224836509e+00, 1.28580261426170299e+01, 2.55085524861528778e+00, 3.37375364703921399e+00,
+    4.31972183329289283e+00, 5.80177030653512738e+00, 7.13385028268536914e+00, 1.11281297796329532e+01,
+    2.46058196744724045e+00, 3.21717454739899322e+00, 4.07213131505824055e+00, 5.38581104484579409e+00,
+    6.54463054393009980e+00, 9.92561290851694267e+00, 2.38906656169325649e+00, 3.09461288790913924e+00,
+    3.88065116891004802e+00, 5.06921043119526260e+00, 6.10155445240116734e+00, 9.04662190934243426e+00,
+    2.33102356578799474e+00, 2.99612037751710947e+00, 3.72829211539250815e+00, 4.82057350188030664e+00,
+    5.75703078597887341e+00, 8.37881422700139744e+00, 2.28297944218514770e+00, 2.91526923870275212e+00,
+    3.60425639404682574e+00, 4.62036339558485487e+00, 5.48190069277931613e+00, 7.85572819309246029e+00,
+    2.24255856929494435e+00, 2.84772599592535869e+00, 3.50136493600155463e+00, 4.45582002592775606e+00,
+    5.25736783816816011e+00, 7.43576836057002666e+00, 2.20808177033144215e+00, 2.79046499736750686e+00,
+    3.41466465773577310e+00, 4.31827305376703485e+00, 5.07080293022875761e+00, 7.09168419034595932e+00,
+    2.17832880439543164e+00, 2.74131082833877837e+00, 3.34063093954694867e+00, 4.20163370427507044e+00,
+    4.91342289377046892e+00, 6.80493464793435887e+00, 2.15239175278376926e+00, 2.69865990162987268e+00,
+    3.27668904030836616e+00, 4.10150532597661499e+00, 4.77893935715213125e+00, 6.56249700468812680e+00,
+    2.12958118637396376e+00, 2.66130452292790087e+00, 3.22091530748985644e+00, 4.01463650735475763e+00,
+    4.66273681718574107e+00, 6.35497335123995111e+00, 2.10936421832453469e+00, 2.62831803833851385e+00,
+    3.17184420394342537e+00, 3.93857261547994097e+00, 4.56135409952949278e+00, 6.17542157062176766e+00,
+    2.09132248779090624e+00, 2.59897771156420232e+00, 3.12833996189709396e+00, 3.87142681512941067e+00,
+    4.47214658844770430e+00, 6.01860847239696195e+00, 2.07512297876138430e+00, 2.57271164050952539e+00,
+    3.08950899936071943e+00, 3.81172549725480758e+00, 4.39306000655212525e+00, 5.88051822471706664e+00,
+    2.06049732388535078e+00, 2.54906141384365847e+00, 3.05463878343006057e+00, 3.75830143500375469e+00,
+    4.32247515492398815e+00, 5.75802025622356783e+00, 2.04722684943821198e+00, 2.52765532524217873e+00,
+    3.02315428677000808e+00, 3.71021836127776616e+00, 4.25909902059575263e+00, 5.64863965084371245e+00,
+    2.03513158635824531e+00, 2.50818882342325544e+00, 2.99458641109060197e+00, 3.66671671794531573e+00,
+    4.20188691285019988e+00, 5.55039510377477097e+00, 2.02406207270672400e+00, 2.49041001808741269e+00,
+    2.96854871480924842e+00, 3.62717396968155015e+00, 4.14998581167194391e+00, 5.46168243037184808e+00,
+    2.01389315420472759e+00, 2.47410878077095875e+00, 2.94472000787680477e+00, 3.59107512639337489e+00,
+    4.10269249857354801e+00, 5.38118941904637182e+00, 2.00451923703874790e+00, 2.45910844257833450e+00,
+    2.92283116013263200e+00, 3.55799054318870134e+00, 4.05942216953736779e+00, 5.30783265065523846e+00,
+    1.99585061106676376e+00, 2.44525939508938350e+00, 2.90265498091708363e+00, 3.52755898891386233e+00,
+    4.01968459909517328e+00, 5.24070997095754354e+00, 1.98781057212215351e+00, 2.43243410457678921e+00,
+    2.88399836795424669e+00, 3.49947458290276847e+00, 3.98306582311412294e+00, 5.17906428792515339e+00,
+    1.98033314793236825e+00, 2.42052318855757331e+00, 2.86669615397524868e+00, 3.47347660866712893e+00,
+    3.94921390854723775e+00, 5.12225567716364338e+00, 1.94962619111574464e+00, 2.37178119636681828e+00,
+    2.79613721515686242e+00, 3.36793450247131831e+00, 3.81225153681708351e+00, 4.89418855954627752e+00,
+    1.92687856171272376e+00, 2.33585240479166378e+00, 2.74438158015077294e+00, 3.29101238929868689e+00,
+    3.71290607763671643e+00, 4.73056833081702788e+00, 1.89543102589809997e+00, 2.28643590417802223e+00,
+    2.67355497369057060e+00, 3.18643421410527372e+00, 3.57850226228425106e+00, 4.51167580546360725e+00,
+    1.87472024906148449e+00, 2.25405300985703549e+00, 2.62736959210227283e+00, 3.11867427155418220e+00,
+    3.49183151723258067e+00, 4.37205460872678842e+00, 1.84911258848441085e+00, 2.21419279548791748e+00,
+    2.57077051283406988e+00, 3.03611087140459812e+00, 3.38667587947827364e+00, 4.20429908799741270e+00,
+    1.83389555021876283e+00, 2.19060094042904163e+00, 2.53740315934318517e+00, 2.98768449681597481e+00,
+    3.32523238168956325e+00, 4.10712455060250914e+00, 1.82381157889438161e+00, 2.17500625258099545e+00,
+    2.51540087647374655e+00, 2.95585400443103063e+00, 3.28494140912629407e+00, 4.04374661452475159e+00,
+    5.89059532421412584e+01, 2.36768400276995322e+02, 9.48216889093934469e+02, 5.92835573158652369e+03,
+    2.37145658007010752e+04, 5.92873287903309567e+05, 9.34908116554971969e+00, 1.93532175360929344e+01,
+    3.93552052921861559e+01, 9.93563737001872909e+01, 1.99356759244421937e+02, 9.99357066288241185e+02,
+    5.26619463976650959e+00, 8.88674295563428096e+00, 1.46243950222412629e+01, 2.76716960703261563e+01,
+    4.44341005825431807e+01, 1.31582857209943768e+02, 3.97896624379537789e+00, 6.09421092569888856e+00,
+    9.07414105156805562e+00, 1.49757577044466981e+01, 2.16216905333488079e+01, 4.96578867335978416e+01,
+    3.36789874849110804e+00, 4.87587169583399938e+00, 6.85307562857665697e+00, 1.04555108917608948e+01,
+    1.42004456360111231e+01, 2.81626470185101141e+01, 3.01445650474308824e+00, 4.20665848786920815e+00,
+    5.69547047368318449e+00, 8.25999527096898589e+00, 1.07859159985657147e+01, 1.94634080414618573e+01,
+    2.78493011750444008e+00, 3.78704353992806997e+00, 4.99490921906324026e+00, 6.99283277871138065e+00,
+    8.88538902941912845e+00, 1.50185567515680614e+01, 2.62413487356119335e+00, 3.50046385504494184e+00,
+    4.52856214736385976e+00, 6.17762426095224981e+00, 7.69414300433248854e+00, 1.23980412308915806e+01,
+    2.50531320155498616e+00, 3.29274583891712158e+00, 4.19704663694551616e+00, 5.61286547737624453e+00,
+    6.88490841883170557e+00, 1.06979479081423676e+01, 2.41396509984671281e+00, 3.13546480462632626e+00,
+    3.94982406893931470e+00, 5.20012125054997032e+00, 6.30248689212059610e+00, 9.51745431428667565e+00,
+    2.34156567658957959e+00, 3.01233034304310188e+00, 3.75863791838007000e+00, 4.88607203921287248e+00,
+    5.86475236413391610e+00, 8.65534793112546730e+00, 2.28278048240477771e+00, 2.91335817901119620e+00,
+    3.60651464222044638e+00, 4.63950244656433863e+00, 5.52452687137686915e+00, 8.00086838368278563e+00,
+    2.23410296032996181e+00, 2.83209750163493856e+00, 3.48266932934265450e+00, 4.44099741066511378e+00,
+    5.25292440835242047e+00, 7.48855455257451652e+00, 2.19313429107523916e+00, 2.76419925677817924e+00,
+    3.37993287765293138e+00, 4.27788185326564019e+00, 5.03133529571810367e+00, 7.07747234716446716e+00,
+    2.15817844753548727e+00, 2.70662678222569619e+00, 3.29335981373231190e+00, 4.14154630703095528e+00,
+    4.84726187350866233e+00, 6.74082473812342098e+00, 2.12800260888754922e+00, 2.65719660022108695e+00,
+    3.21943131832029605e+00, 4.02594659066506733e+00, 4.69201635638499770e+00, 6.46039144559922462e+00,
+    2.10168924708279992e+00, 2.61429904513331879e+00, 3.15557709067935876e+00, 3.92671938827772582e+00,
+    4.55938093786976406e+00, 6.22338266552545427e+00, 2.07854144894250004e+00, 2.57672172925991561e+00,
+    3.09987690169424202e+00, 3.84063865989797426e+00, 4.44479341772784853e+00, 6.02057352342423702e+00,
+    2.05802040094764527e+00, 2.54353430142970582e+00, 3.05086787539847526e+00, 3.76526939463933630e+00,
+    4.34483359476539555e+00, 5.84515301609035909e+00, 2.03970298058623101e+00, 2.51401106299883459e+00,
+    3.00741633052130553e+00, 3.69874015205505113e+00, 4.25688884020011926e+00, 5.69198904333620082e+00,
+    2.02325229745849233e+00, 2.48757770372204057e+00, 2.96863033501068685e+00, 3.63958955821786834e+00,
+    4.17893019557007417e+00, 5.55714492230328094e+00, 2.00839679631527757e+00, 2.46377382996080874e+00,
+    2.93379867151027529e+00, 3.58666022429484910e+00, 4.10935875274934315e+00, 5.43755290570244920e+00,
+    1.99491515412859166e+00, 2.44222608568485944e+00, 2.90234736993234055e+00, 3.53902387787981310e+00,
+    4.04689794269062464e+00, 5.33078855905148163e+00, 1.98262518037924473e+00, 2.42262853342091589e+00,
+    2.87380818803788873e+00, 3.49592752049327471e+00, 3.99051653664346651e+00, 5.23491159215542989e+00,
+    1.97137553535034216e+00, 2.40472810810058224e+00, 2.84779538230485230e+00, 3.45675404663608399e+00,
+    3.93937263736336751e+00, 5.14835147840873208e+00, 1.96103946584570221e+00, 2.38831367802511263e+00,
+    2.82398833571417995e+00, 3.42099299728861084e+00, 3.89277229409762171e+00, 5.06982387967338344e+00,
+    1.95151000747600589e+00, 2.37320771163059829e+00, 2.80211839145296393e+00, 3.38821853687621344e+00,
+    3.85013848475896037e+00, 4.99826865245360352e+00, 1.94269626805948259e+00, 2.35925985405643868e+00,
+    2.78195875217480415e+00, 3.35807265884721318e+00, 3.81098756480398260e+00, 4.93280322741990140e+00,
+    1.93452051824965077e+00, 2.34634192202055214e+00, 2.76331664422773837e+00, 3.33025222958774414e+00,
+    3.77491117200063986e+00, 4.87268710786274983e+00, 1.92691589201681568e+00, 2.33434396484478146e+00,
+    2.74602717634945526e+00, 3.30449888669239566e+00, 3.74156217087736431e+00, 4.81729452273925141e+00,
+    1.89567617130647803e+00, 2.28523517310187074e+00, 2.67551261807310192e+00, 3.19995210729837920e+00,
+    3.60664929926956956e+00, 4.59497657923281455e+00, 1.87252249881635180e+00, 2.24902432514738493e+00,
+    2.62378096326717891e+00, 3.12375705657342095e+00, 3.50880510312152971e+00, 4.43554674395018367e+00,
+    1.84049643321329204e+00, 2.19920208712115306e+00, 2.55297370727071726e+00, 3.02016828922044089e+00,
+    3.37645160062913074e+00, 4.22235073304602615e+00, 1.81939298353585066e+00, 2.16654115604941877e+00,
+    2.50679152011561301e+00, 2.95304920800270176e+00, 3.29111449865117134e+00, 4.08641981417086608e+00,
+    1.79328604894524068e+00, 2.12632428273578178e+00, 2.45018492320936643e+00, 2.87126546394210491e+00,
+    3.18758868215205426e+00, 3.92315961059743845e+00, 1.77776469108212920e+00, 2.10251329455277514e+00,
+    2.41680666125518950e+00, 2.82329531754451857e+00, 3.12710329122125419e+00, 3.82862097744997820e+00,
+    1.76747576549694996e+00, 2.08677027772159418e+00, 2.39479434856558537e+00, 2.79176410970358635e+00,
+    3.08744283903430006e+00, 3.76697525835375124e+00, 5.94389805664771984e+01, 2.38882694802524071e+02,
+    9.56656220603102156e+02, 5.98107030779772504e+03, 2.39254062488244745e+04, 5.98144156249952968e+05,
+    9.36677032737029336e+00, 1.93709928980664614e+01, 3.93730220687024186e+01, 9.93742148189159025e+01,
+    1.99374608395344268e+02, 9.99374921835912801e+02, 5.25167108152146245e+00, 8.84523845995939872e+00,
+    1.45398865704172415e+01, 2.74891770305362151e+01, 4.41255717147290056e+01, 1.30619008764168228e+02,
+    3.95493994454234921e+00, 6.04104447611915507e+00, 8.97958041501104098e+00, 1.47988887906325886e+01,
+    2.13519803553211567e+01, 4.89961887692097804e+01, 3.33927571115433697e+00, 4.81831953565687066e+00,
+    6.75717200739467927e+00, 1.02893110461359338e+01, 1.39609626035679337e+01, 2.76494753708765018e+01,
+    2.98303561429049902e+00, 4.14680416227653303e+00, 5.59962300504305155e+00, 8.10165136673870379e+00,
+    1.05657635056314998e+01, 1.90303331193710079e+01, 2.75157957735358671e+00, 3.72572531712270383e+00,
+    4.89934064826823512e+00, 6.84004907182934652e+00, 8.67811474479429634e+00, 1.46340066323325875e+01,
+    2.58934905572563778e+00, 3.43810123337315821e+00, 4.43325988918237623e+00, 6.02887010661257428e+00,
+    7.49590591481359958e+00, 1.20455412441549345e+01, 2.46940565262621803e+00, 3.22958261268677571e+00,
+    4.10195569693974704e+00, 5.46712251541477201e+00, 6.69330016466629996e+00, 1.03680003742647884e+01,
+    2.37715002264051289e+00, 3.07165838527903823e+00, 3.85489087968522792e+00, 5.05669313174441637e+00,
+    6.11591875010361541e+00, 9.20414986485558906e+00, 2.30399745828859448e+00, 2.94799031863863625e+00,
+    3.66381903428786915e+00, 4.74446764393546516e+00, 5.68212973200559635e+00, 8.35478626222746357e+00,
+    2.24457494789101331e+00, 2.84856514206768274e+00, 3.51177673631482312e+00, 4.49936528084743248e+00,
+    5.34506765341426071e+00, 7.71035230853469677e+00, 2.19534973563982705e+00, 2.76691318191774860e+00,
+    3.38798732538960801e+00, 4.30206201089644757e+00, 5.07605251048771056e+00, 7.20614737696161267e+00,
+    2.15390445389171648e+00, 2.69867241870930652e+00, 3.28528801862453390e+00, 4.13994607512723878e+00,
+    4.85661530921880669e+00, 6.80173979551382146e+00, 2.11852950153795305e+00, 2.64079688290690306e+00,
+    3.19873807854075887e+00, 4.00445318641694303e+00, 4.67435742309741098e+00, 6.47067685784303581e+00,
+    2.08798185123709912e+00, 2.59109617987440100e+00, 3.12482221430226881e+00, 3.88957213992619266e+00,
+    4.52066262311060907e+00, 6.19498166298000097e+00, 2.06133612551984990e+00, 2.54795535776985282e+00,
+    3.06097275639897637e+00, 3.79096417822418319e+00, 4.38936599009600492e+00, 5.96204102778094480e+00,
+    2.03788925853555369e+00, 2.51015789538357570e+00, 3.00527144567750648e+00, 3.70542188117203919e+00,
+    4.27594519504727266e+00, 5.76276119741769843e+00, 2.01709753490950172e+00, 2.47677014745129576e+00,
+    2.95625688873500092e+00, 3.63052458270226053e+00, 4.17701062462906503e+00, 5.59043045364435986e+00,
+    1.99853387139914496e+00, 2.44706374797982296e+00, 2.91279652621012408e+00, 3.56441205329893140e+00,
+    4.08997348223369883e+00, 5.43999319287225269e+00, 1.98185813765624674e+00, 2.42046219735445556e+00,
+    2.87399927955641310e+00, 3.50563179461819541e+00, 4.01282363640071349e+00, 5.30757258370812846e+00,
+    1.96679609914988918e+00, 2.39650328376392663e+00, 2.83915458386986463e+00, 3.45303352710580569e+00,
+    3.94397723770287367e+00, 5.19014835252342532e+00, 1.95312419570990858e+00, 2.37481212582062806e+00,
+    2.80768896989938810e+00, 3.40569473358383679e+00, 3.88216989735191120e+00, 5.08533418537997051e+00,
+    1.94065835262197361e+00, 2.35508149484620777e+00, 2.77913458115311451e+00, 3.36286711994948107e+00,
+    3.82638033915481435e+00, 4.99122074255907489e+00, 1.92924563081438394e+00, 2.33705722406030381e+00,
+    2.75310597194269713e+00, 3.32393746031516679e+00, 3.77577487369161746e+00, 4.90626287937735839e+00,
+    1.91875790988451889e+00, 2.32052723503374780e+00, 2.72928275553268307e+00, 3.28839852123883203e+00,
+    3.72966637662371614e+00, 4.82919726344958811e+00, 1.90908704913413740e+00, 2.30531317742742825e+00,
+    2.70739645320863476e+00, 3.25582716912726156e+00, 3.68748354757947450e+00, 4.75898128065857406e+00,
+    1.90014113832822429e+00, 2.29126398414416155e+00, 2.68722040520921501e+00, 3.22586767654391737e+00,
+    3.64874757218394752e+00, 4.69474710207928414e+00, 1.89184156223992539e+00, 2.27825084905154940e+00,
+    2.66856194387723633e+00, 3.19821884468868367e+00, 3.61305419274118522e+00, 4.63576671352833181e+00,
+    1.88412068010342892e+00, 2.26616327413814211e+00, 2.65125625921801111e+00, 3.17262396351333598e+00,
+    3.58005978308285222e+00, 4.58142498322526670e+00, 1.85239198415891870e+00, 2.21667503267520116e+00,
+    2.58066435869731636e+00, 3.06871595562621025e+00, 3.44658614648618844e+00, 4.36336759295129450e+00,
+    1.82886337508654573e+00, 2.18017045320064051e+00, 2.52886345128781675e+00, 2.99298086976517252e+00,
+    3.34978976089732550e+00, 4.20703657663508679e+00, 1.79629963605457688e+00, 2.12992275917973162e+00,
+    2.45794198126621266e+00, 2.89000772475240897e+00, 3.21885741004294967e+00, 3.99804325462716115e+00,
+    1.77482887839277326e+00, 2.09696831251594862e+00, 2.41167181625306126e+00, 2.82328021547163921e+00,
+    3.13443791390969784e+00, 3.86482816957026420e+00, 1.74825209931353132e+00, 2.05637261155898265e+00,
+    2.35494112864246707e+00, 2.74196414876110683e+00, 3.03202535887346958e+00, 3.70486835813532212e+00,
+    1.73244278443669719e+00, 2.03232759184843426e+00, 2.32148052290018780e+00, 2.69426272888706952e+00,
+    2.97218984423485066e+00, 3.61226059079898532e+00, 1.72195924267361877e+00, 2.01642561306418466e+00,
+    2.29940989745666879e+00, 2.66290562950171417e+00, 2.93295508006203276e+00, 3.55188188353508405e+00,
+    5.98575851459904840e+01, 2.40543254713263281e+02, 9.63284578946760121e+02, 6.02247324496827059e+03,
+    2.40910041089209590e+04, 6.02283991641758475e+05, 9.38054404832638333e+00, 1.93848257181714878e+01,
+    3.93868832825513522e+01, 9.93880927217144290e+01, 1.99388491804988888e+02, 9.99388809631147751e+02,
+    5.23999586113573113e+00, 8.81229955520644914e+00, 1.44730806517737367e+01, 2.73452063335714861e+01,
+    4.38824011495118569e+01, 1.29859963339590820e+02, 3.93567081503525218e+00, 5.99877903121025202e+00,
+    8.90468161459858898e+00, 1.46591335747388669e+01, 2.11390836901418773e+01, 4.84745113473730953e+01,
+    3.31628081885559789e+00, 4.77246561310085848e+00, 6.68105434646090757e+00, 1.01577615479333456e+01,
+    1.37716453782288202e+01, 2.72444585775164363e+01, 2.95774070396694100e+00, 4.09901554171652283e+00,
+    5.52340662397558635e+00, 7.97612136662335924e+00, 1.03914861377432413e+01, 1.86881815716840407e+01,
+    2.72467772155827470e+00, 3.67667469893951226e+00, 4.82321708462294030e+00, 6.71875248182447482e+00,
+    8.51382310645155904e+00, 1.43299004689305729e+01, 2.56123820965701610e+00, 3.38813023473972796e+00,
+    4.35723306496021312e+00, 5.91061884919086644e+00, 7.33859520555033118e+00, 1.17665324946584295e+01,
+    2.44034043770947040e+00, 3.17889310445827000e+00, 4.02599415828297946e+00, 5.35112886114858988e+00,
+    6.54108962685306050e+00, 1.01066278750956346e+01, 2.34730590975051667e+00, 3.02038294702137522e+00,
+    3.77896263409157518e+00, 4.94242065208861003e+00, 5.96757027149481001e+00, 8.95577413530943645e+00,
+    2.27350198196503683e+00, 2.89622276128770428e+00, 3.58789866910654665e+00, 4.63153974764749776e+00,
+    5.53679224409714177e+00, 8.11634734291084214e+00, 2.21352454495325990e+00, 2.79637548949924941e+00,
+    3.43584564186105812e+00, 4.38750996318018949e+00, 5.20213457503014620e+00, 7.47973583900393191e+00,
+    2.16381957944086345e+00, 2.71435578905989194e+00, 3.31203241005310733e+00, 4.19107778181103985e+00,
+    4.93507819557749894e+00, 6.98183647462926604e+00, 2.12195456697690155e+00, 2.64579073523381991e+00,
+    3.20930034089668581e+00, 4.02968033689587468e+00, 4.71726384539371146e+00, 6.58261211383471689e+00,
+    2.08620874923266841e+00, 2.58762643522758484e+00, 3.12271172630332750e+00, 3.89478810712506540e+00,
+    4.53637001057539546e+00, 6.25588029236739729e+00, 2.05533065874032461e+00, 2.53766653888065274e+00,
+    3.04875345803668152e+00, 3.78041516991357129e+00, 4.38383607777025031e+00, 5.98385501237373774e+00,
+    2.02838838945045152e+00, 2.49429149456419674e+00, 2.98485942891410616e+00, 3.68224152404586524e+00,
+    4.25353815479049846e+00, 5.75406154201915676e+00, 2.00467372996192017e+00, 2.45628114915926821e+00,
+    2.92911249312326483e+00, 3.59707391354575190e+00, 4.14098478133858361e+00, 5.55750884131105760e+00,
+    1.98363884402050816e+00, 2.42269893712397044e+00, 2.88005204672379911e+00, 3.52250253991015327e+00,
+    4.04280997758399696e+00, 5.38756291481463645e+00, 1.96485330226169319e+00, 2.39281410844228093e+00,
+    2.83654608610481507e+00, 3.45667563151715918e+00, 3.95644332281658917e+00, 5.23922799995687694e+00,
+    1.94797422440855250e+00, 2.36604819203545436e+00, 2.79770391950302466e+00, 3.39814735764969411e+00,
+    3.87988917205268979e+00, 5.10867405157865750e+00, 1.93272509188929109e+00, 2.34193732766579243e+00,
+    2.76281524636825626e+00, 3.34577275655153183e+00, 3.81157523861502723e+00, 4.99291787943155541e+00,
+    1.91888042951592586e+00, 2.32010524231663018e+00, 2.73130677293590773e+00, 3.29863359737394024e+00,
+    3.75024646671713979e+00, 4.88960292509945749e+00, 1.90625454338691824e+00, 2.30024352251483943e+00,
+    2.70271075364237445e+00, 3.25598507446139163e+00, 3.69488919030888274e+00, 4.79684399000498463e+00,
+    1.89469311495898918e+00, 2.28209698519890614e+00, 2.67664180685823094e+00, 3.21721682624108096e+00,
+    3.64467598299603335e+00, 4.71311571274303009e+00, 1.88406684048824724e+00, 2.26545267434728359e+00,
+    2.65277957596707203e+00, 3.18182399032742769e+00, 3.59892491864756980e+00, 4.63717112146735655e+00,
+    1.87426655781344986e+00, 2.25013147720266637e+00, 2.63085558792280860e+00, 3.14938541065117583e+00,
+    3.55706904500351007e+00, 4.56798124520964066e+00, 1.86519946991076591e+00, 2.23598166067029069e+00,
+    2.61064317117007061e+00, 3.11954702057364663e+00, 3.51863321088448178e+00, 4.50468971941048846e+00,
+    1.85678618762315062e+00, 2.22287383392995741e+00, 2.59194963395551436e+00, 3.09200902510858233e+00,
+    3.48321626527390249e+00, 4.44657823141044961e+00, 1.84895839146416074e+00, 2.21069698330357634e+00,
+    2.57461013370307867e+00, 3.06651590793498885e+00, 3.45047723294278397e+00, 4.39303991267295579e+00,
+    1.81677830164145893e+00, 2.16082925076653165e+00, 2.50386662570728280e+00, 2.96301181438305328e+00,
+    3.31803434424543608e+00, 4.17823399923414573e+00, 1.79290167101694342e+00, 2.12402926401669667e+00,
+    2.45193921702992634e+00, 2.88756044033361858e+00, 3.22198189602034946e+00, 4.02426140005696364e+00,
+    1.75983591194316413e+00, 2.07335116347462245e+00, 2.38082088729425179e+00, 2.78495567787399922e+00,
+    3.09204843395717477e+00, 3.81845668490214374e+00, 1.73802016928635972e+00, 2.04009805547647005e+00,
+    2.33440585196068096e+00, 2.71845438665680605e+00, 3.00826681223534331e+00, 3.68729528026346998e+00,
+    1.71099964420842077e+00, 1.99911480581683976e+00, 2.27747770059936450e+00, 2.63739843079822389e+00,
+    2.90661950585548556e+00, 3.52982300787697323e+00, 1.69491698199072216e+00, 1.97482919825875936e+00,
+    2.24388940885503096e+00, 2.58984059851958737e+00, 2.84722578021573280e+00, 3.43866596302177152e+00,
+    1.68424809332236758e+00, 1.95876329569637653e+00, 2.22172964958887054e+00, 2.55857388212081904e+00,
+    2.80827822019179241e+00, 3.37923720456817778e+00, 6.01949803440462148e+01, 2.41881747250833428e+02,
+    9.68627443676966891e+02, 6.05584670739583089e+03, 2.42244868477474411e+04, 6.05620971223909874e+05,
+    9.39157278014969954e+00, 1.93958967235717523e+01, 3.93979745978644260e+01, 9.93991959745394240e+01,
+    1.99399598996828757e+02, 9.99399919959974682e+02, 5.23041127055522814e+00, 8.78552471052400819e+00,
+    1.44189420421274335e+01, 2.72287341214743037e+01, 4.36858011208926200e+01, 1.29246681575078441e+02,
+    3.91987560373121235e+00, 5.96437055223803370e+00, 8.84388097352142921e+00, 1.45459008033233808e+01,
+    2.09667302679618999e+01, 4.80525891166309549e+01, 3.29740166802993429e+00, 4.73506306969342106e+00,
+    6.61915433142496479e+00, 1.00510172195712730e+01, 1.36181796145449301e+01, 2.69165675897706933e+01,
+    2.93693467084833504e+00, 4.05996279433070040e+00, 5.46132371873179334e+00, 7.87411853356562830e+00,
+    1.02500371199816396e+01, 1.84109247971806909e+01, 2.70251048176804565e+00, 3.63652312062834726e+00,
+    4.76111643499681580e+00, 6.62006267029144002e+00, 8.38032593349669419e+00, 1.40832553833554268e+01,
+    2.53803678155032575e+00, 3.34716312023397977e+00, 4.29512696017258833e+00, 5.81429385512265728e+00,
+    7.21063591522331659e+00, 1.15400561088190887e+01, 2.41631558306089955e+00, 3.13728010788869716e+00,
+    3.96386515762253300e+00, 5.25654199128846233e+00, 6.41715965487966500e+00, 9.89430492120828475e+00,
+    2.32260394089130973e+00, 2.97823701608232216e+00, 3.71679186459736588e+00, 4.84914680208002657e+00,
+    5.84667842505818403e+00, 8.75386627544730089e+00, 2.24822999836509618e+00, 2.85362485827325596e+00,
+    3.52567171588800266e+00, 4.53928181125332042e+00, 5.41825867574838682e+00, 7.92239062137780703e+00,
+    2.18776407887509183e+00, 2.75338676883585443e+00, 3.37355284983530623e+00, 4.29605440400905092e+00,
+    5.08547590241242808e+00, 7.29202902976265577e+00, 2.13763458883327617e+00, 2.67102422855512645e+00,
+    3.24966795013312337e+00, 4.10026726236351635e+00, 4.81994019859808898e+00, 6.79916011749890359e+00,
+    2.09539642064580267e+00, 2.60215505104270806e+00, 3.14686119355757743e+00, 3.93939637132462961e+00,
+    4.60338024699883874e+00, 6.40406474125668446e+00, 2.05931949615681775e+00, 2.54371854969280786e+00,
+    3.06019685141124853e+00, 3.80493974595027495e+00, 4.42353623520512684e+00, 6.08077814237400371e+00,
+    2.02814526136691642e+00, 2.49351322128160868e+00, 2.98616317443406354e+00, 3.69093141789516244e+00,
+    4.27189197389133479e+00, 5.81166802877013478e+00, 2.00093630142992485e+00, 2.44991550039424633e+00,
+    2.92219496724491989e+00, 3.59306613360582183e+00, 4.14235628170674186e+00, 5.58437107579159253e+00,
+    1.97698004248414794e+00, 2.41170203983392062e+00, 2.86637567883308853e+00, 3.50816172969927287e+00,
+    4.03046226245344918e+00, 5.38997884159348661e+00, 1.95572513870367981e+00, 2.37793368728983223e+00,
+    2.81724507725837681e+00, 3.43381688297390308e+00, 3.93286270511334513e+00, 5.22191978930868395e+00,
+    1.93673829870797753e+00, 2.34787756699831185e+00, 2.77367137519908180e+00, 3.36818638918874269e+00,
+    3.84700175214525686e+00, 5.07524621120969766e+00, 1.91967428054137490e+00, 2.32095343930743825e+00,
+    2.73476398895880379e+00, 3.30982957161339320e+00, 3.77089521492776081e+00, 4.94616560625851953e+00,
+    1.90425459648335837e+00, 2.29669595693772655e+00, 2.69981265138965343e+00, 3.25760556004923751e+00,
+    3.70297993118914981e+00, 4.83172452016681842e+00, 1.89025211430577600e+00, 2.27472758503325201e+00,
+    2.66824405118466901e+00, 3.21059940593727822e+00, 3.64200819385766916e+00, 4.72959023659972289e+00,
+    1.87747973419600633e+00, 2.25473883073260328e+00, 2.63959039107289906e+00, 3.16806896198364507e+00,
+    3.58697231576887932e+00, 4.63789688579135184e+00, 1.86578193591642538e+00, 2.23647358105051319e+00,
+    2.61346621542758939e+00, 3.12940603858968158e+00, 3.53704978009417959e+00, 4.55513493392140401e+00,
+    1.85502838168503703e+00, 2.21971807368515872e+00, 2.58955107974364385e+00, 3.09410756230367401e+00,
+    3.49156272645312171e+00, 4.48007048838460964e+00, 1.84510901413245021e+00, 2.20429249277264949e+00,
+    2.56757641512108892e+00, 3.06175386149938111e+00, 3.44994759583101107e+00, 4.41168547676088885e+00,
+    1.83593025688829359e+00, 2.19004448887475300e+00, 2.54731545034740536e+00, 3.03199210982696910e+00,
+    3.41173208940238126e+00, 4.34913268561820843e+00, 1.82741203883424030e+00, 2.17684412830235186e+00,
+    2.52857539310827528e+00, 3.00452355523782177e+00, 3.37651746978532419e+00, 4.29170154044898755e+00,
+    1.81948544091496256e+00, 2.16457991712547404e+00, 2.51119130135695379e+00, 2.97909356363388333e+00,
+    3.34396481674826607e+00, 4.23879175874172986e+00, 1.78688675619274107e+00, 2.11433954620338982e+00,
+    2.44025049322006948e+00, 2.87583318936295473e+00, 3.21226844448480930e+00, 4.02652396918712618e+00,
+    1.76268576500323948e+00, 2.07724804641721050e+00, 2.38816108668986438e+00, 2.80054510713269345e+00,
+    3.11674828412331184e+00, 3.87438608394867323e+00, 1.72914956679546150e+00, 2.02614296117110593e+00,
+    2.31679416287275375e+00, 2.69813941378638367e+00, 2.98751918199602695e+00, 3.67105213827035826e+00,
+    1.70700876058536188e+00, 1.99259199662941944e+00, 2.27019826238270062e+00, 2.63175077526475443e+00,
+    2.90417996876037554e+00, 3.54147524050032381e+00, 1.67956793571271890e+00, 1.95122032223430653e+00,
+    2.21302570900558848e+00, 2.55081190212871789e+00, 2.80305422485710753e+00, 3.38591391096231886e+00,
+    1.66322512793922273e+00, 1.92669248875454935e+00, 2.17928040821753033e+00, 2.50331112687958557e+00,
+    2.74395625558982470e+00, 3.29586659224766265e+00, 1.65237929786484661e+00, 1.91046106466920018e+00,
+    2.15701143561516595e+00, 2.47207675478493938e+00, 2.70519855709038337e+00, 3.23716241087376311e+00,
+    6.07052118741578539e+01, 2.43906038489074604e+02, 9.76707949877332112e+02, 6.10632070769129768e+03,
+    2.44263661825787931e+04, 6.10667821261886507e+05, 9.40813213652570113e+00, 1.94125111472234799e+01,
+    3.94146154778934843e+01, 9.94158524047540766e+01, 1.99416260558128897e+02, 9.99416585607613229e+02,
+    5.21561782854501299e+00, 8.74464066146528474e+00, 1.43365523511947544e+01, 2.70518192561424620e+01,
+    4.33873867901376826e+01, 1.28316463616675918e+02, 3.89552685448588853e+00, 5.91172910911072247e+00,
+    8.75115892413608343e+00, 1.43735870122003231e+01, 2.07046875454836972e+01, 4.74118041715589271e+01,
+    3.26823921479689705e+00, 4.67770379177752282e+00, 6.52454921856359604e+00, 9.88827548681758906e+00,
+    1.33844708419484633e+01, 2.64179664352019508e+01, 2.90472050883365895e+00, 3.99993538331887866e+00,
+    5.36624394975939012e+00, 7.71833265527760659e+00, 1.00342922121682552e+01, 1.79888107747861596e+01,
+    2.66811142381013999e+00, 3.57467644662941675e+00, 4.66582971672596791e+00, 6.46909127884149004e+00,
+    8.17641252922044437e+00, 1.37073163353222718e+01, 2.50195779407260588e+00, 3.28393900572640618e+00,
+    4.19966746131672863e+00, 5.66671926387737557e+00, 7.01491722957365571e+00, 1.11944864784353140e+01,
+    2.37888486446285174e+00, 3.07294712187809260e+00, 3.86822032284327166e+00, 5.11143101687306611e+00,
+    6.22736742008293742e+00, 9.57000509257040299e+00, 2.28405130103245080e+00, 2.91297672158263854e+00,
+    3.62094548293666385e+00, 4.70586968615915335e+00, 5.66132597392010961e+00, 8.44518505666090924e+00,
+    2.20872508845992899e+00, 2.78756932568048921e+00, 3.42961301244266981e+00, 4.39740107742703579e+00,
+    5.23632927694910943e+00, 7.62560657663285735e+00, 2.14743710598429161e+00, 2.68663711249568582e+00,
+    3.27727709403349499e+00, 4.15525779081778790e+00, 4.90624900361201011e+00, 7.00457536918499013e+00,
+    2.09658848394949571e+00, 2.60366074762830157e+00, 3.15317517766161703e+00, 3.96032644518874699e+00,
+    4.64288967056461921e+00, 6.51919906721215980e+00, 2.05371445461418300e+00, 2.53424325274856166e+00,
+    3.05015478881859314e+00, 3.80014083734089958e+00, 4.42811210185682480e+00, 6.13023946895206340e+00,
+    2.01707029444758845e+00, 2.47531297347576995e+00, 2.96328239823224715e+00, 3.66623978360796698e+00,
+    4.24974900821727442e+00, 5.81206087557442430e+00, 1.98538624488811610e+00, 2.42466000166338569e+00,
+    2.88904761144884636e+00, 3.55268674314739785e+00, 4.09935066527402459e+00, 5.54726315417672655e+00,
+    1.95771612873941026e+00, 2.38065416157700716e+00, 2.82488599376506100e+00, 3.45519809932540900e+00,
+    3.97087471184391960e+00, 5.32365111745592046e+00, 1.93334039284035253e+00, 2.34206679804543461e+00,
+    2.76888134724075696e+00, 3.37060787229069359e+00, 3.85989081654931399e+00, 5.13244087422494921e+00,
+    1.91170204520904963e+00, 2.30795442393102679e+00, 2.71957351869437591e+00, 3.29652702984679946e+00,
+    3.76307962864401180e+00, 4.96715498249595466e+00, 1.89236316548343231e+00, 2.27758057354642185e+00,
+    2.67583061868205130e+00, 3.23111983121041391e+00, 3.67790684466946116e+00, 4.82291805927339823e+00,
+    1.87497467248477334e+00, 2.25036199906316314e+00, 2.63676184533277125e+00, 3.17295297645314012e+00,
+    3.60240518010596134e+00, 4.69599405147879434e+00, 1.85925486182840083e+00, 2.22583080708346825e+00,
+    2.60165664196476820e+00, 3.12089141011469051e+00, 3.53502489337877446e+00, 4.58347416589438961e+00,
+    1.84497388194784762e+00, 2.20360728892980928e+00, 2.56994136701465825e+00, 3.07402481374775549e+00,
+    3.47452905115933808e+00, 4.48306145621346541e+00, 1.83194231567186083e+00, 2.18338008161293828e+00,
+    2.54114787308813428e+00, 3.03161476109769668e+00, 3.41991870254093788e+00, 4.39291901929565665e+00,
+    1.82000265373313375e+00, 2.16489145241883918e+00, 2.51489034862395267e+00, 2.99305607840802379e+00,
+    3.37037848007651686e+00, 4.31156101415495563e+00, 1.80902284001769376e+00, 2.14792622772215669e+00,
+    2.49084799670085921e+00, 2.95784815557130276e+00, 3.32523642351012683e+00, 4.23777310456898970e+00,
+    1.79889132390064876e+00, 2.13230335523782966e+00, 2.46875190556686297e+00, 2.92557334747119757e+00,
+    3.28393388075468362e+00, 4.17055349510637630e+00, 1.78951322433956461e+00, 2.11786939698567611e+00,
+    2.44837497448939034e+00, 2.89588050595823310e+00, 3.24600266310331786e+00, 4.10906862372269277e+00,
+    1.78080732465868641e+00, 2.10449345660396414e+00, 2.42952409715861206e+00, 2.86847227728237186e+00,
+    3.21104749866633599e+00, 4.05261944606081848e+00, 1.77270369535732986e+00, 2.09206318527594171e+00,
+    2.41203403416639039e+00, 2.84309519907773645e+00, 3.17873240713534955e+00, 4.00061548165147052e+00,
+    1.73935148014954133e+00, 2.04111123809480421e+00, 2.34062687032527617e+00, 2.74001797417564630e+00,
+    3.04797192108286774e+00, 3.79199075216842774e+00, 1.71456262591224218e+00, 2.00345939550183250e+00,
+    2.28815698458487038e+00, 2.66482735572934182e+00, 2.95310108804262361e+00, 3.64246959812963844e+00,
+    1.68016748936200888e+00, 1.95152768314178737e+00, 2.21620915881174874e+00, 2.56249676490098688e+00,
+    2.82470194827922594e+00, 3.44263306659968293e+00, 1.65742868874640048e+00, 1.91739589917631315e+00,
+    2.16919216341737053e+00, 2.49611594735598707e+00, 2.74186261555882460e+00, 3.31528023104155567e+00,
+    1.62920908611880466e+00, 1.87526157341990718e+00, 2.11145182955908872e+00, 2.41513608371235922e+00,
+    2.64129879021517899e+00, 3.16237783356393143e+00, 1.61238102463778499e+00, 1.85025511418992683e+00,
+    2.07734219479385596e+00, 2.36758212113921029e+00, 2.58250308179639232e+00, 3.07386110803765256e+00,
+    1.60120370549007829e+00, 1.83369527635698826e+00, 2.05481987910426422e+00, 2.33629980935757242e+00,
+    2.54393185637764185e+00, 3.01615025794884684e+00, 6.12203432586099439e+01, 2.45949926205250762e+02,
+    9.84866841257607803e+02, 6.15728461506438907e+03, 2.46302051456914160e+04, 6.15763662006846047e+05,
+    9.42471100350266511e+00, 1.94291350695635430e+01, 3.94312610463970969e+01, 9.94325106961415059e+01,
+    1.99432923047677463e+02, 9.99433251440529602e+02, 5.20031253626088752e+00, 8.70287013489668304e+00,
+    1.42527114536749142e+01, 2.68721949565740132e+01, 4.30846573093143661e+01, 1.27373604286242653e+02,
+    3.87036009614920262e+00, 5.85780536076531977e+00, 8.65654117491387076e+00, 1.41982018694264198e+01,
+    2.04382676547532895e+01, 4.67611729371572267e+01, 3.23801080735582536e+00, 4.61875911640583592e+00,
+    6.42772816707878203e+00, 9.72221947481560278e+00, 1.31463307669879175e+01, 2.59108255054983161e+01,
+    2.87122189989756826e+00, 3.93805798839503884e+00, 5.26866680122997710e+00, 7.55899441522046622e+00,
+    9.81398643262554593e+00, 1.75587421571531159e+01, 2.63223012463979034e+00, 3.51074018463367699e+00,
+    4.56778730567644242e+00, 6.31433087599941612e+00, 7.96776694940554453e+00, 1.33236724460399643e+01,
+    2.46421552837826408e+00, 3.21840551331234304e+00, 4.10121266770653836e+00, 5.51512483969960066e+00,
+    6.81427659632345240e+00, 1.08412918681187431e+01, 2.33962421510091101e+00, 3.00610197236887666e+00,
+    3.76935727929680864e+00, 4.96207835639995753e+00, 6.03245790497350765e+00, 9.23806834502560648e+00,
+    2.24351474368401549e+00, 2.84501652699584495e+00, 3.52167324123943271e+00, 4.55813960452320632e+00,
+    5.47066234374016247e+00, 8.12880347389416791e+00, 2.16709356419939558e+00, 2.71863964757839049e+00,
+    3.32993482243337446e+00, 4.25086726296117945e+00, 5.04889998302846710e+00, 7.32102949191954178e+00,
+    2.10485095354942953e+00, 2.61685123413211196e+00, 3.17720110696330149e+00, 4.00961914041103373e+00,
+    4.72134061419553053e+00, 6.70921972008160594e+00, 2.05315976662839983e+00, 2.53310998313074620e+00,
+    3.05271324738295391e+00, 3.81536545215042944e+00, 4.45998408363345078e+00, 6.23121862755502054e+00,
+    2.00953470202757289e+00, 2.46300310487566243e+00, 2.94932113340227176e+00, 3.65569729086742834e+00,
+    4.24682366770060504e+00, 5.84827379317986473e+00, 1.97221562176205745e+00, 2.40344707149533798e+00,
+    2.86209253046350476e+00, 3.52219367670034789e+00, 4.06978456620974338e+00, 5.53508161647009889e+00,
+    1.93992088243334648e+00, 2.35222276280738551e+00, 2.78751757243456000e+00, 3.40894687239249317e+00,
+    3.92048328849427330e+00, 5.27447603994626490e+00, 1.91169494072506430e+00, 2.30769267208097606e+00,
+    2.72303183344226296e+00, 3.31169427972159180e+00, 3.79292595387483145e+00, 5.05443121297317788e+00,
+    1.88681072680634765e+00, 2.26862219160651968e+00, 2.66671878652262828e+00, 3.22728550711057416e+00,
+    3.68271840166653597e+00, 4.86628852769711884e+00, 1.86470512306441094e+00, 2.23406292200661927e+00,
+    2.61711773939478132e+00, 3.15334325073393185e+00, 3.58656872573100216e+00, 4.70366506182574184e+00,
+    1.84493515132557584e+00, 2.20327428956116611e+00, 2.57309614119166197e+00, 3.08804070751176818e+00,
+    3.50196375948992777e+00, 4.56175797706772546e+00, 1.82714750677572280e+00, 2.17566957257170479e+00,
+    2.53376246557863682e+00, 3.02995146663441206e+00, 3.42695271572061833e+00, 4.43688775151257264e+00,
+    1.81105692300004906e+00, 2.15077791219695458e+00, 2.49840540782452880e+00, 2.97794583715608185e+00,
+    3.35999888399848956e+00, 4.32619024513199157e+00, 1.79643051812730992e+00, 2.12821704767452946e+00,
+    2.46645058052239108e+00, 2.93111771634519203e+00, 3.29987573609922302e+00, 4.22740421368763108e+00,
+    1.78307627703160199e+00, 2.10767340403212122e+00, 2.43742910907749311e+00, 2.88873201825158921e+00,
+    3.24559271126415938e+00, 4.13872161387318105e+00, 1.77083444769006526e+00, 2.08888731929872806e+00,
+    2.41095448343609364e+00, 2.85018623548500649e+00, 3.19634126819729980e+00, 4.05868016656215680e+00,
+    1.75957102575442637e+00, 2.07164192774484768e+00, 2.38670524263981898e+00, 2.81498190060932396e+00,
+    3.15145504598312742e+00, 3.98608494688923631e+00, 1.74917275860886323e+00, 2.05575468549018492e+00,
+    2.36441184819944406e+00, 2.78270310074735194e+00, 3.11038002022630877e+00, 3.91995028434331916e+00,
+    1.73954327064935188e+00, 2.04107083368635545e+00, 2.34384661085958346e+00, 2.75300009579736749e+00,
+    3.07265185349327696e+00, 3.85945611398550259e+00, 1.73060002656743550e+00, 2.02745830139500693e+00,
+    2.32481587365560882e+00, 2.72557668213821280e+00, 3.03787849964813716e+00, 3.80391476841088005e+00,
+    1.72227192837419096e+00, 2.01480369129548897e+00, 2.30715388324466586e+00, 2.70018034097659454e+00,
+    3.00572669634996981e+00, 3.75274541929403638e+00, 1.68795771241582182e+00, 1.96288406076284283e+00,
+    2.23499042774591627e+00, 2.59696860218087000e+00, 2.87557461555778726e+00, 3.54744686796401254e+00,
+    1.66241081001624424e+00, 1.92446282352767017e+00, 2.18190332079259708e+00, 2.52161568658245017e+00,
+    2.78108472343424795e+00, 3.40027972812768153e+00, 1.62689575864166902e+00, 1.87138397770218901e+00,
+    2.10901157067265244e+00, 2.41896140637145418e+00, 2.65310271803865794e+00, 3.20353238951996744e+00,
+    1.60336835225866814e+00, 1.83643736018714177e+00, 2.06130841974815393e+00, 2.35229698684190724e+00,
+    2.57046112840297836e+00, 3.07810238530028890e+00, 1.57411035975612634e+00, 1.79322178940048715e+00,
+    2.00263949674153352e+00, 2.27087925424410342e+00, 2.47004731956655776e+00, 2.92744574817292014e+00,
+    1.55662857499618346e+00, 1.76753005556657672e+00, 1.96793155612787118e+00, 2.22301469499283044e+00,
+    2.41128653536854509e+00, 2.84019027309539585e+00, 1.54500164327276313e+00, 1.75049696066350347e+00,
+    1.94499194011044962e+00, 2.19150406384326457e+00, 2.37271439035396625e+00, 2.78328352752507469e+00,
+    6.17402924017383796e+01, 2.48013082084739409e+02, 9.93102804576249355e+02, 6.20873022176232644e+03,
+    2.48359709060748573e+04, 6.20907672683528741e+05, 9.44130938129717556e+00, 1.94457684906169348e+01,
+    3.94479113033782767e+01, 9.94491708487019110e+01, 1.99449586465474454e+02, 9.99449917458723803e+02,
+    5.18448168328021097e+00, 8.66018980193069687e+00, 1.41673813814000180e+01, 2.66897905101150030e+01,
+    4.27775001252862026e+01, 1.26417773966132188e+02, 3.84433830977792823e+00, 5.80254189325282344e+00,
+    8.55994318705354296e+00, 1.40196086808265807e+01, 2.01672758990373389e+01, 4.61002576392652941e+01,
+    3.20665034711497121e+00, 4.55813149739652079e+00, 6.32855523513256557e+00, 9.55264616178878079e+00,
+    1.29034880633884264e+01, 2.53946220945252215e+01, 2.83633964610551681e+00, 3.87418858102651154e+00,
+    5.16840093806999512e+00, 7.39583189132380880e+00, 9.58877072799390717e+00, 1.71201101960967854e+01,
+    2.59473154401329076e+00, 3.44452483207532367e+00, 4.46673962021407789e+00, 6.15543838557283696e+00,
+    7.75396066892929614e+00, 1.29316257375717232e+01, 2.42463733671052717e+00, 3.15032377350285531e+00,
+    3.99945297072830508e+00, 5.35909494076933246e+00, 6.60820487095108788e+00, 1.04796828214099200e+01,
+    2.29832236139196944e+00, 2.93645539216144114e+00, 3.66690550345881983e+00, 4.80799522878687569e+00,
+    5.83184097835868887e+00, 8.89761271260687892e+00, 2.20074391691795812e+00, 2.77401639832112323e+00,
+    3.41854351618503705e+00, 4.40539476639540073e+00, 5.27401674857659408e+00, 7.80374705301921523e+00,
+    2.12304596760460296e+00, 2.64644515373030265e+00, 3.22614477496476937e+00, 4.09904624866762202e+00,
+    4.85522024666576968e+00, 7.00759318084181793e+00, 2.05967734568233407e+00, 2.54358832965295711e+00,
+    3.07277252355278829e+00, 3.85843310269778872e+00, 4.52992174586401397e+00, 6.40480556637927556e+00,
+    2.00698186323580741e+00, 2.45888177180146350e+00, 2.94767084668869295e+00, 3.66460910395461115e+00,
+    4.27031764113676626e+00, 5.93397375590901976e+00, 1.96245297938949381e+00, 2.38789605513758429e+00,
+    2.84369122275465758e+00, 3.50522233994243049e+00, 4.05853419136855642e+00, 5.55683623976120789e+00,
+    1.92431449111637232e+00, 2.32753500898829424e+00, 2.75590195097799651e+00, 3.37189158209254058e+00,
+    3.88258919746509701e+00, 5.24842474789065871e+00, 1.89127227077047211e+00, 2.27556958522599695e+00,
+    2.68079296081215190e+00, 3.25873736382192503e+00, 3.73416526057379761e+00, 4.99180933363616131e+00,
+    1.86236085730644674e+00, 2.23035428217539833e+00, 2.61579913892968952e+00, 3.16151753655509893e+00,
+    3.60731668681237982e+00, 4.77513474547665862e+00, 1.83684515717684671e+00, 2.19064792556780308e+00,
+    2.55900297384267583e+00, 3.07709672020026304e+00, 3.49768510515368902e+00, 4.58986841281319258e+00,
+    1.81415546143658357e+00, 2.15549663713150874e+00, 2.50894262108440724e+00, 3.00310877165813528e+00,
+    3.40200562688489727e+00, 4.42972234805784826e+00, 1.79384330657029700e+00, 2.12415521291973608e+00,
+    2.46448429754212173e+00, 2.93773527736581652e+00, 3.31778577540169373e+00, 4.28996644502138924e+00,
+    1.77555077168901754e+00, 2.09603297655812071e+00, 2.42473522258849661e+00, 2.87955619278635888e+00,
+    3.24309081106307406e+00, 4.16697774716406499e+00, 1.75898866805808618e+00, 2.07065566124294520e+00,
+    2.38898285266909705e+00, 2.82744669699502449e+00, 3.17639661277562046e+00, 4.05793669916940480e+00,
+    1.74392075259301271e+00, 2.04763804686297046e+00, 2.35665160051488609e+00, 2.78050443799540536e+00,
+    3.11648663010630855e+00, 3.96061762241344972e+00, 1.73015210810842146e+00, 2.02666397155394939e+00,
+    2.32727144460861668e+00, 2.73799723465245348e+00, 3.06237828352906893e+00, 3.87324115305224970e+00,
+    1.71752046014505488e+00, 2.00747149880380116e+00, 2.30045478849216956e+00, 2.69932483918320676e+00,
+    3.01326946946426455e+00, 3.79436836631106500e+00, 1.70588959868053802e+00, 1.98984175257759732e+00,
+    2.27587914863788177e+00, 2.66399054758904130e+00, 2.96849905926627722e+00, 3.72282352578075448e+00,
+    1.69514433191638880e+00, 1.97359040393397556e+00, 2.25327402834233537e+00, 2.63157982606866003e+00,
+    2.92751731061876841e+00, 3.65763685579269149e+00, 1.68518657093012769e+00, 1.95856110227110092e+00,
+    2.23241084321531824e+00, 2.60174401390101462e+00, 2.88986341278875392e+00, 3.59800155698427160e+00,
+    1.67593225981302685e+00, 1.94462035179968162e+00, 2.21309510184790570e+00, 2.57418775181348902e+00,
+    2.85514824112206522e+00, 3.54324110987620866e+00, 1.66730894541878594e+00, 1.93165347523692899e+00,
+    2.19516027410503245e+00, 2.54865918010192738e+00, 2.82304096634227042e+00, 3.49278411445035042e+00,
+    1.63171799991421262e+00, 1.87837502418800284e+00, 2.12179155075028758e+00, 2.44480987413673345e+00,
+    2.69296777407433074e+00, 3.29026321796237831e+00, 1.60515146637552664e+00, 1.83885934902421755e+00,
+    2.06771404641231227e+00, 2.36887612233739553e+00, 2.59841758825189872e+00, 3.14498953044471730e+00,
+    1.56810713250279621e+00, 1.78412481840491943e+00, 1.99329449015215387e+00, 2.26524280460787475e+00,
+    2.47016094475458781e+00, 2.95060455081470963e+00, 1.54348574182846487e+00, 1.74798413312285650e+00,
+    1.94446981876616620e+00, 2.19780590629038830e+00, 2.38720055712883550e+00, 2.82655183405060395e+00,
+    1.51276461892750635e+00, 1.70316008353486592e+00, 1.88426718353575851e+00, 2.11527070362414893e+00,
+    2.28621828194546062e+00, 2.67737933713747633e+00, 1.49434796220306665e+00, 1.67643424975316946e+00,
+    1.84856071184280824e+00, 2.06664609716771208e+00, 2.22701710825133414e+00, 2.59088000569205423e+00,
+    1.48207166003341229e+00, 1.65868014323658897e+00, 1.82491961250737944e+00, 2.03458806309885398e+00,
+    2.18810657072360426e+00, 2.53441831942982354e+00, 6.20020459389256970e+01, 2.49051774831324792e+02,
+    9.97249245200113023e+02, 6.23463089353309351e+03, 2.49395652599432760e+04, 6.23497464863769943e+05,
+    9.44961588680553177e+00, 1.94540887631674195e+01, 3.94562381900487082e+01, 9.94575016229220239e+01,
+    1.99457918522466144e+02, 9.99458250537300160e+02, 5.17636482333644654e+00, 8.63850104026308152e+00,
+    1.41241458217542810e+01, 2.65975232200181004e+01, 4.26222253094903891e+01, 1.25934889734871916e+02,
+    3.83099447976445484e+00, 5.77438865670792367e+00, 8.51087345159414177e+00, 1.39290635359141177e+01,
+    2.00300007119073697e+01, 4.57657976202761105e+01, 3.19052293745672566e+00, 4.52715310773035551e+00,
+    6.27804014185107917e+00, 9.46647080061530843e+00, 1.27802100477305238e+01, 2.51329424433920394e+01,
+    2.81834477798343963e+00, 3.84145690179577226e+00, 5.11719240086073235e+00, 7.31272081159338949e+00,
+    9.47419878974599783e+00, 1.68973686836736761e+01, 2.57532725832272558e+00, 3.41049437606472905e+00,
+    4.41499906508548889e+00, 6.07431925012708795e+00, 7.64496818384309851e+00, 1.27322003639342807e+01,
+    2.40409654409670415e+00, 3.11523979602632206e+00, 3.94722033754801327e+00, 5.27926438723945690e+00,
+    6.50294578973820681e+00, 1.02954336303306295e+01, 2.27682727292276921e+00, 2.90047376005129420e+00,
+    3.61419574061902438e+00, 4.72899756510070279e+00, 5.72917229421589980e+00, 8.72386163231521117e+00,
+    2.17842592063176044e+00, 2.73724765290368577e+00, 3.36536871436383667e+00, 4.32692916407610717e+00,
+    5.17319681833546241e+00, 7.63759696895345996e+00, 2.10000504541186617e+00, 2.60897361888429069e+00,
+    3.17251876983611192e+00, 4.02090959369085255e+00, 4.75574832874012277e+00, 6.84714354703588768e+00,
+    2.03599259657335674e+00, 2.50548154673481349e+00, 3.01871116261900552e+00, 3.78048547175543259e+00,
+    4.43144846475613097e+00, 6.24875178758615046e+00, 1.98271770095411393e+00, 2.42019567658891832e+00,
+    2.89319132297070603e+00, 3.58675252371040942e+00, 4.17259254523653134e+00, 5.78138710101270625e+00,
+    1.93766303155631259e+00, 2.34867807599335432e+00, 2.78881136625681947e+00, 3.42738736722117565e+00,
+    3.96137367208060498e+00, 5.40703554147771293e+00, 1.89904418629445559e+00, 2.28782605814479156e+00,
+    2.70063967802580107e+00, 3.29402859380506907e+00, 3.78585610836320097e+00, 5.10089785820491581e+00,
+    1.86556063113297133e+00, 2.23540541550239213e+00, 2.62516589206724094e+00, 3.18081076055147749e+00,
+    3.63775554001325485e+00, 4.84616303116239422e+00, 1.83624178611594679e+00, 2.18976645613862875e+00,
+    2.55982435245840634e+00, 3.08350179739894115e+00, 3.51115032594897247e+00, 4.63106166226749583e+00,
+    1.81034839141327120e+00, 2.14966453482584141e+00, 2.50269685640706019e+00, 2.99897366345600469e+00,
+    3.40169989829558972e+00, 4.44712454064293450e+00, 1.78730729453086479e+00, 2.11414285291800486e+00,
+    2.45232078771021733e+00, 2.92486561893761410e+00, 3.30615275324043134e+00, 4.28811134235316871e+00,
+    1.76666714847696116e+00, 2.08245371821648062e+00, 2.40756155725123389e+00, 2.85936326405220953e+00,
+    3.22202661600843276e+00, 4.14932842406258207e+00, 1.74806759084279761e+00, 2.05400431223556845e+00,
+    2.36752557463319357e+00, 2.80104955688843749e+00, 3.14739461695129341e+00, 4.02718114000840099e+00,
+    1.73121734560974283e+00, 2.02831850802453495e+00, 2.33149950240309378e+00, 2.74880193442955401e+00,
+    3.08073877114586558e+00, 3.91887220788364843e+00, 1.71587837020757639e+00, 2.00500945824511589e+00,
+    2.29890698745402355e+00, 2.70171974825595296e+00, 3.02084735791286718e+00, 3.82219367998502602e+00,
+    1.70185418457255655e+00, 1.98375956848961255e+00, 2.26927727762142650e+00, 2.65907210434815688e+00,
+    2.96674163129276280e+00, 3.73538045831805965e+00, 1.68898114792889764e+00, 1.96430563406537617e+00,
+    2.24222208471198403e+00, 2.62025972662069506e+00, 2.91762255342809551e+00, 3.65700520693118580e+00,
+    1.67712184874918036e+00, 1.94642765072450818e+00, 2.21741827382539824e+00, 2.58478664221185861e+00,
+    2.87283146376248455e+00, 3.58590168621806749e+00, 1.66616003306492977e+00, 1.92994028140554641e+00,
+    2.19459473720870246e+00, 2.55223886389769294e+00, 2.83182061878493929e+00, 3.52110796531800263e+00,
+    1.65599666845640958e+00, 1.91468627111105860e+00, 2.17352231875134949e+00, 2.52226813523929660e+00,
+    2.79413083508995053e+00, 3.46182377265067931e+00, 1.64654685727032146e+00, 1.90053130977166185e+00,
+    2.15400599307117702e+00, 2.49457939110205817e+00, 2.75937431912608178e+00, 3.40737805730660526e+00,
+    1.63773739239183880e+00, 1.88735998453029175e+00, 2.13587873188591804e+00, 2.46892098040852614e+00,
+    2.72722133491064866e+00, 3.35720402906926063e+00, 1.60133437301987436e+00, 1.83318438538508488e+00,
+    2.06165491111300625e+00, 2.36446551103597491e+00, 2.59688076115035527e+00, 3.15574005248940237e+00,
+    1.57411084051115457e+00, 1.79293703477398947e+00, 2.00686831912761576e+00, 2.28799770991158358e+00,
+    2.50204003137280040e+00, 3.01112991663177132e+00, 1.53606637093889642e+00, 1.73707961409342881e+00,
+    1.93134275511711206e+00, 2.18348502678845602e+00, 2.37322903746417646e+00, 2.81747058000817630e+00,
+    1.51071817715104606e+00, 1.70011669647982577e+00, 1.88169625814425401e+00, 2.11536433560284465e+00,
+    2.28979076344415233e+00, 2.69375743366608367e+00, 1.47900944475676965e+00, 1.65416787921746966e+00,
+    1.82035530655933719e+00, 2.03184705219488393e+00, 2.18807099536354377e+00, 2.54482910448400812e+00,
+    1.45995201430937360e+00, 1.62670811035169094e+00, 1.78389832007220273e+00, 1.98255615279878472e+00,
+    2.12834310912998470e+00, 2.45837068417364657e+00, 1.44722598247045053e+00, 1.60843709629408593e+00,
+    1.75972535353064896e+00, 1.95001810239939366e+00, 2.08904248124278036e+00, 2.40188842687198933e+00,
+    6.22649698015311799e+01, 2.50095148187008846e+02, 1.00141440808794482e+03, 6.26064857938372916e+03,
+    2.50436276701242787e+04, 6.26098958451814367e+05, 9.45792727007768796e+00, 1.94624114104030923e+01,
+    3.94645662488393540e+01, 9.94658328624354198e+01, 1.99466250811519927e+02, 9.99466583662195944e+02,
+    5.16811132856014943e+00, 8.61657587019733384e+00, 1.40805233732638957e+01, 2.65045336968258773e+01,
+    4.24658002741300962e+01, 1.25448635959269723e+02, 3.81742176878725026e+00, 5.74587698254355406e+00,
+    8.46127401385552425e+00, 1.38376603413669113e+01, 1.98915027323204185e+01, 4.54285870806798542e+01,
+    3.17408428720439906e+00, 4.49571226171615557e+00, 6.22687890250677256e+00, 9.37932920600002085e+00,
+    1.26556402170267557e+01, 2.48687733798305928e+01, 2.79996007765557264e+00, 3.80816426527035912e+00,
+    5.06522684198270490e+00, 7.22853306183945321e+00, 9.35824455611661854e+00, 1.66722163341017193e+01,
+    2.55545695938075212e+00, 3.37580750190044432e+00, 4.36239304589719001e+00, 5.99201017448509354e+00,
+    7.53448952195256361e+00, 1.25303550510086126e+01, 2.38301566557066824e+00, 3.07940647197049966e+00,
+    3.89401591662926494e+00, 5.19812954884501988e+00, 6.39608956666799777e+00, 1.01087097080272201e+01,
+    2.25472010109922394e+00, 2.86365234377169608e+00, 3.56041018323358127e+00, 4.64858167442078951e+00,
+    5.62479230915436457e+00, 8.54755576989149013e+00, 2.15542594467906001e+00, 2.69955123302636890e+00,
+    3.31101666781550064e+00, 4.24693281746161944e+00, 5.07055061310664712e+00, 7.46879770699683565e+00,
+    2.07621437253835417e+00, 2.57048912119216144e+00, 3.11761680871634184e+00, 3.94113177577334550e+00,
+    4.65433582952133573e+00, 6.68394226865929930e+00, 2.01149245748165928e+00, 2.46627914233361167e+00,
+    2.96327798724817404e+00, 3.70078878926429677e+00, 4.33092190159681412e+00, 6.08983963734413969e+00,
+    1.95757462807946392e+00, 2.38033392979262581e+00, 2.83724703460074856e+00, 3.50704179851112041e+00,
+    4.07270366684801477e+00, 5.62583349731821603e+00, 1.91193274145933501e+00, 2.30820701764592995e+00,
+    2.73237671312316621e+00, 3.34759610211931724e+00, 3.86194144218911672e+00, 5.25415903399427808e+00,
+    1.87277415366016964e+00, 2.24678915755601283e+00, 2.64373547093339445e+00, 3.21411018322425779e+00,
+    3.68674617643802582e+00, 4.95018705378703938e+00, 1.83879187184317994e+00, 2.19384092290804444e+00,
+    2.56781259801985673e+00, 3.10073263896027784e+00, 3.53886676305813097e+00, 4.69722615623649276e+00,
+    1.80901013806085142e+00, 2.14770836184740377e+00, 2.50204183056636076e+00, 3.00324145574173551e+00,
+    3.41240566711474047e+00, 4.48359325835264677e+00, 1.78268546280082885e+00, 2.10714328186887156e+00,
+    2.44450419749008585e+00, 2.91851588323342170e+00, 3.30304012908805422e+00, 4.30088281200896994e+00,
+    1.75924118413174391e+00, 2.07118588359843558e+00, 2.39373622628409777e+00, 2.84420051813215746e+00,
+    3.20753200181878562e+00, 4.14290234922097955e+00, 1.73822300460645462e+00, 2.03908590418200752e+00,
+    2.34860243274174740e+00, 2.77848489545518840e+00, 3.12340916099435972e+00, 4.00499480347537151e+00,
+    1.71926805327809396e+00, 2.01024830005931632e+00, 2.30820832536392873e+00, 2.71995488921343620e+00,
+    3.04875253983150474e+00, 3.88359389782938758e+00, 1.70208290056466960e+00, 1.98419500171368868e+00,
+    2.27183968089439592e+00, 2.66749010304751621e+00, 2.98205021198591824e+00, 3.77592464088376989e+00,
+    1.68642763943544249e+00, 1.96053745351039832e+00, 2.23891928913479799e+00, 2.62019149864323841e+00,
+    2.92209520231803133e+00, 3.67979680489799277e+00, 1.67210416367955683e+00, 1.93895654935385298e+00,
+    2.20897557755321294e+00, 2.57732937509664284e+00, 2.86791251039620931e+00, 3.59345952609280417e+00,
+    1.65894740491729498e+00, 1.91918773955113031e+00, 2.18161947865950134e+00, 2.53830533471505815e+00,
+    2.81870607426338626e+00, 3.51549701101888701e+00, 1.64681869098905653e+00, 1.90100981741215280e+00,
+    2.15652712120794909e+00, 2.50262404404093042e+00, 2.77381961133467358e+00, 3.44475246028808524e+00,
+    1.63560064889520440e+00, 1.88423636628072644e+00, 2.13342670429570935e+00, 2.46987197288426286e+00,
+    2.73270728756844550e+00, 3.38027172428633271e+00, 1.62519324817396260e+00, 1.86870915813108374e+00,
+    2.11208842103706029e+00, 2.43970118215782916e+00, 2.69491145910566132e+00, 3.32126099113139439e+00,
+    1.61551069720810236e+00, 1.85429300285267318e+00, 2.09231663615734531e+00, 2.41181681682573501e+00,
+    2.66004557781720896e+00, 3.26705460771265566e+00, 1.60647898499872799e+00, 1.84087168911175758e+00,
+    2.07394375047163004e+00, 2.38596735345851974e+00, 2.62778091780928458e+00, 3.21709032153228325e+00,
+    1.56909895799815469e+00, 1.78559088278952771e+00, 1.99862180474561879e+00, 2.28062592054689928e+00,
+    2.49687123575276138e+00, 3.01634725447659502e+00, 1.54107579307886677e+00, 1.74443196432073799e+00,
+    1.94291599969419737e+00, 2.20338204519011338e+00, 2.40147876937116056e+00, 2.87210868315434720e+00,
+    1.50179743759740725e+00, 1.68715693087833452e+00, 1.86594021825740830e+00, 2.09759343957187339e+00,
+    2.27168521502190801e+00, 2.67869478384914839e+00, 1.47553934150333688e+00, 1.64914100902140648e+00,
+    1.81520244038689960e+00, 2.02847851709924987e+00, 2.18743372239438116e+00, 2.55494430086621893e+00,
+    1.44257529688218522e+00, 1.60173017535704498e+00, 1.75232953289197946e+00, 1.94352573909186410e+00,
+    2.08448664129158434e+00, 2.40570883915961842e+00, 1.42269115889494424e+00, 1.57330234982898864e+00,
+    1.71484887885012038e+00, 1.89325403141116499e+00, 2.02389230219190885e+00, 2.31890869513445574e+00,
+    1.40937888239831710e+00, 1.55434259639566763e+00, 1.68994363360361133e+00, 1.86000528371710727e+00,
+    1.98395243927503229e+00, 2.26212523350589256e+00, 6.25290517327160202e+01, 2.51143153132783226e+02,
+    1.00559809716578968e+03, 6.28678205385285673e+03, 2.51481532347724460e+04, 6.28712030901526683e+05,
+    9.46624353112717820e+00, 1.94707364323255128e+01, 3.94728954797503988e+01, 9.94741645672421271e+01,
+    1.99474583332635831e+02, 9.99474916833411157e+02, 5.15971942410623097e+00, 8.59441124999818129e+00,
+    1.40365090736279061e+01, 2.64108126893093882e+01, 4.23082102904820800e+01, 1.24958969499583517e+02,
+    3.80361474161746838e+00, 5.71699840549477845e+00, 8.41113238942865138e+00, 1.37453788946740314e+01,
+    1.97517531786592322e+01, 4.50885612941137524e+01, 3.15732383249133841e+00, 4.46379332437723431e+00,
+    6.17504970397502095e+00, 9.29118878308340435e+00, 1.25297350028852090e+01, 2.46020309589438675e+01,
+    2.78116854807294889e+00, 3.77428628481601791e+00, 5.01247138434695749e+00, 7.14322190229686971e+00,
+    9.24084802478940226e+00, 1.64445484998912868e+01, 2.53509605915131697e+00, 3.34042965183301765e+00,
+    4.30887602703880379e+00, 5.90844855646239164e+00, 7.42244648974614485e+00, 1.23259624485121542e+01,
+    2.36136150669706346e+00, 3.04277782113251538e+00, 3.83978009385544139e+00, 5.11561039574817666e+00,
+    6.28753817672615423e+00, 9.91935909103534463e+00, 2.23195816491011145e+00, 2.82593265367080848e+00,
+    3.50547389987431979e+00, 4.56664872104346564e+00, 5.51858171038976852e+00, 8.36851686051038435e+00,
+    2.13169106674529285e+00, 2.66085520720411273e+00, 3.25539606377587276e+00, 4.16528689740992952e+00,
+    4.96593627442860264e+00, 7.29714325694640831e+00, 2.05161014502105576e+00, 2.53090549698819700e+00,
+    3.06133029602677720e+00, 3.85957296630570346e+00, 4.55081727967338967e+00, 6.51775438071183277e+00,
+    1.98610170548540332e+00, 2.42588005875097767e+00, 2.90634636559214021e+00, 3.61918138840185266e+00,
+    4.22815209011363713e+00, 5.92780420173658928e+00, 1.93146555743415238e+00, 2.33918003287017129e+00,
+    2.77969269303045152e+00, 3.42529273587016103e+00, 3.97043581940739809e+00, 5.46701728136224130e+00,
+    1.88516279401987408e+00, 2.26635049613452777e+00, 2.67422281615255208e+00, 3.26564127427125683e+00,
+    3.75999651723544481e+00, 5.09787967554650123e+00, 1.84539255869991248e+00, 2.20427568363230719e+00,
+    2.58500532674198613e+00, 3.13190556980723223e+00, 3.58499217110880286e+00, 4.79593343736174749e+00,
+    1.81084141086542649e+00, 2.15071096954761876e+00, 2.50852921518579652e+00, 3.01824838174319732e+00,
+    3.43720511887418301e+00, 4.54460761177092909e+00, 1.78052841114889215e+00, 2.10399814218748071e+00,
+    2.44222762548297689e+00, 2.92045782370202200e+00, 3.31076208521255078e+00, 4.33230600860793924e+00,
+    1.75370582564410271e+00, 2.06288544646738448e+00, 2.38418081211133748e+00, 2.83542046837018091e+00,
+    3.20135821166566092e+00, 4.15068714654207316e+00, 1.72979345958821917e+00, 2.02641005516009365e+00,
+    2.33292442345945883e+00, 2.76078625277618173e+00, 3.10576875568748267e+00, 3.99360669346112562e+00,
+    1.70833403510440718e+00, 1.99381909867255658e+00, 2.28732204485743074e+00, 2.69474862919129432e+00,
+    3.02153175821173914e+00, 3.85644434940603231e+00, 1.68896213784100180e+00, 1.96451526561625966e+00,
+    2.24647823895515275e+00, 2.63589635403554423e+00, 2.94673594542905892e+00, 3.73566232959207989e+00,
+    1.67138214624230730e+00, 1.93801849630550183e+00, 2.20967784507689791e+00, 2.58311115228539734e+00,
+    2.87987542134123897e+00, 3.62850800750173397e+00, 1.65535224793721825e+00, 1.91393847580170373e+00,
+    2.17634273941827860e+00, 2.53549554178722270e+00, 2.81974791454649054e+00, 3.53280891237004502e+00,
+    1.64067266807124046e+00, 1.89195453305394046e+00, 2.14600046921335297e+00, 2.49232095464214520e+00,
+    2.76538211839951442e+00, 3.44682842385344479e+00, 1.62717686722238208e+00, 1.87180071874514065e+00,
+    2.11826112567015512e+00, 2.45298980717839843e+00, 2.71598488794301041e+00, 3.36916227929785661e+00,
+    1.61472486875060373e+00, 1.85325456847386860e+00, 2.09280003800541436e+00, 2.41700733818802105e+00,
+    2.67090225464585806e+00, 3.29866309209436404e+00, 1.60319813678400269e+00, 1.83612853063183268e+00,
+    2.06934464853057642e+00, 2.38396040572726609e+00, 2.62959022665740649e+00, 3.23438445467245694e+00,
+    1.59249559930965945e+00, 1.82026334915316945e+00, 2.04766443608376436e+00, 2.35350131853271982e+00,
+    2.59159263030987042e+00, 3.17553896693366644e+00, 1.58253052782005699e+00, 1.80552289955497791e+00,
+    2.02756309257904954e+00, 2.32533536209114589e+00, 2.55652409246008361e+00, 3.12146631930387963e+00,
+    1.57322806527984027e+00, 1.79179011863201421e+00, 2.00887238593506501e+00, 2.29921107153058024e+00,
+    2.52405682655683306e+00, 3.07160873823130132e+00, 1.53464627576308787e+00, 1.73511925421759727e+00,
+    1.93211779999826483e+00, 2.19259539310924723e+00, 2.39215636929907971e+00, 2.87110756774118059e+00,
+    1.50562495322954448e+00, 1.69279720970242953e+00, 1.87519737683027343e+00, 2.11423245409964666e+00,
+    2.29583946918799420e+00, 2.72681593090287988e+00, 1.46477897179190242e+00, 1.63368179182278150e+00,
+    1.79627499270500457e+00, 2.00659151113889056e+00, 2.16443675609628317e+00, 2.53293187130200437e+00,
+    1.43734220486363307e+00, 1.59427252011400600e+00, 1.74404642761331630e+00, 1.93601847158435092e+00,
+    2.07886766600596529e+00, 2.40856709397379376e+00, 1.40271811748792574e+00, 1.54488737446684787e+00,
+    1.67904043187796304e+00, 1.84893238023333684e+00, 1.97393453822366705e+00, 2.25815582428978656e+00,
+    1.38171781280381900e+00, 1.51512527338771918e+00, 1.64010656317776271e+00, 1.79718142659177071e+00,
+    1.91193187979299317e+00, 2.17039338810899940e+00, 1.36760234044683937e+00, 1.49520239286037659e+00,
+    1.61414730765064474e+00, 1.76284878194695493e+00, 1.87094714037786591e+00, 2.11284420125586792e+00,
+    6.26880515192078036e+01, 2.51774158286399171e+02, 1.00811711927619535e+03, 6.30251719264963776e+03,
+    2.52110887900193302e+04, 6.30285379782798118e+05, 9.47123562909449745e+00, 1.94757325853291263e+01,
+    3.94778935809148805e+01, 9.94791638134669540e+01, 1.99479582956695197e+02, 9.99479916758373633e+02,
+    5.15461710215209390e+00, 8.58099626695955564e+00, 1.40099103243463414e+01, 2.63542250919003607e+01,
+    4.22130909468145603e+01, 1.24663513438885687e+02, 3.79521571545726033e+00, 5.69949150091053003e+00,
+    8.38078178772166105e+00, 1.36895797622119506e+01, 1.96672902908914580e+01, 4.48831666164292287e+01,
+    3.14710846167514946e+00, 4.44440561835855075e+00, 6.14362199168716661e+00, 9.23781078563209590e+00,
+    1.24535317671651846e+01, 2.44407134484684185e+01, 2.76969077793207008e+00, 3.75366765904947153e+00,
+    4.98042429824676791e+00, 7.09147512687212345e+00, 9.16969104544127234e+00, 1.63066936996682799e+01,
+    2.52263291205581375e+00, 3.31885564158028723e+00, 4.27630793641608342e+00, 5.85768204471300358e+00,
+    7.35443439905449381e+00, 1.22020465782536931e+01, 2.34807862314018267e+00, 3.02039779496912875e+00,
+    3.80671619702394359e+00, 5.06539774378159180e+00, 6.22154872530447722e+00, 9.80441824759290981e+00,
+    2.21796690719449785e+00, 2.80284251718998956e+00, 3.47192499788221776e+00, 4.51671488161812107e+00,
+    5.45392127710908525e+00, 8.25969891807418399e+00, 2.11707253281070651e+00, 2.63712399507392137e+00,
+    3.22137190570274612e+00, 4.11545174286620963e+00, 4.90215634885285478e+00, 7.19268336404695408e+00,
+    2.03642680169048607e+00, 2.50658681907442560e+00, 3.02684222950520621e+00, 3.80971640437674308e+00,
+    4.48761667546174259e+00, 6.41649652324582309e+00, 1.97040365757240243e+00, 2.40101769832935830e+00,
+    2.87140736314402734e+00, 3.56922222261489042e+00, 4.16532229142027877e+00, 5.82895666950760294e+00,
+    1.91529421868724503e+00, 2.31381098568517496e+00, 2.74431683370594603e+00, 3.37517562036249696e+00,
+    3.90782891735503757e+00, 5.37001823289964442e+00, 1.86855318405388826e+00, 2.24050676973042640e+00,
+    2.63842476387391400e+00, 3.21532844743758117e+00, 3.69750556362045657e+00, 5.00231871263466843e+00,
+    1.82837481974721827e+00, 2.17798544276057537e+00, 2.54879992384572818e+00, 3.08137147336344297e+00,
+    3.52253867727848302e+00, 4.70150355971536715e+00, 1.79344185476467222e+00, 2.12399931061803793e+00,
+    2.47193119419561746e+00, 2.96747606967706234e+00, 3.37473083780726357e+00, 4.45107455481639036e+00,
+    1.76277026923599145e+00, 2.07688764363988376e+00, 2.40525141551579935e+00, 2.86943651165184921e+00,
+    3.24822345519439493e+00, 4.23948798619321998e+00, 1.73560980275942356e+00, 2.03539657621493264e+00,
+    2.34684041491365569e+00, 2.78414382798890525e+00, 3.13872250681960274e+00, 4.05844106571633034e+00,
+    1.71137815425192952e+00, 1.99856148246992493e+00, 2.29523333877456936e+00, 2.70925120393415053e+00,
+    3.04301136178379705e+00, 3.90181853054589833e+00, 1.68961626540535881e+00, 1.96562793950529291e+00,
+    2.24929323002304082e+00, 2.64295447173365794e+00, 2.95863420862974857e+00, 3.76502227976793780e+00,
+    1.66995719910621698e+00, 1.93599727998854543e+00, 2.20812409190474312e+00, 2.58384413542078351e+00,
+    2.88368448181071990e+00, 3.64453172623281851e+00, 1.65210401818591568e+00, 1.90918825001292070e+00,
+    2.17101020311326698e+00, 2.53080320179730212e+00, 2.81665992341736215e+00, 3.53760773651904925e+00,
+    1.63581376362400510e+00, 1.88480947498335172e+00, 2.13737288842391537e+00, 2.48293512411787365e+00,
+    2.75636109419580366e+00, 3.44208854639513628e+00, 1.62088565349337865e+00, 1.86253933760601642e+00,
+    2.10673915958405678e+00, 2.43951201015162544e+00, 2.70181890575490558e+00, 3.35624611688343277e+00,
+    1.60715225789635086e+00, 1.84211103895226169e+00, 2.07871859239554979e+00, 2.39993675583642041e+00,
+    2.65224195902081217e+00, 3.27868312570946419e+00, 1.59447280808691438e+00, 1.82330134810972000e+00,
+    2.05298602311568201e+00, 2.36371493079791950e+00, 2.60697766457504176e+00, 3.20825784524472590e+00,
+    1.58272805981427722e+00, 1.80592201899919846e+00, 2.02926842468556101e+00, 2.33043361058735732e+00,
+    2.56548312259945632e+00, 3.14402851606436728e+00, 1.57181630451548426e+00, 1.78981316397367918e+00,
+    2.00733483047072658e+00, 2.29974523488040594e+00, 2.52730302513747596e+00, 3.08521158139786866e+00,
+    1.56165023919354851e+00, 1.77483808220956352e+00, 1.98698851055899772e+00, 2.27135515393933485e+00,
+    2.49205268519529399e+00, 3.03114992876528877e+00, 1.55215448628946961e+00, 1.76087918294802503e+00,
+    1.96806083406965215e+00, 2.24501191713231840e+00, 2.45940485910295026e+00, 2.98128845877123316e+00,
+    1.51270658665880831e+00, 1.70318975476077017e+00, 1.89022903430254563e+00, 2.13737745344496988e+00,
+    2.32663231987634855e+00, 2.78061222721188628e+00, 1.48295531378592016e+00, 1.66000314557255990e+00,
+    1.83238326587818090e+00, 2.05811339165033980e+00, 2.22950984603683544e+00, 2.63599869744885185e+00,
+    1.44094223484816175e+00, 1.59949546683544241e+00, 1.75195330926507542e+00, 1.94896422050993889e+00,
+    2.09670801379701643e+00, 2.44133039570515553e+00, 1.41261016089509583e+00, 1.55901108603424543e+00,
+    1.69854842794469119e+00, 1.87718702737301624e+00, 2.00998850822010278e+00, 2.31617984466149718e+00,
+    1.37669713461739418e+00, 1.50806918366681741e+00, 1.63182402942324667e+00, 1.78830873759520159e+00,
+    1.90330402294632028e+00, 2.16441383883042171e+00, 1.35481044040515464e+00, 1.47723131597146051e+00,
+    1.59169407559279663e+00, 1.73529179065426931e+00, 1.84004289961433698e+00, 2.07559440664531980e+00,
+    1.34004664965145093e+00, 1.45651929510364320e+00, 1.56485364662966431e+00, 1.70001848086119711e+00,
+    1.79811410166527552e+00, 2.01721799698245929e+00, 6.27942790867374043e+01, 2.52195739093981956e+02,
+    1.00980011013705177e+03, 6.31303005258759185e+03, 2.52531368964763205e+04, 6.31336555777620291e+05,
+    9.47456466996453273e+00, 1.94790638289358995e+01, 3.94812258827819917e+01, 9.94824967373421600e+01,
+    1.99482916085813855e+02, 9.99483250050945799e+02, 5.15118732370489241e+00, 8.57200411265095674e+00,
+    1.39920979162276460e+01, 2.63163508611914096e+01, 4.21494404934931453e+01, 1.24465846815230734e+02,
+    3.78956775641207333e+00, 5.68774412920434269e+00, 8.36043560046875811e+00, 1.36521981906874785e+01,
+    1.96107221240835834e+01, 4.47456529558614307e+01, 3.14023037131994665e+00, 4.43137970423763772e+00,
+    6.12252939232885307e+00, 9.20201492871333571e+00, 1.24024481505886151e+01, 2.43326260571447008e+01,
+    2.76195183487317220e+00, 3.73979661264286323e+00, 4.95889050048468327e+00, 7.05673682141926228e+00,
+    9.12194435035489981e+00, 1.62142520864470399e+01, 2.51421756663463647e+00, 3.30432287642244482e+00,
+    4.25439799838506705e+00, 5.82356564092073281e+00, 7.30875320927080363e+00, 1.21188826954292281e+01,
+    2.33909707175220749e+00, 3.00530258373726067e+00, 3.78444640668327059e+00, 5.03161770679492104e+00,
+    6.17718234084214934e+00, 9.72721238147486567e+00, 2.20849321576161373e+00, 2.78724855729167231e+00,
+    3.44930216732906780e+00, 4.48308696121134798e+00, 5.41040561067843573e+00, 8.18654339166270795e+00,
+    2.10716065633245631e+00, 2.62107715569360566e+00, 3.19840227813712552e+00, 4.08185526547427102e+00,
+    4.85919129249860493e+00, 7.12239765187315577e+00, 2.02611833659376916e+00, 2.49012276868356119e+00,
+    3.00353323262398364e+00, 3.77607094738494986e+00, 4.44500073258322370e+00, 6.34830736706365695e+00,
+    1.95973201403178621e+00, 2.38416562738177351e+00, 2.84776760887413438e+00, 3.53547346928197337e+00,
+    4.12291602920480038e+00, 5.76233455843854525e+00, 1.90428706015974725e+00, 2.29659562216108304e+00,
+    2.72035575580606404e+00, 3.34128662452606262e+00, 3.86553351724842731e+00, 5.30458749233707572e+00,
+    1.85723395125797675e+00, 2.22294956883870887e+00, 2.61415225556530073e+00, 3.18127409371745706e+00,
+    3.65524967293858172e+00, 4.93780504381154994e+00, 1.81676373532424007e+00, 2.16010534182617331e+00,
+    2.52422605452878823e+00, 3.04713486778691811e+00, 3.48027003878258245e+00, 4.63770189513817677e+00,
+    1.78155661562162093e+00, 2.10581323785813623e+00, 2.44706600701402399e+00, 2.93304612846534507e+00,
+    3.33241078430063853e+00, 4.38782853958218677e+00, 1.75062654162386933e+00, 2.05841087865516359e+00,
+    2.38010478972013040e+00, 2.83480631389582083e+00, 3.20582318504135300e+00, 4.17667641909037179e+00,
+    1.72322158747268128e+00, 2.01664301616158737e+00, 2.32142197606390077e+00, 2.74930946768642581e+00,
+    3.09622050197602183e+00, 3.99596867008423118e+00, 1.69875806322155021e+00, 1.97954384535246275e+00,
+    2.26955240300027983e+00, 2.67421097598871782e+00, 3.00039155936047308e+00, 3.83960950945369950e+00,
+    1.67677573596044005e+00, 1.94635792381290051e+00, 2.22335877206963195e+00, 2.60770828593247783e+00,
+    2.91588468171768556e+00, 3.70301571402115925e+00, 1.65690666320376923e+00, 1.91648569294262416e+00,
+    2.18194472958161922e+00, 2.54839308893794891e+00, 2.84079647199734797e+00, 3.58267822326888208e+00,
+    1.63885303834070029e+00, 1.88944511255841241e+00, 2.14459419292072972e+00, 2.49514926376245416e+00,
+    2.77362712088707930e+00, 3.47586694754236136e+00, 1.62237114370454005e+00, 1.86484410910033183e+00,
+    2.11072812869180515e+00, 2.44708090058750205e+00, 2.71317909514174849e+00, 3.38042729822456334e+00,
+    1.60725953020139833e+00, 1.84236043988130116e+00, 2.07987319855644515e+00, 2.40346056753582937e+00,
+    2.65848479874396570e+00, 3.29463698680152595e+00, 1.59335017716021166e+00, 1.82172674326890593e+00,
+    2.05163863947007963e+00, 2.36369148733250922e+00, 2.60875400645077216e+00, 3.21710334069797277e+00,
+    1.58050178950292874e+00, 1.80271927957636713e+00, 2.02569896198956600e+00, 2.32727945480329890e+00,
+    2.56333505513722759e+00, 3.14668842219633937e+00, 1.56859465149661559e+00, 1.78514934072752252e+00,
+    2.00178082754189424e+00, 2.29381169311902688e+00, 2.52168577736593313e+00, 3.08245358336264896e+00,
+    1.55752663015969417e+00, 1.76885661794508886e+00, 1.97965297260730844e+00, 2.26294073016962738e+00,
+    2.48335144456573209e+00, 3.02361783863671096e+00, 1.54721003875283958e+00, 1.75370402520449398e+00,
+    1.95911838505117020e+00, 2.23437195889069518e+00, 2.44794782764865415e+00, 2.96952621283409002e+00,
+    1.53756915136179617e+00, 1.73957361831196566e+00, 1.94000816619231675e+00, 2.20785393642951089e+00,
+    2.41514804385379245e+00, 2.91962539266219334e+00, 1.49746623547066426e+00, 1.68110614912338363e+00,
+    1.86134110917255247e+00, 2.09940284066816618e+00, 2.28164345363171961e+00, 2.71865683547083448e+00,
+    1.46715670863326442e+00, 1.63725182397155766e+00, 1.80277040135087252e+00, 2.01941122207516877e+00,
+    2.18384488008435618e+00, 2.57366634042582154e+00, 1.42423844636982788e+00, 1.57565389970155256e+00,
+    1.72114372459743570e+00, 1.90903161162025969e+00, 2.04986358575489547e+00, 2.37818673627645705e+00,
+    1.39520075641115548e+00, 1.53431417981236451e+00, 1.66679076321488129e+00, 1.83625936041709292e+00,
+    1.96216623835697601e+00, 2.25226554559652437e+00, 1.35825336113401618e+00, 1.48211138433833378e+00,
+    1.59865713155953060e+00, 1.74587702089339114e+00, 1.85397504307461380e+00, 2.09919942156325057e+00,
+    1.33564171491748174e+00, 1.45038565461548319e+00, 1.55752813260894341e+00, 1.69177962866943776e+00,
+    1.78961570078806220e+00, 2.00937192394718789e+00, 1.32034017436722917e+00, 1.42901317795458693e+00,
+    1.52994156057475217e+00, 1.65569319900522527e+00, 1.74685363534353799e+00, 1.95020547846405190e+00,
+    6.29273182448757424e+01, 2.52723733748204666e+02, 1.01190792325471443e+03, 6.32619659337982375e+03,
+    2.53057988930252213e+04, 6.32653072358087054e+05, 9.47872706855612535e+00, 1.94832284177493626e+01,
+    3.94853915238430346e+01, 9.94866629968771576e+01, 1.99487082549426162e+02, 9.99487416677082933e+02,
+    5.14686813888433292e+00, 8.56070863492718459e+00, 1.39697419395099800e+01, 2.62688391991395491e+01,
+    4.20696084832881283e+01, 1.24217975675374689e+02, 3.78245245727109447e+00, 5.67297325995896706e+00,
+    8.33487482201191376e+00, 1.36052638225378626e+01, 1.95397163528143558e+01, 4.45730960563696001e+01,
+    3.13155507452165693e+00, 4.41498192098466991e+00, 6.09600243763828509e+00, 9.15702905824188917e+00,
+    1.23382713622810343e+01, 2.41968957954999375e+01, 2.75217788889175186e+00, 3.72231356604011854e+00,
+    4.93177862059394112e+00, 7.01303713593358324e+00, 9.06190560687342028e+00, 1.60980802680630894e+01,
+    2.50357504750464566e+00, 3.28598323610972542e+00, 4.22678159663178565e+00, 5.78060531216945250e+00,
+    7.25125851819762346e+00, 1.20142875711826171e+01, 2.32772324392292118e+00, 2.98622981534676990e+00,
+    3.75634493976060968e+00, 4.98903801326658236e+00, 6.12129006581596169e+00, 9.63003207158684305e+00,
+    2.19648024969605027e+00, 2.76752174114094185e+00, 3.42072339394839275e+00, 4.44065622336509769e+00,
+    5.35553335640056982e+00, 8.09438577881778087e+00, 2.09457566603231626e+00, 2.60075319408721040e+00,
+    3.16935340711253843e+00, 4.03942162189830523e+00, 4.80496229519266915e+00, 7.03378216541047685e+00,
+    2.01301306743223307e+00, 2.46924591797908688e+00, 2.97402310110900681e+00, 3.73353312207111854e+00,
+    4.39116195445747959e+00, 6.26226408956072511e+00, 1.94614805072853336e+00, 2.36277214149585291e+00,
+    2.81780666301147109e+00, 3.49276303325918125e+00, 4.06929235004435430e+00, 5.67819926806200570e+00,
+    1.89025886772469098e+00, 2.27471626055877962e+00, 2.68995557930851037e+00, 3.29835703416281234e+00,
+    3.81200084034513997e+00, 5.22188895117598673e+00, 1.84279077178994855e+00, 2.20061107266052547e+00,
+    2.58332510046971109e+00, 3.13809373371152533e+00, 3.60171843270779801e+00, 4.85619922360251088e+00,
+    1.80193083641346941e+00, 2.13733136756914321e+00, 2.49298447312214266e+00, 3.00368251450729984e+00,
+    3.42667469676835257e+00, 4.55693166765099278e+00, 1.76635614920825157e+00, 2.08262498461544654e+00,
+    2.41542258691828637e+00, 2.88930791628006878e+00, 3.27870291693630378e+00, 4.30769794087622859e+00,
+    1.73507815709996782e+00, 2.03482753113719239e+00, 2.34807197177518834e+00, 2.79077366025679918e+00,
+    3.15196680472276780e+00, 4.09703363937891929e+00, 1.70734288318191529e+00, 1.99268207083577575e+00,
+    2.28901193351940790e+00, 2.70497762535163178e+00, 3.04218881133608399e+00, 3.91669447260425052e+00,
+    1.68256492785809963e+00, 1.95522135887164161e+00, 2.23677696454029951e+00, 2.62957800495376981e+00,
+    2.94616465114700210e+00, 3.76060914104878563e+00, 1.66028261262456578e+00, 1.92168870763801447e+00,
+    2.19022937562271869e+00, 2.56277431210507212e+00, 2.86144787800593692e+00, 3.62421312712086197e+00,
+    1.64012675766089155e+00, 1.89148346938575407e+00, 2.14847239751502306e+00, 2.50315976237656734e+00,
+    2.78613910512504681e+00, 3.50401186709619239e+00, 1.62179848608065358e+00, 1.86412264231811142e+00,
+    2.11078952194990777e+00, 2.44961935813349685e+00, 2.71874162551472720e+00, 3.39728664873429764e+00,
+    1.60505314594996173e+00, 1.83921329717994264e+00, 2.07660128980660907e+00, 2.40125801405446504e+00,
+    2.65806032325679631e+00, 3.30189191292262141e+00, 1.58968846608661329e+00, 1.81643242474713174e+00,
+    2.04543394366232034e+00, 2.35734889748478027e+00, 2.60312949690681217e+00, 3.21611260884463190e+00,
+    1.57553569732586829e+00, 1.79551197276318120e+00, 2.01689631242678935e+00, 2.31729565949531269e+00,
+    2.55316041276209882e+00, 3.13856191712334764e+00, 1.56245289498730311e+00, 1.77622757618872340e+00,
+    1.99066251242235892e+00, 2.28060439289192152e+00, 2.50750258566777262e+00, 3.06810667139966764e+00,
+    1.55031976084318157e+00, 1.75838995819400123e+00, 1.96645882628776159e+00, 2.24686251892236166e+00,
+    2.46561478020397518e+00, 3.00381214111861095e+00, 1.53903363697058460e+00, 1.74183829069088447e+00,
+    1.94405362800330694e+00, 2.21572268675591477e+00, 2.42704300550387808e+00, 2.94490057772431246e+00,
+    1.52850636141426044e+00, 1.72643501181704795e+00, 1.92324955951552257e+00, 2.18689035147128630e+00,
+    2.39140361568139115e+00, 2.89071969637987003e+00, 1.51866177629427934e+00, 1.71206173998634514e+00,
+    1.90387739272193612e+00, 2.16011408681549577e+00, 2.35837018763237038e+00, 2.84071843151402748e+00,
+    1.47763246259947079e+00, 1.65248415636368051e+00, 1.82400316172063759e+00, 2.05045014890599342e+00,
+    2.22373941350802928e+00, 2.63913649714946796e+00, 1.44652379339652271e+00, 1.60766570637094630e+00,
+    1.76437278048301738e+00, 1.96936833175209935e+00, 2.12489696894961488e+00, 2.49344102241852328e+00,
+    1.40228953252714228e+00, 1.54446924903976268e+00, 1.68097080560995926e+00, 1.85712169502836288e+00,
+    1.98907957776452538e+00, 2.29652132004996323e+00, 1.37220725942412636e+00, 1.50185274420928905e+00,
+    1.62518673448754725e+00, 1.78281601535104772e+00, 1.89984145759894529e+00, 2.16926162536657774e+00,
+    1.33369607756358999e+00, 1.44772808425159027e+00, 1.55488200076724281e+00, 1.69007163173843811e+00,
+    1.78923692923980870e+00, 2.01394592348912260e+00, 1.30996330888300516e+00, 1.41461823839132816e+00,
+    1.51217940065054179e+00, 1.63424161059661932e+00, 1.72308481638979982e+00, 1.92236357095242294e+00,
+    1.29381565833439627e+00, 1.39219830180532078e+00, 1.48339747571168168e+00, 1.59682988826258221e+00,
+    1.67894168584440395e+00, 1.86180978996038071e+00, 6.30072769424224290e+01, 2.53041071271702037e+02,
+    1.01317477402932673e+03, 6.33411003599720880e+03, 2.53374501635219531e+04, 6.33444334120550542e+05,
+    9.48122509304683092e+00, 1.94857274560001379e+01, 3.94878910491341415e+01, 9.94891628084333632e+01,
+    1.99489582455441024e+02, 9.99489916658323637e+02, 5.14425949511711078e+00, 8.55390171383866260e+00,
+    1.39562798607992757e+01, 2.62402416810203434e+01, 4.20215651161841066e+01, 1.24068830677305002e+02,
+    3.77815346848689426e+00, 5.66406407097545284e+00, 8.31946939777864891e+00, 1.35769915066618392e+01,
+    1.94969537181916586e+01, 4.44692038839226669e+01, 3.12630786835625640e+00, 4.40508082443198479e+00,
+    6.07999905297654220e+00, 9.12990712929995674e+00, 1.22995909441176909e+01, 2.41151216687208958e+01,
+    2.74625903450639752e+00, 3.71174535817937379e+00, 4.91540572916026175e+00, 6.98666690984349525e+00,
+    9.02568925073360084e+00, 1.60280403776329230e+01, 2.49712222300711151e+00, 3.27488466349358998e+00,
+    4.21008679023112897e+00, 5.75465729990213593e+00, 7.21654711261237125e+00, 1.19511810682518842e+01,
+    2.32081844378265201e+00, 2.97467448706409909e+00, 3.73933924967160713e+00, 4.96329583318036072e+00,
+    6.08751668560841974e+00, 9.57135505822348165e+00, 2.18917845016479173e+00, 2.75555668125151199e+00,
+    3.40341091230134785e+00, 4.41497995219557637e+00, 5.32234714083386162e+00, 8.03869872963240617e+00,
+    2.08691685548921546e+00, 2.58841217971997128e+00, 3.15173798503404479e+00, 4.01371941549303202e+00,
+    4.77213611596075360e+00, 6.98019387763595045e+00, 2.00502805831778597e+00, 2.45655519818076629e+00,
+    2.95610964957042288e+00, 3.70774363698495968e+00, 4.35854316997960645e+00, 6.21019059568490039e+00,
+    1.93786160081522496e+00, 2.34975321867090292e+00, 2.79960113183802628e+00, 3.46684475433585959e+00,
+    4.03677525552349525e+00, 5.62724056504981185e+00, 1.88169150047278078e+00, 2.26138738957148888e+00,
+    2.67146466501862490e+00, 3.27228167547422322e+00, 3.77951048828615166e+00, 5.17176120211324886e+00,
+    1.83395991027115812e+00, 2.18698814091362337e+00, 2.56455595637800959e+00, 3.11184204757136795e+00,
+    3.56920070763370489e+00, 4.80669518762319026e+00, 1.79285154851648576e+00, 2.12342845007994452e+00,
+    2.47394448124638000e+00, 2.97724155643044908e+00, 3.39408999126712274e+00, 4.50789644568697589e+00,
+    1.75704165951104962e+00, 2.06845471578384643e+00, 2.39611919280001073e+00, 2.86266921442467792e+00,
+    3.24602196820403766e+00, 4.25901348771795885e+00, 1.72554021167942917e+00, 2.02040136652629254e+00,
+    2.32851256986158450e+00, 2.76393196210298653e+00, 3.11916787480540947e+00, 4.04860852478912125e+00,
+    1.69759201782288027e+00, 1.97801047931837592e+00, 2.26920379007729656e+00, 2.67793002215632781e+00,
+    3.00925572991103651e+00, 3.86845690871345838e+00, 1.67261067052391166e+00, 1.94031396858619787e+00,
+    2.21672716749756216e+00, 2.60232330918114796e+00, 2.91308542757292122e+00, 3.71250211074916781e+00,
+    1.65013363980445016e+00, 1.90655442004119013e+00, 2.16994480340871965e+00, 2.53531260780522150e+00,
+    2.82821369839859882e+00, 3.57619090344277346e+00, 1.62979101748620092e+00, 1.87613055048620869e+00,
+    2.12795970117661115e+00, 2.47549207602334675e+00, 2.75274359555795733e+00, 3.45603747708188003e+00,
+    1.61128329693596051e+00, 1.84855879709031012e+00, 2.09005511647378972e+00, 2.42174741477751976e+00,
+    2.68518030274776365e+00, 3.34932999312769653e+00, 1.59436527664049099e+00, 1.82344573125417875e+00,
+    2.05565135177300107e+00, 2.37318405481498518e+00, 2.62433017990982709e+00, 3.25392835036539330e+00,
+    1.57883420187077128e+00, 1.80046789625725667e+00, 2.02427441320268908e+00, 2.32907554174183273e+00,
+    2.56922868452696651e+00, 3.16812187497532305e+00, 1.56452089493934365e+00, 1.77935683643316889e+00,
+    1.99553289805682410e+00, 2.28882580005485670e+00, 2.51908799717329002e+00, 3.09052728902763407e+00,
+    1.55128302896953452e+00, 1.75988782119659892e+00, 1.96910069774308671e+00, 2.25194111574065259e+00,
+    2.47325835637034830e+00, 3.02001431442049473e+00, 1.53899996290268293e+00, 1.74187124097422585e+00,
+    1.94470387784547305e+00, 2.21800904150145950e+00, 2.43119910065720823e+00, 2.95565059299585320e+00,
+    1.52756872971376545e+00, 1.72514596356757499e+00, 1.92211060380974419e+00, 2.18668231030547799e+00,
+    2.39245669465599553e+00, 2.89666033739582884e+00, 1.51690088746203688e+00, 1.70957414816504860e+00,
+    1.90112331787943889e+00, 2.15766642415071930e+00, 2.35664785361100471e+00, 2.84239289342319656e+00,
+    1.50692002358839194e+00, 1.69503715647243158e+00, 1.88157260114972424e+00, 2.13070997513520632e+00,
+    2.32344643995735600e+00, 2.79229855834698704e+00, 1.46526613217257751e+00, 1.63470551159468713e+00,
+    1.80086955769084112e+00, 2.02019496059596593e+00, 2.18800404451901986e+00, 2.59018804350772491e+00,
+    1.43361204335591430e+00, 1.58922420309151113e+00, 1.74050316495382495e+00, 1.93834073017522357e+00,
+    2.08840493657418547e+00, 2.44391542495206604e+00, 1.38846513038386754e+00, 1.52491118420315352e+00,
+    1.65584908516960971e+00, 1.82475323916927223e+00, 1.95124276356655835e+00, 2.24584388241371480e+00,
+    1.35764455387611638e+00, 1.48138592312158091e+00, 1.59903698592172661e+00, 1.74932763897237997e+00,
+    1.86085995789815106e+00, 2.11752030566325278e+00, 1.31800279395786868e+00, 1.42586225476057171e+00,
+    1.52713782071655602e+00, 1.65482182494693641e+00, 1.74842822378589369e+00, 1.96040580531722242e+00,
+    1.29343901254237048e+00, 1.39171955165521988e+00, 1.48325098989272885e+00, 1.59766912302745534e+00,
+    1.68088862783212067e+00, 1.86740138213223328e+00, 1.27665185801475656e+00, 1.36850266933109155e+00,
+    1.45355206804500825e+00, 1.55922670185102663e+00, 1.63565749738208210e+00, 1.80570825170645488e+00,
+    6.30606388522363446e+01, 2.53252854033430395e+02, 1.01402023885508947e+03, 6.33939127467225899e+03,
+    2.53585734515732838e+04, 6.33972402988530113e+05, 9.48289068659726908e+00, 1.94873936002351194e+01,
+    3.94895574579342465e+01, 9.94908293727355044e+01, 1.99491249071054028e+02, 9.99491583314799982e+02,
+    5.14251323044853681e+00, 8.54935136681457308e+00, 1.39472848514674777e+01, 2.62211387934769498e+01,
+    4.19894758854259322e+01, 1.23969223975359341e+02, 3.77527495366799259e+00, 5.65810500786978565e+00,
+    8.30917014799225662e+00, 1.35580963762788116e+01, 1.94683784317158270e+01, 4.43997920367353771e+01,
+    3.12279200746638086e+00, 4.39845376819261080e+00, 6.06929335296924677e+00, 9.11177085150785437e+00,
+    1.22737304782538903e+01, 2.40604639076432605e+01, 2.74229006737738557e+00, 3.70466670862559244e+00,
+    4.90444569950012088e+00, 6.96902309006302012e+00, 9.00146327182027761e+00, 1.59812045536509952e+01,
+    2.49279174117919267e+00, 3.26744534350379823e+00, 4.19890382701737952e+00, 5.73728562844484191e+00,
+    7.19331500529003254e+00, 1.19089616093137955e+01, 2.31618091715168406e+00, 2.96692332069924181e+00,
+    3.72794037704655556e+00, 4.94605150425144124e+00, 6.06489961045938042e+00, 9.53207978276038226e+00,
+    2.18427035222420729e+00, 2.74752478818031332e+00, 3.39179856102450428e+00, 4.39776922852637675e+00,
+    5.30011051668572186e+00, 8.00140608411840049e+00, 2.08176468717007301e+00, 2.58012187347803978e+00,
+    3.13991446242661709e+00, 3.99648069103869874e+00, 4.75012799715669409e+00, 6.94428843819518349e+00,
+    1.99965222256323738e+00, 2.44802379893688871e+00, 2.94407800467595182e+00, 3.69043570246750852e+00,
+    4.33666137402294005e+00, 6.17528211440321684e+00, 1.93227848217295373e+00, 2.34099490585419012e+00,
+    2.78736513786693152e+00, 3.44943967049837497e+00, 4.01494896993782735e+00, 5.59306166663628002e+00,
+    1.87591467707246884e+00, 2.25241419911235274e+00, 2.65902862095577941e+00, 3.25476036485007558e+00,
+    3.75768946673673776e+00, 5.13812211400351515e+00, 1.82800090816511296e+00, 2.17781054979031952e+00,
+    2.55192449043413516e+00, 3.09419149374230074e+00, 3.54734864090493263e+00, 4.77345731625841374e+00,
+    1.78672033697739185e+00, 2.11405574435027832e+00, 2.46112239592041027e+00, 2.95945297540689811e+00,
+    3.37218028250957635e+00, 4.47495617868736684e+00, 1.75074699091357666e+00, 2.05889523661136264e+00,
+    2.38311135226890247e+00, 2.84473683008672396e+00, 3.22403495072437529e+00, 4.22629184936493552e+00,
+    1.71908986348326831e+00, 2.01066268308244211e+00, 2.31532382141394111e+00, 2.74585216725325054e+00,
+    3.09708892715817186e+00, 4.01604433653301829e+00, 1.69099297028974549e+00, 1.96809951544728423e+00,
+    2.25583891085456223e+00, 2.65970079201562548e+00, 2.98707396707432560e+00, 3.83600213086505670e+00,
+    1.66586924073002351e+00, 1.93023709884082884e+00, 2.20319082942824362e+00, 2.58394378398937352e+00,
+    2.89079277240341836e+00, 3.68011858729501418e+00, 1.64325558501154445e+00, 1.89631754459531443e+00,
+    2.15624155101221593e+00, 2.51678279107761327e+00, 2.80580421034288685e+00, 3.54384803588571984e+00,
+    1.62278161645269625e+00, 1.86573915495997222e+00, 2.11409393838973925e+00, 2.45681261339743306e+00,
+    2.73021297721767242e+00, 3.42371052916075458e+00, 1.60414741497388524e+00, 1.83801800127217363e+00,
+    2.07603109976143507e+00, 2.40291942996755070e+00, 2.66252553180486595e+00, 3.31699883363575809e+00,
+    1.58710741844888248e+00, 1.81276032943583054e+00, 2.04147318758492924e+00, 2.35420902664868814e+00,
+    2.60154923095347312e+00, 3.22157650630404424e+00, 1.57145855500913267e+00, 1.78964239109031209e+00,
+    2.00994605840751772e+00, 2.30995521115526348e+00, 2.54632031636245948e+00, 3.13573580848402855e+00,
+    1.55703136601776770e+00, 1.76839546768465672e+00, 1.98105816238599819e+00, 2.26956209920213192e+00,
+    2.49605158849941589e+00, 3.05809583827603859e+00, 1.54368327408938666e+00, 1.74879459042000662e+00,
+    1.95448324756128278e+00, 2.23253611360967685e+00, 2.45009377763987812e+00, 2.98752825638613473e+00,
+    1.53129341349977866e+00, 1.73064993286252733e+00, 1.92994724076429081e+00, 2.19846490197229771e+00,
+    2.40790661331844591e+00, 2.92310229804571309e+00, 1.51975861468218398e+00, 1.71380016457659345e+00,
+    1.90721817380365000e+00, 2.16700125967263491e+00, 2.36903687133278229e+00, 2.86404349384633727e+00,
+    1.50899025223714944e+00, 1.69810726286617131e+00, 1.88609836066399117e+00, 2.13785072590186642e+00,
+    2.33310151444837155e+00, 2.80970228602889893e+00, 1.49891174671999305e+00, 1.68345242199796807e+00,
+    1.86641825965422958e+00, 2.11076191033412375e+00, 2.29977460155762703e+00, 2.75952988876866412e+00,
+    1.45680790714053798e+00, 1.62257505377890676e+00, 1.78511151578517446e+00, 1.99961899745995497e+00,
+    2.16372434840969996e+00, 2.55698774645781723e+00, 1.42475744450792718e+00, 1.57660986159026173e+00,
+    1.72420453225489068e+00, 1.91719078331741910e+00, 2.06355563819286081e+00, 2.41025296889642604e+00,
+    1.37893951262188375e+00, 1.51147229838393637e+00, 1.63862040637218231e+00, 1.80259667427478409e+00,
+    1.92537254573415639e+00, 2.21126568143211566e+00, 1.34756841521930903e+00, 1.46726651633646510e+00,
+    1.58103419134099332e+00, 1.72631951157811692e+00, 1.83411079837119906e+00, 2.08209516008447215e+00,
+    1.30706895369618392e+00, 1.41067705791752074e+00, 1.50791390574055795e+00, 1.63045246654497666e+00,
+    1.72025465757989360e+00, 1.92353625696469255e+00, 1.28186232566630776e+00, 1.37573209116746109e+00,
+    1.46310254592325628e+00, 1.57225842481246758e+00, 1.65161406704700120e+00, 1.82937462418037855e+00,
+    1.26457266800949886e+00, 1.35188645922123518e+00, 1.43267656843049407e+00, 1.53299218308860796e+00,
+    1.60550685006975047e+00, 1.76674283699020296e+00
+};
@@ -0,0 +1,74 @@
+#ifndef STATISTICAL_TABLES_H
+#define STATISTICAL_TABLES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Const lookup tables generated by generate_statistical_tables.c into
+// statistical_tables.c; regenerate that file instead of editing it. The host
+// CMake build compiles its own generated copy, and its
+// statistical_tables_current test fails when the checked-in one differs.
+
+// Normal tables cover z = i / NORMAL_TABLE_STEPS_PER_UNIT for 0 <= z <= NORMAL_TABLE_Z_MAX
+#define NORMAL_TABLE_STEPS_PER_UNIT 64
+#define NORMAL_TABLE_Z_MAX 8
+#define NORMAL_TABLE_SIZE (NORMAL_TABLE_STEPS_PER_UNIT * NORMAL_TABLE_Z_MAX + 1)
+
+// log(n!) for 0 <= n < LOG_FACTORIAL_TABLE_SIZE
+#define LOG_FACTORIAL_TABLE_SIZE 1024
+
+// log(Γ(k/2)) for 1 <= k <= HALF_INTEGER_LOG_GAMMA_TABLE_SIZE, stored at index k - 1
+#define HALF_INTEGER_LOG_GAMMA_TABLE_SIZE 256
+
+// Lower tail Φ(-z) = 1 - Φ(z), so small tail probabilities keep full relative precision
+extern const double normal_cdf_table[NORMAL_TABLE_SIZE];
+
+// Standard normal density φ(z)
+extern const double normal_pdf_table[NORMAL_TABLE_SIZE];
+
+extern const double log_factorial_table[LOG_FACTORIAL_TABLE_SIZE];
+extern const double half_integer_log_gamma_table[HALF_INTEGER_LOG_GAMMA_TABLE_SIZE];
+
+// Critical values at the standard significance levels in critical_alpha_levels
+#define CRITICAL_ALPHA_COUNT 6
+
+// Rows of the t and chi-square tables: df 1..CRITICAL_TABLE_MAX_DF (row df - 1),
+// the large-df anchors in critical_table_df, then the df = ∞ limit
+#define CRITICAL_TABLE_MAX_DF 120
+#define CRITICAL_ANCHOR_COUNT 5
+#define CRITICAL_TABLE_ROWS (CRITICAL_TABLE_MAX_DF + CRITICAL_ANCHOR_COUNT + 1)
+
+// F tables use the classic grid of numerator and denominator df up to
+// CRITICAL_TABLE_MAX_DF, refined between 30 and 120 where 1/df interpolation is weakest
+#define F_TABLE_DF1_COUNT 21
+#define F_TABLE_DF2_COUNT 37
+
+// Flat [row][alpha] and [df1][df2][alpha] indexing
+#define CRITICAL_INDEX(row, alpha) ((row) * CRITICAL_ALPHA_COUNT + (alpha))
+#define F_CRITICAL_INDEX(i, j, alpha) (((i) * F_TABLE_DF2_COUNT + (j)) * CRITICAL_ALPHA_COUNT + (alpha))
+
+extern const double critical_alpha_levels[CRITICAL_ALPHA_COUNT];
+
+// df of each t/chi-square row, 0 for ∞
+extern const double critical_table_df[CRITICAL_TABLE_ROWS];
+
+// Two-sided t critical values t(1 - α/2, df); the ∞ row is z(1 - α/2)
+extern const double t_critical_table[CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT];
+
+// Upper-tail chi-square critical values χ²(1 - α, df); the ∞ row holds z(1 - α),
+// the limit of the Wilson–Hilferty normalized value interpolated past the dense rows
+extern const double chi_square_critical_table[CRITICAL_TABLE_ROWS * CRITICAL_ALPHA_COUNT];
+
+// Grid df for the F table, increasing
+extern const double f_table_df1[F_TABLE_DF1_COUNT];
+extern const double f_table_df2[F_TABLE_DF2_COUNT];
+
+// Upper-tail F critical values F(1 - α; df1, df2)
+extern const double f_critical_table[F_TABLE_DF1_COUNT * F_TABLE_DF2_COUNT * CRITICAL_ALPHA_COUNT];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STATISTICAL_TABLES_H
\ No newline at end of file
@@ -1,21 +1,34 @@
 #include "beta_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
 static const char* beta_param_names[] = {"alpha", "beta"};
 
 double beta_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (beta_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!beta_validate_params(params, param_count)) {
+    return result;
+}
+
+double beta_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (beta_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double alpha = params[0];
-    double beta_param = params[1];
+    return result;
+}
+
+static double beta_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double alpha = prepared->constants[0];
+    double beta_param = prepared->constants[1];
     
     if (!is_finite_number(x) || x < 0 || x > 1) {
         return 0.0;
@@ -33,40 +46,137 @@ double beta_pdf(double x, double* params, int param_count) {
         return beta_param; // or alpha, depends on which end
     }
     
-    double log_beta_func = log_beta(alpha, beta_param);
     double term1 = (alpha - 1) * log(x);
     double term2 = (beta_param - 1) * log(1 - x);
     
-    return safe_exp(term1 + term2 - log_beta_func);
+    return safe_exp(term1 + term2 - prepared->constants[2]);
 }
 
-double beta_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static double beta_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
-    if (!beta_validate_params(params, param_count)) {
-        return NAN;
+    if (x <= 0) {
+        return 0.0;
     }
     
-    double alpha = params[0];
-    double beta_param = params[1];
+    if (x >= 1) {
+        return 1.0;
+    }
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
-        return NAN;
+    return incomplete_beta_evaluate(prepared->constants[0], prepared->constants[1], x, prepared->constants[2], NULL, NULL);
+}
+
+static float beta_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    float alpha = prepared->constants_float[0];
+    float beta_param = prepared->constants_float[1];
+    
+    if (!isfinite(x) || x < 0.0f || x > 1.0f) {
+        return 0.0f;
     }
     
+    if (x == 0.0f || x == 1.0f) {
+        return (float)beta_pdf_prepared(prepared, (double)x);
+    }
+    
+    return expf((alpha - 1.0f) * logf(x) + (beta_param - 1.0f) * log1pf(-x) - prepared->constants_float[2]);
+}
+
+static double beta_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
     if (x <= 0) {
+        *upper = 1.0;
         return 0.0;
     }
     
     if (x >= 1) {
+        *upper = 0.0;
         return 1.0;
     }
     
-    return regularized_incomplete_beta(x, alpha, beta_param);
+    return incomplete_beta_evaluate(prepared->constants[0], prepared->constants[1], x, prepared->constants[2], NULL, upper);
+}
+
+static double beta_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x <= 0 || x >= 1) {
+        return log(beta_pdf_prepared(prepared, x));
+    }
+    
+    return (prepared->constants[0] - 1) * log(x) + (prepared->constants[1] - 1) * log1p(-x) - prepared->constants[2];
+}
+
+static double beta_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x <= 0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    if (x >= 1) {
+        *log_upper = -INFINITY;
+        return 0.0;
+    }
+    
+    return incomplete_beta_evaluate_log(prepared->constants[0], prepared->constants[1], x, prepared->constants[2], NULL,
+                                        log_upper);
+}
+
+static int beta_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!beta_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    prepared->constants[0] = params[0];
+    prepared->constants[1] = params[1];
+    prepared->constants[2] = log_beta_function(params[0], params[1]);
+    prepared->branch = 0;
+    prepared->pdf = beta_pdf_prepared;
+    prepared->cdf = beta_cdf_prepared;
+    prepared->tails = beta_tails_prepared;
+    prepared->logpdf = beta_logpdf_prepared;
+    prepared->log_tails = beta_log_tails_prepared;
+    prepared->pdf_float = beta_pdf_prepared_float;
+    
+    return 0;
+}
+
+int beta_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (beta_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = beta_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+int beta_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (beta_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = beta_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 int beta_validate_params(double* params, int param_count) {
@@ -88,15 +198,18 @@ int beta_validate_params(double* params, int param_count) {
     return 1;
 }
 
+const distribution_t beta_distribution_impl = {
+    .pdf = beta_pdf,
+    .cdf = beta_cdf,
+    .validate_params = beta_validate_params,
+    .distribution_name = "Beta",
+    .param_count = 2,
+    .param_names = beta_param_names,
+    .pdf_batch = beta_pdf_batch,
+    .cdf_batch = beta_cdf_batch,
+    .prepare = beta_prepare
+};
+
 const distribution_t* get_beta_distribution(void) {
-    static const distribution_t beta_dist = {
-        .pdf = beta_pdf,
-        .cdf = beta_cdf,
-        .validate_params = beta_validate_params,
-        .distribution_name = "Beta",
-        .param_count = 2,
-        .param_names = beta_param_names
-    };
-    
-    return &beta_dist;
+    return &beta_distribution_impl;
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "../lib/binomial_distribution.h"
 #include "../../math/math_utils.h"
+#include "../../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
@@ -12,33 +13,65 @@ static const char* binomial_param_names[] = {"n", "p"};
  * where C(n,k) is the binomial coefficient "n choose k"
  */
 double binomial_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (binomial_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!binomial_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Binomial distribution CDF calculation
+ * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i) = I_{1-p}(n-k, k+1)
+ * Evaluated through the regularized incomplete beta function for every n
+ */
+double binomial_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (binomial_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    int n = (int)params[0]; // number of trials
-    double p = params[1];   // probability of success
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    BINOMIAL_N = 0,
+    BINOMIAL_P = 1,
+    BINOMIAL_LOG_P = 2,
+    BINOMIAL_LOG_Q = 3,
+    BINOMIAL_MAX_ITERATIONS = 4
+};
+
+/**
+ * @brief Binomial probability mass for 0 < p < 1 given precomputed log(p) and log(1-p)
+ */
+static double binomial_mass(int n, int k, double log_p, double log_q) {
+    // log(P(X = k)) = log(C(n,k)) + k*log(p) + (n-k)*log(1-p)
+    return safe_exp(log_combination(n, k) + k * log_p + (n - k) * log_q);
+}
+
+/**
+ * @brief Binomial distribution PDF for a prepared handle
+ */
+static double binomial_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    int n = (int)prepared->constants[BINOMIAL_N];
+    double p = prepared->constants[BINOMIAL_P];
     
     if (!is_finite_number(x)) {
         return NAN;
     }
     
-    // Check if x is a non-negative integer
-    if (x < 0.0 || floor(x) != x) {
+    // Check if x is a non-negative integer within [0, n]
+    if (x < 0.0 || floor(x) != x || x > n) {
         return 0.0;
     }
     
     int k = (int)x; // number of successes
     
-    // Check if k is within valid range [0, n]
-    if (k > n) {
-        return 0.0;
-    }
-    
     // Handle edge cases
     if (p == 0.0) {
         return (k == 0) ? 1.0 : 0.0;
@@ -48,31 +81,34 @@ double binomial_pdf(double x, double* params, int param_count) {
         return (k == n) ? 1.0 : 0.0;
     }
     
-    // Calculate PDF using log space for numerical stability
-    // log(P(X = k)) = log(C(n,k)) + k*log(p) + (n-k)*log(1-p)
-    double log_prob = log_combination(n, k) + 
-                      k * safe_log(p) + 
-                      (n - k) * safe_log(1.0 - p);
-    
-    return safe_exp(log_prob);
+    return binomial_mass(n, k, prepared->constants[BINOMIAL_LOG_P], prepared->constants[BINOMIAL_LOG_Q]);
 }
 
 /**
- * @brief Binomial distribution CDF calculation
- * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i)
- * Uses direct summation for small n, and normal approximation for large n
+ * @brief P(X > k) = I_p(k+1, n-k) and P(X <= k) for 0 <= k < n and 0 < p < 1
+ * The incomplete beta kernel evaluates its continued fraction on the
+ * convergent side and returns the other tail by symmetry, so both tails keep
+ * full relative accuracy.
  */
-double binomial_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
-        return NAN;
-    }
+static double binomial_beta_tails(const distribution_prepared_t* prepared, int k, double* lower) {
+    int n = (int)prepared->constants[BINOMIAL_N];
+    special_workspace_t ws;
     
-    if (!binomial_validate_params(params, param_count)) {
-        return NAN;
-    }
+    special_workspace_init(&ws);
+    ws.max_iterations = (int)prepared->constants[BINOMIAL_MAX_ITERATIONS];
     
-    int n = (int)params[0]; // number of trials
-    double p = params[1];   // probability of success
+    // log(B(k+1, n-k)) = log(k!) + log((n-k-1)!) - log(n!)
+    double log_beta = log_factorial(k) + log_factorial(n - k - 1) - log_factorial(n);
+    
+    return incomplete_beta_evaluate(k + 1.0, (double)(n - k), prepared->constants[BINOMIAL_P], log_beta, &ws, lower);
+}
+
+/**
+ * @brief Binomial distribution CDF for a prepared handle
+ */
+static double binomial_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    int n = (int)prepared->constants[BINOMIAL_N];
+    double p = prepared->constants[BINOMIAL_P];
     
     if (!is_finite_number(x)) {
         if (x == -INFINITY) return 0.0;
@@ -80,49 +116,170 @@ double binomial_cdf(double x, double* params, int param_count) {
         return NAN;
     }
     
-    // For discrete distribution, use floor of x
-    int k = (int)floor(x);
-    
-    // CDF is 0 for k < 0
-    if (k < 0) {
+    // CDF is 0 for k < 0 and 1 for k >= n
+    if (x < 0.0) {
         return 0.0;
     }
     
-    // CDF is 1 for k >= n
-    if (k >= n) {
+    if (x >= n) {
         return 1.0;
     }
     
-    // Handle edge cases
+    // Handle edge cases: all probability is at k=0 or k=n
     if (p == 0.0) {
-        return 1.0; // All probability is at k=0
+        return 1.0;
     }
     
     if (p == 1.0) {
-        return (k >= n) ? 1.0 : 0.0; // All probability is at k=n
+        return 0.0;
+    }
+    
+    double lower;
+    binomial_beta_tails(prepared, (int)floor(x), &lower);
+    
+    return lower;
+}
+
+/**
+ * @brief Binomial CDF and survival function for a prepared handle
+ */
+static double binomial_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    int n = (int)prepared->constants[BINOMIAL_N];
+    double p = prepared->constants[BINOMIAL_P];
+    
+    if (x < 0.0 || (x < n && p == 1.0)) {
+        *upper = 1.0;
+        return 0.0;
+    }
+    
+    if (x >= n || p == 0.0) {
+        *upper = 0.0;
+        return 1.0;
+    }
+    
+    double lower;
+    *upper = binomial_beta_tails(prepared, (int)floor(x), &lower);
+    
+    return lower;
+}
+
+/**
+ * @brief Binomial log PMF for a prepared handle
+ */
+static double binomial_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    int n = (int)prepared->constants[BINOMIAL_N];
+    double p = prepared->constants[BINOMIAL_P];
+    
+    if (x < 0.0 || floor(x) != x || x > n || p == 0.0 || p == 1.0) {
+        return log(binomial_pdf_prepared(prepared, x));
+    }
+    
+    int k = (int)x;
+    
+    return log_combination(n, k) + k * prepared->constants[BINOMIAL_LOG_P] + (n - k) * prepared->constants[BINOMIAL_LOG_Q];
+}
+
+/**
+ * @brief Binomial log CDF and log survival function from one log-space incomplete beta evaluation
+ */
+static double binomial_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    int n = (int)prepared->constants[BINOMIAL_N];
+    double p = prepared->constants[BINOMIAL_P];
+    
+    if (x < 0.0 || (x < n && p == 1.0)) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    if (x >= n || p == 0.0) {
+        *log_upper = -INFINITY;
+        return 0.0;
+    }
+    
+    int k = (int)floor(x);
+    special_workspace_t ws;
+    double log_lower;
+    
+    special_workspace_init(&ws);
+    ws.max_iterations = (int)prepared->constants[BINOMIAL_MAX_ITERATIONS];
+    
+    double log_beta = log_factorial(k) + log_factorial(n - k - 1) - log_factorial(n);
+    *log_upper = incomplete_beta_evaluate_log(k + 1.0, (double)(n - k), p, log_beta, &ws, &log_lower);
+    
+    return log_lower;
+}
+
+/**
+ * @brief Validate parameters, cache log(p), log(1-p) and the continued-fraction iteration cap
+ */
+static int binomial_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!binomial_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    int n = (int)params[0]; // number of trials
+    double p = params[1];   // probability of success
+    
+    prepared->constants[BINOMIAL_N] = n;
+    prepared->constants[BINOMIAL_P] = p;
+    prepared->constants[BINOMIAL_LOG_P] = (p > 0.0) ? safe_log(p) : 0.0;
+    prepared->constants[BINOMIAL_LOG_Q] = (p < 1.0) ? safe_log(1.0 - p) : 0.0;
+    
+    // The continued fraction needs on the order of one iteration per standard deviation
+    prepared->constants[BINOMIAL_MAX_ITERATIONS] = SPECIAL_DEFAULT_MAX_ITERATIONS + ceil(2.0 * sqrt(n * p * (1.0 - p)));
+    prepared->branch = 0;
+    
+    prepared->pdf = binomial_pdf_prepared;
+    prepared->cdf = binomial_cdf_prepared;
+    prepared->tails = binomial_tails_prepared;
+    prepared->logpdf = binomial_logpdf_prepared;
+    prepared->log_tails = binomial_log_tails_prepared;
+    
+    return 0;
+}
+
+/**
+ * @brief Binomial distribution batched PDF calculation
+ */
+int binomial_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
     }
     
-    // For large n, use normal approximation with continuity correction
-    // if n*p*(1-p) >= 9 and both n*p >= 5 and n*(1-p) >= 5
-    if (n >= 30 && n * p * (1.0 - p) >= 9.0 && n * p >= 5.0 && n * (1.0 - p) >= 5.0) {
-        double mean = n * p;
-        double variance = n * p * (1.0 - p);
-        double std_dev = sqrt(variance);
-        
-        // Apply continuity correction: P(X <= k) ≈ P(Z <= (k + 0.5 - mean) / std_dev)
-        double z = (k + 0.5 - mean) / std_dev;
-        
-        // Use error function to compute normal CDF
-        return 0.5 * (1.0 + error_function(z / M_SQRT2));
+    if (binomial_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
     }
     
-    // For smaller n, use direct summation
-    double cdf = 0.0;
-    for (int i = 0; i <= k; i++) {
-        cdf += binomial_pdf((double)i, params, param_count);
+    for (size_t i = 0; i < count; i++) {
+        out[i] = binomial_pdf_prepared(&prepared, x[i]);
     }
     
-    return cdf;
+    return 0;
+}
+
+/**
+ * @brief Binomial distribution batched CDF calculation
+ */
+int binomial_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (binomial_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = binomial_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -156,18 +313,24 @@ int binomial_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Binomial distribution interface object, referenced directly by the registry table
+ */
+const distribution_t binomial_distribution_impl = {
+    .pdf = binomial_pdf,
+    .cdf = binomial_cdf,
+    .validate_params = binomial_validate_params,
+    .distribution_name = "Binomial",
+    .param_count = 2,
+    .param_names = binomial_param_names,
+    .pdf_batch = binomial_pdf_batch,
+    .cdf_batch = binomial_cdf_batch,
+    .prepare = binomial_prepare
+};
+
 /**
  * @brief Get the Binomial distribution interface
  */
 const distribution_t* get_binomial_distribution(void) {
-    static const distribution_t binomial_dist = {
-        .pdf = binomial_pdf,
-        .cdf = binomial_cdf,
-        .validate_params = binomial_validate_params,
-        .distribution_name = "Binomial",
-        .param_count = 2,
-        .param_names = binomial_param_names
-    };
-    
-    return &binomial_dist;
+    return &binomial_distribution_impl;
 }
\ No newline at end of file
@@ -1,88 +1,57 @@
 #include "chi_square_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
 // Parameter names for Chi-Square distribution
 static const char* chi_square_param_names[] = {"degrees_of_freedom"};
 
-/**
- * @brief Regularized incomplete gamma function P(a,x) = γ(a,x)/Γ(a)
- * Used for Chi-Square CDF calculation
- */
-static double regularized_incomplete_gamma_p(double a, double x) {
-    if (x <= 0.0) return 0.0;
-    if (a <= 0.0) return NAN;
-    
-    // For very large x relative to a, use asymptotic approximation
-    if (x > a + 50.0) return 1.0;
-    
-    // Use series expansion for P(a,x) when x < a + 1
-    if (x < a + 1.0) {
-        double sum = 1.0;
-        double term = 1.0;
-        double ap = a;
-        
-        // Series: sum(x^n / Γ(a+n+1)) * Γ(a)
-        for (int n = 1; n < 200; n++) {
-            ap += 1.0;
-            term *= x / ap;
-            sum += term;
-            if (fabs(term) < 1e-12) break;
-        }
-        
-        // P(a,x) = (x^a * e^(-x) / Γ(a)) * sum
-        double log_result = a * safe_log(x) - x - log_gamma_function(a) + safe_log(sum);
-        
-        if (log_result < -700.0) return 0.0;
-        return safe_exp(log_result);
-    } else {
-        // Use continued fraction for x >= a + 1
-        // Q(a,x) = 1 - P(a,x), so P(a,x) = 1 - Q(a,x)
-        double b = x + 1.0 - a;
-        double c = 1e30;
-        double d = 1.0 / b;
-        double h = d;
-        
-        for (int i = 1; i <= 200; i++) {
-            double an = -i * (i - a);
-            b += 2.0;
-            d = an * d + b;
-            if (fabs(d) < 1e-30) d = 1e-30;
-            c = b + an / c;
-            if (fabs(c) < 1e-30) c = 1e-30;
-            d = 1.0 / d;
-            double del = d * c;
-            h *= del;
-            if (fabs(del - 1.0) < 1e-12) break;
-        }
-        
-        double log_q = a * safe_log(x) - x - log_gamma_function(a) + safe_log(h);
-        if (log_q < -700.0) return 1.0;
-        
-        double q = safe_exp(log_q);
-        return 1.0 - q;
-    }
-}
-
 /**
  * @brief Chi-Square distribution PDF calculation
  * Formula: f(x) = (1/(2^(k/2) * Γ(k/2))) * x^(k/2-1) * exp(-x/2) for x ≥ 0
  */
 double chi_square_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+    double result;
+    
+    if (chi_square_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!chi_square_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Chi-Square distribution CDF calculation
+ * Formula: F(x) = γ(k/2, x/2) / Γ(k/2) where γ is the lower incomplete gamma function
+ */
+double chi_square_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (chi_square_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double k = params[0]; // degrees of freedom
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    CHI_SQUARE_DF = 0,
+    CHI_SQUARE_HALF_DF = 1,
+    CHI_SQUARE_LOG_COEFFICIENT = 2,
+    CHI_SQUARE_LOG_GAMMA = 3
+};
+
+/**
+ * @brief Chi-Square distribution PDF for a prepared handle
+ */
+static double chi_square_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double k = prepared->constants[CHI_SQUARE_DF];
+    double half_k = prepared->constants[CHI_SQUARE_HALF_DF];
     
     if (!is_finite_number(x)) {
-        if (x == INFINITY) return 0.0;
-        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY || x == -INFINITY) return 0.0;
         return NAN;
     }
     
@@ -99,29 +68,16 @@ double chi_square_pdf(double x, double* params, int param_count) {
     }
     
     // Calculate PDF: (1/(2^(k/2) * Γ(k/2))) * x^(k/2-1) * exp(-x/2)
-    double half_k = k / 2.0;
-    double log_coefficient = -half_k * M_LN_2 - log_gamma_function(half_k);
     double log_power = (half_k - 1.0) * safe_log(x);
     double log_exp = -x / 2.0;
     
-    return safe_exp(log_coefficient + log_power + log_exp);
+    return safe_exp(prepared->constants[CHI_SQUARE_LOG_COEFFICIENT] + log_power + log_exp);
 }
 
 /**
- * @brief Chi-Square distribution CDF calculation
- * Formula: F(x) = γ(k/2, x/2) / Γ(k/2) where γ is the lower incomplete gamma function
+ * @brief Chi-Square distribution CDF for a prepared handle
  */
-double chi_square_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
-        return NAN;
-    }
-    
-    if (!chi_square_validate_params(params, param_count)) {
-        return NAN;
-    }
-    
-    double k = params[0]; // degrees of freedom
-    
+static double chi_square_cdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         if (x == -INFINITY) return 0.0;
         if (x == INFINITY) return 1.0;
@@ -134,10 +90,135 @@ double chi_square_cdf(double x, double* params, int param_count) {
     }
     
     // Calculate CDF using regularized incomplete gamma function
-    double half_k = k / 2.0;
-    double half_x = x / 2.0;
+    return incomplete_gamma_evaluate(prepared->constants[CHI_SQUARE_HALF_DF], x / 2.0,
+                                     prepared->constants[CHI_SQUARE_LOG_GAMMA], NULL, NULL);
+}
+
+/**
+ * @brief Single-precision Chi-square PDF for a prepared handle (the CDF stays in double)
+ */
+static float chi_square_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
+        if (x == INFINITY || x == -INFINITY) return 0.0f;
+        return NAN;
+    }
+    
+    if (x <= 0.0f) {
+        return (x < 0.0f) ? 0.0f : (float)chi_square_pdf_prepared(prepared, 0.0);
+    }
+    
+    float log_power = (prepared->constants_float[CHI_SQUARE_HALF_DF] - 1.0f) * logf(x);
     
-    return regularized_incomplete_gamma_p(half_k, half_x);
+    return expf(prepared->constants_float[CHI_SQUARE_LOG_COEFFICIENT] + log_power - 0.5f * x);
+}
+
+/**
+ * @brief Chi-square CDF and survival function from one incomplete gamma evaluation
+ */
+static double chi_square_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    if (x <= 0.0) {
+        *upper = 1.0;
+        return 0.0;
+    }
+    
+    return incomplete_gamma_evaluate(prepared->constants[CHI_SQUARE_HALF_DF], x / 2.0,
+                                     prepared->constants[CHI_SQUARE_LOG_GAMMA], NULL, upper);
+}
+
+/**
+ * @brief Chi-square log PDF for a prepared handle
+ */
+static double chi_square_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x <= 0.0) {
+        return log(chi_square_pdf_prepared(prepared, x));
+    }
+    
+    return prepared->constants[CHI_SQUARE_LOG_COEFFICIENT] + (prepared->constants[CHI_SQUARE_HALF_DF] - 1.0) * log(x) -
+           x / 2.0;
+}
+
+/**
+ * @brief Chi-square log CDF and log survival function from one incomplete gamma evaluation
+ */
+static double chi_square_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x <= 0.0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    return incomplete_gamma_evaluate_log(prepared->constants[CHI_SQUARE_HALF_DF], x / 2.0,
+                                         prepared->constants[CHI_SQUARE_LOG_GAMMA], NULL, log_upper);
+}
+
+/**
+ * @brief Validate parameters and cache the log normalization constant -(k/2)ln2 - lnΓ(k/2)
+ * together with lnΓ(k/2) for the incomplete gamma CDF
+ */
+static int chi_square_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!chi_square_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    double half_k = params[0] / 2.0;
+    double log_gamma_half_k = log_gamma_function(half_k);
+    
+    prepared->constants[CHI_SQUARE_DF] = params[0];
+    prepared->constants[CHI_SQUARE_HALF_DF] = half_k;
+    prepared->constants[CHI_SQUARE_LOG_COEFFICIENT] = -half_k * M_LN_2 - log_gamma_half_k;
+    prepared->constants[CHI_SQUARE_LOG_GAMMA] = log_gamma_half_k;
+    prepared->branch = 0;
+    prepared->pdf = chi_square_pdf_prepared;
+    prepared->cdf = chi_square_cdf_prepared;
+    prepared->tails = chi_square_tails_prepared;
+    prepared->logpdf = chi_square_logpdf_prepared;
+    prepared->log_tails = chi_square_log_tails_prepared;
+    prepared->pdf_float = chi_square_pdf_prepared_float;
+    
+    return 0;
+}
+
+/**
+ * @brief Chi-Square distribution batched PDF calculation
+ */
+int chi_square_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (chi_square_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = chi_square_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Chi-Square distribution batched CDF calculation
+ */
+int chi_square_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (chi_square_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = chi_square_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -159,18 +240,24 @@ int chi_square_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Chi-Square distribution interface object, referenced directly by the registry table
+ */
+const distribution_t chi_square_distribution_impl = {
+    .pdf = chi_square_pdf,
+    .cdf = chi_square_cdf,
+    .validate_params = chi_square_validate_params,
+    .distribution_name = "Chi-Square",
+    .param_count = 1,
+    .param_names = chi_square_param_names,
+    .pdf_batch = chi_square_pdf_batch,
+    .cdf_batch = chi_square_cdf_batch,
+    .prepare = chi_square_prepare
+};
+
 /**
  * @brief Get the Chi-Square distribution interface
  */
 const distribution_t* get_chi_square_distribution(void) {
-    static const distribution_t chi_square_dist = {
-        .pdf = chi_square_pdf,
-        .cdf = chi_square_cdf,
-        .validate_params = chi_square_validate_params,
-        .distribution_name = "Chi-Square",
-        .param_count = 1,
-        .param_names = chi_square_param_names
-    };
-    
-    return &chi_square_dist;
+    return &chi_square_distribution_impl;
 }
\ No newline at end of file
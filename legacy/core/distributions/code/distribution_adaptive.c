@@ -0,0 +1,221 @@
+#include "../lib/distribution_interface.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Coarse grid spacing in pixels, and its floor in intervals
+#define ADAPTIVE_COARSE_PIXELS 16
+#define ADAPTIVE_COARSE_MIN_INTERVALS 8
+
+// Intervals narrower than this are never split
+#define ADAPTIVE_MIN_WIDTH_PIXELS 1.0
+
+// A point further than this from the chord through its neighbours marks curvature
+#define ADAPTIVE_CURVATURE_PIXELS 0.5
+
+// A rise or fall of more than this across one interval is split to catch spikes between samples
+#define ADAPTIVE_STEP_PIXELS 4.0
+
+/**
+ * @brief Vertical distance in pixels of point j from the chord through j-1 and j+1
+ * 0 at the ends of the series and where a neighbour is not finite.
+ */
+static double adaptive_chord_deviation(const double* x, const double* y, size_t n, size_t j, double y_scale) {
+    if (j == 0 || j + 1 >= n || !isfinite(y[j - 1]) || !isfinite(y[j + 1])) {
+        return 0.0;
+    }
+    
+    double t = (x[j] - x[j - 1]) / (x[j + 1] - x[j - 1]);
+    double chord = y[j - 1] + t * (y[j + 1] - y[j - 1]);
+    
+    return fabs(y[j] - chord) * y_scale;
+}
+
+/**
+ * @brief How far interval [x[i], x[i+1]] is over the pixel thresholds
+ * Above 1 when either end bends away from its chord by more than
+ * ADAPTIVE_CURVATURE_PIXELS or the interval rises or falls by more than
+ * ADAPTIVE_STEP_PIXELS; infinite when an end is not finite. 0 for intervals
+ * already at the minimum width.
+ */
+static double adaptive_interval_score(const double* x, const double* y, size_t n, size_t i,
+                                      double x_scale, double y_scale) {
+    if ((x[i + 1] - x[i]) * x_scale <= ADAPTIVE_MIN_WIDTH_PIXELS) {
+        return 0.0;
+    }
+    
+    if (!isfinite(y[i]) || !isfinite(y[i + 1])) {
+        return INFINITY;
+    }
+    
+    double step = fabs(y[i + 1] - y[i]) * y_scale / ADAPTIVE_STEP_PIXELS;
+    double bend = fmax(adaptive_chord_deviation(x, y, n, i, y_scale),
+                       adaptive_chord_deviation(x, y, n, i + 1, y_scale)) / ADAPTIVE_CURVATURE_PIXELS;
+    
+    return fmax(step, bend);
+}
+
+/**
+ * @brief Pixels per unit of y for the finite values sampled so far
+ * The chart is scaled to the range of what has been seen, from 0 up, so a
+ * spike found by refinement rescales the following passes too.
+ */
+static double adaptive_y_scale(const double* y, size_t n, int height_px) {
+    double y_low = 0.0;
+    double y_high = 0.0;
+    
+    for (size_t i = 0; i < n; i++) {
+        if (isfinite(y[i])) {
+            y_low = fmin(y_low, y[i]);
+            y_high = fmax(y_high, y[i]);
+        }
+    }
+    
+    return (y_high > y_low) ? (double)height_px / (y_high - y_low) : 0.0;
+}
+
+/**
+ * @brief Number of intervals scoring above threshold
+ */
+static size_t adaptive_count_over(const double* x, const double* y, size_t n,
+                                  double x_scale, double y_scale, double threshold) {
+    size_t over = 0;
+    
+    for (size_t i = 0; i + 1 < n; i++) {
+        if (adaptive_interval_score(x, y, n, i, x_scale, y_scale) > threshold) {
+            over++;
+        }
+    }
+    
+    return over;
+}
+
+/**
+ * @brief Sample the PDF/PMF of a prepared handle for a chart width_px by height_px pixels
+ * Starts from a grid every ADAPTIVE_COARSE_PIXELS and halves, pass by pass,
+ * only the intervals that bend or step by more than a pixel threshold, so
+ * flat stretches keep the coarse spacing and peaks, cusps and poles get
+ * pixel spacing. When a pass wants more midpoints than the budget has left
+ * the threshold is doubled until it fits, keeping the worst intervals.
+ * @param prepared Prepared handle
+ * @param x_min First sample point
+ * @param x_max Last sample point
+ * @param width_px Chart width in pixels (the level of detail)
+ * @param height_px Chart height in pixels
+ * @param max_evaluations Cap on PDF evaluations and the capacity of out_x and out_y (at least 2)
+ * @param out_x Output sample points in increasing order
+ * @param out_y Output PDF values at out_x, not necessarily finite
+ * @param out_count Number of points written
+ * @return 0 on success, -1 if the handle, range or sizes are invalid or scratch cannot be allocated
+ */
+int distribution_prepared_adaptive_series(const distribution_prepared_t* prepared, double x_min, double x_max,
+                                          int width_px, int height_px, size_t max_evaluations,
+                                          double* out_x, double* out_y, size_t* out_count) {
+    if (!prepared || !prepared->pdf || !out_x || !out_y || !out_count ||
+        !isfinite(x_min) || !isfinite(x_max) || x_max <= x_min ||
+        width_px < 1 || height_px < 1 || max_evaluations < 2) {
+        return -1;
+    }
+    
+    size_t n = (size_t)(width_px / ADAPTIVE_COARSE_PIXELS);
+    if (n < ADAPTIVE_COARSE_MIN_INTERVALS) {
+        n = ADAPTIVE_COARSE_MIN_INTERVALS;
+    }
+    n += 1;
+    if (n > max_evaluations) {
+        n = max_evaluations;
+    }
+    
+    double step = (x_max - x_min) / (double)(n - 1);
+    for (size_t i = 0; i + 1 < n; i++) {
+        out_x[i] = x_min + (double)i * step;
+    }
+    out_x[n - 1] = x_max;
+    
+    if (distribution_prepared_pdf_batch(prepared, out_x, out_y, n) != 0) {
+        return -1;
+    }
+    
+    // Each pass is rebuilt here with its midpoints, then copied back
+    double* scratch = NULL;
+    if (n < max_evaluations) {
+        scratch = malloc(2 * max_evaluations * sizeof(double));
+        if (!scratch) {
+            return -1;
+        }
+    }
+    
+    double x_scale = (double)width_px / (x_max - x_min);
+    
+    while (n < max_evaluations) {
+        size_t remaining = max_evaluations - n;
+        double y_scale = adaptive_y_scale(out_y, n, height_px);
+        double threshold = 1.0;
+        size_t over = adaptive_count_over(out_x, out_y, n, x_scale, y_scale, threshold);
+    
+        if (over == 0) {
+            break;
+        }
+    
+        // Finite scores stay within a few chart heights; past that only the
+        // infinite ones are left, and they are split left to right
+        while (over > remaining && threshold < 4.0 * (double)height_px / ADAPTIVE_CURVATURE_PIXELS) {
+            threshold *= 2.0;
+            size_t fewer = adaptive_count_over(out_x, out_y, n, x_scale, y_scale, threshold);
+            if (fewer == 0) {
+                threshold /= 2.0;
+                break;
+            }
+            over = fewer;
+        }
+    
+        double* next_x = scratch;
+        double* next_y = scratch + max_evaluations;
+        size_t m = 0;
+        size_t splits = 0;
+    
+        for (size_t i = 0; i + 1 < n; i++) {
+            next_x[m] = out_x[i];
+            next_y[m] = out_y[i];
+            m++;
+    
+            if (splits < remaining &&
+                adaptive_interval_score(out_x, out_y, n, i, x_scale, y_scale) > threshold) {
+                double mid = out_x[i] + 0.5 * (out_x[i + 1] - out_x[i]);
+                next_x[m] = mid;
+                next_y[m] = distribution_prepared_pdf(prepared, mid);
+                m++;
+                splits++;
+            }
+        }
+        next_x[m] = out_x[n - 1];
+        next_y[m] = out_y[n - 1];
+        m++;
+    
+        memcpy(out_x, next_x, m * sizeof(double));
+        memcpy(out_y, next_y, m * sizeof(double));
+        n = m;
+    }
+    
+    free(scratch);
+    *out_count = n;
+    return 0;
+}
+
+/**
+ * @brief Adaptive chart samples of a distribution's PDF/PMF over [x_min, x_max]
+ * Prepares a handle and samples it with distribution_prepared_adaptive_series.
+ * @return 0 on success, -1 if the type, parameters, range or sizes are invalid
+ */
+int distribution_adaptive_series(distribution_type_t type, double* params, int param_count,
+                                 double x_min, double x_max, int width_px, int height_px,
+                                 size_t max_evaluations, double* out_x, double* out_y, size_t* out_count) {
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return -1;
+    }
+    
+    return distribution_prepared_adaptive_series(&prepared, x_min, x_max, width_px, height_px,
+                                                 max_evaluations, out_x, out_y, out_count);
+}
@@ -1,5 +1,6 @@
 #include "../lib/distribution_interface.h"
 #include "../../../models/distributions/distribution_registry.h"
+#include <math.h>
 #include <stddef.h>
 
 /**
@@ -14,30 +15,13 @@ const distribution_t* get_distribution(distribution_type_t type) {
 
 /**
  * @brief Get distribution model information by type
+ * The model lives in the const registry table, so the pointer stays valid and
+ * unchanged for the lifetime of the program.
  * @param type Distribution type
  * @return Pointer to distribution model, or NULL if not found
  */
 const distribution_model_t* get_distribution_model(distribution_type_t type) {
-    const distribution_registry_entry_t* entry = registry_get_distribution(type);
-    if (!entry) {
-        return NULL;
-    }
-    
-    // Create a static model structure from registry entry
-    static distribution_model_t model;
-    model.distribution_id = (uint8_t)type;
-    model.name = entry->name;
-    model.param_count = entry->param_count;
-    model.param_names = entry->param_names;
-    model.category = entry->category;
-    
-    // Copy parameter ranges
-    for (int i = 0; i < 4; i++) {
-        model.param_ranges[i][0] = entry->param_ranges[i][0];
-        model.param_ranges[i][1] = entry->param_ranges[i][1];
-    }
-    
-    return &model;
+    return registry_get_distribution_model(type);
 }
 
 /**
@@ -47,4 +31,752 @@ const distribution_model_t* get_distribution_model(distribution_type_t type) {
  */
 int is_valid_distribution_type(distribution_type_t type) {
     return registry_is_valid_distribution_type(type);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Fill a batch output array with a single value
+ * Used by the batched PDF/CDF entries to report invalid parameters
+ * @param out Output array
+ * @param count Number of values to write
+ * @param value Value to write into every element
+ */
+void distribution_fill_batch(double* out, size_t count, double value) {
+    if (!out) {
+        return;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = value;
+    }
+}
+
+/**
+ * @brief Prepare a distribution handle for repeated evaluation
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param prepared Handle to fill
+ * @return 0 on success, -1 if the type or parameters are invalid
+ */
+int distribution_prepare(distribution_type_t type, double* params, int param_count, distribution_prepared_t* prepared) {
+    return distribution_prepare_with(get_distribution(type), params, param_count, prepared);
+}
+
+/**
+ * @brief Prepare a handle from a distribution implementation
+ * @param distribution Distribution implementation
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param prepared Handle to fill
+ * @return 0 on success, -1 if the distribution or parameters are invalid
+ */
+int distribution_prepare_with(const distribution_t* distribution, double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!distribution || !distribution->prepare || !prepared || !params) {
+        return -1;
+    }
+    
+    if (param_count < 0 || param_count > MAX_PARAMETERS) {
+        return -1;
+    }
+    
+    // Slots a distribution leaves unused stay zero so constants_float is well defined
+    for (int i = 0; i < DISTRIBUTION_PREPARED_CONSTANTS; i++) {
+        prepared->constants[i] = 0.0;
+    }
+    prepared->pdf_float = NULL;
+    prepared->cdf_float = NULL;
+    prepared->tails = NULL;
+    prepared->logpdf = NULL;
+    prepared->log_tails = NULL;
+    
+    if (distribution->prepare(params, param_count, prepared) != 0) {
+        return -1;
+    }
+    
+    prepared->distribution = distribution;
+    prepared->param_count = param_count;
+    for (int i = 0; i < param_count; i++) {
+        prepared->params[i] = params[i];
+    }
+    
+    // Float kernels read these so they never touch double arithmetic per call
+    prepared->precision = DISTRIBUTION_PRECISION_DOUBLE;
+    for (int i = 0; i < DISTRIBUTION_PREPARED_CONSTANTS; i++) {
+        prepared->constants_float[i] = (float)prepared->constants[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Evaluate the PDF of a prepared handle
+ * @param prepared Prepared handle
+ * @param x Value at which to evaluate
+ * @return PDF value at x, or NAN if the handle is invalid
+ */
+double distribution_prepared_pdf(const distribution_prepared_t* prepared, double x) {
+    if (!prepared) {
+        return NAN;
+    }
+    
+    return distribution_prepared_pdf_precision(prepared, x, prepared->precision);
+}
+
+/**
+ * @brief Evaluate the CDF of a prepared handle
+ * @param prepared Prepared handle
+ * @param x Value at which to evaluate
+ * @return CDF value at x, or NAN if the handle is invalid
+ */
+double distribution_prepared_cdf(const distribution_prepared_t* prepared, double x) {
+    if (!prepared) {
+        return NAN;
+    }
+    
+    return distribution_prepared_cdf_precision(prepared, x, prepared->precision);
+}
+
+/**
+ * @brief Evaluate the PDF of a prepared handle over an array of x
+ * @return 0 on success, -1 if the handle or arrays are invalid
+ */
+int distribution_prepared_pdf_batch(const distribution_prepared_t* prepared, const double* x, double* out, size_t count) {
+    if (!prepared || !prepared->pdf || !x || !out) {
+        return -1;
+    }
+    
+    if (prepared->precision == DISTRIBUTION_PRECISION_FLOAT && prepared->pdf_float) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = (double)prepared->pdf_float(prepared, (float)x[i]);
+        }
+        return 0;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = prepared->pdf(prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Evaluate the CDF of a prepared handle over an array of x
+ * @return 0 on success, -1 if the handle or arrays are invalid
+ */
+int distribution_prepared_cdf_batch(const distribution_prepared_t* prepared, const double* x, double* out, size_t count) {
+    if (!prepared || !prepared->cdf || !x || !out) {
+        return -1;
+    }
+    
+    if (prepared->precision == DISTRIBUTION_PRECISION_FLOAT && prepared->cdf_float) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = (double)prepared->cdf_float(prepared, (float)x[i]);
+        }
+        return 0;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = prepared->cdf(prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Select the evaluation precision of a prepared handle
+ * @param prepared Prepared handle
+ * @param precision DISTRIBUTION_PRECISION_DOUBLE or DISTRIBUTION_PRECISION_FLOAT
+ * @return 0 on success, -1 if the handle or precision is invalid
+ */
+int distribution_prepared_set_precision(distribution_prepared_t* prepared, distribution_precision_t precision) {
+    if (!prepared || (precision != DISTRIBUTION_PRECISION_DOUBLE && precision != DISTRIBUTION_PRECISION_FLOAT)) {
+        return -1;
+    }
+    
+    prepared->precision = precision;
+    return 0;
+}
+
+/**
+ * @brief Evaluate the PDF of a prepared handle at an explicit precision
+ * @return PDF value at x, or NAN if the handle is invalid
+ */
+double distribution_prepared_pdf_precision(const distribution_prepared_t* prepared, double x, distribution_precision_t precision) {
+    if (!prepared || !prepared->pdf) {
+        return NAN;
+    }
+    
+    if (precision == DISTRIBUTION_PRECISION_FLOAT && prepared->pdf_float) {
+        return (double)prepared->pdf_float(prepared, (float)x);
+    }
+    
+    return prepared->pdf(prepared, x);
+}
+
+/**
+ * @brief Evaluate the CDF of a prepared handle at an explicit precision
+ * @return CDF value at x, or NAN if the handle is invalid
+ */
+double distribution_prepared_cdf_precision(const distribution_prepared_t* prepared, double x, distribution_precision_t precision) {
+    if (!prepared || !prepared->cdf) {
+        return NAN;
+    }
+    
+    if (precision == DISTRIBUTION_PRECISION_FLOAT && prepared->cdf_float) {
+        return (double)prepared->cdf_float(prepared, (float)x);
+    }
+    
+    return prepared->cdf(prepared, x);
+}
+
+/**
+ * @brief Evaluate the PDF of a prepared handle over a float array
+ * Uses the float kernel when the distribution has one, whatever the handle's precision.
+ * @return 0 on success, -1 if the handle or arrays are invalid
+ */
+int distribution_prepared_pdf_batch_float(const distribution_prepared_t* prepared, const float* x, float* out, size_t count) {
+    if (!prepared || !prepared->pdf || !x || !out) {
+        return -1;
+    }
+    
+    if (prepared->pdf_float) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = prepared->pdf_float(prepared, x[i]);
+        }
+        return 0;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (float)prepared->pdf(prepared, (double)x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Evaluate the CDF of a prepared handle over a float array
+ * Uses the float kernel when the distribution has one, whatever the handle's precision.
+ * @return 0 on success, -1 if the handle or arrays are invalid
+ */
+int distribution_prepared_cdf_batch_float(const distribution_prepared_t* prepared, const float* x, float* out, size_t count) {
+    if (!prepared || !prepared->cdf || !x || !out) {
+        return -1;
+    }
+    
+    if (prepared->cdf_float) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = prepared->cdf_float(prepared, x[i]);
+        }
+        return 0;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (float)prepared->cdf(prepared, (double)x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Ratio P(k+1)/P(k) for the discrete distributions with a closed form
+ * @param type Distribution type
+ * @param params Distribution parameters in registry order
+ * @param k Current support point
+ * @return The ratio, or NAN when there is none (continuous types, or k outside the support)
+ */
+static double distribution_pmf_ratio(distribution_type_t type, const double* params, double k) {
+    double denominator;
+    
+    switch (type) {
+        case DIST_BINOMIAL:
+            if (k < 0.0 || k >= params[0]) return NAN;
+            return (params[0] - k) / (k + 1.0) * params[1] / (1.0 - params[1]);
+        case DIST_POISSON:
+            if (k < 0.0) return NAN;
+            return params[0] / (k + 1.0);
+        case DIST_GEOMETRIC:
+            if (k < 1.0) return NAN;
+            return 1.0 - params[0];
+        case DIST_NEGATIVE_BINOMIAL:
+            if (k < 0.0) return NAN;
+            return (k + params[0]) / (k + 1.0) * (1.0 - params[1]);
+        case DIST_HYPERGEOMETRIC:
+            // (K - k)(n - k) / ((k + 1)(N - K - n + k + 1)) with params (N, K, n)
+            denominator = (k + 1.0) * (params[0] - params[1] - params[2] + k + 1.0);
+            if (k < 0.0 || denominator <= 0.0) return NAN;
+            return (params[1] - k) * (params[2] - k) / denominator;
+        default:
+            return NAN;
+    }
+}
+
+/**
+ * @brief Find the type of a prepared handle among the discrete distributions
+ * @return The type, or DIST_COUNT for continuous or unknown handles
+ */
+static distribution_type_t distribution_prepared_discrete_type(const distribution_prepared_t* prepared) {
+    for (int type = DIST_GEOMETRIC; type <= DIST_POISSON; type++) {
+        if (prepared->distribution == get_distribution((distribution_type_t)type)) {
+            return (distribution_type_t)type;
+        }
+    }
+    
+    return DIST_COUNT;
+}
+
+/**
+ * @brief Mode of the discrete distributions whose PMF has one
+ * @param type Distribution type
+ * @param params Distribution parameters in registry order
+ * @return The mode (the lower one when two points tie), or NAN when there is none
+ */
+static double distribution_pmf_mode(distribution_type_t type, const double* params) {
+    switch (type) {
+        case DIST_BINOMIAL:
+            return fmin(floor((params[0] + 1.0) * params[1]), params[0]);
+        case DIST_POISSON:
+            return floor(params[0]);
+        case DIST_GEOMETRIC:
+            return 1.0;
+        case DIST_NEGATIVE_BINOMIAL:
+            return params[0] > 1.0 ? floor((params[0] - 1.0) * (1.0 - params[1]) / params[1]) : 0.0;
+        case DIST_HYPERGEOMETRIC:
+            return floor((params[2] + 1.0) * (params[1] + 1.0) / (params[0] + 2.0));
+        default:
+            return NAN;
+    }
+}
+
+/**
+ * @brief Evaluate the PMF at k_min, k_min + 1, ..., k_min + count - 1
+ * Discrete distributions step by the ratio P(k+1)/P(k), so each point costs a
+ * multiply instead of a log-gamma evaluation. The chain is seeded at the mode
+ * (clamped to the range) and runs outward in both directions, so it starts
+ * from the largest value and cannot lose the bulk to a seed that underflowed
+ * in a far tail (e^-lambda for a large Poisson rate). The ratio is only
+ * defined inside the support, and these PMFs are unimodal, so a value that
+ * underflows on the way out stays 0 without further kernel calls; points
+ * where the ratio is undefined come from the kernel. Other distributions
+ * evaluate the PDF at each integer.
+ * @param prepared Prepared handle
+ * @param k_min First support point
+ * @param out Output array of count values
+ * @param count Number of values
+ * @return 0 on success, -1 if the handle or array is invalid
+ */
+int distribution_pmf_range(const distribution_prepared_t* prepared, int k_min, double* out, size_t count) {
+    if (!prepared || !prepared->pdf || !out) {
+        return -1;
+    }
+    
+    if (count == 0) {
+        return 0;
+    }
+    
+    distribution_type_t type = distribution_prepared_discrete_type(prepared);
+    double mode = distribution_pmf_mode(type, prepared->params);
+    size_t seed = 0;
+    
+    if (isfinite(mode) && mode > (double)k_min) {
+        double offset = mode - (double)k_min;
+        seed = offset < (double)(count - 1) ? (size_t)offset : count - 1;
+    }
+    
+    out[seed] = prepared->pdf(prepared, (double)k_min + (double)seed);
+    
+    // Upward from the mode: P(k) = P(k-1) * ratio(k-1)
+    for (size_t i = seed + 1; i < count; i++) {
+        double k = (double)k_min + (double)i;
+        double ratio = distribution_pmf_ratio(type, prepared->params, k - 1.0);
+        
+        if (isfinite(ratio) && ratio >= 0.0) {
+            out[i] = out[i - 1] * ratio;
+        } else {
+            out[i] = prepared->pdf(prepared, k);
+        }
+    }
+    
+    // Downward from the mode: P(k) = P(k+1) / ratio(k)
+    for (size_t i = seed; i-- > 0;) {
+        double k = (double)k_min + (double)i;
+        double ratio = distribution_pmf_ratio(type, prepared->params, k);
+        
+        if (isfinite(ratio) && ratio > 0.0) {
+            out[i] = out[i + 1] / ratio;
+        } else {
+            out[i] = prepared->pdf(prepared, k);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Sample a prepared handle's PDF/PMF on count evenly spaced points of [x_min, x_max]
+ * An integer x_min with unit spacing on a discrete distribution takes the
+ * distribution_pmf_range recurrence; everything else is evaluated in
+ * DISTRIBUTION_BATCH_CHUNK slices through the prepared batch kernel.
+ * @param prepared Prepared handle
+ * @param x_min First sample point
+ * @param x_max Last sample point (ignored when count is 1)
+ * @param count Number of samples
+ * @param out Output array of count values
+ * @return 0 on success, -1 if the handle or range is invalid
+ */
+int distribution_prepared_series(const distribution_prepared_t* prepared, double x_min, double x_max,
+                                 size_t count, double* out) {
+    double x[DISTRIBUTION_BATCH_CHUNK];
+    
+    if (!prepared || !out || !isfinite(x_min) || !isfinite(x_max) || x_max < x_min) {
+        return -1;
+    }
+    
+    double step = (count > 1) ? (x_max - x_min) / (double)(count - 1) : 0.0;
+    
+    if (distribution_prepared_discrete_type(prepared) != DIST_COUNT &&
+        (step == 1.0 || count == 1) && floor(x_min) == x_min && fabs(x_min) <= 2147483647.0) {
+        return distribution_pmf_range(prepared, (int)x_min, out, count);
+    }
+    
+    for (size_t start = 0; start < count; start += DISTRIBUTION_BATCH_CHUNK) {
+        size_t chunk = count - start < DISTRIBUTION_BATCH_CHUNK ? count - start : DISTRIBUTION_BATCH_CHUNK;
+        
+        for (size_t i = 0; i < chunk; i++) {
+            x[i] = x_min + (double)(start + i) * step;
+        }
+        if (distribution_prepared_pdf_batch(prepared, x, out + start, chunk) != 0) {
+            return -1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Sample the PDF/PMF on count evenly spaced points of [x_min, x_max]
+ * Prepares a handle and samples it with distribution_prepared_series.
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param x_min First sample point
+ * @param x_max Last sample point (ignored when count is 1)
+ * @param count Number of samples
+ * @param out Output array of count values
+ * @return 0 on success, -1 if the type, parameters or range are invalid
+ */
+int distribution_generate_series(distribution_type_t type, double* params, int param_count,
+                                 double x_min, double x_max, size_t count, double* out) {
+    distribution_prepared_t prepared;
+    
+    if (!out || !isfinite(x_min) || !isfinite(x_max) || x_max < x_min) {
+        return -1;
+    }
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return -1;
+    }
+    
+    return distribution_prepared_series(&prepared, x_min, x_max, count, out);
+}
+
+/**
+ * @brief Support [k_min, k_max] of the discrete distributions with finite support
+ * @return 0 on success, -1 for continuous types and unbounded supports
+ */
+static int distribution_pmf_support(distribution_type_t type, const double* params, double* k_min, double* k_max) {
+    switch (type) {
+        case DIST_BINOMIAL:
+            *k_min = 0.0;
+            *k_max = params[0];
+            return 0;
+        case DIST_HYPERGEOMETRIC:
+            // max(0, n - (N - K)) to min(n, K) with params (N, K, n)
+            *k_min = fmax(0.0, params[2] - (params[0] - params[1]));
+            *k_max = fmin(params[2], params[1]);
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+/**
+ * @brief Support of a prepared discrete handle
+ * @param prepared Prepared handle
+ * @param k_min Receives the smallest support point
+ * @param k_max Receives the largest, INFINITY for unbounded supports
+ * @return 0 on success, -1 for continuous or unknown handles
+ */
+int distribution_pmf_bounds(const distribution_prepared_t* prepared, double* k_min, double* k_max) {
+    if (!prepared || !k_min || !k_max) {
+        return -1;
+    }
+    
+    distribution_type_t type = distribution_prepared_discrete_type(prepared);
+    if (type == DIST_COUNT) {
+        return -1;
+    }
+    
+    if (distribution_pmf_support(type, prepared->params, k_min, k_max) != 0) {
+        *k_min = (type == DIST_GEOMETRIC) ? 1.0 : 0.0;
+        *k_max = INFINITY;
+    }
+    return 0;
+}
+
+/**
+ * @brief Find the type of a prepared handle
+ * @param prepared Prepared handle
+ * @return The type, or DIST_COUNT for NULL or unknown handles
+ */
+distribution_type_t distribution_prepared_type(const distribution_prepared_t* prepared) {
+    if (!prepared) {
+        return DIST_COUNT;
+    }
+    
+    for (int type = 0; type < DIST_COUNT; type++) {
+        if (prepared->distribution == get_distribution((distribution_type_t)type)) {
+            return (distribution_type_t)type;
+        }
+    }
+    
+    return DIST_COUNT;
+}
+
+/**
+ * @brief CDF (returned) and survival function of a prepared handle at x
+ * Infinite and NaN x are answered here so the tails kernels only see finite x.
+ */
+static double distribution_prepared_tails(const distribution_prepared_t* prepared, double x, double* upper) {
+    if (isnan(x)) {
+        *upper = NAN;
+        return NAN;
+    }
+    
+    if (isinf(x)) {
+        *upper = (x < 0.0) ? 1.0 : 0.0;
+        return 1.0 - *upper;
+    }
+    
+    if (prepared->tails) {
+        return prepared->tails(prepared, x, upper);
+    }
+    
+    double lower = prepared->cdf(prepared, x);
+    *upper = 1.0 - lower;
+    return lower;
+}
+
+/**
+ * @brief Survival function P(X > x) of a prepared handle
+ * @param prepared Prepared handle
+ * @param x Value at which to evaluate
+ * @return P(X > x), or NAN if the handle is invalid
+ */
+double distribution_prepared_sf(const distribution_prepared_t* prepared, double x) {
+    double upper;
+    
+    if (!prepared || !prepared->cdf) {
+        return NAN;
+    }
+    
+    distribution_prepared_tails(prepared, x, &upper);
+    return upper;
+}
+
+/**
+ * @brief Log CDF (returned) and log survival function of a prepared handle at x
+ * Without a log_tails kernel the linear tails are logged, which is exact up
+ * to the point they underflow.
+ */
+static double distribution_prepared_log_tails(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    double upper;
+    
+    if (isnan(x)) {
+        *log_upper = NAN;
+        return NAN;
+    }
+    
+    if (isinf(x)) {
+        *log_upper = (x < 0.0) ? 0.0 : -INFINITY;
+        return (x < 0.0) ? -INFINITY : 0.0;
+    }
+    
+    if (prepared->log_tails) {
+        return prepared->log_tails(prepared, x, log_upper);
+    }
+    
+    double lower = distribution_prepared_tails(prepared, x, &upper);
+    *log_upper = log(upper);
+    return log(lower);
+}
+
+/**
+ * @brief Log PDF of a prepared handle
+ * @param prepared Prepared handle
+ * @param x Value at which to evaluate
+ * @return log f(x), or NAN if the handle is invalid
+ */
+double distribution_prepared_logpdf(const distribution_prepared_t* prepared, double x) {
+    if (!prepared || !prepared->pdf) {
+        return NAN;
+    }
+    
+    if (prepared->logpdf && isfinite(x)) {
+        return prepared->logpdf(prepared, x);
+    }
+    
+    return log(prepared->pdf(prepared, x));
+}
+
+/**
+ * @brief Log CDF of a prepared handle
+ * @param prepared Prepared handle
+ * @param x Value at which to evaluate
+ * @return log P(X <= x), or NAN if the handle is invalid
+ */
+double distribution_prepared_logcdf(const distribution_prepared_t* prepared, double x) {
+    double log_upper;
+    
+    if (!prepared || !prepared->cdf) {
+        return NAN;
+    }
+    
+    return distribution_prepared_log_tails(prepared, x, &log_upper);
+}
+
+/**
+ * @brief Log survival function of a prepared handle
+ * @param prepared Prepared handle
+ * @param x Value at which to evaluate
+ * @return log P(X > x), or NAN if the handle is invalid
+ */
+double distribution_prepared_logsf(const distribution_prepared_t* prepared, double x) {
+    double log_upper;
+    
+    if (!prepared || !prepared->cdf) {
+        return NAN;
+    }
+    
+    distribution_prepared_log_tails(prepared, x, &log_upper);
+    return log_upper;
+}
+
+/**
+ * @brief Interval probability P(a < X <= b) of a prepared handle
+ * @param prepared Prepared handle
+ * @param a Lower bound (exclusive), may be -INFINITY
+ * @param b Upper bound (inclusive), may be INFINITY
+ * @return The probability, 0 if b <= a, or NAN if the handle or a bound is invalid
+ */
+double distribution_prepared_interval(const distribution_prepared_t* prepared, double a, double b) {
+    double lower_a;
+    double upper_a;
+    double lower_b;
+    double upper_b;
+    
+    if (!prepared || !prepared->cdf || isnan(a) || isnan(b)) {
+        return NAN;
+    }
+    
+    if (b <= a) {
+        return 0.0;
+    }
+    
+    lower_a = distribution_prepared_tails(prepared, a, &upper_a);
+    lower_b = distribution_prepared_tails(prepared, b, &upper_b);
+    
+    // Difference the tail that is smaller at a, so neither term comes from 1 - (a value near 1)
+    double probability = (upper_a < lower_a) ? upper_a - upper_b : lower_b - lower_a;
+    return (probability < 0.0) ? 0.0 : probability;
+}
+
+/**
+ * @brief Survival function P(X > x)
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param x Value at which to evaluate
+ * @return P(X > x), or NAN if the type or parameters are invalid
+ */
+double distribution_sf(distribution_type_t type, double* params, int param_count, double x) {
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return NAN;
+    }
+    
+    return distribution_prepared_sf(&prepared, x);
+}
+
+/**
+ * @brief Interval probability P(a < X <= b)
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param a Lower bound (exclusive)
+ * @param b Upper bound (inclusive)
+ * @return The probability, or NAN if the type, parameters or bounds are invalid
+ */
+double distribution_interval(distribution_type_t type, double* params, int param_count, double a, double b) {
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return NAN;
+    }
+    
+    return distribution_prepared_interval(&prepared, a, b);
+}
+
+/**
+ * @brief Log PDF log f(x)
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param x Value at which to evaluate
+ * @return log f(x), or NAN if the type or parameters are invalid
+ */
+double distribution_logpdf(distribution_type_t type, double* params, int param_count, double x) {
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return NAN;
+    }
+    
+    return distribution_prepared_logpdf(&prepared, x);
+}
+
+/**
+ * @brief Log CDF log P(X <= x)
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param x Value at which to evaluate
+ * @return log P(X <= x), or NAN if the type or parameters are invalid
+ */
+double distribution_logcdf(distribution_type_t type, double* params, int param_count, double x) {
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return NAN;
+    }
+    
+    return distribution_prepared_logcdf(&prepared, x);
+}
+
+/**
+ * @brief Log survival function log P(X > x)
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param x Value at which to evaluate
+ * @return log P(X > x), or NAN if the type or parameters are invalid
+ */
+double distribution_logsf(distribution_type_t type, double* params, int param_count, double x) {
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return NAN;
+    }
+    
+    return distribution_prepared_logsf(&prepared, x);
+}
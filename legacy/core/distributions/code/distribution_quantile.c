@@ -0,0 +1,494 @@
+#include "../lib/distribution_interface.h"
+#include "../../math/math_utils.h"
+#include "../../../models/distributions/distribution_registry.h"
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+
+// Relative step size at which the continuous refinement stops
+#define QUANTILE_TOLERANCE 1e-13
+
+// Iteration cap for the refinement and for the discrete bracket search
+#define QUANTILE_MAX_ITERATIONS 100
+
+/**
+ * @brief Support of a distribution for the current parameters
+ */
+typedef struct {
+    double lower;
+    double upper;
+    int discrete;
+} quantile_support_t;
+
+/**
+ * @brief Standard normal quantile
+ * Acklam's rational approximation (relative error 1.15e-9) polished with one
+ * Halley step against the C library erfc.
+ */
+static double quantile_standard_normal(double p) {
+    static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                               1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                               6.680131188771972e+01, -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                               -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                               3.754408661907416e+00};
+    
+    if (p <= 0.0) return -INFINITY;
+    if (p >= 1.0) return INFINITY;
+    
+    double z;
+    
+    if (p < 0.02425) {
+        // Lower tail
+        double q = sqrt(-2.0 * log(p));
+        z = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    } else if (p > 1.0 - 0.02425) {
+        // Upper tail
+        double q = sqrt(-2.0 * log1p(-p));
+        z = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+             ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    } else {
+        // Central region
+        double q = p - 0.5;
+        double r = q * q;
+        z = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+            (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+    }
+    
+    // Halley refinement: Φ(z) = erfc(-z/√2)/2, φ'(z)/φ(z) = -z
+    double e = 0.5 * erfc(-z / M_SQRT2) - p;
+    double u = e * M_SQRT_2PI * exp(0.5 * z * z);
+    
+    return z - u / (1.0 + 0.5 * z * u);
+}
+
+/**
+ * @brief Describe the support of a registered distribution
+ * @return 0 on success, -1 if the type is not handled
+ */
+static int quantile_support(distribution_type_t type, const double* params, quantile_support_t* support) {
+    support->discrete = (registry_get_distribution_category(type) == DISTRIBUTION_DISCRETE);
+    support->lower = 0.0;
+    support->upper = INFINITY;
+    
+    switch (type) {
+        case DIST_NORMAL:
+        case DIST_T_DISTRIBUTION:
+            support->lower = -INFINITY;
+            break;
+        case DIST_EXPONENTIAL:
+        case DIST_CHI_SQUARE:
+        case DIST_F_DISTRIBUTION:
+        case DIST_NEGATIVE_BINOMIAL:
+        case DIST_POISSON:
+            break;
+        case DIST_GEOMETRIC:
+            support->lower = 1.0;
+            break;
+        case DIST_HYPERGEOMETRIC:
+            support->lower = fmax(0.0, params[2] + params[1] - params[0]);
+            support->upper = fmin(params[2], params[1]);
+            break;
+        case DIST_BINOMIAL:
+            support->upper = params[0];
+            break;
+        case DIST_GAMMA:
+        case DIST_WEIBULL:
+        case DIST_RAYLEIGH:
+            break;
+        case DIST_UNIFORM:
+            support->lower = params[0];
+            support->upper = params[1];
+            break;
+        case DIST_BETA:
+            support->upper = 1.0;
+            break;
+        case DIST_PARETO:
+            support->lower = params[0];
+            break;
+        default:
+            return -1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Wilson–Hilferty chi-square quantile, with the small-p series form
+ * x ≈ 2(pΓ(k/2+1))^(2/k) where the cube-root transformation breaks down
+ */
+static double quantile_chi_square_guess(double k, double p, double z) {
+    double half_k = k / 2.0;
+    
+    if (k < -1.24 * log(p)) {
+        return 2.0 * exp((log(p) + log_gamma_function(half_k + 1.0)) / half_k);
+    }
+    
+    double h = 2.0 / (9.0 * k);
+    double term = 1.0 - h + z * sqrt(h);
+    
+    return (term > 0.0) ? k * term * term * term : k;
+}
+
+/**
+ * @brief Cornish–Fisher expansion of the t quantile in powers of 1/ν
+ * Uses the closed forms for ν = 1 and ν = 2.
+ */
+static double quantile_t_guess(double nu, double p, double z) {
+    if (nu == 1.0) {
+        return tan(M_PI_PRECISE * (p - 0.5));
+    }
+    
+    if (nu == 2.0) {
+        return (2.0 * p - 1.0) / sqrt(2.0 * p * (1.0 - p));
+    }
+    
+    double z2 = z * z;
+    double g1 = (z2 + 1.0) * z / 4.0;
+    double g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+    double g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+    
+    return z + g1 / nu + g2 / (nu * nu) + g3 / (nu * nu * nu);
+}
+
+/**
+ * @brief Paulson's F quantile: Wilson–Hilferty applied to both chi-squares
+ * Solves ((1-b)y - (1-a)) / √(by² + a) = z for y = x^(1/3).
+ */
+static double quantile_f_guess(double nu1, double nu2, double z) {
+    double a = 2.0 / (9.0 * nu1);
+    double b = 2.0 / (9.0 * nu2);
+    double qa = (1.0 - b) * (1.0 - b) - z * z * b;
+    double qb = -2.0 * (1.0 - a) * (1.0 - b);
+    double qc = (1.0 - a) * (1.0 - a) - z * z * a;
+    double disc = qb * qb - 4.0 * qa * qc;
+    
+    if (qa <= 0.0 || disc < 0.0) {
+        return 1.0;
+    }
+    
+    double y = (-qb + ((z >= 0.0) ? sqrt(disc) : -sqrt(disc))) / (2.0 * qa);
+    
+    return (y > 0.0) ? y * y * y : 1.0;
+}
+
+/**
+ * @brief Cornish–Fisher guess from mean, standard deviation and skewness
+ */
+static double quantile_moment_guess(double mean, double std_dev, double skewness, double z) {
+    return mean + std_dev * (z + skewness * (z * z - 1.0) / 6.0);
+}
+
+/**
+ * @brief Initial quantile estimate for a registered distribution
+ */
+static double quantile_initial_guess(distribution_type_t type, const double* params, double p) {
+    double z = quantile_standard_normal(p);
+    
+    switch (type) {
+        case DIST_NORMAL:
+            return params[0] + params[1] * z;
+        case DIST_EXPONENTIAL:
+            return -log1p(-p) / params[0];
+        case DIST_CHI_SQUARE:
+            return quantile_chi_square_guess(params[0], p, z);
+        case DIST_T_DISTRIBUTION:
+            return quantile_t_guess(params[0], p, z);
+        case DIST_F_DISTRIBUTION:
+            return quantile_f_guess(params[0], params[1], z);
+        case DIST_GEOMETRIC:
+            if (params[0] >= 1.0) return 1.0;
+            return ceil(log1p(-p) / log1p(-params[0]));
+        case DIST_HYPERGEOMETRIC: {
+            double N = params[0];
+            double K = params[1];
+            double n = params[2];
+            double mean = n * K / N;
+            double variance = (N > 1.0) ? mean * (N - K) / N * (N - n) / (N - 1.0) : 0.0;
+            double skewness = 0.0;
+            if (variance > 0.0 && N > 2.0) {
+                skewness = (N - 2.0 * K) * sqrt(N - 1.0) * (N - 2.0 * n) /
+                           (sqrt(n * K * (N - K) * (N - n)) * (N - 2.0));
+            }
+            return quantile_moment_guess(mean, sqrt(variance), skewness, z);
+        }
+        case DIST_BINOMIAL: {
+            double n = params[0];
+            double q = 1.0 - params[1];
+            double std_dev = sqrt(n * params[1] * q);
+            double skewness = (std_dev > 0.0) ? (q - params[1]) / std_dev : 0.0;
+            return quantile_moment_guess(n * params[1], std_dev, skewness, z);
+        }
+        case DIST_NEGATIVE_BINOMIAL: {
+            double r = params[0];
+            double q = 1.0 - params[1];
+            double std_dev = sqrt(r * q) / params[1];
+            double skewness = (q > 0.0) ? (1.0 + q) / sqrt(r * q) : 0.0;
+            return quantile_moment_guess(r * q / params[1], std_dev, skewness, z);
+        }
+        case DIST_POISSON:
+            return quantile_moment_guess(params[0], sqrt(params[0]), 1.0 / sqrt(params[0]), z);
+        case DIST_UNIFORM:
+            return params[0] + p * (params[1] - params[0]);
+        case DIST_GAMMA:
+            // Gamma(k, θ) is θ/2 times a chi-square with 2k degrees of freedom
+            return 0.5 * params[1] * quantile_chi_square_guess(2.0 * params[0], p, z);
+        case DIST_BETA: {
+            double a = params[0];
+            double b = params[1];
+            double mean = a / (a + b);
+            double std_dev = sqrt(a * b / (a + b + 1.0)) / (a + b);
+            return fmin(fmax(mean + std_dev * z, 0.5 * mean), 0.5 * (1.0 + mean));
+        }
+        case DIST_WEIBULL:
+            return params[1] * pow(-log1p(-p), 1.0 / params[0]);
+        case DIST_PARETO:
+            return params[0] * exp(-log1p(-p) / params[1]);
+        case DIST_RAYLEIGH:
+            return params[0] * sqrt(-2.0 * log1p(-p));
+        default:
+            return NAN;
+    }
+}
+
+/**
+ * @brief Derivative of log(PDF), used for the Halley correction
+ * @return d/dx log f(x), or 0 to fall back to a plain Newton step
+ */
+static double quantile_log_pdf_slope(distribution_type_t type, const double* params, double x) {
+    switch (type) {
+        case DIST_NORMAL:
+            return -(x - params[0]) / (params[1] * params[1]);
+        case DIST_EXPONENTIAL:
+            return -params[0];
+        case DIST_CHI_SQUARE:
+            return (params[0] / 2.0 - 1.0) / x - 0.5;
+        case DIST_T_DISTRIBUTION:
+            return -(params[0] + 1.0) * x / (params[0] + x * x);
+        case DIST_F_DISTRIBUTION: {
+            double ratio = params[0] / params[1];
+            return (params[0] / 2.0 - 1.0) / x - (params[0] + params[1]) / 2.0 * ratio / (1.0 + ratio * x);
+        }
+        case DIST_GAMMA:
+            return (params[0] - 1.0) / x - 1.0 / params[1];
+        case DIST_BETA:
+            return (params[0] - 1.0) / x - (params[1] - 1.0) / (1.0 - x);
+        case DIST_WEIBULL:
+            return (params[0] - 1.0) / x - params[0] / params[1] * pow(x / params[1], params[0] - 1.0);
+        case DIST_PARETO:
+            return -(params[1] + 1.0) / x;
+        case DIST_RAYLEIGH:
+            return 1.0 / x - x / (params[0] * params[0]);
+        default:
+            return 0.0;
+    }
+}
+
+/**
+ * @brief Safeguarded Halley/Newton refinement of a continuous quantile
+ * Every evaluation tightens a bracket around the root; steps that leave it
+ * are replaced by bisection, or by doubling while the bracket is unbounded.
+ */
+static double quantile_continuous(distribution_type_t type, const distribution_prepared_t* prepared,
+                                  const quantile_support_t* support, double p, double x) {
+    double lower = support->lower;
+    double upper = support->upper;
+    
+    if (!is_finite_number(x) || x <= lower || x >= upper) {
+        x = is_finite_number(lower) ? lower + 1.0 : (is_finite_number(upper) ? upper - 1.0 : 0.0);
+    }
+    
+    for (int i = 0; i < QUANTILE_MAX_ITERATIONS; i++) {
+        double error = prepared->cdf(prepared, x) - p;
+        
+        if (error == 0.0) {
+            return x;
+        }
+        
+        if (error < 0.0) {
+            lower = x;
+        } else {
+            upper = x;
+        }
+        
+        double density = prepared->pdf(prepared, x);
+        double next = NAN;
+        
+        if (density > 0.0 && is_finite_number(density)) {
+            double step = error / density;
+            double correction = 0.5 * step * quantile_log_pdf_slope(type, prepared->params, x);
+            
+            // Halley only while the correction is small enough to stay stable
+            if (fabs(correction) < 0.5) {
+                step /= 1.0 - correction;
+            }
+            
+            next = x - step;
+        }
+        
+        if (!(next > lower && next < upper)) {
+            if (is_finite_number(lower) && is_finite_number(upper)) {
+                next = 0.5 * (lower + upper);
+            } else if (is_finite_number(lower)) {
+                next = x + fmax(1.0, fabs(x));
+            } else {
+                next = x - fmax(1.0, fabs(x));
+            }
+        }
+        
+        if (fabs(next - x) <= QUANTILE_TOLERANCE * fabs(next) || next == x) {
+            return next;
+        }
+        
+        x = next;
+    }
+    
+    return x;
+}
+
+/**
+ * @brief Smallest support point k with CDF(k) >= p
+ * Gallops away from the initial guess to bracket the answer, then bisects.
+ */
+static double quantile_discrete(const distribution_prepared_t* prepared, const quantile_support_t* support,
+                                double p, double k) {
+    // Accept CDF values a few ulps below p so rounding cannot push the answer up by one
+    double target = p * (1.0 - 64.0 * DBL_EPSILON);
+    
+    k = floor(k + 0.5);
+    if (!is_finite_number(k) || k < support->lower) k = support->lower;
+    if (k > support->upper) k = support->upper;
+    
+    double below;
+    double above;
+    double step = 1.0;
+    
+    if (prepared->cdf(prepared, k) >= target) {
+        // Walk down until the CDF drops below p
+        above = k;
+        below = k - step;
+        while (below >= support->lower && prepared->cdf(prepared, below) >= target) {
+            above = below;
+            step *= 2.0;
+            below = above - step;
+        }
+        
+        if (below < support->lower) {
+            below = support->lower - 1.0;
+        }
+    } else {
+        // Walk up until the CDF reaches p
+        below = k;
+        above = k + step;
+        for (int i = 0; i < QUANTILE_MAX_ITERATIONS; i++) {
+            if (above >= support->upper) {
+                above = support->upper;
+                break;
+            }
+            
+            if (prepared->cdf(prepared, above) >= target) {
+                break;
+            }
+            
+            below = above;
+            step *= 2.0;
+            above = below + step;
+        }
+    }
+    
+    // Invariant: CDF(below) < p <= CDF(above)
+    while (above - below > 1.0) {
+        double middle = floor(0.5 * (below + above));
+        
+        if (prepared->cdf(prepared, middle) >= target) {
+            above = middle;
+        } else {
+            below = middle;
+        }
+    }
+    
+    return above;
+}
+
+/**
+ * @brief Quantile of a prepared handle known to be of the given type
+ */
+static double quantile_prepared(distribution_type_t type, const distribution_prepared_t* prepared, double p) {
+    quantile_support_t support;
+    
+    if (isnan(p) || p < 0.0 || p > 1.0) {
+        return NAN;
+    }
+    
+    if (quantile_support(type, prepared->params, &support) != 0) {
+        return NAN;
+    }
+    
+    if (p == 0.0) {
+        return support.lower;
+    }
+    
+    if (p == 1.0) {
+        return support.upper;
+    }
+    
+    double guess = quantile_initial_guess(type, prepared->params, p);
+    
+    if (support.discrete) {
+        return quantile_discrete(prepared, &support, p, guess);
+    }
+    
+    return quantile_continuous(type, prepared, &support, p, guess);
+}
+
+/**
+ * @brief Quantile (inverse CDF) of a registered distribution
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param p Probability in [0, 1]
+ * @return x with CDF(x) = p, the smallest such support point for discrete
+ *         distributions, or NAN if the type, parameters or p are invalid
+ */
+double distribution_quantile(distribution_type_t type, double* params, int param_count, double p) {
+    distribution_prepared_t prepared;
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        return NAN;
+    }
+    
+    return quantile_prepared(type, &prepared, p);
+}
+
+/**
+ * @brief Quantiles for an array of probabilities with one parameter validation
+ * @param type Distribution type
+ * @param params Distribution parameters
+ * @param param_count Number of parameters
+ * @param p Array of count probabilities
+ * @param out Receives the quantiles
+ * @param count Number of probabilities
+ * @return 0 on success, -1 if the arrays, type or parameters are invalid
+ */
+int distribution_quantile_batch(distribution_type_t type, double* params, int param_count,
+                                const double* p, double* out, size_t count) {
+    distribution_prepared_t prepared;
+    
+    if (!p || !out) {
+        return -1;
+    }
+    
+    if (distribution_prepare(type, params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = quantile_prepared(type, &prepared, p[i]);
+    }
+    
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+#include "../lib/distribution_interface.h"
+#include <math.h>
+#include <stddef.h>
+
+// Largest support point a table index may reach
+#define TABLE_MAX_POINT 2147483647.0
+
+/**
+ * @brief Add value to a Neumaier-compensated running sum
+ */
+static void distribution_table_sum_add(double* sum, double* compensation, double value) {
+    double total = *sum + value;
+    
+    if (fabs(*sum) >= fabs(value)) {
+        *compensation += (*sum - total) + value;
+    } else {
+        *compensation += (value - total) + *sum;
+    }
+    *sum = total;
+}
+
+/**
+ * @brief Smallest k in [k_min, k_max] with P(X > k) <= DISTRIBUTION_TABLE_TAIL_MASS
+ * The step from k_min doubles until it passes the point, then bisection
+ * narrows it down, so an unbounded support costs two logarithms' worth of
+ * survival evaluations.
+ * @return The point, or -1 if it lies past TABLE_MAX_POINT
+ */
+static double distribution_table_upper_point(const distribution_prepared_t* prepared, double k_min, double k_max) {
+    double below = k_min - 1.0;    // survival above the cut-off
+    double above = k_min;
+    double span = 1.0;
+    
+    while (above < k_max && distribution_prepared_sf(prepared, above) > DISTRIBUTION_TABLE_TAIL_MASS) {
+        below = above;
+        span *= 2.0;
+        above = fmin(k_min + span - 1.0, k_max);
+        if (above > TABLE_MAX_POINT) {
+            return -1.0;
+        }
+    }
+    
+    while (above - below > 1.0) {
+        double middle = floor(below + (above - below) / 2.0);
+    
+        if (distribution_prepared_sf(prepared, middle) > DISTRIBUTION_TABLE_TAIL_MASS) {
+            below = middle;
+        } else {
+            above = middle;
+        }
+    }
+    
+    return above;
+}
+
+/**
+ * @brief Smallest k in [k_min, k_max] with P(X <= k) > DISTRIBUTION_TABLE_TAIL_MASS
+ * k_max must satisfy it, as the point from distribution_table_upper_point does.
+ */
+static double distribution_table_lower_point(const distribution_prepared_t* prepared, double k_min, double k_max) {
+    double below = k_min;    // CDF at or under the cut-off
+    double above = k_max;
+    
+    if (distribution_prepared_cdf(prepared, k_min) > DISTRIBUTION_TABLE_TAIL_MASS) {
+        return k_min;
+    }
+    
+    while (above - below > 1.0) {
+        double middle = floor(below + (above - below) / 2.0);
+    
+        if (distribution_prepared_cdf(prepared, middle) > DISTRIBUTION_TABLE_TAIL_MASS) {
+            above = middle;
+        } else {
+            below = middle;
+        }
+    }
+    
+    return above;
+}
+
+/**
+ * @brief Build the PMF, CDF and survival tables of a discrete handle
+ * A support of at most capacity points is tabulated whole. A longer or
+ * unbounded one is cut where each tail holds at most DISTRIBUTION_TABLE_TAIL_MASS,
+ * and the mass left out is kept in lower_mass and upper_mass, so Poisson and
+ * geometric tables end a few dozen points past the bulk. The PMF comes from
+ * the distribution_pmf_range recurrence; cdf[i] sums it up to i from the
+ * lower cut and sf[i] from i + 1 to the upper one, both compensated, so each
+ * keeps full relative precision in its own tail.
+ * @param prepared Prepared discrete handle
+ * @param storage 3 * capacity doubles, which the table's arrays point into
+ * @param capacity Most support points to tabulate, at most DISTRIBUTION_TABLE_MAX_ENTRIES is typical
+ * @param table Receives the table
+ * @return 0 on success, -1 for continuous handles, invalid arguments or a support that does not fit
+ */
+int distribution_table_build(const distribution_prepared_t* prepared, double* storage, size_t capacity,
+                             distribution_table_t* table) {
+    double k_min;
+    double k_max;
+    double lower_mass = 0.0;
+    double upper_mass = 0.0;
+    
+    if (!storage || !table || capacity == 0 || distribution_pmf_bounds(prepared, &k_min, &k_max) != 0 ||
+        k_min > k_max || k_min > TABLE_MAX_POINT) {
+        return -1;
+    }
+    
+    if (k_max - k_min + 1.0 > (double)capacity) {
+        double upper_point = distribution_table_upper_point(prepared, k_min, k_max);
+        if (upper_point < 0.0) {
+            return -1;
+        }
+        double lower_point = distribution_table_lower_point(prepared, k_min, upper_point);
+    
+        if (upper_point - lower_point + 1.0 > (double)capacity) {
+            return -1;
+        }
+        if (lower_point > k_min) {
+            lower_mass = distribution_prepared_cdf(prepared, lower_point - 1.0);
+        }
+        if (upper_point < k_max) {
+            upper_mass = distribution_prepared_sf(prepared, upper_point);
+        }
+        k_min = lower_point;
+        k_max = upper_point;
+    }
+    
+    size_t count = (size_t)(k_max - k_min + 1.0);
+    double* pmf = storage;
+    double* cdf = storage + count;
+    double* sf = storage + 2 * count;
+    
+    if (distribution_pmf_range(prepared, (int)k_min, pmf, count) != 0) {
+        return -1;
+    }
+    
+    double sum = lower_mass;
+    double compensation = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        distribution_table_sum_add(&sum, &compensation, pmf[i]);
+        cdf[i] = fmin(sum + compensation, 1.0);
+    }
+    
+    sum = upper_mass;
+    compensation = 0.0;
+    for (size_t i = count; i-- > 0;) {
+        sf[i] = fmin(sum + compensation, 1.0);
+        distribution_table_sum_add(&sum, &compensation, pmf[i]);
+    }
+    
+    table->k_min = (int)k_min;
+    table->count = count;
+    table->lower_mass = lower_mass;
+    table->upper_mass = upper_mass;
+    table->pmf = pmf;
+    table->cdf = cdf;
+    table->sf = sf;
+    return 0;
+}
+
+/**
+ * @brief PMF, CDF and survival function at x from a table
+ * Non-integer x has no mass and the CDF at floor(x). Below or above the
+ * table the answer is exact only when no mass was left out on that side.
+ * @param table Table from distribution_table_build
+ * @param x Value at which to evaluate
+ * @param pmf Receives P(X = x) (may be NULL)
+ * @param cdf Receives P(X <= x) (may be NULL)
+ * @param sf Receives P(X > x) (may be NULL)
+ * @return 0 on success, -1 if x is NaN or falls in a left-out tail
+ */
+int distribution_table_point(const distribution_table_t* table, double x, double* pmf, double* cdf, double* sf) {
+    double point_pmf = 0.0;
+    double point_cdf;
+    double point_sf;
+    
+    if (!table || isnan(x)) {
+        return -1;
+    }
+    
+    double k = floor(x);
+    double k_last = (double)table->k_min + (double)table->count - 1.0;
+    
+    if (k < (double)table->k_min) {
+        if (table->lower_mass != 0.0 && x != -INFINITY) {
+            return -1;
+        }
+        point_cdf = 0.0;
+        point_sf = 1.0;
+    } else if (k > k_last) {
+        if (table->upper_mass != 0.0 && x != INFINITY) {
+            return -1;
+        }
+        point_cdf = 1.0;
+        point_sf = 0.0;
+    } else {
+        size_t i = (size_t)(k - (double)table->k_min);
+    
+        point_pmf = (k == x) ? table->pmf[i] : 0.0;
+        point_cdf = table->cdf[i];
+        point_sf = table->sf[i];
+    }
+    
+    if (pmf) *pmf = point_pmf;
+    if (cdf) *cdf = point_cdf;
+    if (sf) *sf = point_sf;
+    return 0;
+}
+
+/**
+ * @brief Interval probability P(a < X <= b) from a table
+ * Differences whichever tail is smaller at a, as distribution_prepared_interval does.
+ * @return 0 on success (the probability is 0 when b <= a), -1 if a bound is NaN or falls in a left-out tail
+ */
+int distribution_table_interval(const distribution_table_t* table, double a, double b, double* probability) {
+    double lower_a;
+    double upper_a;
+    double lower_b;
+    double upper_b;
+    
+    if (!table || !probability || isnan(a) || isnan(b)) {
+        return -1;
+    }
+    
+    if (b <= a) {
+        *probability = 0.0;
+        return 0;
+    }
+    
+    if (distribution_table_point(table, a, NULL, &lower_a, &upper_a) != 0 ||
+        distribution_table_point(table, b, NULL, &lower_b, &upper_b) != 0) {
+        return -1;
+    }
+    
+    double value = (upper_a < lower_a) ? upper_a - upper_b : lower_b - lower_a;
+    *probability = (value < 0.0) ? 0.0 : value;
+    return 0;
+}
+
+/**
+ * @brief PMF at count unit-spaced integers from x_min, copied from a table
+ * @param table Table from distribution_table_build
+ * @param x_min First sample point
+ * @param x_max Last sample point (ignored when count is 1)
+ * @param count Number of samples
+ * @param out Output array of count values
+ * @return 0 on success, -1 if the points are not consecutive integers or reach a left-out tail
+ */
+int distribution_table_series(const distribution_table_t* table, double x_min, double x_max, size_t count,
+                              double* out) {
+    if (!table || !out || count == 0 || floor(x_min) != x_min || fabs(x_min) > TABLE_MAX_POINT ||
+        (count > 1 && x_max - x_min != (double)(count - 1))) {
+        return -1;
+    }
+    
+    double k_last = (double)table->k_min + (double)table->count - 1.0;
+    
+    for (size_t i = 0; i < count; i++) {
+        double k = x_min + (double)i;
+    
+        if (k < (double)table->k_min) {
+            if (table->lower_mass != 0.0) {
+                return -1;
+            }
+            out[i] = 0.0;
+        } else if (k > k_last) {
+            if (table->upper_mass != 0.0) {
+                return -1;
+            }
+            out[i] = 0.0;
+        } else {
+            out[i] = table->pmf[(size_t)(k - (double)table->k_min)];
+        }
+    }
+    
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "exponential_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/vector_math.h"
 #include <math.h>
 #include <stddef.h>
 
@@ -11,19 +12,37 @@ static const char* exponential_param_names[] = {"lambda"};
  * Formula: f(x) = λ * exp(-λx) for x ≥ 0, 0 otherwise
  */
 double exponential_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+    double result;
+    
+    if (exponential_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!exponential_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Exponential distribution CDF calculation
+ * Formula: F(x) = 1 - exp(-λx) for x ≥ 0, 0 otherwise
+ */
+double exponential_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (exponential_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double lambda = params[0];
+    return result;
+}
+
+/**
+ * @brief Exponential distribution PDF for a prepared handle
+ */
+static double exponential_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double lambda = prepared->constants[0];
     
     if (!is_finite_number(x)) {
-        if (x == INFINITY) return 0.0;
-        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY || x == -INFINITY) return 0.0;
         return NAN;
     }
     
@@ -37,33 +56,180 @@ double exponential_pdf(double x, double* params, int param_count) {
 }
 
 /**
- * @brief Exponential distribution CDF calculation
- * Formula: F(x) = 1 - exp(-λx) for x ≥ 0, 0 otherwise
+ * @brief Exponential distribution CDF for a prepared handle
  */
-double exponential_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+static double exponential_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double lambda = prepared->constants[0];
+    
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
-    if (!exponential_validate_params(params, param_count)) {
+    // CDF is 0 for negative x
+    if (x < 0.0) {
+        return 0.0;
+    }
+    
+    // Calculate CDF: 1 - exp(-λx), via expm1 to keep precision for small λx
+    return -expm1(-lambda * x);
+}
+
+/**
+ * @brief Single-precision Exponential PDF for a prepared handle
+ */
+static float exponential_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    float lambda = prepared->constants_float[0];
+    
+    if (!isfinite(x)) {
+        if (x == INFINITY || x == -INFINITY) return 0.0f;
         return NAN;
     }
     
-    double lambda = params[0];
+    if (x < 0.0f) {
+        return 0.0f;
+    }
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
+    return lambda * expf(-lambda * x);
+}
+
+/**
+ * @brief Single-precision Exponential CDF for a prepared handle
+ */
+static float exponential_cdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
+        if (x == -INFINITY) return 0.0f;
+        if (x == INFINITY) return 1.0f;
         return NAN;
     }
     
-    // CDF is 0 for negative x
+    if (x < 0.0f) {
+        return 0.0f;
+    }
+    
+    return -expm1f(-prepared->constants_float[0] * x);
+}
+
+/**
+ * @brief Exponential CDF and survival function e^(-λx) for a prepared handle
+ */
+static double exponential_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    double lambda = prepared->constants[0];
+    
     if (x < 0.0) {
+        *upper = 1.0;
         return 0.0;
     }
     
-    // Calculate CDF: 1 - exp(-λx)
-    return 1.0 - safe_exp(-lambda * x);
+    *upper = exp(-lambda * x);
+    return -expm1(-lambda * x);
+}
+
+/**
+ * @brief Exponential log PDF log(λ) - λx for a prepared handle
+ */
+static double exponential_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x < 0.0) {
+        return -INFINITY;
+    }
+    
+    return prepared->constants[1] - prepared->constants[0] * x;
+}
+
+/**
+ * @brief Exponential log CDF and log survival function -λx for a prepared handle
+ */
+static double exponential_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x < 0.0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    *log_upper = -prepared->constants[0] * x;
+    return log_one_minus_exp(*log_upper);
+}
+
+/**
+ * @brief Validate parameters and fill an Exponential prepared handle with λ and log(λ)
+ */
+static int exponential_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!exponential_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    prepared->constants[0] = params[0];
+    prepared->constants[1] = log(params[0]);
+    prepared->branch = 0;
+    prepared->pdf = exponential_pdf_prepared;
+    prepared->cdf = exponential_cdf_prepared;
+    prepared->tails = exponential_tails_prepared;
+    prepared->logpdf = exponential_logpdf_prepared;
+    prepared->log_tails = exponential_log_tails_prepared;
+    prepared->pdf_float = exponential_pdf_prepared_float;
+    prepared->cdf_float = exponential_cdf_prepared_float;
+    
+    return 0;
+}
+
+/**
+ * @brief Exponential distribution batched PDF calculation
+ * Exponents are staged per chunk so exp runs through the vector_math kernel.
+ */
+int exponential_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    double chunk[DISTRIBUTION_BATCH_CHUNK];
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (exponential_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    double lambda = prepared.constants[0];
+    
+    // Negative x (including -∞) maps to exp(-∞) = 0; NaN propagates
+    for (size_t start = 0; start < count; start += DISTRIBUTION_BATCH_CHUNK) {
+        size_t n = (count - start < DISTRIBUTION_BATCH_CHUNK) ? count - start : DISTRIBUTION_BATCH_CHUNK;
+        
+        for (size_t i = 0; i < n; i++) {
+            double value = x[start + i];
+            chunk[i] = (value < 0.0) ? -INFINITY : -lambda * value;
+        }
+        
+        vector_exp(chunk, chunk, n);
+        
+        for (size_t i = 0; i < n; i++) {
+            out[start + i] = lambda * chunk[i];
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Exponential distribution batched CDF calculation
+ */
+int exponential_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (exponential_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = exponential_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -85,18 +251,24 @@ int exponential_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Exponential distribution interface object, referenced directly by the registry table
+ */
+const distribution_t exponential_distribution_impl = {
+    .pdf = exponential_pdf,
+    .cdf = exponential_cdf,
+    .validate_params = exponential_validate_params,
+    .distribution_name = "Exponential",
+    .param_count = 1,
+    .param_names = exponential_param_names,
+    .pdf_batch = exponential_pdf_batch,
+    .cdf_batch = exponential_cdf_batch,
+    .prepare = exponential_prepare
+};
+
 /**
  * @brief Get the Exponential distribution interface
  */
 const distribution_t* get_exponential_distribution(void) {
-    static const distribution_t exponential_dist = {
-        .pdf = exponential_pdf,
-        .cdf = exponential_cdf,
-        .validate_params = exponential_validate_params,
-        .distribution_name = "Exponential",
-        .param_count = 1,
-        .param_names = exponential_param_names
-    };
-    
-    return &exponential_dist;
+    return &exponential_distribution_impl;
 }
\ No newline at end of file
@@ -1,31 +1,56 @@
 #include "f_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
 // Parameter names for F-distribution
 static const char* f_param_names[] = {"numerator_df", "denominator_df"};
 
-// Forward declarations for helper functions
-static double incomplete_beta_regularized_f(double a, double b, double x);
-static double continued_fraction_beta_f(double a, double b, double x);
-
 /**
  * @brief F-distribution PDF calculation
  * Formula: f(x) = [Γ((ν₁+ν₂)/2) / (Γ(ν₁/2)Γ(ν₂/2))] * (ν₁/ν₂)^(ν₁/2) * x^(ν₁/2-1) * (1 + (ν₁/ν₂)x)^(-(ν₁+ν₂)/2)
  */
 double f_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (f_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!f_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief F-distribution CDF calculation
+ * Uses the relationship with the incomplete beta function
+ */
+double f_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (f_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double nu1 = params[0]; // numerator degrees of freedom
-    double nu2 = params[1]; // denominator degrees of freedom
-    
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    F_NU1 = 0,
+    F_NU2 = 1,
+    F_HALF_NU1 = 2,
+    F_HALF_NU2 = 3,
+    F_HALF_SUM = 4,
+    F_RATIO = 5,
+    F_LOG_NORM = 6,
+    F_LOG_BETA = 7
+};
+
+/**
+ * @brief F-distribution PDF for a prepared handle
+ */
+static double f_pdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         if (x == INFINITY || x == -INFINITY) return 0.0;
         return NAN;
@@ -36,121 +61,178 @@ double f_pdf(double x, double* params, int param_count) {
         return 0.0;
     }
     
-    // Calculate PDF using log space for numerical stability
-    double half_nu1 = nu1 / 2.0;
-    double half_nu2 = nu2 / 2.0;
-    double half_sum = (nu1 + nu2) / 2.0;
-    
-    // Log of normalization constant
-    double log_norm = log_gamma_function(half_sum) - log_gamma_function(half_nu1) - log_gamma_function(half_nu2);
-    
-    // Log of (ν₁/ν₂)^(ν₁/2)
-    double log_ratio_power = half_nu1 * safe_log(nu1 / nu2);
-    
     // Log of x^(ν₁/2-1)
-    double log_x_power = (half_nu1 - 1.0) * safe_log(x);
+    double log_x_power = (prepared->constants[F_HALF_NU1] - 1.0) * safe_log(x);
     
     // Log of (1 + (ν₁/ν₂)x)^(-(ν₁+ν₂)/2)
-    double log_denominator = -half_sum * safe_log(1.0 + (nu1 / nu2) * x);
+    double log_denominator = -prepared->constants[F_HALF_SUM] * safe_log(1.0 + prepared->constants[F_RATIO] * x);
     
-    return safe_exp(log_norm + log_ratio_power + log_x_power + log_denominator);
+    return safe_exp(prepared->constants[F_LOG_NORM] + log_x_power + log_denominator);
 }
 
 /**
- * @brief F-distribution CDF calculation
- * Uses the relationship with the incomplete beta function
+ * @brief F-distribution CDF for a prepared handle
  */
-double f_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static double f_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
-    if (!f_validate_params(params, param_count)) {
-        return NAN;
+    // CDF is 0 for negative or zero x
+    if (x <= 0.0) {
+        return 0.0;
     }
     
-    double nu1 = params[0]; // numerator degrees of freedom
-    double nu2 = params[1]; // denominator degrees of freedom
+    // F(x) = I_z(ν₁/2, ν₂/2) where z = (ν₁x)/(ν₁x + ν₂)
+    double nu1_x = prepared->constants[F_NU1] * x;
+    double z = nu1_x / (nu1_x + prepared->constants[F_NU2]);
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
+    return incomplete_beta_evaluate(prepared->constants[F_HALF_NU1], prepared->constants[F_HALF_NU2], z,
+                                    prepared->constants[F_LOG_BETA], NULL, NULL);
+}
+
+/**
+ * @brief Single-precision F PDF for a prepared handle (the CDF stays in double)
+ */
+static float f_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
+        if (x == INFINITY || x == -INFINITY) return 0.0f;
         return NAN;
     }
     
-    // CDF is 0 for negative or zero x
+    if (x <= 0.0f) {
+        return 0.0f;
+    }
+    
+    float log_x_power = (prepared->constants_float[F_HALF_NU1] - 1.0f) * logf(x);
+    float log_denominator = -prepared->constants_float[F_HALF_SUM] * log1pf(prepared->constants_float[F_RATIO] * x);
+    
+    return expf(prepared->constants_float[F_LOG_NORM] + log_x_power + log_denominator);
+}
+
+/**
+ * @brief F CDF and survival function from one incomplete beta evaluation
+ */
+static double f_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
     if (x <= 0.0) {
+        *upper = 1.0;
         return 0.0;
     }
     
-    // Use the relationship with incomplete beta function
-    // F(x) = I_z(ν₁/2, ν₂/2) where z = (ν₁x)/(ν₁x + ν₂)
-    double z = (nu1 * x) / (nu1 * x + nu2);
+    double nu1_x = prepared->constants[F_NU1] * x;
+    double z = nu1_x / (nu1_x + prepared->constants[F_NU2]);
+    
+    return incomplete_beta_evaluate(prepared->constants[F_HALF_NU1], prepared->constants[F_HALF_NU2], z,
+                                    prepared->constants[F_LOG_BETA], NULL, upper);
+}
+
+/**
+ * @brief F-distribution log PDF for a prepared handle
+ */
+static double f_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x <= 0.0) {
+        return -INFINITY;
+    }
     
-    return incomplete_beta_regularized_f(nu1 / 2.0, nu2 / 2.0, z);
+    return prepared->constants[F_LOG_NORM] + (prepared->constants[F_HALF_NU1] - 1.0) * log(x) -
+           prepared->constants[F_HALF_SUM] * log1p(prepared->constants[F_RATIO] * x);
 }
 
 /**
- * @brief Regularized incomplete beta function I_x(a,b) for F-distribution
+ * @brief F log CDF and log survival function from one log-space incomplete beta evaluation
  */
-static double incomplete_beta_regularized_f(double a, double b, double x) {
-    if (x <= 0.0) return 0.0;
-    if (x >= 1.0) return 1.0;
-    if (a <= 0.0 || b <= 0.0) return NAN;
-    
-    // Use continued fraction expansion
-    double bt = safe_exp(log_gamma_function(a + b) - log_gamma_function(a) - log_gamma_function(b) + 
-                        a * safe_log(x) + b * safe_log(1.0 - x));
-    
-    if (x < (a + 1.0) / (a + b + 2.0)) {
-        // Use continued fraction directly
-        return bt * continued_fraction_beta_f(a, b, x) / a;
-    } else {
-        // Use symmetry relation
-        return 1.0 - bt * continued_fraction_beta_f(b, a, 1.0 - x) / b;
+static double f_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x <= 0.0) {
+        *log_upper = 0.0;
+        return -INFINITY;
     }
+    
+    double nu1_x = prepared->constants[F_NU1] * x;
+    double z = nu1_x / (nu1_x + prepared->constants[F_NU2]);
+    
+    return incomplete_beta_evaluate_log(prepared->constants[F_HALF_NU1], prepared->constants[F_HALF_NU2], z,
+                                        prepared->constants[F_LOG_BETA], NULL, log_upper);
 }
 
 /**
- * @brief Continued fraction for incomplete beta function for F-distribution
+ * @brief Validate parameters and cache the log normalization constant including (ν₁/ν₂)^(ν₁/2)
+ * and log(B(ν₁/2, ν₂/2)) for the CDF
  */
-static double continued_fraction_beta_f(double a, double b, double x) {
-    const int max_iter = 200;
-    const double eps = 1e-12;
-    
-    double qab = a + b;
-    double qap = a + 1.0;
-    double qam = a - 1.0;
-    double c = 1.0;
-    double d = 1.0 - qab * x / qap;
-    
-    if (fabs(d) < 1e-30) d = 1e-30;
-    d = 1.0 / d;
-    double h = d;
-    
-    for (int m = 1; m <= max_iter; m++) {
-        int m2 = 2 * m;
-        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
-        d = 1.0 + aa * d;
-        if (fabs(d) < 1e-30) d = 1e-30;
-        c = 1.0 + aa / c;
-        if (fabs(c) < 1e-30) c = 1e-30;
-        d = 1.0 / d;
-        h *= d * c;
-        
-        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
-        d = 1.0 + aa * d;
-        if (fabs(d) < 1e-30) d = 1e-30;
-        c = 1.0 + aa / c;
-        if (fabs(c) < 1e-30) c = 1e-30;
-        d = 1.0 / d;
-        double del = d * c;
-        h *= del;
-        
-        if (fabs(del - 1.0) < eps) break;
-    }
-    
-    return h;
+static int f_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!f_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    double nu1 = params[0]; // numerator degrees of freedom
+    double nu2 = params[1]; // denominator degrees of freedom
+    double half_nu1 = nu1 / 2.0;
+    double half_nu2 = nu2 / 2.0;
+    double half_sum = (nu1 + nu2) / 2.0;
+    
+    prepared->constants[F_NU1] = nu1;
+    prepared->constants[F_NU2] = nu2;
+    prepared->constants[F_HALF_NU1] = half_nu1;
+    prepared->constants[F_HALF_NU2] = half_nu2;
+    prepared->constants[F_HALF_SUM] = half_sum;
+    prepared->constants[F_RATIO] = nu1 / nu2;
+    prepared->constants[F_LOG_NORM] = log_gamma_function(half_sum) - log_gamma_function(half_nu1) - log_gamma_function(half_nu2) +
+                                      half_nu1 * safe_log(nu1 / nu2);
+    prepared->constants[F_LOG_BETA] = log_beta_function(half_nu1, half_nu2);
+    prepared->branch = 0;
+    prepared->pdf = f_pdf_prepared;
+    prepared->cdf = f_cdf_prepared;
+    prepared->tails = f_tails_prepared;
+    prepared->logpdf = f_logpdf_prepared;
+    prepared->log_tails = f_log_tails_prepared;
+    prepared->pdf_float = f_pdf_prepared_float;
+    
+    return 0;
+}
+
+/**
+ * @brief F-distribution batched PDF calculation
+ */
+int f_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (f_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = f_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief F-distribution batched CDF calculation
+ */
+int f_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (f_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = f_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -177,18 +259,24 @@ int f_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief F-distribution interface object, referenced directly by the registry table
+ */
+const distribution_t f_distribution_impl = {
+    .pdf = f_pdf,
+    .cdf = f_cdf,
+    .validate_params = f_validate_params,
+    .distribution_name = "F-distribution",
+    .param_count = 2,
+    .param_names = f_param_names,
+    .pdf_batch = f_pdf_batch,
+    .cdf_batch = f_cdf_batch,
+    .prepare = f_prepare
+};
+
 /**
  * @brief Get the F-distribution interface
  */
 const distribution_t* get_f_distribution(void) {
-    static const distribution_t f_dist = {
-        .pdf = f_pdf,
-        .cdf = f_cdf,
-        .validate_params = f_validate_params,
-        .distribution_name = "F-distribution",
-        .param_count = 2,
-        .param_names = f_param_names
-    };
-    
-    return &f_dist;
+    return &f_distribution_impl;
 }
\ No newline at end of file
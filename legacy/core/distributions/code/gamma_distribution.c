@@ -1,21 +1,34 @@
 #include "gamma_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
 static const char* gamma_param_names[] = {"shape", "scale"};
 
 double gamma_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (gamma_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!gamma_validate_params(params, param_count)) {
+    return result;
+}
+
+double gamma_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (gamma_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double shape = params[0];
-    double scale = params[1];
+    return result;
+}
+
+static double gamma_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double shape = prepared->constants[0];
+    double scale = prepared->constants[1];
     
     if (!is_finite_number(x) || x < 0) {
         return 0.0;
@@ -35,35 +48,126 @@ double gamma_pdf(double x, double* params, int param_count) {
     
     double term1 = (shape - 1) * log(x);
     double term2 = -x / scale;
-    double term3 = -shape * log(scale);
-    double term4 = -log_gamma(shape);
     
-    return safe_exp(term1 + term2 + term3 + term4);
+    return safe_exp(term1 + term2 + prepared->constants[2]);
 }
 
-double gamma_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static double gamma_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
+    if (x < 0) {
+        return 0.0;
+    }
+    
+    return incomplete_gamma_evaluate(prepared->constants[0], x / prepared->constants[1], prepared->constants[3], NULL, NULL);
+}
+
+static float gamma_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    float shape = prepared->constants_float[0];
+    
+    if (!isfinite(x) || x < 0.0f) {
+        return 0.0f;
+    }
+    
+    if (x == 0.0f) {
+        if (shape == 1.0f) return 1.0f / prepared->constants_float[1];
+        return (shape > 1.0f) ? 0.0f : INFINITY;
+    }
+    
+    return expf((shape - 1.0f) * logf(x) - x / prepared->constants_float[1] + prepared->constants_float[2]);
+}
+
+static double gamma_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    if (x < 0) {
+        *upper = 1.0;
+        return 0.0;
+    }
+    
+    return incomplete_gamma_evaluate(prepared->constants[0], x / prepared->constants[1], prepared->constants[3], NULL, upper);
+}
+
+static double gamma_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x <= 0) {
+        return log(gamma_pdf_prepared(prepared, x));
+    }
+    
+    return (prepared->constants[0] - 1) * log(x) - x / prepared->constants[1] + prepared->constants[2];
+}
+
+static double gamma_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x < 0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    return incomplete_gamma_evaluate_log(prepared->constants[0], x / prepared->constants[1], prepared->constants[3], NULL,
+                                         log_upper);
+}
+
+static int gamma_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
     if (!gamma_validate_params(params, param_count)) {
-        return NAN;
+        return -1;
     }
     
     double shape = params[0];
     double scale = params[1];
+    double log_gamma_shape = log_gamma_function(shape);
+    
+    prepared->constants[0] = shape;
+    prepared->constants[1] = scale;
+    prepared->constants[2] = -shape * log(scale) - log_gamma_shape;
+    prepared->constants[3] = log_gamma_shape;
+    prepared->branch = 0;
+    prepared->pdf = gamma_pdf_prepared;
+    prepared->cdf = gamma_cdf_prepared;
+    prepared->tails = gamma_tails_prepared;
+    prepared->logpdf = gamma_logpdf_prepared;
+    prepared->log_tails = gamma_log_tails_prepared;
+    prepared->pdf_float = gamma_pdf_prepared_float;
+    
+    return 0;
+}
+
+int gamma_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
-        return NAN;
+    if (!x || !out) {
+        return -1;
     }
     
-    if (x < 0) {
-        return 0.0;
+    if (gamma_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = gamma_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+int gamma_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (gamma_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = gamma_cdf_prepared(&prepared, x[i]);
     }
     
-    return lower_incomplete_gamma(shape, x / scale);
+    return 0;
 }
 
 int gamma_validate_params(double* params, int param_count) {
@@ -85,15 +189,18 @@ int gamma_validate_params(double* params, int param_count) {
     return 1;
 }
 
+const distribution_t gamma_distribution_impl = {
+    .pdf = gamma_pdf,
+    .cdf = gamma_cdf,
+    .validate_params = gamma_validate_params,
+    .distribution_name = "Gamma",
+    .param_count = 2,
+    .param_names = gamma_param_names,
+    .pdf_batch = gamma_pdf_batch,
+    .cdf_batch = gamma_cdf_batch,
+    .prepare = gamma_prepare
+};
+
 const distribution_t* get_gamma_distribution(void) {
-    static const distribution_t gamma_dist = {
-        .pdf = gamma_pdf,
-        .cdf = gamma_cdf,
-        .validate_params = gamma_validate_params,
-        .distribution_name = "Gamma",
-        .param_count = 2,
-        .param_names = gamma_param_names
-    };
-    
-    return &gamma_dist;
+    return &gamma_distribution_impl;
 }
\ No newline at end of file
@@ -12,16 +12,40 @@ static const char* geometric_param_names[] = {"p"};
  * Note: Using the "number of trials until first success" definition
  */
 double geometric_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+    double result;
+    
+    if (geometric_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!geometric_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Geometric distribution CDF calculation
+ * Formula: P(X ≤ k) = 1 - (1-p)^k for k = 1, 2, 3, ...
+ */
+double geometric_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (geometric_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double p = params[0]; // probability of success
-    
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    GEOMETRIC_P = 0,
+    GEOMETRIC_LOG_P = 1,
+    GEOMETRIC_LOG_Q = 2
+};
+
+/**
+ * @brief Geometric distribution PDF for a prepared handle
+ */
+static double geometric_pdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         return NAN;
     }
@@ -34,32 +58,18 @@ double geometric_pdf(double x, double* params, int param_count) {
     int k = (int)x;
     
     // Handle edge cases
-    if (p == 1.0) {
+    if (prepared->constants[GEOMETRIC_P] == 1.0) {
         return (k == 1) ? 1.0 : 0.0;
     }
     
-    // Calculate PDF: (1-p)^(k-1) * p
-    // Use log space for numerical stability with large k
-    double log_prob = (k - 1) * safe_log(1.0 - p) + safe_log(p);
-    
-    return safe_exp(log_prob);
+    // Calculate PDF: (1-p)^(k-1) * p in log space
+    return safe_exp((k - 1) * prepared->constants[GEOMETRIC_LOG_Q] + prepared->constants[GEOMETRIC_LOG_P]);
 }
 
 /**
- * @brief Geometric distribution CDF calculation
- * Formula: P(X ≤ k) = 1 - (1-p)^k for k = 1, 2, 3, ...
+ * @brief Geometric distribution CDF for a prepared handle
  */
-double geometric_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
-        return NAN;
-    }
-    
-    if (!geometric_validate_params(params, param_count)) {
-        return NAN;
-    }
-    
-    double p = params[0]; // probability of success
-    
+static double geometric_cdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         if (x == -INFINITY) return 0.0;
         if (x == INFINITY) return 1.0;
@@ -71,19 +81,134 @@ double geometric_cdf(double x, double* params, int param_count) {
         return 0.0;
     }
     
-    // For discrete distribution, use floor of x
+    // Handle edge case
+    if (prepared->constants[GEOMETRIC_P] == 1.0) {
+        return 1.0;
+    }
+    
+    // Calculate CDF: 1 - (1-p)^k for k = floor(x)
     int k = (int)floor(x);
     
-    // Handle edge case
-    if (p == 1.0) {
+    return 1.0 - safe_exp(k * prepared->constants[GEOMETRIC_LOG_Q]);
+}
+
+/**
+ * @brief Geometric CDF and survival function (1-p)^k for a prepared handle
+ */
+static double geometric_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    if (x < 1.0) {
+        *upper = 1.0;
+        return 0.0;
+    }
+    
+    if (prepared->constants[GEOMETRIC_P] == 1.0) {
+        *upper = 0.0;
         return 1.0;
     }
     
-    // Calculate CDF: 1 - (1-p)^k
-    // Use log space for numerical stability with large k
-    double log_complement = k * safe_log(1.0 - p);
+    int k = (int)floor(x);
+    *upper = safe_exp(k * prepared->constants[GEOMETRIC_LOG_Q]);
+    return 1.0 - *upper;
+}
+
+/**
+ * @brief Geometric log PMF (k-1) log(1-p) + log(p) for a prepared handle
+ */
+static double geometric_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x < 1.0 || floor(x) != x) {
+        return -INFINITY;
+    }
+    
+    if (prepared->constants[GEOMETRIC_P] == 1.0) {
+        return (x == 1.0) ? 0.0 : -INFINITY;
+    }
     
-    return 1.0 - safe_exp(log_complement);
+    return (x - 1.0) * prepared->constants[GEOMETRIC_LOG_Q] + prepared->constants[GEOMETRIC_LOG_P];
+}
+
+/**
+ * @brief Geometric log CDF and log survival function k log(1-p) for a prepared handle
+ */
+static double geometric_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x < 1.0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    if (prepared->constants[GEOMETRIC_P] == 1.0) {
+        *log_upper = -INFINITY;
+        return 0.0;
+    }
+    
+    *log_upper = floor(x) * prepared->constants[GEOMETRIC_LOG_Q];
+    return log_one_minus_exp(*log_upper);
+}
+
+/**
+ * @brief Validate parameters and cache log(p) and log(1-p)
+ */
+static int geometric_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!geometric_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    double p = params[0]; // probability of success
+    
+    prepared->constants[GEOMETRIC_P] = p;
+    prepared->constants[GEOMETRIC_LOG_P] = safe_log(p);
+    prepared->constants[GEOMETRIC_LOG_Q] = (p < 1.0) ? safe_log(1.0 - p) : 0.0;
+    prepared->branch = 0;
+    prepared->pdf = geometric_pdf_prepared;
+    prepared->cdf = geometric_cdf_prepared;
+    prepared->tails = geometric_tails_prepared;
+    prepared->logpdf = geometric_logpdf_prepared;
+    prepared->log_tails = geometric_log_tails_prepared;
+    
+    return 0;
+}
+
+/**
+ * @brief Geometric distribution batched PDF calculation
+ */
+int geometric_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (geometric_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = geometric_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Geometric distribution batched CDF calculation
+ */
+int geometric_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (geometric_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = geometric_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -105,18 +230,24 @@ int geometric_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Geometric distribution interface object, referenced directly by the registry table
+ */
+const distribution_t geometric_distribution_impl = {
+    .pdf = geometric_pdf,
+    .cdf = geometric_cdf,
+    .validate_params = geometric_validate_params,
+    .distribution_name = "Geometric",
+    .param_count = 1,
+    .param_names = geometric_param_names,
+    .pdf_batch = geometric_pdf_batch,
+    .cdf_batch = geometric_cdf_batch,
+    .prepare = geometric_prepare
+};
+
 /**
  * @brief Get the Geometric distribution interface
  */
 const distribution_t* get_geometric_distribution(void) {
-    static const distribution_t geometric_dist = {
-        .pdf = geometric_pdf,
-        .cdf = geometric_cdf,
-        .validate_params = geometric_validate_params,
-        .distribution_name = "Geometric",
-        .param_count = 1,
-        .param_names = geometric_param_names
-    };
-    
-    return &geometric_dist;
+    return &geometric_distribution_impl;
 }
\ No newline at end of file
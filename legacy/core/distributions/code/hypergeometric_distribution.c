@@ -1,5 +1,7 @@
 #include "hypergeometric_distribution.h"
 #include "../math/math_utils.h"
+#include "../../../../src/common/cache/trace.h"
+#include <float.h>
 #include <math.h>
 #include <stddef.h>
 
@@ -9,6 +11,10 @@ static const char* hypergeometric_param_names[] = {"N", "K", "n"};
 // Forward declarations for helper functions
 static int min_int(int a, int b);
 static int max_int(int a, int b);
+static double hypergeometric_log_mass(int N, int K, int n, int k, double log_total);
+static double hypergeometric_mass(int N, int K, int n, int k, double log_total);
+static double hypergeometric_scaled_sum(const distribution_prepared_t* prepared, int k_lo, int k_hi, double* log_seed_mass);
+static double hypergeometric_sum(const distribution_prepared_t* prepared, int k_lo, int k_hi);
 
 /**
  * @brief Hypergeometric distribution PDF calculation
@@ -16,18 +22,44 @@ static int max_int(int a, int b);
  * where C(n,k) is the binomial coefficient "n choose k"
  */
 double hypergeometric_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 3) {
+    double result;
+    
+    if (hypergeometric_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!hypergeometric_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Hypergeometric distribution CDF calculation
+ * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i)
+ */
+double hypergeometric_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (hypergeometric_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    int N = (int)params[0]; // population size
-    int K = (int)params[1]; // number of success states in population
-    int n = (int)params[2]; // sample size
-    
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    HYPERGEOMETRIC_N = 0,
+    HYPERGEOMETRIC_K = 1,
+    HYPERGEOMETRIC_SAMPLE = 2,
+    HYPERGEOMETRIC_K_MIN = 3,
+    HYPERGEOMETRIC_K_MAX = 4,
+    HYPERGEOMETRIC_LOG_TOTAL = 5,
+    HYPERGEOMETRIC_MODE = 6
+};
+
+/**
+ * @brief Hypergeometric distribution PDF for a prepared handle
+ */
+static double hypergeometric_pdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         return NAN;
     }
@@ -40,38 +72,22 @@ double hypergeometric_pdf(double x, double* params, int param_count) {
     int k = (int)x; // number of successes in sample
     
     // Check if k is within valid range
-    int k_min = max_int(0, n - (N - K));
-    int k_max = min_int(n, K);
-    
-    if (k < k_min || k > k_max) {
+    if (k < (int)prepared->constants[HYPERGEOMETRIC_K_MIN] || k > (int)prepared->constants[HYPERGEOMETRIC_K_MAX]) {
         return 0.0;
     }
     
-    // Calculate PDF using log space for numerical stability
-    // log(P(X = k)) = log(C(K,k)) + log(C(N-K,n-k)) - log(C(N,n))
-    double log_prob = log_combination(K, k) + 
-                      log_combination(N - K, n - k) - 
-                      log_combination(N, n);
-    
-    return safe_exp(log_prob);
+    return hypergeometric_mass((int)prepared->constants[HYPERGEOMETRIC_N],
+                               (int)prepared->constants[HYPERGEOMETRIC_K],
+                               (int)prepared->constants[HYPERGEOMETRIC_SAMPLE],
+                               k, prepared->constants[HYPERGEOMETRIC_LOG_TOTAL]);
 }
 
 /**
- * @brief Hypergeometric distribution CDF calculation
- * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i)
+ * @brief Hypergeometric distribution CDF for a prepared handle
  */
-double hypergeometric_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 3) {
-        return NAN;
-    }
-    
-    if (!hypergeometric_validate_params(params, param_count)) {
-        return NAN;
-    }
-    
-    int N = (int)params[0]; // population size
-    int K = (int)params[1]; // number of success states in population
-    int n = (int)params[2]; // sample size
+static double hypergeometric_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    int k_min = (int)prepared->constants[HYPERGEOMETRIC_K_MIN];
+    int k_max = (int)prepared->constants[HYPERGEOMETRIC_K_MAX];
     
     if (!is_finite_number(x)) {
         if (x == -INFINITY) return 0.0;
@@ -82,27 +98,174 @@ double hypergeometric_cdf(double x, double* params, int param_count) {
     // For discrete distribution, use floor of x
     int k = (int)floor(x);
     
-    // Determine valid range
-    int k_min = max_int(0, n - (N - K));
-    int k_max = min_int(n, K);
+    // CDF is 0 for k < k_min and 1 for k >= k_max
+    if (k < k_min) {
+        return 0.0;
+    }
+    
+    if (k >= k_max) {
+        return 1.0;
+    }
+    
+    // The side of the mode k is on is the shorter sum, and the one that keeps precision
+    if (k < (int)prepared->constants[HYPERGEOMETRIC_MODE]) {
+        return hypergeometric_sum(prepared, k_min, k);
+    }
+    return 1.0 - hypergeometric_sum(prepared, k + 1, k_max);
+}
+
+/**
+ * @brief Hypergeometric CDF and survival function for a prepared handle
+ * Sums whichever side of the mean nK/N k falls beyond, as binomial does, so
+ * the tail that is returned directly keeps full relative precision.
+ */
+static double hypergeometric_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    int N = (int)prepared->constants[HYPERGEOMETRIC_N];
+    int K = (int)prepared->constants[HYPERGEOMETRIC_K];
+    int n = (int)prepared->constants[HYPERGEOMETRIC_SAMPLE];
+    int k_min = (int)prepared->constants[HYPERGEOMETRIC_K_MIN];
+    int k_max = (int)prepared->constants[HYPERGEOMETRIC_K_MAX];
+    int k = (int)floor(x);
     
-    // CDF is 0 for k < k_min
     if (k < k_min) {
+        *upper = 1.0;
         return 0.0;
     }
     
-    // CDF is 1 for k >= k_max
     if (k >= k_max) {
+        *upper = 0.0;
         return 1.0;
     }
     
-    // Sum PDF values from k_min to k
-    double cdf = 0.0;
-    for (int i = k_min; i <= k; i++) {
-        cdf += hypergeometric_pdf((double)i, params, param_count);
+    if (k < (double)n * K / N) {
+        double lower = hypergeometric_sum(prepared, k_min, k);
+        *upper = 1.0 - lower;
+        return lower;
+    }
+    
+    double tail = hypergeometric_sum(prepared, k + 1, k_max);
+    *upper = tail;
+    return 1.0 - tail;
+}
+
+/**
+ * @brief Hypergeometric log PMF for a prepared handle
+ */
+static double hypergeometric_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x < prepared->constants[HYPERGEOMETRIC_K_MIN] || x > prepared->constants[HYPERGEOMETRIC_K_MAX] || floor(x) != x) {
+        return -INFINITY;
+    }
+    
+    return hypergeometric_log_mass((int)prepared->constants[HYPERGEOMETRIC_N],
+                                   (int)prepared->constants[HYPERGEOMETRIC_K],
+                                   (int)prepared->constants[HYPERGEOMETRIC_SAMPLE],
+                                   (int)x, prepared->constants[HYPERGEOMETRIC_LOG_TOTAL]);
+}
+
+/**
+ * @brief Hypergeometric log CDF and log survival function for a prepared handle
+ * The same tail sums as the linear kernel, with the seed mass kept in log space.
+ */
+static double hypergeometric_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    int k_min = (int)prepared->constants[HYPERGEOMETRIC_K_MIN];
+    int k_max = (int)prepared->constants[HYPERGEOMETRIC_K_MAX];
+    int k = (int)floor(x);
+    double log_seed_mass;
+    
+    if (k < k_min) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    if (k >= k_max) {
+        *log_upper = -INFINITY;
+        return 0.0;
+    }
+    
+    // The side of the mode k is on is the shorter sum, and the one that keeps precision
+    if (k < (int)prepared->constants[HYPERGEOMETRIC_MODE]) {
+        double sum = hypergeometric_scaled_sum(prepared, k_min, k, &log_seed_mass);
+        double log_lower = fmin(log_seed_mass + log(sum), 0.0);
+        *log_upper = log_one_minus_exp(log_lower);
+        return log_lower;
+    }
+    
+    double tail = hypergeometric_scaled_sum(prepared, k + 1, k_max, &log_seed_mass);
+    *log_upper = fmin(log_seed_mass + log(tail), 0.0);
+    return log_one_minus_exp(*log_upper);
+}
+
+/**
+ * @brief Validate parameters and cache the support bounds and log(C(N,n))
+ */
+static int hypergeometric_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!hypergeometric_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    int N = (int)params[0]; // population size
+    int K = (int)params[1]; // number of success states in population
+    int n = (int)params[2]; // sample size
+    
+    prepared->constants[HYPERGEOMETRIC_N] = N;
+    prepared->constants[HYPERGEOMETRIC_K] = K;
+    prepared->constants[HYPERGEOMETRIC_SAMPLE] = n;
+    prepared->constants[HYPERGEOMETRIC_K_MIN] = max_int(0, n - (N - K));
+    prepared->constants[HYPERGEOMETRIC_K_MAX] = min_int(n, K);
+    prepared->constants[HYPERGEOMETRIC_LOG_TOTAL] = log_combination(N, n);
+    prepared->constants[HYPERGEOMETRIC_MODE] = floor((n + 1.0) * (K + 1.0) / (N + 2.0));
+    prepared->branch = 0;
+    prepared->pdf = hypergeometric_pdf_prepared;
+    prepared->cdf = hypergeometric_cdf_prepared;
+    prepared->tails = hypergeometric_tails_prepared;
+    prepared->logpdf = hypergeometric_logpdf_prepared;
+    prepared->log_tails = hypergeometric_log_tails_prepared;
+    
+    return 0;
+}
+
+/**
+ * @brief Hypergeometric distribution batched PDF calculation
+ */
+int hypergeometric_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (hypergeometric_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = hypergeometric_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Hypergeometric distribution batched CDF calculation
+ */
+int hypergeometric_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (hypergeometric_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = hypergeometric_cdf_prepared(&prepared, x[i]);
     }
     
-    return cdf;
+    return 0;
 }
 
 /**
@@ -153,20 +316,26 @@ int hypergeometric_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Hypergeometric distribution interface object, referenced directly by the registry table
+ */
+const distribution_t hypergeometric_distribution_impl = {
+    .pdf = hypergeometric_pdf,
+    .cdf = hypergeometric_cdf,
+    .validate_params = hypergeometric_validate_params,
+    .distribution_name = "Hypergeometric",
+    .param_count = 3,
+    .param_names = hypergeometric_param_names,
+    .pdf_batch = hypergeometric_pdf_batch,
+    .cdf_batch = hypergeometric_cdf_batch,
+    .prepare = hypergeometric_prepare
+};
+
 /**
  * @brief Get the Hypergeometric distribution interface
  */
 const distribution_t* get_hypergeometric_distribution(void) {
-    static const distribution_t hypergeometric_dist = {
-        .pdf = hypergeometric_pdf,
-        .cdf = hypergeometric_cdf,
-        .validate_params = hypergeometric_validate_params,
-        .distribution_name = "Hypergeometric",
-        .param_count = 3,
-        .param_names = hypergeometric_param_names
-    };
-    
-    return &hypergeometric_dist;
+    return &hypergeometric_distribution_impl;
 }
 
 
@@ -183,4 +352,70 @@ static int min_int(int a, int b) {
  */
 static int max_int(int a, int b) {
     return (a > b) ? a : b;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Hypergeometric log probability mass for k inside the support
+ * log(P(X = k)) = log(C(K,k)) + log(C(N-K,n-k)) - log(C(N,n))
+ */
+static double hypergeometric_log_mass(int N, int K, int n, int k, double log_total) {
+    return log_combination(K, k) + log_combination(N - K, n - k) - log_total;
+}
+
+/**
+ * @brief Hypergeometric probability mass for k inside the support
+ */
+static double hypergeometric_mass(int N, int K, int n, int k, double log_total) {
+    return safe_exp(hypergeometric_log_mass(N, K, n, k, log_total));
+}
+
+/**
+ * @brief P(k_lo <= X <= k_hi) / P(X = seed) for a range inside the support
+ * One log-space mass at the point of the range nearest the mode seeds the
+ * term ratio P(k+1)/P(k) = (K-k)(n-k) / ((k+1)(N-K-n+k+1)), which is walked
+ * outward in both directions. Terms only shrink away from the mode, so each
+ * walk stops once a term no longer moves the sum; a tail far from the mode
+ * costs a handful of multiplies instead of three log-combinations per term.
+ * The sum is relative to the seed mass, whose log goes to *log_seed_mass,
+ * so the log-space callers never see it underflow.
+ */
+static double hypergeometric_scaled_sum(const distribution_prepared_t* prepared, int k_lo, int k_hi, double* log_seed_mass) {
+    int N = (int)prepared->constants[HYPERGEOMETRIC_N];
+    int K = (int)prepared->constants[HYPERGEOMETRIC_K];
+    int n = (int)prepared->constants[HYPERGEOMETRIC_SAMPLE];
+    int seed = (int)prepared->constants[HYPERGEOMETRIC_MODE];
+    int terms = 1;
+    
+    seed = max_int(k_lo, min_int(seed, k_hi));
+    *log_seed_mass = hypergeometric_log_mass(N, K, n, seed, prepared->constants[HYPERGEOMETRIC_LOG_TOTAL]);
+    double sum = 1.0;
+    
+    double term = 1.0;
+    for (int i = seed; i < k_hi && term > sum * DBL_EPSILON; i++, terms++) {
+        term *= (double)(K - i) * (double)(n - i) / ((i + 1.0) * ((double)(N - K - n) + i + 1.0));
+        sum += term;
+    }
+    
+    term = 1.0;
+    for (int i = seed; i > k_lo && term > sum * DBL_EPSILON; i--, terms++) {
+        term *= (double)i * ((double)(N - K - n) + i) / ((double)(K - i + 1) * (double)(n - i + 1));
+        sum += term;
+    }
+    CACHE_TRACE_COUNT(CACHE_TRACE_COUNTER_PMF_TERMS, terms);
+    
+    return sum;
+}
+
+/**
+ * @brief P(k_lo <= X <= k_hi) for a range inside the support
+ */
+static double hypergeometric_sum(const distribution_prepared_t* prepared, int k_lo, int k_hi) {
+    double log_seed_mass;
+    
+    if (k_lo > k_hi) {
+        return 0.0;
+    }
+    
+    double sum = hypergeometric_scaled_sum(prepared, k_lo, k_hi, &log_seed_mass);
+    return safe_exp(log_seed_mass) * sum;
+}
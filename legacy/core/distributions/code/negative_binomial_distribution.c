@@ -1,5 +1,6 @@
 #include "negative_binomial_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
@@ -13,16 +14,47 @@ static const char* negative_binomial_param_names[] = {"r", "p"};
  * Alternative formula: P(X = k) = C(k+r-1, r-1) * p^r * (1-p)^k
  */
 double negative_binomial_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (negative_binomial_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!negative_binomial_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Negative Binomial distribution CDF calculation
+ * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i) = I_p(r, k+1)
+ * Evaluated through the regularized incomplete beta function
+ */
+double negative_binomial_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (negative_binomial_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    int r = (int)params[0]; // number of successes
-    double p = params[1];   // probability of success
+    return result;
+}
+
+// Upper bound on the extra iterations granted for a very small p
+#define NEGATIVE_BINOMIAL_ITERATION_LIMIT 1000000.0
+
+// Prepared constant slots
+enum {
+    NEGATIVE_BINOMIAL_R = 0,
+    NEGATIVE_BINOMIAL_P = 1,
+    NEGATIVE_BINOMIAL_LOG_P_R = 2,
+    NEGATIVE_BINOMIAL_LOG_Q = 3,
+    NEGATIVE_BINOMIAL_MAX_ITERATIONS = 4
+};
+
+/**
+ * @brief Negative Binomial distribution PDF for a prepared handle
+ */
+static double negative_binomial_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    int r = (int)prepared->constants[NEGATIVE_BINOMIAL_R];
     
     if (!is_finite_number(x)) {
         return NAN;
@@ -35,77 +67,190 @@ double negative_binomial_pdf(double x, double* params, int param_count) {
     
     int k = (int)x; // number of failures
     
-    // Handle edge cases
-    if (p == 1.0) {
-        return (k == 0) ? 1.0 : 0.0; // If p=1, we succeed immediately, so k=0
+    // If p=1, we succeed immediately, so k=0
+    if (prepared->constants[NEGATIVE_BINOMIAL_P] == 1.0) {
+        return (k == 0) ? 1.0 : 0.0;
     }
     
-    // Calculate PDF using log space for numerical stability
     // log(P(X = k)) = log(C(k+r-1, k)) + r*log(p) + k*log(1-p)
-    // Using C(k+r-1, k) = C(k+r-1, r-1)
-    double log_prob = log_combination(k + r - 1, k) + 
-                      r * safe_log(p) + 
-                      k * safe_log(1.0 - p);
+    return safe_exp(log_combination(k + r - 1, k) + prepared->constants[NEGATIVE_BINOMIAL_LOG_P_R] +
+                    k * prepared->constants[NEGATIVE_BINOMIAL_LOG_Q]);
+}
+
+/**
+ * @brief P(X <= k) = I_p(r, k+1) and P(X > k) for k >= 0 and 0 < p < 1
+ * Both tails come from the one incomplete beta evaluation, each without
+ * cancellation.
+ */
+static double negative_binomial_beta_tails(const distribution_prepared_t* prepared, int k, double* upper) {
+    int r = (int)prepared->constants[NEGATIVE_BINOMIAL_R];
+    special_workspace_t ws;
     
-    return safe_exp(log_prob);
+    special_workspace_init(&ws);
+    ws.max_iterations = (int)prepared->constants[NEGATIVE_BINOMIAL_MAX_ITERATIONS];
+    
+    // log(B(r, k+1)) = log((r-1)!) + log(k!) - log((r+k)!)
+    double log_beta = log_factorial(r - 1) + log_factorial(k) - log_factorial(r + k);
+    
+    return incomplete_beta_evaluate((double)r, k + 1.0, prepared->constants[NEGATIVE_BINOMIAL_P], log_beta, &ws, upper);
 }
 
 /**
- * @brief Negative Binomial distribution CDF calculation
- * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i)
- * Can also be expressed using the incomplete beta function
+ * @brief Negative Binomial distribution CDF for a prepared handle
  */
-double negative_binomial_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static double negative_binomial_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
+    // CDF is 0 for k < 0
+    if (x < 0.0) {
+        return 0.0;
+    }
+    
+    // All probability is at k=0 when p=1
+    if (prepared->constants[NEGATIVE_BINOMIAL_P] == 1.0) {
+        return 1.0;
+    }
+    
+    // For discrete distribution, use floor of x
+    return negative_binomial_beta_tails(prepared, (int)floor(x), NULL);
+}
+
+/**
+ * @brief Negative Binomial CDF and survival function for a prepared handle
+ */
+static double negative_binomial_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    if (x < 0.0) {
+        *upper = 1.0;
+        return 0.0;
+    }
+    
+    if (x == INFINITY || prepared->constants[NEGATIVE_BINOMIAL_P] == 1.0) {
+        *upper = 0.0;
+        return 1.0;
+    }
+    
+    return negative_binomial_beta_tails(prepared, (int)floor(x), upper);
+}
+
+/**
+ * @brief Negative Binomial log PMF for a prepared handle
+ */
+static double negative_binomial_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    int r = (int)prepared->constants[NEGATIVE_BINOMIAL_R];
+    
+    if (x < 0.0 || floor(x) != x || prepared->constants[NEGATIVE_BINOMIAL_P] == 1.0) {
+        return log(negative_binomial_pdf_prepared(prepared, x));
+    }
+    
+    int k = (int)x;
+    
+    return log_combination(k + r - 1, k) + prepared->constants[NEGATIVE_BINOMIAL_LOG_P_R] +
+           k * prepared->constants[NEGATIVE_BINOMIAL_LOG_Q];
+}
+
+/**
+ * @brief Negative Binomial log CDF and log survival function from one log-space incomplete beta evaluation
+ */
+static double negative_binomial_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x < 0.0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    if (prepared->constants[NEGATIVE_BINOMIAL_P] == 1.0) {
+        *log_upper = -INFINITY;
+        return 0.0;
+    }
+    
+    int r = (int)prepared->constants[NEGATIVE_BINOMIAL_R];
+    int k = (int)floor(x);
+    special_workspace_t ws;
+    
+    special_workspace_init(&ws);
+    ws.max_iterations = (int)prepared->constants[NEGATIVE_BINOMIAL_MAX_ITERATIONS];
+    
+    double log_beta = log_factorial(r - 1) + log_factorial(k) - log_factorial(r + k);
+    
+    return incomplete_beta_evaluate_log((double)r, k + 1.0, prepared->constants[NEGATIVE_BINOMIAL_P], log_beta, &ws,
+                                        log_upper);
+}
+
+/**
+ * @brief Validate parameters and cache r*log(p), log(1-p) and the continued-fraction iteration cap
+ */
+static int negative_binomial_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
     if (!negative_binomial_validate_params(params, param_count)) {
-        return NAN;
+        return -1;
     }
     
     int r = (int)params[0]; // number of successes
     double p = params[1];   // probability of success
+    double log_p_r = r * safe_log(p);
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
-        return NAN;
+    prepared->constants[NEGATIVE_BINOMIAL_R] = r;
+    prepared->constants[NEGATIVE_BINOMIAL_P] = p;
+    prepared->constants[NEGATIVE_BINOMIAL_LOG_P_R] = log_p_r;
+    prepared->constants[NEGATIVE_BINOMIAL_LOG_Q] = (p < 1.0) ? safe_log(1.0 - p) : 0.0;
+    
+    // The continued fraction needs on the order of one iteration per standard deviation
+    prepared->constants[NEGATIVE_BINOMIAL_MAX_ITERATIONS] = SPECIAL_DEFAULT_MAX_ITERATIONS +
+        fmin(ceil(2.0 * sqrt(r * (1.0 - p)) / p), NEGATIVE_BINOMIAL_ITERATION_LIMIT);
+    prepared->branch = 0;
+    prepared->pdf = negative_binomial_pdf_prepared;
+    prepared->cdf = negative_binomial_cdf_prepared;
+    prepared->tails = negative_binomial_tails_prepared;
+    prepared->logpdf = negative_binomial_logpdf_prepared;
+    prepared->log_tails = negative_binomial_log_tails_prepared;
+    
+    return 0;
+}
+
+/**
+ * @brief Negative Binomial distribution batched PDF calculation
+ */
+int negative_binomial_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
     }
     
-    // For discrete distribution, use floor of x
-    int k = (int)floor(x);
+    if (negative_binomial_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
     
-    // CDF is 0 for k < 0
-    if (k < 0) {
-        return 0.0;
+    for (size_t i = 0; i < count; i++) {
+        out[i] = negative_binomial_pdf_prepared(&prepared, x[i]);
     }
     
-    // Handle edge case
-    if (p == 1.0) {
-        return 1.0; // All probability is at k=0
+    return 0;
+}
+
+/**
+ * @brief Negative Binomial distribution batched CDF calculation
+ */
+int negative_binomial_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
     }
     
-    // For reasonable values of k, use direct summation
-    // For very large k, the tail probability becomes negligible
-    double cdf = 0.0;
-    double current_pdf = negative_binomial_pdf(0.0, params, param_count);
-    cdf += current_pdf;
+    if (negative_binomial_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
     
-    // Sum PDF values from 0 to k
-    for (int i = 1; i <= k; i++) {
-        // Use recurrence relation for efficiency:
-        // P(X = i) = P(X = i-1) * (i + r - 1) * (1-p) / i
-        current_pdf *= ((double)(i + r - 1) * (1.0 - p)) / (double)i;
-        cdf += current_pdf;
-        
-        // Early termination if PDF becomes negligible
-        if (current_pdf < 1e-15) {
-            break;
-        }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = negative_binomial_cdf_prepared(&prepared, x[i]);
     }
     
-    return cdf;
+    return 0;
 }
 
 /**
@@ -139,18 +284,24 @@ int negative_binomial_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Negative Binomial distribution interface object, referenced directly by the registry table
+ */
+const distribution_t negative_binomial_distribution_impl = {
+    .pdf = negative_binomial_pdf,
+    .cdf = negative_binomial_cdf,
+    .validate_params = negative_binomial_validate_params,
+    .distribution_name = "Negative Binomial",
+    .param_count = 2,
+    .param_names = negative_binomial_param_names,
+    .pdf_batch = negative_binomial_pdf_batch,
+    .cdf_batch = negative_binomial_cdf_batch,
+    .prepare = negative_binomial_prepare
+};
+
 /**
  * @brief Get the Negative Binomial distribution interface
  */
 const distribution_t* get_negative_binomial_distribution(void) {
-    static const distribution_t negative_binomial_dist = {
-        .pdf = negative_binomial_pdf,
-        .cdf = negative_binomial_cdf,
-        .validate_params = negative_binomial_validate_params,
-        .distribution_name = "Negative Binomial",
-        .param_count = 2,
-        .param_names = negative_binomial_param_names
-    };
-    
-    return &negative_binomial_dist;
+    return &negative_binomial_distribution_impl;
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "normal_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/vector_math.h"
 #include <math.h>
 #include <stddef.h>
 
@@ -11,58 +12,211 @@ static const char* normal_param_names[] = {"mean", "standard_deviation"};
  * Formula: f(x) = (1/(σ√(2π))) * exp(-0.5 * ((x-μ)/σ)²)
  */
 double normal_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (normal_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!normal_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Normal distribution CDF calculation
+ * Formula: F(x) = 0.5 * erfc(-(x-μ)/(σ√2))
+ */
+double normal_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (normal_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double mean = params[0];
-    double std_dev = params[1];
-    
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    NORMAL_MEAN = 0,
+    NORMAL_INV_STD_DEV = 1,
+    NORMAL_PDF_COEFFICIENT = 2,
+    NORMAL_CDF_SCALE = 3,
+    NORMAL_LOG_PDF_COEFFICIENT = 4
+};
+
+/**
+ * @brief Normal distribution PDF for a prepared handle
+ */
+static double normal_pdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         return NAN;
     }
     
     // Calculate standardized value
-    double z = (x - mean) / std_dev;
+    double z = (x - prepared->constants[NORMAL_MEAN]) * prepared->constants[NORMAL_INV_STD_DEV];
     
-    // Calculate PDF: (1/(σ√(2π))) * exp(-0.5 * z²)
-    double coefficient = 1.0 / (std_dev * M_SQRT_2PI);
-    double exponent = -0.5 * z * z;
+    return prepared->constants[NORMAL_PDF_COEFFICIENT] * safe_exp(-0.5 * z * z);
+}
+
+/**
+ * @brief Normal distribution CDF for a prepared handle
+ */
+static double normal_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
+        return NAN;
+    }
+    
+    // Calculate CDF: 0.5 * erfc(-(x-μ)/(σ√2)), which keeps the lower tail's relative precision
+    double z = (x - prepared->constants[NORMAL_MEAN]) * prepared->constants[NORMAL_CDF_SCALE];
     
-    return coefficient * safe_exp(exponent);
+    return 0.5 * complementary_error_function(-z);
 }
 
 /**
- * @brief Normal distribution CDF calculation
- * Formula: F(x) = 0.5 * (1 + erf((x-μ)/(σ√2)))
+ * @brief Single-precision Normal PDF for a prepared handle
  */
-double normal_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static float normal_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
         return NAN;
     }
     
-    if (!normal_validate_params(params, param_count)) {
+    float z = (x - prepared->constants_float[NORMAL_MEAN]) * prepared->constants_float[NORMAL_INV_STD_DEV];
+    
+    return prepared->constants_float[NORMAL_PDF_COEFFICIENT] * expf(-0.5f * z * z);
+}
+
+/**
+ * @brief Single-precision Normal CDF for a prepared handle
+ */
+static float normal_cdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
+        if (x == -INFINITY) return 0.0f;
+        if (x == INFINITY) return 1.0f;
         return NAN;
     }
     
-    double mean = params[0];
+    float z = (x - prepared->constants_float[NORMAL_MEAN]) * prepared->constants_float[NORMAL_CDF_SCALE];
+    
+    return 0.5f * erfcf(-z);
+}
+
+/**
+ * @brief Normal CDF and survival function for a prepared handle, both through erfc
+ */
+static double normal_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    double z = (x - prepared->constants[NORMAL_MEAN]) * prepared->constants[NORMAL_CDF_SCALE];
+    
+    *upper = 0.5 * complementary_error_function(z);
+    return 0.5 * complementary_error_function(-z);
+}
+
+/**
+ * @brief Normal log PDF -z²/2 - log(σ√(2π)) for a prepared handle
+ */
+static double normal_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double z = (x - prepared->constants[NORMAL_MEAN]) * prepared->constants[NORMAL_INV_STD_DEV];
+    
+    return prepared->constants[NORMAL_LOG_PDF_COEFFICIENT] - 0.5 * z * z;
+}
+
+/**
+ * @brief Normal log CDF and log survival function through log erfc, finite in both far tails
+ */
+static double normal_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    double z = (x - prepared->constants[NORMAL_MEAN]) * prepared->constants[NORMAL_CDF_SCALE];
+    
+    *log_upper = log_complementary_error_function(z) - M_LN_2;
+    return log_complementary_error_function(-z) - M_LN_2;
+}
+
+/**
+ * @brief Validate parameters and cache 1/σ, 1/(σ√(2π)), its log and 1/(σ√2)
+ */
+static int normal_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!normal_validate_params(params, param_count)) {
+        return -1;
+    }
+    
     double std_dev = params[1];
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
-        return NAN;
+    prepared->constants[NORMAL_MEAN] = params[0];
+    prepared->constants[NORMAL_INV_STD_DEV] = 1.0 / std_dev;
+    prepared->constants[NORMAL_PDF_COEFFICIENT] = 1.0 / (std_dev * M_SQRT_2PI);
+    prepared->constants[NORMAL_CDF_SCALE] = 1.0 / (std_dev * M_SQRT2);
+    prepared->constants[NORMAL_LOG_PDF_COEFFICIENT] = -log(std_dev * M_SQRT_2PI);
+    prepared->branch = 0;
+    prepared->pdf = normal_pdf_prepared;
+    prepared->cdf = normal_cdf_prepared;
+    prepared->tails = normal_tails_prepared;
+    prepared->logpdf = normal_logpdf_prepared;
+    prepared->log_tails = normal_log_tails_prepared;
+    prepared->pdf_float = normal_pdf_prepared_float;
+    prepared->cdf_float = normal_cdf_prepared_float;
+    
+    return 0;
+}
+
+/**
+ * @brief Normal distribution batched PDF calculation
+ * Exponents are staged per chunk so exp runs through the vector_math kernel.
+ */
+int normal_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    double chunk[DISTRIBUTION_BATCH_CHUNK];
+    
+    if (!x || !out) {
+        return -1;
     }
     
-    // Calculate standardized value
-    double z = (x - mean) / (std_dev * M_SQRT2);
+    if (normal_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    double mean = prepared.constants[NORMAL_MEAN];
+    double inv_std_dev = prepared.constants[NORMAL_INV_STD_DEV];
+    double coefficient = prepared.constants[NORMAL_PDF_COEFFICIENT];
+    
+    for (size_t start = 0; start < count; start += DISTRIBUTION_BATCH_CHUNK) {
+        size_t n = (count - start < DISTRIBUTION_BATCH_CHUNK) ? count - start : DISTRIBUTION_BATCH_CHUNK;
+        
+        for (size_t i = 0; i < n; i++) {
+            double z = (x[start + i] - mean) * inv_std_dev;
+            chunk[i] = -0.5 * z * z;
+        }
+        
+        vector_exp(chunk, chunk, n);
+        
+        for (size_t i = 0; i < n; i++) {
+            out[start + i] = is_finite_number(x[start + i]) ? coefficient * chunk[i] : NAN;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Normal distribution batched CDF calculation
+ */
+int normal_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (normal_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
     
-    // Calculate CDF: 0.5 * (1 + erf(z/√2))
-    return 0.5 * (1.0 + error_function(z));
+    for (size_t i = 0; i < count; i++) {
+        out[i] = normal_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -90,18 +244,24 @@ int normal_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Normal distribution interface object, referenced directly by the registry table
+ */
+const distribution_t normal_distribution_impl = {
+    .pdf = normal_pdf,
+    .cdf = normal_cdf,
+    .validate_params = normal_validate_params,
+    .distribution_name = "Normal",
+    .param_count = 2,
+    .param_names = normal_param_names,
+    .pdf_batch = normal_pdf_batch,
+    .cdf_batch = normal_cdf_batch,
+    .prepare = normal_prepare
+};
+
 /**
  * @brief Get the Normal distribution interface
  */
 const distribution_t* get_normal_distribution(void) {
-    static const distribution_t normal_dist = {
-        .pdf = normal_pdf,
-        .cdf = normal_cdf,
-        .validate_params = normal_validate_params,
-        .distribution_name = "Normal",
-        .param_count = 2,
-        .param_names = normal_param_names
-    };
-    
-    return &normal_dist;
+    return &normal_distribution_impl;
 }
\ No newline at end of file
@@ -6,50 +6,167 @@
 static const char* pareto_param_names[] = {"scale", "shape"};
 
 double pareto_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (pareto_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!pareto_validate_params(params, param_count)) {
+    return result;
+}
+
+double pareto_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (pareto_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double scale = params[0];
-    double shape = params[1];
+    return result;
+}
+
+static double pareto_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x) || x < prepared->constants[0]) {
+        return 0.0;
+    }
+    
+    double term2 = -(prepared->constants[1] + 1) * log(x);
+    
+    return safe_exp(prepared->constants[2] + term2);
+}
+
+static double pareto_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double scale = prepared->constants[0];
+    
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
+        return NAN;
+    }
     
-    if (!is_finite_number(x) || x < scale) {
+    if (x < scale) {
         return 0.0;
     }
     
-    double term1 = log(shape) + shape * log(scale);
-    double term2 = -(shape + 1) * log(x);
+    return 1.0 - pow(scale / x, prepared->constants[1]);
+}
+
+static float pareto_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x) || x < prepared->constants_float[0]) {
+        return 0.0f;
+    }
     
-    return safe_exp(term1 + term2);
+    return expf(prepared->constants_float[2] - (prepared->constants_float[1] + 1.0f) * logf(x));
 }
 
-double pareto_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static float pareto_cdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    float scale = prepared->constants_float[0];
+    
+    if (!isfinite(x)) {
+        if (x == -INFINITY) return 0.0f;
+        if (x == INFINITY) return 1.0f;
         return NAN;
     }
     
+    if (x < scale) {
+        return 0.0f;
+    }
+    
+    return 1.0f - powf(scale / x, prepared->constants_float[1]);
+}
+
+static double pareto_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    double scale = prepared->constants[0];
+    
+    if (x < scale) {
+        *upper = 1.0;
+        return 0.0;
+    }
+    
+    *upper = pow(scale / x, prepared->constants[1]);
+    return 1.0 - *upper;
+}
+
+static double pareto_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x < prepared->constants[0]) {
+        return -INFINITY;
+    }
+    
+    return prepared->constants[2] - (prepared->constants[1] + 1) * log(x);
+}
+
+static double pareto_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    double scale = prepared->constants[0];
+    
+    if (x < scale) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    // α log(x_m / x), through log1p so the CDF keeps its precision just above x_m
+    *log_upper = -prepared->constants[1] * log1p((x - scale) / scale);
+    return log_one_minus_exp(*log_upper);
+}
+
+static int pareto_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
     if (!pareto_validate_params(params, param_count)) {
-        return NAN;
+        return -1;
     }
     
     double scale = params[0];
     double shape = params[1];
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
-        return NAN;
+    prepared->constants[0] = scale;
+    prepared->constants[1] = shape;
+    prepared->constants[2] = log(shape) + shape * log(scale);
+    prepared->branch = 0;
+    prepared->pdf = pareto_pdf_prepared;
+    prepared->cdf = pareto_cdf_prepared;
+    prepared->tails = pareto_tails_prepared;
+    prepared->logpdf = pareto_logpdf_prepared;
+    prepared->log_tails = pareto_log_tails_prepared;
+    prepared->pdf_float = pareto_pdf_prepared_float;
+    prepared->cdf_float = pareto_cdf_prepared_float;
+    
+    return 0;
+}
+
+int pareto_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
     }
     
-    if (x < scale) {
-        return 0.0;
+    if (pareto_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = pareto_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+int pareto_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
     }
     
-    return 1.0 - pow(scale / x, shape);
+    if (pareto_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = pareto_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 int pareto_validate_params(double* params, int param_count) {
@@ -71,15 +188,18 @@ int pareto_validate_params(double* params, int param_count) {
     return 1;
 }
 
+const distribution_t pareto_distribution_impl = {
+    .pdf = pareto_pdf,
+    .cdf = pareto_cdf,
+    .validate_params = pareto_validate_params,
+    .distribution_name = "Pareto",
+    .param_count = 2,
+    .param_names = pareto_param_names,
+    .pdf_batch = pareto_pdf_batch,
+    .cdf_batch = pareto_cdf_batch,
+    .prepare = pareto_prepare
+};
+
 const distribution_t* get_pareto_distribution(void) {
-    static const distribution_t pareto_dist = {
-        .pdf = pareto_pdf,
-        .cdf = pareto_cdf,
-        .validate_params = pareto_validate_params,
-        .distribution_name = "Pareto",
-        .param_count = 2,
-        .param_names = pareto_param_names
-    };
-    
-    return &pareto_dist;
+    return &pareto_distribution_impl;
 }
\ No newline at end of file
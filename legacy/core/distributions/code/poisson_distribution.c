@@ -1,5 +1,6 @@
 #include "poisson_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
@@ -12,16 +13,41 @@ static const char* poisson_param_names[] = {"lambda"};
  * where k is the number of events and lambda is the rate parameter
  */
 double poisson_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+    double result;
+    
+    if (poisson_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!poisson_validate_params(params, param_count)) {
+    return result;
+}
+
+/**
+ * @brief Poisson distribution CDF calculation
+ * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i)
+ * Evaluated as the regularized upper incomplete gamma Q(k+1, lambda)
+ */
+double poisson_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (poisson_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double lambda = params[0]; // rate parameter
-    
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    POISSON_LAMBDA = 0,
+    POISSON_LOG_LAMBDA = 1,
+    POISSON_PDF_ZERO = 2
+};
+
+/**
+ * @brief Poisson distribution PDF for a prepared handle
+ */
+static double poisson_pdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         return NAN;
     }
@@ -33,38 +59,19 @@ double poisson_pdf(double x, double* params, int param_count) {
     
     int k = (int)x; // number of events
     
-    // Handle edge cases
-    if (lambda == 0.0) {
-        return (k == 0) ? 1.0 : 0.0;
-    }
-    
-    // For very small lambda and k=0, use direct calculation
     if (k == 0) {
-        return safe_exp(-lambda);
+        return prepared->constants[POISSON_PDF_ZERO];
     }
     
-    // Calculate PDF using log space for numerical stability
     // log(P(X = k)) = k*log(lambda) - lambda - log(k!)
-    double log_prob = k * safe_log(lambda) - lambda - log_factorial(k);
-    
-    return safe_exp(log_prob);
+    return safe_exp(k * prepared->constants[POISSON_LOG_LAMBDA] - prepared->constants[POISSON_LAMBDA] - log_factorial(k));
 }
 
 /**
- * @brief Poisson distribution CDF calculation
- * Formula: P(X ≤ k) = sum_{i=0}^{k} P(X = i)
- * For large lambda, uses normal approximation with continuity correction
+ * @brief Poisson distribution CDF for a prepared handle
  */
-double poisson_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
-        return NAN;
-    }
-    
-    if (!poisson_validate_params(params, param_count)) {
-        return NAN;
-    }
-    
-    double lambda = params[0]; // rate parameter
+static double poisson_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double lambda = prepared->constants[POISSON_LAMBDA];
     
     if (!is_finite_number(x)) {
         if (x == -INFINITY) return 0.0;
@@ -80,40 +87,123 @@ double poisson_cdf(double x, double* params, int param_count) {
         return 0.0;
     }
     
-    // Handle edge case
-    if (lambda == 0.0) {
-        return 1.0; // All probability is at k=0
+    // P(X <= k) = Q(k+1, lambda), with lnΓ(k+1) = ln(k!)
+    double cdf;
+    incomplete_gamma_evaluate(k + 1.0, lambda, log_factorial(k), NULL, &cdf);
+    
+    return cdf;
+}
+
+/**
+ * @brief Poisson CDF Q(k+1, λ) and survival function P(k+1, λ) from one incomplete gamma evaluation
+ */
+static double poisson_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    int k = (int)floor(x);
+    double cdf;
+    
+    if (k < 0) {
+        *upper = 1.0;
+        return 0.0;
     }
     
-    // For large lambda (>= 30), use normal approximation with continuity correction
-    if (lambda >= 30.0) {
-        double mean = lambda;
-        double std_dev = sqrt(lambda);
-        
-        // Apply continuity correction: P(X <= k) ≈ P(Z <= (k + 0.5 - mean) / std_dev)
-        double z = (k + 0.5 - mean) / std_dev;
-        
-        // Use error function to compute normal CDF
-        return 0.5 * (1.0 + error_function(z / M_SQRT2));
+    *upper = incomplete_gamma_evaluate(k + 1.0, prepared->constants[POISSON_LAMBDA], log_factorial(k), NULL, &cdf);
+    return cdf;
+}
+
+/**
+ * @brief Poisson log PMF k log(λ) - λ - log(k!) for a prepared handle
+ */
+static double poisson_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x < 0.0 || floor(x) != x) {
+        return -INFINITY;
     }
     
-    // For smaller lambda, use direct summation with recurrence relation
-    double cdf = 0.0;
-    double current_pdf = safe_exp(-lambda); // P(X = 0)
-    cdf += current_pdf;
+    int k = (int)x;
+    
+    return k * prepared->constants[POISSON_LOG_LAMBDA] - prepared->constants[POISSON_LAMBDA] - log_factorial(k);
+}
+
+/**
+ * @brief Poisson log CDF and log survival function from one log-space incomplete gamma evaluation
+ */
+static double poisson_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    int k = (int)floor(x);
+    double log_cdf;
     
-    // Use recurrence relation: P(X = i) = P(X = i-1) * lambda / i
-    for (int i = 1; i <= k; i++) {
-        current_pdf *= lambda / (double)i;
-        cdf += current_pdf;
-        
-        // Early termination if PDF becomes negligible
-        if (current_pdf < 1e-15) {
-            break;
-        }
+    if (k < 0) {
+        *log_upper = 0.0;
+        return -INFINITY;
     }
     
-    return cdf;
+    *log_upper = incomplete_gamma_evaluate_log(k + 1.0, prepared->constants[POISSON_LAMBDA], log_factorial(k), NULL, &log_cdf);
+    return log_cdf;
+}
+
+/**
+ * @brief Validate parameters and cache log(lambda) and e^(-lambda)
+ */
+static int poisson_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!poisson_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    double lambda = params[0]; // rate parameter
+    
+    prepared->constants[POISSON_LAMBDA] = lambda;
+    prepared->constants[POISSON_LOG_LAMBDA] = safe_log(lambda);
+    prepared->constants[POISSON_PDF_ZERO] = safe_exp(-lambda);
+    prepared->branch = 0;
+    prepared->pdf = poisson_pdf_prepared;
+    prepared->cdf = poisson_cdf_prepared;
+    prepared->tails = poisson_tails_prepared;
+    prepared->logpdf = poisson_logpdf_prepared;
+    prepared->log_tails = poisson_log_tails_prepared;
+    
+    return 0;
+}
+
+/**
+ * @brief Poisson distribution batched PDF calculation
+ */
+int poisson_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (poisson_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = poisson_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Poisson distribution batched CDF calculation
+ */
+int poisson_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (poisson_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = poisson_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -135,18 +225,24 @@ int poisson_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Poisson distribution interface object, referenced directly by the registry table
+ */
+const distribution_t poisson_distribution_impl = {
+    .pdf = poisson_pdf,
+    .cdf = poisson_cdf,
+    .validate_params = poisson_validate_params,
+    .distribution_name = "Poisson",
+    .param_count = 1,
+    .param_names = poisson_param_names,
+    .pdf_batch = poisson_pdf_batch,
+    .cdf_batch = poisson_cdf_batch,
+    .prepare = poisson_prepare
+};
+
 /**
  * @brief Get the Poisson distribution interface
  */
 const distribution_t* get_poisson_distribution(void) {
-    static const distribution_t poisson_dist = {
-        .pdf = poisson_pdf,
-        .cdf = poisson_cdf,
-        .validate_params = poisson_validate_params,
-        .distribution_name = "Poisson",
-        .param_count = 1,
-        .param_names = poisson_param_names
-    };
-    
-    return &poisson_dist;
+    return &poisson_distribution_impl;
 }
\ No newline at end of file
@@ -6,50 +6,158 @@
 static const char* rayleigh_param_names[] = {"scale"};
 
 double rayleigh_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+    double result;
+    
+    if (rayleigh_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!rayleigh_validate_params(params, param_count)) {
+    return result;
+}
+
+double rayleigh_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (rayleigh_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double scale = params[0];
-    
+    return result;
+}
+
+static double rayleigh_pdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x) || x < 0) {
         return 0.0;
     }
     
-    double scale_sq = scale * scale;
-    double term1 = log(x) - 2 * log(scale);
-    double term2 = -(x * x) / (2 * scale_sq);
+    double term1 = log(x) - prepared->constants[1];
+    double term2 = -(x * x) * prepared->constants[2];
     
     return safe_exp(term1 + term2);
 }
 
-double rayleigh_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+static double rayleigh_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
-    if (!rayleigh_validate_params(params, param_count)) {
-        return NAN;
+    if (x < 0) {
+        return 0.0;
     }
     
-    double scale = params[0];
+    return -expm1(-(x * x) * prepared->constants[2]);
+}
+
+static float rayleigh_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x) || x < 0.0f) {
+        return 0.0f;
+    }
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
+    return expf(logf(x) - prepared->constants_float[1] - (x * x) * prepared->constants_float[2]);
+}
+
+static float rayleigh_cdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
+        if (x == -INFINITY) return 0.0f;
+        if (x == INFINITY) return 1.0f;
         return NAN;
     }
     
+    if (x < 0.0f) {
+        return 0.0f;
+    }
+    
+    return -expm1f(-(x * x) * prepared->constants_float[2]);
+}
+
+static double rayleigh_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
     if (x < 0) {
+        *upper = 1.0;
         return 0.0;
     }
     
-    double scale_sq = scale * scale;
-    return 1.0 - safe_exp(-(x * x) / (2 * scale_sq));
+    *upper = exp(-(x * x) * prepared->constants[2]);
+    return -expm1(-(x * x) * prepared->constants[2]);
+}
+
+static double rayleigh_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x <= 0) {
+        return -INFINITY;
+    }
+    
+    return log(x) - prepared->constants[1] - (x * x) * prepared->constants[2];
+}
+
+static double rayleigh_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x <= 0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    *log_upper = -(x * x) * prepared->constants[2];
+    return log_one_minus_exp(*log_upper);
+}
+
+static int rayleigh_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!rayleigh_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    double scale = params[0];
+    
+    prepared->constants[0] = scale;
+    prepared->constants[1] = 2 * log(scale);
+    prepared->constants[2] = 1.0 / (2 * scale * scale);
+    prepared->branch = 0;
+    prepared->pdf = rayleigh_pdf_prepared;
+    prepared->cdf = rayleigh_cdf_prepared;
+    prepared->tails = rayleigh_tails_prepared;
+    prepared->logpdf = rayleigh_logpdf_prepared;
+    prepared->log_tails = rayleigh_log_tails_prepared;
+    prepared->pdf_float = rayleigh_pdf_prepared_float;
+    prepared->cdf_float = rayleigh_cdf_prepared_float;
+    
+    return 0;
+}
+
+int rayleigh_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (rayleigh_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = rayleigh_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+int rayleigh_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (rayleigh_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = rayleigh_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 int rayleigh_validate_params(double* params, int param_count) {
@@ -66,15 +174,18 @@ int rayleigh_validate_params(double* params, int param_count) {
     return 1;
 }
 
+const distribution_t rayleigh_distribution_impl = {
+    .pdf = rayleigh_pdf,
+    .cdf = rayleigh_cdf,
+    .validate_params = rayleigh_validate_params,
+    .distribution_name = "Rayleigh",
+    .param_count = 1,
+    .param_names = rayleigh_param_names,
+    .pdf_batch = rayleigh_pdf_batch,
+    .cdf_batch = rayleigh_cdf_batch,
+    .prepare = rayleigh_prepare
+};
+
 const distribution_t* get_rayleigh_distribution(void) {
-    static const distribution_t rayleigh_dist = {
-        .pdf = rayleigh_pdf,
-        .cdf = rayleigh_cdf,
-        .validate_params = rayleigh_validate_params,
-        .distribution_name = "Rayleigh",
-        .param_count = 1,
-        .param_names = rayleigh_param_names
-    };
-    
-    return &rayleigh_dist;
+    return &rayleigh_distribution_impl;
 }
\ No newline at end of file
@@ -1,46 +1,24 @@
 #include "t_distribution.h"
 #include "../math/math_utils.h"
+#include "../math/special_functions.h"
 #include <math.h>
 #include <stddef.h>
 
 // Parameter names for t-distribution
 static const char* t_param_names[] = {"degrees_of_freedom"};
 
-// Forward declarations for helper functions
-static double incomplete_beta_regularized(double a, double b, double x);
-static double continued_fraction_beta(double a, double b, double x);
-
 /**
  * @brief Student's t-distribution PDF calculation
  * Formula: f(x) = Γ((ν+1)/2) / (√(νπ) * Γ(ν/2)) * (1 + x²/ν)^(-(ν+1)/2)
  */
 double t_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
-        return NAN;
-    }
+    double result;
     
-    if (!t_validate_params(params, param_count)) {
+    if (t_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double nu = params[0]; // degrees of freedom
-    
-    if (!is_finite_number(x)) {
-        if (x == INFINITY || x == -INFINITY) return 0.0;
-        return NAN;
-    }
-    
-    // Calculate PDF using log space for numerical stability
-    double half_nu = nu / 2.0;
-    double half_nu_plus_1 = (nu + 1.0) / 2.0;
-    
-    // Log of normalization constant: log(Γ((ν+1)/2)) - log(√(νπ)) - log(Γ(ν/2))
-    double log_norm = log_gamma_function(half_nu_plus_1) - 0.5 * safe_log(nu * M_PI_PRECISE) - log_gamma_function(half_nu);
-    
-    // Log of (1 + x²/ν)^(-(ν+1)/2)
-    double log_power = -half_nu_plus_1 * safe_log(1.0 + (x * x) / nu);
-    
-    return safe_exp(log_norm + log_power);
+    return result;
 }
 
 /**
@@ -48,16 +26,43 @@ double t_pdf(double x, double* params, int param_count) {
  * Uses the relationship with the incomplete beta function
  */
 double t_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 1) {
+    double result;
+    
+    if (t_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!t_validate_params(params, param_count)) {
+    return result;
+}
+
+// Prepared constant slots
+enum {
+    T_DF = 0,
+    T_HALF_DF = 1,
+    T_HALF_DF_PLUS_1 = 2,
+    T_LOG_NORM = 3,
+    T_LOG_BETA = 4
+};
+
+/**
+ * @brief Student's t-distribution PDF for a prepared handle
+ */
+static double t_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == INFINITY || x == -INFINITY) return 0.0;
         return NAN;
     }
     
-    double nu = params[0]; // degrees of freedom
+    // Log of (1 + x²/ν)^(-(ν+1)/2)
+    double log_power = -prepared->constants[T_HALF_DF_PLUS_1] * safe_log(1.0 + (x * x) / prepared->constants[T_DF]);
     
+    return safe_exp(prepared->constants[T_LOG_NORM] + log_power);
+}
+
+/**
+ * @brief Student's t-distribution CDF for a prepared handle
+ */
+static double t_cdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         if (x == -INFINITY) return 0.0;
         if (x == INFINITY) return 1.0;
@@ -68,93 +73,158 @@ double t_cdf(double x, double* params, int param_count) {
         return 0.5;
     }
     
-    // For large degrees of freedom, approximate with normal distribution
-    if (nu > 100.0) {
-        // Use error function approximation
-        return 0.5 * (1.0 + error_function(x / M_SQRT2));
+    // Use incomplete beta function relationship
+    // The tail mass is 0.5 * I_{ν/(ν+t²)}(ν/2, 0.5), which stays accurate far out
+    double t_squared = x * x;
+    double ratio = prepared->constants[T_DF] / (prepared->constants[T_DF] + t_squared);
+    double tail = 0.5 * incomplete_beta_evaluate(prepared->constants[T_HALF_DF], 0.5, ratio,
+                                                 prepared->constants[T_LOG_BETA], NULL, NULL);
+    
+    if (x > 0.0) {
+        return 1.0 - tail;
+    } else {
+        return tail;
+    }
+}
+
+/**
+ * @brief Single-precision Student's t PDF for a prepared handle (the CDF stays in double)
+ */
+static float t_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
+        if (x == INFINITY || x == -INFINITY) return 0.0f;
+        return NAN;
     }
     
-    // Use the relationship: F(t) = 0.5 + (t/√(ν)) * Γ((ν+1)/2) / (√π * Γ(ν/2)) * ₂F₁(0.5, (ν+1)/2; 1.5; -t²/ν)
-    // For simplicity, we'll use a series approximation
+    float log_power = -prepared->constants_float[T_HALF_DF_PLUS_1] * log1pf((x * x) / prepared->constants_float[T_DF]);
     
-    double t_squared = x * x;
-    double ratio = t_squared / (nu + t_squared);
+    return expf(prepared->constants_float[T_LOG_NORM] + log_power);
+}
+
+/**
+ * @brief Student's t CDF and survival function from one incomplete beta evaluation
+ */
+static double t_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    if (x == 0.0) {
+        *upper = 0.5;
+        return 0.5;
+    }
     
-    // Use incomplete beta function relationship
-    // If t > 0: F(t) = 0.5 + 0.5 * I_ratio(0.5, nu/2)
-    // If t < 0: F(t) = 0.5 - 0.5 * I_ratio(0.5, nu/2)
+    double ratio = prepared->constants[T_DF] / (prepared->constants[T_DF] + x * x);
+    double tail = 0.5 * incomplete_beta_evaluate(prepared->constants[T_HALF_DF], 0.5, ratio,
+                                                 prepared->constants[T_LOG_BETA], NULL, NULL);
+    
+    // The distribution is symmetric, so the far tail is the same mass on either side
+    if (x > 0.0) {
+        *upper = tail;
+        return 1.0 - tail;
+    }
+    *upper = 1.0 - tail;
+    return tail;
+}
+
+/**
+ * @brief Student's t log PDF for a prepared handle
+ */
+static double t_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    return prepared->constants[T_LOG_NORM] - prepared->constants[T_HALF_DF_PLUS_1] * log1p((x * x) / prepared->constants[T_DF]);
+}
+
+/**
+ * @brief Student's t log CDF and log survival function from one log-space incomplete beta evaluation
+ */
+static double t_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x == 0.0) {
+        *log_upper = -M_LN_2;
+        return -M_LN_2;
+    }
     
-    double beta_result = incomplete_beta_regularized(0.5, nu / 2.0, ratio);
+    double ratio = prepared->constants[T_DF] / (prepared->constants[T_DF] + x * x);
+    double log_tail = incomplete_beta_evaluate_log(prepared->constants[T_HALF_DF], 0.5, ratio,
+                                                   prepared->constants[T_LOG_BETA], NULL, NULL) - M_LN_2;
     
     if (x > 0.0) {
-        return 0.5 + 0.5 * beta_result;
-    } else {
-        return 0.5 - 0.5 * beta_result;
+        *log_upper = log_tail;
+        return log_one_minus_exp(log_tail);
     }
+    *log_upper = log_one_minus_exp(log_tail);
+    return log_tail;
 }
 
 /**
- * @brief Regularized incomplete beta function I_x(a,b)
- * Used for t-distribution CDF calculation
+ * @brief Validate parameters and cache the log normalization and log beta constants
  */
-static double incomplete_beta_regularized(double a, double b, double x) {
-    if (x <= 0.0) return 0.0;
-    if (x >= 1.0) return 1.0;
-    if (a <= 0.0 || b <= 0.0) return NAN;
-    
-    // Use continued fraction expansion
-    double bt = safe_exp(log_gamma_function(a + b) - log_gamma_function(a) - log_gamma_function(b) + 
-                        a * safe_log(x) + b * safe_log(1.0 - x));
-    
-    if (x < (a + 1.0) / (a + b + 2.0)) {
-        // Use continued fraction directly
-        return bt * continued_fraction_beta(a, b, x) / a;
-    } else {
-        // Use symmetry relation
-        return 1.0 - bt * continued_fraction_beta(b, a, 1.0 - x) / b;
+static int t_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!t_validate_params(params, param_count)) {
+        return -1;
     }
+    
+    double nu = params[0]; // degrees of freedom
+    double half_nu = nu / 2.0;
+    double half_nu_plus_1 = (nu + 1.0) / 2.0;
+    
+    prepared->constants[T_DF] = nu;
+    prepared->constants[T_HALF_DF] = half_nu;
+    prepared->constants[T_HALF_DF_PLUS_1] = half_nu_plus_1;
+    
+    // Log of normalization constant: log(Γ((ν+1)/2)) - log(√(νπ)) - log(Γ(ν/2))
+    prepared->constants[T_LOG_NORM] = log_gamma_function(half_nu_plus_1) - 0.5 * safe_log(nu * M_PI_PRECISE) - log_gamma_function(half_nu);
+    
+    prepared->constants[T_LOG_BETA] = log_beta_function(half_nu, 0.5);
+    
+    prepared->branch = 0;
+    prepared->pdf = t_pdf_prepared;
+    prepared->cdf = t_cdf_prepared;
+    prepared->tails = t_tails_prepared;
+    prepared->logpdf = t_logpdf_prepared;
+    prepared->log_tails = t_log_tails_prepared;
+    prepared->pdf_float = t_pdf_prepared_float;
+    
+    return 0;
 }
 
 /**
- * @brief Continued fraction for incomplete beta function
+ * @brief Student's t-distribution batched PDF calculation
  */
-static double continued_fraction_beta(double a, double b, double x) {
-    const int max_iter = 200;
-    const double eps = 1e-12;
-    
-    double qab = a + b;
-    double qap = a + 1.0;
-    double qam = a - 1.0;
-    double c = 1.0;
-    double d = 1.0 - qab * x / qap;
-    
-    if (fabs(d) < 1e-30) d = 1e-30;
-    d = 1.0 / d;
-    double h = d;
-    
-    for (int m = 1; m <= max_iter; m++) {
-        int m2 = 2 * m;
-        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
-        d = 1.0 + aa * d;
-        if (fabs(d) < 1e-30) d = 1e-30;
-        c = 1.0 + aa / c;
-        if (fabs(c) < 1e-30) c = 1e-30;
-        d = 1.0 / d;
-        h *= d * c;
-        
-        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
-        d = 1.0 + aa * d;
-        if (fabs(d) < 1e-30) d = 1e-30;
-        c = 1.0 + aa / c;
-        if (fabs(c) < 1e-30) c = 1e-30;
-        d = 1.0 / d;
-        double del = d * c;
-        h *= del;
-        
-        if (fabs(del - 1.0) < eps) break;
-    }
-    
-    return h;
+int t_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (t_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = t_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Student's t-distribution batched CDF calculation
+ */
+int t_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (t_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = t_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 /**
@@ -176,18 +246,24 @@ int t_validate_params(double* params, int param_count) {
     return 1;
 }
 
+/**
+ * @brief Student's t-distribution interface object, referenced directly by the registry table
+ */
+const distribution_t t_distribution_impl = {
+    .pdf = t_pdf,
+    .cdf = t_cdf,
+    .validate_params = t_validate_params,
+    .distribution_name = "t-distribution",
+    .param_count = 1,
+    .param_names = t_param_names,
+    .pdf_batch = t_pdf_batch,
+    .cdf_batch = t_cdf_batch,
+    .prepare = t_prepare
+};
+
 /**
  * @brief Get the Student's t-distribution interface
  */
 const distribution_t* get_t_distribution(void) {
-    static const distribution_t t_dist = {
-        .pdf = t_pdf,
-        .cdf = t_cdf,
-        .validate_params = t_validate_params,
-        .distribution_name = "t-distribution",
-        .param_count = 1,
-        .param_names = t_param_names
-    };
-    
-    return &t_dist;
+    return &t_distribution_impl;
 }
\ No newline at end of file
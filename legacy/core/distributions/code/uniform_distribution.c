@@ -6,55 +6,162 @@
 static const char* uniform_param_names[] = {"a", "b"};
 
 double uniform_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (uniform_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!uniform_validate_params(params, param_count)) {
+    return result;
+}
+
+double uniform_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (uniform_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double a = params[0];
-    double b = params[1];
-    
+    return result;
+}
+
+static double uniform_pdf_prepared(const distribution_prepared_t* prepared, double x) {
     if (!is_finite_number(x)) {
         return NAN;
     }
     
-    if (x >= a && x <= b) {
-        return 1.0 / (b - a);
+    if (x >= prepared->constants[0] && x <= prepared->constants[1]) {
+        return prepared->constants[2];
     }
     
     return 0.0;
 }
 
-double uniform_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static double uniform_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double a = prepared->constants[0];
+    double b = prepared->constants[1];
+    
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
-    if (!uniform_validate_params(params, param_count)) {
+    if (x < a) {
+        return 0.0;
+    }
+    
+    if (x >= b) {
+        return 1.0;
+    }
+    
+    return (x - a) * prepared->constants[2];
+}
+
+static float uniform_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
         return NAN;
     }
     
-    double a = params[0];
-    double b = params[1];
+    if (x >= prepared->constants_float[0] && x <= prepared->constants_float[1]) {
+        return prepared->constants_float[2];
+    }
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
+    return 0.0f;
+}
+
+static float uniform_cdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    float a = prepared->constants_float[0];
+    
+    if (!isfinite(x)) {
+        if (x == -INFINITY) return 0.0f;
+        if (x == INFINITY) return 1.0f;
         return NAN;
     }
     
     if (x < a) {
+        return 0.0f;
+    }
+    
+    if (x >= prepared->constants_float[1]) {
+        return 1.0f;
+    }
+    
+    return (x - a) * prepared->constants_float[2];
+}
+
+static double uniform_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
+    double a = prepared->constants[0];
+    double b = prepared->constants[1];
+    
+    if (x < a) {
+        *upper = 1.0;
         return 0.0;
     }
     
     if (x >= b) {
+        *upper = 0.0;
         return 1.0;
     }
     
-    return (x - a) / (b - a);
+    *upper = (b - x) * prepared->constants[2];
+    return (x - a) * prepared->constants[2];
+}
+
+static int uniform_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!uniform_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    prepared->constants[0] = params[0];
+    prepared->constants[1] = params[1];
+    prepared->constants[2] = 1.0 / (params[1] - params[0]);
+    prepared->branch = 0;
+    prepared->pdf = uniform_pdf_prepared;
+    prepared->cdf = uniform_cdf_prepared;
+    prepared->tails = uniform_tails_prepared;
+    prepared->pdf_float = uniform_pdf_prepared_float;
+    prepared->cdf_float = uniform_cdf_prepared_float;
+    
+    return 0;
+}
+
+int uniform_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (uniform_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = uniform_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+int uniform_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (uniform_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = uniform_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 int uniform_validate_params(double* params, int param_count) {
@@ -76,15 +183,18 @@ int uniform_validate_params(double* params, int param_count) {
     return 1;
 }
 
+const distribution_t uniform_distribution_impl = {
+    .pdf = uniform_pdf,
+    .cdf = uniform_cdf,
+    .validate_params = uniform_validate_params,
+    .distribution_name = "Uniform",
+    .param_count = 2,
+    .param_names = uniform_param_names,
+    .pdf_batch = uniform_pdf_batch,
+    .cdf_batch = uniform_cdf_batch,
+    .prepare = uniform_prepare
+};
+
 const distribution_t* get_uniform_distribution(void) {
-    static const distribution_t uniform_dist = {
-        .pdf = uniform_pdf,
-        .cdf = uniform_cdf,
-        .validate_params = uniform_validate_params,
-        .distribution_name = "Uniform",
-        .param_count = 2,
-        .param_names = uniform_param_names
-    };
-    
-    return &uniform_dist;
+    return &uniform_distribution_impl;
 }
\ No newline at end of file
@@ -6,16 +6,28 @@
 static const char* weibull_param_names[] = {"shape", "scale"};
 
 double weibull_pdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+    double result;
+    
+    if (weibull_pdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    if (!weibull_validate_params(params, param_count)) {
+    return result;
+}
+
+double weibull_cdf(double x, double* params, int param_count) {
+    double result;
+    
+    if (weibull_cdf_batch(&x, &result, 1, params, param_count) != 0) {
         return NAN;
     }
     
-    double shape = params[0];
-    double scale = params[1];
+    return result;
+}
+
+static double weibull_pdf_prepared(const distribution_prepared_t* prepared, double x) {
+    double shape = prepared->constants[0];
+    double scale = prepared->constants[1];
     
     if (!is_finite_number(x) || x < 0) {
         return 0.0;
@@ -33,36 +45,158 @@ double weibull_pdf(double x, double* params, int param_count) {
         return INFINITY;
     }
     
-    double term1 = log(shape) - log(scale);
-    double term2 = (shape - 1) * (log(x) - log(scale));
+    double term2 = (shape - 1) * (log(x) - prepared->constants[2]);
     double term3 = -pow(x / scale, shape);
     
-    return safe_exp(term1 + term2 + term3);
+    return safe_exp(prepared->constants[3] + term2 + term3);
 }
 
-double weibull_cdf(double x, double* params, int param_count) {
-    if (!params || param_count != 2) {
+static double weibull_cdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (!is_finite_number(x)) {
+        if (x == -INFINITY) return 0.0;
+        if (x == INFINITY) return 1.0;
         return NAN;
     }
     
-    if (!weibull_validate_params(params, param_count)) {
-        return NAN;
+    if (x < 0) {
+        return 0.0;
     }
     
-    double shape = params[0];
-    double scale = params[1];
+    return -expm1(-pow(x / prepared->constants[1], prepared->constants[0]));
+}
+
+static float weibull_pdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    float shape = prepared->constants_float[0];
     
-    if (!is_finite_number(x)) {
-        if (x == -INFINITY) return 0.0;
-        if (x == INFINITY) return 1.0;
+    if (!isfinite(x) || x < 0.0f) {
+        return 0.0f;
+    }
+    
+    if (x == 0.0f) {
+        if (shape == 1.0f) return 1.0f / prepared->constants_float[1];
+        return (shape > 1.0f) ? 0.0f : INFINITY;
+    }
+    
+    float term2 = (shape - 1.0f) * (logf(x) - prepared->constants_float[2]);
+    float term3 = -powf(x / prepared->constants_float[1], shape);
+    
+    return expf(prepared->constants_float[3] + term2 + term3);
+}
+
+static float weibull_cdf_prepared_float(const distribution_prepared_t* prepared, float x) {
+    if (!isfinite(x)) {
+        if (x == -INFINITY) return 0.0f;
+        if (x == INFINITY) return 1.0f;
         return NAN;
     }
     
+    if (x < 0.0f) {
+        return 0.0f;
+    }
+    
+    return -expm1f(-powf(x / prepared->constants_float[1], prepared->constants_float[0]));
+}
+
+static double weibull_tails_prepared(const distribution_prepared_t* prepared, double x, double* upper) {
     if (x < 0) {
+        *upper = 1.0;
         return 0.0;
     }
     
-    return 1.0 - safe_exp(-pow(x / scale, shape));
+    double scaled = pow(x / prepared->constants[1], prepared->constants[0]);
+    *upper = exp(-scaled);
+    return -expm1(-scaled);
+}
+
+static double weibull_logpdf_prepared(const distribution_prepared_t* prepared, double x) {
+    if (x <= 0) {
+        return log(weibull_pdf_prepared(prepared, x));
+    }
+    
+    double log_ratio = log(x) - prepared->constants[2];
+    
+    return prepared->constants[3] + (prepared->constants[0] - 1) * log_ratio - exp(prepared->constants[0] * log_ratio);
+}
+
+static double weibull_log_tails_prepared(const distribution_prepared_t* prepared, double x, double* log_upper) {
+    if (x <= 0) {
+        *log_upper = 0.0;
+        return -INFINITY;
+    }
+    
+    // log((x/λ)^k) stays finite where the power itself underflows
+    double log_scaled = prepared->constants[0] * (log(x) - prepared->constants[2]);
+    double scaled = exp(log_scaled);
+    
+    *log_upper = -scaled;
+    
+    // log(1 - e^(-s)) = log(s) - s/2 + O(s²) once s is tiny
+    if (log_scaled < -20.0) {
+        return log_scaled - 0.5 * scaled;
+    }
+    return log_one_minus_exp(-scaled);
+}
+
+static int weibull_prepare(double* params, int param_count, distribution_prepared_t* prepared) {
+    if (!weibull_validate_params(params, param_count)) {
+        return -1;
+    }
+    
+    double shape = params[0];
+    double scale = params[1];
+    
+    prepared->constants[0] = shape;
+    prepared->constants[1] = scale;
+    prepared->constants[2] = log(scale);
+    prepared->constants[3] = log(shape) - log(scale);
+    prepared->branch = 0;
+    prepared->pdf = weibull_pdf_prepared;
+    prepared->cdf = weibull_cdf_prepared;
+    prepared->tails = weibull_tails_prepared;
+    prepared->logpdf = weibull_logpdf_prepared;
+    prepared->log_tails = weibull_log_tails_prepared;
+    prepared->pdf_float = weibull_pdf_prepared_float;
+    prepared->cdf_float = weibull_cdf_prepared_float;
+    
+    return 0;
+}
+
+int weibull_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (weibull_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = weibull_pdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
+}
+
+int weibull_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count) {
+    distribution_prepared_t prepared;
+    
+    if (!x || !out) {
+        return -1;
+    }
+    
+    if (weibull_prepare(params, param_count, &prepared) != 0) {
+        distribution_fill_batch(out, count, NAN);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = weibull_cdf_prepared(&prepared, x[i]);
+    }
+    
+    return 0;
 }
 
 int weibull_validate_params(double* params, int param_count) {
@@ -84,15 +218,18 @@ int weibull_validate_params(double* params, int param_count) {
     return 1;
 }
 
+const distribution_t weibull_distribution_impl = {
+    .pdf = weibull_pdf,
+    .cdf = weibull_cdf,
+    .validate_params = weibull_validate_params,
+    .distribution_name = "Weibull",
+    .param_count = 2,
+    .param_names = weibull_param_names,
+    .pdf_batch = weibull_pdf_batch,
+    .cdf_batch = weibull_cdf_batch,
+    .prepare = weibull_prepare
+};
+
 const distribution_t* get_weibull_distribution(void) {
-    static const distribution_t weibull_dist = {
-        .pdf = weibull_pdf,
-        .cdf = weibull_cdf,
-        .validate_params = weibull_validate_params,
-        .distribution_name = "Weibull",
-        .param_count = 2,
-        .param_names = weibull_param_names
-    };
-    
-    return &weibull_dist;
+    return &weibull_distribution_impl;
 }
\ No newline at end of file
@@ -29,6 +29,32 @@ double binomial_pdf(double x, double* params, int param_count);
  */
 double binomial_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Binomial distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [n, p] where:
+ *               n = number of trials
+ *               p = probability of success on each trial
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int binomial_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Binomial distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [n, p] where:
+ *               n = number of trials
+ *               p = probability of success on each trial
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int binomial_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Binomial distribution parameters
  * @param params Array containing [n, p] where:
@@ -45,6 +71,11 @@ int binomial_validate_params(double* params, int param_count);
  */
 const distribution_t* get_binomial_distribution(void);
 
+/**
+ * @brief Binomial distribution interface object for static tables
+ */
+extern const distribution_t binomial_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,28 @@ double chi_square_pdf(double x, double* params, int param_count);
  */
 double chi_square_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Chi-Square distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [degrees_of_freedom]
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int chi_square_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Chi-Square distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [degrees_of_freedom]
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int chi_square_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Chi-Square distribution parameters
  * @param params Array containing [degrees_of_freedom]
@@ -39,6 +61,11 @@ int chi_square_validate_params(double* params, int param_count);
  */
 const distribution_t* get_chi_square_distribution(void);
 
+/**
+ * @brief Chi-Square distribution interface object for static tables
+ */
+extern const distribution_t chi_square_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
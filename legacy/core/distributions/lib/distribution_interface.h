@@ -2,12 +2,46 @@
 #define DISTRIBUTION_INTERFACE_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 /**
  * @brief Maximum number of parameters for any distribution
  */
 #define MAX_PARAMETERS 4
 
+/**
+ * @brief Number of cached per-parameter constants in a prepared handle
+ */
+#define DISTRIBUTION_PREPARED_CONSTANTS 8
+
+/**
+ * @brief Values staged per vector_math call inside the batch kernels
+ */
+#define DISTRIBUTION_BATCH_CHUNK 64
+
+/**
+ * @brief Longest PMF table, in support points
+ */
+#define DISTRIBUTION_TABLE_MAX_ENTRIES 512
+
+/**
+ * @brief Probability mass a PMF table may leave out on each side of an unbounded or wide support
+ */
+#define DISTRIBUTION_TABLE_TAIL_MASS 1e-16
+
+typedef struct distribution_prepared distribution_prepared_t;
+
+/**
+ * @brief Evaluation precision of a prepared handle
+ * FLOAT routes to single-precision kernels (about 7 significant digits, and x
+ * is rounded to float) for previews and chart sweeps; DOUBLE is kept for the
+ * displayed result. Distributions without a float kernel evaluate in double.
+ */
+typedef enum {
+    DISTRIBUTION_PRECISION_DOUBLE = 0,
+    DISTRIBUTION_PRECISION_FLOAT = 1
+} distribution_precision_t;
+
 /**
  * @brief Distribution function interface for PDF and CDF calculations
  */
@@ -18,8 +52,47 @@ typedef struct {
     const char* distribution_name;
     int param_count;
     const char** param_names;
+    
+    // Batched evaluation: params are validated once for all count values
+    int (*pdf_batch)(const double* x, double* out, size_t count, double* params, int param_count);
+    int (*cdf_batch)(const double* x, double* out, size_t count, double* params, int param_count);
+    
+    // Validates params and fills a prepared handle; returns 0 on success, -1 if invalid
+    int (*prepare)(double* params, int param_count, distribution_prepared_t* prepared);
 } distribution_t;
 
+/**
+ * @brief Prepared ("frozen") distribution handle
+ * Parameters are validated once and normalizers and branch selections are
+ * cached, so evaluating many x values for fixed parameters skips that work.
+ */
+struct distribution_prepared {
+    const distribution_t* distribution;
+    double params[MAX_PARAMETERS];
+    int param_count;
+    double constants[DISTRIBUTION_PREPARED_CONSTANTS];
+    int branch;  // distribution-specific evaluation path (e.g. normal approximation)
+    double (*pdf)(const distribution_prepared_t* prepared, double x);
+    double (*cdf)(const distribution_prepared_t* prepared, double x);
+    
+    // Single-precision path: constants_float mirrors constants, kernels may be NULL
+    distribution_precision_t precision;
+    float constants_float[DISTRIBUTION_PREPARED_CONSTANTS];
+    float (*pdf_float)(const distribution_prepared_t* prepared, float x);
+    float (*cdf_float)(const distribution_prepared_t* prepared, float x);
+    
+    // Optional CDF (returned) and survival function (*upper) from one evaluation,
+    // each without cancellation in its own tail; x is finite. NULL when the
+    // distribution has none, and callers fall back to 1 - cdf.
+    double (*tails)(const distribution_prepared_t* prepared, double x, double* upper);
+    
+    // Optional log-space kernels: log PDF, and log CDF (returned) with log SF
+    // (*log_upper) from one evaluation; x is finite. They stay finite where the
+    // linear values underflow. NULL falls back to the log of pdf / tails.
+    double (*logpdf)(const distribution_prepared_t* prepared, double x);
+    double (*log_tails)(const distribution_prepared_t* prepared, double x, double* log_upper);
+};
+
 /**
  * @brief Distribution categories
  */
@@ -46,7 +119,15 @@ typedef enum {
     DIST_NEGATIVE_BINOMIAL = 8,
     DIST_POISSON = 9,
     
-    DIST_COUNT = 10
+    // Continuous distributions added after the original ten (same ids as the JS engine)
+    DIST_UNIFORM = 10,
+    DIST_GAMMA = 11,
+    DIST_BETA = 12,
+    DIST_WEIBULL = 13,
+    DIST_PARETO = 14,
+    DIST_RAYLEIGH = 15,
+    
+    DIST_COUNT = 16
 } distribution_type_t;
 
 /**
@@ -67,5 +148,130 @@ typedef struct {
 const distribution_t* get_distribution(distribution_type_t type);
 const distribution_model_t* get_distribution_model(distribution_type_t type);
 int is_valid_distribution_type(distribution_type_t type);
+void distribution_fill_batch(double* out, size_t count, double value);
+
+/**
+ * @brief Prepared handle API
+ */
+int distribution_prepare(distribution_type_t type, double* params, int param_count, distribution_prepared_t* prepared);
+int distribution_prepare_with(const distribution_t* distribution, double* params, int param_count, distribution_prepared_t* prepared);
+double distribution_prepared_pdf(const distribution_prepared_t* prepared, double x);
+double distribution_prepared_cdf(const distribution_prepared_t* prepared, double x);
+int distribution_prepared_pdf_batch(const distribution_prepared_t* prepared, const double* x, double* out, size_t count);
+int distribution_prepared_cdf_batch(const distribution_prepared_t* prepared, const double* x, double* out, size_t count);
+distribution_type_t distribution_prepared_type(const distribution_prepared_t* prepared);
+
+/**
+ * @brief Precision selection
+ * The plain prepared calls above use the handle's precision (DOUBLE after
+ * prepare); the _precision variants override it for a single call, and the
+ * _float batches always take the single-precision path on float arrays.
+ */
+int distribution_prepared_set_precision(distribution_prepared_t* prepared, distribution_precision_t precision);
+double distribution_prepared_pdf_precision(const distribution_prepared_t* prepared, double x, distribution_precision_t precision);
+double distribution_prepared_cdf_precision(const distribution_prepared_t* prepared, double x, distribution_precision_t precision);
+int distribution_prepared_pdf_batch_float(const distribution_prepared_t* prepared, const float* x, float* out, size_t count);
+int distribution_prepared_cdf_batch_float(const distribution_prepared_t* prepared, const float* x, float* out, size_t count);
+
+/**
+ * @brief Survival function and interval probability
+ * The survival function P(X > x) comes from the handle's tails kernel, so
+ * it keeps full relative precision where the CDF is close to 1. The interval
+ * probability P(a < X <= b) differences whichever tail is smaller at the two
+ * ends.
+ * Both return NAN for an invalid handle or a NaN argument, and the interval
+ * is 0 when b <= a.
+ */
+double distribution_prepared_sf(const distribution_prepared_t* prepared, double x);
+double distribution_prepared_interval(const distribution_prepared_t* prepared, double a, double b);
+double distribution_sf(distribution_type_t type, double* params, int param_count, double x);
+double distribution_interval(distribution_type_t type, double* params, int param_count, double a, double b);
+
+/**
+ * @brief Log-space API
+ * log f(x), log F(x) and log(1 - F(x)) straight from the log-space kernels,
+ * for callers that combine probabilities (likelihoods, products of tails)
+ * and would otherwise exp and re-log, losing extreme tails to underflow.
+ * -INFINITY marks zero probability; NAN an invalid handle or a NaN argument.
+ */
+double distribution_prepared_logpdf(const distribution_prepared_t* prepared, double x);
+double distribution_prepared_logcdf(const distribution_prepared_t* prepared, double x);
+double distribution_prepared_logsf(const distribution_prepared_t* prepared, double x);
+double distribution_logpdf(distribution_type_t type, double* params, int param_count, double x);
+double distribution_logcdf(distribution_type_t type, double* params, int param_count, double x);
+double distribution_logsf(distribution_type_t type, double* params, int param_count, double x);
+
+/**
+ * @brief Series API for charts
+ * distribution_pmf_range fills consecutive integer support points by ratio
+ * recurrence; distribution_generate_series samples count evenly spaced points
+ * of [x_min, x_max] (integers with unit spacing go through the recurrence),
+ * and distribution_prepared_series does the same from an existing handle.
+ */
+int distribution_pmf_range(const distribution_prepared_t* prepared, int k_min, double* out, size_t count);
+int distribution_prepared_series(const distribution_prepared_t* prepared, double x_min, double x_max,
+                                 size_t count, double* out);
+int distribution_generate_series(distribution_type_t type, double* params, int param_count,
+                                 double x_min, double x_max, size_t count, double* out);
+
+/**
+ * @brief PMF table API for discrete distributions
+ * distribution_table_build fills a PMF array over the support, or over the
+ * points outside of which each tail holds at most DISTRIBUTION_TABLE_TAIL_MASS,
+ * with CDF and survival tables from compensated prefix and suffix sums, into
+ * caller storage of 3 * capacity doubles. The lookups then answer a PMF, CDF,
+ * survival or interval query, or a unit-spaced series, by indexing; they
+ * return -1 when the query reaches a left-out tail, so the caller falls back
+ * to the kernels. distribution_pmf_bounds gives the support of a handle.
+ */
+typedef struct {
+    int k_min;
+    size_t count;
+    double lower_mass;   // P(X < k_min), 0 when the table starts at the support minimum
+    double upper_mass;   // P(X > k_min + count - 1), 0 when it ends at the support maximum
+    const double* pmf;
+    const double* cdf;
+    const double* sf;
+} distribution_table_t;
+
+int distribution_pmf_bounds(const distribution_prepared_t* prepared, double* k_min, double* k_max);
+int distribution_table_build(const distribution_prepared_t* prepared, double* storage, size_t capacity,
+                             distribution_table_t* table);
+int distribution_table_point(const distribution_table_t* table, double x, double* pmf, double* cdf, double* sf);
+int distribution_table_interval(const distribution_table_t* table, double a, double b, double* probability);
+int distribution_table_series(const distribution_table_t* table, double x_min, double x_max, size_t count,
+                              double* out);
+
+/**
+ * @brief Adaptive series API for continuous charts
+ * Samples a coarse grid for a width_px by height_px chart and refines only
+ * the intervals that bend or step by more than a pixel threshold, at most
+ * max_evaluations points in all, written to out_x/out_y in increasing x.
+ * width_px is the level of detail: the same width gives the same points.
+ */
+int distribution_prepared_adaptive_series(const distribution_prepared_t* prepared, double x_min, double x_max,
+                                          int width_px, int height_px, size_t max_evaluations,
+                                          double* out_x, double* out_y, size_t* out_count);
+int distribution_adaptive_series(distribution_type_t type, double* params, int param_count,
+                                 double x_min, double x_max, int width_px, int height_px,
+                                 size_t max_evaluations, double* out_x, double* out_y, size_t* out_count);
+
+/**
+ * @brief Quantile (inverse CDF) API
+ * Initial guesses (Wilson–Hilferty, Cornish–Fisher, Paulson) are refined by
+ * safeguarded Halley/Newton steps against the distribution's own CDF.
+ */
+double distribution_quantile(distribution_type_t type, double* params, int param_count, double p);
+int distribution_quantile_batch(distribution_type_t type, double* params, int param_count,
+                                const double* p, double* out, size_t count);
+
+/**
+ * @brief Progressive evaluation support
+ * distribution_cdf_cost estimates the work of an exact CDF at x (PMF terms or
+ * series/continued-fraction iterations); distribution_cdf_preview returns a
+ * closed-form approximation of it, or -1 for types that have none.
+ */
+double distribution_cdf_cost(distribution_type_t type, const double* params, double x);
+int distribution_cdf_preview(distribution_type_t type, const double* params, double x, double* preview);
 
 #endif // DISTRIBUTION_INTERFACE_H
\ No newline at end of file
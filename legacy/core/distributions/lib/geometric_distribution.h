@@ -25,6 +25,28 @@ double geometric_pdf(double x, double* params, int param_count);
  */
 double geometric_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Geometric distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [p] where p is probability of success
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int geometric_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Geometric distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [p] where p is probability of success
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int geometric_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Geometric distribution parameters
  * @param params Array containing [p] where 0 < p <= 1
@@ -39,6 +61,11 @@ int geometric_validate_params(double* params, int param_count);
  */
 const distribution_t* get_geometric_distribution(void);
 
+/**
+ * @brief Geometric distribution interface object for static tables
+ */
+extern const distribution_t geometric_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,6 +31,34 @@ double hypergeometric_pdf(double x, double* params, int param_count);
  */
 double hypergeometric_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Hypergeometric distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [N, K, n] where:
+ *               N = population size
+ *               K = number of success states in population
+ *               n = number of draws (sample size)
+ * @param param_count Number of parameters (should be 3)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int hypergeometric_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Hypergeometric distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [N, K, n] where:
+ *               N = population size
+ *               K = number of success states in population
+ *               n = number of draws (sample size)
+ * @param param_count Number of parameters (should be 3)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int hypergeometric_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Hypergeometric distribution parameters
  * @param params Array containing [N, K, n] where:
@@ -48,6 +76,11 @@ int hypergeometric_validate_params(double* params, int param_count);
  */
 const distribution_t* get_hypergeometric_distribution(void);
 
+/**
+ * @brief Hypergeometric distribution interface object for static tables
+ */
+extern const distribution_t hypergeometric_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,32 @@ double negative_binomial_pdf(double x, double* params, int param_count);
  */
 double negative_binomial_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Negative Binomial distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [r, p] where:
+ *               r = number of successes (positive integer)
+ *               p = probability of success on each trial (0 < p <= 1)
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int negative_binomial_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Negative Binomial distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [r, p] where:
+ *               r = number of successes (positive integer)
+ *               p = probability of success on each trial (0 < p <= 1)
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int negative_binomial_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Negative Binomial distribution parameters
  * @param params Array containing [r, p] where:
@@ -45,6 +71,11 @@ int negative_binomial_validate_params(double* params, int param_count);
  */
 const distribution_t* get_negative_binomial_distribution(void);
 
+/**
+ * @brief Negative Binomial distribution interface object for static tables
+ */
+extern const distribution_t negative_binomial_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
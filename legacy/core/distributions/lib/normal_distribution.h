@@ -25,6 +25,28 @@ double normal_pdf(double x, double* params, int param_count);
  */
 double normal_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Normal distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [mean, standard_deviation]
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int normal_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Normal distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [mean, standard_deviation]
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int normal_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Normal distribution parameters
  * @param params Array containing [mean, standard_deviation]
@@ -39,6 +61,11 @@ int normal_validate_params(double* params, int param_count);
  */
 const distribution_t* get_normal_distribution(void);
 
+/**
+ * @brief Normal distribution interface object for static tables
+ */
+extern const distribution_t normal_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
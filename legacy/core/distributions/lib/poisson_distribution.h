@@ -27,6 +27,30 @@ double poisson_pdf(double x, double* params, int param_count);
  */
 double poisson_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Poisson distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [lambda] where:
+ *               lambda = rate parameter (average number of events)
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int poisson_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Poisson distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [lambda] where:
+ *               lambda = rate parameter (average number of events)
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int poisson_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Poisson distribution parameters
  * @param params Array containing [lambda] where:
@@ -42,6 +66,11 @@ int poisson_validate_params(double* params, int param_count);
  */
 const distribution_t* get_poisson_distribution(void);
 
+/**
+ * @brief Poisson distribution interface object for static tables
+ */
+extern const distribution_t poisson_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,28 @@ double rayleigh_pdf(double x, double* params, int param_count);
  */
 double rayleigh_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Rayleigh distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [scale]
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int rayleigh_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Rayleigh distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [scale]
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int rayleigh_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Rayleigh distribution parameters
  * @param params Array containing [scale]
@@ -39,6 +61,11 @@ int rayleigh_validate_params(double* params, int param_count);
  */
 const distribution_t* get_rayleigh_distribution(void);
 
+/**
+ * @brief Rayleigh distribution interface object for static tables
+ */
+extern const distribution_t rayleigh_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
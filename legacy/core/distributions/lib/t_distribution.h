@@ -25,6 +25,28 @@ double t_pdf(double x, double* params, int param_count);
  */
 double t_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Student's t-distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [degrees_of_freedom]
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int t_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Student's t-distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [degrees_of_freedom]
+ * @param param_count Number of parameters (should be 1)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int t_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Student's t-distribution parameters
  * @param params Array containing [degrees_of_freedom]
@@ -39,6 +61,11 @@ int t_validate_params(double* params, int param_count);
  */
 const distribution_t* get_t_distribution(void);
 
+/**
+ * @brief Student's t-distribution interface object for static tables
+ */
+extern const distribution_t t_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,28 @@ double uniform_pdf(double x, double* params, int param_count);
  */
 double uniform_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Uniform distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [a, b]
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int uniform_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Uniform distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [a, b]
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int uniform_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Uniform distribution parameters
  * @param params Array containing [a, b]
@@ -39,6 +61,11 @@ int uniform_validate_params(double* params, int param_count);
  */
 const distribution_t* get_uniform_distribution(void);
 
+/**
+ * @brief Uniform distribution interface object for static tables
+ */
+extern const distribution_t uniform_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,28 @@ double weibull_pdf(double x, double* params, int param_count);
  */
 double weibull_cdf(double x, double* params, int param_count);
 
+/**
+ * @brief Weibull distribution batched PDF calculation
+ * @param x Array of values at which to evaluate the PDF
+ * @param out Output array receiving one PDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [shape, scale]
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int weibull_pdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
+/**
+ * @brief Weibull distribution batched CDF calculation
+ * @param x Array of values at which to evaluate the CDF
+ * @param out Output array receiving one CDF value per input
+ * @param count Number of values in x and out
+ * @param params Array containing [shape, scale]
+ * @param param_count Number of parameters (should be 2)
+ * @return 0 on success, -1 if the arrays or parameters are invalid
+ */
+int weibull_cdf_batch(const double* x, double* out, size_t count, double* params, int param_count);
+
 /**
  * @brief Validate Weibull distribution parameters
  * @param params Array containing [shape, scale]
@@ -39,6 +61,11 @@ int weibull_validate_params(double* params, int param_count);
  */
 const distribution_t* get_weibull_distribution(void);
 
+/**
+ * @brief Weibull distribution interface object for static tables
+ */
+extern const distribution_t weibull_distribution_impl;
+
 #ifdef __cplusplus
 }
 #endif
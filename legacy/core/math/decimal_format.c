@@ -0,0 +1,598 @@
+#include "decimal_format.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Digits Grisu2 produces for a double, at most
+#define DECIMAL_FORMAT_MAX_DIGITS 17
+
+// Rounded precisions past this always defer to snprintf
+#define DECIMAL_FORMAT_MAX_KEEP 17
+
+// Target window for the scaled binary exponent, so integral digits fit 32 bits
+#define DECIMAL_GRISU_ALPHA (-60)
+#define DECIMAL_GRISU_GAMMA (-32)
+
+// JavaScript switches to exponential layout outside [1e-7, 1e21)
+#define DECIMAL_SHORTEST_MIN_POINT (-5)
+#define DECIMAL_SHORTEST_MAX_POINT 21
+
+/**
+ * @brief Unnormalized binary floating point: f * 2^e
+ */
+typedef struct {
+    uint64_t f;
+    int e;
+} decimal_diyfp_t;
+
+/**
+ * @brief Normalized 64-bit approximation of 10^k: f * 2^e
+ */
+typedef struct {
+    uint64_t f;
+    int e;
+    int k;
+} decimal_cached_power_t;
+
+#define DECIMAL_CACHED_POWERS_MIN_K (-300)
+#define DECIMAL_CACHED_POWERS_STEP 8
+
+// 10^k for k = -300, -292, ..., 324, rounded to nearest
+static const decimal_cached_power_t cached_powers[] = {
+    { UINT64_C(0xAB70FE17C79AC6CA), -1060, -300 },
+    { UINT64_C(0xFF77B1FCBEBCDC4F), -1034, -292 },
+    { UINT64_C(0xBE5691EF416BD60C), -1007, -284 },
+    { UINT64_C(0x8DD01FAD907FFC3C),  -980, -276 },
+    { UINT64_C(0xD3515C2831559A83),  -954, -268 },
+    { UINT64_C(0x9D71AC8FADA6C9B5),  -927, -260 },
+    { UINT64_C(0xEA9C227723EE8BCB),  -901, -252 },
+    { UINT64_C(0xAECC49914078536D),  -874, -244 },
+    { UINT64_C(0x823C12795DB6CE57),  -847, -236 },
+    { UINT64_C(0xC21094364DFB5637),  -821, -228 },
+    { UINT64_C(0x9096EA6F3848984F),  -794, -220 },
+    { UINT64_C(0xD77485CB25823AC7),  -768, -212 },
+    { UINT64_C(0xA086CFCD97BF97F4),  -741, -204 },
+    { UINT64_C(0xEF340A98172AACE5),  -715, -196 },
+    { UINT64_C(0xB23867FB2A35B28E),  -688, -188 },
+    { UINT64_C(0x84C8D4DFD2C63F3B),  -661, -180 },
+    { UINT64_C(0xC5DD44271AD3CDBA),  -635, -172 },
+    { UINT64_C(0x936B9FCEBB25C996),  -608, -164 },
+    { UINT64_C(0xDBAC6C247D62A584),  -582, -156 },
+    { UINT64_C(0xA3AB66580D5FDAF6),  -555, -148 },
+    { UINT64_C(0xF3E2F893DEC3F126),  -529, -140 },
+    { UINT64_C(0xB5B5ADA8AAFF80B8),  -502, -132 },
+    { UINT64_C(0x87625F056C7C4A8B),  -475, -124 },
+    { UINT64_C(0xC9BCFF6034C13053),  -449, -116 },
+    { UINT64_C(0x964E858C91BA2655),  -422, -108 },
+    { UINT64_C(0xDFF9772470297EBD),  -396, -100 },
+    { UINT64_C(0xA6DFBD9FB8E5B88F),  -369,  -92 },
+    { UINT64_C(0xF8A95FCF88747D94),  -343,  -84 },
+    { UINT64_C(0xB94470938FA89BCF),  -316,  -76 },
+    { UINT64_C(0x8A08F0F8BF0F156B),  -289,  -68 },
+    { UINT64_C(0xCDB02555653131B6),  -263,  -60 },
+    { UINT64_C(0x993FE2C6D07B7FAC),  -236,  -52 },
+    { UINT64_C(0xE45C10C42A2B3B06),  -210,  -44 },
+    { UINT64_C(0xAA242499697392D3),  -183,  -36 },
+    { UINT64_C(0xFD87B5F28300CA0E),  -157,  -28 },
+    { UINT64_C(0xBCE5086492111AEB),  -130,  -20 },
+    { UINT64_C(0x8CBCCC096F5088CC),  -103,  -12 },
+    { UINT64_C(0xD1B71758E219652C),   -77,   -4 },
+    { UINT64_C(0x9C40000000000000),   -50,    4 },
+    { UINT64_C(0xE8D4A51000000000),   -24,   12 },
+    { UINT64_C(0xAD78EBC5AC620000),     3,   20 },
+    { UINT64_C(0x813F3978F8940984),    30,   28 },
+    { UINT64_C(0xC097CE7BC90715B3),    56,   36 },
+    { UINT64_C(0x8F7E32CE7BEA5C70),    83,   44 },
+    { UINT64_C(0xD5D238A4ABE98068),   109,   52 },
+    { UINT64_C(0x9F4F2726179A2245),   136,   60 },
+    { UINT64_C(0xED63A231D4C4FB27),   162,   68 },
+    { UINT64_C(0xB0DE65388CC8ADA8),   189,   76 },
+    { UINT64_C(0x83C7088E1AAB65DB),   216,   84 },
+    { UINT64_C(0xC45D1DF942711D9A),   242,   92 },
+    { UINT64_C(0x924D692CA61BE758),   269,  100 },
+    { UINT64_C(0xDA01EE641A708DEA),   295,  108 },
+    { UINT64_C(0xA26DA3999AEF774A),   322,  116 },
+    { UINT64_C(0xF209787BB47D6B85),   348,  124 },
+    { UINT64_C(0xB454E4A179DD1877),   375,  132 },
+    { UINT64_C(0x865B86925B9BC5C2),   402,  140 },
+    { UINT64_C(0xC83553C5C8965D3D),   428,  148 },
+    { UINT64_C(0x952AB45CFA97A0B3),   455,  156 },
+    { UINT64_C(0xDE469FBD99A05FE3),   481,  164 },
+    { UINT64_C(0xA59BC234DB398C25),   508,  172 },
+    { UINT64_C(0xF6C69A72A3989F5C),   534,  180 },
+    { UINT64_C(0xB7DCBF5354E9BECE),   561,  188 },
+    { UINT64_C(0x88FCF317F22241E2),   588,  196 },
+    { UINT64_C(0xCC20CE9BD35C78A5),   614,  204 },
+    { UINT64_C(0x98165AF37B2153DF),   641,  212 },
+    { UINT64_C(0xE2A0B5DC971F303A),   667,  220 },
+    { UINT64_C(0xA8D9D1535CE3B396),   694,  228 },
+    { UINT64_C(0xFB9B7CD9A4A7443C),   720,  236 },
+    { UINT64_C(0xBB764C4CA7A44410),   747,  244 },
+    { UINT64_C(0x8BAB8EEFB6409C1A),   774,  252 },
+    { UINT64_C(0xD01FEF10A657842C),   800,  260 },
+    { UINT64_C(0x9B10A4E5E9913129),   827,  268 },
+    { UINT64_C(0xE7109BFBA19C0C9D),   853,  276 },
+    { UINT64_C(0xAC2820D9623BF429),   880,  284 },
+    { UINT64_C(0x80444B5E7AA7CF85),   907,  292 },
+    { UINT64_C(0xBF21E44003ACDD2D),   933,  300 },
+    { UINT64_C(0x8E679C2F5E44FF8F),   960,  308 },
+    { UINT64_C(0xD433179D9C8CB841),   986,  316 },
+    { UINT64_C(0x9E19DB92B4E31BA9),  1013,  324 }
+};
+
+static const double powers_of_ten[DECIMAL_FORMAT_MAX_KEEP + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+    1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17
+};
+
+static decimal_diyfp_t decimal_diyfp(uint64_t f, int e) {
+    decimal_diyfp_t result;
+    result.f = f;
+    result.e = e;
+    return result;
+}
+
+/**
+ * @brief x * y rounded to the upper 64 bits of the 128-bit product
+ */
+static decimal_diyfp_t decimal_diyfp_mul(decimal_diyfp_t x, decimal_diyfp_t y) {
+    uint64_t x_lo = x.f & 0xFFFFFFFFu;
+    uint64_t x_hi = x.f >> 32;
+    uint64_t y_lo = y.f & 0xFFFFFFFFu;
+    uint64_t y_hi = y.f >> 32;
+    
+    uint64_t p0 = x_lo * y_lo;
+    uint64_t p1 = x_lo * y_hi;
+    uint64_t p2 = x_hi * y_lo;
+    uint64_t p3 = x_hi * y_hi;
+    
+    uint64_t middle = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+    middle += UINT64_C(1) << 31;  // round
+    
+    return decimal_diyfp(p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32), x.e + y.e + 64);
+}
+
+static decimal_diyfp_t decimal_diyfp_normalize(decimal_diyfp_t x) {
+    while ((x.f >> 63) == 0) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+/**
+ * @brief Split a positive finite double into its normalized value and rounding boundaries
+ * Any decimal strictly between minus and plus reads back as value.
+ */
+static void decimal_boundaries(double value, decimal_diyfp_t* w, decimal_diyfp_t* minus, decimal_diyfp_t* plus) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    
+    uint64_t fraction = bits & ((UINT64_C(1) << 52) - 1);
+    int biased = (int)(bits >> 52);
+    decimal_diyfp_t v;
+    
+    if (biased != 0) {
+        v = decimal_diyfp(fraction | (UINT64_C(1) << 52), biased - 1075);
+    } else {
+        v = decimal_diyfp(fraction, -1074);
+    }
+    
+    // The gap below a power of two is half the gap above it
+    int lower_closer = (fraction == 0 && biased > 1);
+    decimal_diyfp_t m_plus = decimal_diyfp(2 * v.f + 1, v.e - 1);
+    decimal_diyfp_t m_minus = lower_closer ? decimal_diyfp(4 * v.f - 1, v.e - 2)
+                                           : decimal_diyfp(2 * v.f - 1, v.e - 1);
+    
+    *plus = decimal_diyfp_normalize(m_plus);
+    *minus = decimal_diyfp(m_minus.f << (m_minus.e - plus->e), plus->e);
+    *w = decimal_diyfp_normalize(v);
+}
+
+/**
+ * @brief Cached power c with ALPHA <= c.e + e + 64 <= GAMMA
+ */
+static const decimal_cached_power_t* decimal_cached_power(int e) {
+    // k = ceil((ALPHA - e - 1) * log10(2)), 78913 / 2^18 being log10(2)
+    int f = DECIMAL_GRISU_ALPHA - e - 1;
+    int k = (f * 78913) / (1 << 18) + (f > 0);
+    int index = (k - DECIMAL_CACHED_POWERS_MIN_K + DECIMAL_CACHED_POWERS_STEP - 1) / DECIMAL_CACHED_POWERS_STEP;
+    return &cached_powers[index];
+}
+
+/**
+ * @brief Largest power of ten not above n (n > 0), and its digit count
+ */
+static int decimal_largest_pow10(uint32_t n, uint32_t* pow10) {
+    int digits = 10;
+    uint32_t power = 1000000000u;
+    
+    while (power > n) {
+        power /= 10;
+        digits--;
+    }
+    *pow10 = power;
+    return digits;
+}
+
+/**
+ * @brief Step the last digit down while that moves it closer to the scaled value
+ */
+static void decimal_round_weed(char* digits, int length, uint64_t distance, uint64_t delta, uint64_t rest,
+                               uint64_t ten_k) {
+    while (rest < distance && delta - rest >= ten_k &&
+           (rest + ten_k < distance || distance - rest > rest + ten_k - distance)) {
+        digits[length - 1]--;
+        rest += ten_k;
+    }
+}
+
+/**
+ * @brief Generate the digits of M+ until they fall inside (M-, M+)
+ */
+static void decimal_digit_gen(char* digits, int* length, int* exponent, decimal_diyfp_t m_minus, decimal_diyfp_t w,
+                              decimal_diyfp_t m_plus) {
+    uint64_t delta = m_plus.f - m_minus.f;
+    uint64_t distance = m_plus.f - w.f;
+    int shift = -m_plus.e;
+    uint64_t one = UINT64_C(1) << shift;
+    uint32_t integral = (uint32_t)(m_plus.f >> shift);
+    uint64_t fractional = m_plus.f & (one - 1);
+    uint32_t pow10;
+    int n = decimal_largest_pow10(integral, &pow10);
+    
+    *length = 0;
+    
+    // Integral digits
+    while (n > 0) {
+        uint32_t digit = integral / pow10;
+        integral %= pow10;
+        digits[(*length)++] = (char)('0' + digit);
+        n--;
+        
+        uint64_t rest = ((uint64_t)integral << shift) + fractional;
+        if (rest <= delta) {
+            *exponent += n;
+            decimal_round_weed(digits, *length, distance, delta, rest, (uint64_t)pow10 << shift);
+            return;
+        }
+        pow10 /= 10;
+    }
+    
+    // Fractional digits; delta and distance scale with them
+    int m = 0;
+    for (;;) {
+        fractional *= 10;
+        digits[(*length)++] = (char)('0' + (fractional >> shift));
+        fractional &= one - 1;
+        m++;
+        delta *= 10;
+        distance *= 10;
+        if (fractional <= delta) {
+            break;
+        }
+    }
+    *exponent -= m;
+    decimal_round_weed(digits, *length, distance, delta, fractional, one);
+}
+
+/**
+ * @brief Shortest digits of a positive finite double: value ~ digits * 10^exponent
+ */
+static void decimal_grisu2(double value, char* digits, int* length, int* exponent) {
+    decimal_diyfp_t w;
+    decimal_diyfp_t minus;
+    decimal_diyfp_t plus;
+    
+    decimal_boundaries(value, &w, &minus, &plus);
+    
+    const decimal_cached_power_t* cached = decimal_cached_power(plus.e);
+    decimal_diyfp_t c = decimal_diyfp(cached->f, cached->e);
+    decimal_diyfp_t w_scaled = decimal_diyfp_mul(w, c);
+    decimal_diyfp_t minus_scaled = decimal_diyfp_mul(minus, c);
+    decimal_diyfp_t plus_scaled = decimal_diyfp_mul(plus, c);
+    
+    // Shrink the interval by one unit on each side to absorb the multiply's error
+    minus_scaled.f++;
+    plus_scaled.f--;
+    
+    *exponent = -cached->k;
+    decimal_digit_gen(digits, length, exponent, minus_scaled, w_scaled, plus_scaled);
+}
+
+/**
+ * @brief Copy a finished string out, or report that it did not fit
+ */
+static size_t decimal_emit(const char* text, size_t length, char* buffer, size_t size) {
+    if (!buffer || length >= size) {
+        if (buffer && size > 0) {
+            buffer[0] = '\0';
+        }
+        return 0;
+    }
+    memcpy(buffer, text, length);
+    buffer[length] = '\0';
+    return length;
+}
+
+/**
+ * @brief snprintf for the cases the fast path cannot decide
+ */
+static size_t decimal_fallback(const char* format, int decimals, double value, char* buffer, size_t size) {
+    if (!buffer || size == 0) {
+        return 0;
+    }
+    
+    int written = snprintf(buffer, size, format, decimals, value);
+    if (written < 0 || (size_t)written >= size) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return (size_t)written;
+}
+
+/**
+ * @brief Append e, the exponent's sign and at least min_digits of its magnitude
+ */
+static size_t decimal_write_exponent(char* text, int exponent, int min_digits) {
+    char reversed[8];
+    int count = 0;
+    size_t pos = 0;
+    unsigned magnitude = (unsigned)(exponent < 0 ? -exponent : exponent);
+    
+    text[pos++] = 'e';
+    text[pos++] = (exponent < 0) ? '-' : '+';
+    do {
+        reversed[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    while (count < min_digits) {
+        reversed[count++] = '0';
+    }
+    while (count > 0) {
+        text[pos++] = reversed[--count];
+    }
+    return pos;
+}
+
+/**
+ * @brief Round the shortest digits of magnitude to their first keep digits
+ * Writes keep digits to out, or keep + 1 ("10...0") when rounding carries
+ * out of the first digit, and returns their count. Returns -1 when the
+ * exact value may round differently from its shortest digits: the dropped
+ * digits are within the digits' own error of a tie, or padding with zeros
+ * would claim precision the double does not have.
+ */
+static int decimal_round_digits(double magnitude, const char* digits, int length, int keep, char* out) {
+    double gap = nextafter(magnitude, INFINITY) - magnitude;
+    double relative = gap / magnitude;
+    
+    if (keep > DECIMAL_FORMAT_MAX_KEEP || !isfinite(relative)) {
+        return -1;
+    }
+    
+    if (keep < 0) {
+        // Below half a unit of the last kept place
+        return 0;
+    }
+    
+    if (keep >= length) {
+        if (2.0 * relative * powers_of_ten[keep] >= 0.5) {
+            return -1;
+        }
+        memcpy(out, digits, (size_t)length);
+        memset(out + length, '0', (size_t)(keep - length));
+        return keep;
+    }
+    
+    // Dropped digits against half a unit of the last kept place, in units of the last digit
+    uint64_t whole = 0;
+    uint64_t rest = 0;
+    uint64_t half = 5;
+    for (int i = 0; i < length; i++) {
+        whole = whole * 10 + (uint64_t)(digits[i] - '0');
+        if (i >= keep) {
+            rest = rest * 10 + (uint64_t)(digits[i] - '0');
+            if (i > keep) {
+                half *= 10;
+            }
+        }
+    }
+    
+    double uncertainty = relative * (double)whole;
+    double distance = (rest > half) ? (double)(rest - half) : (double)(half - rest);
+    if (distance <= 2.0 * uncertainty + 1.0) {
+        return -1;
+    }
+    
+    memcpy(out, digits, (size_t)keep);
+    if (rest < half) {
+        return keep;
+    }
+    
+    for (int i = keep - 1; i >= 0; i--) {
+        if (out[i] != '9') {
+            out[i]++;
+            return keep;
+        }
+        out[i] = '0';
+    }
+    
+    // Carried out of the first digit: 9.99 -> 10.00
+    out[0] = '1';
+    memset(out + 1, '0', (size_t)keep);
+    return keep + 1;
+}
+
+/**
+ * @brief Shortest round-trip decimal
+ * @param value Value to format
+ * @param buffer Output buffer
+ * @param size Size of the buffer
+ * @return Length written, or 0 if it did not fit
+ */
+size_t decimal_format_shortest(double value, char* buffer, size_t size) {
+    char text[DECIMAL_FORMAT_SHORTEST_MAX];
+    char digits[DECIMAL_FORMAT_MAX_DIGITS + 1];
+    size_t pos = 0;
+    int length;
+    int exponent;
+    
+    if (isnan(value)) {
+        return decimal_emit("NaN", 3, buffer, size);
+    }
+    
+    // Before the sign, so -0.0 prints "0" as Number toString does
+    if (value == 0.0) {
+        return decimal_emit("0", 1, buffer, size);
+    }
+    
+    if (signbit(value)) {
+        text[pos++] = '-';
+        value = -value;
+    }
+    
+    if (isinf(value)) {
+        memcpy(text + pos, "Infinity", 8);
+        return decimal_emit(text, pos + 8, buffer, size);
+    }
+    
+    decimal_grisu2(value, digits, &length, &exponent);
+    
+    // Decimal point position: value = 0.digits * 10^point
+    int point = length + exponent;
+    
+    if (length <= point && point <= DECIMAL_SHORTEST_MAX_POINT) {
+        memcpy(text + pos, digits, (size_t)length);
+        pos += (size_t)length;
+        memset(text + pos, '0', (size_t)(point - length));
+        pos += (size_t)(point - length);
+    } else if (0 < point && point <= DECIMAL_SHORTEST_MAX_POINT) {
+        memcpy(text + pos, digits, (size_t)point);
+        pos += (size_t)point;
+        text[pos++] = '.';
+        memcpy(text + pos, digits + point, (size_t)(length - point));
+        pos += (size_t)(length - point);
+    } else if (DECIMAL_SHORTEST_MIN_POINT <= point && point <= 0) {
+        text[pos++] = '0';
+        text[pos++] = '.';
+        memset(text + pos, '0', (size_t)(-point));
+        pos += (size_t)(-point);
+        memcpy(text + pos, digits, (size_t)length);
+        pos += (size_t)length;
+    } else {
+        text[pos++] = digits[0];
+        if (length > 1) {
+            text[pos++] = '.';
+            memcpy(text + pos, digits + 1, (size_t)(length - 1));
+            pos += (size_t)(length - 1);
+        }
+        pos += decimal_write_exponent(text + pos, point - 1, 1);
+    }
+    
+    return decimal_emit(text, pos, buffer, size);
+}
+
+/**
+ * @brief Fixed-point formatting matching "%.*f"
+ * @param value Value to format
+ * @param decimals Digits after the point
+ * @param buffer Output buffer
+ * @param size Size of the buffer
+ * @return Length written, or 0 if it did not fit
+ */
+size_t decimal_format_fixed(double value, int decimals, char* buffer, size_t size) {
+    char text[DECIMAL_FORMAT_MAX_KEEP + 8];
+    char digits[DECIMAL_FORMAT_MAX_DIGITS + 1];
+    char rounded[DECIMAL_FORMAT_MAX_KEEP + 2];
+    double magnitude = fabs(value);
+    size_t pos = 0;
+    int count = 0;
+    
+    if (!isfinite(value) || decimals < 0 || decimals > DECIMAL_FORMAT_MAX_KEEP) {
+        return decimal_fallback("%.*f", decimals, value, buffer, size);
+    }
+    
+    if (magnitude != 0.0) {
+        int length;
+        int exponent;
+        decimal_grisu2(magnitude, digits, &length, &exponent);
+        count = decimal_round_digits(magnitude, digits, length, length + exponent + decimals, rounded);
+        if (count < 0) {
+            return decimal_fallback("%.*f", decimals, value, buffer, size);
+        }
+    }
+    
+    // rounded holds the result in units of 10^-decimals
+    if (signbit(value)) {
+        text[pos++] = '-';
+    }
+    
+    if (count > decimals) {
+        memcpy(text + pos, rounded, (size_t)(count - decimals));
+        pos += (size_t)(count - decimals);
+    } else {
+        text[pos++] = '0';
+    }
+    
+    if (decimals > 0) {
+        int leading = (count < decimals) ? decimals - count : 0;
+        text[pos++] = '.';
+        memset(text + pos, '0', (size_t)leading);
+        pos += (size_t)leading;
+        memcpy(text + pos, rounded + (count - decimals + leading), (size_t)(decimals - leading));
+        pos += (size_t)(decimals - leading);
+    }
+    
+    return decimal_emit(text, pos, buffer, size);
+}
+
+/**
+ * @brief Scientific formatting matching "%.*e"
+ * @param value Value to format
+ * @param decimals Mantissa digits after the point
+ * @param buffer Output buffer
+ * @param size Size of the buffer
+ * @return Length written, or 0 if it did not fit
+ */
+size_t decimal_format_scientific(double value, int decimals, char* buffer, size_t size) {
+    char text[DECIMAL_FORMAT_MAX_KEEP + 16];
+    char digits[DECIMAL_FORMAT_MAX_DIGITS + 1];
+    char rounded[DECIMAL_FORMAT_MAX_KEEP + 2];
+    double magnitude = fabs(value);
+    int keep = decimals + 1;
+    int point = 0;
+    size_t pos = 0;
+    
+    if (!isfinite(value) || decimals < 0 || keep > DECIMAL_FORMAT_MAX_KEEP) {
+        return decimal_fallback("%.*e", decimals, value, buffer, size);
+    }
+    
+    if (magnitude == 0.0) {
+        memset(rounded, '0', (size_t)keep);
+    } else {
+        int length;
+        int exponent;
+        decimal_grisu2(magnitude, digits, &length, &exponent);
+        int count = decimal_round_digits(magnitude, digits, length, keep, rounded);
+        if (count < 0) {
+            return decimal_fallback("%.*e", decimals, value, buffer, size);
+        }
+        // A carry adds a digit: 9.99e+00 -> 1.000e+01, printed as 1.00e+01
+        point = length + exponent - 1 + (count - keep);
+    }
+    
+    if (signbit(value)) {
+        text[pos++] = '-';
+    }
+    text[pos++] = rounded[0];
+    if (decimals > 0) {
+        text[pos++] = '.';
+        memcpy(text + pos, rounded + 1, (size_t)decimals);
+        pos += (size_t)decimals;
+    }
+    pos += decimal_write_exponent(text + pos, point, 2);
+    
+    return decimal_emit(text, pos, buffer, size);
+}
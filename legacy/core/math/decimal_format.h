@@ -0,0 +1,45 @@
+#ifndef DECIMAL_FORMAT_H
+#define DECIMAL_FORMAT_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Buffer size that fits any output of decimal_format_shortest
+#define DECIMAL_FORMAT_SHORTEST_MAX 32
+
+/**
+ * @brief Shortest decimal that reads back as the same double
+ * Digits come from Grisu2 (one 64-bit multiply by a cached power of ten), so
+ * the text always round-trips through strtod or JSON.parse and is the
+ * shortest such string for nearly all inputs. Layout follows JavaScript's
+ * Number toString: plain decimal for 1e-7 <= |value| < 1e21, otherwise
+ * d.ddde+XX. Zero of either sign prints as 0, and non-finite values as NaN,
+ * Infinity and -Infinity.
+ * @return Length written excluding the terminator, or 0 if size is too small
+ */
+size_t decimal_format_shortest(double value, char* buffer, size_t size);
+
+/**
+ * @brief Fixed-point text, identical to snprintf "%.*f"
+ * Rounds the shortest digits at the requested place and defers to snprintf
+ * when that digit is too close to a tie to decide, or the value needs more
+ * than fifteen significant digits.
+ * @return Length written excluding the terminator, or 0 if size is too small
+ */
+size_t decimal_format_fixed(double value, int decimals, char* buffer, size_t size);
+
+/**
+ * @brief Scientific text, identical to snprintf "%.*e"
+ * Same rounding and fallback rules as decimal_format_fixed.
+ * @return Length written excluding the terminator, or 0 if size is too small
+ */
+size_t decimal_format_scientific(double value, int decimals, char* buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DECIMAL_FORMAT_H
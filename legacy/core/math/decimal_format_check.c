@@ -0,0 +1,148 @@
+#include "decimal_format.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Host check of decimal_format against JavaScript's Number toString layout,
+// strtod and snprintf
+// Usage: decimal_format_check [random-values]
+// Prints each mismatch and exits 1 if there was any. Built by the
+// decimal_format_check target of the top-level CMakeLists.txt.
+
+#define DEFAULT_RANDOM_VALUES 200000
+
+/**
+ * A value and the text Number.prototype.toString gives for it
+ */
+typedef struct {
+    double value;
+    const char* expected;
+} shortest_case_t;
+
+static const shortest_case_t shortest_cases[] = {
+    {0.0, "0"},
+    {-0.0, "0"},
+    {1.0, "1"},
+    {-1.5, "-1.5"},
+    {0.1, "0.1"},
+    {0.30000000000000004, "0.30000000000000004"},
+    {123.456, "123.456"},
+    {1e-6, "0.000001"},
+    {1e-7, "1e-7"},
+    {-2.5e-8, "-2.5e-8"},
+    {1e20, "100000000000000000000"},
+    {1e21, "1e+21"},
+    {123456789012345680000.0, "123456789012345680000"},
+    {5e-324, "5e-324"},
+    {1.7976931348623157e308, "1.7976931348623157e+308"},
+    {INFINITY, "Infinity"},
+    {-INFINITY, "-Infinity"},
+    {NAN, "NaN"},
+};
+
+/**
+ * Deterministic 64-bit generator (splitmix64), so failures reproduce
+ */
+static uint64_t check_next_random(uint64_t* state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static int check_shortest_cases(void) {
+    char text[DECIMAL_FORMAT_SHORTEST_MAX];
+    int failures = 0;
+    
+    for (size_t i = 0; i < sizeof(shortest_cases) / sizeof(shortest_cases[0]); i++) {
+        decimal_format_shortest(shortest_cases[i].value, text, sizeof(text));
+        if (strcmp(text, shortest_cases[i].expected) != 0) {
+            printf("shortest(%.17g): \"%s\", expected \"%s\"\n", shortest_cases[i].value, text,
+                   shortest_cases[i].expected);
+            failures++;
+        }
+    }
+    
+    return failures;
+}
+
+/**
+ * Fixed and scientific text of value against snprintf at a few precisions
+ */
+static int check_against_snprintf(double value) {
+    static const int decimals[] = {0, 2, 4, 9};
+    char text[400];
+    char expected[400];
+    int failures = 0;
+    
+    for (size_t i = 0; i < sizeof(decimals) / sizeof(decimals[0]); i++) {
+        decimal_format_scientific(value, decimals[i], text, sizeof(text));
+        snprintf(expected, sizeof(expected), "%.*e", decimals[i], value);
+        if (strcmp(text, expected) != 0) {
+            printf("scientific(%.17g, %d): \"%s\", expected \"%s\"\n", value, decimals[i], text, expected);
+            failures++;
+        }
+    
+        if (fabs(value) < 1e30) {
+            decimal_format_fixed(value, decimals[i], text, sizeof(text));
+            snprintf(expected, sizeof(expected), "%.*f", decimals[i], value);
+            if (strcmp(text, expected) != 0) {
+                printf("fixed(%.17g, %d): \"%s\", expected \"%s\"\n", value, decimals[i], text, expected);
+                failures++;
+            }
+        }
+    }
+    
+    return failures;
+}
+
+/**
+ * Shortest text of random finite doubles must read back as the same bits
+ */
+static int check_random_values(long count) {
+    char text[DECIMAL_FORMAT_SHORTEST_MAX];
+    uint64_t state = 0x243f6a8885a308d3ull;
+    int failures = 0;
+    
+    for (long i = 0; i < count && failures < 20; i++) {
+        uint64_t bits = check_next_random(&state);
+        double value;
+    
+        memcpy(&value, &bits, sizeof(value));
+        if (!isfinite(value)) {
+            continue;
+        }
+    
+        decimal_format_shortest(value, text, sizeof(text));
+        if (strtod(text, NULL) != value) {
+            printf("shortest(%.17g): \"%s\" does not read back\n", value, text);
+            failures++;
+        }
+    
+        // Values a calculator shows, where fixed and scientific are used
+        double shown = ldexp((double)(bits >> 11), -53) * pow(10.0, (double)(int)(bits % 24) - 12.0);
+        failures += check_against_snprintf((bits & 1) ? -shown : shown);
+    }
+    
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    long count = (argc > 1) ? atol(argv[1]) : DEFAULT_RANDOM_VALUES;
+    int failures = 0;
+    
+    if (count < 0) {
+        fprintf(stderr, "usage: %s [random-values]\n", argv[0]);
+        return 2;
+    }
+    
+    failures += check_shortest_cases();
+    failures += check_against_snprintf(0.0);
+    failures += check_against_snprintf(-0.0);
+    failures += check_random_values(count);
+    
+    printf("%d mismatch(es)\n", failures);
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,206 @@
+#include "decimal_parser.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Largest significand digits carried exactly in a uint64_t
+#define DECIMAL_MAX_DIGITS 19
+
+// Integers up to 2^53 are exact doubles
+#define DECIMAL_MAX_EXACT_INTEGER (UINT64_C(1) << 53)
+
+// Powers of ten exactly representable as doubles
+#define DECIMAL_MAX_EXACT_POWER 22
+
+// Exponents past this only matter for overflow or underflow, which strtod handles
+#define DECIMAL_EXPONENT_CAP 100000
+
+static const double exact_powers_of_ten[DECIMAL_MAX_EXACT_POWER + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static int decimal_is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static int decimal_is_separator(char c) {
+    return c == ',' || c == ';' || decimal_is_space(c);
+}
+
+/**
+ * @brief Correctly rounded strtod on a bounded copy of the token
+ */
+static decimal_parse_status_t decimal_parse_slow(const char* text, size_t length, double* value) {
+    char buffer[DECIMAL_PARSE_MAX_TOKEN + 1];
+    char* end;
+
+    memcpy(buffer, text, length);
+    buffer[length] = '\0';
+    *value = strtod(buffer, &end);
+
+    if (end != buffer + length) return DECIMAL_PARSE_SYNTAX;
+    if (isinf(*value)) return DECIMAL_PARSE_RANGE;
+    return DECIMAL_PARSE_OK;
+}
+
+decimal_parse_status_t decimal_parse(const char* text, size_t length, double* value) {
+    if (!text || !value || length == 0) return DECIMAL_PARSE_SYNTAX;
+    if (length > DECIMAL_PARSE_MAX_TOKEN) return DECIMAL_PARSE_TOO_LONG;
+
+    size_t i = 0;
+    int negative = 0;
+    if (text[i] == '+' || text[i] == '-') {
+        negative = text[i] == '-';
+        i++;
+    }
+
+    // Significand: first DECIMAL_MAX_DIGITS significant digits, the rest only noted
+    uint64_t significand = 0;
+    int digits = 0;
+    int seen_digit = 0;
+    int truncated = 0;
+    int64_t exponent = 0;
+
+    for (; i < length && text[i] >= '0' && text[i] <= '9'; i++) {
+        int d = text[i] - '0';
+        seen_digit = 1;
+        if (significand == 0 && d == 0) continue;
+        if (digits < DECIMAL_MAX_DIGITS) {
+            significand = significand * 10 + (uint64_t)d;
+            digits++;
+        } else {
+            exponent++;
+            truncated |= d != 0;
+        }
+    }
+    if (i < length && text[i] == '.') {
+        for (i++; i < length && text[i] >= '0' && text[i] <= '9'; i++) {
+            int d = text[i] - '0';
+            seen_digit = 1;
+            if (significand == 0 && d == 0) {
+                exponent--;
+            } else if (digits < DECIMAL_MAX_DIGITS) {
+                significand = significand * 10 + (uint64_t)d;
+                digits++;
+                exponent--;
+            } else {
+                truncated |= d != 0;
+            }
+        }
+    }
+    if (!seen_digit) return DECIMAL_PARSE_SYNTAX;
+
+    if (i < length && (text[i] == 'e' || text[i] == 'E')) {
+        int exponent_negative = 0;
+        int64_t written = 0;
+
+        i++;
+        if (i < length && (text[i] == '+' || text[i] == '-')) {
+            exponent_negative = text[i] == '-';
+            i++;
+        }
+        if (i >= length || text[i] < '0' || text[i] > '9') return DECIMAL_PARSE_SYNTAX;
+        for (; i < length && text[i] >= '0' && text[i] <= '9'; i++) {
+            if (written < DECIMAL_EXPONENT_CAP) written = written * 10 + (text[i] - '0');
+        }
+        exponent += exponent_negative ? -written : written;
+    }
+    if (i != length) return DECIMAL_PARSE_SYNTAX;
+
+    if (significand == 0) {
+        *value = negative ? -0.0 : 0.0;
+        return DECIMAL_PARSE_OK;
+    }
+
+    // Clinger's fast path: both operands exact, so one IEEE operation rounds correctly
+    if (!truncated && significand <= DECIMAL_MAX_EXACT_INTEGER &&
+        exponent >= -DECIMAL_MAX_EXACT_POWER && exponent <= DECIMAL_MAX_EXACT_POWER + DECIMAL_MAX_DIGITS) {
+        double result;
+
+        if (exponent < 0) {
+            result = (double)significand / exact_powers_of_ten[-exponent];
+        } else {
+            // Move surplus powers into the significand while it stays exact
+            while (exponent > DECIMAL_MAX_EXACT_POWER && significand <= DECIMAL_MAX_EXACT_INTEGER / 10) {
+                significand *= 10;
+                exponent--;
+            }
+            if (exponent > DECIMAL_MAX_EXACT_POWER) return decimal_parse_slow(text, length, value);
+            result = (double)significand * exact_powers_of_ten[exponent];
+        }
+        *value = negative ? -result : result;
+        return DECIMAL_PARSE_OK;
+    }
+
+    return decimal_parse_slow(text, length, value);
+}
+
+size_t decimal_parse_field_bound(const char* text, size_t length) {
+    size_t fields = 0;
+    int in_field = 0;
+
+    if (!text) return 0;
+    for (size_t i = 0; i < length; i++) {
+        int separator = decimal_is_separator(text[i]);
+        // Tokens, plus one per comma or semicolon for a possibly empty field before it
+        if ((!separator && !in_field) || text[i] == ',' || text[i] == ';') fields++;
+        in_field = !separator;
+    }
+    return fields;
+}
+
+/**
+ * @brief Record a bad field if there is room; always counted
+ */
+static void decimal_report(decimal_parse_error_t* errors, size_t error_capacity, decimal_parse_result_t* result,
+                           size_t offset, size_t length, decimal_parse_status_t status) {
+    if (errors && result->error_count < error_capacity) {
+        errors[result->error_count].offset = offset;
+        errors[result->error_count].length = length;
+        errors[result->error_count].status = status;
+    }
+    result->error_count++;
+}
+
+int decimal_parse_list(const char* text, size_t length, double* values, size_t value_capacity,
+                       decimal_parse_error_t* errors, size_t error_capacity, decimal_parse_result_t* result) {
+    if (!text || !result || (!values && value_capacity > 0)) return -1;
+
+    result->value_count = 0;
+    result->error_count = 0;
+
+    size_t i = 0;
+    size_t overflow = 0;
+    int after_field = 0;  // a field ended since the last comma or semicolon
+
+    while (i < length && decimal_is_space(text[i])) i++;
+
+    while (i < length) {
+        if (text[i] == ',' || text[i] == ';') {
+            if (!after_field) decimal_report(errors, error_capacity, result, i, 0, DECIMAL_PARSE_EMPTY);
+            after_field = 0;
+            for (i++; i < length && decimal_is_space(text[i]); i++) {}
+            continue;
+        }
+
+        size_t start = i;
+        while (i < length && !decimal_is_separator(text[i])) i++;
+
+        double value;
+        decimal_parse_status_t status = decimal_parse(text + start, i - start, &value);
+        if (status != DECIMAL_PARSE_OK) {
+            decimal_report(errors, error_capacity, result, start, i - start, status);
+        } else if (result->value_count < value_capacity) {
+            values[result->value_count++] = value;
+        } else {
+            overflow++;
+        }
+        after_field = 1;
+
+        while (i < length && decimal_is_space(text[i])) i++;
+    }
+
+    // A trailing separator is tolerated, as pasted lists often end with one
+    return overflow ? -1 : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef DECIMAL_PARSER_H
+#define DECIMAL_PARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Longest token accepted, sign and exponent included
+#define DECIMAL_PARSE_MAX_TOKEN 128
+
+// Status of one parsed field
+typedef enum {
+    DECIMAL_PARSE_OK = 0,
+    DECIMAL_PARSE_SYNTAX = 1,     // not [+-]digits[.digits][e[+-]digits]
+    DECIMAL_PARSE_RANGE = 2,      // finite decimal that overflows a double
+    DECIMAL_PARSE_EMPTY = 3,      // nothing between two commas
+    DECIMAL_PARSE_TOO_LONG = 4    // longer than DECIMAL_PARSE_MAX_TOKEN
+} decimal_parse_status_t;
+
+/**
+ * @brief A field that failed to parse, located in the input buffer
+ */
+typedef struct {
+    size_t offset;
+    size_t length;
+    decimal_parse_status_t status;
+} decimal_parse_error_t;
+
+/**
+ * @brief Outcome of decimal_parse_list
+ * error_count counts every bad field, including any beyond error_capacity.
+ */
+typedef struct {
+    size_t value_count;
+    size_t error_count;
+} decimal_parse_result_t;
+
+/**
+ * @brief Parse one decimal token of length bytes, with no surrounding space
+ * Significands up to 2^53 with decimal exponents the double powers of ten
+ * represent exactly are converted with one multiply or divide (Clinger's
+ * fast path), which is correctly rounded; anything else defers to strtod.
+ */
+decimal_parse_status_t decimal_parse(const char* text, size_t length, double* value);
+
+/**
+ * @brief Upper bound on values plus errors from decimal_parse_list, for sizing either array
+ */
+size_t decimal_parse_field_bound(const char* text, size_t length);
+
+/**
+ * @brief Parse a comma, semicolon or whitespace separated list in one pass
+ * Runs of whitespace separate fields, as does one comma or semicolon with
+ * optional whitespace around it. Good fields are appended to values (up to
+ * value_capacity); bad ones are skipped and reported with their offset in
+ * errors (up to error_capacity). The buffer need not be NUL-terminated.
+ * @return 0 on success, -1 if values was too small or an argument is NULL
+ */
+int decimal_parse_list(const char* text, size_t length, double* values, size_t value_capacity,
+                       decimal_parse_error_t* errors, size_t error_capacity, decimal_parse_result_t* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DECIMAL_PARSER_H
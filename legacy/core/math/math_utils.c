@@ -1,6 +1,8 @@
 #include "math_utils.h"
+#include "../constants/statistical_tables.h"
 #include <math.h>
 #include <float.h>
+#include <string.h>
 
 // Lanczos coefficients for gamma function approximation
 static const double lanczos_coefficients[] = {
@@ -36,13 +38,28 @@ double gamma_function(double x) {
     }
     
     double t = x + lanczos_g + 0.5;
-    return lanczos_sqrt_2pi * pow(t, x + 0.5) * exp(-t) * a;
+    
+    // t^(x + 0.5) alone overflows from x = 142 on, though the product stays finite up to 170!
+    double half_power = pow(t, 0.5 * (x + 0.5));
+    return lanczos_sqrt_2pi * half_power * exp(-t) * half_power * a;
 }
 
 /**
  * Log gamma function for numerical stability with large values
+ * Integer and half-integer arguments (factorials, chi-square and t degrees
+ * of freedom) are served from the generated tables.
  */
 double log_gamma_function(double x) {
+    double twice = 2.0 * x;
+    
+    if (twice >= 1.0 && twice <= HALF_INTEGER_LOG_GAMMA_TABLE_SIZE && twice == floor(twice)) {
+        return half_integer_log_gamma_table[(int)twice - 1];
+    }
+    
+    if (x >= 1.0 && x <= LOG_FACTORIAL_TABLE_SIZE && x == floor(x)) {
+        return log_factorial_table[(int)x - 1];
+    }
+    
     if (x < 0.5) {
         // Use reflection formula in log space
         return log(M_PI_PRECISE) - log(sin(M_PI_PRECISE * x)) - log_gamma_function(1.0 - x);
@@ -70,6 +87,14 @@ double factorial(int n) {
     return gamma_function(n + 1.0);
 }
 
+// Extension of log_factorial_table up to LOG_FACTORIAL_CACHE_SIZE, filled on first use.
+// log(n!) > 0 for every cached n, so 0.0 marks an empty slot.
+#if LOG_FACTORIAL_CACHE_SIZE > LOG_FACTORIAL_TABLE_SIZE
+#define LOG_FACTORIAL_LAZY_SIZE (LOG_FACTORIAL_CACHE_SIZE - LOG_FACTORIAL_TABLE_SIZE)
+static double log_factorial_lazy[LOG_FACTORIAL_LAZY_SIZE];
+static int log_factorial_lazy_count = 0;
+#endif
+
 /**
  * Log factorial for numerical stability
  */
@@ -77,9 +102,55 @@ double log_factorial(int n) {
     if (n < 0) return NAN;
     if (n == 0 || n == 1) return 0.0;
     
+    if (n < LOG_FACTORIAL_TABLE_SIZE) return log_factorial_table[n];
+
+#ifdef LOG_FACTORIAL_LAZY_SIZE
+    if (n < LOG_FACTORIAL_CACHE_SIZE) {
+        double* slot = &log_factorial_lazy[n - LOG_FACTORIAL_TABLE_SIZE];
+        
+        if (*slot == 0.0) {
+            *slot = log_gamma_function(n + 1.0);
+            log_factorial_lazy_count++;
+        }
+        return *slot;
+    }
+#endif
+    
     return log_gamma_function(n + 1.0);
 }
 
+/**
+ * Number of n values served by the log-factorial cache
+ */
+int log_factorial_cache_size(void) {
+#ifdef LOG_FACTORIAL_LAZY_SIZE
+    return LOG_FACTORIAL_CACHE_SIZE;
+#else
+    return LOG_FACTORIAL_TABLE_SIZE;
+#endif
+}
+
+/**
+ * Number of cache entries currently available (generated plus lazily filled)
+ */
+int log_factorial_cache_entries(void) {
+#ifdef LOG_FACTORIAL_LAZY_SIZE
+    return LOG_FACTORIAL_TABLE_SIZE + log_factorial_lazy_count;
+#else
+    return LOG_FACTORIAL_TABLE_SIZE;
+#endif
+}
+
+/**
+ * Drop the lazily filled entries; the generated table is always kept
+ */
+void log_factorial_cache_clear(void) {
+#ifdef LOG_FACTORIAL_LAZY_SIZE
+    memset(log_factorial_lazy, 0, sizeof(log_factorial_lazy));
+    log_factorial_lazy_count = 0;
+#endif
+}
+
 /**
  * Combination function C(n,k) = n! / (k! * (n-k)!)
  */
@@ -104,40 +175,47 @@ double log_combination(int n, int k) {
     // Use symmetry: C(n,k) = C(n,n-k)
     if (k > n - k) k = n - k;
     
+    // Three cache lookups for n below LOG_FACTORIAL_CACHE_SIZE
     return log_factorial(n) - log_factorial(k) - log_factorial(n - k);
 }
 
 /**
- * Error function using rational approximation
- * Accurate to about 1.5e-7
+ * Error function (C99 libm erf)
+ * Batch callers should use vector_erf from vector_math.h
  */
 double error_function(double x) {
-    if (x == 0.0) return 0.0;
-    
-    // Constants for rational approximation
-    static const double a1 =  0.254829592;
-    static const double a2 = -0.284496736;
-    static const double a3 =  1.421413741;
-    static const double a4 = -1.453152027;
-    static const double a5 =  1.061405429;
-    static const double p  =  0.3275911;
-    
-    // Save the sign of x
-    int sign = (x >= 0) ? 1 : -1;
-    x = fabs(x);
-    
-    // A&S formula 7.1.26
-    double t = 1.0 / (1.0 + p * x);
-    double y = 1.0 - (((((a5 * t + a4) * t) + a3) * t + a2) * t + a1) * t * exp(-x * x);
-    
-    return sign * y;
+    return erf(x);
 }
 
 /**
  * Complementary error function
+ * Evaluated directly, so the upper tail keeps full relative precision
  */
 double complementary_error_function(double x) {
-    return 1.0 - error_function(x);
+    return erfc(x);
+}
+
+/**
+ * Natural log of the complementary error function
+ * Past x = 5, where erfc heads for underflow, uses erfc(x) = e^(-x²) / (√π K)
+ * with the continued fraction K = x + (1/2)/(x + (2/2)/(x + (3/2)/(x + ...))),
+ * evaluated bottom-up; 40 terms are plenty for x >= 5.
+ */
+double log_complementary_error_function(double x) {
+    if (isnan(x) || x < 5.0) {
+        return log(erfc(x));
+    }
+    
+    if (x == INFINITY) {
+        return -INFINITY;
+    }
+    
+    double k = x;
+    for (int n = 40; n >= 1; n--) {
+        k = x + 0.5 * n / k;
+    }
+    
+    return -x * x - 0.5 * log(M_PI_PRECISE) - log(k);
 }
 
 /**
@@ -233,4 +311,13 @@ double safe_log(double x) {
     if (x <= 0.0) return NAN;
     if (x < DBL_MIN) return -INFINITY;
     return log(x);
+}
+
+/**
+ * log(1 - e^x) for x <= 0 without cancellation at either end
+ * expm1 is exact near x = 0 and log1p once e^x is below 1/2 (Mächler's split at -ln 2).
+ */
+double log_one_minus_exp(double x) {
+    if (x > 0.0) return NAN;
+    return (x > -M_LN_2) ? log(-expm1(x)) : log1p(-exp(x));
 }
\ No newline at end of file
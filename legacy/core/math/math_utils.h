@@ -35,9 +35,20 @@ double log_factorial(int n);
 double combination(int n, int k);
 double log_combination(int n, int k);
 
+// Log-factorial cache: log(n!) for n < LOG_FACTORIAL_CACHE_SIZE is served from the
+// generated table and a lazily filled extension; override with -DLOG_FACTORIAL_CACHE_SIZE=N
+#ifndef LOG_FACTORIAL_CACHE_SIZE
+#define LOG_FACTORIAL_CACHE_SIZE 4096
+#endif
+
+int log_factorial_cache_size(void);
+int log_factorial_cache_entries(void);
+void log_factorial_cache_clear(void);
+
 // Error function for normal distribution
 double error_function(double x);
 double complementary_error_function(double x);
+double log_complementary_error_function(double x);  // log(erfc(x)), finite far past erfc's underflow
 double inverse_error_function(double x);
 
 // Beta function
@@ -50,6 +61,7 @@ bool is_valid_probability(double p);
 bool is_positive_integer(double x);
 double safe_exp(double x);
 double safe_log(double x);
+double log_one_minus_exp(double x);  // log(1 - e^x) for x <= 0
 
 #ifdef __cplusplus
 }
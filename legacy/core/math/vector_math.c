@@ -0,0 +1,635 @@
+#include "vector_math.h"
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+
+#if defined(VECTOR_MATH_NEON)
+#include <arm_neon.h>
+#elif defined(VECTOR_MATH_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(VECTOR_MATH_NEON) || defined(VECTOR_MATH_SSE2)
+
+// Fast-path domains; anything outside is evaluated by libm
+#define VM_EXP_MIN -708.0
+#define VM_EXP_MAX 709.0
+#define VM_ERFC_MAX 26.5
+#define VM_ERF_TAYLOR_CUTOFF 0.5
+
+// Adding 1.5 * 2^52 rounds to an integer held in the low mantissa bits
+#define VM_ROUND_MAGIC 6755399441055744.0
+
+// Cody-Waite split of ln(2); k * VM_LN2_HI is exact for |k| < 2^11
+#define VM_LN2_HI 6.93147180369123816490e-01
+#define VM_LN2_LO 1.90821492927058770002e-10
+#define VM_INV_LN2 1.44269504088896338700e+00
+#define VM_SQRT2 1.41421356237309504880
+#define VM_TWO_OVER_SQRT_PI 1.12837916709551257390
+
+// Veltkamp splitter 2^27 + 1, used to square x exactly as hi + lo
+#define VM_SPLITTER 134217729.0
+
+#define VM_EXP_TERMS 14
+#define VM_ERFC_TERMS 28
+#define VM_ERF_TERMS 13
+
+// 1/k! for k = 0..13
+static const double exp_coefficients[VM_EXP_TERMS] = {
+    1.0, 1.0, 0.5, 0.16666666666666666,
+    0.041666666666666664, 0.008333333333333333, 0.001388888888888889, 0.0001984126984126984,
+    2.48015873015873e-05, 2.7557319223985893e-06, 2.755731922398589e-07, 2.505210838544172e-08,
+    2.08767569878681e-09, 1.6059043836821613e-10
+};
+
+// fdlibm log minimax coefficients for 2*atanh(s) = 2s + s*R(s²)
+static const double log_coefficients[7] = {
+    6.666666666666735130e-01,
+    3.999999999940941908e-01,
+    2.857142874366239149e-01,
+    2.222219843214978396e-01,
+    1.818357216161805012e-01,
+    1.531383769920937332e-01,
+    1.479819860511658591e-01
+};
+
+// Chebyshev coefficients of log(erfc(x) e^(x²) (2 + x) / 2) in ty = 4t - 2, t = 2/(2 + x)
+static const double erfc_coefficients[VM_ERFC_TERMS] = {
+    -1.3026537197817094, 6.4196979235649026e-1, 1.9476473204185836e-2, -9.561514786808631e-3,
+    -9.46595344482036e-4, 3.66839497852761e-4, 4.2523324806907e-5, -2.0278578112534e-5,
+    -1.624290004647e-6, 1.303655835580e-6, 1.5626441722e-8, -8.5238095915e-8,
+    6.529054439e-9, 5.059343495e-9, -9.91364156e-10, -2.27365122e-10,
+    9.6467911e-11, 2.394038e-12, -6.886027e-12, 8.94487e-13,
+    3.13092e-13, -1.12708e-13, 3.81e-16, 7.106e-15,
+    -1.523e-15, -9.4e-17, 1.21e-16, -2.8e-17
+};
+
+// (-1)^n / (n! (2n + 1)) for the Maclaurin series of erf
+static const double erf_coefficients[VM_ERF_TERMS] = {
+    1.0, -0.3333333333333333, 0.1, -0.023809523809523808,
+    0.004629629629629629, -0.0007575757575757576, 0.00010683760683760684, -1.3227513227513228e-05,
+    1.4589169000933706e-06, -1.4503852223150468e-07, 1.3122532963802806e-08, -1.0892221037148573e-09,
+    8.35070279514724e-11
+};
+
+// Two-lane primitives over the selected instruction set
+#if defined(VECTOR_MATH_NEON)
+
+typedef float64x2_t vm_double;
+typedef uint64x2_t vm_bits;
+typedef uint64x2_t vm_mask;
+
+static inline vm_double vm_set(double v) { return vdupq_n_f64(v); }
+static inline vm_double vm_load(const double* p) { return vld1q_f64(p); }
+static inline void vm_store(double* p, vm_double v) { vst1q_f64(p, v); }
+static inline vm_double vm_add(vm_double a, vm_double b) { return vaddq_f64(a, b); }
+static inline vm_double vm_sub(vm_double a, vm_double b) { return vsubq_f64(a, b); }
+static inline vm_double vm_mul(vm_double a, vm_double b) { return vmulq_f64(a, b); }
+static inline vm_double vm_div(vm_double a, vm_double b) { return vdivq_f64(a, b); }
+static inline vm_double vm_abs(vm_double a) { return vabsq_f64(a); }
+static inline vm_double vm_min(vm_double a, vm_double b) { return vminq_f64(a, b); }
+static inline vm_double vm_max(vm_double a, vm_double b) { return vmaxq_f64(a, b); }
+static inline vm_mask vm_lt(vm_double a, vm_double b) { return vcltq_f64(a, b); }
+static inline vm_mask vm_gt(vm_double a, vm_double b) { return vcgtq_f64(a, b); }
+static inline vm_mask vm_ge(vm_double a, vm_double b) { return vcgeq_f64(a, b); }
+static inline vm_mask vm_and_mask(vm_mask a, vm_mask b) { return vandq_u64(a, b); }
+static inline int vm_all(vm_mask m) { return (vgetq_lane_u64(m, 0) & vgetq_lane_u64(m, 1)) != 0; }
+static inline int vm_any(vm_mask m) { return (vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1)) != 0; }
+static inline vm_double vm_select(vm_mask m, vm_double a, vm_double b) { return vbslq_f64(m, a, b); }
+static inline vm_bits vm_as_bits(vm_double a) { return vreinterpretq_u64_f64(a); }
+static inline vm_double vm_from_bits(vm_bits a) { return vreinterpretq_f64_u64(a); }
+static inline vm_bits vm_set_bits(uint64_t v) { return vdupq_n_u64(v); }
+static inline vm_bits vm_add_bits(vm_bits a, vm_bits b) { return vaddq_u64(a, b); }
+static inline vm_bits vm_and_bits(vm_bits a, vm_bits b) { return vandq_u64(a, b); }
+static inline vm_bits vm_or_bits(vm_bits a, vm_bits b) { return vorrq_u64(a, b); }
+static inline vm_bits vm_xor_bits(vm_bits a, vm_bits b) { return veorq_u64(a, b); }
+static inline vm_bits vm_shl52(vm_bits a) { return vshlq_n_u64(a, 52); }
+static inline vm_bits vm_shr52(vm_bits a) { return vshrq_n_u64(a, 52); }
+
+#else
+
+typedef __m128d vm_double;
+typedef __m128i vm_bits;
+typedef __m128d vm_mask;
+
+static inline vm_double vm_set(double v) { return _mm_set1_pd(v); }
+static inline vm_double vm_load(const double* p) { return _mm_loadu_pd(p); }
+static inline void vm_store(double* p, vm_double v) { _mm_storeu_pd(p, v); }
+static inline vm_double vm_add(vm_double a, vm_double b) { return _mm_add_pd(a, b); }
+static inline vm_double vm_sub(vm_double a, vm_double b) { return _mm_sub_pd(a, b); }
+static inline vm_double vm_mul(vm_double a, vm_double b) { return _mm_mul_pd(a, b); }
+static inline vm_double vm_div(vm_double a, vm_double b) { return _mm_div_pd(a, b); }
+static inline vm_double vm_abs(vm_double a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+static inline vm_double vm_min(vm_double a, vm_double b) { return _mm_min_pd(a, b); }
+static inline vm_double vm_max(vm_double a, vm_double b) { return _mm_max_pd(a, b); }
+static inline vm_mask vm_lt(vm_double a, vm_double b) { return _mm_cmplt_pd(a, b); }
+static inline vm_mask vm_gt(vm_double a, vm_double b) { return _mm_cmpgt_pd(a, b); }
+static inline vm_mask vm_ge(vm_double a, vm_double b) { return _mm_cmpge_pd(a, b); }
+static inline vm_mask vm_and_mask(vm_mask a, vm_mask b) { return _mm_and_pd(a, b); }
+static inline int vm_all(vm_mask m) { return _mm_movemask_pd(m) == 3; }
+static inline int vm_any(vm_mask m) { return _mm_movemask_pd(m) != 0; }
+static inline vm_double vm_select(vm_mask m, vm_double a, vm_double b) {
+    return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+}
+static inline vm_bits vm_as_bits(vm_double a) { return _mm_castpd_si128(a); }
+static inline vm_double vm_from_bits(vm_bits a) { return _mm_castsi128_pd(a); }
+static inline vm_bits vm_set_bits(uint64_t v) { return _mm_set1_epi64x((long long)v); }
+static inline vm_bits vm_add_bits(vm_bits a, vm_bits b) { return _mm_add_epi64(a, b); }
+static inline vm_bits vm_and_bits(vm_bits a, vm_bits b) { return _mm_and_si128(a, b); }
+static inline vm_bits vm_or_bits(vm_bits a, vm_bits b) { return _mm_or_si128(a, b); }
+static inline vm_bits vm_xor_bits(vm_bits a, vm_bits b) { return _mm_xor_si128(a, b); }
+static inline vm_bits vm_shl52(vm_bits a) { return _mm_slli_epi64(a, 52); }
+static inline vm_bits vm_shr52(vm_bits a) { return _mm_srli_epi64(a, 52); }
+
+#endif
+
+/**
+ * exp(hi + lo) per lane for hi + lo inside (VM_EXP_MIN, VM_EXP_MAX)
+ * lo carries low-order bits of the argument that would be lost in hi + lo.
+ * The low 12 bits of the rounded k are k itself, so (k + 1023) << 52 is 2^k.
+ */
+static inline vm_double vm_exp_kernel(vm_double hi, vm_double lo) {
+    vm_double magic = vm_set(VM_ROUND_MAGIC);
+    vm_double kd = vm_add(vm_mul(vm_add(hi, lo), vm_set(VM_INV_LN2)), magic);
+    vm_bits kbits = vm_as_bits(kd);
+    kd = vm_sub(kd, magic);
+    
+    vm_double r = vm_add(vm_sub(hi, vm_mul(kd, vm_set(VM_LN2_HI))),
+                         vm_sub(lo, vm_mul(kd, vm_set(VM_LN2_LO))));
+    vm_double p = vm_set(exp_coefficients[VM_EXP_TERMS - 1]);
+    for (int i = VM_EXP_TERMS - 2; i >= 0; i--) {
+        p = vm_add(vm_mul(p, r), vm_set(exp_coefficients[i]));
+    }
+    
+    vm_bits scale = vm_shl52(vm_add_bits(kbits, vm_set_bits(1023)));
+    return vm_mul(p, vm_from_bits(scale));
+}
+
+/**
+ * log(x) per lane for normal, finite, positive x
+ * The mantissa is kept in [√2/2, √2) so f = m - 1 stays small.
+ */
+static inline vm_double vm_log_kernel(vm_double x) {
+    vm_bits bits = vm_as_bits(x);
+    vm_bits biased = vm_or_bits(vm_shr52(bits), vm_set_bits(0x4330000000000000ULL));
+    vm_double e = vm_sub(vm_from_bits(biased), vm_set(4503599627370496.0 + 1023.0));
+    vm_double m = vm_from_bits(vm_or_bits(vm_and_bits(bits, vm_set_bits(0x000fffffffffffffULL)),
+                                          vm_set_bits(0x3ff0000000000000ULL)));
+    
+    vm_mask high = vm_gt(m, vm_set(VM_SQRT2));
+    m = vm_select(high, vm_mul(m, vm_set(0.5)), m);
+    e = vm_select(high, vm_add(e, vm_set(1.0)), e);
+    
+    vm_double f = vm_sub(m, vm_set(1.0));
+    vm_double s = vm_div(f, vm_add(vm_set(2.0), f));
+    vm_double z = vm_mul(s, s);
+    vm_double w = vm_mul(z, z);
+    vm_double t1 = vm_mul(w, vm_add(vm_set(log_coefficients[1]),
+                          vm_mul(w, vm_add(vm_set(log_coefficients[3]), vm_mul(w, vm_set(log_coefficients[5]))))));
+    vm_double t2 = vm_mul(z, vm_add(vm_set(log_coefficients[0]),
+                          vm_mul(w, vm_add(vm_set(log_coefficients[2]),
+                          vm_mul(w, vm_add(vm_set(log_coefficients[4]), vm_mul(w, vm_set(log_coefficients[6]))))))));
+    vm_double hfsq = vm_mul(vm_set(0.5), vm_mul(f, f));
+    vm_double inner = vm_add(vm_mul(s, vm_add(vm_add(hfsq, t1), t2)), vm_mul(e, vm_set(VM_LN2_LO)));
+    
+    return vm_sub(vm_mul(e, vm_set(VM_LN2_HI)), vm_sub(vm_sub(hfsq, inner), f));
+}
+
+/**
+ * erfc(ax) for 0 <= ax < VM_ERFC_MAX on VM_ERFC_BLOCK vectors at once
+ * erfc(x) = t exp(-x² + P(ty)) with t = 2/(2+x), ty = 4t - 2 and P a Chebyshev
+ * series evaluated by Clenshaw recurrence. x² is split exactly into hi + lo so
+ * the large exponent does not cost relative accuracy. The recurrence is one
+ * long dependency chain, so several vectors are interleaved to keep the FPU
+ * pipeline full.
+ */
+#define VM_ERFC_BLOCK 4
+
+static inline void vm_erfc_kernel(const vm_double* ax, vm_double* out) {
+    vm_double t[VM_ERFC_BLOCK];
+    vm_double ty[VM_ERFC_BLOCK];
+    vm_double d[VM_ERFC_BLOCK];
+    vm_double dd[VM_ERFC_BLOCK];
+    
+    for (int k = 0; k < VM_ERFC_BLOCK; k++) {
+        t[k] = vm_div(vm_set(2.0), vm_add(vm_set(2.0), ax[k]));
+        ty[k] = vm_sub(vm_mul(vm_set(4.0), t[k]), vm_set(2.0));
+        d[k] = vm_set(0.0);
+        dd[k] = vm_set(0.0);
+    }
+    
+    for (int j = VM_ERFC_TERMS - 1; j > 0; j--) {
+        vm_double coefficient = vm_set(erfc_coefficients[j]);
+        for (int k = 0; k < VM_ERFC_BLOCK; k++) {
+            vm_double tmp = d[k];
+            d[k] = vm_add(vm_mul(ty[k], d[k]), vm_sub(coefficient, dd[k]));
+            dd[k] = tmp;
+        }
+    }
+    
+    for (int k = 0; k < VM_ERFC_BLOCK; k++) {
+        vm_double series = vm_sub(vm_mul(vm_set(0.5), vm_add(vm_set(erfc_coefficients[0]), vm_mul(ty[k], d[k]))), dd[k]);
+        
+        vm_double c = vm_mul(vm_set(VM_SPLITTER), ax[k]);
+        vm_double ah = vm_sub(c, vm_sub(c, ax[k]));
+        vm_double al = vm_sub(ax[k], ah);
+        vm_double sq = vm_mul(ax[k], ax[k]);
+        vm_double sq_lo = vm_add(vm_add(vm_sub(vm_mul(ah, ah), sq), vm_mul(vm_set(2.0), vm_mul(ah, al))), vm_mul(al, al));
+        
+        out[k] = vm_mul(t[k], vm_exp_kernel(vm_sub(vm_set(0.0), sq), vm_sub(series, sq_lo)));
+    }
+}
+
+/**
+ * Load VM_ERFC_BLOCK vectors and their absolute values
+ * Returns 0 if any lane is outside the erfc kernel's domain.
+ */
+static inline int vm_load_erfc_block(const double* x, vm_double* v, vm_double* ax) {
+    vm_mask in_range = vm_lt(vm_set(0.0), vm_set(1.0));
+    
+    for (int k = 0; k < VM_ERFC_BLOCK; k++) {
+        v[k] = vm_load(x + 2 * k);
+        ax[k] = vm_abs(v[k]);
+        in_range = vm_and_mask(in_range, vm_lt(ax[k], vm_set(VM_ERFC_MAX)));
+    }
+    
+    return vm_all(in_range);
+}
+
+void vector_exp(const double* x, double* out, size_t count) {
+    size_t i = 0;
+    
+    for (; i + 2 <= count; i += 2) {
+        vm_double v = vm_load(x + i);
+        
+        if (vm_all(vm_and_mask(vm_gt(v, vm_set(VM_EXP_MIN)), vm_lt(v, vm_set(VM_EXP_MAX))))) {
+            vm_store(out + i, vm_exp_kernel(v, vm_set(0.0)));
+        } else {
+            out[i] = exp(x[i]);
+            out[i + 1] = exp(x[i + 1]);
+        }
+    }
+    
+    for (; i < count; i++) {
+        out[i] = exp(x[i]);
+    }
+}
+
+void vector_log(const double* x, double* out, size_t count) {
+    size_t i = 0;
+    
+    for (; i + 2 <= count; i += 2) {
+        vm_double v = vm_load(x + i);
+        
+        if (vm_all(vm_and_mask(vm_ge(v, vm_set(DBL_MIN)), vm_lt(v, vm_set(INFINITY))))) {
+            vm_store(out + i, vm_log_kernel(v));
+        } else {
+            out[i] = log(x[i]);
+            out[i + 1] = log(x[i + 1]);
+        }
+    }
+    
+    for (; i < count; i++) {
+        out[i] = log(x[i]);
+    }
+}
+
+void vector_erf(const double* x, double* out, size_t count) {
+    size_t i = 0;
+    
+    for (; i + 2 * VM_ERFC_BLOCK <= count; i += 2 * VM_ERFC_BLOCK) {
+        vm_double v[VM_ERFC_BLOCK];
+        vm_double ax[VM_ERFC_BLOCK];
+        vm_double tail[VM_ERFC_BLOCK];
+        
+        if (!vm_load_erfc_block(x + i, v, ax)) {
+            for (int k = 0; k < 2 * VM_ERFC_BLOCK; k++) {
+                out[i + k] = erf(x[i + k]);
+            }
+            continue;
+        }
+        
+        vm_erfc_kernel(ax, tail);
+        
+        for (int k = 0; k < VM_ERFC_BLOCK; k++) {
+            // 1 - erfc(|x|) with the sign of x restored
+            vm_bits sign = vm_and_bits(vm_as_bits(v[k]), vm_set_bits(0x8000000000000000ULL));
+            vm_double lower = vm_sub(vm_set(1.0), tail[k]);
+            vm_double result = vm_from_bits(vm_xor_bits(vm_as_bits(lower), sign));
+            
+            vm_mask small = vm_lt(ax[k], vm_set(VM_ERF_TAYLOR_CUTOFF));
+            if (vm_any(small)) {
+                vm_double x2 = vm_mul(v[k], v[k]);
+                vm_double p = vm_set(erf_coefficients[VM_ERF_TERMS - 1]);
+                for (int j = VM_ERF_TERMS - 2; j >= 0; j--) {
+                    p = vm_add(vm_mul(p, x2), vm_set(erf_coefficients[j]));
+                }
+                result = vm_select(small, vm_mul(v[k], vm_mul(vm_set(VM_TWO_OVER_SQRT_PI), p)), result);
+            }
+            
+            vm_store(out + i + 2 * k, result);
+        }
+    }
+    
+    for (; i < count; i++) {
+        out[i] = erf(x[i]);
+    }
+}
+
+void vector_erfc(const double* x, double* out, size_t count) {
+    size_t i = 0;
+    
+    for (; i + 2 * VM_ERFC_BLOCK <= count; i += 2 * VM_ERFC_BLOCK) {
+        vm_double v[VM_ERFC_BLOCK];
+        vm_double ax[VM_ERFC_BLOCK];
+        vm_double r[VM_ERFC_BLOCK];
+        
+        if (!vm_load_erfc_block(x + i, v, ax)) {
+            for (int k = 0; k < 2 * VM_ERFC_BLOCK; k++) {
+                out[i + k] = erfc(x[i + k]);
+            }
+            continue;
+        }
+        
+        vm_erfc_kernel(ax, r);
+        
+        for (int k = 0; k < VM_ERFC_BLOCK; k++) {
+            vm_mask negative = vm_lt(v[k], vm_set(0.0));
+            vm_store(out + i + 2 * k, vm_select(negative, vm_sub(vm_set(2.0), r[k]), r[k]));
+        }
+    }
+    
+    for (; i < count; i++) {
+        out[i] = erfc(x[i]);
+    }
+}
+
+#else
+
+void vector_exp(const double* x, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = exp(x[i]);
+    }
+}
+
+void vector_log(const double* x, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = log(x[i]);
+    }
+}
+
+void vector_erf(const double* x, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = erf(x[i]);
+    }
+}
+
+void vector_erfc(const double* x, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = erfc(x[i]);
+    }
+}
+
+#endif
+
+// Leaf size for pairwise summation; leaves are summed in four interleaved partials
+#define VM_PAIRWISE_BLOCK 128
+
+typedef double (*vm_leaf_t)(const double* x, const double* y, size_t count, double cx, double cy);
+
+#if defined(VECTOR_MATH_NEON) || defined(VECTOR_MATH_SSE2)
+
+static inline double vm_horizontal_sum(vm_double a, vm_double b) {
+    double lanes[2];
+    vm_store(lanes, vm_add(a, b));
+    return lanes[0] + lanes[1];
+}
+
+static double vm_sum_leaf(const double* x, const double* y, size_t count, double cx, double cy) {
+    vm_double acc0 = vm_set(0.0);
+    vm_double acc1 = vm_set(0.0);
+    size_t i = 0;
+    
+    (void)y;
+    (void)cx;
+    (void)cy;
+    for (; i + 4 <= count; i += 4) {
+        acc0 = vm_add(acc0, vm_load(x + i));
+        acc1 = vm_add(acc1, vm_load(x + i + 2));
+    }
+    
+    double sum = vm_horizontal_sum(acc0, acc1);
+    for (; i < count; i++) {
+        sum += x[i];
+    }
+    return sum;
+}
+
+static double vm_squares_leaf(const double* x, const double* y, size_t count, double cx, double cy) {
+    vm_double center = vm_set(cx);
+    vm_double acc0 = vm_set(0.0);
+    vm_double acc1 = vm_set(0.0);
+    size_t i = 0;
+    
+    (void)y;
+    (void)cy;
+    for (; i + 4 <= count; i += 4) {
+        vm_double d0 = vm_sub(vm_load(x + i), center);
+        vm_double d1 = vm_sub(vm_load(x + i + 2), center);
+        acc0 = vm_add(acc0, vm_mul(d0, d0));
+        acc1 = vm_add(acc1, vm_mul(d1, d1));
+    }
+    
+    double sum = vm_horizontal_sum(acc0, acc1);
+    for (; i < count; i++) {
+        double d = x[i] - cx;
+        sum += d * d;
+    }
+    return sum;
+}
+
+static double vm_products_leaf(const double* x, const double* y, size_t count, double cx, double cy) {
+    vm_double center_x = vm_set(cx);
+    vm_double center_y = vm_set(cy);
+    vm_double acc0 = vm_set(0.0);
+    vm_double acc1 = vm_set(0.0);
+    size_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        acc0 = vm_add(acc0, vm_mul(vm_sub(vm_load(x + i), center_x), vm_sub(vm_load(y + i), center_y)));
+        acc1 = vm_add(acc1, vm_mul(vm_sub(vm_load(x + i + 2), center_x), vm_sub(vm_load(y + i + 2), center_y)));
+    }
+    
+    double sum = vm_horizontal_sum(acc0, acc1);
+    for (; i < count; i++) {
+        sum += (x[i] - cx) * (y[i] - cy);
+    }
+    return sum;
+}
+
+#else
+
+static double vm_sum_leaf(const double* x, const double* y, size_t count, double cx, double cy) {
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    
+    (void)y;
+    (void)cx;
+    (void)cy;
+    for (; i + 4 <= count; i += 4) {
+        acc[0] += x[i];
+        acc[1] += x[i + 1];
+        acc[2] += x[i + 2];
+        acc[3] += x[i + 3];
+    }
+    
+    double sum = (acc[0] + acc[2]) + (acc[1] + acc[3]);
+    for (; i < count; i++) {
+        sum += x[i];
+    }
+    return sum;
+}
+
+static double vm_squares_leaf(const double* x, const double* y, size_t count, double cx, double cy) {
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    
+    (void)y;
+    (void)cy;
+    for (; i + 4 <= count; i += 4) {
+        for (int lane = 0; lane < 4; lane++) {
+            double d = x[i + lane] - cx;
+            acc[lane] += d * d;
+        }
+    }
+    
+    double sum = (acc[0] + acc[2]) + (acc[1] + acc[3]);
+    for (; i < count; i++) {
+        double d = x[i] - cx;
+        sum += d * d;
+    }
+    return sum;
+}
+
+static double vm_products_leaf(const double* x, const double* y, size_t count, double cx, double cy) {
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        for (int lane = 0; lane < 4; lane++) {
+            acc[lane] += (x[i + lane] - cx) * (y[i + lane] - cy);
+        }
+    }
+    
+    double sum = (acc[0] + acc[2]) + (acc[1] + acc[3]);
+    for (; i < count; i++) {
+        sum += (x[i] - cx) * (y[i] - cy);
+    }
+    return sum;
+}
+
+#endif
+
+/**
+ * Pairwise (cascade) summation of leaf results
+ * Rounding error grows with log2(count / VM_PAIRWISE_BLOCK) instead of count.
+ */
+static double vm_pairwise(vm_leaf_t leaf, const double* x, const double* y, size_t count, double cx, double cy) {
+    if (count <= VM_PAIRWISE_BLOCK) {
+        return leaf(x, y, count, cx, cy);
+    }
+    
+    size_t half = count / 2;
+    return vm_pairwise(leaf, x, y, half, cx, cy) +
+           vm_pairwise(leaf, x + half, y ? y + half : NULL, count - half, cx, cy);
+}
+
+double vector_sum(const double* x, size_t count) {
+    if (!x || count == 0) return 0.0;
+    return vm_pairwise(vm_sum_leaf, x, NULL, count, 0.0, 0.0);
+}
+
+double vector_sum_squares(const double* x, size_t count, double center) {
+    if (!x || count == 0) return 0.0;
+    return vm_pairwise(vm_squares_leaf, x, NULL, count, center, 0.0);
+}
+
+double vector_sum_products(const double* x, const double* y, size_t count, double center_x, double center_y) {
+    if (!x || !y || count == 0) return 0.0;
+    return vm_pairwise(vm_products_leaf, x, y, count, center_x, center_y);
+}
+
+void vector_min_max(const double* x, size_t count, double* min_out, double* max_out) {
+    double lo = INFINITY;
+    double hi = -INFINITY;
+    size_t i = 0;
+    
+    if (!x) count = 0;
+#if defined(VECTOR_MATH_NEON) || defined(VECTOR_MATH_SSE2)
+    if (count >= 2) {
+        vm_double vlo = vm_set(INFINITY);
+        vm_double vhi = vm_set(-INFINITY);
+        for (; i + 2 <= count; i += 2) {
+            vm_double v = vm_load(x + i);
+            vlo = vm_min(vlo, v);
+            vhi = vm_max(vhi, v);
+        }
+        
+        double lanes[2];
+        vm_store(lanes, vlo);
+        lo = lanes[0] < lanes[1] ? lanes[0] : lanes[1];
+        vm_store(lanes, vhi);
+        hi = lanes[0] > lanes[1] ? lanes[0] : lanes[1];
+    }
+#endif
+    for (; i < count; i++) {
+        if (x[i] < lo) lo = x[i];
+        if (x[i] > hi) hi = x[i];
+    }
+    
+    if (min_out) *min_out = lo;
+    if (max_out) *max_out = hi;
+}
+
+int vector_all_finite(const double* x, size_t count) {
+    size_t i = 0;
+    
+    if (!x) return count == 0;
+#if defined(VECTOR_MATH_NEON) || defined(VECTOR_MATH_SSE2)
+    vm_double limit = vm_set(DBL_MAX);
+    vm_mask finite = vm_ge(limit, limit);  // all lanes set
+    for (; i + 2 <= count; i += 2) {
+        // NaN fails every comparison, so |x| <= DBL_MAX is false for it and for ±inf
+        finite = vm_and_mask(finite, vm_ge(limit, vm_abs(vm_load(x + i))));
+    }
+    if (!vm_all(finite)) return 0;
+#endif
+    for (; i < count; i++) {
+        if (!isfinite(x[i])) return 0;
+    }
+    return 1;
+}
+
+void vector_difference(const double* a, const double* b, double* out, size_t count) {
+    size_t i = 0;
+    
+    if (!a || !b || !out) return;
+#if defined(VECTOR_MATH_NEON) || defined(VECTOR_MATH_SSE2)
+    for (; i + 2 <= count; i += 2) {
+        vm_store(out + i, vm_sub(vm_load(a + i), vm_load(b + i)));
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+const char* vector_math_backend(void) {
+#if defined(VECTOR_MATH_NEON)
+    return "neon";
+#elif defined(VECTOR_MATH_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef VECTOR_MATH_H
+#define VECTOR_MATH_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Batch exp/log/erf kernels for dense sweeps
+ * The backend is selected at build time: two-lane NEON on AArch64, SSE2 on
+ * x86, otherwise a plain libm loop (define VECTOR_MATH_FORCE_SCALAR to force
+ * it). Both SIMD backends evaluate the same polynomials in the same order.
+ *
+ * Measured max error of the SIMD lanes against long double references:
+ *   exp   < 1.5 ulp   (Cody-Waite reduction, degree 13 Taylor polynomial)
+ *   log   < 1 ulp     (fdlibm atanh-form minimax polynomial)
+ *   erf   < 2.5 ulp   (Maclaurin series for |x| < 0.5, 1 - erfc otherwise)
+ *   erfc  < 7 ulp     relative, for all x below the underflow point
+ *                     (Chebyshev fit of log(erfc(x) e^(x²)))
+ * That is about 1e-15 relative at worst, well inside the 1e-6 display target.
+ * Remainder elements and lanes outside the fast domain (overflow, underflow,
+ * subnormal, non-positive, NaN) are evaluated by libm, so special values match
+ * the scalar functions. Input and output buffers may alias.
+ */
+#if !defined(VECTOR_MATH_FORCE_SCALAR) && defined(__aarch64__) && defined(__ARM_NEON)
+#define VECTOR_MATH_NEON 1
+#elif !defined(VECTOR_MATH_FORCE_SCALAR) && (defined(__SSE2__) || defined(_M_X64))
+#define VECTOR_MATH_SSE2 1
+#endif
+
+void vector_exp(const double* x, double* out, size_t count);
+void vector_log(const double* x, double* out, size_t count);
+void vector_erf(const double* x, double* out, size_t count);
+void vector_erfc(const double* x, double* out, size_t count);
+
+/**
+ * @brief Reductions for descriptive statistics
+ * Sums use pairwise summation over SIMD leaf blocks, so the rounding error
+ * grows with log(count) rather than count and long arrays keep full accuracy.
+ * Squares and products are taken about caller-supplied centers (normally the
+ * mean from vector_sum), which is the two-pass variance: no sum(x²) - n·mean²
+ * cancellation. NaN inputs propagate into sums; vector_min_max expects finite
+ * input (check with vector_all_finite). Empty input gives 0, and +inf/-inf
+ * for min/max.
+ */
+double vector_sum(const double* x, size_t count);
+double vector_sum_squares(const double* x, size_t count, double center);
+double vector_sum_products(const double* x, const double* y, size_t count, double center_x, double center_y);
+void vector_min_max(const double* x, size_t count, double* min_out, double* max_out);
+int vector_all_finite(const double* x, size_t count);
+
+// out[i] = a[i] - b[i]; out may alias either input
+void vector_difference(const double* a, const double* b, double* out, size_t count);
+
+// Name of the compiled backend: "neon", "sse2" or "scalar"
+const char* vector_math_backend(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VECTOR_MATH_H
\ No newline at end of file
@@ -9,6 +9,12 @@
 #include "../../core/distributions/lib/binomial_distribution.h"
 #include "../../core/distributions/lib/negative_binomial_distribution.h"
 #include "../../core/distributions/lib/poisson_distribution.h"
+#include "../../core/distributions/lib/uniform_distribution.h"
+#include "../../core/distributions/lib/gamma_distribution.h"
+#include "../../core/distributions/lib/beta_distribution.h"
+#include "../../core/distributions/lib/weibull_distribution.h"
+#include "../../core/distributions/lib/pareto_distribution.h"
+#include "../../core/distributions/lib/rayleigh_distribution.h"
 #include <stddef.h>
 
 // Parameter names for each distribution
@@ -22,215 +28,285 @@ static const char* hypergeometric_param_names[] = {"population_size", "success_s
 static const char* binomial_param_names[] = {"trials", "probability"};
 static const char* negative_binomial_param_names[] = {"successes", "probability"};
 static const char* poisson_param_names[] = {"lambda"};
+static const char* uniform_param_names[] = {"a", "b"};
+static const char* gamma_param_names[] = {"shape", "scale"};
+static const char* beta_param_names[] = {"alpha", "beta"};
+static const char* weibull_param_names[] = {"shape", "scale"};
+static const char* pareto_param_names[] = {"scale", "shape"};
+static const char* rayleigh_param_names[] = {"scale"};
 
-// Distribution registry entries
-static distribution_registry_entry_t registry_entries[] = {
+// Distribution registry entries, indexed by distribution_type_t
+static const distribution_registry_entry_t registry_entries[DIST_COUNT] = {
     // Continuous distributions
-    {
+    [DIST_NORMAL] = {
         .type = DIST_NORMAL,
-        .name = "Normal",
         .description = "Normal (Gaussian) distribution",
-        .category = DISTRIBUTION_CONTINUOUS,
-        .param_count = 2,
-        .param_names = normal_param_names,
-        .param_ranges = {{-1000.0, 1000.0}, {0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL  // Will be set during initialization
+        .model = {
+            .distribution_id = DIST_NORMAL,
+            .name = "Normal",
+            .param_count = 2,
+            .param_names = normal_param_names,
+            .param_ranges = {{-1000.0, 1000.0}, {0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &normal_distribution_impl
     },
-    {
+    [DIST_EXPONENTIAL] = {
         .type = DIST_EXPONENTIAL,
-        .name = "Exponential",
         .description = "Exponential distribution",
-        .category = DISTRIBUTION_CONTINUOUS,
-        .param_count = 1,
-        .param_names = exponential_param_names,
-        .param_ranges = {{0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_EXPONENTIAL,
+            .name = "Exponential",
+            .param_count = 1,
+            .param_names = exponential_param_names,
+            .param_ranges = {{0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &exponential_distribution_impl
     },
-    {
+    [DIST_CHI_SQUARE] = {
         .type = DIST_CHI_SQUARE,
-        .name = "Chi-Square",
         .description = "Chi-square distribution",
-        .category = DISTRIBUTION_CONTINUOUS,
-        .param_count = 1,
-        .param_names = chi_square_param_names,
-        .param_ranges = {{1.0, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_CHI_SQUARE,
+            .name = "Chi-Square",
+            .param_count = 1,
+            .param_names = chi_square_param_names,
+            .param_ranges = {{1.0, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &chi_square_distribution_impl
     },
-    {
+    [DIST_T_DISTRIBUTION] = {
         .type = DIST_T_DISTRIBUTION,
-        .name = "t-Distribution",
         .description = "Student's t-distribution",
-        .category = DISTRIBUTION_CONTINUOUS,
-        .param_count = 1,
-        .param_names = t_param_names,
-        .param_ranges = {{1.0, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_T_DISTRIBUTION,
+            .name = "t-Distribution",
+            .param_count = 1,
+            .param_names = t_param_names,
+            .param_ranges = {{1.0, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &t_distribution_impl
     },
-    {
+    [DIST_F_DISTRIBUTION] = {
         .type = DIST_F_DISTRIBUTION,
-        .name = "F-Distribution",
         .description = "F-distribution",
-        .category = DISTRIBUTION_CONTINUOUS,
-        .param_count = 2,
-        .param_names = f_param_names,
-        .param_ranges = {{1.0, 1000.0}, {1.0, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_F_DISTRIBUTION,
+            .name = "F-Distribution",
+            .param_count = 2,
+            .param_names = f_param_names,
+            .param_ranges = {{1.0, 1000.0}, {1.0, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &f_distribution_impl
     },
     
     // Discrete distributions
-    {
+    [DIST_GEOMETRIC] = {
         .type = DIST_GEOMETRIC,
-        .name = "Geometric",
         .description = "Geometric distribution",
-        .category = DISTRIBUTION_DISCRETE,
-        .param_count = 1,
-        .param_names = geometric_param_names,
-        .param_ranges = {{0.001, 0.999}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_GEOMETRIC,
+            .name = "Geometric",
+            .param_count = 1,
+            .param_names = geometric_param_names,
+            .param_ranges = {{0.001, 0.999}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_DISCRETE
+        },
+        .distribution_impl = &geometric_distribution_impl
     },
-    {
+    [DIST_HYPERGEOMETRIC] = {
         .type = DIST_HYPERGEOMETRIC,
-        .name = "Hypergeometric",
         .description = "Hypergeometric distribution",
-        .category = DISTRIBUTION_DISCRETE,
-        .param_count = 3,
-        .param_names = hypergeometric_param_names,
-        .param_ranges = {{1.0, 10000.0}, {0.0, 10000.0}, {1.0, 10000.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_HYPERGEOMETRIC,
+            .name = "Hypergeometric",
+            .param_count = 3,
+            .param_names = hypergeometric_param_names,
+            .param_ranges = {{1.0, 10000.0}, {0.0, 10000.0}, {1.0, 10000.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_DISCRETE
+        },
+        .distribution_impl = &hypergeometric_distribution_impl
     },
-    {
+    [DIST_BINOMIAL] = {
         .type = DIST_BINOMIAL,
-        .name = "Binomial",
         .description = "Binomial distribution",
-        .category = DISTRIBUTION_DISCRETE,
-        .param_count = 2,
-        .param_names = binomial_param_names,
-        .param_ranges = {{1.0, 10000.0}, {0.001, 0.999}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_BINOMIAL,
+            .name = "Binomial",
+            .param_count = 2,
+            .param_names = binomial_param_names,
+            .param_ranges = {{1.0, 10000.0}, {0.001, 0.999}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_DISCRETE
+        },
+        .distribution_impl = &binomial_distribution_impl
     },
-    {
+    [DIST_NEGATIVE_BINOMIAL] = {
         .type = DIST_NEGATIVE_BINOMIAL,
-        .name = "Negative Binomial",
         .description = "Negative binomial distribution",
-        .category = DISTRIBUTION_DISCRETE,
-        .param_count = 2,
-        .param_names = negative_binomial_param_names,
-        .param_ranges = {{1.0, 10000.0}, {0.001, 0.999}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_NEGATIVE_BINOMIAL,
+            .name = "Negative Binomial",
+            .param_count = 2,
+            .param_names = negative_binomial_param_names,
+            .param_ranges = {{1.0, 10000.0}, {0.001, 0.999}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_DISCRETE
+        },
+        .distribution_impl = &negative_binomial_distribution_impl
     },
-    {
+    [DIST_POISSON] = {
         .type = DIST_POISSON,
-        .name = "Poisson",
         .description = "Poisson distribution",
-        .category = DISTRIBUTION_DISCRETE,
-        .param_count = 1,
-        .param_names = poisson_param_names,
-        .param_ranges = {{0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
-        .distribution_impl = NULL
+        .model = {
+            .distribution_id = DIST_POISSON,
+            .name = "Poisson",
+            .param_count = 1,
+            .param_names = poisson_param_names,
+            .param_ranges = {{0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_DISCRETE
+        },
+        .distribution_impl = &poisson_distribution_impl
+    },
+    
+    // Continuous distributions added after the original ten
+    [DIST_UNIFORM] = {
+        .type = DIST_UNIFORM,
+        .description = "Continuous uniform distribution",
+        .model = {
+            .distribution_id = DIST_UNIFORM,
+            .name = "Uniform",
+            .param_count = 2,
+            .param_names = uniform_param_names,
+            .param_ranges = {{-1000.0, 1000.0}, {-1000.0, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &uniform_distribution_impl
+    },
+    [DIST_GAMMA] = {
+        .type = DIST_GAMMA,
+        .description = "Gamma distribution",
+        .model = {
+            .distribution_id = DIST_GAMMA,
+            .name = "Gamma",
+            .param_count = 2,
+            .param_names = gamma_param_names,
+            .param_ranges = {{0.001, 1000.0}, {0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &gamma_distribution_impl
+    },
+    [DIST_BETA] = {
+        .type = DIST_BETA,
+        .description = "Beta distribution",
+        .model = {
+            .distribution_id = DIST_BETA,
+            .name = "Beta",
+            .param_count = 2,
+            .param_names = beta_param_names,
+            .param_ranges = {{0.001, 1000.0}, {0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &beta_distribution_impl
+    },
+    [DIST_WEIBULL] = {
+        .type = DIST_WEIBULL,
+        .description = "Weibull distribution",
+        .model = {
+            .distribution_id = DIST_WEIBULL,
+            .name = "Weibull",
+            .param_count = 2,
+            .param_names = weibull_param_names,
+            .param_ranges = {{0.001, 1000.0}, {0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &weibull_distribution_impl
+    },
+    [DIST_PARETO] = {
+        .type = DIST_PARETO,
+        .description = "Pareto (type I) distribution",
+        .model = {
+            .distribution_id = DIST_PARETO,
+            .name = "Pareto",
+            .param_count = 2,
+            .param_names = pareto_param_names,
+            .param_ranges = {{0.001, 1000.0}, {0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &pareto_distribution_impl
+    },
+    [DIST_RAYLEIGH] = {
+        .type = DIST_RAYLEIGH,
+        .description = "Rayleigh distribution",
+        .model = {
+            .distribution_id = DIST_RAYLEIGH,
+            .name = "Rayleigh",
+            .param_count = 1,
+            .param_names = rayleigh_param_names,
+            .param_ranges = {{0.001, 1000.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}},
+            .category = DISTRIBUTION_CONTINUOUS
+        },
+        .distribution_impl = &rayleigh_distribution_impl
     }
 };
 
+// Pointers into registry_entries grouped by category
+static const distribution_registry_entry_t* const continuous_distributions[] = {
+    &registry_entries[DIST_NORMAL],
+    &registry_entries[DIST_EXPONENTIAL],
+    &registry_entries[DIST_CHI_SQUARE],
+    &registry_entries[DIST_T_DISTRIBUTION],
+    &registry_entries[DIST_F_DISTRIBUTION],
+    &registry_entries[DIST_UNIFORM],
+    &registry_entries[DIST_GAMMA],
+    &registry_entries[DIST_BETA],
+    &registry_entries[DIST_WEIBULL],
+    &registry_entries[DIST_PARETO],
+    &registry_entries[DIST_RAYLEIGH]
+};
+
+static const distribution_registry_entry_t* const discrete_distributions[] = {
+    &registry_entries[DIST_GEOMETRIC],
+    &registry_entries[DIST_HYPERGEOMETRIC],
+    &registry_entries[DIST_BINOMIAL],
+    &registry_entries[DIST_NEGATIVE_BINOMIAL],
+    &registry_entries[DIST_POISSON]
+};
+
+#define CONTINUOUS_COUNT (sizeof(continuous_distributions) / sizeof(continuous_distributions[0]))
+#define DISCRETE_COUNT (sizeof(discrete_distributions) / sizeof(discrete_distributions[0]))
+
 // Registry structure
-static distribution_registry_t registry = {
+static const distribution_registry_t registry = {
     .entries = registry_entries,
     .total_count = DIST_COUNT,
-    .continuous_count = 5,  // Normal, Exponential, Chi-Square, t-Distribution, F-Distribution
-    .discrete_count = 5     // Geometric, Hypergeometric, Binomial, Negative Binomial, Poisson
+    .continuous_count = CONTINUOUS_COUNT,
+    .discrete_count = DISCRETE_COUNT,
+    .categories = {
+        [DISTRIBUTION_CONTINUOUS] = {continuous_distributions, CONTINUOUS_COUNT},
+        [DISTRIBUTION_DISCRETE] = {discrete_distributions, DISCRETE_COUNT}
+    }
 };
 
-// Static arrays for category-based lookups
-static const distribution_registry_entry_t* continuous_distributions[5];
-static const distribution_registry_entry_t* discrete_distributions[5];
-static int registry_initialized = 0;
-
-/**
- * @brief Initialize the registry with distribution implementations
- */
-static void initialize_registry(void) {
-    if (registry_initialized) {
-        return;
-    }
-    
-    // Initialize distribution implementations
-    // Connect C distribution implementations to registry entries
-    for (uint8_t i = 0; i < registry.total_count; i++) {
-        switch (registry_entries[i].type) {
-            case DIST_NORMAL:
-                registry_entries[i].distribution_impl = get_normal_distribution();
-                break;
-            case DIST_EXPONENTIAL:
-                registry_entries[i].distribution_impl = get_exponential_distribution();
-                break;
-            case DIST_CHI_SQUARE:
-                registry_entries[i].distribution_impl = get_chi_square_distribution();
-                break;
-            case DIST_T_DISTRIBUTION:
-                registry_entries[i].distribution_impl = get_t_distribution();
-                break;
-            case DIST_F_DISTRIBUTION:
-                registry_entries[i].distribution_impl = get_f_distribution();
-                break;
-            case DIST_GEOMETRIC:
-                registry_entries[i].distribution_impl = get_geometric_distribution();
-                break;
-            case DIST_HYPERGEOMETRIC:
-                registry_entries[i].distribution_impl = get_hypergeometric_distribution();
-                break;
-            case DIST_BINOMIAL:
-                registry_entries[i].distribution_impl = get_binomial_distribution();
-                break;
-            case DIST_NEGATIVE_BINOMIAL:
-                registry_entries[i].distribution_impl = get_negative_binomial_distribution();
-                break;
-            case DIST_POISSON:
-                registry_entries[i].distribution_impl = get_poisson_distribution();
-                break;
-            default:
-                registry_entries[i].distribution_impl = NULL;
-                break;
-        }
-    }
-    
-    // Populate category arrays
-    uint8_t continuous_idx = 0;
-    uint8_t discrete_idx = 0;
-    
-    for (uint8_t i = 0; i < registry.total_count; i++) {
-        if (registry_entries[i].category == DISTRIBUTION_CONTINUOUS) {
-            continuous_distributions[continuous_idx++] = &registry_entries[i];
-        } else {
-            discrete_distributions[discrete_idx++] = &registry_entries[i];
-        }
-    }
-    
-    registry_initialized = 1;
-}
+// Every type must appear in exactly one category list
+_Static_assert(CONTINUOUS_COUNT + DISCRETE_COUNT == DIST_COUNT, "registry category lists must cover every distribution type");
 
 const distribution_registry_t* get_distribution_registry(void) {
-    initialize_registry();
     return &registry;
 }
 
 const distribution_registry_entry_t* registry_get_distribution(distribution_type_t type) {
-    initialize_registry();
-    
-    if (type >= DIST_COUNT) {
+    // Entries are stored at their type's index, so lookup is a bounds check and an offset
+    if ((unsigned)type >= DIST_COUNT) {
         return NULL;
     }
     
-    // Find the entry with matching type
-    for (uint8_t i = 0; i < registry.total_count; i++) {
-        if (registry_entries[i].type == type) {
-            return &registry_entries[i];
-        }
-    }
-    
-    return NULL;
+    return &registry_entries[type];
 }
 
 const distribution_registry_entry_t* registry_get_distribution_by_index(uint8_t index) {
-    initialize_registry();
-    
     if (index >= registry.total_count) {
         return NULL;
     }
@@ -238,19 +314,14 @@ const distribution_registry_entry_t* registry_get_distribution_by_index(uint8_t
     return &registry_entries[index];
 }
 
-const distribution_registry_entry_t** registry_get_distributions_by_category(distribution_category_t category, uint8_t* count) {
-    initialize_registry();
-    
-    if (category == DISTRIBUTION_CONTINUOUS) {
-        if (count) *count = registry.continuous_count;
-        return continuous_distributions;
-    } else if (category == DISTRIBUTION_DISCRETE) {
-        if (count) *count = registry.discrete_count;
-        return discrete_distributions;
+const distribution_registry_entry_t* const* registry_get_distributions_by_category(distribution_category_t category, uint8_t* count) {
+    if ((unsigned)category >= DISTRIBUTION_CATEGORY_COUNT) {
+        if (count) *count = 0;
+        return NULL;
     }
     
-    if (count) *count = 0;
-    return NULL;
+    if (count) *count = registry.categories[category].count;
+    return registry.categories[category].entries;
 }
 
 uint8_t registry_get_total_count(void) {
@@ -258,21 +329,21 @@ uint8_t registry_get_total_count(void) {
 }
 
 uint8_t registry_get_category_count(distribution_category_t category) {
-    if (category == DISTRIBUTION_CONTINUOUS) {
-        return registry.continuous_count;
-    } else if (category == DISTRIBUTION_DISCRETE) {
-        return registry.discrete_count;
-    }
-    return 0;
+    return (unsigned)category < DISTRIBUTION_CATEGORY_COUNT ? registry.categories[category].count : 0;
 }
 
 int registry_is_valid_distribution_type(distribution_type_t type) {
-    return (type < DIST_COUNT);
+    return ((unsigned)type < DIST_COUNT);
+}
+
+const distribution_model_t* registry_get_distribution_model(distribution_type_t type) {
+    const distribution_registry_entry_t* entry = registry_get_distribution(type);
+    return entry ? &entry->model : NULL;
 }
 
 const char* registry_get_distribution_name(distribution_type_t type) {
     const distribution_registry_entry_t* entry = registry_get_distribution(type);
-    return entry ? entry->name : NULL;
+    return entry ? entry->model.name : NULL;
 }
 
 const char* registry_get_distribution_description(distribution_type_t type) {
@@ -282,23 +353,23 @@ const char* registry_get_distribution_description(distribution_type_t type) {
 
 distribution_category_t registry_get_distribution_category(distribution_type_t type) {
     const distribution_registry_entry_t* entry = registry_get_distribution(type);
-    return entry ? entry->category : DISTRIBUTION_CONTINUOUS;  // Default fallback
+    return entry ? entry->model.category : DISTRIBUTION_CONTINUOUS;  // Default fallback
 }
 
 uint8_t registry_get_parameter_count(distribution_type_t type) {
     const distribution_registry_entry_t* entry = registry_get_distribution(type);
-    return entry ? entry->param_count : 0;
+    return entry ? entry->model.param_count : 0;
 }
 
 const char** registry_get_parameter_names(distribution_type_t type) {
     const distribution_registry_entry_t* entry = registry_get_distribution(type);
-    return entry ? entry->param_names : NULL;
+    return entry ? entry->model.param_names : NULL;
 }
 
 const double* registry_get_parameter_ranges(distribution_type_t type, uint8_t param_index) {
     const distribution_registry_entry_t* entry = registry_get_distribution(type);
-    if (!entry || param_index >= entry->param_count) {
+    if (!entry || param_index >= entry->model.param_count) {
         return NULL;
     }
-    return entry->param_ranges[param_index];
+    return entry->model.param_ranges[param_index];
 }
\ No newline at end of file
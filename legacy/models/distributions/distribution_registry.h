@@ -13,32 +13,45 @@ extern "C" {
  */
 typedef struct {
     distribution_type_t type;
-    const char* name;
     const char* description;
-    distribution_category_t category;
-    uint8_t param_count;
-    const char** param_names;
-    double param_ranges[MAX_PARAMETERS][2];  // [min, max] for each parameter
+    distribution_model_t model;  // name, parameters and [min, max] ranges, handed out by pointer
     const distribution_t* distribution_impl;
 } distribution_registry_entry_t;
 
+// Number of distribution_category_t values
+#define DISTRIBUTION_CATEGORY_COUNT 2
+
+/**
+ * @brief One category's distributions, in type order
+ */
+typedef struct {
+    const distribution_registry_entry_t* const* entries;
+    uint8_t count;
+} distribution_category_list_t;
+
 /**
  * @brief Distribution registry structure
+ * Everything a list or detail page needs: the entries (names, descriptions,
+ * parameter names and ranges) and the per-category lists, all laid out at
+ * compile time. categories is indexed by distribution_category_t.
  */
 typedef struct {
     const distribution_registry_entry_t* entries;
     uint8_t total_count;
     uint8_t continuous_count;
     uint8_t discrete_count;
+    distribution_category_list_t categories[DISTRIBUTION_CATEGORY_COUNT];
 } distribution_registry_t;
 
 /**
- * @brief Registry initialization and access functions
+ * @brief Registry access functions
+ * The registry is a const table indexed by distribution_type_t; none of these
+ * need initialization.
  */
 const distribution_registry_t* get_distribution_registry(void);
 const distribution_registry_entry_t* registry_get_distribution(distribution_type_t type);
 const distribution_registry_entry_t* registry_get_distribution_by_index(uint8_t index);
-const distribution_registry_entry_t** registry_get_distributions_by_category(distribution_category_t category, uint8_t* count);
+const distribution_registry_entry_t* const* registry_get_distributions_by_category(distribution_category_t category, uint8_t* count);
 uint8_t registry_get_total_count(void);
 uint8_t registry_get_category_count(distribution_category_t category);
 int registry_is_valid_distribution_type(distribution_type_t type);
@@ -46,6 +59,7 @@ int registry_is_valid_distribution_type(distribution_type_t type);
 /**
  * @brief Distribution metadata access functions
  */
+const distribution_model_t* registry_get_distribution_model(distribution_type_t type);
 const char* registry_get_distribution_name(distribution_type_t type);
 const char* registry_get_distribution_description(distribution_type_t type);
 distribution_category_t registry_get_distribution_category(distribution_type_t type);
@@ -2,6 +2,7 @@
 #include <string.h>
 #include <time.h>
 #include <stddef.h>
+#include <math.h>
 
 /**
  * @brief Initialize calculation history structure
@@ -122,6 +123,244 @@ int history_create_entry(uint8_t distribution_type, const double* parameters,
     return 0;
 }
 
+// Two-bit forms of an encoded double
+#define HISTORY_FORM_ZERO 0     // +0.0, no bytes
+#define HISTORY_FORM_INTEGER 1  // zigzag varint, |value| < HISTORY_INTEGER_LIMIT
+#define HISTORY_FORM_FLOAT 2    // exact as a float, 4 bytes
+#define HISTORY_FORM_DOUBLE 3   // 8 bytes
+
+// Integers below this take at most 4 varint bytes, so never lose to a float
+#define HISTORY_INTEGER_LIMIT 134217728.0
+
+// Doubles stored per entry: parameters, input, PDF and CDF
+#define HISTORY_ENTRY_DOUBLES(param_count) ((param_count) + 3)
+
+static size_t history_put_varint(uint8_t* ptr, uint64_t value) {
+    size_t length = 0;
+    while (value >= 0x80) {
+        ptr[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    ptr[length++] = (uint8_t)value;
+    return length;
+}
+
+/**
+ * @brief Read a varint of at most max_bytes bytes
+ * @return Bytes consumed, 0 if truncated or too long
+ */
+static size_t history_get_varint(const uint8_t* ptr, size_t available, size_t max_bytes, uint64_t* value) {
+    uint64_t result = 0;
+    for (size_t i = 0; i < available && i < max_bytes; i++) {
+        result |= (uint64_t)(ptr[i] & 0x7F) << (7 * i);
+        if ((ptr[i] & 0x80) == 0) {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static uint64_t history_zigzag(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t history_unzigzag(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static int history_double_form(double value) {
+    if (value == 0.0 && !signbit(value)) {
+        return HISTORY_FORM_ZERO;
+    }
+    if (fabs(value) < HISTORY_INTEGER_LIMIT && value == (double)(int64_t)value && !(value == 0.0)) {
+        return HISTORY_FORM_INTEGER;
+    }
+    if (value == (double)(float)value) {
+        return HISTORY_FORM_FLOAT;
+    }
+    return HISTORY_FORM_DOUBLE;
+}
+
+static size_t history_put_le(uint8_t* ptr, uint64_t bits, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        ptr[i] = (uint8_t)(bits >> (8 * i));
+    }
+    return bytes;
+}
+
+static uint64_t history_get_le(const uint8_t* ptr, size_t bytes) {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < bytes; i++) {
+        bits |= (uint64_t)ptr[i] << (8 * i);
+    }
+    return bits;
+}
+
+static size_t history_put_double(uint8_t* ptr, double value, int form) {
+    if (form == HISTORY_FORM_INTEGER) {
+        return history_put_varint(ptr, history_zigzag((int64_t)value));
+    }
+    if (form == HISTORY_FORM_FLOAT) {
+        float narrow = (float)value;
+        uint32_t bits;
+        memcpy(&bits, &narrow, sizeof(bits));
+        return history_put_le(ptr, bits, sizeof(bits));
+    }
+    if (form == HISTORY_FORM_DOUBLE) {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return history_put_le(ptr, bits, sizeof(bits));
+    }
+    return 0;
+}
+
+/**
+ * @brief Decode one double of the given form
+ * @return Bytes consumed, 0 if the buffer is too short
+ */
+static size_t history_get_double(const uint8_t* ptr, size_t available, int form, double* value) {
+    if (form == HISTORY_FORM_ZERO) {
+        *value = 0.0;
+        return 0;
+    }
+    if (form == HISTORY_FORM_INTEGER) {
+        uint64_t zigzag;
+        size_t length = history_get_varint(ptr, available, 4, &zigzag);
+        *value = (double)history_unzigzag(zigzag);
+        return length;
+    }
+    if (form == HISTORY_FORM_FLOAT) {
+        if (available < sizeof(float)) {
+            return 0;
+        }
+        uint32_t bits = (uint32_t)history_get_le(ptr, sizeof(bits));
+        float narrow;
+        memcpy(&narrow, &bits, sizeof(narrow));
+        *value = narrow;
+        return sizeof(float);
+    }
+    if (available < sizeof(double)) {
+        return 0;
+    }
+    uint64_t bits = history_get_le(ptr, sizeof(bits));
+    memcpy(value, &bits, sizeof(*value));
+    return sizeof(double);
+}
+
+/**
+ * @brief Encode one entry in the compact format
+ * @param entry Entry to encode
+ * @param previous_timestamp Timestamp the delta is taken from (0 for a standalone entry)
+ * @param buffer Output buffer
+ * @param buffer_size Size of the buffer (HISTORY_MAX_ENCODED_ENTRY_SIZE always suffices)
+ * @param bytes_written Pointer to store number of bytes written
+ * @return 0 on success, -1 on error
+ */
+int history_encode_entry(const calculation_entry_t* entry, uint32_t previous_timestamp,
+                         uint8_t* buffer, size_t buffer_size, size_t* bytes_written) {
+    if (entry == NULL || buffer == NULL || bytes_written == NULL) {
+        return -1;
+    }
+    
+    uint8_t scratch[HISTORY_MAX_ENCODED_ENTRY_SIZE];
+    uint8_t* ptr = scratch;
+    
+    // Unused parameters are zeroed by history_create_entry; trailing zeros carry no information
+    uint8_t param_count = MAX_PARAMETERS;
+    while (param_count > 0 && history_double_form(entry->parameters[param_count - 1]) == HISTORY_FORM_ZERO) {
+        param_count--;
+    }
+    
+    double values[HISTORY_ENTRY_DOUBLES(MAX_PARAMETERS)];
+    uint8_t value_count = HISTORY_ENTRY_DOUBLES(param_count);
+    memcpy(values, entry->parameters, param_count * sizeof(double));
+    values[param_count] = entry->input_value;
+    values[param_count + 1] = entry->pdf_result;
+    values[param_count + 2] = entry->cdf_result;
+    
+    ptr += history_put_varint(ptr, history_zigzag((int64_t)entry->timestamp - (int64_t)previous_timestamp));
+    *ptr++ = entry->distribution_type;
+    *ptr++ = param_count;
+    
+    uint8_t* tags = ptr;
+    size_t tag_bytes = (value_count + 3) / 4;
+    memset(tags, 0, tag_bytes);
+    ptr += tag_bytes;
+    for (uint8_t i = 0; i < value_count; i++) {
+        int form = history_double_form(values[i]);
+        tags[i / 4] |= (uint8_t)(form << (2 * (i % 4)));
+        ptr += history_put_double(ptr, values[i], form);
+    }
+    
+    size_t length = (size_t)(ptr - scratch);
+    if (buffer_size < length) {
+        return -1;
+    }
+    memcpy(buffer, scratch, length);
+    *bytes_written = length;
+    return 0;
+}
+
+/**
+ * @brief Decode one entry written by history_encode_entry
+ * @param buffer Encoded data
+ * @param buffer_size Bytes available
+ * @param previous_timestamp Timestamp the delta was taken from
+ * @param entry Entry to fill
+ * @param bytes_read Pointer to store number of bytes consumed
+ * @return 0 on success, -1 if the data is truncated or malformed
+ */
+int history_decode_entry(const uint8_t* buffer, size_t buffer_size, uint32_t previous_timestamp,
+                         calculation_entry_t* entry, size_t* bytes_read) {
+    if (buffer == NULL || entry == NULL || bytes_read == NULL) {
+        return -1;
+    }
+    
+    const uint8_t* ptr = buffer;
+    const uint8_t* end = buffer + buffer_size;
+    uint64_t delta;
+    size_t length = history_get_varint(ptr, (size_t)(end - ptr), 5, &delta);
+    if (length == 0 || end - ptr < (ptrdiff_t)(length + 2)) {
+        return -1;
+    }
+    ptr += length;
+    
+    memset(entry, 0, sizeof(*entry));
+    entry->timestamp = (uint32_t)((int64_t)previous_timestamp + history_unzigzag(delta));
+    entry->distribution_type = *ptr++;
+    uint8_t param_count = *ptr++ & 0x0F;
+    if (param_count > MAX_PARAMETERS) {
+        return -1;
+    }
+    
+    uint8_t value_count = HISTORY_ENTRY_DOUBLES(param_count);
+    size_t tag_bytes = (value_count + 3) / 4;
+    if ((size_t)(end - ptr) < tag_bytes) {
+        return -1;
+    }
+    const uint8_t* tags = ptr;
+    ptr += tag_bytes;
+    
+    double values[HISTORY_ENTRY_DOUBLES(MAX_PARAMETERS)];
+    for (uint8_t i = 0; i < value_count; i++) {
+        int form = (tags[i / 4] >> (2 * (i % 4))) & 0x03;
+        size_t used = history_get_double(ptr, (size_t)(end - ptr), form, &values[i]);
+        if (used == 0 && form != HISTORY_FORM_ZERO) {
+            return -1;
+        }
+        ptr += used;
+    }
+    
+    memcpy(entry->parameters, values, param_count * sizeof(double));
+    entry->input_value = values[param_count];
+    entry->pdf_result = values[param_count + 1];
+    entry->cdf_result = values[param_count + 2];
+    
+    *bytes_read = (size_t)(ptr - buffer);
+    return 0;
+}
+
 /**
  * @brief Get the size needed for serialized history data
  * @param history Pointer to history structure
@@ -132,43 +371,53 @@ size_t history_get_serialized_size(const calculation_history_t* history) {
         return 0;
     }
     
-    // Size = header (count + head) + entries
-    return sizeof(uint8_t) + sizeof(uint8_t) + 
-           (history->count * sizeof(calculation_entry_t));
+    // Header (marker + version + count) + encoded entries
+    size_t size = 3;
+    uint32_t previous = 0;
+    for (uint8_t i = 0; i < history->count; i++) {
+        const calculation_entry_t* entry = history_get_entry(history, history->count - 1 - i);
+        uint8_t scratch[HISTORY_MAX_ENCODED_ENTRY_SIZE];
+        size_t length;
+        if (history_encode_entry(entry, previous, scratch, sizeof(scratch), &length) == 0) {
+            size += length;
+        }
+        previous = entry->timestamp;
+    }
+    return size;
 }
 
 /**
  * @brief Serialize history data to binary buffer
  * @param history Pointer to history structure
  * @param buffer Buffer to write serialized data
- * @param buffer_size Size of the buffer
+ * @param buffer_size Size of the buffer (HISTORY_MAX_SERIALIZED_SIZE always suffices)
  * @param bytes_written Pointer to store number of bytes written
  * @return 0 on success, -1 on error
  */
 int history_serialize(const calculation_history_t* history, uint8_t* buffer, 
                      size_t buffer_size, size_t* bytes_written) {
-    if (history == NULL || buffer == NULL || bytes_written == NULL) {
-        return -1;
-    }
-    
-    size_t required_size = history_get_serialized_size(history);
-    if (buffer_size < required_size) {
+    if (history == NULL || buffer == NULL || bytes_written == NULL || buffer_size < 3) {
         return -1;
     }
     
     uint8_t* ptr = buffer;
+    uint8_t* end = buffer + buffer_size;
     
     // Write header information
+    *ptr++ = HISTORY_FORMAT_MARKER;
+    *ptr++ = HISTORY_FORMAT_VERSION;
     *ptr++ = history->count;
-    *ptr++ = history->head;
     
-    // Write entries in chronological order (oldest to newest)
+    // Write entries in chronological order (oldest to newest), timestamps as deltas
+    uint32_t previous = 0;
     for (uint8_t i = 0; i < history->count; i++) {
         const calculation_entry_t* entry = history_get_entry(history, history->count - 1 - i);
-        if (entry != NULL) {
-            memcpy(ptr, entry, sizeof(calculation_entry_t));
-            ptr += sizeof(calculation_entry_t);
+        size_t length;
+        if (history_encode_entry(entry, previous, ptr, (size_t)(end - ptr), &length) != 0) {
+            return -1;
         }
+        ptr += length;
+        previous = entry->timestamp;
     }
     
     *bytes_written = ptr - buffer;
@@ -176,18 +425,9 @@ int history_serialize(const calculation_history_t* history, uint8_t* buffer,
 }
 
 /**
- * @brief Deserialize history data from binary buffer
- * @param history Pointer to history structure to populate
- * @param buffer Buffer containing serialized data
- * @param buffer_size Size of the buffer
- * @return 0 on success, -1 on error
+ * @brief Deserialize version 1 data: count, head, then raw in-memory entries
  */
-int history_deserialize(calculation_history_t* history, const uint8_t* buffer, 
-                       size_t buffer_size) {
-    if (history == NULL || buffer == NULL || buffer_size < 2) {
-        return -1;
-    }
-    
+static int history_deserialize_v1(calculation_history_t* history, const uint8_t* buffer, size_t buffer_size) {
     const uint8_t* ptr = buffer;
     
     // Read header information
@@ -221,4 +461,51 @@ int history_deserialize(calculation_history_t* history, const uint8_t* buffer,
     }
     
     return 0;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Deserialize history data from binary buffer
+ * @param history Pointer to history structure to populate
+ * @param buffer Buffer containing serialized data
+ * @param buffer_size Size of the buffer
+ * @return 0 on success, -1 on error
+ */
+int history_deserialize(calculation_history_t* history, const uint8_t* buffer, 
+                       size_t buffer_size) {
+    if (history == NULL || buffer == NULL || buffer_size < 2) {
+        return -1;
+    }
+    
+    if (buffer[0] <= MAX_HISTORY_ENTRIES) {
+        return history_deserialize_v1(history, buffer, buffer_size);
+    }
+    if (buffer_size < 3 || buffer[0] != HISTORY_FORMAT_MARKER || buffer[1] != HISTORY_FORMAT_VERSION) {
+        return -1;
+    }
+    
+    uint8_t count = buffer[2];
+    if (count > MAX_HISTORY_ENTRIES) {
+        return -1;
+    }
+    
+    // Decode into a scratch history so a malformed buffer leaves the caller's untouched
+    calculation_history_t decoded;
+    history_init(&decoded);
+    
+    const uint8_t* ptr = buffer + 3;
+    const uint8_t* end = buffer + buffer_size;
+    uint32_t previous = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        calculation_entry_t entry;
+        size_t length;
+        if (history_decode_entry(ptr, (size_t)(end - ptr), previous, &entry, &length) != 0) {
+            return -1;
+        }
+        ptr += length;
+        previous = entry.timestamp;
+        history_add_entry(&decoded, &entry);
+    }
+    
+    *history = decoded;
+    return 0;
+}
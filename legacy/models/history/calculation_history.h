@@ -35,6 +35,33 @@ typedef struct {
     uint8_t head;  // Circular buffer head index
 } calculation_history_t;
 
+/**
+ * @brief Compact, versioned encoding of history data
+ * A serialized history starts with HISTORY_FORMAT_MARKER, the version and
+ * the entry count, then the entries oldest first. Each entry is its
+ * timestamp (a varint of the zigzag delta from the previous entry's, or from
+ * 0 for the first), the distribution type, a byte whose low nibble is the
+ * number of parameters used (trailing zero parameters are dropped), two-bit
+ * form tags for each stored double, then the parameters, input, PDF and CDF.
+ * Each double is +0.0 (no bytes), a small integer (zigzag varint), an exact
+ * float (4 bytes) or a full double (8 bytes), all little-endian, so the
+ * encoding is lossless and independent of struct padding and ABI. Buffers
+ * whose first byte is at most MAX_HISTORY_ENTRIES are the version 1 layout
+ * (count, head, raw entries) and are still read.
+ */
+#define HISTORY_FORMAT_MARKER 0xA5
+#define HISTORY_FORMAT_VERSION 2
+
+/**
+ * @brief Largest encoded entry: timestamp varint, type, count, tags and full doubles
+ */
+#define HISTORY_MAX_ENCODED_ENTRY_SIZE (5 + 1 + 1 + 2 + (MAX_PARAMETERS + 3) * 8)
+
+/**
+ * @brief Serialized size bound of a full history, in either format
+ */
+#define HISTORY_MAX_SERIALIZED_SIZE (3 + MAX_HISTORY_ENTRIES * HISTORY_MAX_ENCODED_ENTRY_SIZE)
+
 /**
  * @brief Function prototypes for history management
  */
@@ -58,5 +85,9 @@ int history_create_entry(uint8_t distribution_type, const double* parameters,
 int history_serialize(const calculation_history_t* history, uint8_t* buffer, size_t buffer_size, size_t* bytes_written);
 int history_deserialize(calculation_history_t* history, const uint8_t* buffer, size_t buffer_size);
 size_t history_get_serialized_size(const calculation_history_t* history);
+int history_encode_entry(const calculation_entry_t* entry, uint32_t previous_timestamp,
+                         uint8_t* buffer, size_t buffer_size, size_t* bytes_written);
+int history_decode_entry(const uint8_t* buffer, size_t buffer_size, uint32_t previous_timestamp,
+                         calculation_entry_t* entry, size_t* bytes_read);
 
 #endif // CALCULATION_HISTORY_H
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include "history_index.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Initialize an index for a ring of capacity slots
+ * @param index Pointer to index structure
+ * @param capacity Ring slots, at most HISTORY_INDEX_NONE - 1
+ * @return 0 on success, -1 on error or allocation failure
+ */
+int history_index_init(history_index_t* index, uint32_t capacity) {
+    if (index == NULL || capacity == 0 || capacity == HISTORY_INDEX_NONE) {
+        return -1;
+    }
+    
+    memset(index, 0, sizeof(*index));
+    index->capacity = capacity;
+    index->previous = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    index->distribution = (uint8_t*)malloc(capacity * sizeof(uint8_t));
+    index->set_of = (uint16_t*)malloc(capacity * sizeof(uint16_t));
+    index->sets = (history_parameter_set_t*)malloc(HISTORY_INDEX_MAX_SETS * sizeof(history_parameter_set_t));
+    index->buckets = (uint16_t*)malloc(HISTORY_INDEX_BUCKETS * sizeof(uint16_t));
+    if (!index->previous || !index->distribution || !index->set_of || !index->sets || !index->buckets) {
+        history_index_destroy(index);
+        return -1;
+    }
+    
+    history_index_reset(index, 0);
+    return 0;
+}
+
+/**
+ * @brief Free an index's arrays
+ * @param index Pointer to index structure
+ */
+void history_index_destroy(history_index_t* index) {
+    if (index == NULL) {
+        return;
+    }
+    
+    free(index->previous);
+    free(index->distribution);
+    free(index->set_of);
+    free(index->sets);
+    free(index->buckets);
+    memset(index, 0, sizeof(*index));
+}
+
+/**
+ * @brief Empty the index; the next appended entry goes to first_slot
+ * @param index Pointer to index structure
+ * @param first_slot Ring slot of the next entry
+ */
+void history_index_reset(history_index_t* index, uint32_t first_slot) {
+    if (index == NULL || index->capacity == 0) {
+        return;
+    }
+    
+    index->count = 0;
+    index->next_sequence = first_slot % index->capacity;
+    index->set_count = 0;
+    for (size_t d = 0; d < HISTORY_INDEX_DISTRIBUTIONS; d++) {
+        index->heads[d] = HISTORY_INDEX_NONE;
+        index->distribution_counts[d] = 0;
+    }
+    memset(index->sets, 0, HISTORY_INDEX_MAX_SETS * sizeof(history_parameter_set_t));
+    memset(index->buckets, 0, HISTORY_INDEX_BUCKETS * sizeof(uint16_t));
+}
+
+/**
+ * @brief 64-bit FNV-1a over the distribution and parameters
+ * -0.0 is folded into 0.0 so equal values share a set.
+ * @param entry Entry whose parameter set to hash
+ * @return Hash of the set
+ */
+uint64_t history_parameter_set_hash(const calculation_entry_t* entry) {
+    uint64_t hash = 14695981039346656037ull;
+    
+    hash ^= entry->distribution_type;
+    hash *= 1099511628211ull;
+    for (int i = 0; i < MAX_PARAMETERS; i++) {
+        double value = entry->parameters[i] == 0.0 ? 0.0 : entry->parameters[i];
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        for (int b = 0; b < 8; b++) {
+            hash ^= (bits >> (8 * b)) & 0xff;
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+/**
+ * @brief Is sequence one of the live entries
+ */
+static int history_index_live(const history_index_t* index, uint32_t sequence) {
+    return sequence != HISTORY_INDEX_NONE && index->next_sequence - 1 - sequence < index->count;
+}
+
+static void history_index_bucket_insert(history_index_t* index, uint16_t set_id) {
+    uint32_t bucket = (uint32_t)index->sets[set_id].hash & (HISTORY_INDEX_BUCKETS - 1);
+    while (index->buckets[bucket] != 0) {
+        bucket = (bucket + 1) & (HISTORY_INDEX_BUCKETS - 1);
+    }
+    index->buckets[bucket] = (uint16_t)(set_id + 1);
+}
+
+/**
+ * @brief Set id for hash, or HISTORY_INDEX_NO_SET
+ */
+static uint16_t history_index_find_set(const history_index_t* index, uint64_t hash) {
+    uint32_t bucket = (uint32_t)hash & (HISTORY_INDEX_BUCKETS - 1);
+    while (index->buckets[bucket] != 0) {
+        uint16_t set_id = (uint16_t)(index->buckets[bucket] - 1);
+        if (index->sets[set_id].hash == hash) {
+            return set_id;
+        }
+        bucket = (bucket + 1) & (HISTORY_INDEX_BUCKETS - 1);
+    }
+    return HISTORY_INDEX_NO_SET;
+}
+
+/**
+ * @brief Release a set whose last entry was overwritten
+ * Linear probing cannot simply empty a bucket, so the small bucket table
+ * is rebuilt from the live sets; this only happens when a set disappears.
+ */
+static void history_index_free_set(history_index_t* index, uint16_t set_id) {
+    memset(&index->sets[set_id], 0, sizeof(index->sets[set_id]));
+    index->set_count--;
+    
+    memset(index->buckets, 0, HISTORY_INDEX_BUCKETS * sizeof(uint16_t));
+    for (uint16_t id = 0; id < HISTORY_INDEX_MAX_SETS; id++) {
+        if (index->sets[id].hits > 0) {
+            history_index_bucket_insert(index, id);
+        }
+    }
+}
+
+/**
+ * @brief Drop the oldest entry, whose slot the next append reuses
+ */
+static void history_index_drop_oldest(history_index_t* index, uint32_t slot) {
+    uint32_t oldest = index->next_sequence - index->count;
+    uint8_t distribution = index->distribution[slot];
+    uint16_t set_id = index->set_of[slot];
+    
+    index->distribution_counts[distribution]--;
+    if (index->heads[distribution] == oldest) {
+        index->heads[distribution] = HISTORY_INDEX_NONE;
+    }
+    if (set_id != HISTORY_INDEX_NO_SET && --index->sets[set_id].hits == 0) {
+        history_index_free_set(index, set_id);
+    }
+    index->count--;
+}
+
+/**
+ * @brief Set id for the entry's parameter set, adding the set if untracked
+ */
+static uint16_t history_index_acquire_set(history_index_t* index, const calculation_entry_t* entry, uint32_t sequence) {
+    uint64_t hash = history_parameter_set_hash(entry);
+    uint16_t set_id = history_index_find_set(index, hash);
+    
+    if (set_id == HISTORY_INDEX_NO_SET) {
+        if (index->set_count >= HISTORY_INDEX_MAX_SETS) {
+            return HISTORY_INDEX_NO_SET;
+        }
+        for (set_id = 0; index->sets[set_id].hits > 0; set_id++) {}
+        index->sets[set_id].hash = hash;
+        index->sets[set_id].distribution = entry->distribution_type;
+        index->set_count++;
+        history_index_bucket_insert(index, set_id);
+    }
+    
+    index->sets[set_id].hits++;
+    index->sets[set_id].latest_sequence = sequence;
+    return set_id;
+}
+
+/**
+ * @brief Index the entry just written to the ring's next slot
+ * @param index Pointer to index structure
+ * @param entry Entry written
+ */
+void history_index_append(history_index_t* index, const calculation_entry_t* entry) {
+    if (index == NULL || entry == NULL || index->capacity == 0) {
+        return;
+    }
+    
+    uint32_t sequence = index->next_sequence;
+    uint32_t slot = sequence % index->capacity;
+    uint8_t distribution = entry->distribution_type;
+    
+    if (index->count == index->capacity) {
+        history_index_drop_oldest(index, slot);
+    }
+    
+    index->previous[slot] = index->heads[distribution];
+    index->heads[distribution] = sequence;
+    index->distribution[slot] = distribution;
+    index->distribution_counts[distribution]++;
+    index->set_of[slot] = history_index_acquire_set(index, entry, sequence);
+    
+    index->next_sequence++;
+    index->count++;
+}
+
+/**
+ * @brief Live entries of one distribution
+ * @param index Pointer to index structure
+ * @param distribution Distribution id
+ * @return Entry count
+ */
+uint32_t history_index_distribution_count(const history_index_t* index, uint8_t distribution) {
+    return (index != NULL && index->capacity != 0) ? index->distribution_counts[distribution] : 0;
+}
+
+/**
+ * @brief Ring slots of one distribution's entries, newest first
+ * @param index Pointer to index structure
+ * @param distribution Distribution id
+ * @param first Matching entries to skip
+ * @param count Slots wanted
+ * @param slots Array of at least count slots
+ * @return Number of slots written
+ */
+uint32_t history_index_distribution_slots(const history_index_t* index, uint8_t distribution,
+                                          uint32_t first, uint32_t count, uint32_t* slots) {
+    if (index == NULL || slots == NULL || index->capacity == 0) {
+        return 0;
+    }
+    
+    uint32_t written = 0;
+    uint32_t sequence = index->heads[distribution];
+    // Links run strictly older, so the first dead one ends the list
+    while (written < count && history_index_live(index, sequence)) {
+        uint32_t slot = sequence % index->capacity;
+        if (first > 0) {
+            first--;
+        } else {
+            slots[written++] = slot;
+        }
+        sequence = index->previous[slot];
+    }
+    return written;
+}
+
+/**
+ * @brief The parameter sets with the most live entries
+ * Ties go to the set used most recently.
+ * @param index Pointer to index structure
+ * @param sets Output array
+ * @param max_sets Capacity of sets
+ * @return Number of sets written
+ */
+size_t history_index_popular_sets(const history_index_t* index, history_parameter_set_info_t* sets, size_t max_sets) {
+    if (index == NULL || sets == NULL || index->capacity == 0) {
+        return 0;
+    }
+    
+    size_t written = 0;
+    uint32_t last_hits = UINT32_MAX;
+    uint32_t last_age = 0;
+    
+    // Repeated selection in (hits desc, age asc) order; max_sets is small
+    while (written < max_sets) {
+        int best = -1;
+        uint32_t best_hits = 0;
+        uint32_t best_age = 0;
+    
+        for (int id = 0; id < HISTORY_INDEX_MAX_SETS; id++) {
+            const history_parameter_set_t* set = &index->sets[id];
+            if (set->hits == 0) {
+                continue;
+            }
+            uint32_t age = index->next_sequence - 1 - set->latest_sequence;
+            int after_last = set->hits < last_hits || (set->hits == last_hits && age > last_age);
+            int better = best < 0 || set->hits > best_hits || (set->hits == best_hits && age < best_age);
+            if (after_last && better) {
+                best = id;
+                best_hits = set->hits;
+                best_age = age;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+    
+        sets[written].distribution = index->sets[best].distribution;
+        sets[written].hits = best_hits;
+        sets[written].latest_index = best_age;
+        written++;
+        last_hits = best_hits;
+        last_age = best_age;
+    }
+    return written;
+}
@@ -0,0 +1,98 @@
+#ifndef HISTORY_INDEX_H
+#define HISTORY_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "calculation_history.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Limits of the in-memory history index
+ * Distribution ids are a byte, so every one has a posting list head. At
+ * most HISTORY_INDEX_MAX_SETS distinct parameter sets are tracked at once;
+ * entries of further sets are still stored and listed, just not counted.
+ */
+#define HISTORY_INDEX_DISTRIBUTIONS 256
+#define HISTORY_INDEX_MAX_SETS 512
+#define HISTORY_INDEX_BUCKETS 1024
+
+// No entry, set or link
+#define HISTORY_INDEX_NONE UINT32_MAX
+#define HISTORY_INDEX_NO_SET UINT16_MAX
+
+/**
+ * @brief One distinct (distribution, parameters) set among the live entries
+ */
+typedef struct {
+    uint64_t hash;
+    uint32_t latest_sequence;  // newest entry using the set
+    uint32_t hits;             // live entries using the set, 0 when the slot is free
+    uint8_t distribution;
+} history_parameter_set_t;
+
+/**
+ * @brief A parameter set as reported to callers
+ */
+typedef struct {
+    uint8_t distribution;
+    uint32_t hits;
+    uint32_t latest_index;  // store index (0 = most recent) of the newest entry using it
+} history_parameter_set_info_t;
+
+/**
+ * @brief Secondary indexes over a ring of capacity slots
+ * Entries are numbered by append sequence, with slot = sequence % capacity,
+ * so a link to an entry that has since been overwritten is recognised by
+ * its age instead of having to be unlinked. Per slot the index keeps the
+ * sequence of the previous entry of the same distribution (the posting
+ * lists, newest first), the entry's distribution and its parameter set.
+ * Parameter sets are deduplicated by a 64-bit hash of the distribution and
+ * canonicalised parameters; equal hashes are taken to be equal sets.
+ */
+typedef struct {
+    uint32_t capacity;
+    uint32_t count;
+    uint32_t next_sequence;
+    uint32_t* previous;
+    uint8_t* distribution;
+    uint16_t* set_of;
+    uint32_t heads[HISTORY_INDEX_DISTRIBUTIONS];
+    uint32_t distribution_counts[HISTORY_INDEX_DISTRIBUTIONS];
+    history_parameter_set_t* sets;
+    uint16_t* buckets;  // set id + 1 per bucket, 0 when empty
+    uint32_t set_count;
+} history_index_t;
+
+/**
+ * @brief Function prototypes for the history index
+ * history_index_reset starts an empty index whose next entry goes to
+ * first_slot. history_index_append must be called for every entry written
+ * to the ring, in order; once count reaches capacity it also drops the
+ * overwritten entry.
+ */
+int history_index_init(history_index_t* index, uint32_t capacity);
+void history_index_destroy(history_index_t* index);
+void history_index_reset(history_index_t* index, uint32_t first_slot);
+void history_index_append(history_index_t* index, const calculation_entry_t* entry);
+uint64_t history_parameter_set_hash(const calculation_entry_t* entry);
+
+/**
+ * @brief Queries
+ * history_index_distribution_slots fills slots with the ring slots of
+ * matching entries, newest first, skipping the first `first` of them, and
+ * returns how many it wrote. history_index_popular_sets returns the sets
+ * with the most live entries, most popular first.
+ */
+uint32_t history_index_distribution_count(const history_index_t* index, uint8_t distribution);
+uint32_t history_index_distribution_slots(const history_index_t* index, uint8_t distribution,
+                                          uint32_t first, uint32_t count, uint32_t* slots);
+size_t history_index_popular_sets(const history_index_t* index, history_parameter_set_info_t* sets, size_t max_sets);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HISTORY_INDEX_H
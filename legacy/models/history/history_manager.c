@@ -1,12 +1,26 @@
 #include "history_manager.h"
 #include <string.h>
 #include <stdio.h>
+#include <time.h>
+
+static double history_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+/**
+ * @brief Note an unpersisted change for deferred mode
+ */
+static void history_manager_mark_dirty(history_manager_t* manager) {
+    manager->last_change_ms = history_now_ms();
+}
 
 /**
  * @brief Initialize history manager
  * @param manager Pointer to history manager structure
  * @param storage_path Path for persistent storage (NULL for default)
- * @param auto_save 1 for auto-save on add, 0 for manual save
+ * @param auto_save HISTORY_AUTO_SAVE_OFF, _IMMEDIATE or _DEFERRED
  * @return 0 on success, -1 on error
  */
 int history_manager_init(history_manager_t* manager, const char* storage_path, int auto_save) {
@@ -26,6 +40,11 @@ int history_manager_init(history_manager_t* manager, const char* storage_path, i
     }
     
     manager->auto_save = auto_save;
+    history_log_init(&manager->log);
+    manager->store = NULL;
+    manager->pending = 0;
+    manager->pending_clear = 0;
+    manager->last_change_ms = 0.0;
     
     return 0;
 }
@@ -62,9 +81,20 @@ int history_manager_add_calculation(history_manager_t* manager, uint8_t distribu
         return -1;
     }
     
-    // Auto-save if enabled
-    if (manager->auto_save) {
-        history_save_to_file(&manager->history, manager->storage_path);
+    // The long-term store keeps every calculation; the ring keeps the recent ones
+    if (manager->store != NULL) {
+        history_store_append(manager->store, &entry);
+    }
+    
+    // Auto-save if enabled: one appended record, with periodic compaction
+    if (manager->auto_save == HISTORY_AUTO_SAVE_DEFERRED) {
+        // Write-behind: the calculation path never waits on flash
+        if (manager->pending < UINT8_MAX) {
+            manager->pending++;
+        }
+        history_manager_mark_dirty(manager);
+    } else if (manager->auto_save) {
+        history_log_save(&manager->history, manager->storage_path, &manager->log, HISTORY_RECORD_ADD, &entry);
         // Note: We don't return error if save fails, as the calculation was added successfully
     }
     
@@ -111,28 +141,38 @@ int history_manager_clear(history_manager_t* manager) {
     history_clear(&manager->history);
     
     // Auto-save if enabled
-    if (manager->auto_save) {
-        history_save_to_file(&manager->history, manager->storage_path);
+    if (manager->auto_save == HISTORY_AUTO_SAVE_DEFERRED) {
+        // Adds before the clear no longer need persisting
+        manager->pending = 0;
+        manager->pending_clear = 1;
+        history_manager_mark_dirty(manager);
+    } else if (manager->auto_save) {
+        history_log_save(&manager->history, manager->storage_path, &manager->log, HISTORY_RECORD_CLEAR, NULL);
     }
     
     return 0;
 }
 
 /**
- * @brief Save history to persistent storage
+ * @brief Save history to persistent storage as a fresh snapshot
  * @param manager Pointer to history manager
  * @return 0 on success, -1 on error
  */
-int history_manager_save(const history_manager_t* manager) {
+int history_manager_save(history_manager_t* manager) {
     if (manager == NULL) {
         return -1;
     }
     
-    return history_save_to_file(&manager->history, manager->storage_path);
+    int result = history_compact_to_file(&manager->history, manager->storage_path, &manager->log);
+    if (result == 0) {
+        manager->pending = 0;
+        manager->pending_clear = 0;
+    }
+    return result;
 }
 
 /**
- * @brief Load history from persistent storage
+ * @brief Load history from persistent storage: snapshot plus replayed log
  * @param manager Pointer to history manager
  * @return 0 on success, -1 on error
  */
@@ -141,7 +181,9 @@ int history_manager_load(history_manager_t* manager) {
         return -1;
     }
     
-    return history_load_from_file(&manager->history, manager->storage_path);
+    manager->pending = 0;
+    manager->pending_clear = 0;
+    return history_recover_from_file(&manager->history, manager->storage_path, &manager->log);
 }
 
 /**
@@ -157,4 +199,90 @@ int history_manager_remove_entry(history_manager_t* manager, uint8_t index) {
     (void)manager;  // Suppress unused parameter warning
     (void)index;    // Suppress unused parameter warning
     return -1;  // Not implemented
+}
+
+/**
+ * @brief Attach a long-term store that also receives every added calculation
+ * @param manager Pointer to history manager
+ * @param store Open store, or NULL to detach; the caller keeps ownership
+ */
+void history_manager_attach_store(history_manager_t* manager, history_store_t* store) {
+    if (manager == NULL) {
+        return;
+    }
+    
+    manager->store = store;
+}
+
+/**
+ * @brief Persist pending changes now (deferred mode, lifecycle hooks, explicit saves)
+ * Appends a record per pending change, or compacts when the log is not
+ * ready, would pass its compaction point, or pending adds have already
+ * left the ring. On failure the changes stay pending and the next flush
+ * compacts, so nothing is appended twice.
+ * @param manager Pointer to history manager
+ * @return 0 on success (or nothing pending), -1 on error
+ */
+int history_manager_flush(history_manager_t* manager) {
+    if (manager == NULL) {
+        return -1;
+    }
+    if (!history_manager_is_dirty(manager)) {
+        return 0;
+    }
+    
+    uint32_t records = (uint32_t)manager->pending + manager->pending_clear;
+    if (!manager->log.ready || manager->pending > manager->history.count ||
+        manager->log.records + records > HISTORY_LOG_COMPACT_RECORDS) {
+        return history_manager_save(manager);
+    }
+    
+    if (manager->pending_clear) {
+        if (history_log_save(&manager->history, manager->storage_path, &manager->log,
+                             HISTORY_RECORD_CLEAR, NULL) != 0) {
+            return -1;
+        }
+        manager->pending_clear = 0;
+    }
+    // Oldest pending add first, as they were applied
+    while (manager->pending > 0) {
+        const calculation_entry_t* entry = history_get_entry(&manager->history, manager->pending - 1);
+        if (history_log_save(&manager->history, manager->storage_path, &manager->log,
+                             HISTORY_RECORD_ADD, entry) != 0) {
+            return -1;
+        }
+        manager->pending--;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Flush if the idle timeout has passed or enough adds are pending
+ * Call from a periodic timer; cheap when nothing is pending.
+ * @param manager Pointer to history manager
+ * @return 1 if a flush ran and succeeded, 0 if none was due, -1 on error
+ */
+int history_manager_tick(history_manager_t* manager) {
+    if (manager == NULL) {
+        return -1;
+    }
+    if (!history_manager_is_dirty(manager)) {
+        return 0;
+    }
+    
+    if (manager->pending < HISTORY_FLUSH_PENDING_ENTRIES &&
+        history_now_ms() - manager->last_change_ms < HISTORY_FLUSH_IDLE_MS) {
+        return 0;
+    }
+    return history_manager_flush(manager) == 0 ? 1 : -1;
+}
+
+/**
+ * @brief Check for changes not yet persisted
+ * @param manager Pointer to history manager
+ * @return 1 if dirty, 0 otherwise
+ */
+int history_manager_is_dirty(const history_manager_t* manager) {
+    return manager != NULL && (manager->pending > 0 || manager->pending_clear);
 }
\ No newline at end of file
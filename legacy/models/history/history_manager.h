@@ -3,6 +3,22 @@
 
 #include "calculation_history.h"
 #include "history_persistence.h"
+#include "history_store.h"
+
+/**
+ * @brief auto_save modes
+ * Deferred (write-behind) mode only marks the manager dirty on add or clear;
+ * history_manager_tick flushes once HISTORY_FLUSH_IDLE_MS pass without a
+ * change or HISTORY_FLUSH_PENDING_ENTRIES adds are waiting, and the host
+ * calls history_manager_flush on hide/destroy and for explicit saves.
+ */
+#define HISTORY_AUTO_SAVE_OFF 0
+#define HISTORY_AUTO_SAVE_IMMEDIATE 1
+#define HISTORY_AUTO_SAVE_DEFERRED 2
+
+#define HISTORY_FLUSH_IDLE_MS 2000.0
+// Below MAX_HISTORY_ENTRIES, so pending adds are still in the ring when flushed
+#define HISTORY_FLUSH_PENDING_ENTRIES 8
 
 /**
  * @brief History manager structure that combines history and persistence
@@ -10,7 +26,12 @@
 typedef struct {
     calculation_history_t history;
     char storage_path[MAX_PATH_LENGTH];
-    int auto_save;  // 1 = auto-save on add, 0 = manual save
+    int auto_save;  // HISTORY_AUTO_SAVE_OFF, _IMMEDIATE or _DEFERRED
+    history_log_t log;  // Record log after the snapshot at storage_path
+    history_store_t* store;  // Optional long-term store, NULL if none
+    uint8_t pending;  // Adds not yet persisted (deferred mode)
+    uint8_t pending_clear;  // A clear not yet persisted, before the pending adds
+    double last_change_ms;  // Monotonic time of the last unpersisted change
 } history_manager_t;
 
 /**
@@ -23,8 +44,12 @@ int history_manager_add_calculation(history_manager_t* manager, uint8_t distribu
 const calculation_entry_t* history_manager_get_entry(const history_manager_t* manager, uint8_t index);
 uint8_t history_manager_get_count(const history_manager_t* manager);
 int history_manager_clear(history_manager_t* manager);
-int history_manager_save(const history_manager_t* manager);
+int history_manager_save(history_manager_t* manager);
 int history_manager_load(history_manager_t* manager);
 int history_manager_remove_entry(history_manager_t* manager, uint8_t index);
+void history_manager_attach_store(history_manager_t* manager, history_store_t* store);
+int history_manager_flush(history_manager_t* manager);
+int history_manager_tick(history_manager_t* manager);
+int history_manager_is_dirty(const history_manager_t* manager);
 
 #endif // HISTORY_MANAGER_H
\ No newline at end of file
@@ -1,8 +1,46 @@
 #include "history_persistence.h"
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 
+// "HLG2", first bytes of every record log
+#define HISTORY_LOG_MAGIC 0x32474C48u
+
+// Log header: magic, then the id of the snapshot the log extends (both little-endian)
+#define HISTORY_LOG_HEADER_SIZE 8
+
+// Record prefix: checksum (little-endian), type, payload length
+#define HISTORY_RECORD_PREFIX_SIZE 6
+
+/**
+ * @brief FNV-1a over a byte range
+ */
+static uint32_t history_checksum(const uint8_t* data, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void history_put_u32(uint8_t* ptr, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        ptr[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint32_t history_get_u32(const uint8_t* ptr) {
+    return (uint32_t)ptr[0] | (uint32_t)ptr[1] << 8 | (uint32_t)ptr[2] << 16 | (uint32_t)ptr[3] << 24;
+}
+
+/**
+ * @brief filename followed by suffix, or -1 if it does not fit
+ */
+static int history_sibling_path(char* path, size_t size, const char* filename, const char* suffix) {
+    int length = snprintf(path, size, "%s%s", filename, suffix);
+    return (length < 0 || (size_t)length >= size) ? -1 : 0;
+}
+
 /**
  * @brief Save calculation history to file
  * @param history Pointer to history structure
@@ -19,25 +57,11 @@ int history_save_to_file(const calculation_history_t* history, const char* filen
         return -1;
     }
     
-    // Get serialized size
-    size_t serialized_size = history_get_serialized_size(history);
-    if (serialized_size == 0) {
-        fclose(file);
-        return -1;
-    }
-    
-    // Allocate buffer for serialization
-    uint8_t* buffer = malloc(serialized_size);
-    if (buffer == NULL) {
-        fclose(file);
-        return -1;
-    }
-    
-    // Serialize history
+    // Serialize into a stack buffer; a full history is only a few hundred bytes
+    uint8_t buffer[HISTORY_MAX_SERIALIZED_SIZE];
     size_t bytes_written;
-    int result = history_serialize(history, buffer, serialized_size, &bytes_written);
+    int result = history_serialize(history, buffer, sizeof(buffer), &bytes_written);
     if (result != 0) {
-        free(buffer);
         fclose(file);
         return -1;
     }
@@ -45,7 +69,6 @@ int history_save_to_file(const calculation_history_t* history, const char* filen
     // Write to file
     size_t written = fwrite(buffer, 1, bytes_written, file);
     
-    free(buffer);
     fclose(file);
     
     return (written == bytes_written) ? 0 : -1;
@@ -72,32 +95,23 @@ int history_load_from_file(calculation_history_t* history, const char* filename)
     long file_size = ftell(file);
     fseek(file, 0, SEEK_SET);
     
-    if (file_size <= 0 || file_size > 65536) {  // Reasonable size limit
-        fclose(file);
-        return -1;
-    }
-    
-    // Allocate buffer for file data
-    uint8_t* buffer = malloc(file_size);
-    if (buffer == NULL) {
+    // No valid file is larger than a full serialized history
+    if (file_size <= 0 || (size_t)file_size > HISTORY_MAX_SERIALIZED_SIZE) {
         fclose(file);
         return -1;
     }
     
     // Read file data
-    size_t read_bytes = fread(buffer, 1, file_size, file);
+    uint8_t buffer[HISTORY_MAX_SERIALIZED_SIZE];
+    size_t read_bytes = fread(buffer, 1, (size_t)file_size, file);
     fclose(file);
     
     if (read_bytes != (size_t)file_size) {
-        free(buffer);
         return -1;
     }
     
     // Deserialize history
-    int result = history_deserialize(history, buffer, read_bytes);
-    
-    free(buffer);
-    return result;
+    return history_deserialize(history, buffer, read_bytes);
 }
 
 /**
@@ -129,9 +143,218 @@ int history_delete_file(const char* filename) {
         return -1;
     }
     
+    // The log only means something on top of its snapshot
+    char log_path[MAX_PATH_LENGTH + sizeof(HISTORY_LOG_SUFFIX)];
+    if (history_sibling_path(log_path, sizeof(log_path), filename, HISTORY_LOG_SUFFIX) == 0) {
+        remove(log_path);
+    }
+    
     return remove(filename);
 }
 
+/**
+ * @brief Initialize log state; the first save then writes a full snapshot
+ * @param log Pointer to log state
+ */
+void history_log_init(history_log_t* log) {
+    if (log == NULL) {
+        return;
+    }
+    
+    memset(log, 0, sizeof(*log));
+}
+
+/**
+ * @brief Write a snapshot of history and start an empty log after it
+ * The snapshot is written beside the old one and renamed over it, so a
+ * crash leaves either the old snapshot or the new one, never a torn file.
+ * @param history Pointer to history structure
+ * @param filename Path of the snapshot file
+ * @param log Pointer to log state, updated to the new snapshot
+ * @return 0 on success, -1 on error
+ */
+int history_compact_to_file(const calculation_history_t* history, const char* filename, history_log_t* log) {
+    if (history == NULL || filename == NULL || log == NULL) {
+        return -1;
+    }
+    
+    char temp_path[MAX_PATH_LENGTH + sizeof(HISTORY_TEMP_SUFFIX)];
+    char log_path[MAX_PATH_LENGTH + sizeof(HISTORY_LOG_SUFFIX)];
+    if (history_sibling_path(temp_path, sizeof(temp_path), filename, HISTORY_TEMP_SUFFIX) != 0 ||
+        history_sibling_path(log_path, sizeof(log_path), filename, HISTORY_LOG_SUFFIX) != 0) {
+        return -1;
+    }
+    
+    uint8_t buffer[HISTORY_MAX_SERIALIZED_SIZE];
+    size_t bytes_written;
+    if (history_serialize(history, buffer, sizeof(buffer), &bytes_written) != 0) {
+        return -1;
+    }
+    
+    // Until the log is reset, appending after whatever it holds would be unsafe
+    log->ready = 0;
+    
+    if (history_save_to_file(history, temp_path) != 0 || rename(temp_path, filename) != 0) {
+        remove(temp_path);
+        return -1;
+    }
+    
+    uint8_t header[HISTORY_LOG_HEADER_SIZE];
+    uint32_t snapshot_id = history_checksum(buffer, bytes_written);
+    history_put_u32(header, HISTORY_LOG_MAGIC);
+    history_put_u32(header + 4, snapshot_id);
+    FILE* file = fopen(log_path, "wb");
+    if (file == NULL) {
+        return -1;
+    }
+    size_t written = fwrite(header, sizeof(header), 1, file);
+    if (fclose(file) != 0 || written != 1) {
+        return -1;
+    }
+    
+    log->snapshot_id = snapshot_id;
+    log->records = 0;
+    log->ready = 1;
+    return 0;
+}
+
+/**
+ * @brief Persist the change just applied to history
+ * Normally a single small append to the log; compacts instead when the log
+ * is not ready or has reached HISTORY_LOG_COMPACT_RECORDS.
+ * @param history Pointer to history structure, with the change applied
+ * @param filename Path of the snapshot file
+ * @param log Pointer to log state
+ * @param type Kind of change
+ * @param entry Entry added (HISTORY_RECORD_ADD only, NULL otherwise)
+ * @return 0 on success, -1 on error
+ */
+int history_log_save(const calculation_history_t* history, const char* filename, history_log_t* log,
+                     history_record_type_t type, const calculation_entry_t* entry) {
+    if (history == NULL || filename == NULL || log == NULL || (type == HISTORY_RECORD_ADD && entry == NULL)) {
+        return -1;
+    }
+    
+    if (!log->ready || log->records >= HISTORY_LOG_COMPACT_RECORDS) {
+        return history_compact_to_file(history, filename, log);
+    }
+    
+    char log_path[MAX_PATH_LENGTH + sizeof(HISTORY_LOG_SUFFIX)];
+    if (history_sibling_path(log_path, sizeof(log_path), filename, HISTORY_LOG_SUFFIX) != 0) {
+        return -1;
+    }
+    
+    // Checksum, type and length, then the entry in the compact encoding
+    uint8_t record[HISTORY_RECORD_PREFIX_SIZE + HISTORY_MAX_ENCODED_ENTRY_SIZE];
+    size_t payload = 0;
+    if (entry != NULL && history_encode_entry(entry, 0, record + HISTORY_RECORD_PREFIX_SIZE,
+                                              HISTORY_MAX_ENCODED_ENTRY_SIZE, &payload) != 0) {
+        return -1;
+    }
+    record[4] = (uint8_t)type;
+    record[5] = (uint8_t)payload;
+    history_put_u32(record, history_checksum(record + 4, 2 + payload));
+    size_t record_size = HISTORY_RECORD_PREFIX_SIZE + payload;
+    
+    FILE* file = fopen(log_path, "ab");
+    if (file == NULL) {
+        log->ready = 0;
+        return -1;
+    }
+    size_t written = fwrite(record, 1, record_size, file);
+    if (fclose(file) != 0 || written != record_size) {
+        // A partial record may be on disk; the next save compacts past it
+        log->ready = 0;
+        return -1;
+    }
+    
+    log->records++;
+    return 0;
+}
+
+/**
+ * @brief Load history from its snapshot and replay the log after it
+ * A missing snapshot is an empty history. Replay stops at the first torn or
+ * corrupt record; the log is then marked not ready so the next save
+ * compacts over it. A log written for a different snapshot is ignored.
+ * @param history Pointer to history structure to populate
+ * @param filename Path of the snapshot file
+ * @param log Pointer to log state to populate
+ * @return 0 on success, -1 if the snapshot exists but is unreadable
+ */
+int history_recover_from_file(calculation_history_t* history, const char* filename, history_log_t* log) {
+    if (history == NULL || filename == NULL || log == NULL) {
+        return -1;
+    }
+    
+    char log_path[MAX_PATH_LENGTH + sizeof(HISTORY_LOG_SUFFIX)];
+    if (history_sibling_path(log_path, sizeof(log_path), filename, HISTORY_LOG_SUFFIX) != 0) {
+        return -1;
+    }
+    
+    history_log_init(log);
+    history_init(history);
+    
+    // Snapshot bytes, which also identify the log that may follow them
+    uint8_t buffer[HISTORY_MAX_SERIALIZED_SIZE];
+    size_t snapshot_size = 0;
+    FILE* file = fopen(filename, "rb");
+    if (file != NULL) {
+        snapshot_size = fread(buffer, 1, sizeof(buffer), file);
+        int trailing = fgetc(file) != EOF;
+        fclose(file);
+        if (trailing || history_deserialize(history, buffer, snapshot_size) != 0) {
+            return -1;
+        }
+    } else if (history_serialize(history, buffer, sizeof(buffer), &snapshot_size) != 0) {
+        return -1;
+    }
+    
+    file = fopen(log_path, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+    
+    uint8_t header[HISTORY_LOG_HEADER_SIZE];
+    if (fread(header, sizeof(header), 1, file) != 1 || history_get_u32(header) != HISTORY_LOG_MAGIC ||
+        history_get_u32(header + 4) != history_checksum(buffer, snapshot_size)) {
+        fclose(file);
+        return 0;
+    }
+    
+    uint8_t record[HISTORY_RECORD_PREFIX_SIZE + HISTORY_MAX_ENCODED_ENTRY_SIZE];
+    int clean = 1;
+    size_t got;
+    while ((got = fread(record, 1, HISTORY_RECORD_PREFIX_SIZE, file)) > 0) {
+        size_t payload = record[5];
+        if (got != HISTORY_RECORD_PREFIX_SIZE || payload > HISTORY_MAX_ENCODED_ENTRY_SIZE ||
+            fread(record + HISTORY_RECORD_PREFIX_SIZE, 1, payload, file) != payload ||
+            history_get_u32(record) != history_checksum(record + 4, 2 + payload)) {
+            clean = 0;
+            break;
+        }
+        
+        calculation_entry_t entry;
+        size_t used;
+        if (record[4] == HISTORY_RECORD_ADD &&
+            history_decode_entry(record + HISTORY_RECORD_PREFIX_SIZE, payload, 0, &entry, &used) == 0 &&
+            used == payload) {
+            history_add_entry(history, &entry);
+        } else if (record[4] == HISTORY_RECORD_CLEAR && payload == 0) {
+            history_clear(history);
+        } else {
+            clean = 0;
+            break;
+        }
+        log->records++;
+    }
+    fclose(file);
+    
+    log->snapshot_id = history_get_u32(header + 4);
+    log->ready = (uint8_t)clean;
+    return 0;
+}
+
 /**
  * @brief Save history using default filename
  * @param history Pointer to history structure
@@ -13,6 +13,37 @@
  */
 #define MAX_PATH_LENGTH 256
 
+/**
+ * @brief Suffixes of the append-only record log and of the snapshot being written
+ */
+#define HISTORY_LOG_SUFFIX ".log"
+#define HISTORY_TEMP_SUFFIX ".tmp"
+
+/**
+ * @brief Appended records after which the next save compacts into a snapshot
+ */
+#define HISTORY_LOG_COMPACT_RECORDS (2 * MAX_HISTORY_ENTRIES)
+
+/**
+ * @brief Record kinds in the history log
+ */
+typedef enum {
+    HISTORY_RECORD_ADD = 1,
+    HISTORY_RECORD_CLEAR = 2
+} history_record_type_t;
+
+/**
+ * @brief State of the record log that follows a snapshot file
+ * The log's header names the snapshot it extends by a checksum of the
+ * snapshot's bytes, so a log left behind by a compaction that was cut short
+ * is recognised as stale and ignored rather than replayed twice.
+ */
+typedef struct {
+    uint32_t snapshot_id;  // checksum of the snapshot the log extends
+    uint32_t records;      // records appended since that snapshot
+    uint8_t ready;         // 1 once the log is known to end on a whole record
+} history_log_t;
+
 /**
  * @brief Function prototypes for history persistence
  */
@@ -21,6 +52,19 @@ int history_load_from_file(calculation_history_t* history, const char* filename)
 int history_file_exists(const char* filename);
 int history_delete_file(const char* filename);
 
+/**
+ * @brief Log-structured persistence: a snapshot file plus an append-only log
+ * history_log_save appends one record for the change just applied to
+ * history, or compacts into a fresh snapshot when the log is not ready or
+ * has grown past HISTORY_LOG_COMPACT_RECORDS. history_recover_from_file
+ * reads the snapshot (empty if missing) and replays the log's whole records.
+ */
+void history_log_init(history_log_t* log);
+int history_log_save(const calculation_history_t* history, const char* filename, history_log_t* log,
+                     history_record_type_t type, const calculation_entry_t* entry);
+int history_compact_to_file(const calculation_history_t* history, const char* filename, history_log_t* log);
+int history_recover_from_file(calculation_history_t* history, const char* filename, history_log_t* log);
+
 /**
  * @brief Convenience functions using default filename
  */
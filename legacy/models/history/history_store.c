@@ -0,0 +1,520 @@
+#include "history_store.h"
+#include "../../../src/common/cache/budget.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HISTORY_STORE_MMAP)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// "HSTR", first bytes of a store file
+#define HISTORY_STORE_MAGIC 0x52545348u
+#define HISTORY_STORE_VERSION 1
+
+#define HISTORY_STORE_PAGE_SIZE (HISTORY_STORE_PAGE_RECORDS * sizeof(calculation_entry_t))
+
+/**
+ * @brief On-disk header, padded to HISTORY_STORE_HEADER_SIZE
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t capacity;
+    uint32_t count;
+    uint32_t head;
+} history_store_header_t;
+
+static void history_store_build_index(history_store_t* store);
+
+/**
+ * @brief Budget usage callback: the hot window plus the index arrays
+ */
+static size_t history_store_budget_usage(void* context) {
+    const history_store_t* store = (const history_store_t*)context;
+    size_t usage = page_cache_reserved_bytes(&store->pages);
+    
+    if (store->indexed) {
+        usage += store->index.capacity * (sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint16_t)) +
+                 HISTORY_INDEX_MAX_SETS * sizeof(history_parameter_set_t) +
+                 HISTORY_INDEX_BUCKETS * sizeof(uint16_t);
+    }
+    return usage;
+}
+
+#if defined(CACHE_THREAD_SAFE)
+// The store has no lock of its own, so another thread's trim must not touch its pages
+#define HISTORY_STORE_BUDGET_TRIM NULL
+#else
+/**
+ * @brief Budget trim callback: drop hot pages, which reload from the file
+ */
+static size_t history_store_budget_trim(void* context, size_t bytes_wanted) {
+    history_store_t* store = (history_store_t*)context;
+    
+    return page_cache_trim(&store->pages, bytes_wanted);
+}
+#define HISTORY_STORE_BUDGET_TRIM history_store_budget_trim
+#endif
+
+static size_t history_store_slot_offset(uint32_t slot) {
+    return HISTORY_STORE_HEADER_SIZE + (size_t)slot * sizeof(calculation_entry_t);
+}
+
+static int history_store_header_valid(const history_store_header_t* header) {
+    return header->magic == HISTORY_STORE_MAGIC && header->version == HISTORY_STORE_VERSION &&
+           header->record_size == sizeof(calculation_entry_t) && header->capacity > 0 &&
+           header->count <= header->capacity && header->head < header->capacity;
+}
+
+static void history_store_adopt_header(history_store_t* store, const history_store_header_t* header) {
+    store->capacity = header->capacity;
+    store->count = header->count;
+    store->head = header->head;
+}
+
+/**
+ * @brief Write the header for the store's current count and head
+ * @return 0 on success, -1 on error
+ */
+static int history_store_write_header(history_store_t* store) {
+    history_store_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = HISTORY_STORE_MAGIC;
+    header.version = HISTORY_STORE_VERSION;
+    header.record_size = (uint16_t)sizeof(calculation_entry_t);
+    header.capacity = store->capacity;
+    header.count = store->count;
+    header.head = store->head;
+    
+#if defined(HISTORY_STORE_MMAP)
+    if (store->map != NULL) {
+        memcpy(store->map, &header, sizeof(header));
+        return 0;
+    }
+#endif
+    
+    if (fseek(store->file, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, store->file) != 1) {
+        return -1;
+    }
+    return fflush(store->file) == 0 ? 0 : -1;
+}
+
+#if defined(HISTORY_STORE_MMAP)
+static size_t history_store_file_size(uint32_t capacity) {
+    return HISTORY_STORE_HEADER_SIZE + (size_t)capacity * sizeof(calculation_entry_t);
+}
+
+/**
+ * @brief Map the store file, creating it at full size if it is empty
+ * @return 0 on success, -1 if the caller should fall back to stdio
+ */
+static int history_store_open_mapped(history_store_t* store, const char* filename, uint32_t capacity) {
+    int fd = open(filename, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    
+    struct stat st;
+    history_store_header_t header;
+    int created = 0;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+    if (st.st_size == 0) {
+        // Sparse where the file system allows it; slots are written as entries arrive
+        if (ftruncate(fd, (off_t)history_store_file_size(capacity)) != 0) {
+            close(fd);
+            return -1;
+        }
+        header.capacity = capacity;
+        header.count = 0;
+        header.head = 0;
+        created = 1;
+    } else if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+               !history_store_header_valid(&header) ||
+               (size_t)st.st_size != history_store_file_size(header.capacity)) {
+        close(fd);
+        return -1;
+    }
+    
+    size_t size = history_store_file_size(header.capacity);
+    void* map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+    
+    store->map = (uint8_t*)map;
+    store->map_size = size;
+    store->fd = fd;
+    history_store_adopt_header(store, &header);
+    return created ? history_store_write_header(store) : 0;
+}
+#endif
+
+/**
+ * @brief Open the store file through stdio with a page cache in front of it
+ * @return 0 on success, -1 on error
+ */
+static int history_store_open_buffered(history_store_t* store, const char* filename, uint32_t capacity) {
+    history_store_header_t header;
+    
+    store->file = fopen(filename, "r+b");
+    if (store->file != NULL) {
+        if (fread(&header, sizeof(header), 1, store->file) != 1 || !history_store_header_valid(&header)) {
+            fclose(store->file);
+            store->file = NULL;
+            return -1;
+        }
+        history_store_adopt_header(store, &header);
+    } else {
+        // The file grows as slots are first written; missing slots read as zeros
+        store->file = fopen(filename, "w+b");
+        if (store->file == NULL) {
+            return -1;
+        }
+        store->capacity = capacity;
+        if (history_store_write_header(store) != 0) {
+            fclose(store->file);
+            store->file = NULL;
+            return -1;
+        }
+    }
+    
+    // Lazy, so the memory budget can hand the hot window back
+    size_t page_size = HISTORY_STORE_PAGE_SIZE;
+    if (page_cache_init_classes_ex(&store->pages, HISTORY_STORE_HOT_PAGES, page_size, &page_size, 1,
+                                   PAGE_CACHE_INIT_LAZY) != 0) {
+        fclose(store->file);
+        store->file = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Open or create a history store
+ * @param store Pointer to store structure
+ * @param filename Path of the store file (NULL for HISTORY_STORE_FILENAME)
+ * @param capacity Slots for a new file (0 for HISTORY_STORE_DEFAULT_CAPACITY)
+ * @return 0 on success, -1 on error or if the file is not a valid store
+ */
+int history_store_open(history_store_t* store, const char* filename, uint32_t capacity) {
+    if (store == NULL) {
+        return -1;
+    }
+    
+    memset(store, 0, sizeof(*store));
+    store->fd = -1;
+    if (filename == NULL) {
+        filename = HISTORY_STORE_FILENAME;
+    }
+    if (capacity == 0) {
+        capacity = HISTORY_STORE_DEFAULT_CAPACITY;
+    }
+    
+    int result = -1;
+#if defined(HISTORY_STORE_MMAP)
+    result = history_store_open_mapped(store, filename, capacity);
+#endif
+    if (result != 0) {
+        result = history_store_open_buffered(store, filename, capacity);
+    }
+    if (result == 0) {
+        history_store_build_index(store);
+        store->budget_account = cache_budget_register("history.store", CACHE_BUDGET_CLASS_HISTORY,
+                                                      history_store_budget_usage,
+                                                      HISTORY_STORE_BUDGET_TRIM, store) + 1;
+    }
+    return result;
+}
+
+/**
+ * @brief Flush and close a history store
+ * @param store Pointer to store structure
+ */
+void history_store_close(history_store_t* store) {
+    if (store == NULL) {
+        return;
+    }
+    
+    if (store->budget_account > 0) {
+        cache_budget_unregister(store->budget_account - 1);
+    }
+    
+#if defined(HISTORY_STORE_MMAP)
+    if (store->map != NULL) {
+        msync(store->map, store->map_size, MS_SYNC);
+        munmap(store->map, store->map_size);
+        close(store->fd);
+    }
+#endif
+    
+    if (store->file != NULL) {
+        fclose(store->file);
+        page_cache_destroy(&store->pages);
+    }
+    if (store->indexed) {
+        history_index_destroy(&store->index);
+    }
+    
+    memset(store, 0, sizeof(*store));
+    store->fd = -1;
+}
+
+/**
+ * @brief Load the page holding slot into the hot window if it is not there
+ * @return Pointer to the page's bytes, or NULL on error
+ */
+static const uint8_t* history_store_page(history_store_t* store, uint32_t slot) {
+    uint32_t page_id = slot / HISTORY_STORE_PAGE_RECORDS;
+    page_cache_entry_t* cached = page_cache_get(&store->pages, page_id);
+    if (cached != NULL) {
+        return cached->data;
+    }
+    
+    uint8_t buffer[HISTORY_STORE_PAGE_SIZE];
+    size_t offset = history_store_slot_offset(page_id * HISTORY_STORE_PAGE_RECORDS);
+    size_t got = 0;
+    if (fseek(store->file, (long)offset, SEEK_SET) == 0) {
+        got = fread(buffer, 1, sizeof(buffer), store->file);
+    }
+    // Past the end of a file that has not grown that far yet
+    memset(buffer + got, 0, sizeof(buffer) - got);
+    
+    if (page_cache_put(&store->pages, page_id, buffer, sizeof(buffer)) != 0) {
+        return NULL;
+    }
+    cached = page_cache_get(&store->pages, page_id);
+    return cached != NULL ? cached->data : NULL;
+}
+
+static int history_store_read_slot(history_store_t* store, uint32_t slot, calculation_entry_t* entry) {
+#if defined(HISTORY_STORE_MMAP)
+    if (store->map != NULL) {
+        memcpy(entry, store->map + history_store_slot_offset(slot), sizeof(*entry));
+        return 0;
+    }
+#endif
+    
+    const uint8_t* page = history_store_page(store, slot);
+    if (page == NULL) {
+        return -1;
+    }
+    memcpy(entry, page + (slot % HISTORY_STORE_PAGE_RECORDS) * sizeof(*entry), sizeof(*entry));
+    return 0;
+}
+
+static int history_store_write_slot(history_store_t* store, uint32_t slot, const calculation_entry_t* entry) {
+#if defined(HISTORY_STORE_MMAP)
+    if (store->map != NULL) {
+        memcpy(store->map + history_store_slot_offset(slot), entry, sizeof(*entry));
+        return 0;
+    }
+#endif
+    
+    if (fseek(store->file, (long)history_store_slot_offset(slot), SEEK_SET) != 0 ||
+        fwrite(entry, sizeof(*entry), 1, store->file) != 1) {
+        return -1;
+    }
+    
+    // Write through to a resident copy of the page so the hot window stays current
+    page_cache_entry_t* cached = page_cache_get(&store->pages, slot / HISTORY_STORE_PAGE_RECORDS);
+    if (cached != NULL) {
+        memcpy(cached->data + (slot % HISTORY_STORE_PAGE_RECORDS) * sizeof(*entry), entry, sizeof(*entry));
+    }
+    return 0;
+}
+
+/**
+ * @brief Ring slot of the entry index places before the newest
+ */
+static uint32_t history_store_slot(const history_store_t* store, uint32_t index) {
+    return (uint32_t)(((uint64_t)store->head + store->capacity - 1 - index) % store->capacity);
+}
+
+/**
+ * @brief Rebuild the in-memory index by scanning the entries oldest first
+ * The store stays usable without it; only the indexed queries return 0.
+ */
+static void history_store_build_index(history_store_t* store) {
+    store->indexed = history_index_init(&store->index, store->capacity) == 0;
+    if (!store->indexed) {
+        return;
+    }
+    
+    history_index_reset(&store->index, (store->head + store->capacity - store->count) % store->capacity);
+    for (uint32_t i = store->count; i-- > 0;) {
+        calculation_entry_t entry;
+        if (history_store_read_slot(store, history_store_slot(store, i), &entry) != 0) {
+            history_index_destroy(&store->index);
+            store->indexed = 0;
+            return;
+        }
+        history_index_append(&store->index, &entry);
+    }
+}
+
+/**
+ * @brief Append an entry, overwriting the oldest once the store is full
+ * One record write plus a header update; nothing else is rewritten.
+ * @param store Pointer to store structure
+ * @param entry Entry to append
+ * @return 0 on success, -1 on error
+ */
+int history_store_append(history_store_t* store, const calculation_entry_t* entry) {
+    if (store == NULL || entry == NULL || store->capacity == 0) {
+        return -1;
+    }
+    
+    if (history_store_write_slot(store, store->head, entry) != 0) {
+        return -1;
+    }
+    if (store->indexed) {
+        history_index_append(&store->index, entry);
+    }
+    
+    store->head = (store->head + 1) % store->capacity;
+    if (store->count < store->capacity) {
+        store->count++;
+    }
+    return history_store_write_header(store);
+}
+
+/**
+ * @brief Get entry by index (0 = most recent)
+ * @param store Pointer to store structure
+ * @param index Index of entry to retrieve
+ * @param entry Pointer to entry to fill
+ * @return 0 on success, -1 on invalid index or read error
+ */
+int history_store_get(history_store_t* store, uint32_t index, calculation_entry_t* entry) {
+    if (store == NULL || entry == NULL || index >= store->count) {
+        return -1;
+    }
+    
+    return history_store_read_slot(store, history_store_slot(store, index), entry);
+}
+
+/**
+ * @brief Number of entries in the store
+ * @param store Pointer to store structure
+ * @return Entry count
+ */
+uint32_t history_store_count(const history_store_t* store) {
+    return store != NULL ? store->count : 0;
+}
+
+/**
+ * @brief Copy a run of entries for a viewport (newest first)
+ * @param store Pointer to store structure
+ * @param first Index of the first entry (0 = most recent)
+ * @param count Entries wanted
+ * @param entries Array of at least count entries
+ * @return Number of entries copied
+ */
+uint32_t history_store_read_range(history_store_t* store, uint32_t first, uint32_t count,
+                                  calculation_entry_t* entries) {
+    if (store == NULL || entries == NULL || first >= store->count) {
+        return 0;
+    }
+    
+    if (count > store->count - first) {
+        count = store->count - first;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (history_store_read_slot(store, history_store_slot(store, first + i), &entries[i]) != 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Drop all entries; slots are reused by later appends
+ * @param store Pointer to store structure
+ * @return 0 on success, -1 on error
+ */
+int history_store_clear(history_store_t* store) {
+    if (store == NULL || store->capacity == 0) {
+        return -1;
+    }
+    
+    store->count = 0;
+    store->head = 0;
+    if (store->indexed) {
+        history_index_reset(&store->index, 0);
+    }
+    return history_store_write_header(store);
+}
+
+/**
+ * @brief Number of entries of one distribution
+ * @param store Pointer to store structure
+ * @param distribution Distribution id
+ * @return Entry count
+ */
+uint32_t history_store_count_distribution(const history_store_t* store, uint8_t distribution) {
+    if (store == NULL || !store->indexed) {
+        return 0;
+    }
+    
+    return history_index_distribution_count(&store->index, distribution);
+}
+
+/**
+ * @brief Copy a run of one distribution's entries (newest first)
+ * @param store Pointer to store structure
+ * @param distribution Distribution id
+ * @param first Matching entries to skip (0 = most recent match)
+ * @param count Entries wanted
+ * @param entries Array of at least count entries
+ * @return Number of entries copied
+ */
+uint32_t history_store_read_distribution(history_store_t* store, uint8_t distribution, uint32_t first,
+                                         uint32_t count, calculation_entry_t* entries) {
+    if (store == NULL || entries == NULL || !store->indexed || count == 0) {
+        return 0;
+    }
+    
+    uint32_t available = history_index_distribution_count(&store->index, distribution);
+    if (first >= available) {
+        return 0;
+    }
+    if (count > available - first) {
+        count = available - first;
+    }
+    
+    uint32_t* slots = (uint32_t*)malloc(count * sizeof(uint32_t));
+    if (slots == NULL) {
+        return 0;
+    }
+    
+    uint32_t found = history_index_distribution_slots(&store->index, distribution, first, count, slots);
+    uint32_t copied = 0;
+    while (copied < found && history_store_read_slot(store, slots[copied], &entries[copied]) == 0) {
+        copied++;
+    }
+    free(slots);
+    return copied;
+}
+
+/**
+ * @brief The parameter sets with the most entries, most popular first
+ * @param store Pointer to store structure
+ * @param sets Output array
+ * @param max_sets Capacity of sets
+ * @return Number of sets written
+ */
+size_t history_store_popular_sets(const history_store_t* store, history_parameter_set_info_t* sets, size_t max_sets) {
+    if (store == NULL || !store->indexed) {
+        return 0;
+    }
+    
+    return history_index_popular_sets(&store->index, sets, max_sets);
+}
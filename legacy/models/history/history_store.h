@@ -0,0 +1,96 @@
+#ifndef HISTORY_STORE_H
+#define HISTORY_STORE_H
+
+#include <stdio.h>
+#include "calculation_history.h"
+#include "history_index.h"
+#include "history_persistence.h"
+#include "../../../src/common/cache/core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Default filename and size of the long-term history store
+ */
+#define HISTORY_STORE_FILENAME "calc_history.idx"
+#define HISTORY_STORE_DEFAULT_CAPACITY 4096
+
+/**
+ * @brief Fixed-record file layout
+ * A HISTORY_STORE_HEADER_SIZE header, then capacity slots of one
+ * calculation_entry_t each used as a ring, so entry i from the newest sits
+ * at a computable offset. Records are read in pages of
+ * HISTORY_STORE_PAGE_RECORDS, and at most HISTORY_STORE_HOT_PAGES pages are
+ * resident at once in a page cache; where POSIX mmap is available (and
+ * HISTORY_STORE_NO_MMAP is not defined) the file is mapped instead and the
+ * OS pages records in and out.
+ * The store registers a "history.store" account with the native memory
+ * budget (budget.h) for its hot window and index; the budget may drop the
+ * hot window, which is written through and reloads from the file. The store
+ * must stay at the same address while open.
+ */
+#define HISTORY_STORE_HEADER_SIZE 64
+#define HISTORY_STORE_PAGE_RECORDS 16
+#define HISTORY_STORE_HOT_PAGES 4
+
+#if !defined(HISTORY_STORE_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define HISTORY_STORE_MMAP 1
+#endif
+
+/**
+ * @brief Open history store; entries survive in the file, not in RAM
+ */
+typedef struct {
+    uint32_t capacity;  // slots in the file
+    uint32_t count;     // valid entries, at most capacity
+    uint32_t head;      // slot the next entry is written to
+    FILE* file;         // stdio path (NULL when mapped)
+    page_cache_t pages; // hot window of record pages (stdio path)
+    uint8_t* map;       // mapped file (mmap path, NULL otherwise)
+    size_t map_size;
+    int fd;
+    history_index_t index; // distribution and parameter-set index, rebuilt at open
+    int indexed;           // 0 if the index could not be allocated
+    int budget_account;    // memory budget account id + 1, 0 when not registered
+} history_store_t;
+
+/**
+ * @brief Function prototypes for the history store
+ * history_store_open creates the file if missing; an existing file keeps
+ * the capacity it was created with. Index 0 is the most recent entry.
+ */
+int history_store_open(history_store_t* store, const char* filename, uint32_t capacity);
+void history_store_close(history_store_t* store);
+int history_store_append(history_store_t* store, const calculation_entry_t* entry);
+int history_store_get(history_store_t* store, uint32_t index, calculation_entry_t* entry);
+uint32_t history_store_count(const history_store_t* store);
+int history_store_clear(history_store_t* store);
+
+/**
+ * @brief Copy up to count entries starting at index first (newest first)
+ * Meant for a scrolling view: only the pages under the viewport are read.
+ * @return Number of entries copied
+ */
+uint32_t history_store_read_range(history_store_t* store, uint32_t first, uint32_t count,
+                                  calculation_entry_t* entries);
+
+/**
+ * @brief Filtered and aggregate queries, answered from the in-memory index
+ * history_store_read_distribution pages through one distribution's entries
+ * the way history_store_read_range pages through all of them, reading only
+ * the matching records. history_store_popular_sets lists the parameter sets
+ * with the most entries, for warm starts. Both return 0 if the store could
+ * not allocate its index.
+ */
+uint32_t history_store_count_distribution(const history_store_t* store, uint8_t distribution);
+uint32_t history_store_read_distribution(history_store_t* store, uint8_t distribution, uint32_t first,
+                                         uint32_t count, calculation_entry_t* entries);
+size_t history_store_popular_sets(const history_store_t* store, history_parameter_set_info_t* sets, size_t max_sets);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HISTORY_STORE_H
@@ -0,0 +1,170 @@
+#include "app_state_snapshot.h"
+#include "../history/history_persistence.h"
+#include <stdio.h>
+#include <string.h>
+
+// "ASNP", first bytes of a snapshot
+#define APP_STATE_SNAPSHOT_MAGIC 0x504E5341u
+
+/**
+ * @brief FNV-1a over a byte range
+ */
+static uint32_t app_state_snapshot_checksum(const uint8_t* data, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void app_state_snapshot_put_le(uint8_t* ptr, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        ptr[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint64_t app_state_snapshot_get_le(const uint8_t* ptr, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; i++) {
+        value |= (uint64_t)ptr[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Write a resume snapshot of the application state
+ * Written beside the old snapshot and renamed over it, so a crash during
+ * save leaves the previous snapshot intact.
+ * @param state Application state to save
+ * @param filename Path of the snapshot (NULL for APP_STATE_SNAPSHOT_FILENAME)
+ * @param warm_entries Newest history results to warm the result cache with on restore
+ * @return 0 on success, -1 on error
+ */
+int app_state_snapshot_save(const app_state_t* state, const char* filename, uint8_t warm_entries) {
+    if (!state || !state->is_initialized) {
+        return -1;
+    }
+    if (!filename) {
+        filename = APP_STATE_SNAPSHOT_FILENAME;
+    }
+    
+    char temp_path[MAX_PATH_LENGTH + sizeof(HISTORY_TEMP_SUFFIX)];
+    int path_length = snprintf(temp_path, sizeof(temp_path), "%s%s", filename, HISTORY_TEMP_SUFFIX);
+    if (path_length < 0 || (size_t)path_length >= sizeof(temp_path)) {
+        return -1;
+    }
+    
+    uint8_t buffer[APP_STATE_SNAPSHOT_MAX_SIZE];
+    uint8_t* payload = buffer + APP_STATE_SNAPSHOT_HEADER_SIZE;
+    uint8_t* ptr = payload;
+    
+    *ptr++ = state->current_distribution;
+    *ptr++ = (uint8_t)state->current_category;
+    *ptr++ = state->parameter_count;
+    for (int i = 0; i < MAX_PARAMETERS; i++) {
+        uint64_t bits;
+        memcpy(&bits, &state->current_parameters[i], sizeof(bits));
+        app_state_snapshot_put_le(ptr, bits, sizeof(bits));
+        ptr += sizeof(bits);
+    }
+    
+    size_t history_size;
+    if (history_serialize(&state->history, ptr, (size_t)(buffer + sizeof(buffer) - ptr), &history_size) != 0) {
+        return -1;
+    }
+    ptr += history_size;
+    
+    size_t payload_size = (size_t)(ptr - payload);
+    int validated = app_state_validate(state) == 0 && app_state_parameters_complete(state);
+    
+    app_state_snapshot_put_le(buffer, APP_STATE_SNAPSHOT_MAGIC, 4);
+    buffer[4] = APP_STATE_SNAPSHOT_VERSION;
+    buffer[5] = validated ? APP_STATE_SNAPSHOT_VALIDATED : 0;
+    buffer[6] = 0;
+    buffer[7] = warm_entries;
+    app_state_snapshot_put_le(buffer + 8, app_state_snapshot_checksum(payload, payload_size), 4);
+    app_state_snapshot_put_le(buffer + 12, payload_size, 4);
+    
+    size_t total = APP_STATE_SNAPSHOT_HEADER_SIZE + payload_size;
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) {
+        return -1;
+    }
+    size_t written = fwrite(buffer, 1, total, file);
+    if (fclose(file) != 0 || written != total || rename(temp_path, filename) != 0) {
+        remove(temp_path);
+        return -1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Restore application state from a resume snapshot in one read
+ * The state is only written when the whole snapshot checks out, so on
+ * failure the caller can still fall back to app_state_init.
+ * @param state Application state to fill
+ * @param filename Path of the snapshot (NULL for APP_STATE_SNAPSHOT_FILENAME)
+ * @param info Optional; receives the saved validation status and warm entry count
+ * @return 0 on success, -1 if the snapshot is missing, stale or corrupt
+ */
+int app_state_snapshot_restore(app_state_t* state, const char* filename, app_state_snapshot_info_t* info) {
+    if (!state) {
+        return -1;
+    }
+    if (!filename) {
+        filename = APP_STATE_SNAPSHOT_FILENAME;
+    }
+    
+    uint8_t buffer[APP_STATE_SNAPSHOT_MAX_SIZE + 1];
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        return -1;
+    }
+    size_t size = fread(buffer, 1, sizeof(buffer), file);
+    fclose(file);
+    
+    if (size < APP_STATE_SNAPSHOT_HEADER_SIZE + APP_STATE_SNAPSHOT_FIXED_SIZE || size > APP_STATE_SNAPSHOT_MAX_SIZE) {
+        return -1;
+    }
+    if (app_state_snapshot_get_le(buffer, 4) != APP_STATE_SNAPSHOT_MAGIC || buffer[4] != APP_STATE_SNAPSHOT_VERSION) {
+        return -1;
+    }
+    
+    const uint8_t* payload = buffer + APP_STATE_SNAPSHOT_HEADER_SIZE;
+    size_t payload_size = (size_t)app_state_snapshot_get_le(buffer + 12, 4);
+    if (payload_size != size - APP_STATE_SNAPSHOT_HEADER_SIZE ||
+        app_state_snapshot_get_le(buffer + 8, 4) != app_state_snapshot_checksum(payload, payload_size)) {
+        return -1;
+    }
+    
+    // Decode into a scratch state so a bad snapshot leaves the caller's untouched
+    app_state_t restored;
+    memset(&restored, 0, sizeof(restored));
+    const uint8_t* ptr = payload;
+    restored.current_distribution = *ptr++;
+    restored.current_category = (distribution_category_t)*ptr++;
+    restored.parameter_count = *ptr++;
+    for (int i = 0; i < MAX_PARAMETERS; i++) {
+        uint64_t bits = app_state_snapshot_get_le(ptr, sizeof(bits));
+        memcpy(&restored.current_parameters[i], &bits, sizeof(bits));
+        ptr += sizeof(bits);
+    }
+    if (history_deserialize(&restored.history, ptr, (size_t)(payload + payload_size - ptr)) != 0) {
+        return -1;
+    }
+    restored.is_initialized = 1;
+    
+    // The distribution table may have changed since the save
+    if (app_state_validate(&restored) != 0) {
+        return -1;
+    }
+    
+    *state = restored;
+    if (info) {
+        info->validated = (buffer[5] & APP_STATE_SNAPSHOT_VALIDATED) != 0;
+        info->warm_entries = buffer[7];
+    }
+    return 0;
+}
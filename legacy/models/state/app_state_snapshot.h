@@ -0,0 +1,46 @@
+#ifndef APP_STATE_SNAPSHOT_H
+#define APP_STATE_SNAPSHOT_H
+
+#include "app_state.h"
+
+/**
+ * @brief Default filename for the resume snapshot
+ */
+#define APP_STATE_SNAPSHOT_FILENAME "app_state.snap"
+
+/**
+ * @brief Snapshot layout, all multi-byte fields little-endian
+ * Header: magic, version, flags, reserved byte, warm entry count, then a
+ * checksum and length of the payload. Payload: distribution, category,
+ * parameter count, the MAX_PARAMETERS parameters as IEEE-754 bits, then the
+ * history in the history_serialize encoding. The whole file is written and
+ * read with one call each.
+ */
+#define APP_STATE_SNAPSHOT_VERSION 1
+#define APP_STATE_SNAPSHOT_HEADER_SIZE 16
+#define APP_STATE_SNAPSHOT_FIXED_SIZE (3 + MAX_PARAMETERS * 8)
+#define APP_STATE_SNAPSHOT_MAX_SIZE \
+    (APP_STATE_SNAPSHOT_HEADER_SIZE + APP_STATE_SNAPSHOT_FIXED_SIZE + HISTORY_MAX_SERIALIZED_SIZE)
+
+/**
+ * @brief Snapshot flag: parameters were complete and valid when saved
+ */
+#define APP_STATE_SNAPSHOT_VALIDATED 0x01
+
+/**
+ * @brief What a restore learned beyond the state itself
+ */
+typedef struct {
+    uint8_t validated;     // 1 if the UI can offer Calculate without re-validating
+    uint8_t warm_entries;  // newest history results to hand to orchestrator_warm_result_cache
+} app_state_snapshot_info_t;
+
+/**
+ * @brief Function prototypes for app state snapshots
+ * Save on hide; restore on start in place of app_state_init, falling back
+ * to it when restore fails (missing, stale version or corrupt snapshot).
+ */
+int app_state_snapshot_save(const app_state_t* state, const char* filename, uint8_t warm_entries);
+int app_state_snapshot_restore(app_state_t* state, const char* filename, app_state_snapshot_info_t* info);
+
+#endif // APP_STATE_SNAPSHOT_H
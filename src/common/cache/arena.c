@@ -0,0 +1,20 @@
+#include "arena.h"
+
+#include "sync.h"
+
+/* uint64_t words keep the region CACHE_ARENA_ALIGN-aligned */
+static CACHE_THREAD_LOCAL uint64_t g_thread_region[CACHE_ARENA_THREAD_BYTES / sizeof(uint64_t)];
+static CACHE_THREAD_LOCAL cache_arena_t g_thread_arena;
+static uint64_t g_thread_arena_count;
+
+cache_arena_t *cache_arena_thread(void) {
+    if (!g_thread_arena.base) {
+        cache_arena_init(&g_thread_arena, g_thread_region, sizeof(g_thread_region));
+        cache_counter_add(&g_thread_arena_count, 1);
+    }
+    return &g_thread_arena;
+}
+
+size_t cache_arena_thread_count(void) {
+    return (size_t)cache_counter_load(&g_thread_arena_count);
+}
@@ -0,0 +1,85 @@
+#ifndef CACHE_ARENA_H
+#define CACHE_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Bump allocator over a caller-owned region.
+ *
+ * Allocations are never freed one by one: the whole arena is reset (or
+ * rewound to a mark) at once, so scratch memory for a bridge call costs a
+ * pointer bump and never touches the heap.
+ */
+
+/* Enough for the doubles, 64-bit counters and pointers the bridge stores */
+#define CACHE_ARENA_ALIGN 8
+
+/* Backing size of each thread's arena; fits the largest bridge response plus scratch. */
+#define CACHE_ARENA_THREAD_BYTES (48 * 1024)
+
+typedef struct {
+    uint8_t *base;
+    size_t capacity;
+    size_t used;
+    size_t high_water;
+    uint64_t failures;
+} cache_arena_t;
+
+static inline void cache_arena_init(cache_arena_t *arena, void *buffer, size_t capacity) {
+    arena->base = (uint8_t *)buffer;
+    arena->capacity = buffer ? capacity : 0;
+    arena->used = 0;
+    arena->high_water = 0;
+    arena->failures = 0;
+}
+
+/* Returns CACHE_ARENA_ALIGN-aligned memory (given an aligned region), or NULL once the region is exhausted. */
+static inline void *cache_arena_alloc(cache_arena_t *arena, size_t size) {
+    size_t offset = (arena->used + (CACHE_ARENA_ALIGN - 1)) & ~(size_t)(CACHE_ARENA_ALIGN - 1);
+
+    if (offset > arena->capacity || size > arena->capacity - offset) {
+        arena->failures += 1;
+        return NULL;
+    }
+
+    arena->used = offset + size;
+    if (arena->used > arena->high_water) {
+        arena->high_water = arena->used;
+    }
+    return arena->base + offset;
+}
+
+static inline size_t cache_arena_mark(const cache_arena_t *arena) {
+    return arena->used;
+}
+
+/* Releases everything allocated since mark. */
+static inline void cache_arena_rewind(cache_arena_t *arena, size_t mark) {
+    if (mark <= arena->used) {
+        arena->used = mark;
+    }
+}
+
+static inline void cache_arena_reset(cache_arena_t *arena) {
+    arena->used = 0;
+}
+
+/*
+ * The calling thread's arena over a static CACHE_ARENA_THREAD_BYTES region
+ * (one region per thread in CACHE_THREAD_SAFE builds, see sync.h).
+ */
+cache_arena_t *cache_arena_thread(void);
+
+/* Threads whose arena has been set up; their regions stay until the thread exits. */
+size_t cache_arena_thread_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
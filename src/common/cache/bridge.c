@@ -1,8 +1,20 @@
 #include "bridge.h"
 
+#include "arena.h"
+#include "budget.h"
+#include "intern.h"
 #include "service.h"
+#include "sync.h"
+#include "trace.h"
+#include "../../../legacy/core/math/math_utils.h"
+#include "../../../legacy/core/math/decimal_format.h"
+#include "../../../legacy/calc/engine/calculation_orchestrator.h"
+#include "../../../legacy/calc/engine/pmf_table_cache.h"
+#include "../../../legacy/calc/engine/native_plugin_interface.h"
 
 #include <ctype.h>
+#include <limits.h>
+#include <math.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -13,37 +25,85 @@
  *
  * It uses a small static registry and a conservative JSON parser tailored
  * to the request shapes produced by `src/common/cache/provider.js`.
+ *
+ * Each cache is split into 1..CACHE_BRIDGE_MAX_SHARDS shards picked by key
+ * hash, each with its own bindings, page cache and lock. In CACHE_THREAD_SAFE
+ * builds (see sync.h) any thread may call the value functions; create,
+ * destroy and the registry are guarded by one registry lock, but destroying
+ * a handle while another thread still uses it is not supported.
+ *
+ * Steady-state calls do not touch the heap: keys are interned (intern.h) and
+ * responses and value copies come from the calling thread's arena
+ * (arena.h), which is reset as each public entry point begins. A returned
+ * response or pointer therefore stays valid until the thread's next call.
  */
 
 enum {
-    CACHE_BRIDGE_MAX_CACHES = 8,
+    /* An integer handle keeps the slot index in its low CACHE_BRIDGE_ID_SLOT_BITS bits */
+    CACHE_BRIDGE_ID_SLOT_BITS = 3,
+    CACHE_BRIDGE_MAX_CACHES = 1 << CACHE_BRIDGE_ID_SLOT_BITS,
+    CACHE_BRIDGE_MAX_SHARDS = 8,
     CACHE_BRIDGE_MAX_HANDLE_LEN = 32,
     CACHE_BRIDGE_MAX_NAMESPACE_LEN = 64,
     CACHE_BRIDGE_MAX_KEY_LEN = 128,
+    CACHE_BRIDGE_MAX_PATH_LEN = 256,
     CACHE_BRIDGE_MAX_CAPACITY_PAGES = 1024,
     CACHE_BRIDGE_MAX_VALUE_LEN = 4096,
-    CACHE_BRIDGE_MAX_RESPONSE_LEN = 8192
+    CACHE_BRIDGE_MAX_RESPONSE_LEN = 8192,
+    CACHE_BRIDGE_MAX_ERROR_LEN = 128,
+    CACHE_BRIDGE_MAX_BATCH_KEYS = 256,
+    CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN = 32768,
+    /* Kept free while filling a getMany response: a null per remaining key plus the tail */
+    CACHE_BRIDGE_BATCH_RESERVE = CACHE_BRIDGE_MAX_BATCH_KEYS * 5 + 32
 };
 
+/*
+ * Key index slots hold a binding index + 1; 0 is empty. A binding's page id
+ * is also its index + 1, so free binding indices double as free page ids.
+ */
+#define CACHE_BRIDGE_INDEX_EMPTY 0u
+#define CACHE_BRIDGE_INDEX_TOMBSTONE UINT32_MAX
+
 typedef struct {
     int in_use;
-    char *key;
+    /* Interned; see intern.h */
+    const char *key;
+    uint32_t hash;
     uint32_t page_id;
+    uint32_t next_free;
 } cache_bridge_key_binding_t;
 
 typedef struct {
-    int in_use;
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
-    char cache_namespace[CACHE_BRIDGE_MAX_NAMESPACE_LEN];
+    cache_lock_t lock;
     cache_service_t service;
     cache_bridge_key_binding_t *bindings;
     size_t binding_capacity;
     size_t binding_count;
-    uint32_t next_page_id;
+    uint32_t free_head;
+    uint32_t *key_index;
+    size_t index_capacity;
+    size_t index_tombstones;
+} cache_bridge_shard_t;
+
+typedef struct {
+    int in_use;
+    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
+    cache_bridge_id_t id;
+    char cache_namespace[CACHE_BRIDGE_MAX_NAMESPACE_LEN];
+    cache_bridge_shard_t *shards;
+    size_t shard_count;
 } cache_bridge_slot_t;
 
+/* Indexed by page_cache_policy_t; also the "policy" names accepted by cache.create */
+static const char *const cache_bridge_policy_names[PAGE_CACHE_POLICY_COUNT] = {"clock", "cost"};
 static cache_bridge_slot_t g_cache_slots[CACHE_BRIDGE_MAX_CACHES];
 static unsigned int g_next_handle_id = 1;
+static cache_lock_t g_registry_lock = CACHE_LOCK_INITIALIZER;
+static cache_bridge_crossings_t g_crossings;
+/* The "cache.pages" budget account, registered with the first cache */
+static cache_lock_t g_budget_account_lock = CACHE_LOCK_INITIALIZER;
+static int g_budget_account = -1;
+static size_t g_budget_trim_cursor;
 
 static int cache_bridge_validate_config(size_t capacity_pages, size_t page_size) {
     if (capacity_pages == 0 || page_size == 0) {
@@ -57,72 +117,117 @@ static int cache_bridge_validate_config(size_t capacity_pages, size_t page_size)
     return 0;
 }
 
-static void cache_bridge_release_binding(cache_bridge_key_binding_t *binding) {
-    if (!binding || !binding->in_use) {
-        return;
-    }
-
-    free(binding->key);
-    memset(binding, 0, sizeof(*binding));
-}
-
-static void cache_bridge_release_bindings(cache_bridge_slot_t *slot) {
+static void cache_bridge_release_bindings(cache_bridge_shard_t *shard) {
     size_t i;
 
-    if (!slot || !slot->bindings) {
+    if (!shard || !shard->bindings) {
         return;
     }
 
-    for (i = 0; i < slot->binding_capacity; ++i) {
-        cache_bridge_release_binding(&slot->bindings[i]);
+    for (i = 0; i < shard->binding_capacity; ++i) {
+        cache_intern_release(shard->bindings[i].key);
     }
 
-    free(slot->bindings);
-    slot->bindings = NULL;
-    slot->binding_capacity = 0;
-    slot->binding_count = 0;
-    slot->next_page_id = 1;
+    free(shard->bindings);
+    free(shard->key_index);
+    shard->bindings = NULL;
+    shard->key_index = NULL;
+    shard->binding_capacity = 0;
+    shard->binding_count = 0;
+    shard->free_head = 0;
+    shard->index_capacity = 0;
+    shard->index_tombstones = 0;
 }
 
+/* Caller holds the registry lock. */
 static void cache_bridge_reset_slot(cache_bridge_slot_t *slot) {
+    size_t i;
+
     if (!slot) {
         return;
     }
 
-    if (slot->service.ready) {
-        cache_service_shutdown(&slot->service);
+    for (i = 0; slot->shards && i < slot->shard_count; ++i) {
+        cache_bridge_shard_t *shard = &slot->shards[i];
+
+        if (shard->service.ready) {
+            cache_service_shutdown(&shard->service);
+        }
+        cache_bridge_release_bindings(shard);
+        cache_lock_destroy(&shard->lock);
     }
-    cache_bridge_release_bindings(slot);
+
+    free(slot->shards);
     memset(slot, 0, sizeof(*slot));
 }
 
-static int cache_bridge_init_bindings(cache_bridge_slot_t *slot, size_t capacity_pages) {
+static void cache_bridge_on_evict(void *context, uint32_t page_id);
+
+static int cache_bridge_init_bindings(cache_bridge_shard_t *shard, size_t entry_capacity) {
     size_t binding_capacity;
+    size_t index_capacity = 1;
+    size_t i;
 
-    if (!slot || capacity_pages == 0) {
+    if (!shard || entry_capacity == 0) {
         return -1;
     }
 
-    binding_capacity = capacity_pages * 2;
+    binding_capacity = entry_capacity * 2;
     if (binding_capacity < 8) {
         binding_capacity = 8;
     }
 
-    slot->bindings =
+    while (index_capacity < binding_capacity * 2) {
+        index_capacity <<= 1;
+    }
+
+    shard->bindings =
         (cache_bridge_key_binding_t *)calloc(binding_capacity, sizeof(cache_bridge_key_binding_t));
-    if (!slot->bindings) {
+    shard->key_index = (uint32_t *)calloc(index_capacity, sizeof(uint32_t));
+    if (!shard->bindings || !shard->key_index) {
+        free(shard->bindings);
+        free(shard->key_index);
+        shard->bindings = NULL;
+        shard->key_index = NULL;
         return -1;
     }
 
-    slot->binding_capacity = binding_capacity;
-    slot->binding_count = 0;
-    slot->next_page_id = 1;
+    for (i = 0; i < binding_capacity; ++i) {
+        shard->bindings[i].page_id = (uint32_t)(i + 1);
+        shard->bindings[i].next_free = i + 1 < binding_capacity ? (uint32_t)(i + 2) : 0;
+    }
+
+    shard->binding_capacity = binding_capacity;
+    shard->binding_count = 0;
+    shard->free_head = 1;
+    shard->index_capacity = index_capacity;
+    shard->index_tombstones = 0;
+    cache_service_set_evict_callback(&shard->service, cache_bridge_on_evict, shard);
     return 0;
 }
 
+/* Returned when the thread's arena cannot hold a response */
+static const char cache_bridge_scratch_exhausted[] = "{\"ok\":false,\"errorMessage\":\"scratch_exhausted\"}";
+
+/* Counts a crossing and rewinds the thread's arena; every public entry point starts here. */
+static void cache_bridge_begin_call(uint64_t *crossings) {
+    cache_counter_add(crossings, 1);
+    cache_arena_reset(cache_arena_thread());
+}
+
+/* Scratch that lives until the calling thread's next bridge call. */
+static void *cache_bridge_scratch(size_t size) {
+    return cache_arena_alloc(cache_arena_thread(), size);
+}
+
 static const char *cache_bridge_error_response(const char *message) {
-    static char response[CACHE_BRIDGE_MAX_RESPONSE_LEN];
-    snprintf(response, sizeof(response),
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_ERROR_LEN);
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    snprintf(response, CACHE_BRIDGE_MAX_ERROR_LEN,
              "{\"ok\":false,\"errorMessage\":\"%s\"}",
              message ? message : "cache_bridge_error");
     return response;
@@ -139,31 +244,43 @@ static const char *cache_bridge_skip_whitespace(const char *cursor) {
     return cursor;
 }
 
-static int cache_bridge_extract_string(const char *json,
-                                       const char *key,
-                                       char *out_value,
-                                       size_t out_size) {
+/* Start of key's value (past the colon and whitespace), or NULL if key is absent. */
+static const char *cache_bridge_find_value(const char *json, const char *key) {
     char needle[64];
     const char *cursor;
-    size_t out_index = 0;
 
-    if (!json || !key || !out_value || out_size == 0) {
-        return -1;
+    if (!json || !key) {
+        return NULL;
     }
 
     snprintf(needle, sizeof(needle), "\"%s\"", key);
     cursor = strstr(json, needle);
     if (!cursor) {
-        return -1;
+        return NULL;
     }
 
     cursor = strchr(cursor + strlen(needle), ':');
     if (!cursor) {
-        return -1;
+        return NULL;
     }
 
-    cursor = cache_bridge_skip_whitespace(cursor + 1);
-    if (!cursor || *cursor != '"') {
+    return cache_bridge_skip_whitespace(cursor + 1);
+}
+
+/* Optional boolean member: 1 only for a literal true. */
+static int cache_bridge_extract_flag(const char *json, const char *key) {
+    const char *cursor = cache_bridge_find_value(json, key);
+    return cursor && strncmp(cursor, "true", 4) == 0;
+}
+
+/* Decodes the JSON string literal at cursor; *out_end is set past its closing quote. */
+static int cache_bridge_parse_string(const char *cursor,
+                                     char *out_value,
+                                     size_t out_size,
+                                     const char **out_end) {
+    size_t out_index = 0;
+
+    if (!cursor || *cursor != '"' || !out_value || out_size == 0) {
         return -1;
     }
 
@@ -200,9 +317,47 @@ static int cache_bridge_extract_string(const char *json,
     }
 
     out_value[out_index] = '\0';
+    if (out_end) {
+        *out_end = cursor + 1;
+    }
     return 0;
 }
 
+static int cache_bridge_extract_string(const char *json,
+                                       const char *key,
+                                       char *out_value,
+                                       size_t out_size) {
+    return cache_bridge_parse_string(cache_bridge_find_value(json, key), out_value, out_size, NULL);
+}
+
+/*
+ * Array iteration for the batch methods: *cursor starts at the value of an
+ * array key and is left on the next element. Returns 1 while elements remain,
+ * 0 at the closing bracket and -1 on malformed input.
+ */
+static int cache_bridge_array_open(const char **cursor) {
+    if (!*cursor || **cursor != '[') {
+        return -1;
+    }
+
+    *cursor = cache_bridge_skip_whitespace(*cursor + 1);
+    return **cursor == ']' ? 0 : 1;
+}
+
+static int cache_bridge_array_next(const char **cursor) {
+    *cursor = cache_bridge_skip_whitespace(*cursor);
+    if (**cursor == ']') {
+        return 0;
+    }
+
+    if (**cursor != ',') {
+        return -1;
+    }
+
+    *cursor = cache_bridge_skip_whitespace(*cursor + 1);
+    return 1;
+}
+
 static int cache_bridge_extract_size(const char *json, const char *key, size_t *out_value) {
     char needle[64];
     const char *cursor;
@@ -238,21 +393,40 @@ static int cache_bridge_extract_size(const char *json, const char *key, size_t *
     return 0;
 }
 
-static uint32_t cache_bridge_hash_key(const char *text) {
-    uint32_t hash = 2166136261u;
-    unsigned char ch;
+static int cache_bridge_extract_double(const char *json, const char *key, double *out_value) {
+    char needle[64];
+    const char *cursor;
+    char *end_ptr;
+    double value;
 
-    if (!text) {
-        return 0;
+    if (!json || !key || !out_value) {
+        return -1;
+    }
+
+    snprintf(needle, sizeof(needle), "\"%s\"", key);
+    cursor = strstr(json, needle);
+    if (!cursor) {
+        return -1;
+    }
+
+    cursor = strchr(cursor + strlen(needle), ':');
+    if (!cursor) {
+        return -1;
     }
 
-    while (*text) {
-        ch = (unsigned char)*text++;
-        hash ^= (uint32_t)ch;
-        hash *= 16777619u;
+    cursor = cache_bridge_skip_whitespace(cursor + 1);
+    value = strtod(cursor, &end_ptr);
+    if (end_ptr == cursor) {
+        return -1;
     }
 
-    return hash;
+    *out_value = value;
+    return 0;
+}
+
+/* The intern pool's hash, so a binding's hash can be handed straight to cache_intern_acquire */
+static uint32_t cache_bridge_hash_key(const char *text) {
+    return text ? cache_intern_hash(text, strlen(text)) : 0;
 }
 
 static void cache_bridge_escape_json_string(const char *input, char *output, size_t output_size) {
@@ -285,414 +459,1652 @@ static void cache_bridge_escape_json_string(const char *input, char *output, siz
 }
 
 static cache_bridge_slot_t *cache_bridge_find_slot(const char *handle) {
+    cache_bridge_slot_t *slot = NULL;
     size_t i;
 
     if (!handle) {
         return NULL;
     }
 
+    cache_lock_acquire(&g_registry_lock);
     for (i = 0; i < CACHE_BRIDGE_MAX_CACHES; ++i) {
         if (g_cache_slots[i].in_use && strcmp(g_cache_slots[i].handle, handle) == 0) {
-            return &g_cache_slots[i];
+            slot = &g_cache_slots[i];
+            break;
         }
     }
+    cache_lock_release(&g_registry_lock);
 
-    return NULL;
+    return slot;
 }
 
-static cache_bridge_slot_t *cache_bridge_alloc_slot(void) {
-    size_t i;
+/* One compare instead of a scan: the id names its slot, and the serial must still match. */
+static cache_bridge_slot_t *cache_bridge_find_slot_by_id(cache_bridge_id_t id) {
+    cache_bridge_slot_t *slot = &g_cache_slots[id & (CACHE_BRIDGE_MAX_CACHES - 1)];
 
-    for (i = 0; i < CACHE_BRIDGE_MAX_CACHES; ++i) {
-        if (!g_cache_slots[i].in_use) {
-            memset(&g_cache_slots[i], 0, sizeof(g_cache_slots[i]));
-            g_cache_slots[i].in_use = 1;
-            return &g_cache_slots[i];
-        }
+    if (id == CACHE_BRIDGE_INVALID_ID) {
+        return NULL;
+    }
+
+    cache_lock_acquire(&g_registry_lock);
+    if (!slot->in_use || slot->id != id) {
+        slot = NULL;
     }
+    cache_lock_release(&g_registry_lock);
 
-    return NULL;
+    return slot;
 }
- 
-static uint32_t cache_bridge_next_page_id(cache_bridge_slot_t *slot) {
-    uint32_t page_id;
 
-    if (!slot) {
-        return 0;
+/*
+ * Shards take the high hash bits; the low bits already pick the bucket in
+ * the shard's key index.
+ */
+static cache_bridge_shard_t *cache_bridge_shard_for_key(cache_bridge_slot_t *slot, const char *key) {
+    if (!slot || !key) {
+        return NULL;
     }
 
-    for (;;) {
-        size_t i;
-        int in_use = 0;
+    return &slot->shards[(cache_bridge_hash_key(key) >> 16) % slot->shard_count];
+}
 
-        page_id = slot->next_page_id++;
-        if (page_id == 0) {
-            page_id = slot->next_page_id++;
-        }
+/* Budget usage callback: page cache reservations plus the key tables, over every cache. */
+static size_t cache_bridge_budget_usage(void *context) {
+    size_t usage = 0;
+    size_t i;
+    size_t j;
 
-        for (i = 0; i < slot->binding_capacity; ++i) {
-            if (slot->bindings[i].in_use && slot->bindings[i].page_id == page_id) {
-                in_use = 1;
-                break;
-            }
+    (void)context;
+    cache_lock_acquire(&g_registry_lock);
+    for (i = 0; i < CACHE_BRIDGE_MAX_CACHES; ++i) {
+        cache_bridge_slot_t *slot = &g_cache_slots[i];
+
+        for (j = 0; slot->in_use && j < slot->shard_count; ++j) {
+            cache_bridge_shard_t *shard = &slot->shards[j];
+
+            cache_lock_acquire(&shard->lock);
+            usage += page_cache_reserved_bytes(&shard->service.cache) +
+                     shard->binding_capacity * sizeof(cache_bridge_key_binding_t) +
+                     shard->index_capacity * sizeof(uint32_t);
+            cache_lock_release(&shard->lock);
         }
+    }
+    cache_lock_release(&g_registry_lock);
+
+    return usage;
+}
 
-        if (!in_use) {
-            return page_id;
+/* Budget trim callback. The starting cache rotates so one cache does not absorb every trim. */
+static size_t cache_bridge_budget_trim(void *context, size_t bytes_wanted) {
+    size_t freed = 0;
+    size_t n;
+    size_t j;
+
+    (void)context;
+    cache_lock_acquire(&g_registry_lock);
+    for (n = 0; n < CACHE_BRIDGE_MAX_CACHES && freed < bytes_wanted; ++n) {
+        cache_bridge_slot_t *slot = &g_cache_slots[(g_budget_trim_cursor + n) % CACHE_BRIDGE_MAX_CACHES];
+
+        for (j = 0; slot->in_use && j < slot->shard_count && freed < bytes_wanted; ++j) {
+            cache_lock_acquire(&slot->shards[j].lock);
+            freed += cache_service_trim(&slot->shards[j].service, bytes_wanted - freed);
+            cache_lock_release(&slot->shards[j].lock);
         }
     }
+    g_budget_trim_cursor = (g_budget_trim_cursor + 1) % CACHE_BRIDGE_MAX_CACHES;
+    cache_lock_release(&g_registry_lock);
+
+    return freed;
+}
+
+/* Outside the registry lock: the budget calls back into it. */
+static void cache_bridge_register_budget(void) {
+    cache_lock_acquire(&g_budget_account_lock);
+    if (g_budget_account < 0) {
+        g_budget_account = cache_budget_register("cache.pages",
+                                                 CACHE_BUDGET_CLASS_PAGES,
+                                                 cache_bridge_budget_usage,
+                                                 cache_bridge_budget_trim,
+                                                 NULL);
+    }
+    cache_lock_release(&g_budget_account_lock);
 }
 
-static void cache_bridge_compact_bindings(cache_bridge_slot_t *slot) {
+static cache_bridge_slot_t *cache_bridge_create_slot(const char *namespace_name,
+                                                     size_t capacity_pages,
+                                                     size_t page_size,
+                                                     size_t shard_count,
+                                                     unsigned int init_flags) {
+    cache_bridge_slot_t *slot = NULL;
+    size_t shard_pages;
     size_t i;
 
-    if (!slot || !slot->bindings) {
-        return;
+    if (cache_bridge_validate_config(capacity_pages, page_size) != 0 ||
+        shard_count == 0 || shard_count > CACHE_BRIDGE_MAX_SHARDS || shard_count > capacity_pages) {
+        return NULL;
     }
 
-    for (i = 0; i < slot->binding_capacity; ++i) {
-        cache_bridge_key_binding_t *binding = &slot->bindings[i];
-        if (!binding->in_use) {
-            continue;
-        }
-
-        if (!cache_service_has(&slot->service, binding->page_id)) {
-            cache_bridge_release_binding(binding);
-            if (slot->binding_count > 0) {
-                slot->binding_count -= 1;
-            }
+    cache_bridge_register_budget();
+    cache_lock_acquire(&g_registry_lock);
+    for (i = 0; i < CACHE_BRIDGE_MAX_CACHES; ++i) {
+        if (!g_cache_slots[i].in_use) {
+            slot = &g_cache_slots[i];
+            break;
         }
     }
-}
 
-static cache_bridge_key_binding_t *cache_bridge_find_binding(cache_bridge_slot_t *slot, const char *key) {
-    size_t i;
+    if (!slot) {
+        cache_lock_release(&g_registry_lock);
+        return NULL;
+    }
 
-    if (!slot || !slot->bindings || !key) {
+    memset(slot, 0, sizeof(*slot));
+    slot->shards = (cache_bridge_shard_t *)calloc(shard_count, sizeof(cache_bridge_shard_t));
+    if (!slot->shards) {
+        cache_lock_release(&g_registry_lock);
         return NULL;
     }
 
-    for (i = 0; i < slot->binding_capacity; ++i) {
-        cache_bridge_key_binding_t *binding = &slot->bindings[i];
-        if (!binding->in_use || !binding->key) {
-            continue;
+    slot->in_use = 1;
+    slot->shard_count = shard_count;
+    /* Serials wrap before the shift could push them out of the id */
+    if (g_next_handle_id > (UINT32_MAX >> CACHE_BRIDGE_ID_SLOT_BITS)) {
+        g_next_handle_id = 1;
+    }
+    slot->id = ((cache_bridge_id_t)g_next_handle_id << CACHE_BRIDGE_ID_SLOT_BITS) | (cache_bridge_id_t)i;
+    snprintf(slot->handle, sizeof(slot->handle), "cache-%u", g_next_handle_id++);
+    snprintf(slot->cache_namespace, sizeof(slot->cache_namespace), "%s", namespace_name ? namespace_name : "");
+
+    for (i = 0; i < shard_count; ++i) {
+        cache_lock_init(&slot->shards[i].lock);
+    }
+
+    shard_pages = (capacity_pages + shard_count - 1) / shard_count;
+    for (i = 0; i < shard_count; ++i) {
+        cache_bridge_shard_t *shard = &slot->shards[i];
+
+        /* Slab classes hold more entries than pages, so bindings follow the entry count */
+        if (cache_service_init_ex(&shard->service, shard_pages, page_size, init_flags) != 0 ||
+            cache_bridge_init_bindings(shard, shard->service.cache.entry_capacity) != 0) {
+            cache_bridge_reset_slot(slot);
+            cache_lock_release(&g_registry_lock);
+            return NULL;
         }
+    }
 
-        if (strcmp(binding->key, key) != 0) {
-            continue;
+    cache_lock_release(&g_registry_lock);
+    return slot;
+}
+ 
+/*
+ * Linear probe for key. Returns the index slot holding it, or, when absent,
+ * the slot an insert should use (first tombstone seen, else the empty slot).
+ */
+static size_t cache_bridge_index_probe(const cache_bridge_shard_t *shard,
+                                       const char *key,
+                                       uint32_t hash,
+                                       int *found) {
+    size_t mask = shard->index_capacity - 1;
+    size_t index = (size_t)hash & mask;
+    size_t first_tombstone = SIZE_MAX;
+
+    for (;;) {
+        uint32_t entry = shard->key_index[index];
+        if (entry == CACHE_BRIDGE_INDEX_EMPTY) {
+            *found = 0;
+            return first_tombstone != SIZE_MAX ? first_tombstone : index;
         }
 
-        if (!cache_service_has(&slot->service, binding->page_id)) {
-            cache_bridge_release_binding(binding);
-            if (slot->binding_count > 0) {
-                slot->binding_count -= 1;
+        if (entry == CACHE_BRIDGE_INDEX_TOMBSTONE) {
+            if (first_tombstone == SIZE_MAX) {
+                first_tombstone = index;
+            }
+        } else {
+            const cache_bridge_key_binding_t *binding = &shard->bindings[entry - 1];
+            if (binding->hash == hash && strcmp(binding->key, key) == 0) {
+                *found = 1;
+                return index;
             }
-            return NULL;
         }
 
-        return binding;
+        index = (index + 1) & mask;
     }
-
-    return NULL;
 }
 
-static cache_bridge_key_binding_t *cache_bridge_bind_key(cache_bridge_slot_t *slot, const char *key) {
+/* Drops tombstones once they make up a quarter of the index, so misses stay short. */
+static void cache_bridge_index_rebuild(cache_bridge_shard_t *shard) {
     size_t i;
-    cache_bridge_key_binding_t *binding;
-    char *key_copy;
 
-    if (!slot || !slot->bindings || !key) {
-        return NULL;
+    memset(shard->key_index, 0, shard->index_capacity * sizeof(uint32_t));
+    shard->index_tombstones = 0;
+
+    for (i = 0; i < shard->binding_capacity; ++i) {
+        const cache_bridge_key_binding_t *binding = &shard->bindings[i];
+        size_t index;
+        int found = 0;
+
+        if (!binding->in_use) {
+            continue;
+        }
+
+        index = cache_bridge_index_probe(shard, binding->key, binding->hash, &found);
+        shard->key_index[index] = (uint32_t)(i + 1);
     }
+}
 
-    binding = cache_bridge_find_binding(slot, key);
-    if (binding) {
-        return binding;
+static void cache_bridge_unbind_key(cache_bridge_shard_t *shard, cache_bridge_key_binding_t *binding) {
+    size_t index;
+    int found = 0;
+
+    if (!shard || !binding || !binding->in_use) {
+        return;
     }
 
-    if (slot->binding_count >= slot->binding_capacity) {
-        cache_bridge_compact_bindings(slot);
+    index = cache_bridge_index_probe(shard, binding->key, binding->hash, &found);
+    if (found) {
+        shard->key_index[index] = CACHE_BRIDGE_INDEX_TOMBSTONE;
+        shard->index_tombstones += 1;
     }
 
-    if (slot->binding_count >= slot->binding_capacity) {
-        return NULL;
+    cache_intern_release(binding->key);
+    binding->key = NULL;
+    binding->in_use = 0;
+    binding->next_free = shard->free_head;
+    shard->free_head = binding->page_id;
+    if (shard->binding_count > 0) {
+        shard->binding_count -= 1;
     }
 
-    key_copy = (char *)malloc(strlen(key) + 1);
-    if (!key_copy) {
-        return NULL;
+    if (shard->index_tombstones * 4 > shard->index_capacity) {
+        cache_bridge_index_rebuild(shard);
     }
-    strcpy(key_copy, key);
+}
 
-    for (i = 0; i < slot->binding_capacity; ++i) {
-        binding = &slot->bindings[i];
-        if (binding->in_use) {
-            continue;
-        }
+/* Page eviction callback: the cache dropped page_id, so its key goes too. */
+static void cache_bridge_on_evict(void *context, uint32_t page_id) {
+    cache_bridge_shard_t *shard = (cache_bridge_shard_t *)context;
 
-        binding->in_use = 1;
-        binding->key = key_copy;
-        binding->page_id = cache_bridge_next_page_id(slot);
-        slot->binding_count += 1;
-        return binding;
+    if (!shard || !shard->bindings || page_id == 0 || page_id > shard->binding_capacity) {
+        return;
     }
 
-    free(key_copy);
-    return NULL;
+    cache_bridge_unbind_key(shard, &shard->bindings[page_id - 1]);
 }
 
-static void cache_bridge_unbind_key(cache_bridge_slot_t *slot, cache_bridge_key_binding_t *binding) {
-    if (!slot || !binding || !binding->in_use) {
-        return;
+static cache_bridge_key_binding_t *cache_bridge_find_binding(cache_bridge_shard_t *shard, const char *key) {
+    cache_bridge_key_binding_t *binding;
+    size_t index;
+    int found = 0;
+
+    if (!shard || !shard->bindings || !key) {
+        return NULL;
+    }
+
+    index = cache_bridge_index_probe(shard, key, cache_bridge_hash_key(key), &found);
+    if (!found) {
+        return NULL;
     }
 
-    cache_bridge_release_binding(binding);
-    if (slot->binding_count > 0) {
-        slot->binding_count -= 1;
+    binding = &shard->bindings[shard->key_index[index] - 1];
+    /* Liveness checks go to the page cache so they stay out of the HAS latency */
+    if (!page_cache_has(&shard->service.cache, binding->page_id)) {
+        cache_bridge_unbind_key(shard, binding);
+        return NULL;
     }
+
+    return binding;
 }
 
-static const char *cache_bridge_handle_create(const char *params_json) {
-    static char response[CACHE_BRIDGE_MAX_RESPONSE_LEN];
-    cache_bridge_slot_t *slot;
-    char cache_namespace[CACHE_BRIDGE_MAX_NAMESPACE_LEN];
-    size_t capacity_pages = 0;
-    size_t page_size = 0;
+static cache_bridge_key_binding_t *cache_bridge_bind_key(cache_bridge_shard_t *shard, const char *key) {
+    cache_bridge_key_binding_t *binding;
+    uint32_t hash;
+    size_t index;
+    int found = 0;
+    const char *key_copy;
 
-    if (cache_bridge_extract_string(params_json, "namespace", cache_namespace, sizeof(cache_namespace)) != 0 ||
-        cache_bridge_extract_size(params_json, "capacityPages", &capacity_pages) != 0 ||
-        cache_bridge_extract_size(params_json, "pageSize", &page_size) != 0) {
-        return cache_bridge_error_response("invalid_create_request");
+    if (!shard || !shard->bindings || !key) {
+        return NULL;
     }
 
-    if (cache_bridge_validate_config(capacity_pages, page_size) != 0) {
-        return cache_bridge_error_response("invalid_cache_config");
+    hash = cache_bridge_hash_key(key);
+    index = cache_bridge_index_probe(shard, key, hash, &found);
+    if (found) {
+        return &shard->bindings[shard->key_index[index] - 1];
     }
 
-    slot = cache_bridge_alloc_slot();
-    if (!slot) {
-        return cache_bridge_error_response("cache_registry_full");
+    if (shard->free_head == 0) {
+        return NULL;
     }
 
-    snprintf(slot->handle, sizeof(slot->handle), "cache-%u", g_next_handle_id++);
-    snprintf(slot->cache_namespace, sizeof(slot->cache_namespace), "%s", cache_namespace);
-
-    if (cache_bridge_init_bindings(slot, capacity_pages) != 0) {
-        memset(slot, 0, sizeof(*slot));
-        return cache_bridge_error_response("cache_init_failed");
+    key_copy = cache_intern_acquire(key, strlen(key), hash);
+    if (!key_copy) {
+        return NULL;
     }
 
-    if (cache_service_init(&slot->service, capacity_pages, page_size) != 0) {
-        cache_bridge_release_bindings(slot);
-        memset(slot, 0, sizeof(*slot));
-        return cache_bridge_error_response("cache_init_failed");
-    }
+    binding = &shard->bindings[shard->free_head - 1];
+    shard->free_head = binding->next_free;
+    binding->in_use = 1;
+    binding->key = key_copy;
+    binding->hash = hash;
+    binding->next_free = 0;
+    shard->binding_count += 1;
 
-    snprintf(response, sizeof(response),
-             "{\"ok\":true,\"handle\":\"%s\"}",
-             slot->handle);
-    return response;
+    if (shard->key_index[index] == CACHE_BRIDGE_INDEX_TOMBSTONE) {
+        shard->index_tombstones -= 1;
+    }
+    shard->key_index[index] = binding->page_id;
+    return binding;
 }
 
-static const char *cache_bridge_handle_destroy(const char *params_json) {
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
-    cache_bridge_slot_t *slot;
+/*
+ * Value operations on a resolved slot; the string and id entry points and
+ * the invoke handlers all land here. A NULL slot fails like an unknown handle.
+ */
+static int cache_bridge_slot_get_value(cache_bridge_slot_t *slot,
+                                       const char *key,
+                                       uint8_t *out_buffer,
+                                       size_t *inout_len) {
+    cache_bridge_shard_t *shard = cache_bridge_shard_for_key(slot, key);
+    cache_bridge_key_binding_t *binding;
+    int rc = -1;
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0) {
-        return cache_bridge_error_response("invalid_handle");
+    if (!shard) {
+        return -1;
     }
 
-    slot = cache_bridge_find_slot(handle);
-    if (!slot) {
-        return cache_bridge_error_response("cache_not_found");
+    cache_lock_acquire(&shard->lock);
+    binding = cache_bridge_find_binding(shard, key);
+    if (binding) {
+        rc = cache_service_get(&shard->service, binding->page_id, out_buffer, inout_len);
+        if (rc != 0) {
+            cache_bridge_unbind_key(shard, binding);
+        }
     }
+    cache_lock_release(&shard->lock);
 
-    cache_bridge_reset_slot(slot);
-    return cache_bridge_ok_response();
+    return rc;
 }
 
-static const char *cache_bridge_handle_get(const char *params_json) {
-    static char response[CACHE_BRIDGE_MAX_RESPONSE_LEN];
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
-    char key[CACHE_BRIDGE_MAX_KEY_LEN];
-    char escaped[CACHE_BRIDGE_MAX_RESPONSE_LEN / 2];
-    cache_bridge_slot_t *slot;
-    uint8_t value[CACHE_BRIDGE_MAX_VALUE_LEN];
-    size_t value_len = sizeof(value) - 1;
+static int cache_bridge_slot_get_value_ptr(cache_bridge_slot_t *slot,
+                                           const char *key,
+                                           const uint8_t **out_data,
+                                           size_t *out_len) {
+#if defined(CACHE_THREAD_SAFE)
+    /* The page may be evicted by another thread once the lock drops, so hand out a copy in the thread's arena */
+    uint8_t *value_copy = cache_bridge_scratch(CACHE_BRIDGE_MAX_VALUE_LEN);
+    size_t value_len = CACHE_BRIDGE_MAX_VALUE_LEN;
+
+    if (!value_copy || !out_data || !out_len ||
+        cache_bridge_slot_get_value(slot, key, value_copy, &value_len) != 0) {
+        return -1;
+    }
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0 ||
-        cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0) {
-        return cache_bridge_error_response("invalid_get_request");
+    *out_data = value_copy;
+    *out_len = value_len;
+    return 0;
+#else
+    cache_bridge_shard_t *shard = cache_bridge_shard_for_key(slot, key);
+    cache_bridge_key_binding_t *binding;
+
+    if (!shard) {
+        return -1;
     }
 
-    slot = cache_bridge_find_slot(handle);
-    if (!slot) {
-        return cache_bridge_error_response("cache_not_found");
+    binding = cache_bridge_find_binding(shard, key);
+    if (!binding) {
+        return -1;
     }
 
-    if (cache_bridge_get_value(handle, key, value, &value_len) != 0) {
-        return "{\"ok\":true,\"hit\":false}";
+    if (cache_service_get_ptr(&shard->service, binding->page_id, out_data, out_len) != 0) {
+        cache_bridge_unbind_key(shard, binding);
+        return -1;
     }
 
-    value[value_len] = '\0';
-    cache_bridge_escape_json_string((const char *)value, escaped, sizeof(escaped));
-    snprintf(response, sizeof(response),
+    return 0;
+#endif
+}
+
+static int cache_bridge_slot_set_value(cache_bridge_slot_t *slot,
+                                       const char *key,
+                                       const uint8_t *data,
+                                       size_t data_len,
+                                       uint32_t cost) {
+    cache_bridge_shard_t *shard = cache_bridge_shard_for_key(slot, key);
+    cache_bridge_key_binding_t *binding;
+    int created = 0;
+    int rc = -1;
+
+    if (!shard) {
+        return -1;
+    }
+
+    cache_lock_acquire(&shard->lock);
+    binding = cache_bridge_find_binding(shard, key);
+    if (!binding) {
+        binding = cache_bridge_bind_key(shard, key);
+        created = 1;
+    }
+
+    if (binding) {
+        rc = cache_service_set_cost(&shard->service, binding->page_id, data, data_len, cost);
+        if (rc != 0 && created) {
+            cache_bridge_unbind_key(shard, binding);
+        }
+    }
+    cache_lock_release(&shard->lock);
+
+    /* A set that committed a new segment may have pushed usage over the budget */
+    cache_budget_poll();
+    return rc;
+}
+
+static int cache_bridge_slot_has_value(cache_bridge_slot_t *slot, const char *key) {
+    cache_bridge_shard_t *shard = cache_bridge_shard_for_key(slot, key);
+    cache_bridge_key_binding_t *binding;
+    int has_value = 0;
+
+    if (!shard) {
+        return 0;
+    }
+
+    cache_lock_acquire(&shard->lock);
+    binding = cache_bridge_find_binding(shard, key);
+    if (binding) {
+        has_value = cache_service_has(&shard->service, binding->page_id);
+    }
+    cache_lock_release(&shard->lock);
+
+    return has_value;
+}
+
+static int cache_bridge_slot_pin_value(cache_bridge_slot_t *slot, const char *key) {
+    cache_bridge_shard_t *shard = cache_bridge_shard_for_key(slot, key);
+    cache_bridge_key_binding_t *binding;
+    int rc = -1;
+
+    if (!shard) {
+        return -1;
+    }
+
+    cache_lock_acquire(&shard->lock);
+    binding = cache_bridge_find_binding(shard, key);
+    if (binding) {
+        rc = cache_service_pin(&shard->service, binding->page_id);
+        if (rc != 0 && !page_cache_has(&shard->service.cache, binding->page_id)) {
+            cache_bridge_unbind_key(shard, binding);
+        }
+    }
+    cache_lock_release(&shard->lock);
+
+    return rc;
+}
+
+static int cache_bridge_slot_acquire_value(cache_bridge_slot_t *slot,
+                                           const char *key,
+                                           const uint8_t **out_data,
+                                           size_t *out_len) {
+    cache_bridge_shard_t *shard = cache_bridge_shard_for_key(slot, key);
+    cache_bridge_key_binding_t *binding;
+    int rc = -1;
+
+    if (!shard) {
+        return -1;
+    }
+
+    cache_lock_acquire(&shard->lock);
+    binding = cache_bridge_find_binding(shard, key);
+    if (binding) {
+        rc = cache_service_acquire(&shard->service, binding->page_id, out_data, out_len);
+    }
+    cache_lock_release(&shard->lock);
+
+    return rc;
+}
+
+static int cache_bridge_slot_release_value(cache_bridge_slot_t *slot, const char *key) {
+    cache_bridge_shard_t *shard = cache_bridge_shard_for_key(slot, key);
+    cache_bridge_key_binding_t *binding;
+    int rc = -1;
+
+    if (!shard) {
+        return -1;
+    }
+
+    cache_lock_acquire(&shard->lock);
+    binding = cache_bridge_find_binding(shard, key);
+    if (binding) {
+        rc = cache_service_release(&shard->service, binding->page_id);
+        if (rc != 0 && !page_cache_has(&shard->service.cache, binding->page_id)) {
+            cache_bridge_unbind_key(shard, binding);
+        }
+    }
+    cache_lock_release(&shard->lock);
+
+    return rc;
+}
+
+static int cache_bridge_slot_clear(cache_bridge_slot_t *slot) {
+    int rc = 0;
+    size_t i;
+
+    if (!slot) {
+        return -1;
+    }
+
+    for (i = 0; i < slot->shard_count; ++i) {
+        cache_bridge_shard_t *shard = &slot->shards[i];
+
+        cache_lock_acquire(&shard->lock);
+        if (cache_service_clear(&shard->service) != 0) {
+            rc = -1;
+        } else {
+            cache_bridge_release_bindings(shard);
+            if (cache_bridge_init_bindings(shard, shard->service.cache.entry_capacity) != 0) {
+                rc = -1;
+            }
+        }
+        cache_lock_release(&shard->lock);
+    }
+
+    return rc;
+}
+
+/*
+ * Keeps bindings at twice the shard's entries after a grow; new bindings go
+ * to the front of the free list and the key index is rebuilt at its new size.
+ * A shrink keeps the larger table. Caller holds the shard lock.
+ */
+static int cache_bridge_grow_bindings(cache_bridge_shard_t *shard, size_t entry_capacity) {
+    cache_bridge_key_binding_t *bindings;
+    uint32_t *key_index;
+    size_t binding_capacity = entry_capacity * 2;
+    size_t index_capacity = shard->index_capacity;
+    size_t i;
+
+    if (binding_capacity <= shard->binding_capacity) {
+        return 0;
+    }
+
+    while (index_capacity < binding_capacity * 2) {
+        index_capacity <<= 1;
+    }
+
+    bindings = (cache_bridge_key_binding_t *)realloc(shard->bindings,
+                                                     binding_capacity * sizeof(cache_bridge_key_binding_t));
+    if (!bindings) {
+        return -1;
+    }
+    shard->bindings = bindings;
+
+    key_index = (uint32_t *)malloc(index_capacity * sizeof(uint32_t));
+    if (!key_index) {
+        return -1;
+    }
+
+    for (i = shard->binding_capacity; i < binding_capacity; ++i) {
+        memset(&bindings[i], 0, sizeof(bindings[i]));
+        bindings[i].page_id = (uint32_t)(i + 1);
+        bindings[i].next_free = i + 1 < binding_capacity ? (uint32_t)(i + 2) : shard->free_head;
+    }
+    shard->free_head = (uint32_t)(shard->binding_capacity + 1);
+    shard->binding_capacity = binding_capacity;
+
+    free(shard->key_index);
+    shard->key_index = key_index;
+    shard->index_capacity = index_capacity;
+    cache_bridge_index_rebuild(shard);
+    return 0;
+}
+
+/*
+ * Resizes every shard in place; the keys that survive keep their values.
+ * A failure part way through leaves earlier shards at the new size.
+ */
+static int cache_bridge_slot_resize(cache_bridge_slot_t *slot, size_t capacity_pages) {
+    size_t shard_pages;
+    int rc = 0;
+    size_t i;
+
+    if (!slot || cache_bridge_validate_config(capacity_pages, slot->shards[0].service.page_size) != 0 ||
+        capacity_pages < slot->shard_count) {
+        return -1;
+    }
+
+    shard_pages = (capacity_pages + slot->shard_count - 1) / slot->shard_count;
+    for (i = 0; i < slot->shard_count && rc == 0; ++i) {
+        cache_bridge_shard_t *shard = &slot->shards[i];
+
+        cache_lock_acquire(&shard->lock);
+        if (cache_service_resize(&shard->service, shard_pages) != 0 ||
+            cache_bridge_grow_bindings(shard, shard->service.cache.entry_capacity) != 0) {
+            rc = -1;
+        }
+        cache_lock_release(&shard->lock);
+    }
+
+    /* A grow commits storage up front */
+    cache_budget_poll();
+    return rc;
+}
+
+/* Shards are always bumped together, so they share one generation. */
+static int cache_bridge_invalidate_slot(cache_bridge_slot_t *slot, uint32_t *out_generation) {
+    int rc = 0;
+    size_t i;
+
+    if (!slot) {
+        return -1;
+    }
+
+    for (i = 0; i < slot->shard_count; ++i) {
+        cache_lock_acquire(&slot->shards[i].lock);
+        if (cache_service_invalidate(&slot->shards[i].service, out_generation) != 0) {
+            rc = -1;
+        }
+        cache_lock_release(&slot->shards[i].lock);
+    }
+
+    return rc;
+}
+
+static int cache_bridge_destroy_slot(cache_bridge_slot_t *slot) {
+    size_t i;
+    int any_in_use = 0;
+
+    if (!slot) {
+        return -1;
+    }
+
+    cache_lock_acquire(&g_registry_lock);
+    cache_bridge_reset_slot(slot);
+    for (i = 0; i < CACHE_BRIDGE_MAX_CACHES; ++i) {
+        any_in_use |= g_cache_slots[i].in_use;
+    }
+    /* Last cache gone: hand the pool's chunks back rather than hold them for a later create */
+    if (!any_in_use) {
+        cache_intern_trim();
+    }
+    cache_lock_release(&g_registry_lock);
+    return 0;
+}
+
+/* Sums the shards' counters and histograms; probe_max is the worst shard's. */
+static int cache_bridge_slot_get_stats(cache_bridge_slot_t *slot, cache_service_stats_t *out_stats) {
+    size_t i;
+    size_t c;
+
+    if (!slot || !out_stats) {
+        return -1;
+    }
+
+    memset(out_stats, 0, sizeof(*out_stats));
+    for (i = 0; i < slot->shard_count; ++i) {
+        cache_service_stats_t shard_stats;
+        int rc;
+
+        cache_lock_acquire(&slot->shards[i].lock);
+        rc = cache_service_stats(&slot->shards[i].service, &shard_stats);
+        cache_lock_release(&slot->shards[i].lock);
+        if (rc != 0) {
+            return -1;
+        }
+
+        out_stats->hits += shard_stats.hits;
+        out_stats->misses += shard_stats.misses;
+        out_stats->evictions += shard_stats.evictions;
+        out_stats->entries += shard_stats.entries;
+        out_stats->reserved_bytes += shard_stats.reserved_bytes;
+        out_stats->metadata_bytes += shard_stats.metadata_bytes;
+        out_stats->hash_index_bytes += shard_stats.hash_index_bytes;
+        out_stats->payload_capacity_bytes += shard_stats.payload_capacity_bytes;
+        out_stats->payload_committed_bytes += shard_stats.payload_committed_bytes;
+        out_stats->entry_capacity += shard_stats.entry_capacity;
+        out_stats->stored_bytes += shard_stats.stored_bytes;
+        out_stats->fragmentation_bytes += shard_stats.fragmentation_bytes;
+        out_stats->hash_capacity += shard_stats.hash_capacity;
+        out_stats->hash_count += shard_stats.hash_count;
+        out_stats->probe_count += shard_stats.probe_count;
+        out_stats->probe_steps += shard_stats.probe_steps;
+        if (shard_stats.probe_max > out_stats->probe_max) {
+            out_stats->probe_max = shard_stats.probe_max;
+        }
+        out_stats->prefetch_pending += shard_stats.prefetch_pending;
+        out_stats->prefetch_loaded += shard_stats.prefetch_loaded;
+        out_stats->compressed_writes += shard_stats.compressed_writes;
+        out_stats->compression_saved_bytes += shard_stats.compression_saved_bytes;
+        if (shard_stats.generation > out_stats->generation) {
+            out_stats->generation = shard_stats.generation;
+        }
+        out_stats->invalidations += shard_stats.invalidations;
+        out_stats->policy = shard_stats.policy;
+        for (c = 0; c < PAGE_CACHE_PROBE_BUCKETS; ++c) {
+            out_stats->probe_histogram[c] += shard_stats.probe_histogram[c];
+        }
+        for (c = 0; c < CACHE_OP_COUNT; ++c) {
+            cache_latency_merge(&out_stats->latency[c], &shard_stats.latency[c]);
+        }
+        for (c = 0; c < PAGE_CACHE_POLICY_COUNT; ++c) {
+            out_stats->policies[c].hits += shard_stats.policies[c].hits;
+            out_stats->policies[c].misses += shard_stats.policies[c].misses;
+            out_stats->policies[c].evictions += shard_stats.policies[c].evictions;
+            out_stats->policies[c].evicted_cost += shard_stats.policies[c].evicted_cost;
+        }
+
+        /* Every shard shares the page size, and with it the class layout */
+        out_stats->class_count = shard_stats.class_count;
+        for (c = 0; c < shard_stats.class_count; ++c) {
+            out_stats->classes[c].chunk_size = shard_stats.classes[c].chunk_size;
+            out_stats->classes[c].capacity += shard_stats.classes[c].capacity;
+            out_stats->classes[c].entries += shard_stats.classes[c].entries;
+            out_stats->classes[c].stored_bytes += shard_stats.classes[c].stored_bytes;
+            out_stats->classes[c].evictions += shard_stats.classes[c].evictions;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Resolves "handle", which may be the string from cache.create or its
+ * integer id. Returns -1 when the field is missing or malformed; *out_slot
+ * is NULL when it is well formed but names no live cache.
+ */
+static int cache_bridge_extract_slot(const char *json, cache_bridge_slot_t **out_slot) {
+    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
+    const char *cursor = cache_bridge_find_value(json, "handle");
+    unsigned long long id;
+
+    *out_slot = NULL;
+    if (cursor && isdigit((unsigned char)*cursor)) {
+        id = strtoull(cursor, NULL, 10);
+        if (id > UINT32_MAX) {
+            return -1;
+        }
+        *out_slot = cache_bridge_find_slot_by_id((cache_bridge_id_t)id);
+        return 0;
+    }
+
+    if (cache_bridge_parse_string(cursor, handle, sizeof(handle), NULL) != 0) {
+        return -1;
+    }
+
+    *out_slot = cache_bridge_find_slot(handle);
+    return 0;
+}
+
+static const char *cache_bridge_handle_create(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    cache_bridge_slot_t *slot;
+    char cache_namespace[CACHE_BRIDGE_MAX_NAMESPACE_LEN];
+    size_t capacity_pages = 0;
+    size_t page_size = 0;
+    size_t shard_count = 1;
+    size_t compress_threshold = 0;
+    unsigned int init_flags;
+    char policy[16];
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_string(params_json, "namespace", cache_namespace, sizeof(cache_namespace)) != 0 ||
+        cache_bridge_extract_size(params_json, "capacityPages", &capacity_pages) != 0 ||
+        cache_bridge_extract_size(params_json, "pageSize", &page_size) != 0) {
+        return cache_bridge_error_response("invalid_create_request");
+    }
+
+    /* Optional; absent means a single shard */
+    if (strstr(params_json, "\"shards\"") &&
+        cache_bridge_extract_size(params_json, "shards", &shard_count) != 0) {
+        return cache_bridge_error_response("invalid_create_request");
+    }
+
+    if (cache_bridge_validate_config(capacity_pages, page_size) != 0 ||
+        shard_count == 0 || shard_count > CACHE_BRIDGE_MAX_SHARDS || shard_count > capacity_pages) {
+        return cache_bridge_error_response("invalid_cache_config");
+    }
+
+    /* Optional "lazy":true commits payload as the cache fills */
+    init_flags = cache_bridge_extract_flag(params_json, "lazy") ? PAGE_CACHE_INIT_LAZY : 0;
+
+    slot = cache_bridge_create_slot(cache_namespace, capacity_pages, page_size, shard_count, init_flags);
+    if (!slot) {
+        return cache_bridge_error_response("cache_init_failed");
+    }
+
+    /* Optional; absent means values are stored uncompressed */
+    if (cache_bridge_extract_size(params_json, "compressThreshold", &compress_threshold) == 0) {
+        cache_bridge_set_compression(slot->handle, compress_threshold);
+    }
+
+    if (cache_bridge_extract_string(params_json, "policy", policy, sizeof(policy)) == 0 &&
+        strcmp(policy, "cost") == 0) {
+        cache_bridge_set_policy(slot->handle, PAGE_CACHE_POLICY_COST_CLOCK);
+    }
+
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN,
+             "{\"ok\":true,\"handle\":\"%s\",\"id\":%lu}",
+             slot->handle,
+             (unsigned long)slot->id);
+    return response;
+}
+
+static const char *cache_bridge_handle_destroy(const char *params_json) {
+    cache_bridge_slot_t *slot;
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0) {
+        return cache_bridge_error_response("invalid_handle");
+    }
+
+    if (cache_bridge_destroy_slot(slot) != 0) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    return cache_bridge_ok_response();
+}
+
+static const char *cache_bridge_handle_get(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    char key[CACHE_BRIDGE_MAX_KEY_LEN];
+    char escaped[CACHE_BRIDGE_MAX_RESPONSE_LEN / 2];
+    cache_bridge_slot_t *slot;
+    uint8_t value[CACHE_BRIDGE_MAX_VALUE_LEN];
+    size_t value_len = sizeof(value) - 1;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0 ||
+        cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0) {
+        return cache_bridge_error_response("invalid_get_request");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    if (cache_bridge_slot_get_value(slot, key, value, &value_len) != 0) {
+        return "{\"ok\":true,\"hit\":false}";
+    }
+
+    value[value_len] = '\0';
+    cache_bridge_escape_json_string((const char *)value, escaped, sizeof(escaped));
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN,
              "{\"ok\":true,\"hit\":true,\"serializedValue\":\"%s\"}",
              escaped);
     return response;
 }
 
 static const char *cache_bridge_handle_set(const char *params_json) {
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
     char key[CACHE_BRIDGE_MAX_KEY_LEN];
     char serialized_value[CACHE_BRIDGE_MAX_VALUE_LEN];
     cache_bridge_slot_t *slot;
+    size_t cost = 0;
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0 ||
+    if (cache_bridge_extract_slot(params_json, &slot) != 0 ||
         cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0 ||
         cache_bridge_extract_string(params_json, "serializedValue", serialized_value, sizeof(serialized_value)) != 0) {
         return cache_bridge_error_response("invalid_set_request");
     }
 
-    slot = cache_bridge_find_slot(handle);
     if (!slot) {
         return cache_bridge_error_response("cache_not_found");
     }
 
-    if (cache_bridge_set_value(handle,
-                               key,
-                               (const uint8_t *)serialized_value,
-                               strlen(serialized_value)) != 0) {
+    /* Optional recompute-cost hint for the cost-aware policy */
+    if (cache_bridge_extract_size(params_json, "cost", &cost) != 0 || cost > UINT32_MAX) {
+        cost = 0;
+    }
+
+    if (cache_bridge_slot_set_value(slot,
+                                    key,
+                                    (const uint8_t *)serialized_value,
+                                    strlen(serialized_value),
+                                    (uint32_t)cost) != 0) {
         return cache_bridge_error_response("cache_set_failed");
     }
 
     return cache_bridge_ok_response();
 }
 
+/*
+ * {"handle","keys":[...]} -> {"ok":true,"values":[...]} in key order, null
+ * for misses. Values that no longer fit come back null with "truncated":true.
+ */
+static const char *cache_bridge_handle_get_many(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN);
+    cache_bridge_slot_t *slot;
+    char key[CACHE_BRIDGE_MAX_KEY_LEN];
+    char escaped[CACHE_BRIDGE_MAX_RESPONSE_LEN / 2];
+    uint8_t value[CACHE_BRIDGE_MAX_VALUE_LEN];
+    const char *cursor;
+    size_t used;
+    size_t count = 0;
+    int truncated = 0;
+    int more;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0) {
+        return cache_bridge_error_response("invalid_get_many_request");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    cursor = cache_bridge_find_value(params_json, "keys");
+    more = cache_bridge_array_open(&cursor);
+    used = (size_t)snprintf(response, CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN, "{\"ok\":true,\"values\":[");
+
+    while (more > 0) {
+        size_t value_len = sizeof(value) - 1;
+        size_t escaped_len;
+        int emitted;
+
+        if (count == CACHE_BRIDGE_MAX_BATCH_KEYS) {
+            return cache_bridge_error_response("batch_too_large");
+        }
+
+        if (cache_bridge_parse_string(cursor, key, sizeof(key), &cursor) != 0) {
+            more = -1;
+            break;
+        }
+
+        if (count > 0) {
+            response[used++] = ',';
+        }
+
+        emitted = 0;
+        if (!truncated && cache_bridge_slot_get_value(slot, key, value, &value_len) == 0) {
+            value[value_len] = '\0';
+            cache_bridge_escape_json_string((const char *)value, escaped, sizeof(escaped));
+            escaped_len = strlen(escaped);
+            if (used + escaped_len + 2 + CACHE_BRIDGE_BATCH_RESERVE <= CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN) {
+                used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN - used,
+                                         "\"%s\"", escaped);
+                emitted = 1;
+            } else {
+                truncated = 1;
+            }
+        }
+
+        if (!emitted) {
+            memcpy(response + used, "null", 4);
+            used += 4;
+        }
+
+        count += 1;
+        more = cache_bridge_array_next(&cursor);
+    }
+
+    if (more < 0) {
+        return cache_bridge_error_response("invalid_get_many_request");
+    }
+
+    snprintf(response + used, CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN - used,
+             "]%s}", truncated ? ",\"truncated\":true" : "");
+    return response;
+}
+
+/*
+ * {"handle","keys":[...],"serializedValues":[...],"costs":[...]?} stores the
+ * pairs in order -> {"ok":true,"stored":n}. A value that cannot be stored is
+ * skipped, as a single cache.set would fail.
+ */
+static const char *cache_bridge_handle_set_many(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN);
+    cache_bridge_slot_t *slot;
+    char key[CACHE_BRIDGE_MAX_KEY_LEN];
+    char serialized_value[CACHE_BRIDGE_MAX_VALUE_LEN];
+    const char *key_cursor;
+    const char *value_cursor;
+    const char *cost_cursor;
+    size_t stored = 0;
+    size_t count = 0;
+    int more;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0) {
+        return cache_bridge_error_response("invalid_set_many_request");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    key_cursor = cache_bridge_find_value(params_json, "keys");
+    value_cursor = cache_bridge_find_value(params_json, "serializedValues");
+    cost_cursor = cache_bridge_find_value(params_json, "costs");
+
+    more = cache_bridge_array_open(&key_cursor);
+    if (more < 0 || cache_bridge_array_open(&value_cursor) != more) {
+        return cache_bridge_error_response("invalid_set_many_request");
+    }
+    /* Optional; an absent or malformed costs array means cost 0 throughout */
+    if (cost_cursor && cache_bridge_array_open(&cost_cursor) != more) {
+        cost_cursor = NULL;
+    }
+
+    while (more > 0) {
+        unsigned long long cost = 0;
+
+        if (count == CACHE_BRIDGE_MAX_BATCH_KEYS) {
+            return cache_bridge_error_response("batch_too_large");
+        }
+
+        if (cache_bridge_parse_string(key_cursor, key, sizeof(key), &key_cursor) != 0 ||
+            cache_bridge_parse_string(value_cursor, serialized_value, sizeof(serialized_value), &value_cursor) != 0) {
+            return cache_bridge_error_response("invalid_set_many_request");
+        }
+
+        if (cost_cursor) {
+            char *end_ptr;
+
+            cost = strtoull(cost_cursor, &end_ptr, 10);
+            if (end_ptr == cost_cursor || cost > UINT32_MAX) {
+                cost = 0;
+            }
+            cost_cursor = end_ptr;
+        }
+
+        if (cache_bridge_slot_set_value(slot,
+                                        key,
+                                        (const uint8_t *)serialized_value,
+                                        strlen(serialized_value),
+                                        (uint32_t)cost) == 0) {
+            stored += 1;
+        }
+
+        count += 1;
+        more = cache_bridge_array_next(&key_cursor);
+        if (cache_bridge_array_next(&value_cursor) != more) {
+            return cache_bridge_error_response("invalid_set_many_request");
+        }
+        if (cost_cursor && cache_bridge_array_next(&cost_cursor) != more) {
+            cost_cursor = NULL;
+        }
+    }
+
+    if (more < 0) {
+        return cache_bridge_error_response("invalid_set_many_request");
+    }
+
+    snprintf(response, CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN,
+             "{\"ok\":true,\"stored\":%zu}",
+             stored);
+    return response;
+}
+
+/* {"handle","keys":[...]} -> {"ok":true,"has":[...]} in key order. */
+static const char *cache_bridge_handle_has_many(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN);
+    cache_bridge_slot_t *slot;
+    char key[CACHE_BRIDGE_MAX_KEY_LEN];
+    const char *cursor;
+    size_t used;
+    size_t count = 0;
+    int more;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0) {
+        return cache_bridge_error_response("invalid_has_many_request");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    cursor = cache_bridge_find_value(params_json, "keys");
+    more = cache_bridge_array_open(&cursor);
+    used = (size_t)snprintf(response, CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN, "{\"ok\":true,\"has\":[");
+
+    while (more > 0) {
+        if (count == CACHE_BRIDGE_MAX_BATCH_KEYS) {
+            return cache_bridge_error_response("batch_too_large");
+        }
+
+        if (cache_bridge_parse_string(cursor, key, sizeof(key), &cursor) != 0) {
+            more = -1;
+            break;
+        }
+
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN - used,
+                                 "%s%s",
+                                 count > 0 ? "," : "",
+                                 cache_bridge_slot_has_value(slot, key) ? "true" : "false");
+        count += 1;
+        more = cache_bridge_array_next(&cursor);
+    }
+
+    if (more < 0) {
+        return cache_bridge_error_response("invalid_has_many_request");
+    }
+
+    snprintf(response + used, CACHE_BRIDGE_MAX_BATCH_RESPONSE_LEN - used, "]}");
+    return response;
+}
+
 static const char *cache_bridge_handle_has(const char *params_json) {
-    static char response[CACHE_BRIDGE_MAX_RESPONSE_LEN];
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
     char key[CACHE_BRIDGE_MAX_KEY_LEN];
     cache_bridge_slot_t *slot;
     int has_value;
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0 ||
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0 ||
         cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0) {
         return cache_bridge_error_response("invalid_has_request");
     }
 
-    slot = cache_bridge_find_slot(handle);
     if (!slot) {
         return cache_bridge_error_response("cache_not_found");
     }
 
-    has_value = cache_bridge_has_value(handle, key);
-    snprintf(response, sizeof(response),
+    has_value = cache_bridge_slot_has_value(slot, key);
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN,
              "{\"ok\":true,\"has\":%s}",
              has_value ? "true" : "false");
     return response;
 }
 
 static const char *cache_bridge_handle_clear(const char *params_json) {
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
     cache_bridge_slot_t *slot;
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0) {
-        return cache_bridge_error_response("invalid_handle");
+    if (cache_bridge_extract_slot(params_json, &slot) != 0) {
+        return cache_bridge_error_response("invalid_handle");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    if (cache_bridge_slot_clear(slot) != 0) {
+        return cache_bridge_error_response("cache_clear_failed");
+    }
+
+    return cache_bridge_ok_response();
+}
+
+static const char *cache_bridge_handle_resize(const char *params_json) {
+    cache_bridge_slot_t *slot;
+    size_t capacity_pages = 0;
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0) {
+        return cache_bridge_error_response("invalid_handle");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    if (cache_bridge_extract_size(params_json, "capacityPages", &capacity_pages) != 0) {
+        return cache_bridge_error_response("invalid_argument");
+    }
+
+    if (cache_bridge_slot_resize(slot, capacity_pages) != 0) {
+        return cache_bridge_error_response("cache_resize_failed");
+    }
+
+    return cache_bridge_ok_response();
+}
+
+/* {"handle"} bumps one cache; {"namespace"} bumps every cache created under that name. */
+static const char *cache_bridge_handle_invalidate(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    char cache_namespace[CACHE_BRIDGE_MAX_NAMESPACE_LEN];
+    cache_bridge_slot_t *slot;
+    uint32_t generation = 0;
+    int invalidated;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_slot(params_json, &slot) == 0) {
+        if (!slot) {
+            return cache_bridge_error_response("cache_not_found");
+        }
+
+        if (cache_bridge_invalidate_slot(slot, &generation) != 0) {
+            return cache_bridge_error_response("cache_invalidate_failed");
+        }
+
+        snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN,
+                 "{\"ok\":true,\"generation\":%lu}",
+                 (unsigned long)generation);
+        return response;
+    }
+
+    if (cache_bridge_extract_string(params_json, "namespace", cache_namespace, sizeof(cache_namespace)) != 0) {
+        return cache_bridge_error_response("invalid_invalidate_request");
+    }
+
+    invalidated = cache_bridge_invalidate_namespace(cache_namespace);
+    if (invalidated < 0) {
+        return cache_bridge_error_response("cache_invalidate_failed");
+    }
+
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN,
+             "{\"ok\":true,\"invalidated\":%d}",
+             invalidated);
+    return response;
+}
+
+static const char *cache_bridge_handle_pin(const char *params_json) {
+    char key[CACHE_BRIDGE_MAX_KEY_LEN];
+    cache_bridge_slot_t *slot;
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0 ||
+        cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0) {
+        return cache_bridge_error_response("invalid_pin_request");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    if (cache_bridge_slot_pin_value(slot, key) != 0) {
+        return cache_bridge_error_response("cache_pin_failed");
+    }
+
+    return cache_bridge_ok_response();
+}
+
+static const char *cache_bridge_handle_release(const char *params_json) {
+    char key[CACHE_BRIDGE_MAX_KEY_LEN];
+    cache_bridge_slot_t *slot;
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0 ||
+        cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0) {
+        return cache_bridge_error_response("invalid_release_request");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    if (cache_bridge_slot_release_value(slot, key) != 0) {
+        return cache_bridge_error_response("cache_release_failed");
+    }
+
+    return cache_bridge_ok_response();
+}
+
+static const char *cache_bridge_handle_stats(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    cache_bridge_slot_t *slot;
+    cache_service_stats_t stats;
+    cache_bridge_crossings_t crossings;
+    size_t used;
+    size_t i;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_slot(params_json, &slot) != 0) {
+        return cache_bridge_error_response("invalid_handle");
+    }
+
+    if (!slot) {
+        return cache_bridge_error_response("cache_not_found");
+    }
+
+    if (cache_bridge_slot_get_stats(slot, &stats) != 0) {
+        return cache_bridge_error_response("cache_stats_failed");
+    }
+
+    used = (size_t)snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN,
+             "{\"ok\":true,\"entries\":%zu,\"implementation\":\"native_page_cache\","
+             "\"shards\":%zu,"
+             "\"hits\":%llu,\"misses\":%llu,\"evictions\":%llu,"
+             "\"reservedBytes\":%zu,\"metadataBytes\":%zu,"
+             "\"hashIndexBytes\":%zu,\"payloadCapacityBytes\":%zu,\"payloadCommittedBytes\":%zu,"
+             "\"capacityEntries\":%zu,\"storedBytes\":%zu,\"fragmentationBytes\":%zu,"
+             "\"hashCapacity\":%zu,\"hashCount\":%zu,"
+             "\"probeCount\":%llu,\"probeSteps\":%llu,\"probeMax\":%zu,"
+             "\"prefetchPending\":%zu,\"prefetchLoaded\":%llu,"
+             "\"compressedWrites\":%llu,\"compressionSavedBytes\":%llu,"
+             "\"generation\":%lu,\"invalidations\":%llu,"
+             "\"policy\":\"%s\",\"policies\":{",
+             stats.entries,
+             slot->shard_count,
+             (unsigned long long)stats.hits,
+             (unsigned long long)stats.misses,
+             (unsigned long long)stats.evictions,
+             stats.reserved_bytes,
+             stats.metadata_bytes,
+             stats.hash_index_bytes,
+             stats.payload_capacity_bytes,
+             stats.payload_committed_bytes,
+             stats.entry_capacity,
+             stats.stored_bytes,
+             stats.fragmentation_bytes,
+             stats.hash_capacity,
+             stats.hash_count,
+             (unsigned long long)stats.probe_count,
+             (unsigned long long)stats.probe_steps,
+             stats.probe_max,
+             stats.prefetch_pending,
+             (unsigned long long)stats.prefetch_loaded,
+             (unsigned long long)stats.compressed_writes,
+             (unsigned long long)stats.compression_saved_bytes,
+             (unsigned long)stats.generation,
+             (unsigned long long)stats.invalidations,
+             cache_bridge_policy_names[stats.policy]);
+
+    for (i = 0; i < PAGE_CACHE_POLICY_COUNT && used < CACHE_BRIDGE_MAX_RESPONSE_LEN; ++i) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used,
+                                 "%s\"%s\":{\"hits\":%llu,\"misses\":%llu,"
+                                 "\"evictions\":%llu,\"evictedCost\":%llu}",
+                                 i > 0 ? "," : "",
+                                 cache_bridge_policy_names[i],
+                                 (unsigned long long)stats.policies[i].hits,
+                                 (unsigned long long)stats.policies[i].misses,
+                                 (unsigned long long)stats.policies[i].evictions,
+                                 (unsigned long long)stats.policies[i].evicted_cost);
+    }
+
+    if (used < CACHE_BRIDGE_MAX_RESPONSE_LEN) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used, "},\"classes\":[");
+    }
+
+    for (i = 0; i < stats.class_count && used < CACHE_BRIDGE_MAX_RESPONSE_LEN; ++i) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used,
+                                 "%s{\"chunkSize\":%zu,\"capacity\":%zu,\"entries\":%zu,"
+                                 "\"storedBytes\":%zu,\"evictions\":%llu}",
+                                 i > 0 ? "," : "",
+                                 stats.classes[i].chunk_size,
+                                 stats.classes[i].capacity,
+                                 stats.classes[i].entries,
+                                 stats.classes[i].stored_bytes,
+                                 (unsigned long long)stats.classes[i].evictions);
+    }
+
+    if (used < CACHE_BRIDGE_MAX_RESPONSE_LEN) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used, "],\"probeHistogram\":[");
+    }
+
+    for (i = 0; i < PAGE_CACHE_PROBE_BUCKETS && used < CACHE_BRIDGE_MAX_RESPONSE_LEN; ++i) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used,
+                                 "%s%llu",
+                                 i > 0 ? "," : "",
+                                 (unsigned long long)stats.probe_histogram[i]);
+    }
+
+    if (used < CACHE_BRIDGE_MAX_RESPONSE_LEN) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used, "],\"latency\":{");
+    }
+
+    for (i = 0; i < CACHE_OP_COUNT && used < CACHE_BRIDGE_MAX_RESPONSE_LEN; ++i) {
+        const cache_latency_histogram_t *latency = &stats.latency[i];
+        size_t b;
+
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used,
+                                 "%s\"%s\":{\"count\":%llu,\"totalNs\":%llu,\"maxNs\":%llu,\"buckets\":[",
+                                 i > 0 ? "," : "",
+                                 cache_op_name((cache_op_t)i),
+                                 (unsigned long long)latency->count,
+                                 (unsigned long long)latency->total_ns,
+                                 (unsigned long long)latency->max_ns);
+        for (b = 0; b < CACHE_METRICS_BUCKETS && used < CACHE_BRIDGE_MAX_RESPONSE_LEN; ++b) {
+            used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used,
+                                     "%s%llu",
+                                     b > 0 ? "," : "",
+                                     (unsigned long long)latency->buckets[b]);
+        }
+        if (used < CACHE_BRIDGE_MAX_RESPONSE_LEN) {
+            used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used, "]}");
+        }
+    }
+
+    cache_bridge_get_crossings(&crossings);
+    if (used < CACHE_BRIDGE_MAX_RESPONSE_LEN) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used,
+                                 "},\"crossings\":{\"json\":%llu,\"binary\":%llu,\"direct\":%llu}",
+                                 (unsigned long long)crossings.json,
+                                 (unsigned long long)crossings.binary,
+                                 (unsigned long long)crossings.direct);
+    }
+
+    if (used + 2 > CACHE_BRIDGE_MAX_RESPONSE_LEN) {
+        return cache_bridge_error_response("cache_stats_failed");
+    }
+
+    memcpy(response + used, "}", 2);
+    return response;
+}
+
+static const char *cache_bridge_handle_log_factorial(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    char value[DECIMAL_FORMAT_SHORTEST_MAX];
+    size_t n = 0;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_size(params_json, "n", &n) != 0 || n > INT_MAX) {
+        return cache_bridge_error_response("invalid_argument");
+    }
+
+    decimal_format_shortest(cache_bridge_log_factorial(n), value, sizeof(value));
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN, "{\"ok\":true,\"value\":%s}", value);
+    return response;
+}
+
+static const char *cache_bridge_handle_log_gamma(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    char value[DECIMAL_FORMAT_SHORTEST_MAX];
+    double x = 0.0;
+    double log_gamma;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_double(params_json, "x", &x) != 0) {
+        return cache_bridge_error_response("invalid_argument");
+    }
+
+    /* JSON has no NaN, so poles answer as an error */
+    log_gamma = cache_bridge_log_gamma(x);
+    if (isnan(log_gamma)) {
+        return cache_bridge_error_response("invalid_argument");
+    }
+
+    decimal_format_shortest(log_gamma, value, sizeof(value));
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN, "{\"ok\":true,\"value\":%s}", value);
+    return response;
+}
+
+static const char *cache_bridge_handle_log_combination(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    char value[DECIMAL_FORMAT_SHORTEST_MAX];
+    size_t n = 0;
+    size_t k = 0;
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    if (cache_bridge_extract_size(params_json, "n", &n) != 0 ||
+        cache_bridge_extract_size(params_json, "k", &k) != 0 ||
+        n > INT_MAX || k > n) {
+        return cache_bridge_error_response("invalid_argument");
+    }
+
+    decimal_format_shortest(cache_bridge_log_combination(n, k), value, sizeof(value));
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN, "{\"ok\":true,\"value\":%s}", value);
+    return response;
+}
+
+/* Answers in the plugin's own shape: success, pdf_result, cdf_result, error_message */
+static const char *cache_bridge_handle_calculate(const char *params_json) {
+    char *response = cache_bridge_scratch(NATIVE_PLUGIN_RESULT_LENGTH);
+
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
+    }
+
+    return native_plugin_calculate_json(params_json, response, NATIVE_PLUGIN_RESULT_LENGTH);
+}
+
+/* capacity 0 disables the orchestrator's result cache */
+static const char *cache_bridge_handle_set_result_cache(const char *params_json) {
+    size_t capacity = 0;
+
+    if (cache_bridge_extract_size(params_json, "capacity", &capacity) != 0) {
+        return cache_bridge_error_response("invalid_argument");
+    }
+
+    if (capacity == 0) {
+        orchestrator_disable_result_cache();
+        return cache_bridge_ok_response();
+    }
+
+    if (orchestrator_enable_result_cache(capacity) != 0) {
+        return cache_bridge_error_response("result_cache_failed");
+    }
+
+    return cache_bridge_ok_response();
+}
+
+/* tables 0 disables the shared cache of discrete PMF tables */
+static const char *cache_bridge_handle_set_table_cache(const char *params_json) {
+    size_t tables = 0;
+
+    if (cache_bridge_extract_size(params_json, "tables", &tables) != 0) {
+        return cache_bridge_error_response("invalid_argument");
     }
 
-    slot = cache_bridge_find_slot(handle);
-    if (!slot) {
-        return cache_bridge_error_response("cache_not_found");
+    if (tables == 0) {
+        pmf_table_cache_disable();
+        return cache_bridge_ok_response();
     }
 
-    if (cache_bridge_clear_service(handle) != 0) {
-        return cache_bridge_error_response("cache_clear_failed");
+    if (pmf_table_cache_enable(tables) != 0) {
+        return cache_bridge_error_response("table_cache_failed");
     }
 
     return cache_bridge_ok_response();
 }
 
-static const char *cache_bridge_handle_pin(const char *params_json) {
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
-    char key[CACHE_BRIDGE_MAX_KEY_LEN];
-    cache_bridge_slot_t *slot;
+/* {path, maxBytes} attaches the result cache's flash tier; maxBytes 0 persists and detaches it */
+static const char *cache_bridge_handle_set_result_tier(const char *params_json) {
+    char path[CACHE_BRIDGE_MAX_PATH_LEN];
+    size_t max_bytes = 0;
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0 ||
-        cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0) {
-        return cache_bridge_error_response("invalid_pin_request");
+    if (cache_bridge_extract_size(params_json, "maxBytes", &max_bytes) != 0) {
+        return cache_bridge_error_response("invalid_argument");
     }
 
-    slot = cache_bridge_find_slot(handle);
-    if (!slot) {
-        return cache_bridge_error_response("cache_not_found");
+    orchestrator_detach_result_tier();
+    if (max_bytes == 0) {
+        return cache_bridge_ok_response();
     }
 
-    if (cache_bridge_pin_value(handle, key) != 0) {
-        return cache_bridge_error_response("cache_pin_failed");
+    if (cache_bridge_extract_string(params_json, "path", path, sizeof(path)) != 0 || path[0] == '\0') {
+        return cache_bridge_error_response("invalid_argument");
+    }
+
+    if (orchestrator_attach_result_tier(path, max_bytes) != 0) {
+        return cache_bridge_error_response("result_tier_failed");
     }
 
     return cache_bridge_ok_response();
 }
 
-static const char *cache_bridge_handle_release(const char *params_json) {
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
-    char key[CACHE_BRIDGE_MAX_KEY_LEN];
-    cache_bridge_slot_t *slot;
+static const char *cache_bridge_handle_memory_budget(void) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    cache_budget_stats_t stats;
+    size_t used;
+    size_t i;
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0 ||
-        cache_bridge_extract_string(params_json, "key", key, sizeof(key)) != 0) {
-        return cache_bridge_error_response("invalid_release_request");
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
     }
 
-    slot = cache_bridge_find_slot(handle);
-    if (!slot) {
-        return cache_bridge_error_response("cache_not_found");
+    cache_budget_stats(&stats);
+    used = (size_t)snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN,
+             "{\"ok\":true,\"limit\":%zu,\"usage\":%zu,\"peakUsage\":%zu,"
+             "\"trims\":%llu,\"trimmedBytes\":%llu,\"pressureEvents\":%llu,\"accounts\":[",
+             stats.limit,
+             stats.usage,
+             stats.peak_usage,
+             (unsigned long long)stats.trims,
+             (unsigned long long)stats.trimmed_bytes,
+             (unsigned long long)stats.pressure_events);
+
+    for (i = 0; i < stats.account_count && used < CACHE_BRIDGE_MAX_RESPONSE_LEN; ++i) {
+        used += (size_t)snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used,
+                                 "%s{\"name\":\"%s\",\"class\":\"%s\",\"bytes\":%zu,\"trimmable\":%s}",
+                                 i > 0 ? "," : "",
+                                 stats.accounts[i].name,
+                                 cache_budget_class_name(stats.accounts[i].account_class),
+                                 stats.accounts[i].bytes,
+                                 stats.accounts[i].trimmable ? "true" : "false");
     }
 
-    if (cache_bridge_release_value(handle, key) != 0) {
-        return cache_bridge_error_response("cache_release_failed");
+    if (used < CACHE_BRIDGE_MAX_RESPONSE_LEN) {
+        snprintf(response + used, CACHE_BRIDGE_MAX_RESPONSE_LEN - used, "]}");
+    }
+
+    return response;
+}
+
+static const char *cache_bridge_handle_memory_set_budget(const char *params_json) {
+    size_t limit = 0;
+
+    if (cache_bridge_extract_size(params_json, "limit", &limit) != 0) {
+        return cache_bridge_error_response("invalid_argument");
     }
 
+    cache_budget_set_limit(limit);
     return cache_bridge_ok_response();
 }
 
-static const char *cache_bridge_handle_stats(const char *params_json) {
-    static char response[CACHE_BRIDGE_MAX_RESPONSE_LEN];
-    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
-    cache_bridge_slot_t *slot;
-    cache_service_stats_t stats;
+static const char *cache_bridge_handle_memory_pressure(const char *params_json) {
+    char *response = cache_bridge_scratch(CACHE_BRIDGE_MAX_RESPONSE_LEN);
+    char level[16];
+    cache_budget_pressure_t pressure;
 
-    if (cache_bridge_extract_string(params_json, "handle", handle, sizeof(handle)) != 0) {
-        return cache_bridge_error_response("invalid_handle");
+    if (!response) {
+        return cache_bridge_scratch_exhausted;
     }
 
-    slot = cache_bridge_find_slot(handle);
-    if (!slot) {
-        return cache_bridge_error_response("cache_not_found");
+    if (cache_bridge_extract_string(params_json, "level", level, sizeof(level)) != 0) {
+        return cache_bridge_error_response("invalid_argument");
     }
 
-    if (cache_service_stats(&slot->service, &stats) != 0) {
-        return cache_bridge_error_response("cache_stats_failed");
+    if (strcmp(level, "moderate") == 0) {
+        pressure = CACHE_BUDGET_PRESSURE_MODERATE;
+    } else if (strcmp(level, "critical") == 0) {
+        pressure = CACHE_BUDGET_PRESSURE_CRITICAL;
+    } else {
+        return cache_bridge_error_response("invalid_argument");
     }
 
-    snprintf(response, sizeof(response),
-             "{\"ok\":true,\"entries\":%zu,\"implementation\":\"native_page_cache\","
-             "\"hits\":%llu,\"misses\":%llu,\"evictions\":%llu,"
-             "\"reservedBytes\":%zu,\"metadataBytes\":%zu,"
-             "\"hashIndexBytes\":%zu,\"payloadCapacityBytes\":%zu}",
-             stats.entries,
-             (unsigned long long)stats.hits,
-             (unsigned long long)stats.misses,
-             (unsigned long long)stats.evictions,
-             stats.reserved_bytes,
-             stats.metadata_bytes,
-             stats.hash_index_bytes,
-             stats.payload_capacity_bytes);
+    snprintf(response, CACHE_BRIDGE_MAX_RESPONSE_LEN, "{\"ok\":true,\"freedBytes\":%zu}",
+             cache_budget_pressure(pressure));
     return response;
 }
 
-const char *cache_bridge_invoke(const char *method, const char *params_json) {
+static const char *cache_bridge_dispatch(const char *method, const char *params_json) {
+    cache_bridge_begin_call(&g_crossings.json);
+
     if (method == NULL || params_json == NULL) {
         return cache_bridge_error_response("invalid_request");
     }
@@ -712,9 +2124,24 @@ const char *cache_bridge_invoke(const char *method, const char *params_json) {
     if (strcmp(method, "cache.has") == 0) {
         return cache_bridge_handle_has(params_json);
     }
+    if (strcmp(method, "cache.getMany") == 0) {
+        return cache_bridge_handle_get_many(params_json);
+    }
+    if (strcmp(method, "cache.setMany") == 0) {
+        return cache_bridge_handle_set_many(params_json);
+    }
+    if (strcmp(method, "cache.hasMany") == 0) {
+        return cache_bridge_handle_has_many(params_json);
+    }
     if (strcmp(method, "cache.clear") == 0) {
         return cache_bridge_handle_clear(params_json);
     }
+    if (strcmp(method, "cache.resize") == 0) {
+        return cache_bridge_handle_resize(params_json);
+    }
+    if (strcmp(method, "cache.invalidate") == 0) {
+        return cache_bridge_handle_invalidate(params_json);
+    }
     if (strcmp(method, "cache.pin") == 0) {
         return cache_bridge_handle_pin(params_json);
     }
@@ -724,206 +2151,453 @@ const char *cache_bridge_invoke(const char *method, const char *params_json) {
     if (strcmp(method, "cache.stats") == 0) {
         return cache_bridge_handle_stats(params_json);
     }
+    if (strcmp(method, "math.logFactorial") == 0) {
+        return cache_bridge_handle_log_factorial(params_json);
+    }
+    if (strcmp(method, "math.logGamma") == 0) {
+        return cache_bridge_handle_log_gamma(params_json);
+    }
+    if (strcmp(method, "math.logCombination") == 0) {
+        return cache_bridge_handle_log_combination(params_json);
+    }
+    if (strcmp(method, "calc.calculate") == 0) {
+        return cache_bridge_handle_calculate(params_json);
+    }
+    if (strcmp(method, "calc.setResultCache") == 0) {
+        return cache_bridge_handle_set_result_cache(params_json);
+    }
+    if (strcmp(method, "calc.setTableCache") == 0) {
+        return cache_bridge_handle_set_table_cache(params_json);
+    }
+    if (strcmp(method, "calc.setResultTier") == 0) {
+        return cache_bridge_handle_set_result_tier(params_json);
+    }
+    if (strcmp(method, "calc.invalidateResults") == 0) {
+        return orchestrator_invalidate_result_cache() == 0
+                   ? cache_bridge_ok_response()
+                   : cache_bridge_error_response("result_cache_disabled");
+    }
+    if (strcmp(method, "memory.budget") == 0) {
+        return cache_bridge_handle_memory_budget();
+    }
+    if (strcmp(method, "memory.setBudget") == 0) {
+        return cache_bridge_handle_memory_set_budget(params_json);
+    }
+    if (strcmp(method, "memory.pressure") == 0) {
+        return cache_bridge_handle_memory_pressure(params_json);
+    }
 
     return cache_bridge_error_response("unsupported_method");
 }
 
-int cache_bridge_get_value(const char *handle, const char *key, uint8_t *out_buffer, size_t *inout_len) {
-    cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
-    cache_bridge_key_binding_t *binding;
+static uint16_t cache_bridge_read_u16(const uint8_t *bytes) {
+    return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
 
-    if (!slot || !key) {
-        return -1;
-    }
+static uint32_t cache_bridge_read_u32(const uint8_t *bytes) {
+    return (uint32_t)bytes[0] |
+           ((uint32_t)bytes[1] << 8) |
+           ((uint32_t)bytes[2] << 16) |
+           ((uint32_t)bytes[3] << 24);
+}
 
-    binding = cache_bridge_find_binding(slot, key);
-    if (!binding) {
-        return -1;
-    }
+static void cache_bridge_write_u32(uint8_t *bytes, uint32_t value) {
+    bytes[0] = (uint8_t)(value & 0xff);
+    bytes[1] = (uint8_t)((value >> 8) & 0xff);
+    bytes[2] = (uint8_t)((value >> 16) & 0xff);
+    bytes[3] = (uint8_t)(value >> 24);
+}
+
+/* Large enough for a full value; a GET copies the value straight into it. */
+static CACHE_THREAD_LOCAL uint8_t g_frame_response[CACHE_BRIDGE_FRAME_RESPONSE_HEADER_LEN + CACHE_BRIDGE_MAX_VALUE_LEN];
+
+/* Finishes the response header for a payload already in place after it. */
+static const uint8_t *cache_bridge_frame_response(cache_bridge_status_t status, size_t payload_len, size_t *out_len) {
+    g_frame_response[0] = (uint8_t)status;
+    g_frame_response[1] = 0;
+    g_frame_response[2] = 0;
+    g_frame_response[3] = 0;
+    cache_bridge_write_u32(g_frame_response + 4, (uint32_t)payload_len);
+    *out_len = CACHE_BRIDGE_FRAME_RESPONSE_HEADER_LEN + payload_len;
+    return g_frame_response;
+}
 
-    if (cache_service_get(&slot->service, binding->page_id, out_buffer, inout_len) != 0) {
-        cache_bridge_unbind_key(slot, binding);
+static const uint8_t *cache_bridge_frame_error(const char *message, size_t *out_len) {
+    size_t message_len = strlen(message);
+
+    memcpy(g_frame_response + CACHE_BRIDGE_FRAME_RESPONSE_HEADER_LEN, message, message_len);
+    return cache_bridge_frame_response(CACHE_BRIDGE_STATUS_ERROR, message_len, out_len);
+}
+
+/* Copies a length-prefixed frame field into a NUL-terminated buffer; embedded NULs are rejected. */
+static int cache_bridge_frame_string(const uint8_t *bytes, size_t len, char *out, size_t out_size) {
+    if (len >= out_size || memchr(bytes, '\0', len) != NULL) {
         return -1;
     }
 
+    memcpy(out, bytes, len);
+    out[len] = '\0';
     return 0;
 }
 
-int cache_bridge_get_value_ptr(const char *handle, const char *key, const uint8_t **out_data, size_t *out_len) {
-    cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
-    cache_bridge_key_binding_t *binding;
+static const uint8_t *cache_bridge_dispatch_binary(const uint8_t *request, size_t request_len, size_t *out_len) {
+    char handle[CACHE_BRIDGE_MAX_HANDLE_LEN];
+    char key[CACHE_BRIDGE_MAX_KEY_LEN];
+    uint8_t *payload = g_frame_response + CACHE_BRIDGE_FRAME_RESPONSE_HEADER_LEN;
+    cache_bridge_slot_t *slot;
+    const uint8_t *cursor;
+    size_t handle_len;
+    size_t key_len;
+    size_t value_len;
+    uint32_t arg;
+    int rc;
 
-    if (!slot || !key) {
-        return -1;
-    }
+    cache_bridge_begin_call(&g_crossings.binary);
 
-    binding = cache_bridge_find_binding(slot, key);
-    if (!binding) {
-        return -1;
+    if (!out_len) {
+        return NULL;
     }
 
-    if (cache_service_get_ptr(&slot->service, binding->page_id, out_data, out_len) != 0) {
-        cache_bridge_unbind_key(slot, binding);
-        return -1;
+    if (!request || request_len < CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN) {
+        return cache_bridge_frame_error("invalid_frame", out_len);
     }
 
-    return 0;
-}
+    handle_len = cache_bridge_read_u16(request + 2);
+    key_len = cache_bridge_read_u16(request + 4);
+    value_len = cache_bridge_read_u32(request + 8);
+    arg = cache_bridge_read_u32(request + 12);
+    cursor = request + CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN;
 
-int cache_bridge_set_value(const char *handle, const char *key, const uint8_t *data, size_t data_len) {
-    cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
-    cache_bridge_key_binding_t *binding;
-    int created = 0;
+    if (value_len > CACHE_BRIDGE_MAX_VALUE_LEN ||
+        request_len != CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN + handle_len + key_len + value_len ||
+        cache_bridge_frame_string(cursor + handle_len, key_len, key, sizeof(key)) != 0) {
+        return cache_bridge_frame_error("invalid_frame", out_len);
+    }
 
-    if (!slot || !key) {
-        return -1;
+    if (request[1] & CACHE_BRIDGE_FRAME_FLAG_HANDLE_ID) {
+        if (handle_len != 4) {
+            return cache_bridge_frame_error("invalid_frame", out_len);
+        }
+        slot = cache_bridge_find_slot_by_id(cache_bridge_read_u32(cursor));
+    } else {
+        if (cache_bridge_frame_string(cursor, handle_len, handle, sizeof(handle)) != 0) {
+            return cache_bridge_frame_error("invalid_frame", out_len);
+        }
+        slot = cache_bridge_find_slot(handle);
     }
+    cursor += handle_len + key_len;
 
-    binding = cache_bridge_find_binding(slot, key);
-    if (!binding) {
-        binding = cache_bridge_bind_key(slot, key);
-        created = 1;
+    if (!slot) {
+        return cache_bridge_frame_error("cache_not_found", out_len);
     }
 
-    if (!binding) {
-        return -1;
+    switch ((cache_bridge_op_t)request[0]) {
+        case CACHE_BRIDGE_OP_GET:
+            value_len = CACHE_BRIDGE_MAX_VALUE_LEN;
+            if (cache_bridge_slot_get_value(slot, key, payload, &value_len) != 0) {
+                return cache_bridge_frame_response(CACHE_BRIDGE_STATUS_MISS, 0, out_len);
+            }
+            return cache_bridge_frame_response(CACHE_BRIDGE_STATUS_OK, value_len, out_len);
+
+        case CACHE_BRIDGE_OP_SET:
+            rc = cache_bridge_slot_set_value(slot, key, cursor, value_len, arg);
+            break;
+
+        case CACHE_BRIDGE_OP_HAS:
+            return cache_bridge_frame_response(cache_bridge_slot_has_value(slot, key) ? CACHE_BRIDGE_STATUS_OK
+                                                                                      : CACHE_BRIDGE_STATUS_MISS,
+                                               0,
+                                               out_len);
+
+        case CACHE_BRIDGE_OP_PIN:
+            rc = cache_bridge_slot_pin_value(slot, key);
+            break;
+
+        case CACHE_BRIDGE_OP_RELEASE:
+            rc = cache_bridge_slot_release_value(slot, key);
+            break;
+
+        case CACHE_BRIDGE_OP_CLEAR:
+            rc = cache_bridge_slot_clear(slot);
+            break;
+
+        case CACHE_BRIDGE_OP_INVALIDATE:
+            if (cache_bridge_invalidate_slot(slot, &arg) != 0) {
+                return cache_bridge_frame_error("cache_invalidate_failed", out_len);
+            }
+            cache_bridge_write_u32(payload, arg);
+            return cache_bridge_frame_response(CACHE_BRIDGE_STATUS_OK, 4, out_len);
+
+        default:
+            return cache_bridge_frame_error("unsupported_method", out_len);
     }
 
-    if (cache_service_set(&slot->service, binding->page_id, data, data_len) != 0) {
-        if (created) {
-            cache_bridge_unbind_key(slot, binding);
-        }
-        return -1;
+    if (rc != 0) {
+        return cache_bridge_frame_error("cache_operation_failed", out_len);
     }
+    return cache_bridge_frame_response(CACHE_BRIDGE_STATUS_OK, 0, out_len);
+}
 
-    cache_bridge_compact_bindings(slot);
-    return 0;
+/* The public entry points wrap dispatch in one trace span each. */
+const char *cache_bridge_invoke(const char *method, const char *params_json) {
+    const char *response;
+
+    CACHE_TRACE_BEGIN(CACHE_TRACE_SPAN_BRIDGE_JSON, 0);
+    response = cache_bridge_dispatch(method, params_json);
+    CACHE_TRACE_END(CACHE_TRACE_SPAN_BRIDGE_JSON, 0);
+    return response;
 }
 
-int cache_bridge_has_value(const char *handle, const char *key) {
-    cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
-    cache_bridge_key_binding_t *binding;
+const uint8_t *cache_bridge_invoke_binary(const uint8_t *request, size_t request_len, size_t *out_len) {
+    uint32_t op = (request && request_len > 0) ? request[0] : 0;
+    const uint8_t *response;
 
-    if (!slot || !key) {
-        return 0;
-    }
+    CACHE_TRACE_BEGIN(CACHE_TRACE_SPAN_BRIDGE_BINARY, op);
+    response = cache_bridge_dispatch_binary(request, request_len, out_len);
+    CACHE_TRACE_END(CACHE_TRACE_SPAN_BRIDGE_BINARY, op);
+    return response;
+}
 
-    binding = cache_bridge_find_binding(slot, key);
-    if (!binding) {
-        return 0;
-    }
+int cache_bridge_get_value(const char *handle, const char *key, uint8_t *out_buffer, size_t *inout_len) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_get_value(cache_bridge_find_slot(handle), key, out_buffer, inout_len);
+}
 
-    return cache_service_has(&slot->service, binding->page_id);
+int cache_bridge_get_value_ptr(const char *handle, const char *key, const uint8_t **out_data, size_t *out_len) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_get_value_ptr(cache_bridge_find_slot(handle), key, out_data, out_len);
 }
 
-int cache_bridge_pin_value(const char *handle, const char *key) {
-    cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
-    cache_bridge_key_binding_t *binding;
+int cache_bridge_set_value(const char *handle, const char *key, const uint8_t *data, size_t data_len) {
+    return cache_bridge_set_value_cost(handle, key, data, data_len, 0);
+}
 
-    if (!slot || !key) {
-        return -1;
-    }
+int cache_bridge_set_value_cost(const char *handle,
+                                const char *key,
+                                const uint8_t *data,
+                                size_t data_len,
+                                uint32_t cost) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_set_value(cache_bridge_find_slot(handle), key, data, data_len, cost);
+}
 
-    binding = cache_bridge_find_binding(slot, key);
-    if (!binding) {
-        return -1;
-    }
+int cache_bridge_has_value(const char *handle, const char *key) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_has_value(cache_bridge_find_slot(handle), key);
+}
 
-    if (cache_service_pin(&slot->service, binding->page_id) != 0) {
-        if (!cache_service_has(&slot->service, binding->page_id)) {
-            cache_bridge_unbind_key(slot, binding);
-        }
-        return -1;
-    }
+int cache_bridge_pin_value(const char *handle, const char *key) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_pin_value(cache_bridge_find_slot(handle), key);
+}
 
-    return 0;
+int cache_bridge_acquire_value(const char *handle, const char *key, const uint8_t **out_data, size_t *out_len) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_acquire_value(cache_bridge_find_slot(handle), key, out_data, out_len);
 }
 
 int cache_bridge_release_value(const char *handle, const char *key) {
-    cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
-    cache_bridge_key_binding_t *binding;
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_release_value(cache_bridge_find_slot(handle), key);
+}
 
-    if (!slot || !key) {
-        return -1;
-    }
+int cache_bridge_get_value_by_id(cache_bridge_id_t id, const char *key, uint8_t *out_buffer, size_t *inout_len) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_get_value(cache_bridge_find_slot_by_id(id), key, out_buffer, inout_len);
+}
 
-    binding = cache_bridge_find_binding(slot, key);
-    if (!binding) {
-        return -1;
-    }
+int cache_bridge_get_value_ptr_by_id(cache_bridge_id_t id,
+                                     const char *key,
+                                     const uint8_t **out_data,
+                                     size_t *out_len) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_get_value_ptr(cache_bridge_find_slot_by_id(id), key, out_data, out_len);
+}
 
-    if (cache_service_release(&slot->service, binding->page_id) != 0) {
-        if (!cache_service_has(&slot->service, binding->page_id)) {
-            cache_bridge_unbind_key(slot, binding);
-        }
-        return -1;
-    }
+int cache_bridge_set_value_cost_by_id(cache_bridge_id_t id,
+                                      const char *key,
+                                      const uint8_t *data,
+                                      size_t data_len,
+                                      uint32_t cost) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_set_value(cache_bridge_find_slot_by_id(id), key, data, data_len, cost);
+}
 
-    return 0;
+int cache_bridge_has_value_by_id(cache_bridge_id_t id, const char *key) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_has_value(cache_bridge_find_slot_by_id(id), key);
+}
+
+int cache_bridge_pin_value_by_id(cache_bridge_id_t id, const char *key) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_pin_value(cache_bridge_find_slot_by_id(id), key);
+}
+
+int cache_bridge_release_value_by_id(cache_bridge_id_t id, const char *key) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_release_value(cache_bridge_find_slot_by_id(id), key);
+}
+
+int cache_bridge_acquire_value_by_id(cache_bridge_id_t id,
+                                     const char *key,
+                                     const uint8_t **out_data,
+                                     size_t *out_len) {
+    cache_bridge_begin_call(&g_crossings.direct);
+    return cache_bridge_slot_acquire_value(cache_bridge_find_slot_by_id(id), key, out_data, out_len);
+}
+
+cache_bridge_id_t cache_bridge_handle_id(const char *handle) {
+    cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
+    return slot ? slot->id : CACHE_BRIDGE_INVALID_ID;
+}
+
+const char *cache_bridge_id_handle(cache_bridge_id_t id) {
+    cache_bridge_slot_t *slot = cache_bridge_find_slot_by_id(id);
+    return slot ? slot->handle : NULL;
 }
 
 cache_service_t *cache_bridge_get_service(const char *handle) {
     cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
-    return slot ? &slot->service : NULL;
+    return slot ? &slot->shards[0].service : NULL;
 }
 
 const char *cache_bridge_create_service(const char *namespace_name, size_t capacity_pages, size_t page_size) {
-    cache_bridge_slot_t *slot;
-    if (cache_bridge_validate_config(capacity_pages, page_size) != 0) {
-        return NULL;
-    }
+    return cache_bridge_create_sharded_service(namespace_name, capacity_pages, page_size, 1);
+}
 
-    slot = cache_bridge_alloc_slot();
-    if (!slot) {
-        return NULL;
-    }
+const char *cache_bridge_create_sharded_service(const char *namespace_name,
+                                                size_t capacity_pages,
+                                                size_t page_size,
+                                                size_t shard_count) {
+    return cache_bridge_create_sharded_service_ex(namespace_name, capacity_pages, page_size, shard_count, 0);
+}
 
-    snprintf(slot->handle, sizeof(slot->handle), "cache-%u", g_next_handle_id++);
-    if (namespace_name) {
-        snprintf(slot->cache_namespace, sizeof(slot->cache_namespace), "%s", namespace_name);
-    } else {
-        slot->cache_namespace[0] = '\0';
-    }
+const char *cache_bridge_create_sharded_service_ex(const char *namespace_name,
+                                                   size_t capacity_pages,
+                                                   size_t page_size,
+                                                   size_t shard_count,
+                                                   unsigned int init_flags) {
+    cache_bridge_slot_t *slot =
+        cache_bridge_create_slot(namespace_name, capacity_pages, page_size, shard_count, init_flags);
+    return slot ? slot->handle : NULL;
+}
 
-    if (cache_bridge_init_bindings(slot, capacity_pages) != 0) {
-        memset(slot, 0, sizeof(*slot));
-        return NULL;
+int cache_bridge_clear_service(const char *handle) {
+    return cache_bridge_slot_clear(cache_bridge_find_slot(handle));
+}
+
+int cache_bridge_invalidate(const char *handle, uint32_t *out_generation) {
+    return cache_bridge_invalidate_slot(cache_bridge_find_slot(handle), out_generation);
+}
+
+int cache_bridge_invalidate_namespace(const char *namespace_name) {
+    int invalidated = 0;
+    size_t i;
+
+    if (!namespace_name) {
+        return -1;
     }
 
-    if (cache_service_init(&slot->service, capacity_pages, page_size) != 0) {
-        cache_bridge_release_bindings(slot);
-        memset(slot, 0, sizeof(*slot));
-        return NULL;
+    cache_lock_acquire(&g_registry_lock);
+    for (i = 0; i < CACHE_BRIDGE_MAX_CACHES; ++i) {
+        cache_bridge_slot_t *slot = &g_cache_slots[i];
+
+        if (!slot->in_use || strcmp(slot->cache_namespace, namespace_name) != 0) {
+            continue;
+        }
+
+        if (cache_bridge_invalidate_slot(slot, NULL) != 0) {
+            invalidated = -1;
+            break;
+        }
+        invalidated += 1;
     }
+    cache_lock_release(&g_registry_lock);
 
-    return slot->handle;
+    return invalidated;
 }
 
-int cache_bridge_clear_service(const char *handle) {
+int cache_bridge_destroy_service(const char *handle) {
+    return cache_bridge_destroy_slot(cache_bridge_find_slot(handle));
+}
+
+int cache_bridge_resize_service(const char *handle, size_t capacity_pages) {
+    return cache_bridge_slot_resize(cache_bridge_find_slot(handle), capacity_pages);
+}
+
+int cache_bridge_resize_service_by_id(cache_bridge_id_t id, size_t capacity_pages) {
+    return cache_bridge_slot_resize(cache_bridge_find_slot_by_id(id), capacity_pages);
+}
+
+int cache_bridge_set_compression(const char *handle, size_t threshold_bytes) {
     cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
+    size_t i;
 
     if (!slot) {
         return -1;
     }
 
-    if (cache_service_clear(&slot->service) != 0) {
-        return -1;
+    for (i = 0; i < slot->shard_count; ++i) {
+        cache_lock_acquire(&slot->shards[i].lock);
+        cache_service_set_compression(&slot->shards[i].service, threshold_bytes);
+        cache_lock_release(&slot->shards[i].lock);
     }
 
-    cache_bridge_release_bindings(slot);
-    return cache_bridge_init_bindings(slot, slot->service.capacity_pages);
+    return 0;
 }
 
-int cache_bridge_destroy_service(const char *handle) {
+int cache_bridge_set_policy(const char *handle, page_cache_policy_t policy) {
     cache_bridge_slot_t *slot = cache_bridge_find_slot(handle);
+    int rc = 0;
+    size_t i;
+
     if (!slot) {
         return -1;
     }
 
-    cache_bridge_reset_slot(slot);
-    return 0;
+    for (i = 0; i < slot->shard_count; ++i) {
+        cache_lock_acquire(&slot->shards[i].lock);
+        if (cache_service_set_policy(&slot->shards[i].service, policy) != 0) {
+            rc = -1;
+        }
+        cache_lock_release(&slot->shards[i].lock);
+    }
+
+    return rc;
+}
+
+int cache_bridge_get_stats(const char *handle, cache_service_stats_t *out_stats) {
+    return cache_bridge_slot_get_stats(cache_bridge_find_slot(handle), out_stats);
+}
+
+void cache_bridge_get_crossings(cache_bridge_crossings_t *out_crossings) {
+    if (!out_crossings) {
+        return;
+    }
+
+    out_crossings->json = cache_counter_load(&g_crossings.json);
+    out_crossings->binary = cache_counter_load(&g_crossings.binary);
+    out_crossings->direct = cache_counter_load(&g_crossings.direct);
 }
 
 uint32_t cache_bridge_hash(const char *key) {
     return cache_bridge_hash_key(key);
 }
+
+double cache_bridge_log_factorial(size_t n) {
+    return n > INT_MAX ? NAN : log_factorial((int)n);
+}
+
+double cache_bridge_log_gamma(double x) {
+    return (isnan(x) || (x <= 0.0 && x == floor(x))) ? NAN : log_gamma_function(x);
+}
+
+double cache_bridge_log_combination(size_t n, size_t k) {
+    if (n > INT_MAX) {
+        return NAN;
+    }
+    if (k > n) {
+        return -INFINITY;
+    }
+    return log_combination((int)n, (int)k);
+}
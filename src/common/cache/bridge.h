@@ -12,22 +12,159 @@ extern "C" {
  *
  * This exports both a legacy JSON-based invoke and direct C APIs 
  * for more efficient native integration (Direct Provider).
+ *
+ * Built with CACHE_THREAD_SAFE, the value and stats functions may be called
+ * from worker threads; responses and get_value_ptr data are then per-thread.
+ * JSON responses (and get_value_ptr copies in those builds) stay valid until
+ * the calling thread's next bridge call.
+ * cache_bridge_get_service returns the first shard unsynchronized.
  */
 
 const char *cache_bridge_invoke(const char *method, const char *params_json);
 
+/*
+ * Integer handles: the registry slot index plus that slot's creation serial,
+ * so an id stops resolving once its cache is destroyed, even if the slot is
+ * reused. 0 is never valid. String handles keep working everywhere; the
+ * _by_id value functions skip the string lookup on the hot path. JSON
+ * requests accept the id in place of the "handle" string, and cache.create
+ * returns both.
+ */
+typedef uint32_t cache_bridge_id_t;
+
+#define CACHE_BRIDGE_INVALID_ID 0u
+
+/* The id for a string handle, or CACHE_BRIDGE_INVALID_ID if it is unknown. */
+cache_bridge_id_t cache_bridge_handle_id(const char *handle);
+/* The string handle for an id, or NULL; valid until the cache is destroyed. */
+const char *cache_bridge_id_handle(cache_bridge_id_t id);
+
+/*
+ * Binary framing for the hot value operations, for runtimes that can pass
+ * bytes but have no direct QuickJS provider. All integers are little-endian.
+ *
+ *   request:  u8 op, u8 flags, u16 handle_len, u16 key_len, u16 0,
+ *             u32 value_len, u32 arg, then the handle, key and value bytes
+ *   response: u8 status, u8 0, u16 0, u32 payload_len, then the payload
+ *
+ * GET answers OK with the raw value or MISS; HAS answers OK or MISS; SET
+ * takes the recompute cost in arg; INVALIDATE answers with the new
+ * generation as a u32. ERROR carries a message. Create, destroy and stats
+ * stay on the JSON path. With CACHE_BRIDGE_FRAME_FLAG_HANDLE_ID set, the
+ * handle field is a 4-byte cache_bridge_id_t instead of the string.
+ */
+#define CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN 16
+#define CACHE_BRIDGE_FRAME_RESPONSE_HEADER_LEN 8
+#define CACHE_BRIDGE_FRAME_FLAG_HANDLE_ID 0x01
+
+typedef enum {
+    CACHE_BRIDGE_OP_GET = 1,
+    CACHE_BRIDGE_OP_SET = 2,
+    CACHE_BRIDGE_OP_HAS = 3,
+    CACHE_BRIDGE_OP_PIN = 4,
+    CACHE_BRIDGE_OP_RELEASE = 5,
+    CACHE_BRIDGE_OP_CLEAR = 6,
+    CACHE_BRIDGE_OP_INVALIDATE = 7
+} cache_bridge_op_t;
+
+typedef enum {
+    CACHE_BRIDGE_STATUS_OK = 0,
+    CACHE_BRIDGE_STATUS_MISS = 1,
+    CACHE_BRIDGE_STATUS_ERROR = 2
+} cache_bridge_status_t;
+
+/* Returns the response frame (per-thread buffer, valid until the next call) and its length; NULL if out_len is. */
+const uint8_t *cache_bridge_invoke_binary(const uint8_t *request, size_t request_len, size_t *out_len);
+
 cache_service_t *cache_bridge_get_service(const char *handle);
 const char *cache_bridge_create_service(const char *namespace_name, size_t capacity_pages, size_t page_size);
+const char *cache_bridge_create_sharded_service(const char *namespace_name,
+                                                size_t capacity_pages,
+                                                size_t page_size,
+                                                size_t shard_count);
+/*
+ * init_flags are PAGE_CACHE_INIT_* (core.h). With PAGE_CACHE_INIT_LAZY only
+ * metadata is reserved up front; payload is committed as the cache fills.
+ */
+const char *cache_bridge_create_sharded_service_ex(const char *namespace_name,
+                                                   size_t capacity_pages,
+                                                   size_t page_size,
+                                                   size_t shard_count,
+                                                   unsigned int init_flags);
 int cache_bridge_clear_service(const char *handle);
+/*
+ * Changes a cache's total capacity (split across its shards as at create)
+ * without dropping warm entries; see page_cache_resize. Fails while a value
+ * is pinned.
+ */
+int cache_bridge_resize_service(const char *handle, size_t capacity_pages);
+int cache_bridge_resize_service_by_id(cache_bridge_id_t id, size_t capacity_pages);
+/* O(1) bulk invalidation: current entries read as misses from now on. */
+int cache_bridge_invalidate(const char *handle, uint32_t *out_generation);
+/* Invalidates every cache created under namespace_name; returns how many, or -1. */
+int cache_bridge_invalidate_namespace(const char *namespace_name);
 int cache_bridge_destroy_service(const char *handle);
 int cache_bridge_get_value(const char *handle, const char *key, uint8_t *out_buffer, size_t *inout_len);
 int cache_bridge_get_value_ptr(const char *handle, const char *key, const uint8_t **out_data, size_t *out_len);
 int cache_bridge_set_value(const char *handle, const char *key, const uint8_t *data, size_t data_len);
+int cache_bridge_set_value_cost(const char *handle,
+                                const char *key,
+                                const uint8_t *data,
+                                size_t data_len,
+                                uint32_t cost);
 int cache_bridge_has_value(const char *handle, const char *key);
 int cache_bridge_pin_value(const char *handle, const char *key);
 int cache_bridge_release_value(const char *handle, const char *key);
+/*
+ * Zero-copy read: pins key's page and returns its bytes in place. Release
+ * with cache_bridge_release_value. Fails for compressed values, which need
+ * cache_bridge_get_value_ptr. The data must not be used after the cache is
+ * cleared or destroyed.
+ */
+int cache_bridge_acquire_value(const char *handle, const char *key, const uint8_t **out_data, size_t *out_len);
+int cache_bridge_get_value_by_id(cache_bridge_id_t id, const char *key, uint8_t *out_buffer, size_t *inout_len);
+int cache_bridge_get_value_ptr_by_id(cache_bridge_id_t id,
+                                     const char *key,
+                                     const uint8_t **out_data,
+                                     size_t *out_len);
+int cache_bridge_set_value_cost_by_id(cache_bridge_id_t id,
+                                      const char *key,
+                                      const uint8_t *data,
+                                      size_t data_len,
+                                      uint32_t cost);
+int cache_bridge_has_value_by_id(cache_bridge_id_t id, const char *key);
+int cache_bridge_pin_value_by_id(cache_bridge_id_t id, const char *key);
+int cache_bridge_release_value_by_id(cache_bridge_id_t id, const char *key);
+int cache_bridge_acquire_value_by_id(cache_bridge_id_t id,
+                                     const char *key,
+                                     const uint8_t **out_data,
+                                     size_t *out_len);
+int cache_bridge_set_compression(const char *handle, size_t threshold_bytes);
+int cache_bridge_set_policy(const char *handle, page_cache_policy_t policy);
+int cache_bridge_get_stats(const char *handle, cache_service_stats_t *out_stats);
 uint32_t cache_bridge_hash(const char *key);
 
+/*
+ * Process-wide count of calls into the bridge by entry point: JSON invokes,
+ * binary frames, and direct value calls (the QuickJS provider). Batches count
+ * once per invoke. Never reset.
+ */
+typedef struct {
+    uint64_t json;
+    uint64_t binary;
+    uint64_t direct;
+} cache_bridge_crossings_t;
+
+void cache_bridge_get_crossings(cache_bridge_crossings_t *out_crossings);
+
+/*
+ * Shared native log-gamma and log-factorial tables (legacy/core/math/math_utils.c).
+ * cache_bridge_log_gamma is log|Γ(x)|, NaN at the poles 0, -1, -2, ...
+ */
+double cache_bridge_log_factorial(size_t n);
+double cache_bridge_log_gamma(double x);
+double cache_bridge_log_combination(size_t n, size_t k);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,24 +1,162 @@
+import { registerRuntimeCleanup } from './runtime_cleanup.js'
+
+/**
+ * Native caches hand out an integer id (slot plus generation); older
+ * providers and the JSON bridge may hand out strings. Both are opaque.
+ * @typedef {number | string} CacheHandle
+ */
+
+/**
+ * Native timings, see metrics.h. Bucket b of a latency histogram counts
+ * samples under 2^(8+b) ns; the last bucket is open-ended.
+ * @typedef {{ count: number, totalNs: number, maxNs: number, buckets: number[] }} LatencyHistogram
+ * @typedef {{
+ *   latency: Record<'get' | 'set' | 'has' | 'pin' | 'prefetch' | 'evict', LatencyHistogram>,
+ *   probeHistogram: number[],
+ *   crossings: { json: number, binary: number, direct: number }
+ * }} CacheMetrics
+ */
+
+/**
+ * Native hot-path trace, see trace.h. Empty unless built with CACHE_TRACE.
+ * @typedef {{
+ *   enabled: boolean,
+ *   events: Array<{ span: string, phase: 'begin' | 'end', arg: number, timestampNs: number }>,
+ *   counters: Record<'betaFraction' | 'gammaSeries' | 'gammaFraction' | 'pmfTerms', number>
+ * }} TraceDump
+ */
+
+/**
+ * Result of the C calculation orchestrator (calculation_orchestrator.h).
+ * provisional marks a progressive preview whose exact result follows under ticket.
+ * @typedef {{
+ *   success: boolean, pdfResult: number, cdfResult: number, errorMessage: string | null,
+ *   fromCache?: boolean, provisional?: boolean, ticket?: number
+ * }} NativeCalculation
+ */
+
 /**
  * @typedef {{
  *   createCache: (config: {
  *     namespace: string,
  *     capacityPages: number,
- *     pageSize: number
- *   }) => string,
- *   destroyCache?: (handle: string) => void,
- *   get: (handle: string, key: string) => { hit: boolean, serializedValue?: string | null },
- *   set: (handle: string, key: string, serializedValue: string) => void,
- *   has?: (handle: string, key: string) => boolean,
- *   clear?: (handle: string) => void,
- *   pin?: (handle: string, key: string) => void,
- *   release?: (handle: string, key: string) => void,
- *   stats?: (handle: string) => { entries?: number, implementation?: string }
+ *     pageSize: number,
+ *     compressThreshold?: number,
+ *     policy?: 'clock' | 'cost',
+ *     lazy?: boolean
+ *   }) => CacheHandle,
+ *   destroyCache?: (handle: CacheHandle) => void,
+ *   get: (handle: CacheHandle, key: string) => { hit: boolean, serializedValue?: string | null },
+ *   set: (handle: CacheHandle, key: string, serializedValue: string, cost?: number) => void,
+ *   getBuffer?: (handle: CacheHandle, key: string) => ArrayBuffer | null,
+ *   setBuffer?: (handle: CacheHandle, key: string, bytes: ArrayBuffer | ArrayBufferView, cost?: number) => void,
+ *   has?: (handle: CacheHandle, key: string) => boolean,
+ *   getMany?: (handle: CacheHandle, keys: string[]) => Array<string | null>,
+ *   setMany?: (handle: CacheHandle, keys: string[], serializedValues: string[], costs?: number[]) => void,
+ *   hasMany?: (handle: CacheHandle, keys: string[]) => boolean[],
+ *   clear?: (handle: CacheHandle) => void,
+ *   resize?: (handle: CacheHandle, capacityPages: number) => boolean,
+ *   invalidate?: (handle: CacheHandle) => number,
+ *   invalidateNamespace?: (namespace: string) => number,
+ *   pin?: (handle: CacheHandle, key: string) => void,
+ *   release?: (handle: CacheHandle, key: string) => void,
+ *   stats?: (handle: CacheHandle) => { entries?: number, implementation?: string },
+ *   metrics?: (handle: CacheHandle) => CacheMetrics | null,
+ *   logFactorial?: (n: number) => number,
+ *   logCombination?: (n: number, k: number) => number,
+ *   logGamma?: (x: number) => number,
+ *   calculate?: (distribution: number, params: number[], x: number) => NativeCalculation | null,
+ *   calculateInto?: (distribution: number, params: number[], x: number, out: Float64Array) => boolean,
+ *   calculateBatch?: (requests: Array<{ distribution: number, params: number[], x: number }>) => NativeCalculation[],
+ *   calculateProgressive?: (distribution: number, params: number[], x: number) => NativeCalculation | null,
+ *   runRefinements?: (max?: number) => NativeCalculation[],
+ *   registryMetadata?: () => RegistryMetadata,
+ *   generateSeries?: (
+ *     distribution: number, params: number[], xMin: number, xMax: number, n: number,
+ *     handle?: CacheHandle, key?: string
+ *   ) => Float64Array | null,
+ *   adaptiveSeries?: (
+ *     distribution: number, params: number[], xMin: number, xMax: number,
+ *     widthPx: number, heightPx: number, maxEvaluations: number,
+ *     handle?: CacheHandle, key?: string
+ *   ) => Float64Array | null,
+ *   sampleStats?: (data: number[]) => { n: number, mean: number, s: number, variance: number },
+ *   hypothesisTest?: (kind: string, options: object) => object,
+ *   hypothesisSummary?: (kind: string, options: object) => object,
+ *   createRegression?: () => ArrayBuffer,
+ *   regressionAdd?: (state: ArrayBuffer, x: number, y: number) => boolean,
+ *   regressionRemove?: (state: ArrayBuffer, x: number, y: number) => boolean,
+ *   regressionReplace?: (state: ArrayBuffer, oldX: number, oldY: number, x: number, y: number) => boolean,
+ *   regressionFit?: (state: ArrayBuffer, alpha?: number) => object,
+ *   createExpression?: () => ArrayBuffer,
+ *   expressionUpdate?: (state: ArrayBuffer, text: string) => number,
+ *   expressionEvaluate?: (state: ArrayBuffer, ans?: number) => number | null,
+ *   createCoinSimulation?: (p: number, trials: number, seed: number) => ArrayBuffer,
+ *   coinSimulationStep?: (state: ArrayBuffer, maxTrials: number) => object,
+ *   createPokerSimulation?: (handSize: number, trials: number, seed: number) => ArrayBuffer,
+ *   pokerSimulationStep?: (state: ArrayBuffer, maxTrials: number) => object,
+ *   createResampling?: (kind: string, options: object) => ArrayBuffer,
+ *   resamplingStep?: (state: ArrayBuffer, maxResamples: number, budgetMs: number) => object,
+ *   resamplingInterval?: (state: ArrayBuffer, level: number) => object | null,
+ *   parseNumbers?: (text: string) => { values: Float64Array, errors: object[] },
+ *   traceDump?: (reset?: boolean) => TraceDump,
+ *   scheduleCalculation?: (priority: number, owner: number, distribution: number, params: number[], x: number) => number,
+ *   scheduleSimulation?: (priority: number, owner: number, kind: 'coin' | 'poker' | 'resampling', state: ArrayBuffer) => number,
+ *   runJobs?: (budgetMs: number, sliceUnits?: number) => Array<NativeCalculation & { kind: string, id: number, owner: number }>,
+ *   cancelJobs?: (owner?: number) => number,
+ *   cancelJob?: (id: number) => boolean,
+ *   pendingJobs?: () => number,
+ *   memoryBudget?: () => MemoryBudget | null,
+ *   setMemoryBudget?: (limit: number) => boolean,
+ *   memoryPressure?: (level: 'moderate' | 'critical') => number
  * }} CacheProvider
  */
 
+/**
+ * @typedef {{
+ *   limit: number, usage: number, peakUsage: number,
+ *   trims: number, trimmedBytes: number, pressureEvents: number,
+ *   accounts: Array<{ name: string, class: string, bytes: number, trimmable: boolean }>
+ * }} MemoryBudget
+ */
+
+/**
+ * @typedef {{
+ *   distributions: Array<{
+ *     id: number, name: string, description: string, category: 'continuous' | 'discrete',
+ *     params: Array<{ name: string, min: number, max: number }>
+ *   }>,
+ *   categories: { continuous: number[], discrete: number[] }
+ * }} RegistryMetadata
+ */
+
+// Keys per native batch call; matches CACHE_BRIDGE_MAX_BATCH_KEYS in bridge.c
+const BATCH_LIMIT = 256
+
 /** @type {CacheProvider | null} */
 let provider = null
 
+/** @type {RegistryMetadata | null} */
+let registryMetadata = null
+
+/**
+ * Runs fn over keys in BATCH_LIMIT-sized slices and concatenates the results.
+ * @template T
+ * @param {string[]} keys @param {(slice: string[], start: number) => T[] | void} fn
+ * @returns {T[]}
+ */
+function inBatches(keys, fn) {
+  /** @type {T[]} */
+  let results = []
+  for (let start = 0; start < keys.length; start += BATCH_LIMIT) {
+    const batch = fn(keys.slice(start, start + BATCH_LIMIT), start)
+    if (batch) {
+      results = results.concat(batch)
+    }
+  }
+  return results
+}
+
 /** @param {CacheProvider | null} nextProvider */
 export function registerProvider(nextProvider) {
   provider = nextProvider
@@ -33,11 +171,802 @@ export function hasProvider() {
   )
 }
 
+/*
+ * Binary request framing for cache_bridge_invoke_binary (see bridge.h).
+ * Little-endian; a 16-byte request header and an 8-byte response header.
+ */
+export const FRAME_OP = {
+  GET: 1,
+  SET: 2,
+  HAS: 3,
+  PIN: 4,
+  RELEASE: 5,
+  CLEAR: 6,
+  INVALIDATE: 7,
+}
+
+export const FRAME_STATUS = {
+  OK: 0,
+  MISS: 1,
+  ERROR: 2,
+}
+
+const FRAME_REQUEST_HEADER_LEN = 16
+const FRAME_RESPONSE_HEADER_LEN = 8
+// CACHE_BRIDGE_FRAME_FLAG_HANDLE_ID: the handle field is a u32 id
+const FRAME_FLAG_HANDLE_ID = 0x01
+
+/** @param {string} text @returns {number[]} UTF-8 bytes */
+function utf8Encode(text) {
+  const bytes = []
+  for (let i = 0; i < text.length; i += 1) {
+    let code = text.charCodeAt(i)
+    if (code >= 0xd800 && code < 0xdc00 && i + 1 < text.length) {
+      const low = text.charCodeAt(i + 1)
+      if (low >= 0xdc00 && low < 0xe000) {
+        code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00)
+        i += 1
+      }
+    }
+    if (code < 0x80) {
+      bytes.push(code)
+    } else if (code < 0x800) {
+      bytes.push(0xc0 | (code >> 6), 0x80 | (code & 0x3f))
+    } else if (code < 0x10000) {
+      bytes.push(0xe0 | (code >> 12), 0x80 | ((code >> 6) & 0x3f), 0x80 | (code & 0x3f))
+    } else {
+      bytes.push(
+        0xf0 | (code >> 18),
+        0x80 | ((code >> 12) & 0x3f),
+        0x80 | ((code >> 6) & 0x3f),
+        0x80 | (code & 0x3f)
+      )
+    }
+  }
+  return bytes
+}
+
+/** @param {Uint8Array} bytes @returns {string} */
+function utf8Decode(bytes) {
+  let text = ''
+  let i = 0
+  while (i < bytes.length) {
+    const byte = bytes[i]
+    let code
+    if (byte < 0x80) {
+      code = byte
+      i += 1
+    } else if (byte < 0xe0) {
+      code = ((byte & 0x1f) << 6) | (bytes[i + 1] & 0x3f)
+      i += 2
+    } else if (byte < 0xf0) {
+      code = ((byte & 0x0f) << 12) | ((bytes[i + 1] & 0x3f) << 6) | (bytes[i + 2] & 0x3f)
+      i += 3
+    } else {
+      code =
+        ((byte & 0x07) << 18) |
+        ((bytes[i + 1] & 0x3f) << 12) |
+        ((bytes[i + 2] & 0x3f) << 6) |
+        (bytes[i + 3] & 0x3f)
+      i += 4
+    }
+    if (code >= 0x10000) {
+      code -= 0x10000
+      text += String.fromCharCode(0xd800 + (code >> 10), 0xdc00 + (code & 0x3ff))
+    } else {
+      text += String.fromCharCode(code)
+    }
+  }
+  return text
+}
+
+/**
+ * @param {number} op FRAME_OP value
+ * @param {CacheHandle} handle
+ * @param {string} [key]
+ * @param {string} [value] serialized value (SET)
+ * @param {number} [arg] SET: recompute cost
+ * @returns {ArrayBuffer}
+ */
+export function encodeFrame(op, handle, key = '', value = '', arg = 0) {
+  const numeric = typeof handle === 'number'
+  const handleBytes = numeric
+    ? [handle & 0xff, (handle >>> 8) & 0xff, (handle >>> 16) & 0xff, handle >>> 24]
+    : utf8Encode(handle)
+  const keyBytes = utf8Encode(key)
+  const valueBytes = utf8Encode(value)
+  const buffer = new ArrayBuffer(
+    FRAME_REQUEST_HEADER_LEN + handleBytes.length + keyBytes.length + valueBytes.length
+  )
+  const view = new DataView(buffer)
+  const bytes = new Uint8Array(buffer)
+
+  view.setUint8(0, op)
+  view.setUint8(1, numeric ? FRAME_FLAG_HANDLE_ID : 0)
+  view.setUint16(2, handleBytes.length, true)
+  view.setUint16(4, keyBytes.length, true)
+  view.setUint32(8, valueBytes.length, true)
+  view.setUint32(12, arg >>> 0, true)
+  bytes.set(handleBytes, FRAME_REQUEST_HEADER_LEN)
+  bytes.set(keyBytes, FRAME_REQUEST_HEADER_LEN + handleBytes.length)
+  bytes.set(valueBytes, FRAME_REQUEST_HEADER_LEN + handleBytes.length + keyBytes.length)
+  return buffer
+}
+
+/**
+ * @param {ArrayBuffer} buffer response frame
+ * @returns {{ status: number, payload: Uint8Array, text: () => string }}
+ */
+export function decodeFrame(buffer) {
+  if (!buffer || buffer.byteLength < FRAME_RESPONSE_HEADER_LEN) {
+    return { status: FRAME_STATUS.ERROR, payload: new Uint8Array(0), text: () => 'invalid_frame' }
+  }
+  const view = new DataView(buffer)
+  const length = view.getUint32(4, true)
+  if (length > buffer.byteLength - FRAME_RESPONSE_HEADER_LEN) {
+    return { status: FRAME_STATUS.ERROR, payload: new Uint8Array(0), text: () => 'invalid_frame' }
+  }
+  const payload = new Uint8Array(buffer, FRAME_RESPONSE_HEADER_LEN, length)
+  return {
+    status: view.getUint8(0),
+    payload,
+    text: () => utf8Decode(payload),
+  }
+}
+
+/**
+ * Invalidates every native cache created under namespace (O(1) per cache).
+ * Returns how many caches were invalidated; 0 without a native provider.
+ * @param {string} namespace
+ */
+export function invalidateNamespace(namespace) {
+  if (!provider || typeof provider.invalidateNamespace !== 'function') {
+    return 0
+  }
+  const count = provider.invalidateNamespace(namespace)
+  return typeof count === 'number' ? count : 0
+}
+
+/**
+ * log(n!) from the native log-factorial cache, or null without a native provider.
+ * @param {number} n
+ */
+export function nativeLogFactorial(n) {
+  if (!provider || typeof provider.logFactorial !== 'function') {
+    return null
+  }
+  const value = provider.logFactorial(n)
+  return typeof value === 'number' ? value : null
+}
+
+/**
+ * log(C(n, k)) from the native log-factorial cache, or null without a native provider.
+ * @param {number} n @param {number} k
+ */
+export function nativeLogCombination(n, k) {
+  if (!provider || typeof provider.logCombination !== 'function') {
+    return null
+  }
+  const value = provider.logCombination(n, k)
+  return typeof value === 'number' ? value : null
+}
+
+/**
+ * log|Γ(x)| from the native log-gamma tables, or null without a native provider.
+ * @param {number} x
+ */
+export function nativeLogGamma(x) {
+  if (!provider || typeof provider.logGamma !== 'function') {
+    return null
+  }
+  const value = provider.logGamma(x)
+  return typeof value === 'number' && !Number.isNaN(value) ? value : null
+}
+
+/** Slots nativeCalculateInto fills: pdfResult, cdfResult, fromCache (0 or 1) */
+export const NATIVE_RESULT_SLOTS = 3
+
+/**
+ * nativeCalculate into a caller-owned Float64Array of NATIVE_RESULT_SLOTS,
+ * so a hot caller reuses one flat buffer instead of receiving a result object
+ * per call. Returns false without a native provider or when the request is
+ * rejected; out is left untouched then.
+ * @param {number} distribution @param {number[]} params @param {number} x @param {Float64Array} out
+ */
+export function nativeCalculateInto(distribution, params, x, out) {
+  if (!provider) {
+    return false
+  }
+  if (typeof provider.calculateInto === 'function') {
+    return !!provider.calculateInto(distribution, params, x, out)
+  }
+  // Invoke-bridge providers answer with an object; copy it across
+  const result = nativeCalculate(distribution, params, x)
+  if (!result) {
+    return false
+  }
+  out[0] = result.pdfResult
+  out[1] = result.cdfResult
+  out[2] = result.fromCache ? 1 : 0
+  return true
+}
+
+/**
+ * PDF/PMF and CDF from the native orchestrator, or null without a native
+ * provider or when it rejects the request (the caller computes in JS then).
+ * @param {number} distribution DISTRIBUTION_TYPES id @param {number[]} params registry order @param {number} x
+ * @returns {{ pdfResult: number, cdfResult: number, fromCache: boolean } | null}
+ */
+export function nativeCalculate(distribution, params, x) {
+  if (!provider || typeof provider.calculate !== 'function') {
+    return null
+  }
+  const result = provider.calculate(distribution, params, x)
+  return result && result.success ? result : null
+}
+
+/**
+ * nativeCalculate for many requests in one crossing
+ * (orchestrator_calculate_batch), or null without a native provider. Requests
+ * sharing a distribution and parameters are prepared once. Each slot holds
+ * the native result, or null where it was rejected, in request order.
+ * @param {Array<{ distribution: number, params: number[], x: number }>} requests
+ * @returns {Array<{ pdfResult: number, cdfResult: number, fromCache: boolean } | null> | null}
+ */
+export function nativeCalculateBatch(requests) {
+  if (!provider || typeof provider.calculateBatch !== 'function') {
+    return null
+  }
+  const results = provider.calculateBatch(requests)
+  return results ? results.map((result) => (result && result.success ? result : null)) : null
+}
+
+/** @type {Map<number, Array<(result: NativeCalculation | null) => void>>} */
+const pendingRefinements = new Map()
+let refinementTimer = null
+
+/**
+ * Runs up to max queued native refinements and hands each exact result to
+ * the callbacks waiting on its ticket. Hosts with an idle hook call this
+ * from it; nativeCalculateProgressive otherwise schedules it one at a time.
+ * @param {number} [max]
+ * @returns {number} refinements run
+ */
+export function nativeRunRefinements(max) {
+  if (!provider || typeof provider.runRefinements !== 'function') {
+    return 0
+  }
+  const results = provider.runRefinements(max) || []
+  results.forEach((result) => {
+    const callbacks = pendingRefinements.get(result.ticket) || []
+    pendingRefinements.delete(result.ticket)
+    callbacks.forEach((callback) => callback(result.success ? result : null))
+  })
+  return results.length
+}
+
+function scheduleRefinements() {
+  if (refinementTimer !== null) {
+    return
+  }
+  refinementTimer = setTimeout(() => {
+    refinementTimer = null
+    // One refinement per tick keeps each slice short on the watch
+    if (nativeRunRefinements(1) > 0) {
+      scheduleRefinements()
+    }
+  }, 0)
+}
+
+/**
+ * nativeCalculate that answers at once. When the exact CDF is expensive the
+ * result is provisional (exact PDF, approximate CDF) and onRefined later
+ * receives the exact result, or null if it was rejected. A final result
+ * never calls onRefined. Null without a native provider.
+ * @param {number} distribution @param {number[]} params @param {number} x
+ * @param {(result: NativeCalculation | null) => void} [onRefined]
+ * @returns {NativeCalculation | null}
+ */
+export function nativeCalculateProgressive(distribution, params, x, onRefined) {
+  if (!provider || typeof provider.calculateProgressive !== 'function') {
+    return nativeCalculate(distribution, params, x)
+  }
+  const result = provider.calculateProgressive(distribution, params, x)
+  if (!result || !result.success) {
+    return null
+  }
+  if (result.provisional && result.ticket) {
+    if (typeof onRefined === 'function') {
+      const callbacks = pendingRefinements.get(result.ticket) || []
+      callbacks.push(onRefined)
+      pendingRefinements.set(result.ticket, callbacks)
+    }
+    // Refined results also land in the native result cache, so run them regardless
+    scheduleRefinements()
+  }
+  return result
+}
+
+/** Native job scheduler classes (job_scheduler.h); lower runs first. */
+export const JOB_PRIORITY = Object.freeze({ INTERACTIVE: 0, CHART: 1, PREFETCH: 2 })
+
+// Time handed to runJobs per event-loop turn, short enough to keep gestures responsive
+const JOB_SLICE_MS = 8
+
+/** @type {Map<number, { owner: number, settle: (completion: object | null) => void }>} */
+const scheduledJobs = new Map()
+let jobTimer = null
+
+function scheduleJobPump() {
+  if (jobTimer !== null || scheduledJobs.size === 0) {
+    return
+  }
+  jobTimer = setTimeout(() => {
+    jobTimer = null
+    if (!provider || typeof provider.runJobs !== 'function') {
+      return
+    }
+    const completions = provider.runJobs(JOB_SLICE_MS) || []
+    completions.forEach((completion) => {
+      const job = scheduledJobs.get(completion.id)
+      scheduledJobs.delete(completion.id)
+      if (job) {
+        job.settle(completion)
+      }
+    })
+    scheduleJobPump()
+  }, 0)
+}
+
+/**
+ * Tracks a submitted native job; the promise resolves with what settle maps
+ * the completion to, or null if the job is cancelled.
+ * @param {number} id @param {number} owner @param {(completion: object) => any} map
+ */
+function trackJob(id, owner, map) {
+  let resolveJob
+  const promise = new Promise((resolve) => { resolveJob = resolve })
+  scheduledJobs.set(id, { owner, settle: (completion) => resolveJob(completion ? map(completion) : null) })
+  scheduleJobPump()
+  return {
+    promise,
+    cancel: () => {
+      const job = scheduledJobs.get(id)
+      if (job) {
+        scheduledJobs.delete(id)
+        provider.cancelJob(id)
+        job.settle(null)
+      }
+    }
+  }
+}
+
+/**
+ * nativeCalculate as a native job, queued by priority with the page's
+ * simulations and run from the scheduler's tick. The promise resolves with the
+ * result, or null if it was rejected or cancelled. Returns null without a
+ * native scheduler or when it is full (the caller calculates directly then).
+ * @param {number} distribution @param {number[]} params @param {number} x
+ * @param {{ priority?: number, owner?: number }} [options] owner tags jobs for cancelNativeJobs
+ * @returns {{ promise: Promise<NativeCalculation | null>, cancel: () => void } | null}
+ */
+export function scheduleNativeCalculation(distribution, params, x, { priority = JOB_PRIORITY.INTERACTIVE, owner = 0 } = {}) {
+  if (!provider || typeof provider.scheduleCalculation !== 'function') {
+    return null
+  }
+  const id = provider.scheduleCalculation(priority, owner, distribution, params, x)
+  return id ? trackJob(id, owner, (result) => (result.success ? result : null)) : null
+}
+
+/**
+ * Drops every scheduled native job with owner, or all of them when owner is
+ * omitted (e.g. when the user navigates away); their promises resolve with null.
+ * @param {number} [owner]
+ * @returns {number} jobs cancelled
+ */
+export function cancelNativeJobs(owner) {
+  if (!provider || typeof provider.cancelJobs !== 'function') {
+    return 0
+  }
+  const cancelled = provider.cancelJobs(owner)
+  scheduledJobs.forEach((job, id) => {
+    if (owner === undefined || job.owner === owner) {
+      scheduledJobs.delete(id)
+      job.settle(null)
+    }
+  })
+  return cancelled
+}
+
+registerRuntimeCleanup(() => cancelNativeJobs())
+
+/**
+ * Sizes the native orchestrator's result cache (entries); 0 disables it.
+ * Returns false without a native provider.
+ * @param {number} capacity
+ * @returns {boolean}
+ */
+export function configureNativeResultCache(capacity) {
+  if (!provider || typeof provider.setResultCache !== 'function') {
+    return false
+  }
+  return provider.setResultCache(capacity) === true
+}
+
+/**
+ * Sizes the native cache of discrete PMF tables (tables); 0 disables it.
+ * Returns false without a native provider.
+ * @param {number} tables
+ * @returns {boolean}
+ */
+export function configureNativeTableCache(tables) {
+  if (!provider || typeof provider.setTableCache !== 'function') {
+    return false
+  }
+  return provider.setTableCache(tables) === true
+}
+
+/**
+ * Keeps results the native result cache evicts in a flash file of at most
+ * maxBytes, so they survive a restart; maxBytes 0 writes the cached results
+ * out and detaches the file. Returns false without a native provider.
+ * @param {string} path
+ * @param {number} maxBytes
+ * @returns {boolean}
+ */
+export function configureNativeResultTier(path, maxBytes) {
+  if (!provider || typeof provider.setResultTier !== 'function') {
+    return false
+  }
+  return provider.setResultTier(path, maxBytes) === true
+}
+
+/** Drops every cached native calculation result. */
+export function invalidateNativeResults() {
+  if (!provider || typeof provider.invalidateResults !== 'function') {
+    return false
+  }
+  return provider.invalidateResults() === true
+}
+
+/**
+ * The native memory budget: the cap, current usage and each account's share
+ * (page caches, result cache, history, arenas, tables), or null without a
+ * native provider.
+ * @returns {MemoryBudget | null}
+ */
+export function nativeMemoryBudget() {
+  if (!provider || typeof provider.memoryBudget !== 'function') {
+    return null
+  }
+  return provider.memoryBudget() || null
+}
+
+/**
+ * Caps native memory at limit bytes, trimming at once if usage is over it;
+ * 0 removes the cap. Returns false without a native provider.
+ * @param {number} limit
+ */
+export function setNativeMemoryBudget(limit) {
+  if (!provider || typeof provider.setMemoryBudget !== 'function') {
+    return false
+  }
+  return provider.setMemoryBudget(limit) === true
+}
+
+/**
+ * Passes a memory pressure signal to the native budget: 'moderate' trims a
+ * quarter of native usage, 'critical' everything that can be rebuilt.
+ * Returns the bytes freed, 0 without a native provider.
+ * @param {'moderate' | 'critical'} level
+ */
+export function nativeMemoryPressure(level) {
+  if (!provider || typeof provider.memoryPressure !== 'function') {
+    return 0
+  }
+  const freed = provider.memoryPressure(level)
+  return typeof freed === 'number' ? freed : 0
+}
+
+/**
+ * The native distribution registry (names, descriptions, parameter names and
+ * ranges, category lists), or null without a native provider. The registry is
+ * compile-time const, so it is fetched in one crossing on first use and the
+ * same object is returned afterwards.
+ * @returns {RegistryMetadata | null}
+ */
+export function nativeRegistryMetadata() {
+  if (registryMetadata) {
+    return registryMetadata
+  }
+  if (!provider || typeof provider.registryMetadata !== 'function') {
+    return null
+  }
+  registryMetadata = provider.registryMetadata() || null
+  return registryMetadata
+}
+
+/**
+ * n PDF/PMF samples over [xMin, xMax] from the native batch kernels, or null
+ * without a native provider. Discrete distributions with integer xMin and
+ * unit spacing are filled by recurrence.
+ * @param {number} distribution @param {number[]} params @param {number} xMin @param {number} xMax @param {number} n
+ * @returns {Float64Array | null}
+ */
+export function nativeGenerateSeries(distribution, params, xMin, xMax, n) {
+  if (!provider || typeof provider.generateSeries !== 'function') {
+    return null
+  }
+  return provider.generateSeries(distribution, params, xMin, xMax, n) || null
+}
+
+/**
+ * The PDF over [xMin, xMax] sampled for a widthPx by heightPx chart, as
+ * interleaved x, y pairs: a coarse grid refined only where the curve bends
+ * or steps by more than a pixel threshold, at most maxEvaluations points.
+ * The same width gives the same points, so callers cache per width. null
+ * without a native provider.
+ * @param {number} distribution @param {number[]} params @param {number} xMin @param {number} xMax
+ * @param {number} widthPx @param {number} heightPx @param {number} maxEvaluations
+ * @returns {Float64Array | null}
+ */
+export function nativeAdaptiveSeries(distribution, params, xMin, xMax, widthPx, heightPx, maxEvaluations) {
+  if (!provider || typeof provider.adaptiveSeries !== 'function') {
+    return null
+  }
+  return provider.adaptiveSeries(distribution, params, xMin, xMax, widthPx, heightPx, maxEvaluations) || null
+}
+
+/**
+ * Summary statistics of the finite values in data from one native Welford
+ * pass, or null without a native provider.
+ * @param {number[]} data
+ * @returns {{ n: number, mean: number, s: number, variance: number } | null}
+ */
+export function nativeSampleStats(data) {
+  if (!provider || typeof provider.sampleStats !== 'function') {
+    return null
+  }
+  return provider.sampleStats(data) || null
+}
+
+/**
+ * Runs the HypothesisEngine method named kind in the native kernels
+ * (hypothesis_kernels.h), or null without a native provider. options holds
+ * the method's named parameters; array inputs go in sample1/sample2,
+ * observed/expected, x/y or matrix. The result, errors included, has the
+ * JS method's shape.
+ * @param {string} kind @param {object} options
+ * @returns {any}
+ */
+export function nativeHypothesisTest(kind, options) {
+  if (!provider || typeof provider.hypothesisTest !== 'function') {
+    return null
+  }
+  return provider.hypothesisTest(kind, options) || null
+}
+
+/**
+ * Statistic, tail p-value, confidence intervals at several levels, effect
+ * size and power for one Z or t test in a single native call
+ * (hypothesis_summary in hypothesis_kernels.h), or null without a native
+ * provider. kind and options are as for nativeHypothesisTest, plus tail and
+ * levels.
+ * @param {'zTestOneSample' | 'zTestTwoSample' | 'tTestOneSample' | 'tTestTwoSample'} kind
+ * @param {object} options
+ * @returns {any}
+ */
+export function nativeHypothesisSummary(kind, options) {
+  if (!provider || typeof provider.hypothesisSummary !== 'function') {
+    return null
+  }
+  return provider.hypothesisSummary(kind, options) || null
+}
+
+/**
+ * Native online regression state (hypothesis_accumulator_* in
+ * hypothesis_kernels.h), or null without a native provider. The state is an
+ * ArrayBuffer the garbage collector frees; fit returns linearRegression's
+ * result shape.
+ * @returns {{
+ *   add: (x: number, y: number) => boolean,
+ *   remove: (x: number, y: number) => boolean,
+ *   replace: (oldX: number, oldY: number, x: number, y: number) => boolean,
+ *   fit: (alpha?: number) => any
+ * } | null}
+ */
+export function createNativeRegression() {
+  if (!provider || typeof provider.createRegression !== 'function') {
+    return null
+  }
+  const native = provider
+  const state = native.createRegression()
+  if (!state) {
+    return null
+  }
+  return {
+    add: (x, y) => native.regressionAdd(state, x, y) === true,
+    remove: (x, y) => native.regressionRemove(state, x, y) === true,
+    replace: (oldX, oldY, x, y) => native.regressionReplace(state, oldX, oldY, x, y) === true,
+    fit: (alpha) => native.regressionFit(state, alpha),
+  }
+}
+
+// expression_status_t in expression_engine.h, by code
+const EXPRESSION_STATUSES = ['ok', 'empty', 'incomplete', 'syntax', 'unbalanced', 'arity', 'too_large']
+
+/**
+ * Native calculator expression (expression_engine.h), or null without a
+ * native provider. update compiles the new text to bytecode, re-lexing only
+ * from the first character that differs from the previous text, and
+ * returns the status name; evaluate runs the compiled program and returns
+ * null unless the last update was 'ok'. Typing and deleting at the end are
+ * cheap enough to update on every key.
+ * @returns {{
+ *   update: (text: string) => 'ok' | 'empty' | 'incomplete' | 'syntax' | 'unbalanced' | 'arity' | 'too_large',
+ *   evaluate: (ans?: number) => number | null
+ * } | null}
+ */
+export function createNativeExpression() {
+  if (!provider || typeof provider.createExpression !== 'function') {
+    return null
+  }
+  const native = provider
+  const state = native.createExpression()
+  if (!state) {
+    return null
+  }
+  return {
+    update: (text) => EXPRESSION_STATUSES[native.expressionUpdate(state, text)] || 'syntax',
+    evaluate: (ans) => {
+      const value = native.expressionEvaluate(state, ans)
+      return typeof value === 'number' ? value : null
+    },
+  }
+}
+
+/**
+ * Runs a native simulation state to completion as a scheduler job; the
+ * promise resolves with its final progress, or null if cancelled. Null when
+ * the provider has no scheduler or it is full.
+ */
+function scheduleSimulation(native, kind, state, priority, owner, finalProgress) {
+  if (typeof native.scheduleSimulation !== 'function') {
+    return null
+  }
+  const id = native.scheduleSimulation(priority, owner, kind, state)
+  return id ? trackJob(id, owner, finalProgress) : null
+}
+
+/**
+ * Native chunked coin-flip run (sim_coin_* in monte_carlo.h), or null without
+ * a native provider. Each step flips up to maxTrials more coins and returns
+ * the running totals; schedule instead runs the rest as a native scheduler
+ * job (chart priority by default) and resolves with the final totals.
+ * Throws RangeError for p outside [0, 1].
+ * @returns {{
+ *   step: (maxTrials: number) => {
+ *     done: number, total: number, heads: number,
+ *     longestHeadsRun: number, longestTailsRun: number, finished: boolean
+ *   },
+ *   schedule: (options?: { priority?: number, owner?: number }) => { promise: Promise<object | null>, cancel: () => void } | null
+ * } | null}
+ */
+export function createNativeCoinSimulation(p, trials, seed) {
+  if (!provider || typeof provider.createCoinSimulation !== 'function') {
+    return null
+  }
+  const native = provider
+  const state = native.createCoinSimulation(p, trials, seed)
+  if (!state) {
+    return null
+  }
+  return {
+    step: (maxTrials) => native.coinSimulationStep(state, maxTrials),
+    schedule: ({ priority = JOB_PRIORITY.CHART, owner = 0 } = {}) => scheduleSimulation(native, 'coin', state, priority, owner, () => native.coinSimulationStep(state, 0)),
+  }
+}
+
+/**
+ * Native chunked poker deal (sim_poker_* in monte_carlo.h), or null without a
+ * native provider. counts is keyed by category ('high_card' .. 'straight_flush').
+ * Throws RangeError for a hand size outside 5..7.
+ * @returns {{
+ *   step: (maxTrials: number) => {
+ *     done: number, total: number, counts: Object<string, number>, finished: boolean
+ *   },
+ *   schedule: (options?: { priority?: number, owner?: number }) => { promise: Promise<object | null>, cancel: () => void } | null
+ * } | null}
+ */
+export function createNativePokerSimulation(handSize, trials, seed) {
+  if (!provider || typeof provider.createPokerSimulation !== 'function') {
+    return null
+  }
+  const native = provider
+  const state = native.createPokerSimulation(handSize, trials, seed)
+  if (!state) {
+    return null
+  }
+  return {
+    step: (maxTrials) => native.pokerSimulationStep(state, maxTrials),
+    schedule: ({ priority = JOB_PRIORITY.CHART, owner = 0 } = {}) => scheduleSimulation(native, 'poker', state, priority, owner, () => native.pokerSimulationStep(state, 0)),
+  }
+}
+
+/**
+ * Parses a comma, semicolon or whitespace separated list of decimals in one
+ * native pass (decimal_parser.h), or null without a native provider. Bad
+ * fields are left out of values and reported with their offset and length.
+ * @param {string} text
+ * @returns {{
+ *   values: Float64Array,
+ *   errors: { offset: number, length: number, status: 'syntax' | 'range' | 'empty' | 'too_long' }[]
+ * } | null}
+ */
+export function nativeParseNumbers(text) {
+  if (!provider || typeof provider.parseNumbers !== 'function') {
+    return null
+  }
+  return provider.parseNumbers(text) || null
+}
+
+/**
+ * The native hot-path trace ring and loop counters, or null without a native
+ * provider. Pass reset to clear them after reading, e.g. before reproducing
+ * a slow screen.
+ * @param {boolean} [reset]
+ * @returns {TraceDump | null}
+ */
+export function nativeTraceDump(reset = false) {
+  if (!provider || typeof provider.traceDump !== 'function') {
+    return null
+  }
+  return provider.traceDump(reset) || null
+}
+
+/**
+ * Native chunked resampling run (resample_* in resampling.h), or null without
+ * a native provider. kind is 'bootstrap' (mean, or mean difference with
+ * sample2) or 'permutation' (two-sided test of the mean difference). Each step
+ * runs up to maxResamples more, returning early after budgetMs; permutation
+ * runs also finish once the p-value is clearly on one side of alpha.
+ * interval() gives the bootstrap percentile interval so far, null for
+ * permutation runs. Throws RangeError for invalid samples or counts.
+ * @param {'bootstrap' | 'permutation'} kind
+ * @param {{ sample1: number[], sample2?: number[], maxResamples: number, alpha?: number, seed: number }} options
+ * @returns {{
+ *   step: (maxResamples: number, budgetMs?: number) => {
+ *     done: number, total: number, observed: number, finished: boolean,
+ *     pValue?: number, pLower?: number, pUpper?: number, decided?: boolean
+ *   },
+ *   interval: (level?: number) => { lower: number, upper: number, standardError: number } | null,
+ *   schedule: (options?: { priority?: number, owner?: number }) => { promise: Promise<object | null>, cancel: () => void } | null
+ * } | null}
+ */
+export function createNativeResampling(kind, options) {
+  if (!provider || typeof provider.createResampling !== 'function') {
+    return null
+  }
+  const native = provider
+  const state = native.createResampling(kind, options)
+  if (!state) {
+    return null
+  }
+  return {
+    step: (maxResamples, budgetMs = 0) => native.resamplingStep(state, maxResamples, budgetMs),
+    interval: (level = 0.95) => native.resamplingInterval(state, level),
+    schedule: ({ priority = JOB_PRIORITY.CHART, owner = 0 } = {}) => scheduleSimulation(native, 'resampling', state, priority, owner, () => native.resamplingStep(state, 0)),
+  }
+}
+
 /**
  * @param {{
  *   namespace?: string,
  *   capacityPages?: number,
  *   pageSize?: number,
+ *   compressThreshold?: number,
+ *   policy?: 'clock' | 'cost',
+ *   lazy?: boolean,
  *   serialize?: (value: any) => string,
  *   deserialize?: (serialized: string) => any
  * }} options
@@ -46,6 +975,9 @@ export function createBackend({
   namespace = 'default',
   capacityPages = 256,
   pageSize = 4096,
+  compressThreshold = 0,
+  policy = 'clock',
+  lazy = false,
   serialize = JSON.stringify,
   deserialize = JSON.parse,
 } = {}) {
@@ -57,6 +989,9 @@ export function createBackend({
     namespace,
     capacityPages,
     pageSize,
+    compressThreshold,
+    policy,
+    lazy,
   })
 
   if (!handle) {
@@ -73,9 +1008,78 @@ export function createBackend({
       return deserialize(result.serializedValue)
     },
 
-    /** @param {number|string} key @param {any} value */
-    set(key, value) {
-      provider.set(handle, String(key), serialize(value))
+    /** @param {number|string} key @param {any} value @param {number} [cost] */
+    set(key, value, cost) {
+      provider.set(handle, String(key), serialize(value), cost)
+    },
+
+    /**
+     * Raw bytes without JSON. On a native binding the result views the cached
+     * page, which stays pinned until the buffer is collected: read it, then
+     * drop it. Treat it as read-only.
+     * @param {number|string} key
+     */
+    getBuffer(key) {
+      if (typeof provider.getBuffer === 'function') {
+        return provider.getBuffer(handle, String(key))
+      }
+      const result = provider.get(handle, String(key))
+      if (!result || !result.hit || typeof result.serializedValue !== 'string') {
+        return null
+      }
+      return new Uint8Array(JSON.parse(result.serializedValue)).buffer
+    },
+
+    /** @param {number|string} key @param {ArrayBuffer|ArrayBufferView} bytes @param {number} [cost] */
+    setBuffer(key, bytes, cost) {
+      if (typeof provider.setBuffer === 'function') {
+        provider.setBuffer(handle, String(key), bytes, cost)
+        return
+      }
+      const view = ArrayBuffer.isView(bytes)
+        ? new Uint8Array(bytes.buffer, bytes.byteOffset, bytes.byteLength)
+        : new Uint8Array(bytes)
+      provider.set(handle, String(key), JSON.stringify(Array.from(view)), cost)
+    },
+
+    /**
+     * One native crossing per batch; values in key order, null for misses.
+     * @param {Array<number|string>} keys
+     */
+    getMany(keys) {
+      const names = keys.map(String)
+      if (typeof provider.getMany !== 'function') {
+        return names.map((key) => this.get(key))
+      }
+      return inBatches(names, (slice) => provider.getMany(handle, slice)).map((serialized) =>
+        typeof serialized === 'string' ? deserialize(serialized) : null
+      )
+    },
+
+    /** @param {Array<number|string>} keys @param {any[]} values @param {number[]} [costs] */
+    setMany(keys, values, costs) {
+      const names = keys.map(String)
+      if (typeof provider.setMany !== 'function') {
+        names.forEach((key, index) => this.set(key, values[index], costs ? costs[index] : undefined))
+        return
+      }
+      inBatches(names, (slice, start) => {
+        provider.setMany(
+          handle,
+          slice,
+          values.slice(start, start + slice.length).map((value) => serialize(value)),
+          costs ? costs.slice(start, start + slice.length) : undefined
+        )
+      })
+    },
+
+    /** @param {Array<number|string>} keys */
+    hasMany(keys) {
+      const names = keys.map(String)
+      if (typeof provider.hasMany !== 'function') {
+        return names.map((key) => this.has(key))
+      }
+      return inBatches(names, (slice) => provider.hasMany(handle, slice))
     },
 
     /** @param {number|string} key */
@@ -92,6 +1096,25 @@ export function createBackend({
       }
     },
 
+    /**
+     * Changes capacity in place, keeping warm entries; false when the
+     * provider cannot (no resize, a pinned page, bad size), and the caller
+     * falls back to a new cache.
+     * @param {number} capacityPages
+     */
+    resize(capacityPages) {
+      return typeof provider.resize === 'function' && provider.resize(handle, capacityPages) === true
+    },
+
+    /** Bumps the cache generation; falls back to clear on providers without it */
+    invalidate() {
+      if (typeof provider.invalidate === 'function') {
+        provider.invalidate(handle)
+      } else {
+        this.clear()
+      }
+    },
+
     /** @param {number|string} key */
     pin(key) {
       if (typeof provider.pin === 'function') {
@@ -120,6 +1143,11 @@ export function createBackend({
       }
     },
 
+    /** @returns {CacheMetrics | null} */
+    metrics() {
+      return typeof provider.metrics === 'function' ? provider.metrics(handle) || null : null
+    },
+
     get size() {
       const result = typeof provider.stats === 'function' ? provider.stats(handle) : null
       return result && typeof result.entries === 'number' ? result.entries : 0
@@ -0,0 +1,588 @@
+/*
+ * Host benchmark: the same workloads through the JS engines, the native
+ * kernels and the cache bridge.
+ *
+ * Usage: bridge_benchmark [sweeps] [repo-root]
+ *
+ * Every line on stdout is one JSON object, so runs from different releases
+ * can be diffed or loaded into a tracker. The first line describes the run;
+ * each following line is one measurement:
+ *
+ *   {"suite":"calc","workload":"tDistribution","path":"orchestrator",
+ *    "ops":20200,"nsPerOp":412.5,"checksum":10149.7}
+ *
+ * An op is one PDF/PMF + CDF evaluation (calc), one lookup or store (cache)
+ * or one test (hypothesis). checksum folds the results, so paths that agree
+ * print the same value and a dead-code-eliminated loop shows up as 0.
+ *
+ * Paths:
+ *   kernel        distribution_t pdf/cdf, no validation or preparation reuse
+ *   orchestrator  orchestrator_calculate_with_request (result cache off)
+ *   direct        cache_bridge_*_by_id, as the QuickJS provider calls them
+ *   invokeJson    cache_bridge_invoke, request built and response parsed
+ *   invokeBinary  cache_bridge_invoke_binary frames
+ *   js            distribution_engine.js / hypothesis_engine.js, no provider
+ *   jsDirect      the same modules over the QuickJS direct provider
+ *   jsInvoke      the same modules over provider.js's invoke bridge
+ *
+ * The js* paths need QuickJS and run in the bridge_benchmark_quickjs
+ * variant, which the build adds when it finds quickjs.h and libquickjs.
+ * They load src/common/cache/bridge_benchmark.js and the engines from
+ * repo-root (default "."), and bare imports such as jstat from
+ * repo-root/node_modules.
+ *
+ * Build from the repo root:
+ *   cmake -S . -B build && cmake --build build
+ */
+
+#include "bridge.h"
+#include "qjs.h"
+#include "../../../legacy/calc/engine/calculation_orchestrator.h"
+#include "../../../legacy/core/distributions/lib/distribution_interface.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_SWEEPS 200
+#define BENCH_POINTS 101
+#define BENCH_CACHE_KEYS 64
+#define BENCH_CACHE_VALUE_LEN 48
+#define BENCH_REQUEST_LEN 512
+
+typedef struct {
+    const char *name; /* also the DistributionCalculator method, called as name(...params, x) */
+    distribution_type_t type;
+    double params[MAX_PARAMETERS];
+    int param_count;
+    double x_min;
+    double x_max;
+} bench_workload_t;
+
+/* Nothing here builds chart data, so every path does the same work per op */
+static const bench_workload_t bench_workloads[] = {
+    { "hypergeometric", DIST_HYPERGEOMETRIC, { 500.0, 200.0, 100.0 }, 3, 0.0, 100.0 },
+    { "negativeBinomial", DIST_NEGATIVE_BINOMIAL, { 10.0, 0.3 }, 2, 0.0, 100.0 },
+    { "chiSquareDistribution", DIST_CHI_SQUARE, { 10.0 }, 1, 0.0, 40.0 },
+    { "tDistribution", DIST_T_DISTRIBUTION, { 7.0 }, 1, -6.0, 6.0 },
+    { "fDistribution", DIST_F_DISTRIBUTION, { 5.0, 12.0 }, 2, 0.0, 6.0 },
+    { "betaDistribution", DIST_BETA, { 2.5, 4.0 }, 2, 0.0, 1.0 },
+    { "gammaDistribution", DIST_GAMMA, { 3.0, 2.0 }, 2, 0.0, 30.0 }
+};
+
+#define BENCH_WORKLOAD_COUNT (sizeof(bench_workloads) / sizeof(bench_workloads[0]))
+
+static double bench_now_ns(void) {
+    struct timespec now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        return 0.0;
+    }
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static double bench_point(const bench_workload_t *workload, size_t i) {
+    return workload->x_min + (workload->x_max - workload->x_min) * (double)i / (double)(BENCH_POINTS - 1);
+}
+
+static void bench_report(const char *suite, const char *workload, const char *path,
+                         size_t ops, double elapsed_ns, double checksum) {
+    printf("{\"suite\":\"%s\",\"workload\":\"%s\",\"path\":\"%s\",\"ops\":%zu,\"nsPerOp\":%.1f,\"checksum\":%.10g}\n",
+           suite, workload, path, ops, ops ? elapsed_ns / (double)ops : 0.0, checksum);
+}
+
+static void bench_calc_kernel(const bench_workload_t *workload, int sweeps) {
+    const distribution_t *distribution = get_distribution(workload->type);
+    double params[MAX_PARAMETERS];
+    double checksum = 0.0;
+    double start;
+    int sweep;
+    size_t i;
+
+    if (!distribution || !distribution->pdf || !distribution->cdf) {
+        return;
+    }
+
+    memcpy(params, workload->params, sizeof(params));
+    start = bench_now_ns();
+    for (sweep = 0; sweep < sweeps; ++sweep) {
+        for (i = 0; i < BENCH_POINTS; ++i) {
+            double x = bench_point(workload, i);
+            checksum += distribution->pdf(x, params, workload->param_count);
+            checksum += distribution->cdf(x, params, workload->param_count);
+        }
+    }
+    bench_report("calc", workload->name, "kernel", (size_t)sweeps * BENCH_POINTS, bench_now_ns() - start,
+                 checksum / sweeps);
+}
+
+static void bench_calc_orchestrator(const bench_workload_t *workload, int sweeps) {
+    calculation_request_t request;
+    calculation_result_t result;
+    double checksum = 0.0;
+    double start;
+    int sweep;
+    size_t i;
+
+    memset(&request, 0, sizeof(request));
+    request.distribution = workload->type;
+    memcpy(request.parameters, workload->params, sizeof(request.parameters));
+    request.param_count = (uint8_t)workload->param_count;
+
+    start = bench_now_ns();
+    for (sweep = 0; sweep < sweeps; ++sweep) {
+        for (i = 0; i < BENCH_POINTS; ++i) {
+            request.input_value = bench_point(workload, i);
+            if (orchestrator_calculate_with_request(&request, &result) == CALC_SUCCESS) {
+                checksum += result.pdf_result + result.cdf_result;
+            }
+        }
+    }
+    bench_report("calc", workload->name, "orchestrator", (size_t)sweeps * BENCH_POINTS, bench_now_ns() - start,
+                 checksum / sweeps);
+}
+
+/* Reads the number after "key": in a JSON response, 0 when absent */
+static double bench_json_number(const char *json, const char *key) {
+    const char *cursor = json ? strstr(json, key) : NULL;
+
+    if (!cursor || !(cursor = strchr(cursor + strlen(key), ':'))) {
+        return 0.0;
+    }
+    return strtod(cursor + 1, NULL);
+}
+
+static void bench_calc_invoke(const bench_workload_t *workload, int sweeps) {
+    char request[BENCH_REQUEST_LEN];
+    char params[BENCH_REQUEST_LEN];
+    size_t used = 0;
+    double checksum = 0.0;
+    double start;
+    int sweep;
+    int p;
+    size_t i;
+
+    for (p = 0; p < workload->param_count; ++p) {
+        used += (size_t)snprintf(params + used, sizeof(params) - used, "%s%.17g", p ? "," : "", workload->params[p]);
+    }
+
+    start = bench_now_ns();
+    for (sweep = 0; sweep < sweeps; ++sweep) {
+        for (i = 0; i < BENCH_POINTS; ++i) {
+            const char *response;
+            int length = snprintf(request, sizeof(request),
+                                  "{\"distribution\":%d,\"parameters\":[%s],\"input_value\":%.17g}",
+                                  (int)workload->type, params, bench_point(workload, i));
+
+            if (length < 0 || (size_t)length >= sizeof(request)) {
+                continue;
+            }
+            response = cache_bridge_invoke("calc.calculate", request);
+            checksum += bench_json_number(response, "\"pdf_result\"") + bench_json_number(response, "\"cdf_result\"");
+        }
+    }
+    bench_report("calc", workload->name, "invokeJson", (size_t)sweeps * BENCH_POINTS, bench_now_ns() - start,
+                 checksum / sweeps);
+}
+
+static size_t bench_frame(uint8_t *frame, size_t capacity, cache_bridge_op_t op, cache_bridge_id_t id,
+                          const char *key, const char *value) {
+    size_t key_len = strlen(key);
+    size_t value_len = value ? strlen(value) : 0;
+    size_t length = CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN + sizeof(id) + key_len + value_len;
+
+    if (length > capacity) {
+        return 0;
+    }
+
+    memset(frame, 0, CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN);
+    frame[0] = (uint8_t)op;
+    frame[1] = CACHE_BRIDGE_FRAME_FLAG_HANDLE_ID;
+    frame[2] = (uint8_t)sizeof(id);
+    frame[4] = (uint8_t)(key_len & 0xff);
+    frame[5] = (uint8_t)(key_len >> 8);
+    frame[8] = (uint8_t)(value_len & 0xff);
+    frame[9] = (uint8_t)(value_len >> 8);
+    frame[16] = (uint8_t)(id & 0xff);
+    frame[17] = (uint8_t)((id >> 8) & 0xff);
+    frame[18] = (uint8_t)((id >> 16) & 0xff);
+    frame[19] = (uint8_t)(id >> 24);
+    memcpy(frame + CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN + sizeof(id), key, key_len);
+    if (value_len) {
+        memcpy(frame + CACHE_BRIDGE_FRAME_REQUEST_HEADER_LEN + sizeof(id) + key_len, value, value_len);
+    }
+    return length;
+}
+
+static void bench_cache(int sweeps) {
+    static const char *paths[] = { "direct", "invokeJson", "invokeBinary" };
+    char keys[BENCH_CACHE_KEYS][16];
+    char value[BENCH_CACHE_VALUE_LEN + 1];
+    char request[BENCH_REQUEST_LEN];
+    uint8_t frame[BENCH_REQUEST_LEN];
+    uint8_t out[BENCH_REQUEST_LEN];
+    const char *handle;
+    cache_bridge_id_t id;
+    size_t path;
+    int set;
+    size_t k;
+
+    memset(value, 'v', BENCH_CACHE_VALUE_LEN);
+    value[BENCH_CACHE_VALUE_LEN] = '\0';
+    for (k = 0; k < BENCH_CACHE_KEYS; ++k) {
+        snprintf(keys[k], sizeof(keys[k]), "p%zu", k);
+    }
+
+    handle = cache_bridge_create_service("bench", BENCH_CACHE_KEYS * 2, 256);
+    id = handle ? cache_bridge_handle_id(handle) : CACHE_BRIDGE_INVALID_ID;
+    if (id == CACHE_BRIDGE_INVALID_ID) {
+        fprintf(stderr, "bridge_benchmark: cannot create the cache\n");
+        return;
+    }
+
+    for (set = 1; set >= 0; --set) {
+        for (path = 0; path < sizeof(paths) / sizeof(paths[0]); ++path) {
+            double checksum = 0.0;
+            double start = bench_now_ns();
+            int sweep;
+
+            for (sweep = 0; sweep < sweeps; ++sweep) {
+                for (k = 0; k < BENCH_CACHE_KEYS; ++k) {
+                    size_t len = sizeof(out);
+                    const uint8_t *response;
+                    size_t frame_len;
+
+                    if (path == 0) {
+                        checksum += set
+                            ? cache_bridge_set_value_cost_by_id(id, keys[k], (const uint8_t *)value, BENCH_CACHE_VALUE_LEN, 0) == 0
+                            : cache_bridge_get_value_by_id(id, keys[k], out, &len) == 0;
+                    } else if (path == 1) {
+                        int length = set
+                            ? snprintf(request, sizeof(request), "{\"handle\":%u,\"key\":\"%s\",\"serializedValue\":\"%s\"}",
+                                       (unsigned)id, keys[k], value)
+                            : snprintf(request, sizeof(request), "{\"handle\":%u,\"key\":\"%s\"}", (unsigned)id, keys[k]);
+
+                        if (length > 0 && (size_t)length < sizeof(request)) {
+                            checksum += strstr(cache_bridge_invoke(set ? "cache.set" : "cache.get", request),
+                                               set ? "\"ok\":true" : "\"hit\":true") != NULL;
+                        }
+                    } else {
+                        frame_len = bench_frame(frame, sizeof(frame), set ? CACHE_BRIDGE_OP_SET : CACHE_BRIDGE_OP_GET,
+                                                id, keys[k], set ? value : NULL);
+                        response = cache_bridge_invoke_binary(frame, frame_len, &len);
+                        checksum += response && len >= CACHE_BRIDGE_FRAME_RESPONSE_HEADER_LEN &&
+                                    response[0] == CACHE_BRIDGE_STATUS_OK;
+                    }
+                }
+            }
+            bench_report("cache", set ? "set" : "get", paths[path], (size_t)sweeps * BENCH_CACHE_KEYS,
+                         bench_now_ns() - start, checksum / sweeps);
+        }
+    }
+
+    cache_bridge_destroy_service(handle);
+}
+
+#if defined(CACHE_HAS_QUICKJS)
+
+typedef struct {
+    const char *root;
+} bench_js_context_t;
+
+static char *bench_read_file(const char *path, size_t *out_len) {
+    FILE *file = fopen(path, "rb");
+    char *data = NULL;
+    long size;
+
+    if (!file) {
+        return NULL;
+    }
+    if (fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0 &&
+        (data = (char *)malloc((size_t)size + 1)) != NULL) {
+        if (fread(data, 1, (size_t)size, file) != (size_t)size) {
+            free(data);
+            data = NULL;
+        } else {
+            data[size] = '\0';
+            *out_len = (size_t)size;
+        }
+    }
+    fclose(file);
+    return data;
+}
+
+/*
+ * Loads a module by path, trying a ".js" suffix for extensionless imports.
+ * Bare names resolve to root/node_modules/<name>, through package.json's
+ * "main"; those are CommonJS/UMD builds, so they are wrapped to export
+ * module.exports as the default.
+ */
+static JSModuleDef *bench_load_module(JSContext *ctx, const char *module_name, void *opaque) {
+    const bench_js_context_t *bench = (const bench_js_context_t *)opaque;
+    char path[1024];
+    char *source = NULL;
+    size_t length = 0;
+    int commonjs = 0;
+    JSValue compiled;
+    JSModuleDef *module;
+
+    if (module_name[0] == '/' || module_name[0] == '.') {
+        snprintf(path, sizeof(path), "%s", module_name);
+        source = bench_read_file(path, &length);
+        if (!source) {
+            snprintf(path, sizeof(path), "%s.js", module_name);
+            source = bench_read_file(path, &length);
+        }
+    } else {
+        char main_file[256] = "index.js";
+        char *package;
+        const char *cursor;
+
+        snprintf(path, sizeof(path), "%s/node_modules/%s/package.json", bench->root, module_name);
+        package = bench_read_file(path, &length);
+        cursor = package ? strstr(package, "\"main\"") : NULL;
+        if (cursor && (cursor = strchr(cursor + 6, '"')) != NULL) {
+            const char *end = strchr(cursor + 1, '"');
+            if (end && (size_t)(end - cursor - 1) < sizeof(main_file)) {
+                memcpy(main_file, cursor + 1, (size_t)(end - cursor - 1));
+                main_file[end - cursor - 1] = '\0';
+            }
+        }
+        free(package);
+
+        snprintf(path, sizeof(path), "%s/node_modules/%s/%s", bench->root, module_name, main_file);
+        source = bench_read_file(path, &length);
+        commonjs = 1;
+    }
+
+    if (!source) {
+        JS_ThrowReferenceError(ctx, "could not load module '%s'", module_name);
+        return NULL;
+    }
+
+    if (commonjs) {
+        static const char prefix[] = "const module = { exports: {} }; const exports = module.exports;\n";
+        static const char suffix[] = "\nexport default module.exports;\n";
+        char *wrapped = (char *)malloc(sizeof(prefix) + length + sizeof(suffix));
+
+        if (!wrapped) {
+            free(source);
+            JS_ThrowOutOfMemory(ctx);
+            return NULL;
+        }
+        memcpy(wrapped, prefix, sizeof(prefix) - 1);
+        memcpy(wrapped + sizeof(prefix) - 1, source, length);
+        memcpy(wrapped + sizeof(prefix) - 1 + length, suffix, sizeof(suffix));
+        length += sizeof(prefix) - 1 + sizeof(suffix) - 1;
+        free(source);
+        source = wrapped;
+    }
+
+    compiled = JS_Eval(ctx, source, length, module_name, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+    free(source);
+    if (JS_IsException(compiled)) {
+        return NULL;
+    }
+    module = (JSModuleDef *)JS_VALUE_GET_PTR(compiled);
+    JS_FreeValue(ctx, compiled);
+    return module;
+}
+
+static JSValue bench_js_now(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+    return JS_NewFloat64(ctx, bench_now_ns());
+}
+
+/* report(line): one measurement, already JSON-encoded by the driver */
+static JSValue bench_js_report(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    const char *line;
+
+    (void)this_val;
+
+    if (argc < 1 || (line = JS_ToCString(ctx, argv[0])) == NULL) {
+        return JS_EXCEPTION;
+    }
+    printf("%s\n", line);
+    JS_FreeCString(ctx, line);
+    return JS_UNDEFINED;
+}
+
+/* invoke(method, paramsJson): the JSON bridge, for provider.js's invoke-bridge provider */
+static JSValue bench_js_invoke(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    const char *method;
+    const char *params;
+    JSValue result;
+
+    (void)this_val;
+
+    if (argc < 2 || (method = JS_ToCString(ctx, argv[0])) == NULL) {
+        return JS_EXCEPTION;
+    }
+    if ((params = JS_ToCString(ctx, argv[1])) == NULL) {
+        JS_FreeCString(ctx, method);
+        return JS_EXCEPTION;
+    }
+    result = JS_NewString(ctx, cache_bridge_invoke(method, params));
+    JS_FreeCString(ctx, params);
+    JS_FreeCString(ctx, method);
+    return result;
+}
+
+/* invokeBinary(frame): the framed bridge; answers with a copy of the response frame */
+static JSValue bench_js_invoke_binary(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    const uint8_t *response;
+    uint8_t *request;
+    size_t request_len = 0;
+    size_t response_len = 0;
+
+    (void)this_val;
+
+    if (argc < 1 || (request = JS_GetArrayBuffer(ctx, &request_len, argv[0])) == NULL) {
+        return JS_ThrowTypeError(ctx, "Expected an ArrayBuffer frame");
+    }
+    response = cache_bridge_invoke_binary(request, request_len, &response_len);
+    return response ? JS_NewArrayBufferCopy(ctx, response, response_len) : JS_NULL;
+}
+
+static void bench_js_dump_exception(JSContext *ctx) {
+    JSValue exception = JS_GetException(ctx);
+    const char *message = JS_ToCString(ctx, exception);
+
+    fprintf(stderr, "bridge_benchmark: %s\n", message ? message : "exception");
+    JS_FreeCString(ctx, message);
+    JS_FreeValue(ctx, exception);
+}
+
+/* The workload table as JSON, so the driver runs exactly what the C paths ran */
+static char *bench_workloads_json(void) {
+    size_t capacity = 2048;
+    char *json = (char *)malloc(capacity);
+    size_t used = 0;
+    size_t w;
+    int p;
+
+    if (!json) {
+        return NULL;
+    }
+
+    used += (size_t)snprintf(json + used, capacity - used, "[");
+    for (w = 0; w < BENCH_WORKLOAD_COUNT; ++w) {
+        const bench_workload_t *workload = &bench_workloads[w];
+
+        used += (size_t)snprintf(json + used, capacity - used, "%s{\"name\":\"%s\",\"params\":[", w ? "," : "",
+                                 workload->name);
+        for (p = 0; p < workload->param_count; ++p) {
+            used += (size_t)snprintf(json + used, capacity - used, "%s%.17g", p ? "," : "", workload->params[p]);
+        }
+        used += (size_t)snprintf(json + used, capacity - used, "],\"xMin\":%.17g,\"xMax\":%.17g}",
+                                 workload->x_min, workload->x_max);
+    }
+    snprintf(json + used, capacity - used, "]");
+    return json;
+}
+
+static int bench_js(const char *root, int sweeps) {
+    static const char driver[] =
+        "import { runBenchmarks } from './src/common/cache/bridge_benchmark.js';\n"
+        "runBenchmarks(globalThis.__bench);\n";
+    bench_js_context_t bench = { root };
+    char driver_name[1024];
+    char *workloads;
+    JSRuntime *runtime;
+    JSContext *ctx;
+    JSContext *job_ctx;
+    JSValue global_obj;
+    JSValue host;
+    JSValue result;
+    int rc = 0;
+
+    runtime = JS_NewRuntime();
+    ctx = runtime ? JS_NewContext(runtime) : NULL;
+    workloads = bench_workloads_json();
+    if (!ctx || !workloads) {
+        free(workloads);
+        if (runtime) {
+            JS_FreeRuntime(runtime);
+        }
+        return -1;
+    }
+    JS_SetModuleLoaderFunc(runtime, NULL, bench_load_module, &bench);
+
+    global_obj = JS_GetGlobalObject(ctx);
+    host = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, host, "now", JS_NewCFunction(ctx, bench_js_now, "now", 0));
+    JS_SetPropertyStr(ctx, host, "report", JS_NewCFunction(ctx, bench_js_report, "report", 1));
+    JS_SetPropertyStr(ctx, host, "invoke", JS_NewCFunction(ctx, bench_js_invoke, "invoke", 2));
+    JS_SetPropertyStr(ctx, host, "invokeBinary", JS_NewCFunction(ctx, bench_js_invoke_binary, "invokeBinary", 1));
+    JS_SetPropertyStr(ctx, host, "sweeps", JS_NewInt32(ctx, sweeps));
+    JS_SetPropertyStr(ctx, host, "points", JS_NewInt32(ctx, BENCH_POINTS));
+    JS_SetPropertyStr(ctx, host, "cacheKeys", JS_NewInt32(ctx, BENCH_CACHE_KEYS));
+    JS_SetPropertyStr(ctx, host, "cacheValueLength", JS_NewInt32(ctx, BENCH_CACHE_VALUE_LEN));
+    JS_SetPropertyStr(ctx, host, "workloads", JS_NewString(ctx, workloads));
+    JS_SetPropertyStr(ctx, global_obj, "__bench", host);
+    JS_FreeValue(ctx, global_obj);
+    free(workloads);
+
+    /* The direct provider goes on __velaCacheProvider; the driver takes it off
+     * again before the js path, which must not find it */
+    if (cache_register_quickjs(ctx) != 0) {
+        fprintf(stderr, "bridge_benchmark: cannot register the QuickJS provider\n");
+        rc = -1;
+    } else {
+        /* Relative module names must start with '.' or the loader takes them for packages */
+        snprintf(driver_name, sizeof(driver_name), "%s%s/bridge_benchmark_driver.js",
+                 (root[0] == '/' || root[0] == '.') ? "" : "./", root);
+        result = JS_Eval(ctx, driver, sizeof(driver) - 1, driver_name, JS_EVAL_TYPE_MODULE);
+        if (JS_IsException(result)) {
+            bench_js_dump_exception(ctx);
+            rc = -1;
+        }
+        JS_FreeValue(ctx, result);
+        while (JS_ExecutePendingJob(runtime, &job_ctx) > 0) {
+        }
+    }
+
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(runtime);
+    return rc;
+}
+
+#endif
+
+int main(int argc, char **argv) {
+    int sweeps = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_SWEEPS;
+    const char *root = argc > 2 ? argv[2] : ".";
+    size_t w;
+    int quickjs = 0;
+
+    if (sweeps <= 0) {
+        fprintf(stderr, "usage: %s [sweeps] [repo-root]\n", argv[0]);
+        return 1;
+    }
+#if defined(CACHE_HAS_QUICKJS)
+    quickjs = 1;
+#endif
+
+    printf("{\"benchmark\":\"bridge_benchmark\",\"schema\":1,\"sweeps\":%d,\"points\":%d,\"cacheKeys\":%d,\"quickjs\":%s}\n",
+           sweeps, BENCH_POINTS, BENCH_CACHE_KEYS, quickjs ? "true" : "false");
+
+    orchestrator_disable_result_cache();
+    for (w = 0; w < BENCH_WORKLOAD_COUNT; ++w) {
+        bench_calc_kernel(&bench_workloads[w], sweeps);
+        bench_calc_orchestrator(&bench_workloads[w], sweeps);
+        bench_calc_invoke(&bench_workloads[w], sweeps);
+    }
+    bench_cache(sweeps);
+
+#if defined(CACHE_HAS_QUICKJS)
+    if (bench_js(root, sweeps) != 0) {
+        return 1;
+    }
+#else
+    (void)root;
+#endif
+    return 0;
+}
@@ -0,0 +1,138 @@
+import { DistributionCalculator } from '../distribution_engine.js'
+import HypothesisEngine from '../hypothesis_engine.js'
+import CacheService from './cache.js'
+import { registerProvider } from './bridge.js'
+import { installVelaProvider } from './provider.js'
+
+/**
+ * QuickJS half of bridge_benchmark.c. Host-only: nothing in the app imports
+ * this module. The C driver passes `__bench` with a nanosecond clock, a
+ * line reporter, the JSON invoke entry points and the calc workload table,
+ * and the lines printed here follow the same schema as the native paths.
+ *
+ * Each suite runs three times: with no provider (the JS fallbacks), over the
+ * QuickJS direct provider, and over provider.js's invoke bridge. The native
+ * orchestrator's result cache stays off, so repeated sweeps are recomputed.
+ */
+
+const HYPOTHESIS_WORKLOADS = [
+  ['zTestOneSample', { mean: 5.2, n: 40, sigma: 1.5, mu0: 5 }],
+  ['tTestOneSample', { mean: 5.2, n: 40, s: 1.5, mu0: 5 }],
+  ['tTestTwoSample', { mean1: 5.2, n1: 40, s1: 1.5, mean2: 4.8, n2: 35, s2: 1.7 }],
+  ['fTestTwoSample', { s1: 1.5, n1: 40, s2: 1.7, n2: 35 }],
+]
+
+/**
+ * @param {any} bench @param {string} suite @param {string} workload @param {string} path
+ * @param {number} ops @param {number} elapsedNs @param {number} checksum
+ */
+function report(bench, suite, workload, path, ops, elapsedNs, checksum) {
+  bench.report(
+    JSON.stringify({
+      suite,
+      workload,
+      path,
+      ops,
+      nsPerOp: ops ? Math.round((elapsedNs / ops) * 10) / 10 : 0,
+      checksum: Number(checksum.toPrecision(10)),
+    })
+  )
+}
+
+/** @param {any} bench @param {string} path @param {Array<{ name: string, params: number[], xMin: number, xMax: number }>} workloads */
+function runCalc(bench, path, workloads) {
+  const points = bench.points
+  const sweeps = bench.sweeps
+
+  for (const workload of workloads) {
+    const method = DistributionCalculator[workload.name]
+    const args = workload.params.concat([0])
+    const last = args.length - 1
+    const step = (workload.xMax - workload.xMin) / (points - 1)
+    let checksum = 0
+
+    const start = bench.now()
+    for (let sweep = 0; sweep < sweeps; sweep++) {
+      for (let i = 0; i < points; i++) {
+        args[last] = workload.xMin + step * i
+        const result = method.apply(DistributionCalculator, args)
+        if (result.success) {
+          checksum += result.pdfResult + result.cdfResult
+        }
+      }
+    }
+    report(bench, 'calc', workload.name, path, sweeps * points, bench.now() - start, checksum / sweeps)
+  }
+}
+
+/** @param {any} bench @param {string} path */
+function runCache(bench, path) {
+  const keys = bench.cacheKeys
+  const sweeps = bench.sweeps
+  const value = 'v'.repeat(bench.cacheValueLength)
+  const cache = new CacheService({ namespace: `bench:${path}`, capacityPages: keys * 2 })
+
+  for (const set of [true, false]) {
+    let checksum = 0
+
+    const start = bench.now()
+    for (let sweep = 0; sweep < sweeps; sweep++) {
+      for (let key = 0; key < keys; key++) {
+        if (set) {
+          cache.set(key, value)
+          checksum++
+        } else if (cache.get(key) === value) {
+          checksum++
+        }
+      }
+    }
+    report(bench, 'cache', set ? 'set' : 'get', path, sweeps * keys, bench.now() - start, checksum / sweeps)
+  }
+  cache.destroy()
+}
+
+/** @param {any} bench @param {string} path */
+function runHypothesis(bench, path) {
+  const sweeps = bench.sweeps * 10
+
+  for (const [name, options] of HYPOTHESIS_WORKLOADS) {
+    let checksum = 0
+
+    const start = bench.now()
+    for (let sweep = 0; sweep < sweeps; sweep++) {
+      const result = HypothesisEngine[name](options)
+      checksum += result.pValueTwoTail || 0
+    }
+    report(bench, 'hypothesis', name, path, sweeps, bench.now() - start, checksum / sweeps)
+  }
+}
+
+/** @param {any} bench */
+export function runBenchmarks(bench) {
+  const workloads = JSON.parse(bench.workloads)
+  const direct = globalThis.__velaCacheProvider
+  const paths = [
+    ['js', null],
+    ['jsDirect', direct],
+    ['jsInvoke', { invoke: bench.invoke, invokeBinary: bench.invokeBinary }],
+  ]
+
+  // Keep the js path from binding to it through ensureVelaProvider
+  delete globalThis.__velaCacheProvider
+
+  try {
+    for (const [path, provider] of paths) {
+      registerProvider(null)
+      if (provider && !installVelaProvider(provider)) {
+        continue
+      }
+      runCalc(bench, path, workloads)
+      runCache(bench, path)
+      runHypothesis(bench, path)
+    }
+  } catch (error) {
+    bench.report(JSON.stringify({ error: String((error && error.stack) || error) }))
+  } finally {
+    registerProvider(null)
+  }
+}
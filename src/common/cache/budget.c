@@ -0,0 +1,288 @@
+#include "budget.h"
+
+#include "arena.h"
+#include "sync.h"
+#include "../../../legacy/core/math/math_utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    int in_use;
+    char name[CACHE_BUDGET_MAX_NAME_LEN];
+    cache_budget_class_t account_class;
+    cache_budget_usage_fn usage_fn;
+    cache_budget_trim_fn trim_fn;
+    void *context;
+} cache_budget_slot_t;
+
+static const char *const cache_budget_class_names[CACHE_BUDGET_CLASS_COUNT] = {
+    "prefetch", "results", "pages", "history", "tables"};
+
+static size_t cache_budget_arena_usage(void *context) {
+    (void)context;
+    return cache_arena_thread_count() * CACHE_ARENA_THREAD_BYTES;
+}
+
+/* The generated table and its lazy extension are static arrays: tracked, never freed */
+static size_t cache_budget_table_usage(void *context) {
+    (void)context;
+    return (size_t)log_factorial_cache_size() * sizeof(double);
+}
+
+static cache_budget_slot_t g_budget_slots[CACHE_BUDGET_MAX_ACCOUNTS] = {
+    {1, "cache.arenas", CACHE_BUDGET_CLASS_TABLES, cache_budget_arena_usage, NULL, NULL},
+    {1, "math.tables", CACHE_BUDGET_CLASS_TABLES, cache_budget_table_usage, NULL, NULL},
+};
+static cache_lock_t g_budget_lock = CACHE_LOCK_INITIALIZER;
+static size_t g_budget_limit;
+static size_t g_budget_peak;
+static uint64_t g_budget_trims;
+static uint64_t g_budget_trimmed_bytes;
+static uint64_t g_budget_pressure_events;
+/* Bumped lock-free by cache_budget_note_growth; g_budget_seen_growth is its value at the last enforce */
+static uint64_t g_budget_growth;
+static uint64_t g_budget_seen_growth;
+
+/* Caller holds the budget lock. */
+static size_t cache_budget_usage_locked(void) {
+    size_t usage = 0;
+    size_t i;
+
+    for (i = 0; i < CACHE_BUDGET_MAX_ACCOUNTS; ++i) {
+        if (g_budget_slots[i].in_use) {
+            usage += g_budget_slots[i].usage_fn(g_budget_slots[i].context);
+        }
+    }
+
+    if (usage > g_budget_peak) {
+        g_budget_peak = usage;
+    }
+    return usage;
+}
+
+/* Caller holds the budget lock. */
+static size_t cache_budget_trim_class_locked(cache_budget_class_t account_class, size_t bytes_wanted) {
+    size_t freed = 0;
+    size_t i;
+
+    for (i = 0; i < CACHE_BUDGET_MAX_ACCOUNTS && freed < bytes_wanted; ++i) {
+        cache_budget_slot_t *slot = &g_budget_slots[i];
+
+        if (slot->in_use && slot->trim_fn && slot->account_class == account_class) {
+            freed += slot->trim_fn(slot->context, bytes_wanted - freed);
+        }
+    }
+
+    return freed;
+}
+
+/* Caller holds the budget lock. */
+static size_t cache_budget_trim_locked(size_t target_bytes) {
+    size_t usage = cache_budget_usage_locked();
+    size_t freed = 0;
+    int c;
+
+    for (c = 0; c < CACHE_BUDGET_CLASS_COUNT && usage > target_bytes; ++c) {
+        size_t got = cache_budget_trim_class_locked((cache_budget_class_t)c, usage - target_bytes);
+
+        /* A trim may free more than asked: a whole segment, say */
+        usage = got < usage ? usage - got : 0;
+        freed += got;
+    }
+
+    if (freed > 0) {
+        g_budget_trims += 1;
+        g_budget_trimmed_bytes += freed;
+    }
+    return freed;
+}
+
+/* Caller holds the budget lock. */
+static size_t cache_budget_enforce_locked(void) {
+    size_t usage;
+
+    g_budget_seen_growth = cache_counter_load(&g_budget_growth);
+    if (g_budget_limit == 0) {
+        return 0;
+    }
+
+    usage = cache_budget_usage_locked();
+    if (usage <= g_budget_limit) {
+        return 0;
+    }
+    return cache_budget_trim_locked(g_budget_limit - g_budget_limit / 8);
+}
+
+int cache_budget_register(const char *name,
+                          cache_budget_class_t account_class,
+                          cache_budget_usage_fn usage_fn,
+                          cache_budget_trim_fn trim_fn,
+                          void *context) {
+    int id = -1;
+    int i;
+
+    if (!name || !usage_fn || (unsigned)account_class >= CACHE_BUDGET_CLASS_COUNT) {
+        return -1;
+    }
+
+    cache_lock_acquire(&g_budget_lock);
+    for (i = 0; i < CACHE_BUDGET_MAX_ACCOUNTS; ++i) {
+        cache_budget_slot_t *slot = &g_budget_slots[i];
+
+        if (slot->in_use) {
+            continue;
+        }
+
+        slot->in_use = 1;
+        snprintf(slot->name, sizeof(slot->name), "%s", name);
+        slot->account_class = account_class;
+        slot->usage_fn = usage_fn;
+        slot->trim_fn = trim_fn;
+        slot->context = context;
+        id = i;
+        break;
+    }
+    cache_lock_release(&g_budget_lock);
+
+    return id;
+}
+
+void cache_budget_unregister(int id) {
+    if (id < 0 || id >= CACHE_BUDGET_MAX_ACCOUNTS) {
+        return;
+    }
+
+    cache_lock_acquire(&g_budget_lock);
+    memset(&g_budget_slots[id], 0, sizeof(g_budget_slots[id]));
+    cache_lock_release(&g_budget_lock);
+}
+
+void cache_budget_set_limit(size_t limit_bytes) {
+    cache_lock_acquire(&g_budget_lock);
+    g_budget_limit = limit_bytes;
+    cache_budget_enforce_locked();
+    cache_lock_release(&g_budget_lock);
+}
+
+size_t cache_budget_limit(void) {
+    size_t limit;
+
+    cache_lock_acquire(&g_budget_lock);
+    limit = g_budget_limit;
+    cache_lock_release(&g_budget_lock);
+    return limit;
+}
+
+size_t cache_budget_usage(void) {
+    size_t usage;
+
+    cache_lock_acquire(&g_budget_lock);
+    usage = cache_budget_usage_locked();
+    cache_lock_release(&g_budget_lock);
+    return usage;
+}
+
+size_t cache_budget_trim(size_t target_bytes) {
+    size_t freed;
+
+    cache_lock_acquire(&g_budget_lock);
+    freed = cache_budget_trim_locked(target_bytes);
+    cache_lock_release(&g_budget_lock);
+    return freed;
+}
+
+size_t cache_budget_trim_class(cache_budget_class_t account_class, size_t bytes_wanted) {
+    size_t freed;
+
+    if ((unsigned)account_class >= CACHE_BUDGET_CLASS_COUNT) {
+        return 0;
+    }
+
+    cache_lock_acquire(&g_budget_lock);
+    freed = cache_budget_trim_class_locked(account_class, bytes_wanted);
+    if (freed > 0) {
+        g_budget_trims += 1;
+        g_budget_trimmed_bytes += freed;
+    }
+    cache_lock_release(&g_budget_lock);
+    return freed;
+}
+
+size_t cache_budget_enforce(void) {
+    size_t freed;
+
+    cache_lock_acquire(&g_budget_lock);
+    freed = cache_budget_enforce_locked();
+    cache_lock_release(&g_budget_lock);
+    return freed;
+}
+
+void cache_budget_note_growth(size_t bytes) {
+    cache_counter_add(&g_budget_growth, bytes);
+}
+
+void cache_budget_poll(void) {
+    cache_lock_acquire(&g_budget_lock);
+    if (g_budget_limit != 0 && cache_counter_load(&g_budget_growth) != g_budget_seen_growth) {
+        cache_budget_enforce_locked();
+    }
+    cache_lock_release(&g_budget_lock);
+}
+
+size_t cache_budget_pressure(cache_budget_pressure_t level) {
+    size_t freed;
+    size_t usage;
+
+    cache_lock_acquire(&g_budget_lock);
+    g_budget_pressure_events += 1;
+    usage = cache_budget_usage_locked();
+    freed = cache_budget_trim_locked(level == CACHE_BUDGET_PRESSURE_CRITICAL ? 0 : usage - usage / 4);
+    cache_lock_release(&g_budget_lock);
+    return freed;
+}
+
+int cache_budget_stats(cache_budget_stats_t *out_stats) {
+    size_t i;
+
+    if (!out_stats) {
+        return -1;
+    }
+
+    memset(out_stats, 0, sizeof(*out_stats));
+    cache_lock_acquire(&g_budget_lock);
+    for (i = 0; i < CACHE_BUDGET_MAX_ACCOUNTS; ++i) {
+        const cache_budget_slot_t *slot = &g_budget_slots[i];
+        cache_budget_account_t *account = &out_stats->accounts[out_stats->account_count];
+
+        if (!slot->in_use) {
+            continue;
+        }
+
+        memcpy(account->name, slot->name, sizeof(account->name));
+        account->account_class = slot->account_class;
+        account->bytes = slot->usage_fn(slot->context);
+        account->trimmable = slot->trim_fn != NULL;
+        out_stats->usage += account->bytes;
+        out_stats->account_count += 1;
+    }
+
+    if (out_stats->usage > g_budget_peak) {
+        g_budget_peak = out_stats->usage;
+    }
+    out_stats->limit = g_budget_limit;
+    out_stats->peak_usage = g_budget_peak;
+    out_stats->trims = g_budget_trims;
+    out_stats->trimmed_bytes = g_budget_trimmed_bytes;
+    out_stats->pressure_events = g_budget_pressure_events;
+    cache_lock_release(&g_budget_lock);
+
+    return 0;
+}
+
+const char *cache_budget_class_name(cache_budget_class_t account_class) {
+    if ((unsigned)account_class >= CACHE_BUDGET_CLASS_COUNT) {
+        return "unknown";
+    }
+    return cache_budget_class_names[account_class];
+}
@@ -0,0 +1,114 @@
+#ifndef CACHE_BUDGET_H
+#define CACHE_BUDGET_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Process-wide native memory budget.
+ *
+ * Each owner of long-lived native memory (page caches, the calculation
+ * result cache, the history store, the thread arenas and the math tables)
+ * registers an account with a usage callback and, if it can shrink, a trim
+ * callback. With a limit set, cache_budget_enforce trims accounts class by
+ * class, cheapest to rebuild first, until usage is back under the limit; a
+ * pressure signal from the JS side trims the same way without a limit. The
+ * page-cache trims themselves are cost-aware (page_cache_trim).
+ *
+ * Callbacks run with the budget lock held and may take their owners' locks,
+ * so they must not call back into the budget, and owners register and
+ * unregister outside their own locks. cache_budget_note_growth is the one
+ * call that is safe from anywhere: it only bumps an atomic counter, which
+ * cache_budget_poll checks before doing any work.
+ */
+
+#define CACHE_BUDGET_MAX_ACCOUNTS 16
+#define CACHE_BUDGET_MAX_NAME_LEN 24
+
+/* Trim order: a lower class is emptied before a higher one is touched. */
+typedef enum {
+    CACHE_BUDGET_CLASS_PREFETCH = 0, /* speculative data nobody has asked for */
+    CACHE_BUDGET_CLASS_RESULTS = 1,  /* memoised calculation results */
+    CACHE_BUDGET_CLASS_PAGES = 2,    /* JS-visible cache pages */
+    CACHE_BUDGET_CLASS_HISTORY = 3,  /* persisted history, reloadable from disk */
+    CACHE_BUDGET_CLASS_TABLES = 4,   /* arenas and lookup tables */
+    CACHE_BUDGET_CLASS_COUNT
+} cache_budget_class_t;
+
+typedef enum {
+    /* Trim a quarter of current usage */
+    CACHE_BUDGET_PRESSURE_MODERATE = 1,
+    /* Trim everything that can be trimmed */
+    CACHE_BUDGET_PRESSURE_CRITICAL = 2
+} cache_budget_pressure_t;
+
+/* Bytes the account holds now. */
+typedef size_t (*cache_budget_usage_fn)(void *context);
+/* Frees at least bytes_wanted if it can; returns the bytes actually freed. */
+typedef size_t (*cache_budget_trim_fn)(void *context, size_t bytes_wanted);
+
+typedef struct {
+    char name[CACHE_BUDGET_MAX_NAME_LEN];
+    cache_budget_class_t account_class;
+    size_t bytes;
+    int trimmable;
+} cache_budget_account_t;
+
+typedef struct {
+    size_t limit;
+    size_t usage;
+    size_t peak_usage;
+    uint64_t trims;
+    uint64_t trimmed_bytes;
+    uint64_t pressure_events;
+    size_t account_count;
+    cache_budget_account_t accounts[CACHE_BUDGET_MAX_ACCOUNTS];
+} cache_budget_stats_t;
+
+/*
+ * Returns an account id, or -1 when the table is full or arguments are
+ * invalid. trim_fn may be NULL for memory that is tracked but fixed.
+ */
+int cache_budget_register(const char *name,
+                          cache_budget_class_t account_class,
+                          cache_budget_usage_fn usage_fn,
+                          cache_budget_trim_fn trim_fn,
+                          void *context);
+void cache_budget_unregister(int id);
+
+/* 0 removes the cap. Setting a lower cap enforces it at once. */
+void cache_budget_set_limit(size_t limit_bytes);
+size_t cache_budget_limit(void);
+size_t cache_budget_usage(void);
+
+/* Trims class by class until usage is at most target_bytes; returns the bytes freed. */
+size_t cache_budget_trim(size_t target_bytes);
+/* Trims only one class by up to bytes_wanted. */
+size_t cache_budget_trim_class(cache_budget_class_t account_class, size_t bytes_wanted);
+
+/*
+ * Over the limit, trims to an eighth below it so a cache that regrows by
+ * one segment does not trigger another trim straight away.
+ */
+size_t cache_budget_enforce(void);
+
+void cache_budget_note_growth(size_t bytes);
+/* Enforces only when a limit is set and some account grew since the last enforce. */
+void cache_budget_poll(void);
+
+size_t cache_budget_pressure(cache_budget_pressure_t level);
+
+int cache_budget_stats(cache_budget_stats_t *out_stats);
+
+/* Lower-camel names for the JSON and QuickJS views, "unknown" when out of range. */
+const char *cache_budget_class_name(cache_budget_class_t account_class);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
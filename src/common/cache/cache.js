@@ -7,10 +7,27 @@ const createDestroyedBackend = () => ({
     return null
   },
   set() {},
+  getBuffer() {
+    return null
+  },
+  setBuffer() {},
+  /** @param {Array<number|string>} keys */
+  getMany(keys) {
+    return keys.map(() => null)
+  },
+  setMany() {},
+  /** @param {Array<number|string>} keys */
+  hasMany(keys) {
+    return keys.map(() => false)
+  },
   has() {
     return false
   },
   clear() {},
+  invalidate() {},
+  resize() {
+    return false
+  },
   pin() {},
   release() {},
   destroy() {},
@@ -20,6 +37,9 @@ const createDestroyedBackend = () => ({
       entries: 0,
     }
   },
+  metrics() {
+    return null
+  },
   get size() {
     return 0
   },
@@ -37,6 +57,32 @@ const createJsFallbackBackend = (capacityPages) => {
     set(key, value) {
       cache.set(key, value)
     },
+    /** @param {Array<number|string>} keys */
+    getMany(keys) {
+      return keys.map((key) => cache.get(key))
+    },
+    /** @param {Array<number|string>} keys @param {any[]} values */
+    setMany(keys, values) {
+      keys.forEach((key, index) => cache.set(key, values[index]))
+    },
+    /** @param {Array<number|string>} keys */
+    hasMany(keys) {
+      return keys.map((key) => cache.has(key))
+    },
+    /** @param {number|string} key */
+    getBuffer(key) {
+      const bytes = cache.get(key)
+      return bytes instanceof ArrayBuffer ? bytes : null
+    },
+    /** @param {number|string} key @param {ArrayBuffer|ArrayBufferView} bytes */
+    setBuffer(key, bytes) {
+      cache.set(
+        key,
+        ArrayBuffer.isView(bytes)
+          ? bytes.buffer.slice(bytes.byteOffset, bytes.byteOffset + bytes.byteLength)
+          : bytes.slice(0)
+      )
+    },
     /** @param {number|string} key */
     has(key) {
       return cache.has(key)
@@ -44,6 +90,14 @@ const createJsFallbackBackend = (capacityPages) => {
     clear() {
       cache.clear()
     },
+    invalidate() {
+      cache.clear()
+    },
+    /** @param {number} capacityPages */
+    resize(capacityPages) {
+      cache.resize(capacityPages)
+      return true
+    },
     pin() {},
     release() {},
     stats() {
@@ -52,6 +106,9 @@ const createJsFallbackBackend = (capacityPages) => {
         entries: cache.size,
       }
     },
+    metrics() {
+      return null
+    },
     get size() {
       return cache.size
     },
@@ -62,16 +119,22 @@ const createJsFallbackBackend = (capacityPages) => {
  * @param {{
  *   namespace: string,
  *   capacityPages: number,
- *   pageSize: number
+ *   pageSize: number,
+ *   compressThreshold?: number,
+ *   policy?: 'clock' | 'cost',
+ *   lazy?: boolean
  * }} options
  */
-const createCacheBackend = ({ namespace, capacityPages, pageSize }) => {
+const createCacheBackend = ({ namespace, capacityPages, pageSize, compressThreshold = 0, policy = 'clock', lazy = true }) => {
   ensureVelaProvider()
   return (
     createBackend({
       namespace,
       capacityPages,
       pageSize,
+      compressThreshold,
+      policy,
+      lazy,
     }) || createJsFallbackBackend(capacityPages)
   )
 }
@@ -81,11 +144,26 @@ const createCacheBackend = ({ namespace, capacityPages, pageSize }) => {
  * Replace the internals with a native bridge when the runtime binding is ready.
  */
 class CacheService {
-  constructor({ capacityPages = 256, pageSize = 4096, namespace = 'default' } = {}) {
+  /**
+   * compressThreshold: native values of at least this many bytes are stored compressed (0 = off)
+   * policy: 'cost' lets entries set with a recompute cost outlive cheap ones under eviction
+   * lazy: native payload memory is committed as the cache fills rather than at creation
+   */
+  constructor({
+    capacityPages = 256,
+    pageSize = 4096,
+    namespace = 'default',
+    compressThreshold = 0,
+    policy = 'clock',
+    lazy = true,
+  } = {}) {
     this.capacityPages = capacityPages
     this.pageSize = pageSize
     this.namespace = namespace
-    this.backend = createCacheBackend({ namespace, capacityPages, pageSize })
+    this.compressThreshold = compressThreshold
+    this.policy = policy
+    this.lazy = lazy
+    this.backend = createCacheBackend({ namespace, capacityPages, pageSize, compressThreshold, policy, lazy })
     this.pinned = new Set()
     this.destroyed = false
   }
@@ -94,6 +172,11 @@ class CacheService {
     if (this.destroyed) {
       return
     }
+    // A capacity change alone resizes in place and keeps warm entries
+    if (pageSize === this.pageSize && capacityPages !== this.capacityPages && this.backend.resize(capacityPages)) {
+      this.capacityPages = capacityPages
+      return
+    }
     if (capacityPages !== this.capacityPages || pageSize !== this.pageSize) {
       this.capacityPages = capacityPages
       this.pageSize = pageSize
@@ -104,6 +187,9 @@ class CacheService {
         namespace: this.namespace,
         capacityPages,
         pageSize,
+        compressThreshold: this.compressThreshold,
+        policy: this.policy,
+        lazy: this.lazy,
       })
       this.pinned.clear()
       return
@@ -115,9 +201,44 @@ class CacheService {
     return this.backend.get(pageId)
   }
 
-  /** @param {number|string} pageId @param {any} value */
-  set(pageId, value) {
-    this.backend.set(pageId, value)
+  /** @param {number|string} pageId @param {any} value @param {number} [cost] recompute cost hint */
+  set(pageId, value, cost) {
+    this.backend.set(pageId, value, cost)
+  }
+
+  /**
+   * Binary values (e.g. Float64Array chart series) without JSON. The native
+   * result views the cached page and keeps it pinned until collected, so
+   * read it and drop it.
+   * @param {number|string} pageId
+   * @returns {ArrayBuffer|null}
+   */
+  getBuffer(pageId) {
+    return this.backend.getBuffer(pageId)
+  }
+
+  /** @param {number|string} pageId @param {ArrayBuffer|ArrayBufferView} bytes @param {number} [cost] */
+  setBuffer(pageId, bytes, cost) {
+    this.backend.setBuffer(pageId, bytes, cost)
+  }
+
+  /**
+   * Batched reads: one native crossing per batch, values in pageIds order,
+   * null for misses.
+   * @param {Array<number|string>} pageIds
+   */
+  getMany(pageIds) {
+    return this.backend.getMany(pageIds)
+  }
+
+  /** @param {Array<number|string>} pageIds @param {any[]} values @param {number[]} [costs] */
+  setMany(pageIds, values, costs) {
+    this.backend.setMany(pageIds, values, costs)
+  }
+
+  /** @param {Array<number|string>} pageIds */
+  hasMany(pageIds) {
+    return this.backend.hasMany(pageIds)
   }
 
   /** @param {number|string} pageId */
@@ -130,6 +251,15 @@ class CacheService {
     this.pinned.clear()
   }
 
+  /**
+   * Drops every current entry in O(1) on the native backend (stale entries
+   * read as misses and are reclaimed lazily). Pinned pages stay readable
+   * until released.
+   */
+  invalidate() {
+    this.backend.invalidate()
+  }
+
   destroy() {
     if (this.destroyed) {
       return
@@ -166,14 +296,22 @@ class CacheService {
       return
     }
 
-    pageIds.forEach((pageId) => {
-      if (!this.has(pageId)) {
+    // One batched presence check and one batched store instead of a crossing per page
+    const present = this.hasMany(pageIds)
+    const loadedIds = []
+    const loadedPages = []
+    pageIds.forEach((pageId, index) => {
+      if (!present[index]) {
         const page = loader(pageId)
         if (page !== null && typeof page !== 'undefined') {
-          this.set(pageId, page)
+          loadedIds.push(pageId)
+          loadedPages.push(page)
         }
       }
     })
+    if (loadedIds.length > 0) {
+      this.setMany(loadedIds, loadedPages)
+    }
   }
 
   /** @param {number|string} pageId @param {(pageId: number|string) => any=} loader */
@@ -203,6 +341,11 @@ class CacheService {
       ...backendStats,
     }
   }
+
+  /** Native latency and probe histograms; null on the JS fallback. */
+  metrics() {
+    return this.backend.metrics()
+  }
 }
 
 export default CacheService
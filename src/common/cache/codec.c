@@ -0,0 +1,255 @@
+#include "codec.h"
+
+#include <string.h>
+
+enum {
+    CACHE_CODEC_MIN_MATCH = 4,
+    CACHE_CODEC_HASH_BITS = 10,
+    CACHE_CODEC_MAX_OFFSET = 65535,
+    CACHE_CODEC_NIBBLE_MAX = 15
+};
+
+typedef struct {
+    uint8_t *data;
+    size_t capacity;
+    size_t length;
+    int overflow;
+} cache_codec_writer_t;
+
+static void cache_codec_put(cache_codec_writer_t *writer, uint8_t value) {
+    if (writer->length >= writer->capacity) {
+        writer->overflow = 1;
+        return;
+    }
+
+    writer->data[writer->length++] = value;
+}
+
+static void cache_codec_put_bytes(cache_codec_writer_t *writer, const uint8_t *bytes, size_t count) {
+    if (count > writer->capacity - writer->length) {
+        writer->overflow = 1;
+        return;
+    }
+
+    memcpy(writer->data + writer->length, bytes, count);
+    writer->length += count;
+}
+
+/* Length beyond the token nibble: runs of 255 followed by the remainder. */
+static void cache_codec_put_length(cache_codec_writer_t *writer, size_t value) {
+    while (value >= 255 && !writer->overflow) {
+        cache_codec_put(writer, 255);
+        value -= 255;
+    }
+
+    cache_codec_put(writer, (uint8_t)value);
+}
+
+static void cache_codec_put_sequence(cache_codec_writer_t *writer,
+                                     const uint8_t *literals,
+                                     size_t literal_len,
+                                     size_t offset,
+                                     size_t match_len) {
+    size_t literal_nibble = literal_len < CACHE_CODEC_NIBBLE_MAX ? literal_len : CACHE_CODEC_NIBBLE_MAX;
+    size_t match_nibble = 0;
+
+    if (match_len > 0) {
+        match_nibble = match_len - CACHE_CODEC_MIN_MATCH;
+        if (match_nibble > CACHE_CODEC_NIBBLE_MAX) {
+            match_nibble = CACHE_CODEC_NIBBLE_MAX;
+        }
+    }
+
+    cache_codec_put(writer, (uint8_t)((literal_nibble << 4) | match_nibble));
+    if (literal_nibble == CACHE_CODEC_NIBBLE_MAX) {
+        cache_codec_put_length(writer, literal_len - CACHE_CODEC_NIBBLE_MAX);
+    }
+    cache_codec_put_bytes(writer, literals, literal_len);
+
+    if (match_len == 0) {
+        return;
+    }
+
+    cache_codec_put(writer, (uint8_t)(offset & 0xff));
+    cache_codec_put(writer, (uint8_t)(offset >> 8));
+    if (match_nibble == CACHE_CODEC_NIBBLE_MAX) {
+        cache_codec_put_length(writer, match_len - CACHE_CODEC_MIN_MATCH - CACHE_CODEC_NIBBLE_MAX);
+    }
+}
+
+static uint32_t cache_codec_hash(const uint8_t *bytes) {
+    uint32_t word = (uint32_t)bytes[0] |
+                    ((uint32_t)bytes[1] << 8) |
+                    ((uint32_t)bytes[2] << 16) |
+                    ((uint32_t)bytes[3] << 24);
+    return (word * 2654435761u) >> (32 - CACHE_CODEC_HASH_BITS);
+}
+
+size_t cache_codec_compress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_capacity) {
+    /* Positions + 1 of the last occurrence of each hashed 4-byte prefix; 0 is unset. */
+    uint32_t table[1u << CACHE_CODEC_HASH_BITS];
+    cache_codec_writer_t writer;
+    size_t anchor = 0;
+    size_t pos = 0;
+    size_t value;
+
+    if (!src || !dst || src_len == 0 || src_len > UINT32_MAX - 1) {
+        return 0;
+    }
+
+    memset(table, 0, sizeof(table));
+    writer.data = dst;
+    writer.capacity = dst_capacity;
+    writer.length = 0;
+    writer.overflow = 0;
+
+    value = src_len;
+    while (value >= 0x80) {
+        cache_codec_put(&writer, (uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    cache_codec_put(&writer, (uint8_t)value);
+
+    while (pos + CACHE_CODEC_MIN_MATCH <= src_len && !writer.overflow) {
+        uint32_t hash = cache_codec_hash(src + pos);
+        size_t candidate = table[hash];
+        size_t match_len;
+
+        table[hash] = (uint32_t)(pos + 1);
+        if (candidate == 0 ||
+            pos - (candidate - 1) > CACHE_CODEC_MAX_OFFSET ||
+            memcmp(src + candidate - 1, src + pos, CACHE_CODEC_MIN_MATCH) != 0) {
+            pos += 1;
+            continue;
+        }
+
+        candidate -= 1;
+        match_len = CACHE_CODEC_MIN_MATCH;
+        while (pos + match_len < src_len && src[candidate + match_len] == src[pos + match_len]) {
+            match_len += 1;
+        }
+
+        cache_codec_put_sequence(&writer, src + anchor, pos - anchor, pos - candidate, match_len);
+        pos += match_len;
+        anchor = pos;
+    }
+
+    cache_codec_put_sequence(&writer, src + anchor, src_len - anchor, 0, 0);
+
+    if (writer.overflow || writer.length >= src_len) {
+        return 0;
+    }
+
+    return writer.length;
+}
+
+static int cache_codec_read_varint(const uint8_t *src, size_t src_len, size_t *pos, size_t *out_value) {
+    size_t value = 0;
+    unsigned int shift = 0;
+
+    while (*pos < src_len && shift < sizeof(size_t) * 8) {
+        uint8_t byte = src[(*pos)++];
+        value |= (size_t)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            *out_value = value;
+            return 0;
+        }
+        shift += 7;
+    }
+
+    return -1;
+}
+
+static int cache_codec_read_length(const uint8_t *src, size_t src_len, size_t *pos, size_t *inout_len) {
+    uint8_t byte;
+
+    do {
+        if (*pos >= src_len) {
+            return -1;
+        }
+        byte = src[(*pos)++];
+        *inout_len += byte;
+    } while (byte == 255);
+
+    return 0;
+}
+
+int cache_codec_raw_length(const uint8_t *src, size_t src_len, size_t *out_len) {
+    size_t pos = 0;
+
+    if (!src || !out_len) {
+        return -1;
+    }
+
+    return cache_codec_read_varint(src, src_len, &pos, out_len);
+}
+
+int cache_codec_decompress(const uint8_t *src,
+                           size_t src_len,
+                           uint8_t *dst,
+                           size_t dst_capacity,
+                           size_t *out_len) {
+    size_t pos = 0;
+    size_t raw_len;
+    size_t written = 0;
+
+    if (!src || !dst || !out_len ||
+        cache_codec_read_varint(src, src_len, &pos, &raw_len) != 0 ||
+        raw_len > dst_capacity) {
+        return -1;
+    }
+
+    while (pos < src_len) {
+        uint8_t token = src[pos++];
+        size_t literal_len = token >> 4;
+        size_t match_len = token & 0x0f;
+        size_t offset;
+        size_t i;
+
+        if (literal_len == CACHE_CODEC_NIBBLE_MAX &&
+            cache_codec_read_length(src, src_len, &pos, &literal_len) != 0) {
+            return -1;
+        }
+
+        if (literal_len > src_len - pos || literal_len > raw_len - written) {
+            return -1;
+        }
+
+        memcpy(dst + written, src + pos, literal_len);
+        pos += literal_len;
+        written += literal_len;
+
+        if (pos == src_len) {
+            break;
+        }
+
+        if (src_len - pos < 2) {
+            return -1;
+        }
+
+        offset = (size_t)src[pos] | ((size_t)src[pos + 1] << 8);
+        pos += 2;
+        if (match_len == CACHE_CODEC_NIBBLE_MAX &&
+            cache_codec_read_length(src, src_len, &pos, &match_len) != 0) {
+            return -1;
+        }
+        match_len += CACHE_CODEC_MIN_MATCH;
+
+        if (offset == 0 || offset > written || match_len > raw_len - written) {
+            return -1;
+        }
+
+        /* Byte-wise so overlapping matches replicate runs */
+        for (i = 0; i < match_len; ++i) {
+            dst[written + i] = dst[written + i - offset];
+        }
+        written += match_len;
+    }
+
+    if (written != raw_len) {
+        return -1;
+    }
+
+    *out_len = written;
+    return 0;
+}
@@ -0,0 +1,39 @@
+#ifndef CACHE_CODEC_H
+#define CACHE_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Small LZ77 codec for cached payloads (serialized JSON, chart series).
+ *
+ * Stream layout: varint raw length, then LZ4-style sequences of
+ * [token][literal length ext][literals][offset lo, hi][match length ext],
+ * where the token's high nibble is the literal count and the low nibble the
+ * match length minus 4. The last sequence carries literals only. Offsets are
+ * 16-bit, so inputs are expected to stay within a cache page.
+ */
+
+/* Compresses src into dst. Returns the compressed size, or 0 when the
+ * result would not fit in dst_capacity or would not be smaller than src. */
+size_t cache_codec_compress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_capacity);
+
+/* Reads the raw length recorded in a compressed stream. */
+int cache_codec_raw_length(const uint8_t *src, size_t src_len, size_t *out_len);
+
+/* Decompresses into dst; fails if the stream is malformed or dst is too small. */
+int cache_codec_decompress(const uint8_t *src,
+                           size_t src_len,
+                           uint8_t *dst,
+                           size_t dst_capacity,
+                           size_t *out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
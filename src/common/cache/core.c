@@ -1,14 +1,19 @@
 #include "core.h"
 
+#include "budget.h"
+
 #include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
-enum {
-    PAGE_CACHE_HASH_EMPTY = 0,
-    PAGE_CACHE_HASH_OCCUPIED = 1,
-    PAGE_CACHE_HASH_TOMBSTONE = 2
-};
+/*
+ * The page index is a single linear-probed bucket array that deletes by
+ * backward shift, so there are no tombstones: a probe only ever walks the
+ * run of live keys. Empty buckets carry PAGE_CACHE_BUCKET_EMPTY as slot.
+ */
+
+/* Default slab classes below page_size; page_size itself is always the top class. */
+static const size_t page_cache_default_class_sizes[] = {64, 256, 1024};
 
 static size_t page_cache_next_power_of_two(size_t value) {
     size_t result = 1;
@@ -33,30 +38,33 @@ static int page_cache_mul_overflows(size_t left, size_t right) {
 }
 
 static size_t page_cache_hash_probe(page_cache_t *cache, uint32_t page_id, int *found) {
-    size_t index = page_cache_hash_key(page_id) & (cache->hash_capacity - 1);
-    size_t first_tombstone = SIZE_MAX;
-
-    for (;;) {
-        uint8_t state = cache->hash_states[index];
-        if (state == PAGE_CACHE_HASH_EMPTY) {
-            *found = 0;
-            return first_tombstone != SIZE_MAX ? first_tombstone : index;
-        }
-
-        if (state == PAGE_CACHE_HASH_OCCUPIED && cache->hash_keys[index] == page_id) {
-            *found = 1;
-            return index;
-        }
+    size_t mask = cache->hash_capacity - 1;
+    size_t index = page_cache_hash_key(page_id) & mask;
+    size_t length = 1;
+    size_t bucket = 0;
+    size_t scaled;
+
+    while (cache->buckets[index].slot != PAGE_CACHE_BUCKET_EMPTY && cache->buckets[index].page_id != page_id) {
+        index = (index + 1) & mask;
+        length += 1;
+    }
 
-        if (state == PAGE_CACHE_HASH_TOMBSTONE && first_tombstone == SIZE_MAX) {
-            first_tombstone = index;
-        }
+    *found = cache->buckets[index].slot != PAGE_CACHE_BUCKET_EMPTY;
+    cache->probe_count += 1;
+    cache->probe_steps += length;
+    if (length > cache->probe_max) {
+        cache->probe_max = length;
+    }
 
-        index = (index + 1) & (cache->hash_capacity - 1);
+    for (scaled = length >> 1; scaled != 0 && bucket + 1 < PAGE_CACHE_PROBE_BUCKETS; scaled >>= 1) {
+        bucket += 1;
     }
+    cache->probe_histogram[bucket] += 1;
+    return index;
 }
 
-static page_cache_entry_t *page_cache_find(page_cache_t *cache, uint32_t page_id) {
+/* Raw index lookup; stale entries are returned too. */
+static page_cache_entry_t *page_cache_lookup(page_cache_t *cache, uint32_t page_id) {
     int found = 0;
     size_t index;
 
@@ -69,25 +77,56 @@ static page_cache_entry_t *page_cache_find(page_cache_t *cache, uint32_t page_id
         return NULL;
     }
 
-    return &cache->entries[cache->hash_slots[index]];
+    return &cache->entries[cache->buckets[index].slot];
+}
+
+static int page_cache_is_stale(const page_cache_t *cache, const page_cache_entry_t *entry) {
+    return entry->pin_count == 0 && entry->generation != cache->generation;
 }
 
 static void page_cache_hash_insert(page_cache_t *cache, uint32_t page_id, size_t slot) {
     int found = 0;
     size_t index = page_cache_hash_probe(cache, page_id, &found);
-    cache->hash_keys[index] = page_id;
-    cache->hash_slots[index] = slot;
-    cache->hash_states[index] = PAGE_CACHE_HASH_OCCUPIED;
+    if (!found) {
+        cache->hash_count += 1;
+    }
+    cache->buckets[index].page_id = page_id;
+    cache->buckets[index].slot = (uint32_t)slot;
 }
 
+/*
+ * Backward-shift delete: pull later members of the run into the hole unless
+ * that would move them in front of their home slot.
+ */
 static void page_cache_hash_remove(page_cache_t *cache, uint32_t page_id) {
+    size_t mask = cache->hash_capacity - 1;
     int found = 0;
-    size_t index = page_cache_hash_probe(cache, page_id, &found);
+    size_t hole = page_cache_hash_probe(cache, page_id, &found);
+    size_t next = hole;
+
     if (!found) {
         return;
     }
 
-    cache->hash_states[index] = PAGE_CACHE_HASH_TOMBSTONE;
+    for (;;) {
+        size_t home;
+
+        next = (next + 1) & mask;
+        if (cache->buckets[next].slot == PAGE_CACHE_BUCKET_EMPTY) {
+            break;
+        }
+
+        home = page_cache_hash_key(cache->buckets[next].page_id) & mask;
+        if (((next - home) & mask) < ((next - hole) & mask)) {
+            continue;
+        }
+
+        cache->buckets[hole] = cache->buckets[next];
+        hole = next;
+    }
+
+    cache->buckets[hole].slot = PAGE_CACHE_BUCKET_EMPTY;
+    cache->hash_count -= 1;
 }
 
 static void page_cache_fill(page_cache_entry_t *entry, uint32_t page_id, size_t page_size) {
@@ -97,135 +136,416 @@ static void page_cache_fill(page_cache_entry_t *entry, uint32_t page_id, size_t
     entry->pin_count = 0;
     entry->occupied = 1;
     entry->referenced = 1;
+    entry->flags = 0;
+    entry->cost_level = 0;
+    entry->credit = 0;
 
     for (i = 0; i < page_size; ++i) {
         entry->data[i] = (uint8_t)((page_id + i) & 0xff);
     }
 }
 
-static void page_cache_assign(page_cache_entry_t *entry,
+static void page_cache_assign(page_cache_t *cache,
+                              page_cache_entry_t *entry,
                               uint32_t page_id,
                               const uint8_t *data,
                               size_t data_len) {
+    page_cache_class_t *size_class = &cache->classes[entry->size_class];
+
+    size_class->stored_bytes = size_class->stored_bytes - entry->data_len + data_len;
     entry->page_id = page_id;
     entry->data_len = (uint32_t)data_len;
     entry->occupied = 1;
     entry->referenced = 1;
+    entry->generation = cache->generation;
 
     if (data_len > 0 && data != NULL) {
         memcpy(entry->data, data, data_len);
     }
 }
 
-static page_cache_entry_t *page_cache_allocate_slot(page_cache_t *cache) {
+/* Smallest class whose chunks hold data_len bytes, or class_count if none does. */
+static size_t page_cache_class_for(const page_cache_t *cache, size_t data_len) {
+    size_t i;
+
+    for (i = 0; i < cache->class_count; ++i) {
+        if (cache->classes[i].chunk_size >= data_len) {
+            return i;
+        }
+    }
+
+    return cache->class_count;
+}
+
+static uint8_t page_cache_cost_level(uint32_t cost) {
+    uint8_t level = 0;
+
+    while (cost > 1 && level < PAGE_CACHE_MAX_COST_LEVEL) {
+        cost >>= 1;
+        level += 1;
+    }
+
+    return level;
+}
+
+/* Header of a lazily committed run of chunks; the chunks follow it. */
+typedef struct page_cache_segment {
+    struct page_cache_segment *next;
+    size_t bytes;
+    size_t class_index;
+    /* Class-relative: the segment backs slots [first_slot, first_slot + slot_count) of its class */
+    size_t first_slot;
+    size_t slot_count;
+} page_cache_segment_t;
+
+/* Commits the next segment of a lazy class. Returns the first new entry, or NULL. */
+static page_cache_entry_t *page_cache_commit_slots(page_cache_t *cache, size_t class_index) {
+    page_cache_class_t *size_class = &cache->classes[class_index];
+    size_t remaining = size_class->slot_count - size_class->committed_slots;
+    size_t grow = size_class->committed_slots ? size_class->committed_slots : PAGE_CACHE_LAZY_FIRST_SLOTS;
+    page_cache_segment_t *segment;
+    uint8_t *chunks;
+    size_t bytes;
+    size_t i;
+
+    if (remaining == 0) {
+        return NULL;
+    }
+
+    if (grow > remaining) {
+        grow = remaining;
+    }
+
+    bytes = grow * size_class->chunk_size;
+    segment = (page_cache_segment_t *)malloc(sizeof(page_cache_segment_t) + bytes);
+    if (!segment) {
+        return NULL;
+    }
+
+    segment->next = (page_cache_segment_t *)cache->segments;
+    segment->bytes = bytes;
+    segment->class_index = class_index;
+    segment->first_slot = size_class->committed_slots;
+    segment->slot_count = grow;
+    cache->segments = segment;
+
+    chunks = (uint8_t *)(segment + 1);
+    for (i = 0; i < grow; ++i) {
+        cache->entries[size_class->first_slot + size_class->committed_slots + i].data =
+            chunks + i * size_class->chunk_size;
+    }
+
+    /* Point the clock at the fresh slots after the one handed out, ahead of anything already live */
+    size_class->clock_hand = (size_class->committed_slots + 1) % (size_class->committed_slots + grow);
+    size_class->committed_slots += grow;
+    cache->payload_committed_bytes += bytes;
+    cache->total_reserved_bytes += bytes;
+    if (cache->total_reserved_bytes > cache->peak_reserved_bytes) {
+        cache->peak_reserved_bytes = cache->total_reserved_bytes;
+    }
+    cache_budget_note_growth(bytes);
+
+    return &cache->entries[size_class->first_slot + size_class->committed_slots - grow];
+}
+
+/*
+ * Clock sweep over one class's committed slots. A free slot is returned
+ * unoccupied when take_free is set and skipped otherwise; an evicted entry
+ * comes back still occupied with data_len 0.
+ */
+static page_cache_entry_t *page_cache_clock_sweep(page_cache_t *cache, size_t class_index, int take_free) {
+    page_cache_class_t *size_class = &cache->classes[class_index];
+    size_t passes = cache->policy == PAGE_CACHE_POLICY_COST_CLOCK ? 2 + PAGE_CACHE_MAX_COST_LEVEL : 2;
     size_t scanned = 0;
 
-    while (scanned < cache->capacity_pages * 2) {
-        page_cache_entry_t *entry = &cache->entries[cache->clock_hand];
+    while (scanned < size_class->committed_slots * passes) {
+        page_cache_entry_t *entry = &cache->entries[size_class->first_slot + size_class->clock_hand];
 
-        cache->clock_hand = (cache->clock_hand + 1) % cache->capacity_pages;
+        size_class->clock_hand = (size_class->clock_hand + 1) % size_class->committed_slots;
         scanned += 1;
 
         if (!entry->occupied) {
-            cache->count += 1;
-            return entry;
+            if (take_free) {
+                return entry;
+            }
+            continue;
         }
 
         if (entry->pin_count > 0) {
             continue;
         }
 
+        /* Stale data is reclaimed ahead of anything still live */
+        if (page_cache_is_stale(cache, entry)) {
+            page_cache_hash_remove(cache, entry->page_id);
+            size_class->stored_bytes -= entry->data_len;
+            entry->data_len = 0;
+            cache->invalidations += 1;
+            if (cache->on_evict) {
+                cache->on_evict(cache->evict_context, entry->page_id);
+            }
+            return entry;
+        }
+
         if (entry->referenced) {
             entry->referenced = 0;
             continue;
         }
 
+        if (cache->policy == PAGE_CACHE_POLICY_COST_CLOCK && entry->credit > 0) {
+            entry->credit -= 1;
+            continue;
+        }
+
+        if (cache->on_demote) {
+            cache->on_demote(cache->demote_context, entry);
+        }
         page_cache_hash_remove(cache, entry->page_id);
+        size_class->stored_bytes -= entry->data_len;
+        entry->data_len = 0;
+        size_class->evictions += 1;
         cache->evictions += 1;
+        cache->policy_stats[cache->policy].evictions += 1;
+        cache->policy_stats[cache->policy].evicted_cost += (1u << entry->cost_level) - 1;
+        if (cache->on_evict) {
+            cache->on_evict(cache->evict_context, entry->page_id);
+        }
         return entry;
     }
 
     return NULL;
 }
 
+/* Clock sweep for a new value. A lazy class that is full grows before it evicts. */
+static page_cache_entry_t *page_cache_allocate_slot(page_cache_t *cache, size_t class_index) {
+    page_cache_class_t *size_class = &cache->classes[class_index];
+    page_cache_entry_t *entry;
+
+    if (size_class->count == size_class->committed_slots) {
+        entry = page_cache_commit_slots(cache, class_index);
+
+        if (entry) {
+            cache->count += 1;
+            size_class->count += 1;
+            return entry;
+        }
+    }
+
+    entry = page_cache_clock_sweep(cache, class_index, 1);
+    if (entry && !entry->occupied) {
+        cache->count += 1;
+        size_class->count += 1;
+    }
+    return entry;
+}
+
+/* Best-fit class first; larger classes only when every chunk of the smaller ones is pinned. */
+static page_cache_entry_t *page_cache_allocate(page_cache_t *cache, size_t data_len) {
+    size_t i;
+
+    for (i = page_cache_class_for(cache, data_len); i < cache->class_count; ++i) {
+        page_cache_entry_t *entry = page_cache_allocate_slot(cache, i);
+        if (entry) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static void page_cache_release_slot(page_cache_t *cache, page_cache_entry_t *entry) {
+    page_cache_class_t *size_class = &cache->classes[entry->size_class];
+
+    page_cache_hash_remove(cache, entry->page_id);
+    size_class->stored_bytes -= entry->data_len;
+    size_class->count -= 1;
+    cache->count -= 1;
+    entry->data_len = 0;
+    entry->occupied = 0;
+    entry->referenced = 0;
+}
+
+/* Live lookup: a stale entry is dropped on sight and reported as absent. */
+static page_cache_entry_t *page_cache_find(page_cache_t *cache, uint32_t page_id) {
+    page_cache_entry_t *entry = page_cache_lookup(cache, page_id);
+
+    if (!entry || !page_cache_is_stale(cache, entry)) {
+        return entry;
+    }
+
+    page_cache_release_slot(cache, entry);
+    cache->invalidations += 1;
+    if (cache->on_evict) {
+        cache->on_evict(cache->evict_context, page_id);
+    }
+    return NULL;
+}
+
 int page_cache_init(page_cache_t *cache, size_t capacity_pages, size_t page_size) {
+    return page_cache_init_classes(cache, capacity_pages, page_size, &page_size, 1);
+}
+
+/*
+ * The payload budget stays capacity_pages * page_size and is split evenly
+ * between the classes, so small values get many more (smaller) slots.
+ * class_sizes must be strictly increasing and end at page_size.
+ */
+int page_cache_init_classes(page_cache_t *cache,
+                            size_t capacity_pages,
+                            size_t page_size,
+                            const size_t *class_sizes,
+                            size_t class_count) {
+    return page_cache_init_classes_ex(cache, capacity_pages, page_size, class_sizes, class_count, 0);
+}
+
+int page_cache_init_classes_ex(page_cache_t *cache,
+                               size_t capacity_pages,
+                               size_t page_size,
+                               const size_t *class_sizes,
+                               size_t class_count,
+                               unsigned int flags) {
+    int lazy = (flags & PAGE_CACHE_INIT_LAZY) != 0;
     size_t i;
+    size_t budget;
+    size_t class_budget;
+    size_t entry_capacity = 0;
     size_t hash_capacity;
-    size_t hash_key_bytes;
-    size_t hash_slot_bytes;
-    size_t hash_state_bytes;
+    size_t bucket_bytes;
     size_t entry_bytes;
-    size_t payload_bytes;
+    size_t payload_bytes = 0;
 
-    if (!cache || capacity_pages == 0 || page_size == 0) {
+    if (!cache || capacity_pages == 0 || page_size == 0 || !class_sizes ||
+        class_count == 0 || class_count > PAGE_CACHE_MAX_CLASSES ||
+        class_sizes[class_count - 1] != page_size) {
         return -1;
     }
 
-    if (page_cache_mul_overflows(capacity_pages, 4) ||
-        page_cache_mul_overflows(capacity_pages, sizeof(page_cache_entry_t)) ||
-        page_cache_mul_overflows(capacity_pages, page_size)) {
+    for (i = 0; i < class_count; ++i) {
+        if (class_sizes[i] == 0 || (i > 0 && class_sizes[i] <= class_sizes[i - 1])) {
+            return -1;
+        }
+    }
+
+    if (page_cache_mul_overflows(capacity_pages, page_size)) {
         return -1;
     }
 
     memset(cache, 0, sizeof(*cache));
+    budget = capacity_pages * page_size;
+    class_budget = budget / class_count;
+
+    for (i = 0; i < class_count; ++i) {
+        page_cache_class_t *size_class = &cache->classes[i];
+        size_t slot_count = class_budget / class_sizes[i];
+
+        if (slot_count == 0) {
+            slot_count = 1;
+        }
+
+        size_class->chunk_size = class_sizes[i];
+        size_class->first_slot = entry_capacity;
+        size_class->slot_count = slot_count;
+        entry_capacity += slot_count;
+        payload_bytes += slot_count * class_sizes[i];
+    }
+
+    if (entry_capacity >= PAGE_CACHE_BUCKET_EMPTY ||
+        page_cache_mul_overflows(entry_capacity, 4) ||
+        page_cache_mul_overflows(entry_capacity, sizeof(page_cache_entry_t))) {
+        return -1;
+    }
+
     cache->capacity_pages = capacity_pages;
     cache->page_size = page_size;
-    hash_capacity = page_cache_next_power_of_two(capacity_pages * 4);
+    cache->init_flags = flags;
+    cache->entry_capacity = entry_capacity;
+    cache->class_count = class_count;
+    hash_capacity = page_cache_next_power_of_two(entry_capacity * 4);
 
-    if (page_cache_mul_overflows(hash_capacity, sizeof(uint32_t)) ||
-        page_cache_mul_overflows(hash_capacity, sizeof(size_t)) ||
-        page_cache_mul_overflows(hash_capacity, sizeof(uint8_t))) {
+    if (page_cache_mul_overflows(hash_capacity, sizeof(page_cache_bucket_t))) {
         return -1;
     }
 
-    hash_key_bytes = hash_capacity * sizeof(uint32_t);
-    hash_slot_bytes = hash_capacity * sizeof(size_t);
-    hash_state_bytes = hash_capacity * sizeof(uint8_t);
-    entry_bytes = capacity_pages * sizeof(page_cache_entry_t);
-    payload_bytes = capacity_pages * page_size;
+    bucket_bytes = hash_capacity * sizeof(page_cache_bucket_t);
+    entry_bytes = entry_capacity * sizeof(page_cache_entry_t);
 
-    if (hash_key_bytes > SIZE_MAX - hash_slot_bytes ||
-        hash_key_bytes + hash_slot_bytes > SIZE_MAX - hash_state_bytes ||
-        entry_bytes > SIZE_MAX - (hash_key_bytes + hash_slot_bytes + hash_state_bytes) ||
-        entry_bytes + hash_key_bytes + hash_slot_bytes + hash_state_bytes > SIZE_MAX - payload_bytes) {
+    if (entry_bytes > SIZE_MAX - bucket_bytes ||
+        entry_bytes + bucket_bytes > SIZE_MAX - payload_bytes) {
         return -1;
     }
 
     cache->hash_capacity = hash_capacity;
-    cache->hash_index_bytes = hash_key_bytes + hash_slot_bytes + hash_state_bytes;
+    cache->hash_index_bytes = bucket_bytes;
     cache->metadata_bytes = entry_bytes + cache->hash_index_bytes;
     cache->payload_capacity_bytes = payload_bytes;
-    cache->total_reserved_bytes = cache->metadata_bytes + cache->payload_capacity_bytes;
+    cache->payload_committed_bytes = lazy ? 0 : payload_bytes;
+    cache->total_reserved_bytes = cache->metadata_bytes + cache->payload_committed_bytes;
     cache->peak_reserved_bytes = cache->total_reserved_bytes;
 
-    cache->entries = (page_cache_entry_t *)calloc(capacity_pages, sizeof(page_cache_entry_t));
-    cache->storage = (uint8_t *)malloc(cache->payload_capacity_bytes);
-    cache->hash_keys = (uint32_t *)calloc(cache->hash_capacity, sizeof(uint32_t));
-    cache->hash_slots = (size_t *)calloc(cache->hash_capacity, sizeof(size_t));
-    cache->hash_states = (uint8_t *)calloc(cache->hash_capacity, sizeof(uint8_t));
+    cache->entries = (page_cache_entry_t *)calloc(entry_capacity, sizeof(page_cache_entry_t));
+    cache->storage = lazy ? NULL : (uint8_t *)malloc(cache->payload_capacity_bytes);
+    cache->buckets = (page_cache_bucket_t *)malloc(bucket_bytes);
 
-    if (!cache->entries || !cache->storage || !cache->hash_keys || !cache->hash_slots || !cache->hash_states) {
+    if (!cache->entries || (!lazy && !cache->storage) || !cache->buckets) {
         page_cache_destroy(cache);
         return -1;
     }
 
-    for (i = 0; i < capacity_pages; ++i) {
-        cache->entries[i].data = cache->storage + (i * page_size);
+    for (i = 0; i < hash_capacity; ++i) {
+        cache->buckets[i].page_id = 0;
+        cache->buckets[i].slot = PAGE_CACHE_BUCKET_EMPTY;
+    }
+
+    payload_bytes = 0;
+    for (i = 0; i < class_count; ++i) {
+        page_cache_class_t *size_class = &cache->classes[i];
+        size_t slot;
+
+        for (slot = 0; slot < size_class->slot_count; ++slot) {
+            page_cache_entry_t *entry = &cache->entries[size_class->first_slot + slot];
+            entry->size_class = (uint8_t)i;
+            entry->data = lazy ? NULL : cache->storage + payload_bytes + (slot * size_class->chunk_size);
+        }
+        size_class->committed_slots = lazy ? 0 : size_class->slot_count;
+        payload_bytes += size_class->slot_count * size_class->chunk_size;
     }
 
     return 0;
 }
 
+int page_cache_init_slabs(page_cache_t *cache, size_t capacity_pages, size_t page_size) {
+    return page_cache_init_slabs_ex(cache, capacity_pages, page_size, 0);
+}
+
+int page_cache_init_slabs_ex(page_cache_t *cache, size_t capacity_pages, size_t page_size, unsigned int flags) {
+    size_t class_sizes[PAGE_CACHE_MAX_CLASSES];
+    size_t class_count = 0;
+    size_t i;
+
+    for (i = 0; i < sizeof(page_cache_default_class_sizes) / sizeof(page_cache_default_class_sizes[0]); ++i) {
+        if (page_cache_default_class_sizes[i] < page_size) {
+            class_sizes[class_count++] = page_cache_default_class_sizes[i];
+        }
+    }
+    class_sizes[class_count++] = page_size;
+
+    return page_cache_init_classes_ex(cache, capacity_pages, page_size, class_sizes, class_count, flags);
+}
+
 void page_cache_destroy(page_cache_t *cache) {
     if (!cache) {
         return;
     }
 
+    while (cache->segments) {
+        page_cache_segment_t *segment = (page_cache_segment_t *)cache->segments;
+        cache->segments = segment->next;
+        free(segment);
+    }
+
     free(cache->entries);
     free(cache->storage);
-    free(cache->hash_keys);
-    free(cache->hash_slots);
-    free(cache->hash_states);
+    free(cache->buckets);
     memset(cache, 0, sizeof(*cache));
 }
 
@@ -239,11 +559,14 @@ page_cache_entry_t *page_cache_get(page_cache_t *cache, uint32_t page_id) {
     entry = page_cache_find(cache, page_id);
     if (!entry) {
         cache->misses += 1;
+        cache->policy_stats[cache->policy].misses += 1;
         return NULL;
     }
 
     entry->referenced = 1;
+    entry->credit = entry->cost_level;
     cache->hits += 1;
+    cache->policy_stats[cache->policy].hits += 1;
     return entry;
 }
 
@@ -254,36 +577,82 @@ page_cache_entry_t *page_cache_touch(page_cache_t *cache, uint32_t page_id) {
         return entry;
     }
 
-    entry = page_cache_allocate_slot(cache);
+    entry = page_cache_allocate_slot(cache, cache->class_count - 1);
     if (!entry) {
         return NULL;
     }
 
+    cache->classes[entry->size_class].stored_bytes += cache->page_size;
     page_cache_fill(entry, page_id, cache->page_size);
+    entry->generation = cache->generation;
     page_cache_hash_insert(cache, page_id, page_cache_slot_of(cache, entry));
     return entry;
 }
 
 int page_cache_put(page_cache_t *cache, uint32_t page_id, const uint8_t *data, size_t data_len) {
+    return page_cache_put_ex(cache, page_id, data, data_len, 0, 0);
+}
+
+int page_cache_put_ex(page_cache_t *cache,
+                      uint32_t page_id,
+                      const uint8_t *data,
+                      size_t data_len,
+                      uint8_t flags,
+                      uint32_t cost) {
     page_cache_entry_t *entry;
 
     if (!cache || data_len > cache->page_size || (data_len > 0 && data == NULL)) {
         return -1;
     }
 
-    entry = page_cache_find(cache, page_id);
+    /* A stale entry is simply overwritten; its key is being rewritten anyway */
+    entry = page_cache_lookup(cache, page_id);
+    if (entry && entry->size_class != page_cache_class_for(cache, data_len)) {
+        /* Pinned data cannot move; it is rewritten in place while it still fits. */
+        if (entry->pin_count > 0) {
+            if (cache->classes[entry->size_class].chunk_size < data_len) {
+                return -1;
+            }
+        } else {
+            page_cache_release_slot(cache, entry);
+            entry = NULL;
+        }
+    }
+
     if (!entry) {
-        entry = page_cache_allocate_slot(cache);
+        entry = page_cache_allocate(cache, data_len);
         if (!entry) {
             return -1;
         }
         page_cache_hash_insert(cache, page_id, page_cache_slot_of(cache, entry));
     }
 
-    page_cache_assign(entry, page_id, data, data_len);
+    page_cache_assign(cache, entry, page_id, data, data_len);
+    entry->flags = flags;
+    entry->cost_level = page_cache_cost_level(cost);
+    entry->credit = entry->cost_level;
+    return 0;
+}
+
+/* Switching keeps entries and their credits; later counters go to the new policy. */
+int page_cache_set_policy(page_cache_t *cache, page_cache_policy_t policy) {
+    if (!cache || (unsigned)policy >= PAGE_CACHE_POLICY_COUNT) {
+        return -1;
+    }
+
+    cache->policy = policy;
     return 0;
 }
 
+uint32_t page_cache_bump_generation(page_cache_t *cache) {
+    if (!cache) {
+        return 0;
+    }
+
+    cache->generation += 1;
+    return cache->generation;
+}
+
 int page_cache_has(page_cache_t *cache, uint32_t page_id) {
     return page_cache_find(cache, page_id) != NULL;
 }
@@ -316,6 +685,379 @@ size_t page_cache_reserved_bytes(const page_cache_t *cache) {
     return cache->total_reserved_bytes;
 }
 
+void page_cache_set_evict_callback(page_cache_t *cache, page_cache_evict_fn on_evict, void *context) {
+    if (!cache) {
+        return;
+    }
+
+    cache->on_evict = on_evict;
+    cache->evict_context = context;
+}
+
+void page_cache_set_demote_callback(page_cache_t *cache, page_cache_demote_fn on_demote, void *context) {
+    if (!cache) {
+        return;
+    }
+
+    cache->on_demote = on_demote;
+    cache->demote_context = context;
+}
+
+size_t page_cache_demote_live(page_cache_t *cache) {
+    size_t demoted = 0;
+    size_t i;
+
+    if (!cache || !cache->on_demote || !cache->entries) {
+        return 0;
+    }
+
+    for (i = 0; i < cache->entry_capacity; ++i) {
+        const page_cache_entry_t *entry = &cache->entries[i];
+
+        if (entry->occupied && entry->data_len > 0 && !page_cache_is_stale(cache, entry)) {
+            cache->on_demote(cache->demote_context, entry);
+            demoted += 1;
+        }
+    }
+
+    return demoted;
+}
+
+size_t page_cache_stored_bytes(const page_cache_t *cache) {
+    size_t total = 0;
+    size_t i;
+
+    if (!cache) {
+        return 0;
+    }
+
+    for (i = 0; i < cache->class_count; ++i) {
+        total += cache->classes[i].stored_bytes;
+    }
+
+    return total;
+}
+
+/* Bytes of occupied chunks not covered by their values (internal fragmentation). */
+size_t page_cache_fragmentation_bytes(const page_cache_t *cache) {
+    size_t occupied = 0;
+    size_t i;
+
+    if (!cache) {
+        return 0;
+    }
+
+    for (i = 0; i < cache->class_count; ++i) {
+        occupied += cache->classes[i].count * cache->classes[i].chunk_size;
+    }
+
+    return occupied - page_cache_stored_bytes(cache);
+}
+
+/*
+ * Live recompute cost of a segment's entries (2^level each; stale entries are
+ * free), or UINT64_MAX when one is pinned and the segment cannot go.
+ */
+static uint64_t page_cache_segment_cost(const page_cache_t *cache, const page_cache_segment_t *segment) {
+    const page_cache_class_t *size_class = &cache->classes[segment->class_index];
+    uint64_t cost = 0;
+    size_t i;
+
+    for (i = 0; i < segment->slot_count; ++i) {
+        const page_cache_entry_t *entry = &cache->entries[size_class->first_slot + segment->first_slot + i];
+
+        if (!entry->occupied) {
+            continue;
+        }
+        if (entry->pin_count > 0) {
+            return UINT64_MAX;
+        }
+        if (!page_cache_is_stale(cache, entry)) {
+            cost += (uint64_t)1 << entry->cost_level;
+        }
+    }
+
+    return cost;
+}
+
+/* Evicts a tail segment's entries and hands its chunks back to the heap. */
+static void page_cache_free_segment(page_cache_t *cache, page_cache_segment_t **link) {
+    page_cache_segment_t *segment = *link;
+    page_cache_class_t *size_class = &cache->classes[segment->class_index];
+    size_t i;
+
+    for (i = 0; i < segment->slot_count; ++i) {
+        page_cache_entry_t *entry = &cache->entries[size_class->first_slot + segment->first_slot + i];
+        uint32_t page_id = entry->page_id;
+
+        if (entry->occupied) {
+            if (page_cache_is_stale(cache, entry)) {
+                cache->invalidations += 1;
+            } else {
+                size_class->evictions += 1;
+                cache->evictions += 1;
+                cache->policy_stats[cache->policy].evictions += 1;
+                cache->policy_stats[cache->policy].evicted_cost += (1u << entry->cost_level) - 1;
+                if (cache->on_demote) {
+                    cache->on_demote(cache->demote_context, entry);
+                }
+            }
+            page_cache_release_slot(cache, entry);
+            if (cache->on_evict) {
+                cache->on_evict(cache->evict_context, page_id);
+            }
+        }
+        entry->data = NULL;
+    }
+
+    size_class->committed_slots = segment->first_slot;
+    if (size_class->clock_hand >= size_class->committed_slots) {
+        size_class->clock_hand = 0;
+    }
+    cache->payload_committed_bytes -= segment->bytes;
+    cache->total_reserved_bytes -= segment->bytes;
+    *link = segment->next;
+    free(segment);
+}
+
+size_t page_cache_trim(page_cache_t *cache, size_t bytes_wanted) {
+    size_t freed = 0;
+
+    if (!cache || cache->storage) {
+        return 0;
+    }
+
+    while (freed < bytes_wanted) {
+        page_cache_segment_t **best_link = NULL;
+        uint64_t best_cost = 0;
+        page_cache_segment_t **link;
+
+        /* Only a class's newest segment can go, so its committed run stays contiguous */
+        for (link = (page_cache_segment_t **)&cache->segments; *link; link = &(*link)->next) {
+            const page_cache_segment_t *segment = *link;
+            uint64_t cost;
+
+            if (segment->first_slot + segment->slot_count != cache->classes[segment->class_index].committed_slots) {
+                continue;
+            }
+
+            cost = page_cache_segment_cost(cache, segment);
+            if (cost == UINT64_MAX) {
+                continue;
+            }
+
+            /* Cheapest cost per byte; cross-multiplied to stay in integers */
+            if (!best_link || cost * (*best_link)->bytes < best_cost * segment->bytes) {
+                best_link = link;
+                best_cost = cost;
+            }
+        }
+
+        if (!best_link) {
+            break;
+        }
+
+        freed += (*best_link)->bytes;
+        page_cache_free_segment(cache, best_link);
+    }
+
+    return freed;
+}
+
+/* Index insert for a rebuild: every key is known to be absent, and probes stay out of the stats. */
+static void page_cache_rehash_insert(page_cache_bucket_t *buckets, size_t hash_capacity, uint32_t page_id, size_t slot) {
+    size_t mask = hash_capacity - 1;
+    size_t index = page_cache_hash_key(page_id) & mask;
+
+    while (buckets[index].slot != PAGE_CACHE_BUCKET_EMPTY) {
+        index = (index + 1) & mask;
+    }
+
+    buckets[index].page_id = page_id;
+    buckets[index].slot = (uint32_t)slot;
+}
+
+int page_cache_resize(page_cache_t *cache, size_t capacity_pages) {
+    int lazy;
+    size_t slot_counts[PAGE_CACHE_MAX_CLASSES];
+    size_t kept[PAGE_CACHE_MAX_CLASSES];
+    page_cache_segment_t *new_segments[PAGE_CACHE_MAX_CLASSES] = {NULL};
+    page_cache_entry_t *entries;
+    page_cache_bucket_t *buckets;
+    uint8_t *storage = NULL;
+    size_t class_budget;
+    size_t entry_capacity = 0;
+    size_t hash_capacity;
+    size_t payload_bytes = 0;
+    size_t committed_bytes = 0;
+    size_t i;
+    size_t c;
+
+    if (!cache || !cache->entries || capacity_pages == 0 || page_cache_mul_overflows(capacity_pages, cache->page_size)) {
+        return -1;
+    }
+
+    if (capacity_pages == cache->capacity_pages) {
+        return 0;
+    }
+
+    /* A pin hands out a pointer into storage, which moving would leave dangling */
+    for (i = 0; i < cache->entry_capacity; ++i) {
+        if (cache->entries[i].occupied && cache->entries[i].pin_count > 0) {
+            return -1;
+        }
+    }
+
+    /* Same split as page_cache_init_classes_ex, so a resized cache matches a fresh one */
+    lazy = (cache->init_flags & PAGE_CACHE_INIT_LAZY) != 0;
+    class_budget = capacity_pages * cache->page_size / cache->class_count;
+    for (c = 0; c < cache->class_count; ++c) {
+        slot_counts[c] = class_budget / cache->classes[c].chunk_size;
+        if (slot_counts[c] == 0) {
+            slot_counts[c] = 1;
+        }
+        kept[c] = cache->classes[c].count < slot_counts[c] ? cache->classes[c].count : slot_counts[c];
+        entry_capacity += slot_counts[c];
+        payload_bytes += slot_counts[c] * cache->classes[c].chunk_size;
+        committed_bytes += (lazy ? kept[c] : slot_counts[c]) * cache->classes[c].chunk_size;
+    }
+
+    if (entry_capacity >= PAGE_CACHE_BUCKET_EMPTY || page_cache_mul_overflows(entry_capacity, 4) ||
+        page_cache_mul_overflows(entry_capacity, sizeof(page_cache_entry_t))) {
+        return -1;
+    }
+
+    hash_capacity = page_cache_next_power_of_two(entry_capacity * 4);
+    if (page_cache_mul_overflows(hash_capacity, sizeof(page_cache_bucket_t))) {
+        return -1;
+    }
+
+    /* Everything is allocated before the first eviction, so a failure leaves the cache as it was */
+    entries = (page_cache_entry_t *)calloc(entry_capacity, sizeof(page_cache_entry_t));
+    buckets = (page_cache_bucket_t *)malloc(hash_capacity * sizeof(page_cache_bucket_t));
+    if (!lazy) {
+        storage = (uint8_t *)malloc(payload_bytes);
+    }
+    for (c = 0; lazy && c < cache->class_count; ++c) {
+        if (kept[c] > 0) {
+            new_segments[c] = (page_cache_segment_t *)malloc(sizeof(page_cache_segment_t) +
+                                                             kept[c] * cache->classes[c].chunk_size);
+            if (!new_segments[c]) {
+                break;
+            }
+        }
+    }
+
+    if (!entries || !buckets || (!lazy && !storage) || (lazy && c < cache->class_count)) {
+        for (c = 0; c < cache->class_count; ++c) {
+            free(new_segments[c]);
+        }
+        free(entries);
+        free(buckets);
+        free(storage);
+        return -1;
+    }
+
+    /* Shrinking: the clock picks what goes, exactly as it would for new values */
+    for (c = 0; c < cache->class_count; ++c) {
+        while (cache->classes[c].count > slot_counts[c]) {
+            page_cache_entry_t *victim = page_cache_clock_sweep(cache, c, 0);
+
+            if (!victim) {
+                break;
+            }
+            page_cache_release_slot(cache, victim);
+        }
+    }
+
+    for (i = 0; i < hash_capacity; ++i) {
+        buckets[i].page_id = 0;
+        buckets[i].slot = PAGE_CACHE_BUCKET_EMPTY;
+    }
+
+    /* Live entries move to the front of their class's new run, in slot order */
+    payload_bytes = 0;
+    entry_capacity = 0;
+    for (c = 0; c < cache->class_count; ++c) {
+        page_cache_class_t *size_class = &cache->classes[c];
+        uint8_t *chunks = lazy ? (new_segments[c] ? (uint8_t *)(new_segments[c] + 1) : NULL) : storage + payload_bytes;
+        size_t room = lazy ? kept[c] : slot_counts[c];
+        size_t moved = 0;
+
+        for (i = 0; i < size_class->committed_slots && moved < room; ++i) {
+            const page_cache_entry_t *entry = &cache->entries[size_class->first_slot + i];
+            page_cache_entry_t *target;
+
+            if (!entry->occupied) {
+                continue;
+            }
+
+            target = &entries[entry_capacity + moved];
+            *target = *entry;
+            target->data = chunks + moved * size_class->chunk_size;
+            memcpy(target->data, entry->data, entry->data_len);
+            page_cache_rehash_insert(buckets, hash_capacity, target->page_id, entry_capacity + moved);
+            moved += 1;
+        }
+
+        for (i = moved; i < slot_counts[c]; ++i) {
+            entries[entry_capacity + i].size_class = (uint8_t)c;
+            entries[entry_capacity + i].data = lazy ? NULL : chunks + i * size_class->chunk_size;
+        }
+
+        if (new_segments[c]) {
+            new_segments[c]->bytes = moved * size_class->chunk_size;
+            new_segments[c]->class_index = c;
+            new_segments[c]->first_slot = 0;
+            new_segments[c]->slot_count = moved;
+        }
+
+        size_class->first_slot = entry_capacity;
+        size_class->slot_count = slot_counts[c];
+        size_class->committed_slots = lazy ? moved : slot_counts[c];
+        size_class->count = moved;
+        size_class->clock_hand = 0;
+        entry_capacity += slot_counts[c];
+        payload_bytes += slot_counts[c] * size_class->chunk_size;
+    }
+
+    while (cache->segments) {
+        page_cache_segment_t *segment = (page_cache_segment_t *)cache->segments;
+        cache->segments = segment->next;
+        free(segment);
+    }
+    for (c = 0; c < cache->class_count; ++c) {
+        if (new_segments[c]) {
+            new_segments[c]->next = (page_cache_segment_t *)cache->segments;
+            cache->segments = new_segments[c];
+        }
+    }
+
+    free(cache->entries);
+    free(cache->buckets);
+    free(cache->storage);
+    cache->entries = entries;
+    cache->buckets = buckets;
+    cache->storage = storage;
+    cache->capacity_pages = capacity_pages;
+    cache->entry_capacity = entry_capacity;
+    cache->hash_capacity = hash_capacity;
+    cache->hash_count = cache->count;
+    cache->hash_index_bytes = hash_capacity * sizeof(page_cache_bucket_t);
+    cache->metadata_bytes = entry_capacity * sizeof(page_cache_entry_t) + cache->hash_index_bytes;
+    cache->payload_capacity_bytes = payload_bytes;
+    cache->payload_committed_bytes = committed_bytes;
+    if (cache->metadata_bytes + committed_bytes > cache->total_reserved_bytes) {
+        cache_budget_note_growth(cache->metadata_bytes + committed_bytes - cache->total_reserved_bytes);
+    }
+    cache->total_reserved_bytes = cache->metadata_bytes + committed_bytes;
+    if (cache->total_reserved_bytes > cache->peak_reserved_bytes) {
+        cache->peak_reserved_bytes = cache->total_reserved_bytes;
+    }
+
+    return 0;
+}
+
 int page_cache_smoke_test(void) {
     page_cache_t cache;
     page_cache_entry_t *entry;
@@ -362,6 +1104,31 @@ int page_cache_smoke_test(void) {
         return -1;
     }
 
+    page_cache_destroy(&cache);
+
+    /* 4 x 256-byte budget split into 64- and 256-byte classes: 8 + 2 slots */
+    if (page_cache_init_slabs(&cache, 4, 256) != 0 || cache.entry_capacity != 10) {
+        page_cache_destroy(&cache);
+        return -1;
+    }
+
+    if (page_cache_put(&cache, 1, (const uint8_t *)"small", 5) != 0 ||
+        page_cache_find(&cache, 1)->size_class != 0 ||
+        page_cache_fragmentation_bytes(&cache) != 64 - 5) {
+        page_cache_destroy(&cache);
+        return -1;
+    }
+
+    /* Growing past the chunk moves the value to the larger class */
+    entry = page_cache_touch(&cache, 2);
+    if (!entry || entry->size_class != 1 ||
+        page_cache_put(&cache, 1, entry->data, 200) != 0 ||
+        page_cache_find(&cache, 1)->size_class != 1 ||
+        cache.classes[0].count != 0) {
+        page_cache_destroy(&cache);
+        return -1;
+    }
+
     page_cache_destroy(&cache);
     return 0;
 }
@@ -8,22 +8,106 @@
 extern "C" {
 #endif
 
+#define PAGE_CACHE_MAX_CLASSES 4
+
+/*
+ * Init flag: reserve entries and the hash index up front but commit payload
+ * chunks per class as they fill, in segments that double from
+ * PAGE_CACHE_LAZY_FIRST_SLOTS up to the class's full slot count. A class evicts
+ * only once it is fully committed.
+ */
+#define PAGE_CACHE_INIT_LAZY 0x01u
+#define PAGE_CACHE_LAZY_FIRST_SLOTS 4
+
+/* Highest recompute-cost level; a level-n entry survives n extra clock passes. */
+#define PAGE_CACHE_MAX_COST_LEVEL 15
+
+/*
+ * CLOCK evicts on the second pass over an unreferenced entry. COST_CLOCK
+ * (GreedyDual-style) also gives each entry credit = log2 of its recompute
+ * cost hint, refreshed on every hit and spent one unit per pass, so
+ * expensive results outlive cheap ones that were used as recently.
+ */
+typedef enum {
+    PAGE_CACHE_POLICY_CLOCK = 0,
+    PAGE_CACHE_POLICY_COST_CLOCK = 1,
+    PAGE_CACHE_POLICY_COUNT
+} page_cache_policy_t;
+
+/* Counters accumulated while a policy was active; evicted_cost sums 2^level - 1. */
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t evicted_cost;
+} page_cache_policy_stats_t;
+
+/* Probe-length histogram: bucket b counts probes of [2^b, 2^(b+1)) steps; the last is open-ended. */
+#define PAGE_CACHE_PROBE_BUCKETS 8
+
+/* Bucket slot value marking an empty index bucket. */
+#define PAGE_CACHE_BUCKET_EMPTY UINT32_MAX
+
+/*
+ * One index bucket: 8 bytes, so a 64-byte cache line holds a probe group of
+ * eight. A 16-bit slot would be padded to the same size, so slots stay 32-bit.
+ */
 typedef struct {
+    uint32_t page_id;
+    uint32_t slot;
+} page_cache_bucket_t;
+
+/* Called after a clock eviction or a stale-generation reclaim drops page_id. */
+typedef void (*page_cache_evict_fn)(void *context, uint32_t page_id);
+
+struct page_cache_entry_s;
+/*
+ * Called with a live entry, its data still intact, just before a clock
+ * eviction or a trim drops it. Stale entries are never demoted.
+ */
+typedef void (*page_cache_demote_fn)(void *context, const struct page_cache_entry_s *entry);
+
+typedef struct page_cache_entry_s {
     uint32_t page_id;
     uint32_t data_len;
     uint16_t pin_count;
     uint8_t occupied;
     uint8_t referenced;
+    uint8_t size_class;
+    uint8_t flags;
+    uint8_t cost_level;
+    uint8_t credit;
+    uint32_t generation;
     uint8_t *data;
 } page_cache_entry_t;
 
+/*
+ * One slab class: a contiguous run of equally sized chunks with its own clock.
+ * Entries [first_slot, first_slot + slot_count) belong to the class.
+ */
+typedef struct {
+    size_t chunk_size;
+    size_t first_slot;
+    size_t slot_count;
+    /* Slots [first_slot, first_slot + committed_slots) have payload storage */
+    size_t committed_slots;
+    size_t count;
+    size_t clock_hand;
+    size_t stored_bytes;
+    uint64_t evictions;
+} page_cache_class_t;
+
 typedef struct {
     size_t capacity_pages;
     size_t page_size;
     size_t count;
-    size_t clock_hand;
+    size_t entry_capacity;
+    size_t class_count;
+    page_cache_class_t classes[PAGE_CACHE_MAX_CLASSES];
     size_t hash_capacity;
+    size_t hash_count;
     size_t payload_capacity_bytes;
+    size_t payload_committed_bytes;
     size_t metadata_bytes;
     size_t hash_index_bytes;
     size_t total_reserved_bytes;
@@ -31,22 +115,92 @@ typedef struct {
     uint64_t hits;
     uint64_t misses;
     uint64_t evictions;
+    page_cache_policy_t policy;
+    page_cache_policy_stats_t policy_stats[PAGE_CACHE_POLICY_COUNT];
+    uint32_t generation;
+    uint64_t invalidations;
+    uint64_t probe_count;
+    uint64_t probe_steps;
+    size_t probe_max;
+    uint64_t probe_histogram[PAGE_CACHE_PROBE_BUCKETS];
+    unsigned int init_flags;
     page_cache_entry_t *entries;
+    /* One eager block, or NULL with lazily committed segments chained from segments */
     uint8_t *storage;
-    uint32_t *hash_keys;
-    size_t *hash_slots;
-    uint8_t *hash_states;
+    void *segments;
+    page_cache_bucket_t *buckets;
+    page_cache_evict_fn on_evict;
+    void *evict_context;
+    page_cache_demote_fn on_demote;
+    void *demote_context;
 } page_cache_t;
 
 int page_cache_init(page_cache_t *cache, size_t capacity_pages, size_t page_size);
+int page_cache_init_classes(page_cache_t *cache,
+                            size_t capacity_pages,
+                            size_t page_size,
+                            const size_t *class_sizes,
+                            size_t class_count);
+int page_cache_init_slabs(page_cache_t *cache, size_t capacity_pages, size_t page_size);
+/* As the above, with PAGE_CACHE_INIT_* flags. */
+int page_cache_init_classes_ex(page_cache_t *cache,
+                               size_t capacity_pages,
+                               size_t page_size,
+                               const size_t *class_sizes,
+                               size_t class_count,
+                               unsigned int flags);
+int page_cache_init_slabs_ex(page_cache_t *cache, size_t capacity_pages, size_t page_size, unsigned int flags);
 void page_cache_destroy(page_cache_t *cache);
 page_cache_entry_t *page_cache_get(page_cache_t *cache, uint32_t page_id);
 page_cache_entry_t *page_cache_touch(page_cache_t *cache, uint32_t page_id);
 int page_cache_put(page_cache_t *cache, uint32_t page_id, const uint8_t *data, size_t data_len);
+/*
+ * As page_cache_put, also storing caller-defined flag bits and a recompute
+ * cost hint (caller units, e.g. microseconds; 0 = trivially cheap).
+ */
+int page_cache_put_ex(page_cache_t *cache,
+                      uint32_t page_id,
+                      const uint8_t *data,
+                      size_t data_len,
+                      uint8_t flags,
+                      uint32_t cost);
+int page_cache_set_policy(page_cache_t *cache, page_cache_policy_t policy);
+/*
+ * O(1) bulk invalidation. Entries written under an older generation read as
+ * misses and are reclaimed lazily, on lookup or when the clock reaches them.
+ * Pinned entries stay readable until their last unpin. Returns the new
+ * generation.
+ */
+uint32_t page_cache_bump_generation(page_cache_t *cache);
 int page_cache_has(page_cache_t *cache, uint32_t page_id);
 int page_cache_pin(page_cache_t *cache, uint32_t page_id);
 int page_cache_unpin(page_cache_t *cache, uint32_t page_id);
+void page_cache_set_evict_callback(page_cache_t *cache, page_cache_evict_fn on_evict, void *context);
+void page_cache_set_demote_callback(page_cache_t *cache, page_cache_demote_fn on_demote, void *context);
+/* Hands every live entry to the demote callback without evicting it; returns how many. */
+size_t page_cache_demote_live(page_cache_t *cache);
 size_t page_cache_reserved_bytes(const page_cache_t *cache);
+size_t page_cache_stored_bytes(const page_cache_t *cache);
+size_t page_cache_fragmentation_bytes(const page_cache_t *cache);
+/*
+ * Hands lazily committed segments back to the heap until at least
+ * bytes_wanted are freed or nothing more can go, and returns the bytes
+ * freed. Each step drops the class tail segment whose live entries carry the
+ * least recompute cost per byte, evicting them through the evict callback;
+ * segments holding a pinned entry stay. The class regrows on demand. Eager
+ * caches cannot shrink and return 0.
+ */
+size_t page_cache_trim(page_cache_t *cache, size_t bytes_wanted);
+/*
+ * Changes capacity_pages in place, keeping page_size, the slab classes and
+ * as many entries as the new size holds. Shrinking evicts through the clock
+ * (evict callback included) until each class fits; growing keeps every
+ * entry. Live entries move to new storage and the index is rebuilt in the
+ * same pass, so no probe is ever made against a half-built index. Counters,
+ * policy and generation carry over. Fails with -1, leaving the cache as it
+ * was, while any entry is pinned or if an allocation fails.
+ */
+int page_cache_resize(page_cache_t *cache, size_t capacity_pages);
 int page_cache_smoke_test(void);
 
 #ifdef __cplusplus
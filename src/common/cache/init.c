@@ -21,6 +21,10 @@ int cache_plugin_init(JSContext *ctx) {
     return cache_register_quickjs(ctx);
 }
 
+int cache_plugin_init_lazy(JSContext *ctx) {
+    return cache_register_quickjs_lazy(ctx);
+}
+
 /*
  * QuickJS-native module entry point.
  *
@@ -55,4 +59,9 @@ int cache_plugin_init(JSContext *ctx) {
     return -1;
 }
 
+int cache_plugin_init_lazy(JSContext *ctx) {
+    (void)ctx;
+    return -1;
+}
+
 #endif
@@ -16,6 +16,12 @@ extern "C" {
  */
 int cache_plugin_init(JSContext *ctx);
 
+/*
+ * As cache_plugin_init, but the provider object is only built when JS first
+ * reads `globalThis.__velaCacheProvider`.
+ */
+int cache_plugin_init_lazy(JSContext *ctx);
+
 #ifdef __cplusplus
 }
 #endif
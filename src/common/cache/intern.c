@@ -0,0 +1,302 @@
+#include "intern.h"
+
+#include "sync.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    CACHE_INTERN_CLASS_COUNT = 4,
+    /* size_class of strings too long for any cell; they are malloc'd and freed individually */
+    CACHE_INTERN_HEAP_CLASS = CACHE_INTERN_CLASS_COUNT,
+    CACHE_INTERN_MIN_TABLE = 64
+};
+
+typedef struct cache_intern_entry {
+    struct cache_intern_entry *next_free;
+    uint32_t hash;
+    uint32_t refs;
+    uint32_t length;
+    uint32_t size_class;
+    char text[];
+} cache_intern_entry_t;
+
+typedef struct cache_intern_chunk {
+    struct cache_intern_chunk *next;
+    size_t cell_size;
+} cache_intern_chunk_t;
+
+/* Cell sizes include the entry header; the largest holds a CACHE_BRIDGE_MAX_KEY_LEN key. */
+static const size_t cache_intern_cell_sizes[CACHE_INTERN_CLASS_COUNT] = {32, 64, 96, 160};
+
+typedef struct {
+    cache_intern_entry_t **table;
+    size_t table_capacity;
+    /* Live entries plus tombstones */
+    size_t table_used;
+    cache_intern_entry_t *free_cells[CACHE_INTERN_CLASS_COUNT];
+    cache_intern_chunk_t *chunk_list;
+    cache_intern_stats_t stats;
+} cache_intern_pool_t;
+
+static cache_intern_pool_t g_pool;
+static cache_lock_t g_pool_lock = CACHE_LOCK_INITIALIZER;
+static cache_intern_entry_t g_tombstone;
+
+uint32_t cache_intern_hash(const char *text, size_t length) {
+    uint32_t hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < length; ++i) {
+        hash ^= (uint32_t)(unsigned char)text[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static cache_intern_entry_t *cache_intern_entry_of(const char *interned) {
+    return (cache_intern_entry_t *)(void *)((char *)(uintptr_t)interned - offsetof(cache_intern_entry_t, text));
+}
+
+/* Slot holding text, or the slot to insert it into (the first tombstone seen, else the empty slot). */
+static size_t cache_intern_probe(const char *text, size_t length, uint32_t hash, int *found) {
+    size_t mask = g_pool.table_capacity - 1;
+    size_t index = hash & mask;
+    size_t insert_at = g_pool.table_capacity;
+
+    *found = 0;
+    for (;;) {
+        cache_intern_entry_t *entry = g_pool.table[index];
+
+        if (!entry) {
+            return insert_at < g_pool.table_capacity ? insert_at : index;
+        }
+
+        if (entry == &g_tombstone) {
+            if (insert_at == g_pool.table_capacity) {
+                insert_at = index;
+            }
+        } else if (entry->hash == hash && entry->length == length && memcmp(entry->text, text, length) == 0) {
+            *found = 1;
+            return index;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+/* Rehashes live entries into a table of capacity slots, dropping tombstones. */
+static int cache_intern_resize(size_t capacity) {
+    cache_intern_entry_t **old_table = g_pool.table;
+    size_t old_capacity = g_pool.table_capacity;
+    size_t i;
+
+    g_pool.table = (cache_intern_entry_t **)calloc(capacity, sizeof(cache_intern_entry_t *));
+    if (!g_pool.table) {
+        g_pool.table = old_table;
+        return -1;
+    }
+
+    g_pool.table_capacity = capacity;
+    g_pool.table_used = 0;
+    for (i = 0; i < old_capacity; ++i) {
+        cache_intern_entry_t *entry = old_table[i];
+        size_t index;
+
+        if (!entry || entry == &g_tombstone) {
+            continue;
+        }
+
+        index = entry->hash & (capacity - 1);
+        while (g_pool.table[index]) {
+            index = (index + 1) & (capacity - 1);
+        }
+        g_pool.table[index] = entry;
+        g_pool.table_used += 1;
+    }
+
+    free(old_table);
+    return 0;
+}
+
+static size_t cache_intern_class_for(size_t length) {
+    size_t size_class;
+
+    for (size_class = 0; size_class < CACHE_INTERN_CLASS_COUNT; ++size_class) {
+        if (length + 1 <= cache_intern_cell_sizes[size_class] - offsetof(cache_intern_entry_t, text)) {
+            return size_class;
+        }
+    }
+
+    return CACHE_INTERN_HEAP_CLASS;
+}
+
+static cache_intern_entry_t *cache_intern_cell_alloc(size_t size_class) {
+    cache_intern_entry_t *entry;
+
+    if (!g_pool.free_cells[size_class]) {
+        size_t cell_size = cache_intern_cell_sizes[size_class];
+        size_t cell_count = (CACHE_INTERN_CHUNK_BYTES - sizeof(cache_intern_chunk_t)) / cell_size;
+        cache_intern_chunk_t *chunk = (cache_intern_chunk_t *)malloc(CACHE_INTERN_CHUNK_BYTES);
+        uint8_t *cells;
+        size_t i;
+
+        if (!chunk) {
+            return NULL;
+        }
+
+        chunk->next = g_pool.chunk_list;
+        chunk->cell_size = cell_size;
+        g_pool.chunk_list = chunk;
+        g_pool.stats.chunks += 1;
+        g_pool.stats.bytes_reserved += CACHE_INTERN_CHUNK_BYTES;
+
+        cells = (uint8_t *)(chunk + 1);
+        for (i = cell_count; i > 0; --i) {
+            cache_intern_entry_t *cell = (cache_intern_entry_t *)(void *)(cells + (i - 1) * cell_size);
+            cell->next_free = g_pool.free_cells[size_class];
+            g_pool.free_cells[size_class] = cell;
+        }
+    }
+
+    entry = g_pool.free_cells[size_class];
+    g_pool.free_cells[size_class] = entry->next_free;
+    entry->next_free = NULL;
+    return entry;
+}
+
+const char *cache_intern_acquire(const char *text, size_t length, uint32_t hash) {
+    cache_intern_entry_t *entry;
+    size_t size_class;
+    size_t index;
+    int found;
+
+    if (!text || length > UINT32_MAX - 1) {
+        return NULL;
+    }
+
+    cache_lock_acquire(&g_pool_lock);
+
+    if (!g_pool.table || (g_pool.table_used + 1) * 4 > g_pool.table_capacity * 3) {
+        size_t capacity = g_pool.table_capacity ? g_pool.table_capacity : CACHE_INTERN_MIN_TABLE;
+
+        /* Grow when live entries fill half the table, otherwise just clear tombstones */
+        if (g_pool.stats.strings * 2 >= capacity) {
+            capacity *= 2;
+        }
+        if (cache_intern_resize(capacity) != 0) {
+            cache_lock_release(&g_pool_lock);
+            return NULL;
+        }
+    }
+
+    index = cache_intern_probe(text, length, hash, &found);
+    if (found) {
+        entry = g_pool.table[index];
+        entry->refs += 1;
+        g_pool.stats.references += 1;
+        cache_lock_release(&g_pool_lock);
+        return entry->text;
+    }
+
+    size_class = cache_intern_class_for(length);
+    if (size_class == CACHE_INTERN_HEAP_CLASS) {
+        entry = (cache_intern_entry_t *)malloc(offsetof(cache_intern_entry_t, text) + length + 1);
+        if (entry) {
+            g_pool.stats.bytes_reserved += offsetof(cache_intern_entry_t, text) + length + 1;
+        }
+    } else {
+        entry = cache_intern_cell_alloc(size_class);
+    }
+
+    if (!entry) {
+        cache_lock_release(&g_pool_lock);
+        return NULL;
+    }
+
+    entry->next_free = NULL;
+    entry->hash = hash;
+    entry->refs = 1;
+    entry->length = (uint32_t)length;
+    entry->size_class = (uint32_t)size_class;
+    memcpy(entry->text, text, length);
+    entry->text[length] = '\0';
+
+    if (!g_pool.table[index]) {
+        g_pool.table_used += 1;
+    }
+    g_pool.table[index] = entry;
+    g_pool.stats.strings += 1;
+    g_pool.stats.references += 1;
+
+    cache_lock_release(&g_pool_lock);
+    return entry->text;
+}
+
+void cache_intern_release(const char *interned) {
+    cache_intern_entry_t *entry;
+    size_t index;
+    int found;
+
+    if (!interned) {
+        return;
+    }
+
+    entry = cache_intern_entry_of(interned);
+
+    cache_lock_acquire(&g_pool_lock);
+    g_pool.stats.references -= 1;
+    entry->refs -= 1;
+    if (entry->refs > 0) {
+        cache_lock_release(&g_pool_lock);
+        return;
+    }
+
+    index = cache_intern_probe(entry->text, entry->length, entry->hash, &found);
+    if (found) {
+        g_pool.table[index] = &g_tombstone;
+    }
+    g_pool.stats.strings -= 1;
+
+    if (entry->size_class == CACHE_INTERN_HEAP_CLASS) {
+        g_pool.stats.bytes_reserved -= offsetof(cache_intern_entry_t, text) + entry->length + 1;
+        free(entry);
+    } else {
+        entry->next_free = g_pool.free_cells[entry->size_class];
+        g_pool.free_cells[entry->size_class] = entry;
+    }
+
+    cache_lock_release(&g_pool_lock);
+}
+
+void cache_intern_get_stats(cache_intern_stats_t *out_stats) {
+    if (!out_stats) {
+        return;
+    }
+
+    cache_lock_acquire(&g_pool_lock);
+    *out_stats = g_pool.stats;
+    cache_lock_release(&g_pool_lock);
+}
+
+void cache_intern_trim(void) {
+    cache_intern_chunk_t *chunk;
+
+    cache_lock_acquire(&g_pool_lock);
+    if (g_pool.stats.strings != 0) {
+        cache_lock_release(&g_pool_lock);
+        return;
+    }
+
+    chunk = g_pool.chunk_list;
+    while (chunk) {
+        cache_intern_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    free(g_pool.table);
+    memset(&g_pool, 0, sizeof(g_pool));
+    cache_lock_release(&g_pool_lock);
+}
@@ -0,0 +1,54 @@
+#ifndef CACHE_INTERN_H
+#define CACHE_INTERN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Process-wide pool of reference-counted, deduplicated key strings.
+ *
+ * Strings live in fixed-size cells carved from CACHE_INTERN_CHUNK_BYTES
+ * chunks, one cell size per chunk. A released cell goes back on its size
+ * class's free list instead of to the heap, so once the working set of keys
+ * has been seen, interning does no heap allocation and cannot fragment it.
+ * Strings longer than the largest class get their own allocation.
+ *
+ * Thread-safe under CACHE_THREAD_SAFE (see sync.h).
+ */
+
+#define CACHE_INTERN_CHUNK_BYTES 4096
+
+typedef struct {
+    size_t strings;
+    size_t references;
+    size_t chunks;
+    /* Bytes held by chunks and oversized strings, whether in use or free */
+    size_t bytes_reserved;
+} cache_intern_stats_t;
+
+/* FNV-1a over length bytes; the hash cache_intern_acquire expects. */
+uint32_t cache_intern_hash(const char *text, size_t length);
+
+/*
+ * Returns the pooled copy of text (NUL-terminated), taking a reference, or
+ * NULL on allocation failure. hash must be cache_intern_hash(text, length).
+ */
+const char *cache_intern_acquire(const char *text, size_t length, uint32_t hash);
+
+/* Drops a reference taken by cache_intern_acquire; NULL is ignored. */
+void cache_intern_release(const char *interned);
+
+void cache_intern_get_stats(cache_intern_stats_t *out_stats);
+
+/* Returns every chunk to the heap once no strings are referenced. */
+void cache_intern_trim(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
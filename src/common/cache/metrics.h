@@ -0,0 +1,97 @@
+#ifndef CACHE_METRICS_H
+#define CACHE_METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if !defined(CACHE_NO_METRICS)
+#include <time.h>
+#endif
+
+/*
+ * Latency histograms for the native cache.
+ *
+ * Samples land in log2 buckets: bucket 0 holds anything under 256 ns, bucket
+ * b holds [2^(7+b), 2^(8+b)) ns, and the last bucket is open-ended (about
+ * 4 ms and up). Build with CACHE_NO_METRICS to skip the clock reads; counts
+ * still accumulate, with every sample in bucket 0.
+ */
+
+#define CACHE_METRICS_BUCKETS 16
+#define CACHE_METRICS_BUCKET_SHIFT 8
+
+typedef enum {
+    CACHE_OP_GET = 0,
+    CACHE_OP_SET = 1,
+    CACHE_OP_HAS = 2,
+    CACHE_OP_PIN = 3,
+    CACHE_OP_PREFETCH = 4,
+    /* Sets that had to evict, timed end to end */
+    CACHE_OP_EVICT = 5,
+    CACHE_OP_COUNT
+} cache_op_t;
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t buckets[CACHE_METRICS_BUCKETS];
+} cache_latency_histogram_t;
+
+/* Lower-case op name, as used for the keys of cache.stats "latency". */
+static inline const char *cache_op_name(cache_op_t op) {
+    static const char *const names[CACHE_OP_COUNT] = {"get", "set", "has", "pin", "prefetch", "evict"};
+    return (unsigned)op < CACHE_OP_COUNT ? names[op] : "unknown";
+}
+
+static inline uint64_t cache_metrics_now_ns(void) {
+#if defined(CACHE_NO_METRICS)
+    return 0;
+#else
+    struct timespec now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        return 0;
+    }
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+}
+
+/* Exclusive upper bound of bucket in ns; 0 for the open-ended last bucket. */
+static inline uint64_t cache_metrics_bucket_limit(size_t bucket) {
+    return bucket + 1 < CACHE_METRICS_BUCKETS ? (uint64_t)1 << (CACHE_METRICS_BUCKET_SHIFT + bucket) : 0;
+}
+
+/* Records the time since start_ns, as returned by cache_metrics_now_ns. */
+static inline void cache_latency_record(cache_latency_histogram_t *histogram, uint64_t start_ns) {
+    uint64_t elapsed = cache_metrics_now_ns() - start_ns;
+    uint64_t scaled = elapsed >> CACHE_METRICS_BUCKET_SHIFT;
+    size_t bucket = 0;
+
+    while (scaled != 0 && bucket + 1 < CACHE_METRICS_BUCKETS) {
+        scaled >>= 1;
+        bucket += 1;
+    }
+
+    histogram->count += 1;
+    histogram->total_ns += elapsed;
+    if (elapsed > histogram->max_ns) {
+        histogram->max_ns = elapsed;
+    }
+    histogram->buckets[bucket] += 1;
+}
+
+static inline void cache_latency_merge(cache_latency_histogram_t *into, const cache_latency_histogram_t *from) {
+    size_t i;
+
+    into->count += from->count;
+    into->total_ns += from->total_ns;
+    if (from->max_ns > into->max_ns) {
+        into->max_ns = from->max_ns;
+    }
+    for (i = 0; i < CACHE_METRICS_BUCKETS; ++i) {
+        into->buckets[i] += from->buckets[i];
+    }
+}
+
+#endif
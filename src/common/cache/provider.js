@@ -1,11 +1,12 @@
-import { hasProvider, registerProvider } from './bridge.js'
+import { FRAME_OP, FRAME_STATUS, decodeFrame, encodeFrame, hasProvider, registerProvider } from './bridge.js'
 
 /**
  * Vela-friendly native cache provider stub.
  *
  * The runtime can inject either:
  * - a direct provider object on a global key, or
- * - a bridge object with `invoke(method, paramsJson)`
+ * - a bridge object with `invoke(method, paramsJson)`, optionally with
+ *   `invokeBinary(frame)` for the framed get/set/has path (see bridge.h)
  *
  * This avoids dynamic native loading in JS and keeps the app-side API stable.
  */
@@ -45,8 +46,24 @@ function isInvokeBridge(candidate) {
   return !!(candidate && typeof candidate.invoke === 'function')
 }
 
-/** @param {{ invoke: (method: string, paramsJson: string) => any }} methods */
+/**
+ * @param {{
+ *   invoke: (method: string, paramsJson: string) => any,
+ *   invokeBinary?: (frame: ArrayBuffer) => ArrayBuffer
+ * }} methods
+ */
 function createInvokeBridgeProvider(methods) {
+  const binary = typeof methods.invokeBinary === 'function'
+
+  /** @param {number} op @param {number | string} handle @param {string} [key] @param {string} [value] @param {number} [arg] */
+  const invokeFrame = (op, handle, key, value, arg) => {
+    try {
+      return decodeFrame(methods.invokeBinary(encodeFrame(op, handle, key, value, arg)))
+    } catch (error) {
+      return decodeFrame(null)
+    }
+  }
+
   /** @param {string} method @param {object} params */
   const invoke = (method, params) => {
     try {
@@ -67,17 +84,30 @@ function createInvokeBridgeProvider(methods) {
   }
 
   return {
-    /** @param {{ namespace: string, capacityPages: number, pageSize: number }} config */
+    /** @param {{ namespace: string, capacityPages: number, pageSize: number, compressThreshold?: number, policy?: string, lazy?: boolean }} config */
     createCache(config) {
       const result = invoke('cache.create', config)
-      return result && result.ok && typeof result.handle === 'string' ? result.handle : ''
+      if (!result || !result.ok) {
+        return ''
+      }
+      // Prefer the integer id: the native side resolves it without a string lookup
+      if (typeof result.id === 'number' && result.id > 0) {
+        return result.id
+      }
+      return typeof result.handle === 'string' ? result.handle : ''
     },
-    /** @param {string} handle */
+    /** @param {number | string} handle */
     destroyCache(handle) {
       invoke('cache.destroy', { handle })
     },
-    /** @param {string} handle @param {string} key */
+    /** @param {number | string} handle @param {string} key */
     get(handle, key) {
+      if (binary) {
+        const frame = invokeFrame(FRAME_OP.GET, handle, key)
+        return frame.status === FRAME_STATUS.OK
+          ? { hit: true, serializedValue: frame.text() }
+          : { hit: false, serializedValue: null }
+      }
       const result = invoke('cache.get', { handle, key })
       return {
         hit: !!(result && result.ok && result.hit),
@@ -85,28 +115,100 @@ function createInvokeBridgeProvider(methods) {
           result && typeof result.serializedValue === 'string' ? result.serializedValue : null,
       }
     },
-    /** @param {string} handle @param {string} key @param {string} serializedValue */
-    set(handle, key, serializedValue) {
-      invoke('cache.set', { handle, key, serializedValue })
+    /** @param {number | string} handle @param {string} key @param {string} serializedValue @param {number} [cost] */
+    set(handle, key, serializedValue, cost) {
+      if (binary) {
+        invokeFrame(FRAME_OP.SET, handle, key, serializedValue, cost || 0)
+        return
+      }
+      invoke('cache.set', { handle, key, serializedValue, cost: cost || 0 })
     },
-    /** @param {string} handle @param {string} key */
+    /** @param {number | string} handle @param {string[]} keys */
+    getMany(handle, keys) {
+      const result = invoke('cache.getMany', { handle, keys })
+      if (!result || !result.ok || !Array.isArray(result.values)) {
+        return keys.map(() => null)
+      }
+      return keys.map((key, index) => {
+        const value = result.values[index]
+        if (typeof value === 'string') {
+          return value
+        }
+        if (!result.truncated) {
+          return null
+        }
+        // The batch response filled up; fetch the rest one by one
+        const single = invoke('cache.get', { handle, key })
+        return single && single.ok && single.hit && typeof single.serializedValue === 'string'
+          ? single.serializedValue
+          : null
+      })
+    },
+    /** @param {number | string} handle @param {string[]} keys @param {string[]} serializedValues @param {number[]} [costs] */
+    setMany(handle, keys, serializedValues, costs) {
+      invoke('cache.setMany', costs ? { handle, keys, serializedValues, costs } : { handle, keys, serializedValues })
+    },
+    /** @param {number | string} handle @param {string[]} keys */
+    hasMany(handle, keys) {
+      const result = invoke('cache.hasMany', { handle, keys })
+      return result && result.ok && Array.isArray(result.has)
+        ? keys.map((key, index) => !!result.has[index])
+        : keys.map(() => false)
+    },
+    /** @param {number | string} handle @param {string} key */
     has(handle, key) {
+      if (binary) {
+        return invokeFrame(FRAME_OP.HAS, handle, key).status === FRAME_STATUS.OK
+      }
       const result = invoke('cache.has', { handle, key })
       return !!(result && result.ok && result.has)
     },
-    /** @param {string} handle */
+    /** @param {number | string} handle */
     clear(handle) {
+      if (binary) {
+        invokeFrame(FRAME_OP.CLEAR, handle)
+        return
+      }
       invoke('cache.clear', { handle })
     },
-    /** @param {string} handle @param {string} key */
+    /** @param {number | string} handle @param {number} capacityPages */
+    resize(handle, capacityPages) {
+      const result = invoke('cache.resize', { handle, capacityPages })
+      return !!(result && result.ok)
+    },
+    /** @param {number | string} handle */
+    invalidate(handle) {
+      if (binary) {
+        const frame = invokeFrame(FRAME_OP.INVALIDATE, handle)
+        return frame.status === FRAME_STATUS.OK && frame.payload.byteLength >= 4
+          ? new DataView(frame.payload.buffer, frame.payload.byteOffset, 4).getUint32(0, true)
+          : -1
+      }
+      const result = invoke('cache.invalidate', { handle })
+      return result && result.ok && typeof result.generation === 'number' ? result.generation : -1
+    },
+    /** @param {string} namespace */
+    invalidateNamespace(namespace) {
+      const result = invoke('cache.invalidate', { namespace })
+      return result && result.ok && typeof result.invalidated === 'number' ? result.invalidated : 0
+    },
+    /** @param {number | string} handle @param {string} key */
     pin(handle, key) {
+      if (binary) {
+        invokeFrame(FRAME_OP.PIN, handle, key)
+        return
+      }
       invoke('cache.pin', { handle, key })
     },
-    /** @param {string} handle @param {string} key */
+    /** @param {number | string} handle @param {string} key */
     release(handle, key) {
+      if (binary) {
+        invokeFrame(FRAME_OP.RELEASE, handle, key)
+        return
+      }
       invoke('cache.release', { handle, key })
     },
-    /** @param {string} handle */
+    /** @param {number | string} handle */
     stats(handle) {
       const result = invoke('cache.stats', { handle })
       if (!result || !result.ok) {
@@ -119,6 +221,79 @@ function createInvokeBridgeProvider(methods) {
         implementation: result.implementation || 'native_bridge_stub',
       }
     },
+    /** @param {number | string} handle */
+    metrics(handle) {
+      const result = invoke('cache.stats', { handle })
+      if (!result || !result.ok || !result.latency) {
+        return null
+      }
+      return {
+        latency: result.latency,
+        probeHistogram: result.probeHistogram || [],
+        crossings: result.crossings || { json: 0, binary: 0, direct: 0 },
+      }
+    },
+    /** @param {number} distribution @param {number[]} params @param {number} x */
+    calculate(distribution, params, x) {
+      const result = invoke('calc.calculate', { distribution, parameters: params, input_value: x })
+      if (!result || result.success !== 1) {
+        return null
+      }
+      return {
+        success: true,
+        pdfResult: result.pdf_result,
+        cdfResult: result.cdf_result,
+        fromCache: result.from_cache === 1,
+        errorMessage: null,
+      }
+    },
+    /** @param {number} capacity 0 disables the orchestrator's result cache */
+    setResultCache(capacity) {
+      const result = invoke('calc.setResultCache', { capacity })
+      return !!(result && result.ok)
+    },
+    /** @param {string} path @param {number} maxBytes 0 persists and detaches the result tier */
+    setResultTier(path, maxBytes) {
+      const result = invoke('calc.setResultTier', { path, maxBytes })
+      return !!(result && result.ok)
+    },
+    invalidateResults() {
+      const result = invoke('calc.invalidateResults', {})
+      return !!(result && result.ok)
+    },
+    memoryBudget() {
+      const result = invoke('memory.budget', {})
+      if (!result || !result.ok) {
+        return null
+      }
+      delete result.ok
+      return result
+    },
+    /** @param {number} limit Bytes; 0 removes the cap */
+    setMemoryBudget(limit) {
+      const result = invoke('memory.setBudget', { limit })
+      return !!(result && result.ok)
+    },
+    /** @param {'moderate' | 'critical'} level */
+    memoryPressure(level) {
+      const result = invoke('memory.pressure', { level })
+      return result && result.ok ? result.freedBytes : 0
+    },
+    /** @param {number} n */
+    logFactorial(n) {
+      const result = invoke('math.logFactorial', { n })
+      return result && result.ok && typeof result.value === 'number' ? result.value : null
+    },
+    /** @param {number} x */
+    logGamma(x) {
+      const result = invoke('math.logGamma', { x })
+      return result && result.ok && typeof result.value === 'number' ? result.value : null
+    },
+    /** @param {number} n @param {number} k */
+    logCombination(n, k) {
+      const result = invoke('math.logCombination', { n, k })
+      return result && result.ok && typeof result.value === 'number' ? result.value : null
+    },
   }
 }
 
@@ -1,13 +1,27 @@
 #include "qjs.h"
 #include "bridge.h"
+#include "budget.h"
 #include "service.h"
+#include "trace.h"
+#include "../../../legacy/calc/engine/calculation_orchestrator.h"
+#include "../../../legacy/calc/engine/expression_engine.h"
+#include "../../../legacy/calc/engine/job_scheduler.h"
+#include "../../../legacy/calc/engine/pmf_table_cache.h"
+#include "../../../legacy/calc/hypothesis/hypothesis_kernels.h"
+#include "../../../legacy/calc/simulation/monte_carlo.h"
+#include "../../../legacy/calc/simulation/resampling.h"
+#include "../../../legacy/core/math/decimal_parser.h"
+#include "../../../legacy/models/distributions/distribution_registry.h"
+#include <math.h>
+#include <stdlib.h>
 #include <string.h>
 
 #if defined(CACHE_HAS_QUICKJS)
 
 enum {
     QJS_CACHE_MAX_CAPACITY_PAGES = 1024,
-    QJS_CACHE_MAX_PAGE_SIZE = 4096
+    QJS_CACHE_MAX_PAGE_SIZE = 4096,
+    QJS_SERIES_MAX_POINTS = 16384
 };
 
 static int get_prop_int(JSContext *ctx, JSValue obj, const char *prop, int default_val) {
@@ -36,6 +50,131 @@ static const char *get_prop_str(JSContext *ctx, JSValue obj, const char *prop) {
     return str;
 }
 
+/*
+ * Handle argument: the integer id createCache returns, taken without a
+ * string conversion, or a string handle, resolved once. Returns -1 with an
+ * exception pending if the conversion throws; unknown handles give
+ * CACHE_BRIDGE_INVALID_ID, which every bridge call rejects.
+ */
+static int get_handle_id(JSContext *ctx, JSValueConst value, cache_bridge_id_t *out_id) {
+    const char *handle;
+    uint32_t id;
+
+    if (JS_IsNumber(value)) {
+        if (JS_ToUint32(ctx, &id, value) < 0) {
+            return -1;
+        }
+        *out_id = id;
+        return 0;
+    }
+
+    handle = JS_ToCString(ctx, value);
+    if (!handle) {
+        return -1;
+    }
+    *out_id = cache_bridge_handle_id(handle);
+    JS_FreeCString(ctx, handle);
+    return 0;
+}
+
+#if !defined(CACHE_THREAD_SAFE)
+/*
+ * A getBuffer view: an external ArrayBuffer over a pinned page. The buffer's
+ * free callback releases the pin. destroy/clear detach the views still alive,
+ * so JS never reads storage that has been freed.
+ */
+typedef struct qjs_cache_view {
+    struct qjs_cache_view *next;
+    JSContext *ctx;
+    JSValue buffer; /* not a counted reference; the list entry dies with the buffer */
+    int detaching;
+    cache_bridge_id_t id;
+    char key[1];
+} qjs_cache_view_t;
+
+static qjs_cache_view_t *g_views = NULL;
+
+static void qjs_cache_view_unlink(qjs_cache_view_t *view) {
+    qjs_cache_view_t **link = &g_views;
+
+    while (*link && *link != view) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = view->next;
+    }
+}
+
+/*
+ * QuickJS calls this once when a view is detached and again, with ptr NULL,
+ * when the detached buffer is finalized; an undetached buffer gets one call.
+ */
+static void qjs_cache_view_free(JSRuntime *rt, void *opaque, void *ptr) {
+    qjs_cache_view_t *view = (qjs_cache_view_t *)opaque;
+
+    (void)rt;
+
+    if (!ptr) {
+        free(view);
+        return;
+    }
+
+    qjs_cache_view_unlink(view);
+    cache_bridge_release_value_by_id(view->id, view->key);
+    if (!view->detaching) {
+        free(view);
+    }
+}
+
+static void qjs_cache_detach_views(cache_bridge_id_t id) {
+    qjs_cache_view_t *view = g_views;
+
+    while (view) {
+        qjs_cache_view_t *next = view->next;
+
+        if (view->id == id) {
+            view->detaching = 1;
+            JS_DetachArrayBuffer(view->ctx, view->buffer);
+        }
+        view = next;
+    }
+}
+
+static JSValue qjs_cache_new_view(JSContext *ctx, cache_bridge_id_t id, const char *key) {
+    size_t key_len = strlen(key);
+    qjs_cache_view_t *view;
+    const uint8_t *data;
+    size_t data_len;
+
+    if (cache_bridge_acquire_value_by_id(id, key, &data, &data_len) != 0) {
+        return JS_UNDEFINED;
+    }
+
+    view = (qjs_cache_view_t *)malloc(sizeof(*view) + key_len);
+    if (!view) {
+        cache_bridge_release_value_by_id(id, key);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    view->id = id;
+    memcpy(view->key, key, key_len + 1);
+    view->ctx = ctx;
+    view->detaching = 0;
+
+    /* Read-only by contract: a write through the view would change the cached value */
+    view->buffer = JS_NewArrayBuffer(ctx, (uint8_t *)data, data_len, qjs_cache_view_free, view, 0);
+    if (JS_IsException(view->buffer)) {
+        cache_bridge_release_value_by_id(id, key);
+        free(view);
+        return JS_EXCEPTION;
+    }
+
+    view->next = g_views;
+    g_views = view;
+    return view->buffer;
+}
+#endif
+
 static int is_valid_cache_config(int capacity_pages, int page_size) {
     return capacity_pages > 0 &&
            page_size > 0 &&
@@ -47,6 +186,11 @@ static JSValue qjs_cache_create(JSContext *ctx, JSValueConst this_val, int argc,
     const char *namespace_name;
     int capacity_pages;
     int page_size;
+    int compress_threshold;
+    int shard_count;
+    int lazy;
+    const char *policy_name;
+    int cost_policy;
     const char *handle;
 
     (void)this_val;
@@ -58,6 +202,14 @@ static JSValue qjs_cache_create(JSContext *ctx, JSValueConst this_val, int argc,
     namespace_name = get_prop_str(ctx, argv[0], "namespace");
     capacity_pages = get_prop_int(ctx, argv[0], "capacityPages", 256);
     page_size = get_prop_int(ctx, argv[0], "pageSize", 4096);
+    compress_threshold = get_prop_int(ctx, argv[0], "compressThreshold", 0);
+    shard_count = get_prop_int(ctx, argv[0], "shards", 1);
+    lazy = get_prop_int(ctx, argv[0], "lazy", 0);
+    policy_name = get_prop_str(ctx, argv[0], "policy");
+    cost_policy = policy_name && strcmp(policy_name, "cost") == 0;
+    if (policy_name) {
+        JS_FreeCString(ctx, policy_name);
+    }
 
     if (!is_valid_cache_config(capacity_pages, page_size)) {
         if (namespace_name) {
@@ -66,10 +218,16 @@ static JSValue qjs_cache_create(JSContext *ctx, JSValueConst this_val, int argc,
         return JS_ThrowRangeError(ctx, "Invalid cache size configuration");
     }
 
-    handle = cache_bridge_create_service(
+    if (shard_count < 1) {
+        shard_count = 1;
+    }
+
+    handle = cache_bridge_create_sharded_service_ex(
         namespace_name ? namespace_name : "default",
         (size_t)capacity_pages,
-        (size_t)page_size
+        (size_t)page_size,
+        (size_t)shard_count,
+        lazy ? PAGE_CACHE_INIT_LAZY : 0
     );
 
     if (namespace_name) {
@@ -79,10 +237,17 @@ static JSValue qjs_cache_create(JSContext *ctx, JSValueConst this_val, int argc,
     if (!handle) {
         return JS_NULL;
     }
-    return JS_NewString(ctx, handle);
+    if (compress_threshold > 0) {
+        cache_bridge_set_compression(handle, (size_t)compress_threshold);
+    }
+    if (cost_policy) {
+        cache_bridge_set_policy(handle, PAGE_CACHE_POLICY_COST_CLOCK);
+    }
+    return JS_NewInt64(ctx, (int64_t)cache_bridge_handle_id(handle));
 }
 
 static JSValue qjs_cache_destroy(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
     const char *handle;
 
     (void)this_val;
@@ -91,16 +256,22 @@ static JSValue qjs_cache_destroy(JSContext *ctx, JSValueConst this_val, int argc
         return JS_UNDEFINED;
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    handle = cache_bridge_id_handle(id);
     if (handle) {
+#if !defined(CACHE_THREAD_SAFE)
+        qjs_cache_detach_views(id);
+#endif
         cache_bridge_destroy_service(handle);
-        JS_FreeCString(ctx, handle);
     }
     return JS_UNDEFINED;
 }
 
 static JSValue qjs_cache_get(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
-    const char *handle;
+    cache_bridge_id_t id;
     const char *key;
     JSValue result;
     const uint8_t *data;
@@ -112,197 +283,2812 @@ static JSValue qjs_cache_get(JSContext *ctx, JSValueConst this_val, int argc, JS
         return JS_ThrowTypeError(ctx, "Expected handle and key");
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
-    key = JS_ToCString(ctx, argv[1]);
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
+    }
 
-    if (!handle || !key) {
-        if (handle) JS_FreeCString(ctx, handle);
-        if (key) JS_FreeCString(ctx, key);
+    key = JS_ToCString(ctx, argv[1]);
+    if (!key) {
         return JS_EXCEPTION;
     }
 
     result = JS_NewObject(ctx);
-    if (cache_bridge_get_value_ptr(handle, key, &data, &data_len) == 0) {
+    if (cache_bridge_get_value_ptr_by_id(id, key, &data, &data_len) == 0) {
         JS_SetPropertyStr(ctx, result, "hit", JS_NewBool(ctx, 1));
         JS_SetPropertyStr(ctx, result, "serializedValue", JS_NewStringLen(ctx, (const char *)data, data_len));
     } else {
         JS_SetPropertyStr(ctx, result, "hit", JS_NewBool(ctx, 0));
     }
 
-    JS_FreeCString(ctx, handle);
     JS_FreeCString(ctx, key);
     return result;
 }
 
 static JSValue qjs_cache_set(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
-    const char *handle;
+    cache_bridge_id_t id;
     const char *key;
     size_t val_len;
     const char *val_str;
+    uint32_t cost = 0;
     (void)this_val;
 
     if (argc < 3) {
         return JS_ThrowTypeError(ctx, "Expected handle, key, value");
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
+    }
+
     key = JS_ToCString(ctx, argv[1]);
     val_str = JS_ToCStringLen(ctx, &val_len, argv[2]);
 
-    if (!handle || !key || !val_str) {
-        if (handle) JS_FreeCString(ctx, handle);
+    if (!key || !val_str) {
         if (key) JS_FreeCString(ctx, key);
         if (val_str) JS_FreeCString(ctx, val_str);
         return JS_EXCEPTION;
     }
 
-    cache_bridge_set_value(handle, key, (const uint8_t *)val_str, val_len);
+    /* Optional 4th argument: recompute-cost hint for the cost-aware policy */
+    if (argc > 3 && !JS_IsUndefined(argv[3]) && JS_ToUint32(ctx, &cost, argv[3]) < 0) {
+        cost = 0;
+    }
+
+    cache_bridge_set_value_cost_by_id(id, key, (const uint8_t *)val_str, val_len, cost);
 
-    JS_FreeCString(ctx, handle);
     JS_FreeCString(ctx, key);
     JS_FreeCString(ctx, val_str);
 
     return JS_UNDEFINED;
 }
 
-static JSValue qjs_cache_has(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
-    const char *handle;
+/*
+ * getBuffer(handle, key): the value as an ArrayBuffer, or null on a miss.
+ * Uncompressed values come back as a view over the pinned page, released
+ * when the buffer is collected; compressed values, and every value in the
+ * thread-safe build, are copied.
+ */
+static JSValue qjs_cache_get_buffer(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
     const char *key;
-    int has_val = 0;
+    JSValue result = JS_UNDEFINED;
+    const uint8_t *data;
+    size_t data_len;
 
     (void)this_val;
 
     if (argc < 2) {
-        return JS_NewBool(ctx, 0);
+        return JS_ThrowTypeError(ctx, "Expected handle and key");
+    }
+
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    key = JS_ToCString(ctx, argv[1]);
+    if (!key) {
+        return JS_EXCEPTION;
+    }
+
+#if !defined(CACHE_THREAD_SAFE)
+    result = qjs_cache_new_view(ctx, id, key);
+#endif
+    if (JS_IsUndefined(result)) {
+        if (cache_bridge_get_value_ptr_by_id(id, key, &data, &data_len) == 0) {
+            result = JS_NewArrayBufferCopy(ctx, data, data_len);
+        } else {
+            result = JS_NULL;
+        }
+    }
+
+    JS_FreeCString(ctx, key);
+    return result;
+}
+
+/* Bytes of an ArrayBuffer or a TypedArray's window on one, or NULL with an exception set. */
+static const uint8_t *qjs_cache_buffer_bytes(JSContext *ctx, JSValueConst value, size_t *out_len) {
+    JSValue buffer;
+    size_t byte_offset;
+    size_t byte_length;
+    size_t bytes_per_element;
+    size_t buffer_len;
+    uint8_t *data;
+
+    buffer = JS_GetTypedArrayBuffer(ctx, value, &byte_offset, &byte_length, &bytes_per_element);
+    if (JS_IsException(buffer)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return JS_GetArrayBuffer(ctx, out_len, value);
+    }
+
+    /* value keeps the buffer alive, so data outlives this reference */
+    data = JS_GetArrayBuffer(ctx, &buffer_len, buffer);
+    JS_FreeValue(ctx, buffer);
+    if (!data) {
+        return NULL;
+    }
+
+    *out_len = byte_length;
+    return data + byte_offset;
+}
+
+/* setBuffer(handle, key, bytes, cost?): one copy from the backing store into the page. */
+static JSValue qjs_cache_set_buffer(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
+    const char *key;
+    const uint8_t *data;
+    size_t data_len = 0;
+    uint32_t cost = 0;
+
+    (void)this_val;
+
+    if (argc < 3) {
+        return JS_ThrowTypeError(ctx, "Expected handle, key, buffer");
+    }
+
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
     key = JS_ToCString(ctx, argv[1]);
+    if (!key) {
+        return JS_EXCEPTION;
+    }
+
+    if (argc > 3 && !JS_IsUndefined(argv[3]) && JS_ToUint32(ctx, &cost, argv[3]) < 0) {
+        cost = 0;
+    }
+
+    /* Fetched last: the conversions above may run JS that detaches the buffer */
+    data = qjs_cache_buffer_bytes(ctx, argv[2], &data_len);
+    if (!data) {
+        JS_FreeCString(ctx, key);
+        return JS_EXCEPTION;
+    }
+
+    cache_bridge_set_value_cost_by_id(id, key, data, data_len, cost);
+
+    JS_FreeCString(ctx, key);
+
+    return JS_UNDEFINED;
+}
+
+/* Length of a JS array argument, or -1 (with no exception) when it is not an array. */
+static int64_t qjs_cache_array_length(JSContext *ctx, JSValueConst value) {
+    JSValue length_val;
+    int64_t length;
+
+    if (!JS_IsArray(ctx, value)) {
+        return -1;
+    }
+
+    length_val = JS_GetPropertyStr(ctx, value, "length");
+    if (JS_ToInt64(ctx, &length, length_val) < 0) {
+        length = -1;
+    }
+    JS_FreeValue(ctx, length_val);
+    return length;
+}
+
+/* getMany(handle, keys): serialized values in key order, null for misses. One crossing per batch. */
+static JSValue qjs_cache_get_many(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
+    JSValue result;
+    int64_t count;
+    int64_t i;
+
+    (void)this_val;
+
+    if (argc < 2 || (count = qjs_cache_array_length(ctx, argv[1])) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected handle and key array");
+    }
+
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    result = JS_NewArray(ctx);
+    for (i = 0; i < count && !JS_IsException(result); ++i) {
+        JSValue key_val = JS_GetPropertyUint32(ctx, argv[1], (uint32_t)i);
+        const char *key = JS_ToCString(ctx, key_val);
+        const uint8_t *data;
+        size_t data_len;
+        JSValue item = JS_NULL;
+
+        JS_FreeValue(ctx, key_val);
+        if (!key) {
+            JS_FreeValue(ctx, result);
+            result = JS_EXCEPTION;
+            break;
+        }
+
+        if (cache_bridge_get_value_ptr_by_id(id, key, &data, &data_len) == 0) {
+            item = JS_NewStringLen(ctx, (const char *)data, data_len);
+        }
+        JS_FreeCString(ctx, key);
+        JS_SetPropertyUint32(ctx, result, (uint32_t)i, item);
+    }
+
+    return result;
+}
+
+/* setMany(handle, keys, serializedValues, costs?): stores the pairs in order. */
+static JSValue qjs_cache_set_many(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
+    int64_t count;
+    int has_costs;
+    int64_t i;
+
+    (void)this_val;
+
+    if (argc < 3 ||
+        (count = qjs_cache_array_length(ctx, argv[1])) < 0 ||
+        qjs_cache_array_length(ctx, argv[2]) != count) {
+        return JS_ThrowTypeError(ctx, "Expected handle and matching key and value arrays");
+    }
+    has_costs = argc > 3 && qjs_cache_array_length(ctx, argv[3]) == count;
+
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    for (i = 0; i < count; ++i) {
+        JSValue key_val = JS_GetPropertyUint32(ctx, argv[1], (uint32_t)i);
+        JSValue value_val = JS_GetPropertyUint32(ctx, argv[2], (uint32_t)i);
+        const char *key = JS_ToCString(ctx, key_val);
+        size_t value_len;
+        const char *value = JS_ToCStringLen(ctx, &value_len, value_val);
+        uint32_t cost = 0;
+
+        JS_FreeValue(ctx, key_val);
+        JS_FreeValue(ctx, value_val);
+
+        if (has_costs) {
+            JSValue cost_val = JS_GetPropertyUint32(ctx, argv[3], (uint32_t)i);
+            if (JS_ToUint32(ctx, &cost, cost_val) < 0) {
+                cost = 0;
+            }
+            JS_FreeValue(ctx, cost_val);
+        }
+
+        if (key && value) {
+            cache_bridge_set_value_cost_by_id(id, key, (const uint8_t *)value, value_len, cost);
+        }
+        if (key) JS_FreeCString(ctx, key);
+        if (value) JS_FreeCString(ctx, value);
+        if (!key || !value) {
+            return JS_EXCEPTION;
+        }
+    }
+
+    return JS_UNDEFINED;
+}
+
+/* hasMany(handle, keys): booleans in key order. */
+static JSValue qjs_cache_has_many(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
+    JSValue result;
+    int64_t count;
+    int64_t i;
+
+    (void)this_val;
+
+    if (argc < 2 || (count = qjs_cache_array_length(ctx, argv[1])) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected handle and key array");
+    }
+
+    if (get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    result = JS_NewArray(ctx);
+    for (i = 0; i < count && !JS_IsException(result); ++i) {
+        JSValue key_val = JS_GetPropertyUint32(ctx, argv[1], (uint32_t)i);
+        const char *key = JS_ToCString(ctx, key_val);
+
+        JS_FreeValue(ctx, key_val);
+        if (!key) {
+            JS_FreeValue(ctx, result);
+            result = JS_EXCEPTION;
+            break;
+        }
+
+        JS_SetPropertyUint32(ctx, result, (uint32_t)i, JS_NewBool(ctx, cache_bridge_has_value_by_id(id, key)));
+        JS_FreeCString(ctx, key);
+    }
 
-    if (handle && key) {
-        has_val = cache_bridge_has_value(handle, key);
+    return result;
+}
+
+static JSValue qjs_cache_has(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
+    const char *key;
+    int has_val = 0;
+
+    (void)this_val;
+
+    if (argc < 2 || get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_NewBool(ctx, 0);
     }
 
-    if (handle) JS_FreeCString(ctx, handle);
-    if (key) JS_FreeCString(ctx, key);
+    key = JS_ToCString(ctx, argv[1]);
+    if (key) {
+        has_val = cache_bridge_has_value_by_id(id, key);
+        JS_FreeCString(ctx, key);
+    }
 
     return JS_NewBool(ctx, has_val);
 }
 
 static JSValue qjs_cache_clear(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
     const char *handle;
 
     (void)this_val;
 
-    if (argc < 1) {
+    if (argc < 1 || get_handle_id(ctx, argv[0], &id) < 0) {
         return JS_UNDEFINED;
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
+    handle = cache_bridge_id_handle(id);
     if (handle) {
+#if !defined(CACHE_THREAD_SAFE)
+        qjs_cache_detach_views(id);
+#endif
         cache_bridge_clear_service(handle);
-        JS_FreeCString(ctx, handle);
     }
     return JS_UNDEFINED;
 }
 
-static JSValue qjs_cache_pin(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+/*
+ * Like clear, detaches the cache's getBuffer views first: they pin pages, and
+ * a resize moves every page.
+ */
+static JSValue qjs_cache_resize(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
+    uint32_t capacity_pages;
+
+    (void)this_val;
+
+    if (argc < 2 || get_handle_id(ctx, argv[0], &id) < 0 || JS_ToUint32(ctx, &capacity_pages, argv[1]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected handle and capacityPages");
+    }
+
+#if !defined(CACHE_THREAD_SAFE)
+    qjs_cache_detach_views(id);
+#endif
+    return JS_NewBool(ctx, cache_bridge_resize_service_by_id(id, capacity_pages) == 0);
+}
+
+/* Returns the new generation, or -1 if the handle is unknown. */
+static JSValue qjs_cache_invalidate(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
     const char *handle;
+    uint32_t generation = 0;
+    int rc = -1;
+
+    (void)this_val;
+
+    if (argc < 1 || get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_NewInt64(ctx, -1);
+    }
+
+    handle = cache_bridge_id_handle(id);
+    if (handle) {
+        rc = cache_bridge_invalidate(handle, &generation);
+    }
+    return JS_NewInt64(ctx, rc == 0 ? (int64_t)generation : -1);
+}
+
+/* Returns how many caches were invalidated. */
+static JSValue qjs_cache_invalidate_namespace(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    const char *namespace_name;
+    int invalidated = 0;
+
+    (void)this_val;
+
+    if (argc < 1) {
+        return JS_NewInt32(ctx, 0);
+    }
+
+    namespace_name = JS_ToCString(ctx, argv[0]);
+    if (namespace_name) {
+        invalidated = cache_bridge_invalidate_namespace(namespace_name);
+        JS_FreeCString(ctx, namespace_name);
+    }
+    return JS_NewInt32(ctx, invalidated < 0 ? 0 : invalidated);
+}
+
+static JSValue qjs_cache_pin(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_id_t id;
     const char *key;
 
     (void)this_val;
 
-    if (argc < 2) {
+    if (argc < 2 || get_handle_id(ctx, argv[0], &id) < 0) {
         return JS_UNDEFINED;
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
     key = JS_ToCString(ctx, argv[1]);
-
-    if (handle && key) {
-        cache_bridge_pin_value(handle, key);
+    if (key) {
+        cache_bridge_pin_value_by_id(id, key);
+        JS_FreeCString(ctx, key);
     }
-
-    if (handle) JS_FreeCString(ctx, handle);
-    if (key) JS_FreeCString(ctx, key);
     return JS_UNDEFINED;
 }
 
 static JSValue qjs_cache_release(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
-    const char *handle;
+    cache_bridge_id_t id;
     const char *key;
 
     (void)this_val;
 
-    if (argc < 2) {
+    if (argc < 2 || get_handle_id(ctx, argv[0], &id) < 0) {
         return JS_UNDEFINED;
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
     key = JS_ToCString(ctx, argv[1]);
-
-    if (handle && key) {
-        cache_bridge_release_value(handle, key);
+    if (key) {
+        cache_bridge_release_value_by_id(id, key);
+        JS_FreeCString(ctx, key);
     }
-
-    if (handle) JS_FreeCString(ctx, handle);
-    if (key) JS_FreeCString(ctx, key);
     return JS_UNDEFINED;
 }
 
 static JSValue qjs_cache_stats(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
     JSValue result;
+    cache_bridge_id_t id;
     const char *handle;
 
     (void)this_val;
 
     result = JS_NewObject(ctx);
-    if (argc < 1) {
+    if (argc < 1 || get_handle_id(ctx, argv[0], &id) < 0) {
         return result;
     }
 
-    handle = JS_ToCString(ctx, argv[0]);
+    handle = cache_bridge_id_handle(id);
     if (handle) {
-        cache_service_t *svc = cache_bridge_get_service(handle);
         cache_service_stats_t stats;
-        if (svc && cache_service_stats(svc, &stats) == 0) {
+        if (cache_bridge_get_stats(handle, &stats) == 0) {
             JS_SetPropertyStr(ctx, result, "entries", JS_NewInt32(ctx, (int32_t)stats.entries));
             JS_SetPropertyStr(ctx, result, "implementation", JS_NewString(ctx, "native_provider"));
             JS_SetPropertyStr(ctx, result, "hits", JS_NewInt64(ctx, (int64_t)stats.hits));
             JS_SetPropertyStr(ctx, result, "misses", JS_NewInt64(ctx, (int64_t)stats.misses));
             JS_SetPropertyStr(ctx, result, "evictions", JS_NewInt64(ctx, (int64_t)stats.evictions));
+            JS_SetPropertyStr(ctx, result, "capacityEntries", JS_NewInt64(ctx, (int64_t)stats.entry_capacity));
+            JS_SetPropertyStr(ctx, result, "storedBytes", JS_NewInt64(ctx, (int64_t)stats.stored_bytes));
+            JS_SetPropertyStr(ctx, result, "fragmentationBytes", JS_NewInt64(ctx, (int64_t)stats.fragmentation_bytes));
+            JS_SetPropertyStr(ctx, result, "compressionSavedBytes", JS_NewInt64(ctx, (int64_t)stats.compression_saved_bytes));
+            JS_SetPropertyStr(ctx, result, "generation", JS_NewInt64(ctx, (int64_t)stats.generation));
+            JS_SetPropertyStr(ctx, result, "invalidations", JS_NewInt64(ctx, (int64_t)stats.invalidations));
         }
-        JS_FreeCString(ctx, handle);
     }
     return result;
 }
 
-int cache_register_quickjs(JSContext *ctx) {
-    JSValue global_obj;
-    JSValue provider_obj;
+static JSValue qjs_cache_new_latency(JSContext *ctx, const cache_latency_histogram_t *latency) {
+    JSValue result = JS_NewObject(ctx);
+    JSValue buckets = JS_NewArray(ctx);
+    size_t i;
 
-    if (ctx == NULL) {
-        return -1;
+    JS_SetPropertyStr(ctx, result, "count", JS_NewInt64(ctx, (int64_t)latency->count));
+    JS_SetPropertyStr(ctx, result, "totalNs", JS_NewInt64(ctx, (int64_t)latency->total_ns));
+    JS_SetPropertyStr(ctx, result, "maxNs", JS_NewInt64(ctx, (int64_t)latency->max_ns));
+    for (i = 0; i < CACHE_METRICS_BUCKETS; ++i) {
+        JS_SetPropertyUint32(ctx, buckets, (uint32_t)i, JS_NewInt64(ctx, (int64_t)latency->buckets[i]));
     }
+    JS_SetPropertyStr(ctx, result, "buckets", buckets);
+    return result;
+}
 
-    global_obj = JS_GetGlobalObject(ctx);
-    provider_obj = JS_NewObject(ctx);
+/* Same shape as the latency/probeHistogram/crossings fields of cache.stats. */
+static JSValue qjs_cache_metrics(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_bridge_crossings_t crossings;
+    cache_service_stats_t stats;
+    JSValue result;
+    JSValue latency;
+    JSValue probes;
+    JSValue crossing_counts;
+    cache_bridge_id_t id;
+    const char *handle;
+    size_t i;
 
-    if (JS_IsException(provider_obj) || JS_IsException(global_obj)) {
-        JS_FreeValue(ctx, provider_obj);
-        JS_FreeValue(ctx, global_obj);
-        return -1;
+    (void)this_val;
+
+    if (argc < 1 || get_handle_id(ctx, argv[0], &id) < 0) {
+        return JS_NULL;
     }
 
-    JS_SetPropertyStr(ctx, provider_obj, "createCache", JS_NewCFunction(ctx, qjs_cache_create, "createCache", 1));
-    JS_SetPropertyStr(ctx, provider_obj, "destroyCache", JS_NewCFunction(ctx, qjs_cache_destroy, "destroyCache", 1));
-    JS_SetPropertyStr(ctx, provider_obj, "get", JS_NewCFunction(ctx, qjs_cache_get, "get", 2));
-    JS_SetPropertyStr(ctx, provider_obj, "set", JS_NewCFunction(ctx, qjs_cache_set, "set", 3));
-    JS_SetPropertyStr(ctx, provider_obj, "has", JS_NewCFunction(ctx, qjs_cache_has, "has", 2));
-    JS_SetPropertyStr(ctx, provider_obj, "clear", JS_NewCFunction(ctx, qjs_cache_clear, "clear", 1));
-    JS_SetPropertyStr(ctx, provider_obj, "pin", JS_NewCFunction(ctx, qjs_cache_pin, "pin", 2));
-    JS_SetPropertyStr(ctx, provider_obj, "release", JS_NewCFunction(ctx, qjs_cache_release, "release", 2));
-    JS_SetPropertyStr(ctx, provider_obj, "stats", JS_NewCFunction(ctx, qjs_cache_stats, "stats", 1));
+    handle = cache_bridge_id_handle(id);
+    if (!handle || cache_bridge_get_stats(handle, &stats) != 0) {
+        return JS_NULL;
+    }
+
+    result = JS_NewObject(ctx);
+    latency = JS_NewObject(ctx);
+    for (i = 0; i < CACHE_OP_COUNT; ++i) {
+        JS_SetPropertyStr(ctx, latency, cache_op_name((cache_op_t)i), qjs_cache_new_latency(ctx, &stats.latency[i]));
+    }
+    JS_SetPropertyStr(ctx, result, "latency", latency);
+
+    probes = JS_NewArray(ctx);
+    for (i = 0; i < PAGE_CACHE_PROBE_BUCKETS; ++i) {
+        JS_SetPropertyUint32(ctx, probes, (uint32_t)i, JS_NewInt64(ctx, (int64_t)stats.probe_histogram[i]));
+    }
+    JS_SetPropertyStr(ctx, result, "probeHistogram", probes);
+
+    cache_bridge_get_crossings(&crossings);
+    crossing_counts = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, crossing_counts, "json", JS_NewInt64(ctx, (int64_t)crossings.json));
+    JS_SetPropertyStr(ctx, crossing_counts, "binary", JS_NewInt64(ctx, (int64_t)crossings.binary));
+    JS_SetPropertyStr(ctx, crossing_counts, "direct", JS_NewInt64(ctx, (int64_t)crossings.direct));
+    JS_SetPropertyStr(ctx, result, "crossings", crossing_counts);
+    return result;
+}
+
+/*
+ * traceDump(reset): the hot-path trace as {enabled, events, counters}.
+ * events holds {span, phase, arg, timestampNs} oldest first, with phase
+ * "begin" or "end"; counters maps each loop counter name to its total.
+ * A truthy reset clears both after the copy. Without a CACHE_TRACE build
+ * enabled is false and both are empty.
+ */
+static JSValue qjs_trace_dump(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    uint64_t counters[CACHE_TRACE_COUNTER_COUNT];
+    cache_trace_event_t *events;
+    JSValue result;
+    JSValue event_list;
+    JSValue counter_map;
+    size_t count;
+    size_t i;
+
+    (void)this_val;
+
+    events = (cache_trace_event_t *)malloc(CACHE_TRACE_RING_LEN * sizeof(*events));
+    if (events == NULL) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    count = cache_trace_snapshot(events, CACHE_TRACE_RING_LEN);
+    cache_trace_counters(counters);
+    if (argc >= 1 && JS_ToBool(ctx, argv[0]) > 0) {
+        cache_trace_reset();
+    }
+
+    result = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, result, "enabled", JS_NewBool(ctx, cache_trace_enabled()));
+
+    event_list = JS_NewArray(ctx);
+    for (i = 0; i < count; ++i) {
+        JSValue event = JS_NewObject(ctx);
+
+        JS_SetPropertyStr(ctx, event, "span",
+                          JS_NewString(ctx, cache_trace_span_name((cache_trace_span_t)events[i].span)));
+        JS_SetPropertyStr(ctx, event, "phase",
+                          JS_NewString(ctx, events[i].phase == CACHE_TRACE_PHASE_BEGIN ? "begin" : "end"));
+        JS_SetPropertyStr(ctx, event, "arg", JS_NewInt64(ctx, (int64_t)events[i].arg));
+        JS_SetPropertyStr(ctx, event, "timestampNs", JS_NewInt64(ctx, (int64_t)events[i].timestamp_ns));
+        JS_SetPropertyUint32(ctx, event_list, (uint32_t)i, event);
+    }
+    JS_SetPropertyStr(ctx, result, "events", event_list);
+    free(events);
+
+    counter_map = JS_NewObject(ctx);
+    for (i = 0; i < CACHE_TRACE_COUNTER_COUNT; ++i) {
+        JS_SetPropertyStr(ctx, counter_map, cache_trace_counter_name((cache_trace_counter_t)i),
+                          JS_NewInt64(ctx, (int64_t)counters[i]));
+    }
+    JS_SetPropertyStr(ctx, result, "counters", counter_map);
+    return result;
+}
+
+/* Doubles calculateInto writes: pdfResult, cdfResult, fromCache */
+#define QJS_CALCULATION_SLOTS 3
+
+/* Reads (distribution, params, x) into request; returns -1 on a malformed request. */
+static int qjs_read_request(JSContext *ctx, JSValueConst distribution_val, JSValueConst params_val,
+                            JSValueConst x_val, calculation_request_t *request) {
+    int32_t distribution;
+    int64_t count;
+    int64_t i;
+
+    memset(request, 0, sizeof(*request));
+    if (JS_ToInt32(ctx, &distribution, distribution_val) < 0 ||
+        (count = qjs_cache_array_length(ctx, params_val)) < 0 || count > MAX_PARAMETERS ||
+        JS_ToFloat64(ctx, &request->input_value, x_val) < 0) {
+        return -1;
+    }
+
+    for (i = 0; i < count; ++i) {
+        JSValue param_val = JS_GetPropertyUint32(ctx, params_val, (uint32_t)i);
+        int rc = JS_ToFloat64(ctx, &request->parameters[i], param_val);
+
+        JS_FreeValue(ctx, param_val);
+        if (rc < 0) {
+            return -1;
+        }
+    }
+    request->distribution = (distribution_type_t)distribution;
+    request->param_count = (uint8_t)count;
+    return 0;
+}
+
+static JSValue qjs_new_calculation(JSContext *ctx, const calculation_result_t *calculation) {
+    JSValue result = JS_NewObject(ctx);
+
+    JS_SetPropertyStr(ctx, result, "success", JS_NewBool(ctx, calculation->success));
+    JS_SetPropertyStr(ctx, result, "pdfResult", JS_NewFloat64(ctx, calculation->pdf_result));
+    JS_SetPropertyStr(ctx, result, "cdfResult", JS_NewFloat64(ctx, calculation->cdf_result));
+    JS_SetPropertyStr(ctx, result, "errorMessage",
+                      calculation->error_message ? JS_NewString(ctx, calculation->error_message) : JS_NULL);
+    JS_SetPropertyStr(ctx, result, "fromCache", JS_NewBool(ctx, calculation->from_cache));
+    JS_SetPropertyStr(ctx, result, "provisional", JS_NewBool(ctx, calculation->provisional));
+    return result;
+}
+
+/*
+ * calculate(distribution, params, x): PDF/PMF and CDF from the C
+ * orchestrator, as {success, pdfResult, cdfResult, errorMessage}.
+ * distribution is a distribution_type_t, params in registry order.
+ */
+static JSValue qjs_calculate(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    calculation_request_t request;
+    calculation_result_t calculation;
+
+    (void)this_val;
+
+    if (argc < 3 || qjs_read_request(ctx, argv[0], argv[1], argv[2], &request) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected distribution, parameter array and x");
+    }
+
+    orchestrator_calculate_with_request(&request, &calculation);
+    return qjs_new_calculation(ctx, &calculation);
+}
+
+/*
+ * calculateInto(distribution, params, x, out): calculate without allocating
+ * a result object. out is a Float64Array of at least QJS_CALCULATION_SLOTS
+ * that receives [pdfResult, cdfResult, fromCache]; callers keep one and
+ * reuse it. Returns success, leaving out untouched on failure.
+ */
+static JSValue qjs_calculate_into(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    calculation_request_t request;
+    calculation_result_t calculation;
+    double slots[QJS_CALCULATION_SLOTS];
+    uint8_t *out;
+    size_t out_len = 0;
+
+    (void)this_val;
+
+    if (argc < 4 || qjs_read_request(ctx, argv[0], argv[1], argv[2], &request) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected distribution, parameter array, x and output array");
+    }
+    /* The caller owns the array, so writing through its backing store is fine */
+    out = (uint8_t *)qjs_cache_buffer_bytes(ctx, argv[3], &out_len);
+    if (out == NULL || out_len < sizeof(slots)) {
+        return JS_ThrowRangeError(ctx, "Output array needs %d doubles", QJS_CALCULATION_SLOTS);
+    }
+
+    orchestrator_calculate_with_request(&request, &calculation);
+    if (!calculation.success) {
+        return JS_NewBool(ctx, 0);
+    }
+
+    slots[0] = calculation.pdf_result;
+    slots[1] = calculation.cdf_result;
+    slots[2] = calculation.from_cache ? 1.0 : 0.0;
+    memcpy(out, slots, sizeof(slots));
+    return JS_NewBool(ctx, 1);
+}
+
+/*
+ * calculateBatch(requests): calculate for an array of
+ * {distribution, params, x} in one crossing, through
+ * orchestrator_calculate_batch, so requests sharing a parameter set are
+ * prepared once. Returns an array of calculate's results in request order.
+ */
+static JSValue qjs_calculate_batch(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    calculation_request_t *requests;
+    calculation_result_t *calculations;
+    JSValue result;
+    int64_t count;
+    int64_t i;
+
+    (void)this_val;
+
+    if (argc < 1 || (count = qjs_cache_array_length(ctx, argv[0])) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected request array");
+    }
+    if (count == 0) {
+        return JS_NewArray(ctx);
+    }
+
+    requests = (calculation_request_t *)malloc((size_t)count * sizeof(*requests));
+    calculations = (calculation_result_t *)malloc((size_t)count * sizeof(*calculations));
+    if (requests == NULL || calculations == NULL) {
+        free(requests);
+        free(calculations);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    for (i = 0; i < count; ++i) {
+        JSValue item = JS_GetPropertyUint32(ctx, argv[0], (uint32_t)i);
+        JSValue distribution_val = JS_GetPropertyStr(ctx, item, "distribution");
+        JSValue params_val = JS_GetPropertyStr(ctx, item, "params");
+        JSValue x_val = JS_GetPropertyStr(ctx, item, "x");
+        int rc = qjs_read_request(ctx, distribution_val, params_val, x_val, &requests[i]);
+
+        JS_FreeValue(ctx, x_val);
+        JS_FreeValue(ctx, params_val);
+        JS_FreeValue(ctx, distribution_val);
+        JS_FreeValue(ctx, item);
+        if (rc < 0) {
+            free(requests);
+            free(calculations);
+            return JS_ThrowTypeError(ctx, "Expected {distribution, params, x} at index %d", (int)i);
+        }
+    }
+
+    orchestrator_calculate_batch(requests, (size_t)count, calculations, NULL);
+
+    result = JS_NewArray(ctx);
+    for (i = 0; i < count; ++i) {
+        JS_SetPropertyUint32(ctx, result, (uint32_t)i, qjs_new_calculation(ctx, &calculations[i]));
+    }
+    free(requests);
+    free(calculations);
+    return result;
+}
+
+/*
+ * calculateProgressive(distribution, params, x): calculate's result plus
+ * {provisional, ticket}. A provisional result carries the exact PDF and a
+ * closed-form CDF preview; runRefinements later returns the exact result
+ * under the same nonzero ticket.
+ */
+static JSValue qjs_calculate_progressive(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    calculation_request_t request;
+    calculation_result_t calculation;
+    uint32_t ticket;
+    JSValue result;
+
+    (void)this_val;
+
+    if (argc < 3 || qjs_read_request(ctx, argv[0], argv[1], argv[2], &request) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected distribution, parameter array and x");
+    }
+
+    orchestrator_calculate_progressive(&request, &calculation, &ticket);
+    result = qjs_new_calculation(ctx, &calculation);
+    JS_SetPropertyStr(ctx, result, "ticket", JS_NewInt64(ctx, (int64_t)ticket));
+    return result;
+}
+
+/*
+ * runRefinements(max): runs up to max queued refinements (all of them when
+ * max is omitted) and returns their exact results, each with its ticket.
+ * Meant for the host's idle hook.
+ */
+static JSValue qjs_run_refinements(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    uint32_t tickets[ORCHESTRATOR_REFINEMENT_QUEUE_LEN];
+    calculation_result_t calculations[ORCHESTRATOR_REFINEMENT_QUEUE_LEN];
+    uint32_t max = ORCHESTRATOR_REFINEMENT_QUEUE_LEN;
+    JSValue result;
+    size_t count;
+    size_t i;
+
+    (void)this_val;
+
+    if (argc >= 1 && !JS_IsUndefined(argv[0]) && JS_ToUint32(ctx, &max, argv[0]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected refinement count");
+    }
+    if (max > ORCHESTRATOR_REFINEMENT_QUEUE_LEN) {
+        max = ORCHESTRATOR_REFINEMENT_QUEUE_LEN;
+    }
+
+    count = orchestrator_run_refinements(tickets, calculations, max);
+    result = JS_NewArray(ctx);
+    for (i = 0; i < count; ++i) {
+        JSValue calculation = qjs_new_calculation(ctx, &calculations[i]);
+
+        JS_SetPropertyStr(ctx, calculation, "ticket", JS_NewInt64(ctx, (int64_t)tickets[i]));
+        JS_SetPropertyUint32(ctx, result, (uint32_t)i, calculation);
+    }
+    return result;
+}
+
+/* setResultCache(capacity): sizes the orchestrator's result cache; 0 disables it. */
+static JSValue qjs_set_result_cache(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    uint32_t capacity;
+
+    (void)this_val;
+
+    if (argc < 1 || JS_ToUint32(ctx, &capacity, argv[0]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected capacity");
+    }
+
+    if (capacity == 0) {
+        orchestrator_disable_result_cache();
+        return JS_NewBool(ctx, 1);
+    }
+
+    return JS_NewBool(ctx, orchestrator_enable_result_cache(capacity) == 0);
+}
+
+/* setTableCache(tables): sizes the shared cache of discrete PMF tables; 0 disables it. */
+static JSValue qjs_set_table_cache(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    uint32_t tables;
+
+    (void)this_val;
+
+    if (argc < 1 || JS_ToUint32(ctx, &tables, argv[0]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected table count");
+    }
+
+    if (tables == 0) {
+        pmf_table_cache_disable();
+        return JS_NewBool(ctx, 1);
+    }
+
+    return JS_NewBool(ctx, pmf_table_cache_enable(tables) == 0);
+}
+
+/* setResultTier(path, maxBytes): attaches the result cache's flash tier; maxBytes 0 persists and detaches it. */
+static JSValue qjs_set_result_tier(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    const char *path;
+    int64_t max_bytes;
+    int rc;
+
+    (void)this_val;
+
+    if (argc < 2 || JS_ToInt64(ctx, &max_bytes, argv[1]) < 0 || max_bytes < 0) {
+        return JS_ThrowTypeError(ctx, "Expected path and maxBytes");
+    }
+
+    orchestrator_detach_result_tier();
+    if (max_bytes == 0) {
+        return JS_NewBool(ctx, 1);
+    }
+
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path) {
+        return JS_EXCEPTION;
+    }
+
+    rc = orchestrator_attach_result_tier(path, (size_t)max_bytes);
+    JS_FreeCString(ctx, path);
+    return JS_NewBool(ctx, rc == 0);
+}
+
+static JSValue qjs_invalidate_results(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+
+    return JS_NewBool(ctx, orchestrator_invalidate_result_cache() == 0);
+}
+
+static JSValue qjs_memory_budget(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_budget_stats_t stats;
+    JSValue result;
+    JSValue accounts;
+    size_t i;
+
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+
+    cache_budget_stats(&stats);
+    result = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, result, "limit", JS_NewInt64(ctx, (int64_t)stats.limit));
+    JS_SetPropertyStr(ctx, result, "usage", JS_NewInt64(ctx, (int64_t)stats.usage));
+    JS_SetPropertyStr(ctx, result, "peakUsage", JS_NewInt64(ctx, (int64_t)stats.peak_usage));
+    JS_SetPropertyStr(ctx, result, "trims", JS_NewInt64(ctx, (int64_t)stats.trims));
+    JS_SetPropertyStr(ctx, result, "trimmedBytes", JS_NewInt64(ctx, (int64_t)stats.trimmed_bytes));
+    JS_SetPropertyStr(ctx, result, "pressureEvents", JS_NewInt64(ctx, (int64_t)stats.pressure_events));
+
+    accounts = JS_NewArray(ctx);
+    for (i = 0; i < stats.account_count; ++i) {
+        JSValue account = JS_NewObject(ctx);
+
+        JS_SetPropertyStr(ctx, account, "name", JS_NewString(ctx, stats.accounts[i].name));
+        JS_SetPropertyStr(ctx, account, "class",
+                          JS_NewString(ctx, cache_budget_class_name(stats.accounts[i].account_class)));
+        JS_SetPropertyStr(ctx, account, "bytes", JS_NewInt64(ctx, (int64_t)stats.accounts[i].bytes));
+        JS_SetPropertyStr(ctx, account, "trimmable", JS_NewBool(ctx, stats.accounts[i].trimmable));
+        JS_SetPropertyUint32(ctx, accounts, (uint32_t)i, account);
+    }
+    JS_SetPropertyStr(ctx, result, "accounts", accounts);
+    return result;
+}
+
+static JSValue qjs_set_memory_budget(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    int64_t limit;
+
+    (void)this_val;
+
+    if (argc < 1 || JS_ToInt64(ctx, &limit, argv[0]) < 0 || limit < 0) {
+        return JS_ThrowTypeError(ctx, "Expected a byte limit");
+    }
+
+    cache_budget_set_limit((size_t)limit);
+    return JS_NewBool(ctx, 1);
+}
+
+/* Returns the bytes freed. */
+static JSValue qjs_memory_pressure(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    cache_budget_pressure_t pressure;
+    const char *level;
+
+    (void)this_val;
+
+    level = argc >= 1 ? JS_ToCString(ctx, argv[0]) : NULL;
+    if (!level) {
+        return JS_ThrowTypeError(ctx, "Expected a pressure level");
+    }
+
+    if (strcmp(level, "moderate") == 0) {
+        pressure = CACHE_BUDGET_PRESSURE_MODERATE;
+    } else if (strcmp(level, "critical") == 0) {
+        pressure = CACHE_BUDGET_PRESSURE_CRITICAL;
+    } else {
+        JS_FreeCString(ctx, level);
+        return JS_ThrowRangeError(ctx, "Unknown pressure level");
+    }
+
+    JS_FreeCString(ctx, level);
+    return JS_NewInt64(ctx, (int64_t)cache_budget_pressure(pressure));
+}
+
+static const char *const qjs_category_names[DISTRIBUTION_CATEGORY_COUNT] = {
+    [DISTRIBUTION_CONTINUOUS] = "continuous",
+    [DISTRIBUTION_DISCRETE] = "discrete"
+};
+
+static JSValue qjs_registry_entry(JSContext *ctx, const distribution_registry_entry_t *entry) {
+    const distribution_model_t *model = &entry->model;
+    JSValue result = JS_NewObject(ctx);
+    JSValue params = JS_NewArray(ctx);
+    uint8_t i;
+
+    for (i = 0; i < model->param_count; ++i) {
+        JSValue param = JS_NewObject(ctx);
+
+        JS_SetPropertyStr(ctx, param, "name", JS_NewString(ctx, model->param_names[i]));
+        JS_SetPropertyStr(ctx, param, "min", JS_NewFloat64(ctx, model->param_ranges[i][0]));
+        JS_SetPropertyStr(ctx, param, "max", JS_NewFloat64(ctx, model->param_ranges[i][1]));
+        JS_SetPropertyUint32(ctx, params, i, param);
+    }
+
+    JS_SetPropertyStr(ctx, result, "id", JS_NewInt32(ctx, (int32_t)entry->type));
+    JS_SetPropertyStr(ctx, result, "name", JS_NewString(ctx, model->name));
+    JS_SetPropertyStr(ctx, result, "description", JS_NewString(ctx, entry->description));
+    JS_SetPropertyStr(ctx, result, "category", JS_NewString(ctx, qjs_category_names[model->category]));
+    JS_SetPropertyStr(ctx, result, "params", params);
+    return result;
+}
+
+/*
+ * registryMetadata(): the whole distribution registry in one crossing, as
+ * {distributions, categories}. distributions is indexed by
+ * distribution_type_t, each {id, name, description, category,
+ * params: [{name, min, max}]}; categories maps each category name to its
+ * type ids. The registry is compile-time const, so JS fetches this once.
+ */
+static JSValue qjs_registry_metadata(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    const distribution_registry_t *registry = get_distribution_registry();
+    JSValue result;
+    JSValue distributions;
+    JSValue categories;
+    uint8_t i;
+    int c;
+
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+
+    result = JS_NewObject(ctx);
+    distributions = JS_NewArray(ctx);
+    for (i = 0; i < registry->total_count; ++i) {
+        JS_SetPropertyUint32(ctx, distributions, i, qjs_registry_entry(ctx, &registry->entries[i]));
+    }
+    JS_SetPropertyStr(ctx, result, "distributions", distributions);
+
+    categories = JS_NewObject(ctx);
+    for (c = 0; c < DISTRIBUTION_CATEGORY_COUNT; ++c) {
+        const distribution_category_list_t *list = &registry->categories[c];
+        JSValue ids = JS_NewArray(ctx);
+
+        for (i = 0; i < list->count; ++i) {
+            JS_SetPropertyUint32(ctx, ids, i, JS_NewInt32(ctx, (int32_t)list->entries[i]->type));
+        }
+        JS_SetPropertyStr(ctx, categories, qjs_category_names[c], ids);
+    }
+    JS_SetPropertyStr(ctx, result, "categories", categories);
+    return result;
+}
+
+static void qjs_series_free(JSRuntime *rt, void *opaque, void *ptr) {
+    (void)rt;
+    (void)opaque;
+    free(ptr);
+}
+
+/* Wraps count malloc'd doubles in a Float64Array that owns them; frees values on failure. */
+static JSValue qjs_new_float64_array(JSContext *ctx, double *values, size_t count) {
+    JSValue buffer = JS_NewArrayBuffer(ctx, (uint8_t *)values, count * sizeof(double), qjs_series_free, NULL, 0);
+    JSValue global_obj;
+    JSValue constructor;
+    JSValue result;
+
+    if (JS_IsException(buffer)) {
+        free(values);
+        return buffer;
+    }
+
+    global_obj = JS_GetGlobalObject(ctx);
+    constructor = JS_GetPropertyStr(ctx, global_obj, "Float64Array");
+    result = JS_CallConstructor(ctx, constructor, 1, &buffer);
+    JS_FreeValue(ctx, constructor);
+    JS_FreeValue(ctx, global_obj);
+    JS_FreeValue(ctx, buffer);
+    return result;
+}
+
+/*
+ * generateSeries(type, params, xMin, xMax, n, handle?, key?): n PDF/PMF
+ * samples over [xMin, xMax] as a Float64Array that owns the native buffer.
+ * With handle and key the same bytes are stored in that cache, for getBuffer
+ * to read back, when they fit in a page. Returns null for invalid parameters.
+ */
+static JSValue qjs_generate_series(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    distribution_prepared_t prepared;
+    double params[MAX_PARAMETERS];
+    double x_min;
+    double x_max;
+    double *series;
+    int32_t type;
+    int64_t param_count;
+    int64_t count;
+    int64_t i;
+
+    (void)this_val;
+
+    if (argc < 5 ||
+        JS_ToInt32(ctx, &type, argv[0]) < 0 ||
+        (param_count = qjs_cache_array_length(ctx, argv[1])) < 0 || param_count > MAX_PARAMETERS ||
+        JS_ToFloat64(ctx, &x_min, argv[2]) < 0 ||
+        JS_ToFloat64(ctx, &x_max, argv[3]) < 0 ||
+        JS_ToInt64(ctx, &count, argv[4]) < 0 ||
+        count < 1 || count > QJS_SERIES_MAX_POINTS) {
+        return JS_ThrowTypeError(ctx, "Expected type, parameter array, xMin, xMax and n");
+    }
+
+    for (i = 0; i < param_count; ++i) {
+        JSValue param_val = JS_GetPropertyUint32(ctx, argv[1], (uint32_t)i);
+        int rc = JS_ToFloat64(ctx, &params[i], param_val);
+
+        JS_FreeValue(ctx, param_val);
+        if (rc < 0) {
+            return JS_EXCEPTION;
+        }
+    }
+
+    series = malloc((size_t)count * sizeof(double));
+    if (!series) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    /* Unit-spaced discrete ranges are copied from the parameters' PMF table */
+    if (!isfinite(x_min) || !isfinite(x_max) || x_max < x_min ||
+        distribution_prepare((distribution_type_t)type, params, (int)param_count, &prepared) != 0 ||
+        (pmf_table_cache_series(&prepared, x_min, x_max, (size_t)count, series) != 0 &&
+         distribution_prepared_series(&prepared, x_min, x_max, (size_t)count, series) != 0)) {
+        free(series);
+        return JS_NULL;
+    }
+
+    if (argc > 6 && !JS_IsUndefined(argv[5])) {
+        cache_bridge_id_t id;
+        const char *key;
+
+        if (get_handle_id(ctx, argv[5], &id) < 0 || !(key = JS_ToCString(ctx, argv[6]))) {
+            free(series);
+            return JS_EXCEPTION;
+        }
+        cache_bridge_set_value_cost_by_id(id, key, (const uint8_t *)series, (size_t)count * sizeof(double), 0);
+        JS_FreeCString(ctx, key);
+    }
+
+    return qjs_new_float64_array(ctx, series, (size_t)count);
+}
+
+/*
+ * adaptiveSeries(type, params, xMin, xMax, widthPx, heightPx, maxEvaluations,
+ * handle?, key?): the PDF sampled for a widthPx by heightPx chart, refined
+ * only where it bends or steps by more than a pixel threshold, as a
+ * Float64Array of interleaved x, y pairs. The same width gives the same
+ * points, so with handle and key (which should name the width) the bytes are
+ * stored in that cache per level of detail, as generateSeries does. Returns
+ * null for invalid parameters.
+ */
+static JSValue qjs_adaptive_series(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    double params[MAX_PARAMETERS];
+    double x_min;
+    double x_max;
+    double *samples;
+    double *series;
+    int32_t type;
+    int32_t width_px;
+    int32_t height_px;
+    int64_t param_count;
+    int64_t max_evaluations;
+    size_t count;
+    size_t i;
+
+    (void)this_val;
+
+    if (argc < 7 ||
+        JS_ToInt32(ctx, &type, argv[0]) < 0 ||
+        (param_count = qjs_cache_array_length(ctx, argv[1])) < 0 || param_count > MAX_PARAMETERS ||
+        JS_ToFloat64(ctx, &x_min, argv[2]) < 0 ||
+        JS_ToFloat64(ctx, &x_max, argv[3]) < 0 ||
+        JS_ToInt32(ctx, &width_px, argv[4]) < 0 ||
+        JS_ToInt32(ctx, &height_px, argv[5]) < 0 ||
+        JS_ToInt64(ctx, &max_evaluations, argv[6]) < 0 ||
+        max_evaluations < 2 || max_evaluations > QJS_SERIES_MAX_POINTS) {
+        return JS_ThrowTypeError(ctx, "Expected type, parameter array, xMin, xMax, widthPx, heightPx and maxEvaluations");
+    }
+
+    for (i = 0; i < (size_t)param_count; ++i) {
+        JSValue param_val = JS_GetPropertyUint32(ctx, argv[1], (uint32_t)i);
+        int rc = JS_ToFloat64(ctx, &params[i], param_val);
+
+        JS_FreeValue(ctx, param_val);
+        if (rc < 0) {
+            return JS_EXCEPTION;
+        }
+    }
+
+    /* x then y, interleaved into series once the count is known */
+    samples = malloc(2 * (size_t)max_evaluations * sizeof(double));
+    if (!samples) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    if (distribution_adaptive_series((distribution_type_t)type, params, (int)param_count, x_min, x_max,
+                                     width_px, height_px, (size_t)max_evaluations,
+                                     samples, samples + max_evaluations, &count) != 0) {
+        free(samples);
+        return JS_NULL;
+    }
+
+    series = malloc(2 * count * sizeof(double));
+    if (!series) {
+        free(samples);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    for (i = 0; i < count; ++i) {
+        series[2 * i] = samples[i];
+        series[2 * i + 1] = samples[max_evaluations + i];
+    }
+    free(samples);
+
+    if (argc > 8 && !JS_IsUndefined(argv[7])) {
+        cache_bridge_id_t id;
+        const char *key;
+
+        if (get_handle_id(ctx, argv[7], &id) < 0 || !(key = JS_ToCString(ctx, argv[8]))) {
+            free(series);
+            return JS_EXCEPTION;
+        }
+        cache_bridge_set_value_cost_by_id(id, key, (const uint8_t *)series, 2 * count * sizeof(double), 0);
+        JS_FreeCString(ctx, key);
+    }
+
+    return qjs_new_float64_array(ctx, series, 2 * count);
+}
+
+static JSValue qjs_log_factorial(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    int32_t n;
+
+    (void)this_val;
+
+    if (argc < 1 || JS_ToInt32(ctx, &n, argv[0]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected n");
+    }
+    if (n < 0) {
+        return JS_NewFloat64(ctx, NAN);
+    }
+    return JS_NewFloat64(ctx, cache_bridge_log_factorial((size_t)n));
+}
+
+static JSValue qjs_log_combination(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    int32_t n;
+    int32_t k;
+
+    (void)this_val;
+
+    if (argc < 2 || JS_ToInt32(ctx, &n, argv[0]) < 0 || JS_ToInt32(ctx, &k, argv[1]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected n and k");
+    }
+    if (n < 0 || k < 0 || k > n) {
+        return JS_NewFloat64(ctx, -INFINITY);
+    }
+    return JS_NewFloat64(ctx, cache_bridge_log_combination((size_t)n, (size_t)k));
+}
+
+static JSValue qjs_log_gamma(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    double x;
+
+    (void)this_val;
+
+    if (argc < 1 || JS_ToFloat64(ctx, &x, argv[0]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected x");
+    }
+    return JS_NewFloat64(ctx, cache_bridge_log_gamma(x));
+}
+
+static double get_prop_double(JSContext *ctx, JSValueConst obj, const char *prop, double default_val) {
+    JSValue val = JS_GetPropertyStr(ctx, obj, prop);
+    double res;
+
+    if (JS_IsUndefined(val) || JS_IsException(val) || JS_ToFloat64(ctx, &res, val) < 0) {
+        JS_FreeValue(ctx, val);
+        return default_val;
+    }
+    JS_FreeValue(ctx, val);
+    return res;
+}
+
+/*
+ * Copies the numeric array in obj[prop] into a malloc'd buffer (Number()
+ * coercion, so holes read as NaN). A missing or non-array property gives
+ * *out_values NULL and -1 in *out_count. Returns -1 with an exception pending
+ * if a conversion throws or the copy cannot be allocated.
+ */
+static int qjs_read_doubles(JSContext *ctx, JSValueConst obj, const char *prop,
+                            double **out_values, int64_t *out_count) {
+    JSValue array = JS_GetPropertyStr(ctx, obj, prop);
+    double *values;
+    int64_t count;
+    int64_t i;
+
+    *out_values = NULL;
+    *out_count = -1;
+
+    if (JS_IsException(array)) {
+        return -1;
+    }
+
+    count = qjs_cache_array_length(ctx, array);
+    if (count < 0) {
+        JS_FreeValue(ctx, array);
+        return 0;
+    }
+
+    values = malloc((size_t)(count > 0 ? count : 1) * sizeof(double));
+    if (!values) {
+        JS_FreeValue(ctx, array);
+        JS_ThrowOutOfMemory(ctx);
+        return -1;
+    }
+
+    for (i = 0; i < count; ++i) {
+        JSValue item = JS_GetPropertyUint32(ctx, array, (uint32_t)i);
+        int rc = JS_ToFloat64(ctx, &values[i], item);
+
+        JS_FreeValue(ctx, item);
+        if (rc < 0) {
+            free(values);
+            JS_FreeValue(ctx, array);
+            return -1;
+        }
+    }
+
+    JS_FreeValue(ctx, array);
+    *out_values = values;
+    *out_count = count;
+    return 0;
+}
+
+/*
+ * Row-major copy of the table in obj.matrix; the column count is taken from
+ * its first row, as hypothesis_engine.js does.
+ */
+static int qjs_read_matrix(JSContext *ctx, JSValueConst obj, double **out_values, int64_t *out_rows,
+                           int64_t *out_cols) {
+    JSValue matrix = JS_GetPropertyStr(ctx, obj, "matrix");
+    JSValue row;
+    double *values;
+    int64_t rows;
+    int64_t cols = -1;
+    int64_t i;
+    int64_t j;
+
+    *out_values = NULL;
+    *out_rows = 0;
+    *out_cols = 0;
+
+    if (JS_IsException(matrix)) {
+        return -1;
+    }
+
+    rows = qjs_cache_array_length(ctx, matrix);
+    if (rows > 0) {
+        row = JS_GetPropertyUint32(ctx, matrix, 0);
+        cols = qjs_cache_array_length(ctx, row);
+        JS_FreeValue(ctx, row);
+    }
+    if (rows < 2 || cols < 2) {
+        JS_FreeValue(ctx, matrix);
+        return 0;
+    }
+
+    values = malloc((size_t)rows * (size_t)cols * sizeof(double));
+    if (!values) {
+        JS_FreeValue(ctx, matrix);
+        JS_ThrowOutOfMemory(ctx);
+        return -1;
+    }
+
+    for (i = 0; i < rows; ++i) {
+        row = JS_GetPropertyUint32(ctx, matrix, (uint32_t)i);
+        for (j = 0; j < cols; ++j) {
+            JSValue item = JS_GetPropertyUint32(ctx, row, (uint32_t)j);
+            int rc = JS_ToFloat64(ctx, &values[i * cols + j], item);
+
+            JS_FreeValue(ctx, item);
+            if (rc < 0) {
+                JS_FreeValue(ctx, row);
+                JS_FreeValue(ctx, matrix);
+                free(values);
+                return -1;
+            }
+        }
+        JS_FreeValue(ctx, row);
+    }
+
+    JS_FreeValue(ctx, matrix);
+    *out_values = values;
+    *out_rows = rows;
+    *out_cols = cols;
+    return 0;
+}
+
+/* sampleStats(data): {n, mean, s, variance} of the finite values, one Welford pass with no copy. */
+static JSValue qjs_sample_stats(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    hypothesis_moments_t moments;
+    JSValue result;
+    double *values = NULL;
+    size_t finite = 0;
+    int64_t count;
+    int64_t i;
+
+    (void)this_val;
+
+    count = argc > 0 ? qjs_cache_array_length(ctx, argv[0]) : -1;
+    if (count > 0) {
+        values = malloc((size_t)count * sizeof(double));
+        if (!values) {
+            return JS_ThrowOutOfMemory(ctx);
+        }
+    }
+    for (i = 0; i < count; ++i) {
+        JSValue item = JS_GetPropertyUint32(ctx, argv[0], (uint32_t)i);
+        double value;
+
+        /* Only numbers count, like Number.isFinite: no string coercion */
+        if (JS_IsNumber(item) && JS_ToFloat64(ctx, &value, item) == 0 && isfinite(value)) {
+            values[finite++] = value;
+        }
+        JS_FreeValue(ctx, item);
+    }
+
+    /* Gathered values are all finite, so this is the vectorized two-pass path */
+    hypothesis_sample_moments(values, finite, &moments);
+    free(values);
+
+    result = JS_NewObject(ctx);
+    if (moments.n == 0) {
+        JS_SetPropertyStr(ctx, result, "n", JS_NewInt64(ctx, 0));
+        JS_SetPropertyStr(ctx, result, "mean", JS_NewFloat64(ctx, 0.0));
+        JS_SetPropertyStr(ctx, result, "s", JS_NewFloat64(ctx, 0.0));
+        JS_SetPropertyStr(ctx, result, "variance", JS_NewFloat64(ctx, 0.0));
+        return result;
+    }
+
+    JS_SetPropertyStr(ctx, result, "n", JS_NewInt64(ctx, (int64_t)moments.n));
+    JS_SetPropertyStr(ctx, result, "mean", JS_NewFloat64(ctx, moments.mean));
+    JS_SetPropertyStr(ctx, result, "s", JS_NewFloat64(ctx, sqrt(hypothesis_moments_variance(&moments))));
+    JS_SetPropertyStr(ctx, result, "variance", JS_NewFloat64(ctx, hypothesis_moments_variance(&moments)));
+    return result;
+}
+
+static JSValue qjs_hypothesis_error(JSContext *ctx, hypothesis_error_t error) {
+    JSValue result;
+    const char *message = hypothesis_error_message(error);
+
+    if (error == HYPOTHESIS_ERROR_OUT_OF_MEMORY) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    result = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, result, "error", JS_NewString(ctx, hypothesis_error_code(error)));
+    if (message) {
+        JS_SetPropertyStr(ctx, result, "message", JS_NewString(ctx, message));
+    }
+    return result;
+}
+
+/* Nullable number, for the slope interval of an exact fit */
+static JSValue qjs_new_optional_float(JSContext *ctx, int present, double value) {
+    return present ? JS_NewFloat64(ctx, value) : JS_NULL;
+}
+
+/* Result object of the Z, t and F tests, with hypothesis_engine.js field names. */
+static JSValue qjs_hypothesis_result(JSContext *ctx, const char *statistic_name, const hypothesis_result_t *test,
+                                     int has_df, int has_ci, int paired) {
+    JSValue result = JS_NewObject(ctx);
+
+    JS_SetPropertyStr(ctx, result, statistic_name, JS_NewFloat64(ctx, test->statistic));
+    if (has_df) {
+        JS_SetPropertyStr(ctx, result, "df", JS_NewFloat64(ctx, test->df));
+    }
+    JS_SetPropertyStr(ctx, result, "pValueTwoTail", JS_NewFloat64(ctx, test->p_two_tail));
+    JS_SetPropertyStr(ctx, result, "pValueLeft", JS_NewFloat64(ctx, test->p_left));
+    JS_SetPropertyStr(ctx, result, "pValueRight", JS_NewFloat64(ctx, test->p_right));
+    if (has_ci) {
+        JS_SetPropertyStr(ctx, result, "lowerCI", JS_NewFloat64(ctx, test->lower_ci));
+        JS_SetPropertyStr(ctx, result, "upperCI", JS_NewFloat64(ctx, test->upper_ci));
+    }
+    if (paired) {
+        JS_SetPropertyStr(ctx, result, "meanDiff", JS_NewFloat64(ctx, test->mean_diff));
+        JS_SetPropertyStr(ctx, result, "sDiff", JS_NewFloat64(ctx, test->s_diff));
+    }
+    return result;
+}
+
+static JSValue qjs_chi_square_result(JSContext *ctx, const hypothesis_result_t *test) {
+    JSValue result = JS_NewObject(ctx);
+
+    JS_SetPropertyStr(ctx, result, "chiSquare", JS_NewFloat64(ctx, test->statistic));
+    JS_SetPropertyStr(ctx, result, "df", JS_NewFloat64(ctx, test->df));
+    JS_SetPropertyStr(ctx, result, "pValue", JS_NewFloat64(ctx, test->p_right));
+    return result;
+}
+
+static JSValue qjs_regression_result(JSContext *ctx, const hypothesis_regression_t *fit) {
+    JSValue result = JS_NewObject(ctx);
+
+    JS_SetPropertyStr(ctx, result, "a", JS_NewFloat64(ctx, fit->intercept));
+    JS_SetPropertyStr(ctx, result, "b", JS_NewFloat64(ctx, fit->slope));
+    JS_SetPropertyStr(ctx, result, "slope", JS_NewFloat64(ctx, fit->slope));
+    JS_SetPropertyStr(ctx, result, "intercept", JS_NewFloat64(ctx, fit->intercept));
+    JS_SetPropertyStr(ctx, result, "r", JS_NewFloat64(ctx, fit->r));
+    JS_SetPropertyStr(ctx, result, "rSquared", JS_NewFloat64(ctx, fit->r_squared));
+    JS_SetPropertyStr(ctx, result, "t", JS_NewFloat64(ctx, fit->t));
+    JS_SetPropertyStr(ctx, result, "df", JS_NewFloat64(ctx, fit->df));
+    JS_SetPropertyStr(ctx, result, "pValueTwoTail", JS_NewFloat64(ctx, fit->p_two_tail));
+    JS_SetPropertyStr(ctx, result, "lowerCISlope", qjs_new_optional_float(ctx, fit->has_ci, fit->lower_ci_slope));
+    JS_SetPropertyStr(ctx, result, "upperCISlope", qjs_new_optional_float(ctx, fit->has_ci, fit->upper_ci_slope));
+    return result;
+}
+
+/* Array-input tests: tTestPaired, chiSquareGoodnessOfFit, linearRegression and chiSquareIndependence. */
+static JSValue qjs_hypothesis_array_test(JSContext *ctx, const char *kind, JSValueConst options) {
+    hypothesis_result_t test;
+    hypothesis_regression_t fit;
+    hypothesis_error_t error;
+    double alpha = get_prop_double(ctx, options, "alpha", 0.05);
+    double *first = NULL;
+    double *second = NULL;
+    int64_t first_count;
+    int64_t second_count;
+    const char *first_name;
+    const char *second_name;
+    int paired = 0;
+    int regression = 0;
+    size_t count;
+    JSValue result;
+
+    if (strcmp(kind, "chiSquareIndependence") == 0) {
+        int64_t rows;
+        int64_t cols;
+
+        if (qjs_read_matrix(ctx, options, &first, &rows, &cols) < 0) {
+            return JS_EXCEPTION;
+        }
+        error = hypothesis_chi_square_independence(first, (size_t)rows, (size_t)cols, &test);
+        free(first);
+        return error == HYPOTHESIS_SUCCESS ? qjs_chi_square_result(ctx, &test) : qjs_hypothesis_error(ctx, error);
+    }
+
+    if (strcmp(kind, "tTestPaired") == 0) {
+        first_name = "sample1";
+        second_name = "sample2";
+        paired = 1;
+    } else if (strcmp(kind, "chiSquareGoodnessOfFit") == 0) {
+        first_name = "observed";
+        second_name = "expected";
+    } else if (strcmp(kind, "linearRegression") == 0) {
+        first_name = "x";
+        second_name = "y";
+        regression = 1;
+    } else {
+        return JS_ThrowTypeError(ctx, "Unknown hypothesis test");
+    }
+
+    if (qjs_read_doubles(ctx, options, first_name, &first, &first_count) < 0 ||
+        qjs_read_doubles(ctx, options, second_name, &second, &second_count) < 0) {
+        free(first);
+        return JS_EXCEPTION;
+    }
+
+    /* Missing or mismatched arrays reach the kernels as empty input, which they reject */
+    count = (first_count >= 0 && first_count == second_count) ? (size_t)first_count : 0;
+
+    if (paired) {
+        error = hypothesis_t_test_paired(first, second, count, alpha, &test);
+        result = error == HYPOTHESIS_SUCCESS ? qjs_hypothesis_result(ctx, "t", &test, 1, 1, 1)
+                                             : qjs_hypothesis_error(ctx, error);
+    } else if (regression) {
+        error = hypothesis_linear_regression(first, second, count, alpha, &fit);
+        result = error == HYPOTHESIS_SUCCESS ? qjs_regression_result(ctx, &fit) : qjs_hypothesis_error(ctx, error);
+    } else {
+        error = hypothesis_chi_square_goodness_of_fit(first, second, count, &test);
+        result = error == HYPOTHESIS_SUCCESS ? qjs_chi_square_result(ctx, &test) : qjs_hypothesis_error(ctx, error);
+    }
+
+    free(first);
+    free(second);
+    return result;
+}
+
+/*
+ * hypothesisTest(kind, options): runs the HypothesisEngine method named kind
+ * natively (hypothesis_kernels.h). options holds that method's named
+ * parameters; array-input tests take sample1/sample2, observed/expected,
+ * x/y or matrix. Returns the same result shape as the JS method, or
+ * {error, message?} for rejected input.
+ */
+static JSValue qjs_hypothesis_test(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    hypothesis_result_t test;
+    hypothesis_error_t error;
+    const char *kind;
+    JSValueConst options;
+    double alpha;
+    double diff;
+    JSValue result;
+
+    (void)this_val;
+
+    if (argc < 2 || !JS_IsObject(argv[1]) || !(kind = JS_ToCString(ctx, argv[0]))) {
+        return JS_ThrowTypeError(ctx, "Expected test name and options");
+    }
+    options = argv[1];
+    alpha = get_prop_double(ctx, options, "alpha", 0.05);
+    diff = get_prop_double(ctx, options, "diff", 0.0);
+
+    if (strcmp(kind, "zTestOneSample") == 0) {
+        error = hypothesis_z_test_one_sample(get_prop_double(ctx, options, "mean", NAN),
+                                             get_prop_double(ctx, options, "n", NAN),
+                                             get_prop_double(ctx, options, "sigma", NAN),
+                                             get_prop_double(ctx, options, "mu0", NAN), alpha, &test);
+        result = error == HYPOTHESIS_SUCCESS ? qjs_hypothesis_result(ctx, "z", &test, 0, 1, 0)
+                                             : qjs_hypothesis_error(ctx, error);
+    } else if (strcmp(kind, "zTestTwoSample") == 0) {
+        error = hypothesis_z_test_two_sample(get_prop_double(ctx, options, "mean1", NAN),
+                                             get_prop_double(ctx, options, "n1", NAN),
+                                             get_prop_double(ctx, options, "sigma1", NAN),
+                                             get_prop_double(ctx, options, "mean2", NAN),
+                                             get_prop_double(ctx, options, "n2", NAN),
+                                             get_prop_double(ctx, options, "sigma2", NAN), diff, alpha, &test);
+        result = error == HYPOTHESIS_SUCCESS ? qjs_hypothesis_result(ctx, "z", &test, 0, 1, 0)
+                                             : qjs_hypothesis_error(ctx, error);
+    } else if (strcmp(kind, "tTestOneSample") == 0) {
+        error = hypothesis_t_test_one_sample(get_prop_double(ctx, options, "mean", NAN),
+                                             get_prop_double(ctx, options, "n", NAN),
+                                             get_prop_double(ctx, options, "s", NAN),
+                                             get_prop_double(ctx, options, "mu0", NAN), alpha, &test);
+        result = error == HYPOTHESIS_SUCCESS ? qjs_hypothesis_result(ctx, "t", &test, 1, 1, 0)
+                                             : qjs_hypothesis_error(ctx, error);
+    } else if (strcmp(kind, "tTestTwoSample") == 0) {
+        JSValue equal_val = JS_GetPropertyStr(ctx, options, "equalVariances");
+        int equal_variances = JS_ToBool(ctx, equal_val) > 0;
+
+        JS_FreeValue(ctx, equal_val);
+        error = hypothesis_t_test_two_sample(get_prop_double(ctx, options, "mean1", NAN),
+                                             get_prop_double(ctx, options, "n1", NAN),
+                                             get_prop_double(ctx, options, "s1", NAN),
+                                             get_prop_double(ctx, options, "mean2", NAN),
+                                             get_prop_double(ctx, options, "n2", NAN),
+                                             get_prop_double(ctx, options, "s2", NAN),
+                                             equal_variances, diff, alpha, &test);
+        result = error == HYPOTHESIS_SUCCESS ? qjs_hypothesis_result(ctx, "t", &test, 1, 1, 0)
+                                             : qjs_hypothesis_error(ctx, error);
+    } else if (strcmp(kind, "fTestTwoSample") == 0) {
+        error = hypothesis_f_test_two_sample(get_prop_double(ctx, options, "s1", NAN),
+                                             get_prop_double(ctx, options, "n1", NAN),
+                                             get_prop_double(ctx, options, "s2", NAN),
+                                             get_prop_double(ctx, options, "n2", NAN), &test);
+        if (error == HYPOTHESIS_SUCCESS) {
+            result = JS_NewObject(ctx);
+            JS_SetPropertyStr(ctx, result, "f", JS_NewFloat64(ctx, test.statistic));
+            JS_SetPropertyStr(ctx, result, "df1", JS_NewFloat64(ctx, test.df));
+            JS_SetPropertyStr(ctx, result, "df2", JS_NewFloat64(ctx, test.df2));
+            JS_SetPropertyStr(ctx, result, "pValueLeft", JS_NewFloat64(ctx, test.p_left));
+            JS_SetPropertyStr(ctx, result, "pValueRight", JS_NewFloat64(ctx, test.p_right));
+            JS_SetPropertyStr(ctx, result, "pValueTwoTail", JS_NewFloat64(ctx, test.p_two_tail));
+        } else {
+            result = qjs_hypothesis_error(ctx, error);
+        }
+    } else {
+        result = qjs_hypothesis_array_test(ctx, kind, options);
+    }
+
+    JS_FreeCString(ctx, kind);
+    return result;
+}
+
+/* Tail names used by tail_type_select; anything else is two-tailed. */
+static hypothesis_tail_t qjs_read_tail(JSContext *ctx, JSValueConst options) {
+    const char *tail = get_prop_str(ctx, options, "tail");
+    hypothesis_tail_t result = HYPOTHESIS_TAIL_TWO;
+
+    if (tail) {
+        if (strcmp(tail, "left_tail") == 0) {
+            result = HYPOTHESIS_TAIL_LEFT;
+        } else if (strcmp(tail, "right_tail") == 0) {
+            result = HYPOTHESIS_TAIL_RIGHT;
+        }
+        JS_FreeCString(ctx, tail);
+    }
+    return result;
+}
+
+/*
+ * hypothesisSummary(kind, options): one native pass filling a Z or t result
+ * page. kind and options are those of hypothesisTest (zTestOneSample,
+ * zTestTwoSample, tTestOneSample, tTestTwoSample) plus tail ("two_tail",
+ * "left_tail", "right_tail") and levels (confidence levels, default
+ * 0.90/0.95/0.99). The result is the hypothesisTest object with pValue,
+ * reject, estimate, standardError, criticalValue, intervals [{ level, lower,
+ * upper }], effectSize and power added.
+ */
+static JSValue qjs_hypothesis_summary(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    static const double default_levels[] = {0.90, 0.95, 0.99};
+    hypothesis_summary_request_t request;
+    hypothesis_summary_t summary;
+    hypothesis_error_t error;
+    const char *kind;
+    JSValueConst options;
+    double *levels;
+    int64_t level_count;
+    int64_t i;
+    int is_z;
+    JSValue result;
+    JSValue intervals;
+
+    (void)this_val;
+
+    if (argc < 2 || !JS_IsObject(argv[1]) || !(kind = JS_ToCString(ctx, argv[0]))) {
+        return JS_ThrowTypeError(ctx, "Expected test name and options");
+    }
+    options = argv[1];
+    memset(&request, 0, sizeof(request));
+
+    is_z = strcmp(kind, "zTestOneSample") == 0 || strcmp(kind, "zTestTwoSample") == 0;
+    if (strcmp(kind, "zTestOneSample") == 0 || strcmp(kind, "tTestOneSample") == 0) {
+        request.kind = is_z ? HYPOTHESIS_SUMMARY_Z_ONE_SAMPLE : HYPOTHESIS_SUMMARY_T_ONE_SAMPLE;
+        request.mean1 = get_prop_double(ctx, options, "mean", NAN);
+        request.n1 = get_prop_double(ctx, options, "n", NAN);
+        request.spread1 = get_prop_double(ctx, options, is_z ? "sigma" : "s", NAN);
+        request.null_value = get_prop_double(ctx, options, "mu0", NAN);
+    } else if (strcmp(kind, "zTestTwoSample") == 0 || strcmp(kind, "tTestTwoSample") == 0) {
+        if (is_z) {
+            request.kind = HYPOTHESIS_SUMMARY_Z_TWO_SAMPLE;
+        } else {
+            JSValue equal_val = JS_GetPropertyStr(ctx, options, "equalVariances");
+
+            request.kind = JS_ToBool(ctx, equal_val) > 0 ? HYPOTHESIS_SUMMARY_T_POOLED : HYPOTHESIS_SUMMARY_T_WELCH;
+            JS_FreeValue(ctx, equal_val);
+        }
+        request.mean1 = get_prop_double(ctx, options, "mean1", NAN);
+        request.n1 = get_prop_double(ctx, options, "n1", NAN);
+        request.spread1 = get_prop_double(ctx, options, is_z ? "sigma1" : "s1", NAN);
+        request.mean2 = get_prop_double(ctx, options, "mean2", NAN);
+        request.n2 = get_prop_double(ctx, options, "n2", NAN);
+        request.spread2 = get_prop_double(ctx, options, is_z ? "sigma2" : "s2", NAN);
+        request.null_value = get_prop_double(ctx, options, "diff", 0.0);
+    } else {
+        JS_FreeCString(ctx, kind);
+        return JS_ThrowRangeError(ctx, "Unknown summary test");
+    }
+    JS_FreeCString(ctx, kind);
+
+    request.tail = qjs_read_tail(ctx, options);
+    request.alpha = get_prop_double(ctx, options, "alpha", 0.05);
+
+    if (qjs_read_doubles(ctx, options, "levels", &levels, &level_count) < 0) {
+        return JS_EXCEPTION;
+    }
+    if (level_count < 0) {
+        level_count = (int64_t)(sizeof(default_levels) / sizeof(default_levels[0]));
+        memcpy(request.levels, default_levels, sizeof(default_levels));
+    } else if (level_count <= HYPOTHESIS_SUMMARY_MAX_LEVELS) {
+        memcpy(request.levels, levels, (size_t)level_count * sizeof(double));
+    }
+    free(levels);
+    if (level_count > HYPOTHESIS_SUMMARY_MAX_LEVELS) {
+        return JS_ThrowRangeError(ctx, "Too many confidence levels");
+    }
+    request.level_count = (size_t)level_count;
+
+    error = hypothesis_summary(&request, &summary);
+    if (error != HYPOTHESIS_SUCCESS) {
+        return qjs_hypothesis_error(ctx, error);
+    }
+
+    result = qjs_hypothesis_result(ctx, is_z ? "z" : "t", &summary.test, !is_z, 1, 0);
+    intervals = JS_NewArray(ctx);
+    for (i = 0; i < (int64_t)summary.level_count; ++i) {
+        JSValue interval = JS_NewObject(ctx);
+
+        JS_SetPropertyStr(ctx, interval, "level", JS_NewFloat64(ctx, summary.levels[i]));
+        JS_SetPropertyStr(ctx, interval, "lower", JS_NewFloat64(ctx, summary.lower[i]));
+        JS_SetPropertyStr(ctx, interval, "upper", JS_NewFloat64(ctx, summary.upper[i]));
+        JS_SetPropertyUint32(ctx, intervals, (uint32_t)i, interval);
+    }
+    JS_SetPropertyStr(ctx, result, "pValue", JS_NewFloat64(ctx, summary.p_value));
+    JS_SetPropertyStr(ctx, result, "reject", JS_NewBool(ctx, summary.reject));
+    JS_SetPropertyStr(ctx, result, "estimate", JS_NewFloat64(ctx, summary.estimate));
+    JS_SetPropertyStr(ctx, result, "standardError", JS_NewFloat64(ctx, summary.standard_error));
+    JS_SetPropertyStr(ctx, result, "criticalValue", JS_NewFloat64(ctx, summary.critical_value));
+    JS_SetPropertyStr(ctx, result, "intervals", intervals);
+    JS_SetPropertyStr(ctx, result, "effectSize", JS_NewFloat64(ctx, summary.effect_size));
+    JS_SetPropertyStr(ctx, result, "power", JS_NewFloat64(ctx, summary.power));
+    return result;
+}
+
+/*
+ * Online regression state lives in an ArrayBuffer that owns a native
+ * hypothesis_regression_accumulator_t, so the JS garbage collector frees it.
+ * Returns NULL with a TypeError pending for anything else.
+ */
+static void *qjs_native_state(JSContext *ctx, JSValueConst value, size_t expected_size, const char *message) {
+    size_t size;
+    uint8_t *data = JS_GetArrayBuffer(ctx, &size, value);
+
+    if (!data || size != expected_size) {
+        if (!data) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+        }
+        JS_ThrowTypeError(ctx, "%s", message);
+        return NULL;
+    }
+    return (void *)data;
+}
+
+/* Wraps a malloc'd native state in an ArrayBuffer that frees it; frees state on failure. */
+static JSValue qjs_new_native_state(JSContext *ctx, void *state, size_t size) {
+    JSValue buffer = JS_NewArrayBuffer(ctx, (uint8_t *)state, size, qjs_series_free, NULL, 0);
+
+    if (JS_IsException(buffer)) {
+        free(state);
+    }
+    return buffer;
+}
+
+static hypothesis_regression_accumulator_t *qjs_regression_state(JSContext *ctx, JSValueConst value) {
+    return (hypothesis_regression_accumulator_t *)qjs_native_state(
+        ctx, value, sizeof(hypothesis_regression_accumulator_t), "Expected regression state");
+}
+
+/* createRegression(): empty online regression state for the regression* calls below. */
+static JSValue qjs_create_regression(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    hypothesis_regression_accumulator_t *acc;
+
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+
+    acc = malloc(sizeof(*acc));
+    if (!acc) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    hypothesis_accumulator_init(acc);
+    return qjs_new_native_state(ctx, acc, sizeof(*acc));
+}
+
+/* Reads count numbers from argv[first] on; returns -1 with an exception pending. */
+static int qjs_read_float_args(JSContext *ctx, JSValueConst *argv, int first, int count, double *out) {
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        if (JS_ToFloat64(ctx, &out[i], argv[first + i]) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* regressionAdd(state, x, y): false for a non-finite point, which is not added. */
+static JSValue qjs_regression_add(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    hypothesis_regression_accumulator_t *acc;
+    double point[2];
+
+    (void)this_val;
+
+    if (argc < 3) {
+        return JS_ThrowTypeError(ctx, "Expected state, x and y");
+    }
+    if (!(acc = qjs_regression_state(ctx, argv[0])) || qjs_read_float_args(ctx, argv, 1, 2, point) < 0) {
+        return JS_EXCEPTION;
+    }
+    return JS_NewBool(ctx, hypothesis_accumulator_add(acc, point[0], point[1]) == 0);
+}
+
+/* regressionRemove(state, x, y): drops a previously added point. */
+static JSValue qjs_regression_remove(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    hypothesis_regression_accumulator_t *acc;
+    double point[2];
+
+    (void)this_val;
+
+    if (argc < 3) {
+        return JS_ThrowTypeError(ctx, "Expected state, x and y");
+    }
+    if (!(acc = qjs_regression_state(ctx, argv[0])) || qjs_read_float_args(ctx, argv, 1, 2, point) < 0) {
+        return JS_EXCEPTION;
+    }
+    return JS_NewBool(ctx, hypothesis_accumulator_remove(acc, point[0], point[1]) == 0);
+}
+
+/* regressionReplace(state, oldX, oldY, x, y): swaps one added point for another. */
+static JSValue qjs_regression_replace(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    hypothesis_regression_accumulator_t *acc;
+    double points[4];
+
+    (void)this_val;
+
+    if (argc < 5) {
+        return JS_ThrowTypeError(ctx, "Expected state, old point and new point");
+    }
+    if (!(acc = qjs_regression_state(ctx, argv[0])) || qjs_read_float_args(ctx, argv, 1, 4, points) < 0) {
+        return JS_EXCEPTION;
+    }
+    return JS_NewBool(ctx, hypothesis_accumulator_replace(acc, points[0], points[1], points[2], points[3]) == 0);
+}
+
+/* regressionFit(state, alpha?): linearRegression-shaped fit of the accumulated points, O(1). */
+static JSValue qjs_regression_fit(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    hypothesis_regression_accumulator_t *acc;
+    hypothesis_regression_t fit;
+    hypothesis_error_t error;
+    double alpha = 0.05;
+
+    (void)this_val;
+
+    if (argc < 1) {
+        return JS_ThrowTypeError(ctx, "Expected regression state");
+    }
+    if (!(acc = qjs_regression_state(ctx, argv[0]))) {
+        return JS_EXCEPTION;
+    }
+    if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_ToFloat64(ctx, &alpha, argv[1]) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    error = hypothesis_accumulator_fit(acc, alpha, &fit);
+    return error == HYPOTHESIS_SUCCESS ? qjs_regression_result(ctx, &fit) : qjs_hypothesis_error(ctx, error);
+}
+
+static expression_t *qjs_expression_state(JSContext *ctx, JSValueConst value) {
+    return (expression_t *)qjs_native_state(ctx, value, sizeof(expression_t), "Expected expression state");
+}
+
+/* createExpression(): empty calculator expression for expressionUpdate and expressionEvaluate. */
+static JSValue qjs_create_expression(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    expression_t *expression;
+
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+
+    expression = malloc(sizeof(*expression));
+    if (!expression) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    expression_init(expression);
+    return qjs_new_native_state(ctx, expression, sizeof(*expression));
+}
+
+/*
+ * expressionUpdate(state, text): recompiles after an edit, re-lexing only
+ * from where text stops matching the previous one. Returns the
+ * expression_status_t code (0 when it compiled).
+ */
+static JSValue qjs_expression_update(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    expression_t *expression;
+    expression_status_t status;
+    const char *text;
+    size_t length;
+
+    (void)this_val;
+
+    if (argc < 2) {
+        return JS_ThrowTypeError(ctx, "Expected state and text");
+    }
+    if (!(expression = qjs_expression_state(ctx, argv[0])) || !(text = JS_ToCStringLen(ctx, &length, argv[1]))) {
+        return JS_EXCEPTION;
+    }
+
+    status = expression_update(expression, text, length);
+    JS_FreeCString(ctx, text);
+    return JS_NewInt32(ctx, (int32_t)status);
+}
+
+/* expressionEvaluate(state, ans?): value of the compiled expression, or null if it did not compile. */
+static JSValue qjs_expression_evaluate(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    expression_t *expression;
+    double ans = 0.0;
+    double value;
+
+    (void)this_val;
+
+    if (argc < 1) {
+        return JS_ThrowTypeError(ctx, "Expected expression state");
+    }
+    if (!(expression = qjs_expression_state(ctx, argv[0]))) {
+        return JS_EXCEPTION;
+    }
+    if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_ToFloat64(ctx, &ans, argv[1]) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    return expression_evaluate(expression, ans, &value) == EXPRESSION_OK ? JS_NewFloat64(ctx, value) : JS_NULL;
+}
+
+/* Largest trial count that survives the round trip through a JS number exactly. */
+#define QJS_SIMULATION_MAX_TRIALS 9007199254740992.0
+
+/* Reads a non-negative integral count; returns -1 with an exception pending. */
+static int qjs_read_count(JSContext *ctx, JSValueConst value, const char *message, uint64_t *out) {
+    double count;
+
+    if (JS_ToFloat64(ctx, &count, value) < 0) {
+        return -1;
+    }
+    if (!(count >= 0.0) || count > QJS_SIMULATION_MAX_TRIALS || count != floor(count)) {
+        JS_ThrowRangeError(ctx, "%s", message);
+        return -1;
+    }
+    *out = (uint64_t)count;
+    return 0;
+}
+
+/* Seeds arrive as JS numbers; any finite value is folded into 64 bits. */
+static int qjs_read_seed(JSContext *ctx, JSValueConst value, uint64_t *out) {
+    double seed;
+    int64_t bits;
+
+    if (JS_ToFloat64(ctx, &seed, value) < 0) {
+        return -1;
+    }
+    if (!isfinite(seed)) {
+        JS_ThrowRangeError(ctx, "Invalid simulation seed");
+        return -1;
+    }
+    memcpy(&bits, &seed, sizeof(bits));
+    *out = (uint64_t)bits;
+    return 0;
+}
+
+/* createCoinSimulation(p, trials, seed): state for coinSimulationStep. */
+static JSValue qjs_create_coin_simulation(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    sim_coin_t *sim;
+    uint64_t trials;
+    uint64_t seed;
+    double p;
+
+    (void)this_val;
+
+    if (argc < 3) {
+        return JS_ThrowTypeError(ctx, "Expected p, trials and seed");
+    }
+    if (JS_ToFloat64(ctx, &p, argv[0]) < 0 || qjs_read_count(ctx, argv[1], "Invalid trial count", &trials) < 0 ||
+        qjs_read_seed(ctx, argv[2], &seed) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    sim = malloc(sizeof(*sim));
+    if (!sim) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    if (sim_coin_init(sim, p, trials, seed) != 0) {
+        free(sim);
+        return JS_ThrowRangeError(ctx, "Invalid probability");
+    }
+    return qjs_new_native_state(ctx, sim, sizeof(*sim));
+}
+
+/*
+ * coinSimulationStep(state, maxTrials): flips the next chunk and returns the
+ * running totals { done, total, heads, longestHeadsRun, longestTailsRun, finished }.
+ */
+static JSValue qjs_coin_simulation_step(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    sim_coin_t *sim;
+    uint64_t max_trials;
+    JSValue result;
+
+    (void)this_val;
+
+    if (argc < 2) {
+        return JS_ThrowTypeError(ctx, "Expected state and trial count");
+    }
+    if (!(sim = (sim_coin_t *)qjs_native_state(ctx, argv[0], sizeof(sim_coin_t), "Expected coin simulation state")) ||
+        qjs_read_count(ctx, argv[1], "Invalid trial count", &max_trials) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    sim_coin_step(sim, max_trials);
+
+    result = JS_NewObject(ctx);
+    if (JS_IsException(result)) {
+        return result;
+    }
+    JS_SetPropertyStr(ctx, result, "done", JS_NewFloat64(ctx, (double)sim->trials_done));
+    JS_SetPropertyStr(ctx, result, "total", JS_NewFloat64(ctx, (double)sim->trials_total));
+    JS_SetPropertyStr(ctx, result, "heads", JS_NewFloat64(ctx, (double)sim->heads));
+    JS_SetPropertyStr(ctx, result, "longestHeadsRun", JS_NewFloat64(ctx, (double)sim->longest_heads_run));
+    JS_SetPropertyStr(ctx, result, "longestTailsRun", JS_NewFloat64(ctx, (double)sim->longest_tails_run));
+    JS_SetPropertyStr(ctx, result, "finished", JS_NewBool(ctx, sim->trials_done >= sim->trials_total));
+    return result;
+}
+
+/* createPokerSimulation(handSize, trials, seed): state for pokerSimulationStep. */
+static JSValue qjs_create_poker_simulation(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    sim_poker_t *sim;
+    uint64_t trials;
+    uint64_t seed;
+    int32_t hand_size;
+
+    (void)this_val;
+
+    if (argc < 3) {
+        return JS_ThrowTypeError(ctx, "Expected hand size, trials and seed");
+    }
+    if (JS_ToInt32(ctx, &hand_size, argv[0]) < 0 ||
+        qjs_read_count(ctx, argv[1], "Invalid trial count", &trials) < 0 || qjs_read_seed(ctx, argv[2], &seed) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    sim = malloc(sizeof(*sim));
+    if (!sim) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    if (sim_poker_init(sim, hand_size, trials, seed) != 0) {
+        free(sim);
+        return JS_ThrowRangeError(ctx, "Invalid hand size");
+    }
+    return qjs_new_native_state(ctx, sim, sizeof(*sim));
+}
+
+/*
+ * pokerSimulationStep(state, maxTrials): deals the next chunk and returns
+ * { done, total, counts, finished }, counts keyed by poker_category_name.
+ */
+static JSValue qjs_poker_simulation_step(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    sim_poker_t *sim;
+    uint64_t max_trials;
+    JSValue result;
+    JSValue counts;
+    int category;
+
+    (void)this_val;
+
+    if (argc < 2) {
+        return JS_ThrowTypeError(ctx, "Expected state and trial count");
+    }
+    if (!(sim = (sim_poker_t *)qjs_native_state(ctx, argv[0], sizeof(sim_poker_t), "Expected poker simulation state")) ||
+        qjs_read_count(ctx, argv[1], "Invalid trial count", &max_trials) < 0) {
+        return JS_EXCEPTION;
+    }
+
+    sim_poker_step(sim, max_trials);
+
+    result = JS_NewObject(ctx);
+    if (JS_IsException(result)) {
+        return result;
+    }
+    counts = JS_NewObject(ctx);
+    if (JS_IsException(counts)) {
+        JS_FreeValue(ctx, result);
+        return counts;
+    }
+    for (category = 0; category < POKER_CATEGORY_COUNT; ++category) {
+        JS_SetPropertyStr(ctx, counts, poker_category_name((poker_category_t)category),
+                          JS_NewFloat64(ctx, (double)sim->category_counts[category]));
+    }
+
+    JS_SetPropertyStr(ctx, result, "done", JS_NewFloat64(ctx, (double)sim->trials_done));
+    JS_SetPropertyStr(ctx, result, "total", JS_NewFloat64(ctx, (double)sim->trials_total));
+    JS_SetPropertyStr(ctx, result, "counts", counts);
+    JS_SetPropertyStr(ctx, result, "finished", JS_NewBool(ctx, sim->trials_done >= sim->trials_total));
+    return result;
+}
+
+/*
+ * Resampling state is variable-length (the samples and per-resample slots
+ * follow the header), so it is checked against its own header rather than a
+ * fixed size. Returns NULL with a TypeError pending for anything else.
+ */
+static resample_state_t *qjs_resampling_state(JSContext *ctx, JSValueConst value) {
+    size_t size;
+    uint8_t *data = JS_GetArrayBuffer(ctx, &size, value);
+
+    if (!data || !resample_state_valid((const resample_state_t *)(void *)data, size)) {
+        if (!data) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+        }
+        JS_ThrowTypeError(ctx, "Expected resampling state");
+        return NULL;
+    }
+    return (resample_state_t *)(void *)data;
+}
+
+/*
+ * createResampling(kind, { sample1, sample2, maxResamples, alpha, seed }):
+ * state for resamplingStep. kind is "bootstrap" (sample2 optional) or
+ * "permutation".
+ */
+static JSValue qjs_create_resampling(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    resample_state_t *state;
+    resample_kind_t kind;
+    double *sample1 = NULL;
+    double *sample2 = NULL;
+    int64_t n1;
+    int64_t n2;
+    uint64_t max_resamples;
+    uint64_t seed;
+    double alpha;
+    size_t size;
+    const char *kind_name;
+    JSValue value;
+    int rc;
+
+    (void)this_val;
+
+    if (argc < 2 || !JS_IsObject(argv[1])) {
+        return JS_ThrowTypeError(ctx, "Expected kind and options");
+    }
+
+    kind_name = JS_ToCString(ctx, argv[0]);
+    if (!kind_name) {
+        return JS_EXCEPTION;
+    }
+    if (strcmp(kind_name, "bootstrap") == 0) {
+        kind = RESAMPLE_BOOTSTRAP;
+    } else if (strcmp(kind_name, "permutation") == 0) {
+        kind = RESAMPLE_PERMUTATION;
+    } else {
+        JS_FreeCString(ctx, kind_name);
+        return JS_ThrowRangeError(ctx, "Unknown resampling kind");
+    }
+    JS_FreeCString(ctx, kind_name);
+
+    value = JS_GetPropertyStr(ctx, argv[1], "maxResamples");
+    rc = qjs_read_count(ctx, value, "Invalid resample count", &max_resamples);
+    JS_FreeValue(ctx, value);
+    if (rc < 0) {
+        return JS_EXCEPTION;
+    }
+    value = JS_GetPropertyStr(ctx, argv[1], "seed");
+    rc = qjs_read_seed(ctx, value, &seed);
+    JS_FreeValue(ctx, value);
+    if (rc < 0) {
+        return JS_EXCEPTION;
+    }
+    alpha = get_prop_double(ctx, argv[1], "alpha", 0.05);
+
+    if (qjs_read_doubles(ctx, argv[1], "sample1", &sample1, &n1) < 0 ||
+        qjs_read_doubles(ctx, argv[1], "sample2", &sample2, &n2) < 0) {
+        free(sample1);
+        return JS_EXCEPTION;
+    }
+    if (n2 < 0) {
+        n2 = 0;
+    }
+
+    size = n1 < 0 ? 0 : resample_state_size(kind, (size_t)n1, (size_t)n2, max_resamples);
+    state = size ? malloc(size) : NULL;
+    if (size && !state) {
+        free(sample1);
+        free(sample2);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    if (!state || resample_init(state, size, kind, sample1, (size_t)n1, sample2, (size_t)n2, max_resamples,
+                                alpha, seed) != 0) {
+        free(state);
+        free(sample1);
+        free(sample2);
+        return JS_ThrowRangeError(ctx, "Invalid resampling input");
+    }
+
+    free(sample1);
+    free(sample2);
+    return qjs_new_native_state(ctx, state, size);
+}
+
+/*
+ * resamplingStep(state, maxResamples, budgetMs): runs the next chunk, stopping
+ * once budgetMs has elapsed, and returns { done, total, observed, finished }.
+ * Permutation runs add pValue, pLower, pUpper and decided (stopped early).
+ */
+static JSValue qjs_resampling_step(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    resample_state_t *state;
+    uint64_t max_resamples;
+    double budget_ms = 0.0;
+    double p_value;
+    double lower;
+    double upper;
+    JSValue result;
+
+    (void)this_val;
+
+    if (argc < 2) {
+        return JS_ThrowTypeError(ctx, "Expected state and resample count");
+    }
+    if (!(state = qjs_resampling_state(ctx, argv[0])) ||
+        qjs_read_count(ctx, argv[1], "Invalid resample count", &max_resamples) < 0 ||
+        (argc > 2 && JS_ToFloat64(ctx, &budget_ms, argv[2]) < 0)) {
+        return JS_EXCEPTION;
+    }
+
+    resample_step(state, max_resamples, budget_ms);
+
+    result = JS_NewObject(ctx);
+    if (JS_IsException(result)) {
+        return result;
+    }
+    JS_SetPropertyStr(ctx, result, "done", JS_NewFloat64(ctx, (double)state->resamples_done));
+    JS_SetPropertyStr(ctx, result, "total", JS_NewFloat64(ctx, (double)state->max_resamples));
+    JS_SetPropertyStr(ctx, result, "observed", JS_NewFloat64(ctx, state->observed));
+    if (resample_p_value(state, &p_value, &lower, &upper) == 0) {
+        JS_SetPropertyStr(ctx, result, "pValue", JS_NewFloat64(ctx, p_value));
+        JS_SetPropertyStr(ctx, result, "pLower", JS_NewFloat64(ctx, lower));
+        JS_SetPropertyStr(ctx, result, "pUpper", JS_NewFloat64(ctx, upper));
+        JS_SetPropertyStr(ctx, result, "decided", JS_NewBool(ctx, state->decided));
+    }
+    JS_SetPropertyStr(ctx, result, "finished", JS_NewBool(ctx, resample_finished(state)));
+    return result;
+}
+
+/*
+ * resamplingInterval(state, level): bootstrap percentile interval
+ * { lower, upper, standardError } over the resamples so far, or null.
+ */
+static JSValue qjs_resampling_interval(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    resample_state_t *state;
+    double level = 0.95;
+    double lower;
+    double upper;
+    double standard_error;
+    JSValue result;
+
+    (void)this_val;
+
+    if (argc < 1) {
+        return JS_ThrowTypeError(ctx, "Expected state");
+    }
+    if (!(state = qjs_resampling_state(ctx, argv[0])) || (argc > 1 && JS_ToFloat64(ctx, &level, argv[1]) < 0)) {
+        return JS_EXCEPTION;
+    }
+    if (resample_bootstrap_interval(state, level, &lower, &upper, &standard_error) != 0) {
+        return JS_NULL;
+    }
+
+    result = JS_NewObject(ctx);
+    if (JS_IsException(result)) {
+        return result;
+    }
+    JS_SetPropertyStr(ctx, result, "lower", JS_NewFloat64(ctx, lower));
+    JS_SetPropertyStr(ctx, result, "upper", JS_NewFloat64(ctx, upper));
+    JS_SetPropertyStr(ctx, result, "standardError", JS_NewFloat64(ctx, standard_error));
+    return result;
+}
+
+static const char *qjs_decimal_status_name(decimal_parse_status_t status) {
+    switch (status) {
+    case DECIMAL_PARSE_RANGE:
+        return "range";
+    case DECIMAL_PARSE_EMPTY:
+        return "empty";
+    case DECIMAL_PARSE_TOO_LONG:
+        return "too_long";
+    default:
+        return "syntax";
+    }
+}
+
+/*
+ * Native job scheduler shared by the app's pages. Calculation jobs own an
+ * orchestrator_job_t; simulation jobs hold a reference to the JS state
+ * ArrayBuffer (coin, poker or resampling) and step it in place, so the
+ * existing step calls with a count of 0 read the finished state.
+ */
+typedef enum {
+    QJS_JOB_CALCULATION = 0,
+    QJS_JOB_COIN = 1,
+    QJS_JOB_POKER = 2,
+    QJS_JOB_RESAMPLING = 3
+} qjs_job_kind_t;
+
+typedef struct {
+    qjs_job_kind_t kind;
+    JSContext *ctx;
+    JSValue state;
+    orchestrator_job_t calculation;
+} qjs_job_t;
+
+typedef struct {
+    JSContext *ctx;
+    JSValue list;
+    uint32_t count;
+} qjs_job_completions_t;
+
+static job_scheduler_t g_job_scheduler;
+static int g_job_scheduler_ready = 0;
+
+static job_scheduler_t *qjs_job_scheduler(void) {
+    if (!g_job_scheduler_ready) {
+        job_scheduler_init(&g_job_scheduler);
+        g_job_scheduler_ready = 1;
+    }
+    return &g_job_scheduler;
+}
+
+static int qjs_job_step(void *task, uint64_t max_units) {
+    qjs_job_t *job = (qjs_job_t *)task;
+    uint8_t *data;
+    size_t size;
+
+    if (job->kind == QJS_JOB_CALCULATION) {
+        return orchestrator_job_step(&job->calculation, max_units);
+    }
+
+    /* A detached buffer has nothing left to run */
+    data = JS_GetArrayBuffer(job->ctx, &size, job->state);
+    if (!data) {
+        JS_FreeValue(job->ctx, JS_GetException(job->ctx));
+        return 1;
+    }
+
+    switch (job->kind) {
+        case QJS_JOB_COIN: {
+            sim_coin_t *sim = (sim_coin_t *)data;
+
+            sim_coin_step(sim, max_units);
+            return sim->trials_done >= sim->trials_total;
+        }
+        case QJS_JOB_POKER: {
+            sim_poker_t *sim = (sim_poker_t *)data;
+
+            sim_poker_step(sim, max_units);
+            return sim->trials_done >= sim->trials_total;
+        }
+        default:
+            resample_step((resample_state_t *)data, max_units, 0.0);
+            return resample_finished((resample_state_t *)data);
+    }
+}
+
+static void qjs_job_release(void *task) {
+    qjs_job_t *job = (qjs_job_t *)task;
+
+    if (job->kind != QJS_JOB_CALCULATION) {
+        JS_FreeValue(job->ctx, job->state);
+    }
+    free(job);
+}
+
+static void qjs_job_complete(void *context, uint32_t id, uint32_t owner, void *task) {
+    qjs_job_completions_t *completions = (qjs_job_completions_t *)context;
+    qjs_job_t *job = (qjs_job_t *)task;
+    JSContext *ctx = completions->ctx;
+    JSValue completion;
+
+    if (job->kind == QJS_JOB_CALCULATION) {
+        completion = qjs_new_calculation(ctx, &job->calculation.result);
+        JS_SetPropertyStr(ctx, completion, "kind", JS_NewString(ctx, "calculation"));
+    } else {
+        completion = JS_NewObject(ctx);
+        JS_SetPropertyStr(ctx, completion, "kind", JS_NewString(ctx, "simulation"));
+    }
+    JS_SetPropertyStr(ctx, completion, "id", JS_NewInt64(ctx, (int64_t)id));
+    JS_SetPropertyStr(ctx, completion, "owner", JS_NewInt64(ctx, (int64_t)owner));
+    JS_SetPropertyUint32(ctx, completions->list, completions->count++, completion);
+}
+
+/* Reads the (priority, owner) pair every schedule call starts with. */
+static int qjs_read_job_slot(JSContext *ctx, JSValueConst priority_val, JSValueConst owner_val,
+                             uint32_t *priority, uint32_t *owner) {
+    if (JS_ToUint32(ctx, priority, priority_val) < 0 || JS_ToUint32(ctx, owner, owner_val) < 0) {
+        return -1;
+    }
+    if (*priority >= JOB_PRIORITY_COUNT) {
+        JS_ThrowRangeError(ctx, "Invalid priority");
+        return -1;
+    }
+    return 0;
+}
+
+/* Queues a job; returns its id, or 0 when the scheduler is full. */
+static JSValue qjs_submit_job(JSContext *ctx, qjs_job_t *job, uint32_t priority, uint32_t owner) {
+    uint32_t id = job_scheduler_submit(qjs_job_scheduler(), (job_priority_t)priority, owner, qjs_job_step,
+                                       qjs_job_release, job);
+
+    if (id == 0) {
+        qjs_job_release(job);
+    }
+    return JS_NewInt64(ctx, (int64_t)id);
+}
+
+/*
+ * scheduleCalculation(priority, owner, distribution, params, x): queues
+ * calculate as a resumable job. priority is 0 (interactive), 1 (chart) or
+ * 2 (prefetch); owner is any tag for cancelJobs. Returns the job id, or 0
+ * when the scheduler is full.
+ */
+static JSValue qjs_schedule_calculation(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    calculation_request_t request;
+    uint32_t priority;
+    uint32_t owner;
+    qjs_job_t *job;
+
+    (void)this_val;
+
+    if (argc < 5) {
+        return JS_ThrowTypeError(ctx, "Expected priority, owner, distribution, parameter array and x");
+    }
+    if (qjs_read_job_slot(ctx, argv[0], argv[1], &priority, &owner) < 0) {
+        return JS_EXCEPTION;
+    }
+    if (qjs_read_request(ctx, argv[2], argv[3], argv[4], &request) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected distribution, parameter array and x");
+    }
+
+    job = (qjs_job_t *)calloc(1, sizeof(*job));
+    if (job == NULL) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    job->kind = QJS_JOB_CALCULATION;
+    job->ctx = ctx;
+    orchestrator_job_init(&job->calculation, &request);
+    return qjs_submit_job(ctx, job, priority, owner);
+}
+
+/*
+ * scheduleSimulation(priority, owner, kind, state): runs a coin, poker or
+ * resampling state to completion in scheduler slices. kind is 'coin',
+ * 'poker' or 'resampling'; state comes from the matching create call.
+ */
+static JSValue qjs_schedule_simulation(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    qjs_job_kind_t kind;
+    const char *kind_name;
+    uint32_t priority;
+    uint32_t owner;
+    void *state;
+    qjs_job_t *job;
+
+    (void)this_val;
+
+    if (argc < 4) {
+        return JS_ThrowTypeError(ctx, "Expected priority, owner, kind and state");
+    }
+    if (qjs_read_job_slot(ctx, argv[0], argv[1], &priority, &owner) < 0 ||
+        !(kind_name = JS_ToCString(ctx, argv[2]))) {
+        return JS_EXCEPTION;
+    }
+
+    if (strcmp(kind_name, "coin") == 0) {
+        kind = QJS_JOB_COIN;
+        state = qjs_native_state(ctx, argv[3], sizeof(sim_coin_t), "Expected coin simulation state");
+    } else if (strcmp(kind_name, "poker") == 0) {
+        kind = QJS_JOB_POKER;
+        state = qjs_native_state(ctx, argv[3], sizeof(sim_poker_t), "Expected poker simulation state");
+    } else if (strcmp(kind_name, "resampling") == 0) {
+        kind = QJS_JOB_RESAMPLING;
+        state = qjs_resampling_state(ctx, argv[3]);
+    } else {
+        JS_FreeCString(ctx, kind_name);
+        return JS_ThrowRangeError(ctx, "Unknown simulation kind");
+    }
+    JS_FreeCString(ctx, kind_name);
+    if (!state) {
+        return JS_EXCEPTION;
+    }
+
+    job = (qjs_job_t *)calloc(1, sizeof(*job));
+    if (job == NULL) {
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    job->kind = kind;
+    job->ctx = ctx;
+    job->state = JS_DupValue(ctx, argv[3]);
+    return qjs_submit_job(ctx, job, priority, owner);
+}
+
+/*
+ * runJobs(budgetMs, sliceUnits): steps queued jobs, highest priority first,
+ * until budgetMs has passed (at least one slice runs). Returns the jobs that
+ * finished as {kind, id, owner}, calculations also carrying calculate's fields.
+ */
+static JSValue qjs_run_jobs(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    qjs_job_completions_t completions;
+    double budget_ms = 0.0;
+    uint32_t slice_units = 0;
+
+    (void)this_val;
+
+    if ((argc >= 1 && JS_ToFloat64(ctx, &budget_ms, argv[0]) < 0) ||
+        (argc >= 2 && !JS_IsUndefined(argv[1]) && JS_ToUint32(ctx, &slice_units, argv[1]) < 0)) {
+        return JS_EXCEPTION;
+    }
+    if (!(budget_ms > 0.0)) {
+        budget_ms = 0.0;
+    }
+
+    completions.ctx = ctx;
+    completions.list = JS_NewArray(ctx);
+    completions.count = 0;
+    job_scheduler_run(qjs_job_scheduler(), (uint64_t)(budget_ms * 1000.0), slice_units, qjs_job_complete,
+                      &completions);
+    return completions.list;
+}
+
+/* cancelJobs(owner): drops every queued job with that owner; returns how many. */
+static JSValue qjs_cancel_jobs(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    uint32_t owner;
+
+    (void)this_val;
+
+    if (argc < 1 || JS_IsUndefined(argv[0])) {
+        size_t pending = job_scheduler_pending(qjs_job_scheduler(), JOB_PRIORITY_COUNT);
+
+        job_scheduler_shutdown(qjs_job_scheduler());
+        return JS_NewInt64(ctx, (int64_t)pending);
+    }
+    if (JS_ToUint32(ctx, &owner, argv[0]) < 0) {
+        return JS_EXCEPTION;
+    }
+    return JS_NewInt64(ctx, (int64_t)job_scheduler_cancel_owner(qjs_job_scheduler(), owner));
+}
+
+/* cancelJob(id): true if the job was still queued. */
+static JSValue qjs_cancel_job(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    uint32_t id;
+
+    (void)this_val;
+
+    if (argc < 1 || JS_ToUint32(ctx, &id, argv[0]) < 0) {
+        return JS_ThrowTypeError(ctx, "Expected job id");
+    }
+    return JS_NewBool(ctx, job_scheduler_cancel(qjs_job_scheduler(), id) == 0);
+}
+
+static JSValue qjs_pending_jobs(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+
+    return JS_NewInt64(ctx, (int64_t)job_scheduler_pending(qjs_job_scheduler(), JOB_PRIORITY_COUNT));
+}
+
+/*
+ * parseNumbers(text): one native pass over a comma, semicolon or whitespace
+ * separated list. Returns { values: Float64Array, errors: [{ offset, length,
+ * status }] } with offsets in UTF-8 bytes (characters, for the input
+ * method's ASCII). Bad fields are skipped, not NaN-filled.
+ */
+static JSValue qjs_parse_numbers(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    decimal_parse_error_t *errors;
+    decimal_parse_result_t parsed;
+    const char *text;
+    double *values;
+    size_t length;
+    size_t bound;
+    size_t i;
+    JSValue result;
+    JSValue error_list;
+    JSValue array;
+
+    (void)this_val;
+
+    if (argc < 1) {
+        return JS_ThrowTypeError(ctx, "Expected text");
+    }
+    text = JS_ToCStringLen(ctx, &length, argv[0]);
+    if (!text) {
+        return JS_EXCEPTION;
+    }
+
+    /* Every field is either a value or an error, so the field bound sizes both */
+    bound = decimal_parse_field_bound(text, length);
+    values = malloc((bound > 0 ? bound : 1) * sizeof(double));
+    errors = malloc((bound > 0 ? bound : 1) * sizeof(*errors));
+    if (!values || !errors) {
+        free(values);
+        free(errors);
+        JS_FreeCString(ctx, text);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+
+    decimal_parse_list(text, length, values, bound, errors, bound, &parsed);
+    JS_FreeCString(ctx, text);
+
+    error_list = JS_NewArray(ctx);
+    if (JS_IsException(error_list)) {
+        free(values);
+        free(errors);
+        return error_list;
+    }
+    for (i = 0; i < parsed.error_count; ++i) {
+        JSValue item = JS_NewObject(ctx);
+
+        if (JS_IsException(item)) {
+            free(values);
+            free(errors);
+            JS_FreeValue(ctx, error_list);
+            return item;
+        }
+        JS_SetPropertyStr(ctx, item, "offset", JS_NewFloat64(ctx, (double)errors[i].offset));
+        JS_SetPropertyStr(ctx, item, "length", JS_NewFloat64(ctx, (double)errors[i].length));
+        JS_SetPropertyStr(ctx, item, "status", JS_NewString(ctx, qjs_decimal_status_name(errors[i].status)));
+        JS_SetPropertyUint32(ctx, error_list, (uint32_t)i, item);
+    }
+    free(errors);
+
+    array = qjs_new_float64_array(ctx, values, parsed.value_count);
+    if (JS_IsException(array)) {
+        JS_FreeValue(ctx, error_list);
+        return array;
+    }
+
+    result = JS_NewObject(ctx);
+    if (JS_IsException(result)) {
+        JS_FreeValue(ctx, array);
+        JS_FreeValue(ctx, error_list);
+        return result;
+    }
+    JS_SetPropertyStr(ctx, result, "values", array);
+    JS_SetPropertyStr(ctx, result, "errors", error_list);
+    return result;
+}
+
+/* Builds the full __velaCacheProvider object. */
+static JSValue qjs_new_provider(JSContext *ctx) {
+    JSValue provider_obj = JS_NewObject(ctx);
+
+    if (JS_IsException(provider_obj)) {
+        return provider_obj;
+    }
+
+    JS_SetPropertyStr(ctx, provider_obj, "createCache", JS_NewCFunction(ctx, qjs_cache_create, "createCache", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "destroyCache", JS_NewCFunction(ctx, qjs_cache_destroy, "destroyCache", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "get", JS_NewCFunction(ctx, qjs_cache_get, "get", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "set", JS_NewCFunction(ctx, qjs_cache_set, "set", 4));
+    JS_SetPropertyStr(ctx, provider_obj, "getBuffer", JS_NewCFunction(ctx, qjs_cache_get_buffer, "getBuffer", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "setBuffer", JS_NewCFunction(ctx, qjs_cache_set_buffer, "setBuffer", 4));
+    JS_SetPropertyStr(ctx, provider_obj, "has", JS_NewCFunction(ctx, qjs_cache_has, "has", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "getMany", JS_NewCFunction(ctx, qjs_cache_get_many, "getMany", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "setMany", JS_NewCFunction(ctx, qjs_cache_set_many, "setMany", 4));
+    JS_SetPropertyStr(ctx, provider_obj, "hasMany", JS_NewCFunction(ctx, qjs_cache_has_many, "hasMany", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "clear", JS_NewCFunction(ctx, qjs_cache_clear, "clear", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "resize", JS_NewCFunction(ctx, qjs_cache_resize, "resize", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "invalidate", JS_NewCFunction(ctx, qjs_cache_invalidate, "invalidate", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "invalidateNamespace",
+                      JS_NewCFunction(ctx, qjs_cache_invalidate_namespace, "invalidateNamespace", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "pin", JS_NewCFunction(ctx, qjs_cache_pin, "pin", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "release", JS_NewCFunction(ctx, qjs_cache_release, "release", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "stats", JS_NewCFunction(ctx, qjs_cache_stats, "stats", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "metrics", JS_NewCFunction(ctx, qjs_cache_metrics, "metrics", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "traceDump", JS_NewCFunction(ctx, qjs_trace_dump, "traceDump", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "logFactorial", JS_NewCFunction(ctx, qjs_log_factorial, "logFactorial", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "logCombination", JS_NewCFunction(ctx, qjs_log_combination, "logCombination", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "logGamma", JS_NewCFunction(ctx, qjs_log_gamma, "logGamma", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "calculate", JS_NewCFunction(ctx, qjs_calculate, "calculate", 3));
+    JS_SetPropertyStr(ctx, provider_obj, "calculateInto",
+                      JS_NewCFunction(ctx, qjs_calculate_into, "calculateInto", 4));
+    JS_SetPropertyStr(ctx, provider_obj, "calculateBatch",
+                      JS_NewCFunction(ctx, qjs_calculate_batch, "calculateBatch", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "calculateProgressive",
+                      JS_NewCFunction(ctx, qjs_calculate_progressive, "calculateProgressive", 3));
+    JS_SetPropertyStr(ctx, provider_obj, "runRefinements",
+                      JS_NewCFunction(ctx, qjs_run_refinements, "runRefinements", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "scheduleCalculation",
+                      JS_NewCFunction(ctx, qjs_schedule_calculation, "scheduleCalculation", 5));
+    JS_SetPropertyStr(ctx, provider_obj, "scheduleSimulation",
+                      JS_NewCFunction(ctx, qjs_schedule_simulation, "scheduleSimulation", 4));
+    JS_SetPropertyStr(ctx, provider_obj, "runJobs", JS_NewCFunction(ctx, qjs_run_jobs, "runJobs", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "cancelJobs", JS_NewCFunction(ctx, qjs_cancel_jobs, "cancelJobs", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "cancelJob", JS_NewCFunction(ctx, qjs_cancel_job, "cancelJob", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "pendingJobs", JS_NewCFunction(ctx, qjs_pending_jobs, "pendingJobs", 0));
+    JS_SetPropertyStr(ctx, provider_obj, "setResultCache",
+                      JS_NewCFunction(ctx, qjs_set_result_cache, "setResultCache", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "setTableCache",
+                      JS_NewCFunction(ctx, qjs_set_table_cache, "setTableCache", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "setResultTier",
+                      JS_NewCFunction(ctx, qjs_set_result_tier, "setResultTier", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "invalidateResults",
+                      JS_NewCFunction(ctx, qjs_invalidate_results, "invalidateResults", 0));
+    JS_SetPropertyStr(ctx, provider_obj, "memoryBudget", JS_NewCFunction(ctx, qjs_memory_budget, "memoryBudget", 0));
+    JS_SetPropertyStr(ctx, provider_obj, "setMemoryBudget",
+                      JS_NewCFunction(ctx, qjs_set_memory_budget, "setMemoryBudget", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "memoryPressure",
+                      JS_NewCFunction(ctx, qjs_memory_pressure, "memoryPressure", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "registryMetadata",
+                      JS_NewCFunction(ctx, qjs_registry_metadata, "registryMetadata", 0));
+    JS_SetPropertyStr(ctx, provider_obj, "generateSeries",
+                      JS_NewCFunction(ctx, qjs_generate_series, "generateSeries", 7));
+    JS_SetPropertyStr(ctx, provider_obj, "adaptiveSeries",
+                      JS_NewCFunction(ctx, qjs_adaptive_series, "adaptiveSeries", 9));
+    JS_SetPropertyStr(ctx, provider_obj, "sampleStats", JS_NewCFunction(ctx, qjs_sample_stats, "sampleStats", 1));
+    JS_SetPropertyStr(ctx, provider_obj, "hypothesisTest",
+                      JS_NewCFunction(ctx, qjs_hypothesis_test, "hypothesisTest", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "hypothesisSummary",
+                      JS_NewCFunction(ctx, qjs_hypothesis_summary, "hypothesisSummary", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "createRegression",
+                      JS_NewCFunction(ctx, qjs_create_regression, "createRegression", 0));
+    JS_SetPropertyStr(ctx, provider_obj, "regressionAdd",
+                      JS_NewCFunction(ctx, qjs_regression_add, "regressionAdd", 3));
+    JS_SetPropertyStr(ctx, provider_obj, "regressionRemove",
+                      JS_NewCFunction(ctx, qjs_regression_remove, "regressionRemove", 3));
+    JS_SetPropertyStr(ctx, provider_obj, "regressionReplace",
+                      JS_NewCFunction(ctx, qjs_regression_replace, "regressionReplace", 5));
+    JS_SetPropertyStr(ctx, provider_obj, "regressionFit",
+                      JS_NewCFunction(ctx, qjs_regression_fit, "regressionFit", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "createExpression",
+                      JS_NewCFunction(ctx, qjs_create_expression, "createExpression", 0));
+    JS_SetPropertyStr(ctx, provider_obj, "expressionUpdate",
+                      JS_NewCFunction(ctx, qjs_expression_update, "expressionUpdate", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "expressionEvaluate",
+                      JS_NewCFunction(ctx, qjs_expression_evaluate, "expressionEvaluate", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "createCoinSimulation",
+                      JS_NewCFunction(ctx, qjs_create_coin_simulation, "createCoinSimulation", 3));
+    JS_SetPropertyStr(ctx, provider_obj, "coinSimulationStep",
+                      JS_NewCFunction(ctx, qjs_coin_simulation_step, "coinSimulationStep", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "createPokerSimulation",
+                      JS_NewCFunction(ctx, qjs_create_poker_simulation, "createPokerSimulation", 3));
+    JS_SetPropertyStr(ctx, provider_obj, "pokerSimulationStep",
+                      JS_NewCFunction(ctx, qjs_poker_simulation_step, "pokerSimulationStep", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "createResampling",
+                      JS_NewCFunction(ctx, qjs_create_resampling, "createResampling", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "resamplingStep",
+                      JS_NewCFunction(ctx, qjs_resampling_step, "resamplingStep", 3));
+    JS_SetPropertyStr(ctx, provider_obj, "resamplingInterval",
+                      JS_NewCFunction(ctx, qjs_resampling_interval, "resamplingInterval", 2));
+    JS_SetPropertyStr(ctx, provider_obj, "parseNumbers", JS_NewCFunction(ctx, qjs_parse_numbers, "parseNumbers", 1));
+
+    return provider_obj;
+}
+
+int cache_register_quickjs(JSContext *ctx) {
+    JSValue global_obj;
+    JSValue provider_obj;
+
+    if (ctx == NULL) {
+        return -1;
+    }
+
+    global_obj = JS_GetGlobalObject(ctx);
+    provider_obj = qjs_new_provider(ctx);
+
+    if (JS_IsException(provider_obj) || JS_IsException(global_obj)) {
+        JS_FreeValue(ctx, provider_obj);
+        JS_FreeValue(ctx, global_obj);
+        return -1;
+    }
 
     if (JS_SetPropertyStr(ctx, global_obj, "__velaCacheProvider", provider_obj) < 0) {
         JS_FreeValue(ctx, provider_obj);
@@ -314,6 +3100,59 @@ int cache_register_quickjs(JSContext *ctx) {
     return 0;
 }
 
+/*
+ * Getter installed by cache_register_quickjs_lazy: builds the provider on
+ * first read and replaces itself with a plain data property holding it.
+ */
+static JSValue qjs_provider_getter(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv) {
+    JSValue global_obj;
+    JSValue provider_obj;
+
+    (void)this_val;
+    (void)argc;
+    (void)argv;
+
+    provider_obj = qjs_new_provider(ctx);
+    if (JS_IsException(provider_obj)) {
+        return provider_obj;
+    }
+
+    global_obj = JS_GetGlobalObject(ctx);
+    if (JS_DefinePropertyValueStr(ctx, global_obj, "__velaCacheProvider", JS_DupValue(ctx, provider_obj),
+                                  JS_PROP_C_W_E) < 0) {
+        JS_FreeValue(ctx, global_obj);
+        JS_FreeValue(ctx, provider_obj);
+        return JS_EXCEPTION;
+    }
+
+    JS_FreeValue(ctx, global_obj);
+    return provider_obj;
+}
+
+int cache_register_quickjs_lazy(JSContext *ctx) {
+    JSValue global_obj;
+    JSAtom name;
+    int rc;
+
+    if (ctx == NULL) {
+        return -1;
+    }
+
+    global_obj = JS_GetGlobalObject(ctx);
+    if (JS_IsException(global_obj)) {
+        return -1;
+    }
+
+    name = JS_NewAtom(ctx, "__velaCacheProvider");
+    rc = JS_DefinePropertyGetSet(ctx, global_obj, name,
+                                 JS_NewCFunction(ctx, qjs_provider_getter, "__velaCacheProvider", 0),
+                                 JS_UNDEFINED,
+                                 JS_PROP_CONFIGURABLE | JS_PROP_ENUMERABLE);
+    JS_FreeAtom(ctx, name);
+    JS_FreeValue(ctx, global_obj);
+    return rc < 0 ? -1 : 0;
+}
+
 #else
 
 int cache_register_quickjs(JSContext *ctx) {
@@ -321,4 +3160,9 @@ int cache_register_quickjs(JSContext *ctx) {
     return -1;
 }
 
+int cache_register_quickjs_lazy(JSContext *ctx) {
+    (void)ctx;
+    return -1;
+}
+
 #endif
@@ -17,6 +17,11 @@ typedef struct JSContext JSContext;
 #endif
 
 int cache_register_quickjs(JSContext *ctx);
+/*
+ * Installs __velaCacheProvider as a getter that builds the provider object
+ * on first access, keeping that work off the startup path.
+ */
+int cache_register_quickjs_lazy(JSContext *ctx);
 
 #ifdef __cplusplus
 }
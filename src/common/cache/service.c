@@ -1,10 +1,17 @@
 #include "service.h"
 
+#include "codec.h"
 #include "core.h"
+#include "trace.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 int cache_service_init(cache_service_t *service, size_t capacity_pages, size_t page_size) {
+    return cache_service_init_ex(service, capacity_pages, page_size, 0);
+}
+
+int cache_service_init_ex(cache_service_t *service, size_t capacity_pages, size_t page_size, unsigned int flags) {
     if (!service) {
         return -1;
     }
@@ -13,7 +20,20 @@ int cache_service_init(cache_service_t *service, size_t capacity_pages, size_t p
         return 0;
     }
 
-    if (page_cache_init(&service->cache, capacity_pages, page_size) != 0) {
+    if (page_cache_init_slabs_ex(&service->cache, capacity_pages, page_size, flags) != 0) {
+        return -1;
+    }
+
+    if (!(flags & PAGE_CACHE_INIT_LAZY)) {
+        service->load_buffer = (uint8_t *)malloc(page_size);
+        service->codec_buffer = (uint8_t *)malloc(page_size);
+    }
+    if (!(flags & PAGE_CACHE_INIT_LAZY) && (!service->load_buffer || !service->codec_buffer)) {
+        page_cache_destroy(&service->cache);
+        free(service->load_buffer);
+        free(service->codec_buffer);
+        service->load_buffer = NULL;
+        service->codec_buffer = NULL;
         return -1;
     }
 
@@ -28,13 +48,27 @@ void cache_service_shutdown(cache_service_t *service) {
         return;
     }
 
+    if (service->tier) {
+        cache_tier_flush(service->tier);
+    }
     page_cache_destroy(&service->cache);
+    free(service->load_buffer);
+    free(service->codec_buffer);
     memset(service, 0, sizeof(*service));
 }
 
 int cache_service_clear(cache_service_t *service) {
     size_t capacity_pages;
     size_t page_size;
+    page_cache_evict_fn on_evict;
+    void *evict_context;
+    cache_service_loader_fn loader;
+    void *loader_context;
+    size_t compress_threshold;
+    page_cache_policy_t policy;
+    uint32_t generation;
+    unsigned int init_flags;
+    cache_tier_t *tier;
 
     if (!service || !service->ready) {
         return -1;
@@ -42,82 +76,393 @@ int cache_service_clear(cache_service_t *service) {
 
     capacity_pages = service->capacity_pages;
     page_size = service->page_size;
+    on_evict = service->cache.on_evict;
+    evict_context = service->cache.evict_context;
+    loader = service->loader;
+    loader_context = service->loader_context;
+    compress_threshold = service->compress_threshold;
+    policy = service->cache.policy;
+    generation = service->cache.generation;
+    init_flags = service->cache.init_flags;
+    tier = service->tier;
     cache_service_shutdown(service);
-    return cache_service_init(service, capacity_pages, page_size);
+    if (cache_service_init_ex(service, capacity_pages, page_size, init_flags) != 0) {
+        return -1;
+    }
+
+    page_cache_set_evict_callback(&service->cache, on_evict, evict_context);
+    service->loader = loader;
+    service->loader_context = loader_context;
+    service->compress_threshold = compress_threshold;
+    page_cache_set_policy(&service->cache, policy);
+    /* Generations keep counting up, so callers can compare them across a clear */
+    service->cache.generation = generation;
+    if (tier) {
+        cache_tier_clear(tier);
+        cache_service_set_tier(service, tier);
+    }
+    return 0;
+}
+
+/* A page-sized scratch buffer, allocated on first use for lazily initialised services. */
+static uint8_t *cache_service_scratch(cache_service_t *service, uint8_t **buffer) {
+    if (!*buffer) {
+        *buffer = (uint8_t *)malloc(service->page_size);
+    }
+    return *buffer;
+}
+
+/*
+ * RAM miss: reads page_id's stored bytes from the tier into load_buffer and
+ * puts them back in the cache. A failed put still serves this read.
+ */
+static int cache_service_promote(cache_service_t *service, uint32_t page_id, size_t *out_len, uint8_t *out_flags) {
+    if (!service->tier || !cache_service_scratch(service, &service->load_buffer) ||
+        cache_tier_get(service->tier, page_id, service->load_buffer, service->page_size, out_len, out_flags) != 0) {
+        return -1;
+    }
+
+    page_cache_put_ex(&service->cache, page_id, service->load_buffer, *out_len, *out_flags, 0);
+    return 0;
+}
+
+/* Demote callback: the clock or a trim is about to drop entry from RAM. */
+static void cache_service_demote(void *context, const page_cache_entry_t *entry) {
+    cache_service_t *service = (cache_service_t *)context;
+
+    cache_tier_put(service->tier, entry->page_id, entry->data, entry->data_len, entry->flags);
+}
+
+static int cache_service_copy_out(cache_service_t *service, uint32_t page_id, uint8_t *out_buffer, size_t *inout_len) {
+    page_cache_entry_t *entry = page_cache_get(&service->cache, page_id);
+    const uint8_t *data;
+    size_t data_len;
+    uint8_t flags;
+
+    if (entry) {
+        data = entry->data;
+        data_len = entry->data_len;
+        flags = entry->flags;
+    } else if (cache_service_promote(service, page_id, &data_len, &flags) == 0) {
+        data = service->load_buffer;
+    } else {
+        return -1;
+    }
+
+    if (flags & CACHE_SERVICE_FLAG_COMPRESSED) {
+        return cache_codec_decompress(data, data_len, out_buffer, *inout_len, inout_len);
+    }
+
+    if (*inout_len < data_len) {
+        return -1;
+    }
+
+    memcpy(out_buffer, data, data_len);
+    *inout_len = data_len;
+    return 0;
 }
 
 int cache_service_get(cache_service_t *service, uint32_t page_id, uint8_t *out_buffer, size_t *inout_len) {
-    page_cache_entry_t *entry;
+    uint64_t start = cache_metrics_now_ns();
+    int rc;
 
     if (!service || !service->ready || !out_buffer || !inout_len) {
         return -1;
     }
 
-    entry = page_cache_get(&service->cache, page_id);
-    if (!entry || *inout_len < entry->data_len) {
-        return -1;
+    CACHE_TRACE_BEGIN(CACHE_TRACE_SPAN_CACHE_GET, page_id);
+    rc = cache_service_copy_out(service, page_id, out_buffer, inout_len);
+    CACHE_TRACE_END(CACHE_TRACE_SPAN_CACHE_GET, page_id);
+    cache_latency_record(&service->latency[CACHE_OP_GET], start);
+    return rc;
+}
+
+static int cache_service_find_data(cache_service_t *service, uint32_t page_id, const uint8_t **out_data, size_t *out_len) {
+    page_cache_entry_t *entry = page_cache_get(&service->cache, page_id);
+    uint8_t flags;
+
+    /* A promoted page is read from load_buffer, or decompressed into codec_buffer */
+    if (!entry) {
+        if (cache_service_promote(service, page_id, out_len, &flags) != 0) {
+            return -1;
+        }
+        if (!(flags & CACHE_SERVICE_FLAG_COMPRESSED)) {
+            *out_data = service->load_buffer;
+            return 0;
+        }
+        if (!cache_service_scratch(service, &service->codec_buffer) ||
+            cache_codec_decompress(service->load_buffer, *out_len, service->codec_buffer, service->page_size, out_len) !=
+                0) {
+            return -1;
+        }
+        *out_data = service->codec_buffer;
+        return 0;
+    }
+
+    if (entry->flags & CACHE_SERVICE_FLAG_COMPRESSED) {
+        if (!cache_service_scratch(service, &service->load_buffer) ||
+            cache_codec_decompress(entry->data, entry->data_len, service->load_buffer, service->page_size, out_len) != 0) {
+            return -1;
+        }
+        *out_data = service->load_buffer;
+        return 0;
     }
 
-    memcpy(out_buffer, entry->data, entry->data_len);
-    *inout_len = entry->data_len;
+    *out_data = entry->data;
+    *out_len = entry->data_len;
     return 0;
 }
 
 int cache_service_get_ptr(cache_service_t *service, uint32_t page_id, const uint8_t **out_data, size_t *out_len) {
-    page_cache_entry_t *entry;
+    uint64_t start = cache_metrics_now_ns();
+    int rc;
 
     if (!service || !service->ready || !out_data || !out_len) {
         return -1;
     }
 
-    entry = page_cache_get(&service->cache, page_id);
-    if (!entry) {
+    CACHE_TRACE_BEGIN(CACHE_TRACE_SPAN_CACHE_GET, page_id);
+    rc = cache_service_find_data(service, page_id, out_data, out_len);
+    CACHE_TRACE_END(CACHE_TRACE_SPAN_CACHE_GET, page_id);
+    cache_latency_record(&service->latency[CACHE_OP_GET], start);
+    return rc;
+}
+
+static int cache_service_store(cache_service_t *service,
+                               uint32_t page_id,
+                               const uint8_t *data,
+                               size_t data_len,
+                               uint32_t cost) {
+    size_t packed_len = 0;
+
+    if (data_len > service->page_size) {
         return -1;
     }
 
-    *out_data = entry->data;
-    *out_len = entry->data_len;
+    /* Without a scratch buffer the value is simply stored raw */
+    if (service->compress_threshold > 0 && data_len >= service->compress_threshold && data &&
+        cache_service_scratch(service, &service->codec_buffer)) {
+        packed_len = cache_codec_compress(data, data_len, service->codec_buffer, service->page_size);
+    }
+
+    if (packed_len == 0) {
+        return page_cache_put_ex(&service->cache, page_id, data, data_len, 0, cost);
+    }
+
+    if (page_cache_put_ex(&service->cache,
+                          page_id,
+                          service->codec_buffer,
+                          packed_len,
+                          CACHE_SERVICE_FLAG_COMPRESSED,
+                          cost) != 0) {
+        return -1;
+    }
+
+    service->compressed_writes += 1;
+    service->compression_saved_bytes += data_len - packed_len;
     return 0;
 }
 
 int cache_service_set(cache_service_t *service, uint32_t page_id, const uint8_t *data, size_t data_len) {
+    return cache_service_set_cost(service, page_id, data, data_len, 0);
+}
+
+int cache_service_set_cost(cache_service_t *service,
+                           uint32_t page_id,
+                           const uint8_t *data,
+                           size_t data_len,
+                           uint32_t cost) {
+    uint64_t start = cache_metrics_now_ns();
+    uint64_t evictions;
+    int rc;
+
+    if (!service || !service->ready) {
+        return -1;
+    }
+
+    evictions = service->cache.evictions;
+    CACHE_TRACE_BEGIN(CACHE_TRACE_SPAN_CACHE_SET, page_id);
+    rc = cache_service_store(service, page_id, data, data_len, cost);
+    CACHE_TRACE_END(CACHE_TRACE_SPAN_CACHE_SET, page_id);
+    cache_latency_record(&service->latency[CACHE_OP_SET], start);
+    if (service->cache.evictions != evictions) {
+        cache_latency_record(&service->latency[CACHE_OP_EVICT], start);
+    }
+    return rc;
+}
+
+int cache_service_set_policy(cache_service_t *service, page_cache_policy_t policy) {
     if (!service || !service->ready) {
         return -1;
     }
 
-    return page_cache_put(&service->cache, page_id, data, data_len);
+    return page_cache_set_policy(&service->cache, policy);
+}
+
+int cache_service_invalidate(cache_service_t *service, uint32_t *out_generation) {
+    uint32_t generation;
+
+    if (!service || !service->ready) {
+        return -1;
+    }
+
+    generation = page_cache_bump_generation(&service->cache);
+    if (service->tier) {
+        cache_tier_clear(service->tier);
+    }
+    if (out_generation) {
+        *out_generation = generation;
+    }
+    return 0;
+}
+
+int cache_service_resize(cache_service_t *service, size_t capacity_pages) {
+    if (!service || !service->ready || page_cache_resize(&service->cache, capacity_pages) != 0) {
+        return -1;
+    }
+
+    service->capacity_pages = capacity_pages;
+    return 0;
+}
+
+size_t cache_service_trim(cache_service_t *service, size_t bytes_wanted) {
+    if (!service || !service->ready) {
+        return 0;
+    }
+
+    return page_cache_trim(&service->cache, bytes_wanted);
 }
 
 int cache_service_has(cache_service_t *service, uint32_t page_id) {
+    uint64_t start = cache_metrics_now_ns();
+    int has_page;
+
     if (!service || !service->ready) {
         return 0;
     }
 
-    return page_cache_has(&service->cache, page_id);
+    has_page = page_cache_has(&service->cache, page_id);
+    cache_latency_record(&service->latency[CACHE_OP_HAS], start);
+    return has_page;
+}
+
+void cache_service_set_compression(cache_service_t *service, size_t threshold_bytes) {
+    if (!service || !service->ready) {
+        return;
+    }
+
+    service->compress_threshold = threshold_bytes;
+}
+
+void cache_service_set_loader(cache_service_t *service, cache_service_loader_fn loader, void *context) {
+    if (!service || !service->ready) {
+        return;
+    }
+
+    service->loader = loader;
+    service->loader_context = context;
+}
+
+static int cache_service_is_queued(const cache_service_t *service, uint32_t page_id) {
+    size_t i;
+
+    for (i = 0; i < service->prefetch_count; ++i) {
+        size_t index = (service->prefetch_head + i) % CACHE_SERVICE_PREFETCH_QUEUE_LEN;
+        if (service->prefetch_queue[index] == page_id) {
+            return 1;
+        }
+    }
+
+    return 0;
 }
 
+/*
+ * Queues the missing pages for the loader and returns without loading any.
+ * Prefetch is a hint: ids beyond the queue capacity are dropped.
+ */
 int cache_service_prefetch(cache_service_t *service, const uint32_t *page_ids, size_t count) {
     size_t i;
 
-    if (!service || !service->ready || (!page_ids && count > 0)) {
+    if (!service || !service->ready || (!service->loader && !service->tier) || (!page_ids && count > 0)) {
         return -1;
     }
 
-    for (i = 0; i < count; ++i) {
-        if (page_cache_touch(&service->cache, page_ids[i]) == NULL) {
-            return -1;
+    for (i = 0; i < count && service->prefetch_count < CACHE_SERVICE_PREFETCH_QUEUE_LEN; ++i) {
+        size_t tail;
+
+        if (page_cache_has(&service->cache, page_ids[i]) || cache_service_is_queued(service, page_ids[i])) {
+            continue;
         }
+
+        tail = (service->prefetch_head + service->prefetch_count) % CACHE_SERVICE_PREFETCH_QUEUE_LEN;
+        service->prefetch_queue[tail] = page_ids[i];
+        service->prefetch_count += 1;
     }
 
     return 0;
 }
 
+/* Loads up to max_pages queued pages; returns how many were installed, or -1. */
+int cache_service_run_prefetch(cache_service_t *service, size_t max_pages) {
+    int installed = 0;
+
+    if (!service || !service->ready || (!service->loader && !service->tier) ||
+        !cache_service_scratch(service, &service->load_buffer)) {
+        return -1;
+    }
+
+    while (max_pages > 0 && service->prefetch_count > 0) {
+        uint32_t page_id = service->prefetch_queue[service->prefetch_head];
+        uint64_t start = cache_metrics_now_ns();
+        size_t data_len = 0;
+        uint8_t flags = 0;
+
+        service->prefetch_head = (service->prefetch_head + 1) % CACHE_SERVICE_PREFETCH_QUEUE_LEN;
+        service->prefetch_count -= 1;
+        max_pages -= 1;
+
+        if (page_cache_has(&service->cache, page_id)) {
+            continue;
+        }
+
+        /* The tier is cheaper than the loader, which usually recomputes */
+        if (cache_service_promote(service, page_id, &data_len, &flags) == 0) {
+            if (page_cache_has(&service->cache, page_id)) {
+                service->prefetch_loaded += 1;
+                installed += 1;
+            }
+            cache_latency_record(&service->latency[CACHE_OP_PREFETCH], start);
+            continue;
+        }
+
+        if (!service->loader ||
+            service->loader(service->loader_context, page_id, service->load_buffer, service->page_size, &data_len) != 0 ||
+            data_len > service->page_size) {
+            continue;
+        }
+
+        if (cache_service_store(service, page_id, service->load_buffer, data_len, 0) == 0) {
+            service->prefetch_loaded += 1;
+            installed += 1;
+        }
+        /* Loader plus store, for pages that reached the loader */
+        cache_latency_record(&service->latency[CACHE_OP_PREFETCH], start);
+    }
+
+    return installed;
+}
+
 int cache_service_pin(cache_service_t *service, uint32_t page_id) {
+    uint64_t start = cache_metrics_now_ns();
+    int rc;
+
     if (!service || !service->ready) {
         return -1;
     }
 
-    return page_cache_pin(&service->cache, page_id);
+    rc = page_cache_pin(&service->cache, page_id);
+    cache_latency_record(&service->latency[CACHE_OP_PIN], start);
+    return rc;
 }
 
 int cache_service_release(cache_service_t *service, uint32_t page_id) {
@@ -128,7 +473,31 @@ int cache_service_release(cache_service_t *service, uint32_t page_id) {
     return page_cache_unpin(&service->cache, page_id);
 }
 
+int cache_service_acquire(cache_service_t *service, uint32_t page_id, const uint8_t **out_data, size_t *out_len) {
+    uint64_t start = cache_metrics_now_ns();
+    page_cache_entry_t *entry;
+
+    if (!service || !service->ready || !out_data || !out_len) {
+        return -1;
+    }
+
+    entry = page_cache_get(&service->cache, page_id);
+    if (!entry || (entry->flags & CACHE_SERVICE_FLAG_COMPRESSED) || entry->pin_count == UINT16_MAX) {
+        cache_latency_record(&service->latency[CACHE_OP_GET], start);
+        return -1;
+    }
+
+    /* Pinned directly: page_cache_pin would look the page up, and count a hit, again */
+    entry->pin_count += 1;
+    *out_data = entry->data;
+    *out_len = entry->data_len;
+    cache_latency_record(&service->latency[CACHE_OP_GET], start);
+    return 0;
+}
+
 int cache_service_stats(cache_service_t *service, cache_service_stats_t *out_stats) {
+    size_t i;
+
     if (!service || !service->ready || !out_stats) {
         return -1;
     }
@@ -141,5 +510,68 @@ int cache_service_stats(cache_service_t *service, cache_service_stats_t *out_sta
     out_stats->metadata_bytes = service->cache.metadata_bytes;
     out_stats->hash_index_bytes = service->cache.hash_index_bytes;
     out_stats->payload_capacity_bytes = service->cache.payload_capacity_bytes;
+    out_stats->payload_committed_bytes = service->cache.payload_committed_bytes;
+    out_stats->entry_capacity = service->cache.entry_capacity;
+    out_stats->stored_bytes = page_cache_stored_bytes(&service->cache);
+    out_stats->fragmentation_bytes = page_cache_fragmentation_bytes(&service->cache);
+    out_stats->hash_capacity = service->cache.hash_capacity;
+    out_stats->hash_count = service->cache.hash_count;
+    out_stats->probe_count = service->cache.probe_count;
+    out_stats->probe_steps = service->cache.probe_steps;
+    out_stats->probe_max = service->cache.probe_max;
+    out_stats->prefetch_pending = service->prefetch_count;
+    out_stats->prefetch_loaded = service->prefetch_loaded;
+    out_stats->compressed_writes = service->compressed_writes;
+    out_stats->compression_saved_bytes = service->compression_saved_bytes;
+    out_stats->tier_hits = service->tier ? service->tier->hits : 0;
+    out_stats->tier_misses = service->tier ? service->tier->misses : 0;
+    out_stats->tier_writes = service->tier ? service->tier->writes : 0;
+    out_stats->tier_corrupt = service->tier ? service->tier->corrupt : 0;
+    out_stats->policy = service->cache.policy;
+    memcpy(out_stats->policies, service->cache.policy_stats, sizeof(out_stats->policies));
+    out_stats->generation = service->cache.generation;
+    out_stats->invalidations = service->cache.invalidations;
+    out_stats->class_count = service->cache.class_count;
+    memcpy(out_stats->probe_histogram, service->cache.probe_histogram, sizeof(out_stats->probe_histogram));
+    memcpy(out_stats->latency, service->latency, sizeof(out_stats->latency));
+
+    for (i = 0; i < service->cache.class_count; ++i) {
+        const page_cache_class_t *size_class = &service->cache.classes[i];
+
+        out_stats->classes[i].chunk_size = size_class->chunk_size;
+        out_stats->classes[i].capacity = size_class->slot_count;
+        out_stats->classes[i].entries = size_class->count;
+        out_stats->classes[i].stored_bytes = size_class->stored_bytes;
+        out_stats->classes[i].evictions = size_class->evictions;
+    }
+
     return 0;
 }
+
+void cache_service_set_evict_callback(cache_service_t *service, page_cache_evict_fn on_evict, void *context) {
+    if (!service || !service->ready) {
+        return;
+    }
+
+    page_cache_set_evict_callback(&service->cache, on_evict, context);
+}
+
+void cache_service_set_tier(cache_service_t *service, cache_tier_t *tier) {
+    if (!service || !service->ready) {
+        return;
+    }
+
+    service->tier = tier;
+    page_cache_set_demote_callback(&service->cache, tier ? cache_service_demote : NULL, service);
+}
+
+int cache_service_persist(cache_service_t *service) {
+    size_t demoted;
+
+    if (!service || !service->ready || !service->tier) {
+        return -1;
+    }
+
+    demoted = page_cache_demote_live(&service->cache);
+    return cache_tier_flush(service->tier) == 0 ? (int)demoted : -1;
+}
@@ -5,11 +5,36 @@
 #include <stdint.h>
 
 #include "core.h"
+#include "metrics.h"
+#include "tier.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define CACHE_SERVICE_PREFETCH_QUEUE_LEN 64
+
+/* Entry flag: the stored bytes are a codec.h stream, not the raw value. */
+#define CACHE_SERVICE_FLAG_COMPRESSED 0x01
+
+/*
+ * Prefetch loader: writes at most capacity bytes of page_id's data to out and
+ * stores the length in *out_len. A non-zero return skips the page.
+ */
+typedef int (*cache_service_loader_fn)(void *context,
+                                       uint32_t page_id,
+                                       uint8_t *out,
+                                       size_t capacity,
+                                       size_t *out_len);
+
+typedef struct {
+    size_t chunk_size;
+    size_t capacity;
+    size_t entries;
+    size_t stored_bytes;
+    uint64_t evictions;
+} cache_service_class_stats_t;
+
 typedef struct {
     uint64_t hits;
     uint64_t misses;
@@ -19,26 +44,112 @@ typedef struct {
     size_t metadata_bytes;
     size_t hash_index_bytes;
     size_t payload_capacity_bytes;
+    size_t payload_committed_bytes;
+    size_t entry_capacity;
+    size_t stored_bytes;
+    size_t fragmentation_bytes;
+    size_t hash_capacity;
+    size_t hash_count;
+    uint64_t probe_count;
+    uint64_t probe_steps;
+    size_t probe_max;
+    size_t prefetch_pending;
+    uint64_t prefetch_loaded;
+    uint64_t compressed_writes;
+    uint64_t compression_saved_bytes;
+    uint64_t tier_hits;
+    uint64_t tier_misses;
+    uint64_t tier_writes;
+    uint64_t tier_corrupt;
+    page_cache_policy_t policy;
+    page_cache_policy_stats_t policies[PAGE_CACHE_POLICY_COUNT];
+    uint32_t generation;
+    uint64_t invalidations;
+    size_t class_count;
+    cache_service_class_stats_t classes[PAGE_CACHE_MAX_CLASSES];
+    uint64_t probe_histogram[PAGE_CACHE_PROBE_BUCKETS];
+    cache_latency_histogram_t latency[CACHE_OP_COUNT];
 } cache_service_stats_t;
 
+/*
+ * Values of at least compress_threshold bytes (0 disables it) are stored
+ * compressed when that makes them smaller; codec_buffer is the scratch for it.
+ * A service initialised with PAGE_CACHE_INIT_LAZY also defers load_buffer and
+ * codec_buffer until a decompress, compress or prefetch first needs them.
+ * prefetch_queue is a ring of page ids waiting for the loader; it is drained
+ * by cache_service_run_prefetch from the host's idle hook, on the same thread
+ * as every other service call. latency is indexed by cache_op_t and, like the
+ * other counters, restarts on clear. tier, when attached, is borrowed: the
+ * caller opens it before cache_service_set_tier and closes it after the
+ * service lets go.
+ */
 typedef struct {
     page_cache_t cache;
     size_t capacity_pages;
     size_t page_size;
     int ready;
+    cache_service_loader_fn loader;
+    void *loader_context;
+    uint8_t *load_buffer;
+    uint8_t *codec_buffer;
+    size_t compress_threshold;
+    uint64_t compressed_writes;
+    uint64_t compression_saved_bytes;
+    uint32_t prefetch_queue[CACHE_SERVICE_PREFETCH_QUEUE_LEN];
+    size_t prefetch_head;
+    size_t prefetch_count;
+    uint64_t prefetch_loaded;
+    cache_tier_t *tier;
+    cache_latency_histogram_t latency[CACHE_OP_COUNT];
 } cache_service_t;
 
 int cache_service_init(cache_service_t *service, size_t capacity_pages, size_t page_size);
+/* flags are PAGE_CACHE_INIT_* (core.h); they survive cache_service_clear. */
+int cache_service_init_ex(cache_service_t *service, size_t capacity_pages, size_t page_size, unsigned int flags);
 void cache_service_shutdown(cache_service_t *service);
 int cache_service_clear(cache_service_t *service);
 int cache_service_get(cache_service_t *service, uint32_t page_id, uint8_t *out_buffer, size_t *inout_len);
+/* For compressed values *out_data points into a service buffer, valid until the next service call. */
 int cache_service_get_ptr(cache_service_t *service, uint32_t page_id, const uint8_t **out_data, size_t *out_len);
 int cache_service_set(cache_service_t *service, uint32_t page_id, const uint8_t *data, size_t data_len);
+/* cost is a recompute-cost hint for PAGE_CACHE_POLICY_COST_CLOCK (caller units, 0 = cheap). */
+int cache_service_set_cost(cache_service_t *service,
+                           uint32_t page_id,
+                           const uint8_t *data,
+                           size_t data_len,
+                           uint32_t cost);
+int cache_service_set_policy(cache_service_t *service, page_cache_policy_t policy);
+/* Bumps the generation so every current entry reads as a miss; see page_cache_bump_generation. */
+int cache_service_invalidate(cache_service_t *service, uint32_t *out_generation);
+/* Resizes in place, keeping warm entries; see page_cache_resize. */
+int cache_service_resize(cache_service_t *service, size_t capacity_pages);
+/* Frees lazily committed payload; returns the bytes freed. See page_cache_trim. */
+size_t cache_service_trim(cache_service_t *service, size_t bytes_wanted);
 int cache_service_has(cache_service_t *service, uint32_t page_id);
+void cache_service_set_compression(cache_service_t *service, size_t threshold_bytes);
+void cache_service_set_loader(cache_service_t *service, cache_service_loader_fn loader, void *context);
 int cache_service_prefetch(cache_service_t *service, const uint32_t *page_ids, size_t count);
+int cache_service_run_prefetch(cache_service_t *service, size_t max_pages);
 int cache_service_pin(cache_service_t *service, uint32_t page_id);
 int cache_service_release(cache_service_t *service, uint32_t page_id);
+/*
+ * Pins page_id and returns its stored bytes in place, for zero-copy readers.
+ * Fails for missing or compressed pages. The pointer stays valid until the
+ * matching cache_service_release; a set of the same page rewrites it in place.
+ */
+int cache_service_acquire(cache_service_t *service, uint32_t page_id, const uint8_t **out_data, size_t *out_len);
 int cache_service_stats(cache_service_t *service, cache_service_stats_t *out_stats);
+void cache_service_set_evict_callback(cache_service_t *service, page_cache_evict_fn on_evict, void *context);
+/*
+ * Attaches a persistent second level (NULL detaches it). Clock victims and
+ * trimmed entries are demoted into it as stored, compressed or not; a get,
+ * get_ptr or prefetch that misses RAM reads it next and promotes a hit back
+ * into the cache. has and acquire look at RAM only. invalidate and clear
+ * drop its records too.
+ */
+void cache_service_set_tier(cache_service_t *service, cache_tier_t *tier);
+/* Writes every live entry to the tier too, e.g. before the app exits; returns how many, or -1. */
+int cache_service_persist(cache_service_t *service);
 
 #ifdef __cplusplus
 }
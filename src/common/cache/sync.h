@@ -0,0 +1,89 @@
+#ifndef CACHE_SYNC_H
+#define CACHE_SYNC_H
+
+/*
+ * Opt-in locking for the native cache.
+ *
+ * Build with CACHE_THREAD_SAFE to let worker threads share caches with the
+ * UI thread: locks become pthread mutexes and bridge response buffers become
+ * thread-local. Without it every lock compiles away and the bridge keeps its
+ * single-threaded behaviour.
+ */
+
+#include <stdint.h>
+
+#if defined(CACHE_THREAD_SAFE)
+
+#include <pthread.h>
+
+typedef pthread_mutex_t cache_lock_t;
+
+#define CACHE_LOCK_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define CACHE_THREAD_LOCAL _Thread_local
+#else
+#define CACHE_THREAD_LOCAL __thread
+#endif
+
+static inline void cache_lock_init(cache_lock_t *lock) {
+    pthread_mutex_init(lock, NULL);
+}
+
+static inline void cache_lock_destroy(cache_lock_t *lock) {
+    pthread_mutex_destroy(lock);
+}
+
+static inline void cache_lock_acquire(cache_lock_t *lock) {
+    pthread_mutex_lock(lock);
+}
+
+static inline void cache_lock_release(cache_lock_t *lock) {
+    pthread_mutex_unlock(lock);
+}
+
+/* Relaxed: process-wide tallies that are only ever read as a snapshot. */
+static inline void cache_counter_add(uint64_t *counter, uint64_t amount) {
+    __atomic_fetch_add(counter, amount, __ATOMIC_RELAXED);
+}
+
+static inline uint64_t cache_counter_load(const uint64_t *counter) {
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+#else
+
+typedef struct {
+    char unused;
+} cache_lock_t;
+
+#define CACHE_LOCK_INITIALIZER {0}
+#define CACHE_THREAD_LOCAL
+
+static inline void cache_lock_init(cache_lock_t *lock) {
+    (void)lock;
+}
+
+static inline void cache_lock_destroy(cache_lock_t *lock) {
+    (void)lock;
+}
+
+static inline void cache_lock_acquire(cache_lock_t *lock) {
+    (void)lock;
+}
+
+static inline void cache_lock_release(cache_lock_t *lock) {
+    (void)lock;
+}
+
+static inline void cache_counter_add(uint64_t *counter, uint64_t amount) {
+    *counter += amount;
+}
+
+static inline uint64_t cache_counter_load(const uint64_t *counter) {
+    return *counter;
+}
+
+#endif
+
+#endif
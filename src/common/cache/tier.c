@@ -0,0 +1,209 @@
+#include "tier.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* "CTR1", first bytes of every tier file */
+#define CACHE_TIER_MAGIC 0x31525443u
+
+/*
+ * Header: magic, slot size, slot count, epoch. Record prefix: checksum,
+ * page id, epoch, then the length in the low 24 bits and the flags in the
+ * top byte. All little-endian.
+ */
+
+/* FNV-1a over a byte range */
+static uint32_t cache_tier_checksum(const uint8_t *data, size_t length) {
+    uint32_t hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < length; ++i) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void cache_tier_put_u32(uint8_t *ptr, uint32_t value) {
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        ptr[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint32_t cache_tier_get_u32(const uint8_t *ptr) {
+    return (uint32_t)ptr[0] | (uint32_t)ptr[1] << 8 | (uint32_t)ptr[2] << 16 | (uint32_t)ptr[3] << 24;
+}
+
+static int cache_tier_write_header(cache_tier_t *tier) {
+    uint8_t header[CACHE_TIER_HEADER_SIZE];
+
+    cache_tier_put_u32(header, CACHE_TIER_MAGIC);
+    cache_tier_put_u32(header + 4, (uint32_t)tier->slot_size);
+    cache_tier_put_u32(header + 8, (uint32_t)tier->slot_count);
+    cache_tier_put_u32(header + 12, tier->epoch);
+    if (fseek(tier->file, 0, SEEK_SET) != 0 || fwrite(header, 1, sizeof(header), tier->file) != sizeof(header)) {
+        return -1;
+    }
+    return fflush(tier->file) == 0 ? 0 : -1;
+}
+
+/* Keeps an existing file whose geometry matches; returns -1 to start over. */
+static int cache_tier_read_header(cache_tier_t *tier) {
+    uint8_t header[CACHE_TIER_HEADER_SIZE];
+
+    if (fread(header, 1, sizeof(header), tier->file) != sizeof(header) ||
+        cache_tier_get_u32(header) != CACHE_TIER_MAGIC ||
+        cache_tier_get_u32(header + 4) != (uint32_t)tier->slot_size ||
+        cache_tier_get_u32(header + 8) != (uint32_t)tier->slot_count) {
+        return -1;
+    }
+
+    tier->epoch = cache_tier_get_u32(header + 12);
+    return tier->epoch != 0 ? 0 : -1;
+}
+
+static int cache_tier_seek_slot(cache_tier_t *tier, uint32_t page_id) {
+    size_t offset = CACHE_TIER_HEADER_SIZE + (size_t)(page_id % tier->slot_count) * tier->slot_size;
+
+    return fseek(tier->file, (long)offset, SEEK_SET);
+}
+
+int cache_tier_open(cache_tier_t *tier, const char *path, size_t max_value_len, size_t max_bytes) {
+    if (!tier || !path || max_value_len == 0 || max_value_len > CACHE_TIER_MAX_VALUE_LEN) {
+        return -1;
+    }
+
+    memset(tier, 0, sizeof(*tier));
+    tier->slot_size = CACHE_TIER_RECORD_PREFIX_SIZE + max_value_len;
+    if (max_bytes < CACHE_TIER_HEADER_SIZE + tier->slot_size) {
+        return -1;
+    }
+    tier->slot_count = (max_bytes - CACHE_TIER_HEADER_SIZE) / tier->slot_size;
+    if (tier->slot_count > UINT32_MAX) {
+        tier->slot_count = UINT32_MAX;
+    }
+
+    tier->buffer = (uint8_t *)malloc(tier->slot_size);
+    if (!tier->buffer) {
+        return -1;
+    }
+
+    tier->file = fopen(path, "r+b");
+    if (tier->file && cache_tier_read_header(tier) != 0) {
+        fclose(tier->file);
+        tier->file = NULL;
+    }
+
+    if (!tier->file) {
+        /* Truncates whatever was there; records of another geometry are useless */
+        tier->file = fopen(path, "w+b");
+        tier->epoch = 1;
+        if (!tier->file || cache_tier_write_header(tier) != 0) {
+            cache_tier_close(tier);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void cache_tier_close(cache_tier_t *tier) {
+    if (!tier) {
+        return;
+    }
+
+    if (tier->file) {
+        fclose(tier->file);
+    }
+    free(tier->buffer);
+    memset(tier, 0, sizeof(*tier));
+}
+
+int cache_tier_put(cache_tier_t *tier, uint32_t page_id, const uint8_t *data, size_t data_len, uint8_t flags) {
+    size_t record_len = CACHE_TIER_RECORD_PREFIX_SIZE + data_len;
+
+    if (!tier || !tier->file || record_len > tier->slot_size || (data_len > 0 && !data)) {
+        return -1;
+    }
+
+    cache_tier_put_u32(tier->buffer + 4, page_id);
+    cache_tier_put_u32(tier->buffer + 8, tier->epoch);
+    cache_tier_put_u32(tier->buffer + 12, (uint32_t)data_len | (uint32_t)flags << 24);
+    if (data_len > 0) {
+        memcpy(tier->buffer + CACHE_TIER_RECORD_PREFIX_SIZE, data, data_len);
+    }
+    cache_tier_put_u32(tier->buffer, cache_tier_checksum(tier->buffer + 4, record_len - 4));
+
+    /* Only the record is written; the rest of the slot keeps whatever it held */
+    if (cache_tier_seek_slot(tier, page_id) != 0 || fwrite(tier->buffer, 1, record_len, tier->file) != record_len) {
+        return -1;
+    }
+
+    tier->writes += 1;
+    return 0;
+}
+
+int cache_tier_get(cache_tier_t *tier,
+                   uint32_t page_id,
+                   uint8_t *out_buffer,
+                   size_t capacity,
+                   size_t *out_len,
+                   uint8_t *out_flags) {
+    size_t data_len;
+    uint32_t length_and_flags;
+
+    if (!tier || !tier->file || !out_buffer || !out_len || !out_flags) {
+        return -1;
+    }
+
+    /* A slot past the end of the file was never written */
+    if (cache_tier_seek_slot(tier, page_id) != 0 ||
+        fread(tier->buffer, 1, CACHE_TIER_RECORD_PREFIX_SIZE, tier->file) != CACHE_TIER_RECORD_PREFIX_SIZE) {
+        tier->misses += 1;
+        return -1;
+    }
+
+    length_and_flags = cache_tier_get_u32(tier->buffer + 12);
+    data_len = length_and_flags & CACHE_TIER_MAX_VALUE_LEN;
+    if (cache_tier_get_u32(tier->buffer + 4) != page_id || cache_tier_get_u32(tier->buffer + 8) != tier->epoch ||
+        CACHE_TIER_RECORD_PREFIX_SIZE + data_len > tier->slot_size || data_len > capacity) {
+        tier->misses += 1;
+        return -1;
+    }
+
+    if (fread(tier->buffer + CACHE_TIER_RECORD_PREFIX_SIZE, 1, data_len, tier->file) != data_len ||
+        cache_tier_get_u32(tier->buffer) !=
+            cache_tier_checksum(tier->buffer + 4, CACHE_TIER_RECORD_PREFIX_SIZE - 4 + data_len)) {
+        tier->corrupt += 1;
+        tier->misses += 1;
+        return -1;
+    }
+
+    memcpy(out_buffer, tier->buffer + CACHE_TIER_RECORD_PREFIX_SIZE, data_len);
+    *out_len = data_len;
+    *out_flags = (uint8_t)(length_and_flags >> 24);
+    tier->hits += 1;
+    return 0;
+}
+
+int cache_tier_clear(cache_tier_t *tier) {
+    if (!tier || !tier->file) {
+        return -1;
+    }
+
+    tier->epoch += 1;
+    if (tier->epoch == 0) {
+        tier->epoch = 1;
+    }
+    return cache_tier_write_header(tier);
+}
+
+int cache_tier_flush(cache_tier_t *tier) {
+    if (!tier || !tier->file) {
+        return -1;
+    }
+
+    return fflush(tier->file) == 0 ? 0 : -1;
+}
@@ -0,0 +1,69 @@
+#ifndef CACHE_TIER_H
+#define CACHE_TIER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Persistent second cache level: a slotted file on flash under a
+ * cache_service_t. The file is a header followed by slot_count fixed-size
+ * slots; page_id % slot_count picks a page's slot, so the file never grows
+ * past its cap and the newest demotion into a slot wins it.
+ *
+ * Each record carries a checksum over its page id, epoch, length, flags and
+ * data. A torn write, a stale epoch or another page's record in the slot
+ * all read as a miss. Clearing bumps the epoch in the header instead of
+ * rewriting every slot. A file whose slot geometry does not match the one
+ * asked for (a new record layout, a new cap) is started over.
+ *
+ * Not thread-safe: the owning service serialises calls.
+ */
+
+#define CACHE_TIER_HEADER_SIZE 16
+#define CACHE_TIER_RECORD_PREFIX_SIZE 16
+/* Record lengths share a word with the flags byte */
+#define CACHE_TIER_MAX_VALUE_LEN 0x00FFFFFFu
+
+typedef struct {
+    FILE *file;
+    size_t slot_size;
+    size_t slot_count;
+    uint32_t epoch;
+    /* One slot, for reads and writes */
+    uint8_t *buffer;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t writes;
+    /* Records that failed their checksum */
+    uint64_t corrupt;
+} cache_tier_t;
+
+/*
+ * Opens or creates path with slots for values of up to max_value_len bytes,
+ * as many as fit in max_bytes. Returns -1 if the file cannot be opened or
+ * not even one slot fits.
+ */
+int cache_tier_open(cache_tier_t *tier, const char *path, size_t max_value_len, size_t max_bytes);
+void cache_tier_close(cache_tier_t *tier);
+int cache_tier_put(cache_tier_t *tier, uint32_t page_id, const uint8_t *data, size_t data_len, uint8_t flags);
+/* 0 and the stored bytes and flags on a hit, -1 on a miss or if capacity is short. */
+int cache_tier_get(cache_tier_t *tier,
+                   uint32_t page_id,
+                   uint8_t *out_buffer,
+                   size_t capacity,
+                   size_t *out_len,
+                   uint8_t *out_flags);
+/* Drops every record by bumping the epoch. */
+int cache_tier_clear(cache_tier_t *tier);
+int cache_tier_flush(cache_tier_t *tier);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
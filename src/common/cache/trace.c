@@ -0,0 +1,160 @@
+#include "trace.h"
+
+#include "sync.h"
+
+#include <string.h>
+
+#if defined(CACHE_TRACE)
+#include <time.h>
+
+typedef struct {
+    /* 0 while a writer fills the slot, otherwise its event index + 1 */
+    uint64_t sequence;
+    cache_trace_event_t event;
+} cache_trace_slot_t;
+
+static cache_trace_slot_t g_trace_ring[CACHE_TRACE_RING_LEN];
+static uint64_t g_trace_head;
+static uint64_t g_trace_counters[CACHE_TRACE_COUNTER_COUNT];
+
+#if defined(CACHE_THREAD_SAFE)
+
+static inline uint64_t cache_trace_claim(void) {
+    return __atomic_fetch_add(&g_trace_head, 1, __ATOMIC_RELAXED);
+}
+
+static inline void cache_trace_publish(uint64_t *sequence, uint64_t value) {
+    __atomic_store_n(sequence, value, __ATOMIC_RELEASE);
+}
+
+static inline uint64_t cache_trace_observe(const uint64_t *sequence) {
+    return __atomic_load_n(sequence, __ATOMIC_ACQUIRE);
+}
+
+#else
+
+static inline uint64_t cache_trace_claim(void) {
+    return g_trace_head++;
+}
+
+static inline void cache_trace_publish(uint64_t *sequence, uint64_t value) {
+    *sequence = value;
+}
+
+static inline uint64_t cache_trace_observe(const uint64_t *sequence) {
+    return *sequence;
+}
+
+#endif
+
+static uint64_t cache_trace_now_ns(void) {
+    struct timespec now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        return 0;
+    }
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+void cache_trace_record(cache_trace_span_t span, int phase, uint32_t arg) {
+    uint64_t index = cache_trace_claim();
+    cache_trace_slot_t *slot = &g_trace_ring[index % CACHE_TRACE_RING_LEN];
+
+    cache_trace_publish(&slot->sequence, 0);
+    slot->event.timestamp_ns = cache_trace_now_ns();
+    slot->event.arg = arg;
+    slot->event.span = (uint16_t)span;
+    slot->event.phase = (uint8_t)phase;
+    slot->event.reserved = 0;
+    cache_trace_publish(&slot->sequence, index + 1);
+}
+
+void cache_trace_count(cache_trace_counter_t counter, uint64_t amount) {
+    if ((unsigned)counter < CACHE_TRACE_COUNTER_COUNT) {
+        cache_counter_add(&g_trace_counters[counter], amount);
+    }
+}
+
+int cache_trace_enabled(void) {
+    return 1;
+}
+
+size_t cache_trace_snapshot(cache_trace_event_t *events, size_t capacity) {
+    uint64_t head = cache_counter_load(&g_trace_head);
+    uint64_t index = head > CACHE_TRACE_RING_LEN ? head - CACHE_TRACE_RING_LEN : 0;
+    size_t copied = 0;
+
+    if (!events) {
+        return 0;
+    }
+
+    for (; index < head && copied < capacity; ++index) {
+        const cache_trace_slot_t *slot = &g_trace_ring[index % CACHE_TRACE_RING_LEN];
+        cache_trace_event_t event;
+
+        /* Skip slots that are mid-write or were overwritten while copying */
+        if (cache_trace_observe(&slot->sequence) != index + 1) {
+            continue;
+        }
+        event = slot->event;
+        if (cache_trace_observe(&slot->sequence) != index + 1) {
+            continue;
+        }
+        events[copied++] = event;
+    }
+    return copied;
+}
+
+void cache_trace_counters(uint64_t counters[CACHE_TRACE_COUNTER_COUNT]) {
+    size_t i;
+
+    for (i = 0; i < CACHE_TRACE_COUNTER_COUNT; ++i) {
+        counters[i] = cache_counter_load(&g_trace_counters[i]);
+    }
+}
+
+void cache_trace_reset(void) {
+    size_t i;
+
+    for (i = 0; i < CACHE_TRACE_RING_LEN; ++i) {
+        cache_trace_publish(&g_trace_ring[i].sequence, 0);
+    }
+    for (i = 0; i < CACHE_TRACE_COUNTER_COUNT; ++i) {
+        cache_trace_publish(&g_trace_counters[i], 0);
+    }
+}
+
+#else
+
+int cache_trace_enabled(void) {
+    return 0;
+}
+
+size_t cache_trace_snapshot(cache_trace_event_t *events, size_t capacity) {
+    (void)events;
+    (void)capacity;
+    return 0;
+}
+
+void cache_trace_counters(uint64_t counters[CACHE_TRACE_COUNTER_COUNT]) {
+    memset(counters, 0, CACHE_TRACE_COUNTER_COUNT * sizeof(uint64_t));
+}
+
+void cache_trace_reset(void) {
+}
+
+#endif
+
+const char *cache_trace_span_name(cache_trace_span_t span) {
+    static const char *const names[CACHE_TRACE_SPAN_COUNT] = {
+        "calculate", "cacheGet", "cacheSet", "bridgeJson", "bridgeBinary"
+    };
+    return (unsigned)span < CACHE_TRACE_SPAN_COUNT ? names[span] : "unknown";
+}
+
+const char *cache_trace_counter_name(cache_trace_counter_t counter) {
+    static const char *const names[CACHE_TRACE_COUNTER_COUNT] = {
+        "betaFraction", "gammaSeries", "gammaFraction", "pmfTerms"
+    };
+    return (unsigned)counter < CACHE_TRACE_COUNTER_COUNT ? names[counter] : "unknown";
+}
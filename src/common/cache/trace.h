@@ -0,0 +1,95 @@
+#ifndef CACHE_TRACE_H
+#define CACHE_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Opt-in hot-path tracing.
+ *
+ * Build with CACHE_TRACE to record begin/end events with a monotonic
+ * timestamp into a fixed ring of CACHE_TRACE_RING_LEN slots, and to count
+ * the iterations spent in the special-function loops and PMF summations.
+ * Writers claim a slot with one atomic increment and never block, so the
+ * newest events overwrite the oldest. Without CACHE_TRACE the macros below
+ * compile away, the ring is not allocated and the snapshot functions report
+ * no events.
+ */
+
+#define CACHE_TRACE_RING_LEN 256
+
+typedef enum {
+    CACHE_TRACE_SPAN_CALCULATE = 0,     /* orchestrator_calculate_with_request; arg is the distribution */
+    CACHE_TRACE_SPAN_CACHE_GET = 1,     /* cache_service_get and _get_ptr; arg is the page id */
+    CACHE_TRACE_SPAN_CACHE_SET = 2,     /* cache_service_set_cost; arg is the page id */
+    CACHE_TRACE_SPAN_BRIDGE_JSON = 3,   /* cache_bridge_invoke */
+    CACHE_TRACE_SPAN_BRIDGE_BINARY = 4, /* cache_bridge_invoke_binary; arg is the opcode */
+    CACHE_TRACE_SPAN_COUNT
+} cache_trace_span_t;
+
+typedef enum {
+    CACHE_TRACE_COUNTER_BETA_FRACTION = 0,  /* beta_continued_fraction iterations */
+    CACHE_TRACE_COUNTER_GAMMA_SERIES = 1,   /* incomplete gamma power-series terms */
+    CACHE_TRACE_COUNTER_GAMMA_FRACTION = 2, /* incomplete gamma continued-fraction iterations */
+    CACHE_TRACE_COUNTER_PMF_TERMS = 3,      /* PMF terms added by discrete CDF and interval sums */
+    CACHE_TRACE_COUNTER_COUNT
+} cache_trace_counter_t;
+
+#define CACHE_TRACE_PHASE_BEGIN 0
+#define CACHE_TRACE_PHASE_END 1
+
+typedef struct {
+    uint64_t timestamp_ns;
+    uint32_t arg;
+    uint16_t span;
+    uint8_t phase;
+    uint8_t reserved;
+} cache_trace_event_t;
+
+#if defined(CACHE_TRACE)
+
+void cache_trace_record(cache_trace_span_t span, int phase, uint32_t arg);
+void cache_trace_count(cache_trace_counter_t counter, uint64_t amount);
+
+#define CACHE_TRACE_BEGIN(span, arg) cache_trace_record((span), CACHE_TRACE_PHASE_BEGIN, (uint32_t)(arg))
+#define CACHE_TRACE_END(span, arg) cache_trace_record((span), CACHE_TRACE_PHASE_END, (uint32_t)(arg))
+#define CACHE_TRACE_COUNT(counter, amount) cache_trace_count((counter), (uint64_t)(amount))
+
+#else
+
+/* sizeof keeps arguments "used" without evaluating them */
+#define CACHE_TRACE_BEGIN(span, arg) ((void)sizeof(arg))
+#define CACHE_TRACE_END(span, arg) ((void)sizeof(arg))
+#define CACHE_TRACE_COUNT(counter, amount) ((void)sizeof(amount))
+
+#endif
+
+/* 1 when built with CACHE_TRACE. */
+int cache_trace_enabled(void);
+
+/*
+ * Copies up to capacity of the retained events, oldest first, and returns
+ * how many were copied. Slots a writer is filling during the copy are
+ * skipped rather than returned half-written.
+ */
+size_t cache_trace_snapshot(cache_trace_event_t *events, size_t capacity);
+
+/* Copies the iteration counters, indexed by cache_trace_counter_t. */
+void cache_trace_counters(uint64_t counters[CACHE_TRACE_COUNTER_COUNT]);
+
+/* Drops every retained event and zeroes the counters. */
+void cache_trace_reset(void);
+
+/* Lower-camel names for the QuickJS dump, "unknown" when out of range. */
+const char *cache_trace_span_name(cache_trace_span_t span);
+const char *cache_trace_counter_name(cache_trace_counter_t counter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
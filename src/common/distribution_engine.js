@@ -3,7 +3,20 @@ import {
   STAT_SQRT_2PI, 
   ABRAMOWITZ_STEGUN_COEFF, 
   ABRAMOWITZ_STEGUN_CONST } from './constants.js';
+import LRUCache from './lru_cache.js'
 import { registerRuntimeCleanup } from './cache/runtime_cleanup.js'
+import {
+  configureNativeResultCache,
+  configureNativeResultTier,
+  configureNativeTableCache,
+  invalidateNativeResults,
+  NATIVE_RESULT_SLOTS,
+  nativeAdaptiveSeries,
+  nativeCalculateInto,
+  nativeGenerateSeries,
+  nativeLogFactorial,
+  nativeLogGamma
+} from './cache/bridge.js'
 
 const DISTRIBUTION_TYPES = {
   DIST_NORMAL: 0,
@@ -44,66 +57,87 @@ class CalculationResult {
   }
 }
 
-import CacheService from './cache/cache.js'
-
-const memoCache = {
-  logFactorial: new CacheService({ namespace: 'logFactorial', capacityPages: 500 }),
-  logGamma: new CacheService({ namespace: 'logGamma', capacityPages: 500 }),
-  logCombination: new CacheService({ namespace: 'logCombination', capacityPages: 500 })
-}
-
-let memoCacheCleanupInterval = null
-let memoCacheDestroyed = false
-let unregisterMemoCacheCleanup = () => {}
+// Scalar results memoized by the native orchestrator; keyed on the exact
+// (distribution, params, x) bits, so repeated slider positions skip the math.
+const NATIVE_RESULT_CACHE_ENTRIES = 256
+configureNativeResultCache(NATIVE_RESULT_CACHE_ENTRIES)
+
+// Whole-support PMF, CDF and survival tables of discrete parameter sets, built
+// on first use and shared by results, intervals and charts, so dragging x
+// across a binomial or Poisson is a lookup per step.
+const NATIVE_TABLE_CACHE_TABLES = 8
+configureNativeTableCache(NATIVE_TABLE_CACHE_TABLES)
+
+// Results evicted from it go to a capped flash file beside the history and
+// are read back before recomputing, so popular ones survive a relaunch.
+const NATIVE_RESULT_TIER_PATH = 'calc_results.tier'
+const NATIVE_RESULT_TIER_BYTES = 64 * 1024
+configureNativeResultTier(NATIVE_RESULT_TIER_PATH, NATIVE_RESULT_TIER_BYTES)
+
+// log(n!) for n < LOG_FACTORIAL_TABLE_SIZE, filled lazily from the native
+// log-factorial cache (LOG_FACTORIAL_CACHE_SIZE in math_utils.h) when a provider
+// is installed, otherwise by the running sum log(n!) = log((n-1)!) + log(n).
+// log(n!) > 0 for n >= 2, so 0 marks an empty slot.
+const LOG_FACTORIAL_TABLE_SIZE = 4096
+
+const logFactorialTable = {
+  values: new Float64Array(LOG_FACTORIAL_TABLE_SIZE),
+  prefix: 2,
+  entries: 0,
+
+  fill(n) {
+    const nativeValue = nativeLogFactorial(n)
+    if (nativeValue !== null) {
+      this.values[n] = nativeValue
+      this.entries++
+      return nativeValue
+    }
 
-const resultPool = {
-  pool: [],
-  maxSize: 25,
-  
-  get() {
-    if (this.pool.length > 0) {
-      return this.pool.pop()
+    for (let i = this.prefix; i <= n; i++) {
+      if (this.values[i] === 0) {
+        this.values[i] = this.values[i - 1] + Math.log(i)
+        this.entries++
+      }
     }
-    return new CalculationResult()
-  },
-  
-  release(result) {
-    if (this.pool.length < this.maxSize) {
-      // Clear all references
-      result.success = false
-      result.pdfResult = 0
-      result.pmfResult = 0
-      result.cdfResult = 0
-      result.errorMessage = null
-      result.chartData = null
-      this.pool.push(result)
+    if (n >= this.prefix) {
+      this.prefix = n + 1
     }
+    return this.values[n]
   },
-  
-  // Force cleanup of result pool
-  cleanup() {
-    this.pool.length = 0
+
+  clear() {
+    this.values.fill(0)
+    this.prefix = 2
+    this.entries = 0
   }
 }
 
-// Periodic cleanup
-memoCacheCleanupInterval = setInterval(() => {
-  // Clear caches
-  if (memoCache.logFactorial.size > 300) {
-    memoCache.logFactorial.clear()
-  }
-  if (memoCache.logGamma.size > 300) {
-    memoCache.logGamma.clear()
-  }
-  if (memoCache.logCombination.size > 300) {
-    memoCache.logCombination.clear()
-  }
-  
-  // Cleanup result pool
-  if (resultPool.pool.length > 15) {
-    resultPool.cleanup()
+// Continuous charts are sampled adaptively for the Chart component's canvas
+// (400px high, about the band's width across). Widths are rounded up to a
+// power of two, the level of detail, so nearby widths share one series.
+const CHART_WIDTH_PX = 192
+const CHART_HEIGHT_PX = 400
+const CHART_MIN_LOD_WIDTH_PX = 64
+const CHART_MAX_EVALUATIONS = 256
+const CHART_SERIES_ENTRIES = 16
+
+// Interleaved x, y series from nativeAdaptiveSeries by distribution, parameters, range and level of detail
+const chartSeriesCache = new LRUCache(CHART_SERIES_ENTRIES)
+
+function chartLevelOfDetail(widthPx) {
+  let lod = CHART_MIN_LOD_WIDTH_PX
+  while (lod < widthPx) {
+    lod *= 2
   }
-}, 30000)
+  return lod
+}
+
+// Flat buffer nativeCalculateInto fills on every native call, so the only
+// object a calculation allocates is the CalculationResult handed back
+const nativeResultSlots = new Float64Array(NATIVE_RESULT_SLOTS)
+
+let memoCacheDestroyed = false
+let unregisterMemoCacheCleanup = () => {}
 
 function destroyMemoCache() {
   if (memoCacheDestroyed) {
@@ -112,54 +146,56 @@ function destroyMemoCache() {
   memoCacheDestroyed = true
   unregisterMemoCacheCleanup()
 
-  if (memoCacheCleanupInterval) {
-    clearInterval(memoCacheCleanupInterval)
-    memoCacheCleanupInterval = null
-  }
-
-  memoCache.logFactorial.destroy()
-  memoCache.logGamma.destroy()
-  memoCache.logCombination.destroy()
-  resultPool.cleanup()
+  // Before the cache goes, so its results are written out
+  configureNativeResultTier(NATIVE_RESULT_TIER_PATH, 0)
+  configureNativeResultCache(0)
+  configureNativeTableCache(0)
+  logFactorialTable.clear()
+  chartSeriesCache.clear()
 }
 
 unregisterMemoCacheCleanup = registerRuntimeCleanup(destroyMemoCache)
 
 class DistributionCalculator {
   static createResult(success = false, pdfResult = 0, cdfResult = 0, errorMessage = null, chartData = null) {
-    const result = resultPool.get()
-    result.success = success
-    result.pdfResult = pdfResult
-    result.pmfResult = pdfResult
-    result.cdfResult = cdfResult
-    result.errorMessage = errorMessage
-    result.chartData = chartData
-    return result
+    return new CalculationResult(success, pdfResult, cdfResult, errorMessage, chartData)
+  }
+
+  // Compiled-C result from the native orchestrator, or null to compute in JS
+  static nativeResult(type, params, x) {
+    if (!nativeCalculateInto(type, params, x, nativeResultSlots)) {
+      return null
+    }
+    return this.createResult(true, nativeResultSlots[0], nativeResultSlots[1])
   }
 
   static clearCache(cacheType = 'all') {
     if (cacheType === 'all' || cacheType === 'logFactorial') {
-      memoCache.logFactorial.clear()
+      logFactorialTable.clear()
     }
-    if (cacheType === 'all' || cacheType === 'logGamma') {
-      memoCache.logGamma.clear()
+    if (cacheType === 'all' || cacheType === 'results') {
+      invalidateNativeResults()
     }
-    if (cacheType === 'all' || cacheType === 'logCombination') {
-      memoCache.logCombination.clear()
+    if (cacheType === 'all' || cacheType === 'charts') {
+      chartSeriesCache.clear()
     }
   }
 
   static getCacheStats() {
     return {
-      logFactorial: memoCache.logFactorial.size,
-      logGamma: memoCache.logGamma.size,
-      logCombination: memoCache.logCombination.size,
-      resultPoolSize: resultPool.pool.length,
-      totalCacheEntries: memoCache.logFactorial.size + memoCache.logGamma.size + memoCache.logCombination.size
+      logFactorial: logFactorialTable.entries,
+      charts: chartSeriesCache.size,
+      totalCacheEntries: logFactorialTable.entries + chartSeriesCache.size
     }
   }
 
   static binomial(n, p, k) {
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_BINOMIAL, [n, p], k)
+    if (native) {
+      native.chartData = this.generateBinomialChartData(n, p)
+      return native
+    }
+
     const logCombo = this.logCombination(n, k)
     const logP = Math.log(p)
     const log1MinusP = Math.log(1 - p)
@@ -182,9 +218,11 @@ class DistributionCalculator {
 
   static generateBinomialChartData(n, p) {
     const labels = [];
-    const data = [];
+    const series = nativeGenerateSeries(DISTRIBUTION_TYPES.DIST_BINOMIAL, [n, p], 0, n, n + 1);
+    const data = series ? Array.from(series) : [];
     for (let k = 0; k <= n; k++) {
       labels.push(k);
+      if (series) continue;
       const logCombo = this.logCombination(n, k);
       const logP = Math.log(p);
       const log1MinusP = Math.log(1 - p);
@@ -205,6 +243,12 @@ class DistributionCalculator {
   }
 
   static poisson(lambda, k) {
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_POISSON, [lambda], k)
+    if (native) {
+      native.chartData = this.generatePoissonChartData(lambda)
+      return native
+    }
+
     const logLambda = Math.log(lambda)
     const logProb = k * logLambda - lambda - this.logFactorial(k)
     const pmf = Math.exp(logProb)
@@ -225,11 +269,13 @@ class DistributionCalculator {
 
   static generatePoissonChartData(lambda) {
     const labels = [];
-    const data = [];
     const maxK = Math.max(20, Math.ceil(lambda + 5 * Math.sqrt(lambda)));
+    const series = nativeGenerateSeries(DISTRIBUTION_TYPES.DIST_POISSON, [lambda], 0, maxK, maxK + 1);
+    const data = series ? Array.from(series) : [];
 
     for (let k = 0; k <= maxK; k++) {
       labels.push(k);
+      if (series) continue;
       const logProb = k * Math.log(lambda) - lambda - this.logFactorial(k);
       data.push(Math.exp(logProb));
     }
@@ -247,6 +293,9 @@ class DistributionCalculator {
   }
 
   static geometric(p, k) {
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_GEOMETRIC, [p], k)
+    if (native) return native
+
     const log1MinusP = Math.log(1 - p)
     const logProb = (k - 1) * log1MinusP + Math.log(p)
     const pmf = Math.exp(logProb)
@@ -256,21 +305,61 @@ class DistributionCalculator {
   }
 
   static negativeBinomial(r, p, k) {
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_NEGATIVE_BINOMIAL, [r, p], k)
+    if (native) return native
+
     const pmf = jstat.negbin.pdf(k, r, p);
     const cdf = jstat.negbin.cdf(k, r, p);
     return this.createResult(true, pmf, cdf);
   }
 
   static hypergeometric(N, K, n, k) {
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_HYPERGEOMETRIC, [N, K, n], k)
+    if (native) {
+      native.chartData = this.generateHypergeometricChartData(N, K, n)
+      return native
+    }
+
     const pmf = jstat.hypgeom.pdf(k, N, K, n);
     const cdf = jstat.hypgeom.cdf(k, N, K, n);
-    return this.createResult(true, pmf, cdf);
+    const chartData = this.generateHypergeometricChartData(N, K, n);
+    return this.createResult(true, pmf, cdf, null, chartData);
+  }
+
+  // The support clipped to mean ± 5σ, so large populations stay a readable chart
+  static generateHypergeometricChartData(N, K, n) {
+    const labels = [];
+    const mean = (n * K) / N;
+    const sd = N > 1 ? Math.sqrt((mean * (N - K) * (N - n)) / (N * (N - 1))) : 0;
+    const kMin = Math.max(0, n - (N - K), Math.floor(mean - 5 * sd));
+    const kMax = Math.min(n, K, Math.ceil(mean + 5 * sd));
+    const series = nativeGenerateSeries(DISTRIBUTION_TYPES.DIST_HYPERGEOMETRIC, [N, K, n], kMin, kMax, kMax - kMin + 1);
+    const data = series ? Array.from(series) : [];
+
+    for (let k = kMin; k <= kMax; k++) {
+      labels.push(k);
+      if (series) continue;
+      data.push(jstat.hypgeom.pdf(k, N, K, n));
+    }
+
+    return {
+      labels,
+      datasets: [
+        {
+          label: "PMF",
+          data,
+          backgroundColor: "#00ff88",
+        },
+      ],
+    };
   }
 
   static chiSquareDistribution(k, x) {
     if (k <= 0 || x < 0) {
       return this.createResult(false, 0, 0, 'Invalid parameters');
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_CHI_SQUARE, [k], x)
+    if (native) return native
     const pdf = jstat.chisquare.pdf(x, k);
     const cdf = jstat.chisquare.cdf(x, k);
     return this.createResult(true, pdf, cdf);
@@ -280,6 +369,8 @@ class DistributionCalculator {
     if (nu <= 0) {
       return this.createResult(false, 0, 0, 'Invalid degrees of freedom');
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_T_DISTRIBUTION, [nu], t)
+    if (native) return native
     const pdf = jstat.studentt.pdf(t, nu);
     const cdf = jstat.studentt.cdf(t, nu);
     return this.createResult(true, pdf, cdf);
@@ -289,6 +380,8 @@ class DistributionCalculator {
     if (d1 <= 0 || d2 <= 0 || x < 0) {
       return this.createResult(false, 0, 0, 'Invalid parameters');
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_F_DISTRIBUTION, [d1, d2], x)
+    if (native) return native
     const pdf = jstat.centralF.pdf(x, d1, d2);
     const cdf = jstat.centralF.cdf(x, d1, d2);
     return this.createResult(true, pdf, cdf);
@@ -298,12 +391,20 @@ class DistributionCalculator {
     if (alpha <= 0 || beta <= 0 || x < 0 || x > 1) {
       return this.createResult(false, 0, 0, 'Invalid parameters');
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_BETA, [alpha, beta], x)
+    if (native) return native
     const pdf = jstat.beta.pdf(x, alpha, beta);
     const cdf = jstat.beta.cdf(x, alpha, beta);
     return this.createResult(true, pdf, cdf);
   }
 
   static normalDistribution(mu, sigma, x) {
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_NORMAL, [mu, sigma], x)
+    if (native) {
+      native.chartData = this.generateNormalChartData(mu, sigma)
+      return native
+    }
+
     const z = (x - mu) / sigma
     const pdf = (MATH_CONSTANTS.INV_SQRT_2PI / sigma) * Math.exp(-0.5 * z * z)
     const cdf = this.standardNormalCDF(z)
@@ -311,20 +412,60 @@ class DistributionCalculator {
     return this.createResult(true, pdf, cdf, null, chartData)
   }
 
-  static generateNormalChartData(mu, sigma) {
+  // {x, y} points from the native adaptive sampler at the level of detail for
+  // widthPx, or null without a native provider. Non-finite values (poles)
+  // become gaps.
+  static adaptiveChartPoints(type, params, xMin, xMax, widthPx) {
+    const lod = chartLevelOfDetail(widthPx)
+    const key = `${type}:${params.join(',')}:${xMin}:${xMax}:${lod}`
+    let series = chartSeriesCache.get(key)
+    if (!series) {
+      series = nativeAdaptiveSeries(type, params, xMin, xMax, lod, CHART_HEIGHT_PX, CHART_MAX_EVALUATIONS)
+      if (!series) {
+        return null
+      }
+      chartSeriesCache.set(key, series)
+    }
+
+    const points = new Array(series.length / 2)
+    for (let i = 0; i < points.length; i++) {
+      const y = series[2 * i + 1]
+      points[i] = { x: series[2 * i], y: Number.isFinite(y) ? y : null }
+    }
+    return points
+  }
+
+  static generateNormalChartData(mu, sigma, widthPx = CHART_WIDTH_PX) {
     const dataPoints = 100;
     const range = 8 * sigma;
     const step = range / dataPoints;
     const startX = mu - 4 * sigma;
     
+    // Unlabelled points: the Chart component plots them on a linear x axis
+    const points = this.adaptiveChartPoints(DISTRIBUTION_TYPES.DIST_NORMAL, [mu, sigma], startX, startX + range, widthPx);
+    if (points) {
+      return {
+        datasets: [
+          {
+            label: "PDF",
+            data: points,
+            borderColor: "#00ff88",
+            fill: false,
+          },
+        ],
+      };
+    }
+    
     const labels = [];
-    const data = [];
+    const series = nativeGenerateSeries(DISTRIBUTION_TYPES.DIST_NORMAL, [mu, sigma], startX, startX + range, dataPoints + 1);
+    const data = series ? Array.from(series) : [];
     
     for (let i = 0; i <= dataPoints; i++) {
       const x = startX + i * step;
+      labels.push(x.toFixed(2));
+      if (series) continue;
       const z = (x - mu) / sigma;
       const pdf = (MATH_CONSTANTS.INV_SQRT_2PI / sigma) * Math.exp(-0.5 * z * z);
-      labels.push(x.toFixed(2));
       data.push(pdf);
     }
     
@@ -345,6 +486,8 @@ class DistributionCalculator {
     if (lambda <= 0 || x < 0) {
       return this.createResult(false, 0, 0, 'Invalid parameters')
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_EXPONENTIAL, [lambda], x)
+    if (native) return native
     const pdf = lambda * Math.exp(-lambda * x)
     const cdf = 1 - Math.exp(-lambda * x)
     return this.createResult(true, pdf, cdf)
@@ -354,6 +497,8 @@ class DistributionCalculator {
     if (a >= b) {
       return this.createResult(false, 0, 0, 'Invalid parameters: a must be less than b')
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_UNIFORM, [a, b], x)
+    if (native) return native
     let pdf = 0
     let cdf = 0
     if (x >= a && x <= b) {
@@ -373,6 +518,8 @@ class DistributionCalculator {
     if (k <= 0 || theta <= 0 || x < 0) {
       return this.createResult(false, 0, 0, 'Invalid parameters')
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_GAMMA, [k, theta], x)
+    if (native) return native
     const pdf = jstat.gamma.pdf(x, k, theta);
     const cdf = jstat.gamma.cdf(x, k, theta);
     return this.createResult(true, pdf, cdf)
@@ -382,6 +529,8 @@ class DistributionCalculator {
     if (k <= 0 || lambda <= 0 || x < 0) {
       return this.createResult(false, 0, 0, 'Invalid parameters')
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_WEIBULL, [k, lambda], x)
+    if (native) return native
     const pdf = (k / lambda) * Math.pow(x / lambda, k - 1) * Math.exp(-Math.pow(x / lambda, k))
     const cdf = 1 - Math.exp(-Math.pow(x / lambda, k))
     return this.createResult(true, pdf, cdf)
@@ -391,6 +540,9 @@ class DistributionCalculator {
     if (alpha <= 0 || xm <= 0 || x < xm) {
       return this.createResult(false, 0, 0, 'Invalid parameters: α > 0, xm > 0, x ≥ xm')
     }
+    // The native Pareto takes (scale, shape)
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_PARETO, [xm, alpha], x)
+    if (native) return native
     const pdf = (alpha * Math.pow(xm, alpha)) / Math.pow(x, alpha + 1)
     const cdf = 1 - Math.pow(xm / x, alpha)
     return this.createResult(true, pdf, cdf)
@@ -400,6 +552,8 @@ class DistributionCalculator {
     if (sigma <= 0 || x < 0) {
       return this.createResult(false, 0, 0, 'Invalid parameters')
     }
+    const native = this.nativeResult(DISTRIBUTION_TYPES.DIST_RAYLEIGH, [sigma], x)
+    if (native) return native
     const pdf = (x / (sigma * sigma)) * Math.exp(-(x * x) / (2 * sigma * sigma))
     const cdf = 1 - Math.exp(-(x * x) / (2 * sigma * sigma))
     return this.createResult(true, pdf, cdf)
@@ -409,48 +563,31 @@ class DistributionCalculator {
     if (k > n || k < 0) return -Infinity
     if (k === 0 || k === n) return 0
 
-    const key = `${n},${k}`
-    const cachedResult = memoCache.logCombination.get(key)
-    if (cachedResult !== null) {
-      return cachedResult
-    }
-
-    const result = this.logFactorial(n) - this.logFactorial(k) - this.logFactorial(n - k)
-    memoCache.logCombination.set(key, result)
-
-    return result
+    return this.logFactorial(n) - this.logFactorial(k) - this.logFactorial(n - k)
   }
 
   static logFactorial(n) {
     if (n <= 1) return 0
 
-    const cachedResult = memoCache.logFactorial.get(n)
-    if (cachedResult !== null) {
-      return cachedResult
-    }
-
-    let result = 0
-    for (let i = 2; i <= n; i++) {
-      result += Math.log(i)
+    if (n < LOG_FACTORIAL_TABLE_SIZE) {
+      const value = logFactorialTable.values[n]
+      return value !== 0 ? value : logFactorialTable.fill(n)
     }
 
-    memoCache.logFactorial.set(n, result)
-    return result
+    const nativeValue = nativeLogFactorial(n)
+    return nativeValue !== null ? nativeValue : this.logGamma(n + 1)
   }
 
+  // Native Lanczos with the integer and half-integer tables when a provider
+  // is installed; the Stirling series is cheap enough not to memoize
   static logGamma(z) {
-    const key = z.toString()
-    const cachedResult = memoCache.logGamma.get(key)
-    if (cachedResult !== null) {
-      return cachedResult
+    const nativeValue = nativeLogGamma(z)
+    if (nativeValue !== null) {
+      return nativeValue
     }
 
-    const originalZ = z
     if (z < 1) z += 1
-    const result = (z - 0.5) * Math.log(z) - z + MATH_CONSTANTS.HALF_LOG_2PI + 1 / (12 * z) - 1 / (360 * z * z * z)
-
-    memoCache.logGamma.set(originalZ.toString(), result)
-    return result
+    return (z - 0.5) * Math.log(z) - z + MATH_CONSTANTS.HALF_LOG_2PI + 1 / (12 * z) - 1 / (360 * z * z * z)
   }
 
   static logBeta(a, b) {
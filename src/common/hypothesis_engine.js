@@ -1,5 +1,10 @@
 import jstat from 'jstat';
+import { createNativeRegression, nativeHypothesisSummary, nativeHypothesisTest, nativeSampleStats } from './cache/bridge.js';
 
+/**
+ * With a native provider registered (cache/bridge.js) the tests below run in
+ * legacy/calc/hypothesis/hypothesis_kernels.c; the JS bodies are the fallback.
+ */
 class HypothesisEngine {
   /**
    * Validate statistics parameters
@@ -23,6 +28,9 @@ class HypothesisEngine {
     if (!data || !Array.isArray(data) || data.length === 0) {
       return { n: 0, mean: 0, s: 0, variance: 0 };
     }
+    const native = nativeSampleStats(data);
+    if (native) return native;
+
     const validData = data.filter(Number.isFinite);
     if (validData.length === 0) return { n: 0, mean: 0, s: 0, variance: 0 };
 
@@ -45,6 +53,9 @@ class HypothesisEngine {
    * @returns {object} { z, pValueTwoTail, pValueLeft, pValueRight, lowerCI, upperCI }
    */
   static zTestOneSample({ mean, n, sigma, mu0, alpha = 0.05 }) {
+    const native = nativeHypothesisTest('zTestOneSample', { mean, n, sigma, mu0, alpha });
+    if (native) return native;
+
     const error = this._validateParams({ n, sigma });
     if (error) return error;
 
@@ -85,6 +96,9 @@ class HypothesisEngine {
    * @returns {object} { z, pValueTwoTail, pValueLeft, pValueRight, lowerCI, upperCI }
    */
   static zTestTwoSample({ mean1, n1, sigma1, mean2, n2, sigma2, diff = 0, alpha = 0.05 }) {
+    const native = nativeHypothesisTest('zTestTwoSample', { mean1, n1, sigma1, mean2, n2, sigma2, diff, alpha });
+    if (native) return native;
+
     const error = this._validateParams({ n: n1, sigma: sigma1 }) || this._validateParams({ n: n2, sigma: sigma2 });
     if (error) return error;
 
@@ -117,6 +131,9 @@ class HypothesisEngine {
    * @returns {object} { t, df, pValueTwoTail, pValueLeft, pValueRight, lowerCI, upperCI }
    */
   static tTestOneSample({ mean, n, s, mu0, alpha = 0.05 }) {
+    const native = nativeHypothesisTest('tTestOneSample', { mean, n, s, mu0, alpha });
+    if (native) return native;
+
     const error = this._validateParams({ n, s });
     if (error) return error;
     if (n <= 1) return { error: 'invalid_n', message: 'Sample size must be > 1 for t-test' };
@@ -154,6 +171,9 @@ class HypothesisEngine {
    * @returns {object} { t, df, pValueTwoTail, pValueLeft, pValueRight, lowerCI, upperCI }
    */
   static tTestTwoSample({ mean1, n1, s1, mean2, n2, s2, equalVariances = false, diff = 0, alpha = 0.05 }) {
+    const native = nativeHypothesisTest('tTestTwoSample', { mean1, n1, s1, mean2, n2, s2, equalVariances, diff, alpha });
+    if (native) return native;
+
     const error = this._validateParams({ n: n1, s: s1 }) || this._validateParams({ n: n2, s: s2 });
     if (error) return error;
     if (n1 <= 1 || n2 <= 1) return { error: 'invalid_n', message: 'Sample sizes must be > 1' };
@@ -202,6 +222,9 @@ class HypothesisEngine {
     if (!sample1 || !sample2 || sample1.length !== sample2.length || sample1.length <= 1) {
       return { error: 'invalid_samples', message: 'Samples must be same length and > 1' };
     }
+
+    const native = nativeHypothesisTest('tTestPaired', { sample1, sample2, alpha });
+    if (native) return native;
     
     const diffs = [];
     for (let i = 0; i < sample1.length; i++) {
@@ -231,6 +254,9 @@ class HypothesisEngine {
    * @returns {object} { f, df1, df2, pValueTwoTail, pValueLeft, pValueRight }
    */
   static fTestTwoSample({ s1, n1, s2, n2 }) {
+    const native = nativeHypothesisTest('fTestTwoSample', { s1, n1, s2, n2 });
+    if (native) return native;
+
     const error = this._validateParams({ n: n1, s: s1 }) || this._validateParams({ n: n2, s: s2 });
     if (error) return error;
     if (n1 <= 1 || n2 <= 1) return { error: 'invalid_n', message: 'Sample sizes must be > 1' };
@@ -266,6 +292,8 @@ class HypothesisEngine {
     if (!observed || !expected || observed.length !== expected.length || observed.length < 2) {
       return { error: 'invalid_data' };
     }
+    const native = nativeHypothesisTest('chiSquareGoodnessOfFit', { observed, expected });
+    if (native) return native;
 
     const n = jstat.sum(observed);
     const expectedSum = jstat.sum(expected);
@@ -323,6 +351,8 @@ class HypothesisEngine {
     if (!x || !y || x.length !== y.length || x.length <= 2) {
       return { error: 'invalid_data', message: 'Need at least 3 points for regression' };
     }
+    const native = nativeHypothesisTest('linearRegression', { x, y, alpha });
+    if (native) return native;
 
     const pairs = [];
     for (let i = 0; i < x.length; i++) {
@@ -350,6 +380,15 @@ class HypothesisEngine {
       syy += dy * dy;
     }
 
+    return this._regressionFromSums(n, meanX, meanY, sxx, sxy, syy, alpha);
+  }
+
+  /**
+   * Slope t-test from centered sums; shared by linearRegression and RegressionAccumulator.
+   * @param {number} n @param {number} meanX @param {number} meanY
+   * @param {number} sxx @param {number} sxy @param {number} syy @param {number} alpha
+   */
+  static _regressionFromSums(n, meanX, meanY, sxx, sxy, syy, alpha) {
     if (sxx === 0) return { error: 'zero_variance_x', message: 'X values must vary' };
 
     const slope = sxy / sxx;
@@ -418,6 +457,8 @@ class HypothesisEngine {
     if (!observedMatrix || observedMatrix.length < 2 || observedMatrix[0].length < 2) {
       return { error: 'invalid_matrix', message: 'Matrix must be at least 2x2' };
     }
+    const native = nativeHypothesisTest('chiSquareIndependence', { matrix: observedMatrix });
+    if (native) return native;
 
     const rows = observedMatrix.length;
     const cols = observedMatrix[0].length;
@@ -455,6 +496,206 @@ class HypothesisEngine {
       pValue
     };
   }
+
+  /**
+   * Everything a Z or t result page shows, from one set of moments: the
+   * single test's result plus the p-value and decision for the chosen tail,
+   * intervals at several confidence levels, Cohen's d and the power at alpha
+   * if the true effect equals the observed one (shifted central t for t tests).
+   * Each distinct critical value is computed once and shared.
+   * @param {'zTestOneSample' | 'zTestTwoSample' | 'tTestOneSample' | 'tTestTwoSample'} kind
+   * @param {object} options - the test's parameters plus tail and levels
+   * @param {'two_tail' | 'left_tail' | 'right_tail'} [options.tail='two_tail']
+   * @param {number[]} [options.levels=[0.90, 0.95, 0.99]]
+   * @returns {object} test result + { pValue, reject, estimate, standardError, criticalValue,
+   *   intervals: { level, lower, upper }[], effectSize, power }
+   */
+  static summary(kind, { tail = 'two_tail', levels = SUMMARY_LEVELS, alpha = 0.05, ...params } = {}) {
+    const native = nativeHypothesisSummary(kind, { ...params, tail, levels, alpha });
+    if (native) return native;
+
+    if (!SUMMARY_TESTS.includes(kind)) throw new RangeError('Unknown summary test');
+    if (levels.length > SUMMARY_MAX_LEVELS) throw new RangeError('Too many confidence levels');
+    const oneSided = tail === 'left_tail' || tail === 'right_tail';
+    if (!(alpha > 0 && alpha < (oneSided ? 0.5 : 1)) || !levels.every(level => level > 0 && level < 1)) {
+      return { error: 'invalid_data' };
+    }
+
+    const result = this[kind]({ ...params, alpha });
+    if (result.error) return result;
+
+    const isZ = kind.startsWith('z');
+    const twoSample = kind.endsWith('TwoSample');
+    const { mean, n, mu0, mean1, n1, mean2, n2, diff = 0, equalVariances = false } = params;
+    const a = isZ ? (twoSample ? params.sigma1 : params.sigma) : (twoSample ? params.s1 : params.s);
+    const b = isZ ? params.sigma2 : params.s2;
+    const estimate = twoSample ? mean1 - mean2 : mean;
+    const nullValue = twoSample ? diff : mu0;
+    const df = isZ ? Infinity : result.df;
+    const pooledVariance = ((n1 - 1) * a * a + (n2 - 1) * b * b) / (n1 + n2 - 2);
+    const se = !twoSample ? a / Math.sqrt(n)
+      : kind === 'tTestTwoSample' && equalVariances ? Math.sqrt(pooledVariance * (1 / n1 + 1 / n2))
+      : Math.sqrt(a * a / n1 + b * b / n2);
+    const scale = !twoSample ? a
+      : kind === 'tTestTwoSample' && equalVariances ? Math.sqrt(pooledVariance)
+      : Math.sqrt((a * a + b * b) / 2);
+
+    const criticalValues = new Map();
+    const critical = (level) => {
+      const key = level.toFixed(12);
+      if (!criticalValues.has(key)) {
+        const q = 1 - level / 2;
+        criticalValues.set(key, isZ ? jstat.normal.inv(q, 0, 1) : jstat.studentt.inv(q, df));
+      }
+      return criticalValues.get(key);
+    };
+    const cdf = x => (isZ ? jstat.normal.cdf(x, 0, 1) : jstat.studentt.cdf(x, df));
+
+    const shift = (estimate - nullValue) / se;
+    const c = critical(oneSided ? 2 * alpha : alpha);
+    const pValue = tail === 'left_tail' ? result.pValueLeft
+      : tail === 'right_tail' ? result.pValueRight
+      : result.pValueTwoTail;
+    const power = tail === 'left_tail' ? cdf(-shift - c)
+      : tail === 'right_tail' ? cdf(shift - c)
+      : cdf(shift - c) + cdf(-shift - c);
+
+    return {
+      ...result,
+      pValue,
+      reject: pValue < alpha,
+      estimate,
+      standardError: se,
+      criticalValue: tail === 'left_tail' ? -c : c,
+      intervals: levels.map(level => {
+        const margin = critical(1 - level) * se;
+        return { level, lower: estimate - margin, upper: estimate + margin };
+      }),
+      effectSize: (estimate - nullValue) / scale,
+      power
+    };
+  }
+}
+
+const SUMMARY_TESTS = ['zTestOneSample', 'zTestTwoSample', 'tTestOneSample', 'tTestTwoSample'];
+const SUMMARY_LEVELS = [0.90, 0.95, 0.99];
+// Mirrors HYPOTHESIS_SUMMARY_MAX_LEVELS in hypothesis_kernels.h
+const SUMMARY_MAX_LEVELS = 4;
+
+// Centered sums of squares below this fraction of the raw sum are rounding residue (as in hypothesis_kernels.c)
+const CANCELLATION_EPSILON = 1e-12;
+
+/**
+ * Online simple linear regression: add, remove or replace one (x, y) point
+ * in O(1) and fit on demand without revisiting the data. Sums are
+ * compensated (Neumaier) and taken relative to the first point added, like
+ * the native accumulator that backs this class when a provider is registered.
+ * Callers only remove or replace points they added.
+ */
+export class RegressionAccumulator {
+  constructor() {
+    this._native = createNativeRegression();
+    this.count = 0;
+    this._shiftX = 0;
+    this._shiftY = 0;
+    // sum and compensation for x, y, xx, xy and yy
+    this._sums = new Float64Array(10);
+  }
+
+  /** @param {number} index @param {number} value */
+  _sumAdd(index, value) {
+    const sums = this._sums;
+    const total = sums[index] + value;
+    if (Math.abs(sums[index]) >= Math.abs(value)) {
+      sums[index + 1] += (sums[index] - total) + value;
+    } else {
+      sums[index + 1] += (value - total) + sums[index];
+    }
+    sums[index] = total;
+  }
+
+  /** @param {number} index */
+  _sumValue(index) {
+    return this._sums[index] + this._sums[index + 1];
+  }
+
+  /** @param {number} x @param {number} y @param {number} sign */
+  _apply(x, y, sign) {
+    const dx = x - this._shiftX;
+    const dy = y - this._shiftY;
+    this._sumAdd(0, sign * dx);
+    this._sumAdd(2, sign * dy);
+    this._sumAdd(4, sign * dx * dx);
+    this._sumAdd(6, sign * dx * dy);
+    this._sumAdd(8, sign * dy * dy);
+  }
+
+  /**
+   * @param {number} x @param {number} y
+   * @returns {boolean} false for a non-finite point, which is not added
+   */
+  add(x, y) {
+    if (!Number.isFinite(x) || !Number.isFinite(y)) return false;
+    if (this._native) {
+      if (!this._native.add(x, y)) return false;
+    } else {
+      if (this.count === 0) {
+        this._shiftX = x;
+        this._shiftY = y;
+      }
+      this._apply(x, y, 1);
+    }
+    this.count++;
+    return true;
+  }
+
+  /** @param {number} x @param {number} y @returns {boolean} */
+  remove(x, y) {
+    if (this.count === 0 || !Number.isFinite(x) || !Number.isFinite(y)) return false;
+    if (this._native) {
+      if (!this._native.remove(x, y)) return false;
+    } else if (this.count === 1) {
+      this._sums.fill(0);
+    } else {
+      this._apply(x, y, -1);
+    }
+    this.count--;
+    return true;
+  }
+
+  /** @param {number} oldX @param {number} oldY @param {number} x @param {number} y @returns {boolean} */
+  replace(oldX, oldY, x, y) {
+    if (!Number.isFinite(x) || !Number.isFinite(y)) return false;
+    if (this._native) return this._native.replace(oldX, oldY, x, y);
+    return this.remove(oldX, oldY) && this.add(x, y);
+  }
+
+  /** @param {number} index @param {number} a @param {number} b @param {boolean} square */
+  _centered(index, a, b, square) {
+    const raw = this._sumValue(index);
+    const centered = raw - this._sumValue(a) * this._sumValue(b) / this.count;
+    return square && centered <= CANCELLATION_EPSILON * raw ? 0 : centered;
+  }
+
+  /**
+   * Fit of the accumulated points, with HypothesisEngine.linearRegression's result shape.
+   * @param {number} [alpha=0.05]
+   */
+  fit(alpha = 0.05) {
+    if (this._native) return this._native.fit(alpha);
+    const n = this.count;
+    if (n <= 2) return { error: 'invalid_data', message: 'Need at least 3 points for regression' };
+
+    return HypothesisEngine._regressionFromSums(
+      n,
+      this._shiftX + this._sumValue(0) / n,
+      this._shiftY + this._sumValue(2) / n,
+      this._centered(4, 0, 0, true),
+      this._centered(6, 0, 2, false),
+      this._centered(8, 2, 2, true),
+      alpha
+    );
+  }
 }
 
 export default HypothesisEngine;
@@ -68,6 +68,16 @@ class LRUCache {
     return this.cache.has(key);
   }
 
+  // Drops least recently used entries until the new size fits
+  resize(maxSize) {
+    this.maxSize = maxSize;
+    while (this.cache.size > Math.max(maxSize, 0)) {
+      const oldestNode = this.tail.prev;
+      this._remove(oldestNode);
+      this.cache.delete(oldestNode.key);
+    }
+  }
+
   clear() {
     this.cache.clear();
     this.head.next = this.tail;
@@ -3,6 +3,8 @@
  * Provides memory usage monitoring and optimization capabilities
  */
 
+import { nativeMemoryBudget, nativeMemoryPressure } from './cache/bridge.js';
+
 class MemoryMonitor {
     constructor() {
         this.isEnabled = true;
@@ -21,8 +23,12 @@ class MemoryMonitor {
         this.callbacks = {
             warning: [],
             critical: [],
-            cleanup: []
+            cleanup: [],
+            metrics: []
         };
+        // Native cache metrics, sampled on the same tick as memory usage
+        this.metricsSources = new Map();
+        this.nativeMetrics = {};
         
         this.init();
     }
@@ -92,6 +98,8 @@ class MemoryMonitor {
     }
     
     checkMemoryUsage() {
+        this.collectMetrics();
+        
         const usage = this.getCurrentMemoryUsage();
         if (!usage) return;
         
@@ -130,6 +138,43 @@ class MemoryMonitor {
         this.callbacks.cleanup.push(callback);
     }
     
+    onMetricsReport(callback) {
+        this.callbacks.metrics.push(callback);
+    }
+    
+    /**
+     * Samples source() on every monitoring tick and reports the result under
+     * name. Starts monitoring if no memory API did.
+     */
+    addMetricsSource(name, source) {
+        this.metricsSources.set(name, source);
+        if (!this.monitoringInterval) {
+            this.startMonitoring();
+        }
+    }
+    
+    removeMetricsSource(name) {
+        this.metricsSources.delete(name);
+        delete this.nativeMetrics[name];
+    }
+    
+    collectMetrics() {
+        if (this.metricsSources.size === 0) return;
+        
+        this.metricsSources.forEach((source, name) => {
+            try {
+                const metrics = source();
+                if (metrics) {
+                    this.nativeMetrics[name] = metrics;
+                }
+            } catch (error) {
+                // Metrics source error
+            }
+        });
+        
+        this.triggerCallbacks('metrics', this.nativeMetrics);
+    }
+    
     setupCleanupTriggers() {
         // Automatic cleanup on memory pressure
         this.onMemoryCleanup(() => {
@@ -141,8 +186,14 @@ class MemoryMonitor {
         });
     }
     
-    performAutomaticCleanup() {
+    /**
+     * nativeLevel is passed on to the native memory budget, which trims its
+     * caches in the same pass.
+     */
+    performAutomaticCleanup(nativeLevel = 'moderate') {
         try {
+            nativeMemoryPressure(nativeLevel);
+            
             // Trigger global cleanup if available
             if (typeof window !== 'undefined' && window.globalState) {
                 window.globalState.forceCleanup();
@@ -161,7 +212,7 @@ class MemoryMonitor {
     performAggressiveCleanup() {
         try {
             // Perform automatic cleanup first
-            this.performAutomaticCleanup();
+            this.performAutomaticCleanup('critical');
             
             // Clear all possible caches
             this.clearAllCaches();
@@ -230,7 +281,9 @@ class MemoryMonitor {
                 heapUsed: this.formatBytes(this.memoryStats.heapUsed),
                 heapTotal: this.formatBytes(this.memoryStats.heapTotal),
                 external: this.formatBytes(this.memoryStats.external)
-            }
+            },
+            native: this.nativeMetrics,
+            budget: nativeMemoryBudget()
         };
     }
     
@@ -252,7 +305,9 @@ class MemoryMonitor {
     
     destroy() {
         this.stopMonitoring();
-        this.callbacks = { warning: [], critical: [], cleanup: [] };
+        this.callbacks = { warning: [], critical: [], cleanup: [], metrics: [] };
+        this.metricsSources.clear();
+        this.nativeMetrics = {};
     }
 }
 
@@ -0,0 +1,59 @@
+import { nativeParseNumbers } from './cache/bridge.js';
+
+/**
+ * Bulk parsing of pasted or typed number lists (e.g. "1.5, 2 3;4").
+ * With a native provider the whole buffer is parsed in one call
+ * (legacy/core/math/decimal_parser.c); the scanner below mirrors its rules:
+ * whitespace runs separate fields, as does one comma or semicolon, an empty
+ * field between two commas is an error and a trailing separator is ignored.
+ */
+
+const MAX_TOKEN = 128;
+const DECIMAL_PATTERN = /^[+-]?(\d+\.?\d*|\.\d+)([eE][+-]?\d+)?$/;
+const FIELD_PATTERN = /[,;]|[^\s,;]+/g;
+
+function parseToken(token) {
+  if (token.length > MAX_TOKEN) return { status: 'too_long' };
+  if (!DECIMAL_PATTERN.test(token)) return { status: 'syntax' };
+  const value = Number(token);
+  return Number.isFinite(value) ? { value } : { status: 'range' };
+}
+
+function parseJs(text) {
+  const values = [];
+  const errors = [];
+  let afterField = false;
+
+  FIELD_PATTERN.lastIndex = 0;
+  for (let match = FIELD_PATTERN.exec(text); match; match = FIELD_PATTERN.exec(text)) {
+    const token = match[0];
+    if (token === ',' || token === ';') {
+      if (!afterField) errors.push({ offset: match.index, length: 0, status: 'empty' });
+      afterField = false;
+      continue;
+    }
+    const parsed = parseToken(token);
+    if (parsed.status) {
+      errors.push({ offset: match.index, length: token.length, status: parsed.status });
+    } else {
+      values.push(parsed.value);
+    }
+    afterField = true;
+  }
+
+  return { values, errors };
+}
+
+/**
+ * Parse a separated list of decimals.
+ * values holds the good fields in order (a Float64Array from the native
+ * parser, an array otherwise); errors locates each bad field by offset.
+ * @param {string} text
+ * @returns {{ values: ArrayLike<number>, errors: { offset: number, length: number, status: string }[] }}
+ */
+export function parseNumberList(text) {
+  if (typeof text !== 'string') throw new TypeError('Expected text');
+  return nativeParseNumbers(text) || parseJs(text);
+}
+
+export default parseNumberList;
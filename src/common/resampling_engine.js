@@ -0,0 +1,211 @@
+import { createNativeResampling } from './cache/bridge.js';
+import { runChunked } from './simulation_engine.js';
+
+/**
+ * Bootstrap confidence intervals and permutation tests for the two-sample
+ * pages. With a native provider the resamples run in
+ * legacy/calc/simulation/resampling.c; the JS stepper below mirrors it.
+ * Resamples draw indices only, each chunk stops after budgetMs so the page
+ * keeps animating, and permutation runs stop as soon as the 99% interval on
+ * the p-value lies clear of alpha.
+ */
+
+const DEFAULT_RESAMPLES = 10000;
+const DEFAULT_BUDGET_MS = 12;
+const DEFAULT_CHUNK = 1 << 14;
+const MAX_RESAMPLES = 1000000;
+
+// Mirrors RESAMPLE_MIN_DECISION, RESAMPLE_DECISION_Z and RESAMPLE_DECISION_STRIDE in resampling.h
+const MIN_DECISION = 200;
+const DECISION_Z = 2.5758293035489004;
+const DECISION_STRIDE = 32;
+const CLOCK_WORK = 4096;
+
+function mean(values) {
+  let sum = 0;
+  for (let i = 0; i < values.length; i++) sum += values[i];
+  return sum / values.length;
+}
+
+function wilson(count, trials, z) {
+  const p = count / trials;
+  const z2 = z * z;
+  const denominator = 1 + z2 / trials;
+  const center = (p + z2 / (2 * trials)) / denominator;
+  const half = z / denominator * Math.sqrt(p * (1 - p) / trials + z2 / (4 * trials * trials));
+  return { lower: Math.max(0, center - half), upper: Math.min(1, center + half) };
+}
+
+/**
+ * Type 7 (linear) quantile of sorted values.
+ */
+function sortedQuantile(sorted, q) {
+  const h = (sorted.length - 1) * q;
+  const lo = Math.floor(h);
+  if (lo + 1 >= sorted.length) return sorted[lo];
+  return sorted[lo] + (h - lo) * (sorted[lo + 1] - sorted[lo]);
+}
+
+function createJsResampling(kind, { sample1, sample2 = [], maxResamples, alpha = 0.05 }) {
+  const n1 = sample1.length;
+  const n2 = sample2.length;
+  const mean1 = mean(sample1);
+  const mean2 = n2 ? mean(sample2) : 0;
+  const observed = n2 ? mean1 - mean2 : mean1;
+  const permutation = kind === 'permutation';
+  const pooled = (mean1 * n1 + mean2 * n2) / (n1 + n2);
+
+  // Centered copies, as in resample_init
+  const values = new Float64Array(n1 + n2);
+  for (let i = 0; i < n1; i++) values[i] = sample1[i] - (permutation ? pooled : mean1);
+  for (let i = 0; i < n2; i++) values[n1 + i] = sample2[i] - (permutation ? pooled : mean2);
+
+  const order = permutation ? Uint32Array.from({ length: n1 + n2 }, (_, i) => i) : null;
+  const statistics = permutation ? null : new Float64Array(maxResamples);
+  const k = Math.min(n1, n2);
+  const threshold = Math.abs(observed) * (1 - 1e-12);
+  let done = 0;
+  let extreme = 0;
+  let decided = false;
+
+  const drawSum = (offset, count) => {
+    let sum = 0;
+    for (let i = 0; i < count; i++) sum += values[offset + Math.floor(Math.random() * count)];
+    return sum;
+  };
+
+  const once = () => {
+    if (!permutation) {
+      let shift = drawSum(0, n1) / n1;
+      if (n2) shift -= drawSum(n1, n2) / n2;
+      statistics[done] = observed + shift;
+      return;
+    }
+    let prefix = 0;
+    for (let i = 0; i < k; i++) {
+      const j = i + Math.floor(Math.random() * (n1 + n2 - i));
+      const index = order[j];
+      order[j] = order[i];
+      order[i] = index;
+      prefix += values[index];
+    }
+    const sum1 = n1 <= n2 ? prefix : -prefix;
+    const sum2 = n1 <= n2 ? -prefix : prefix;
+    if (Math.abs(sum1 / n1 - sum2 / n2) >= threshold) extreme++;
+  };
+
+  return {
+    step(max, budgetMs = 0) {
+      const end = Math.min(maxResamples, done + max);
+      const deadline = budgetMs > 0 ? Date.now() + budgetMs : 0;
+      const drawsPerResample = permutation ? k : n1 + n2;
+      let work = 0;
+
+      while (!decided && done < end) {
+        once();
+        done++;
+        if (permutation && done % DECISION_STRIDE === 0 && done >= MIN_DECISION) {
+          const { lower, upper } = wilson(extreme, done, DECISION_Z);
+          decided = upper < alpha || lower > alpha;
+        }
+        work += drawsPerResample;
+        if (deadline && work >= CLOCK_WORK) {
+          work = 0;
+          if (Date.now() >= deadline) break;
+        }
+      }
+
+      const progress = { done, total: maxResamples, observed, finished: decided || done >= maxResamples };
+      if (permutation && done > 0) {
+        const { lower, upper } = wilson(extreme, done, DECISION_Z);
+        Object.assign(progress, { pValue: (extreme + 1) / (done + 1), pLower: lower, pUpper: upper, decided });
+      }
+      return progress;
+    },
+
+    interval(level = 0.95) {
+      if (permutation || done < 2) return null;
+      const sorted = statistics.slice(0, done).sort();
+      const m = mean(sorted);
+      let ss = 0;
+      for (let i = 0; i < done; i++) ss += (sorted[i] - m) * (sorted[i] - m);
+      const tail = (1 - level) / 2;
+      return {
+        lower: sortedQuantile(sorted, tail),
+        upper: sortedQuantile(sorted, 1 - tail),
+        standardError: Math.sqrt(ss / (done - 1))
+      };
+    }
+  };
+}
+
+function validateSample(sample, name) {
+  if (!Array.isArray(sample) || sample.length < 2 || !sample.every(Number.isFinite)) {
+    throw new RangeError(`${name} needs at least 2 finite values`);
+  }
+}
+
+function validateResamples(resamples) {
+  if (!Number.isInteger(resamples) || resamples < 2 || resamples > MAX_RESAMPLES) {
+    throw new RangeError('Invalid resample count');
+  }
+}
+
+function run(kind, options, { chunkSize, budgetMs, level, onProgress }) {
+  const resampling = createNativeResampling(kind, options) || createJsResampling(kind, options);
+  const stepper = {
+    step(max) {
+      const progress = resampling.step(max, budgetMs);
+      if (kind === 'bootstrap') progress.interval = resampling.interval(level);
+      return progress;
+    }
+  };
+  return runChunked(stepper, chunkSize, onProgress);
+}
+
+class ResamplingEngine {
+  /**
+   * Percentile bootstrap interval for the mean of sample1, or for
+   * mean(sample1) - mean(sample2) when sample2 is given.
+   * Progress and the result carry interval: { lower, upper, standardError }.
+   * @param {{ sample1: number[], sample2?: number[], resamples?: number, level?: number, seed?: number,
+   *   budgetMs?: number, chunkSize?: number, onProgress?: Function }} options
+   * @returns {{ promise: Promise<object>, cancel: () => void }}
+   */
+  static runBootstrap({
+    sample1, sample2, resamples = DEFAULT_RESAMPLES, level = 0.95, seed = Date.now(),
+    budgetMs = DEFAULT_BUDGET_MS, chunkSize = DEFAULT_CHUNK, onProgress
+  } = {}) {
+    validateSample(sample1, 'sample1');
+    if (sample2 !== undefined) validateSample(sample2, 'sample2');
+    validateResamples(resamples);
+    if (typeof level !== 'number' || !(level > 0 && level < 1)) throw new RangeError('Invalid confidence level');
+
+    const options = { sample1, maxResamples: resamples, seed };
+    if (sample2 !== undefined) options.sample2 = sample2;
+    return run('bootstrap', options, { chunkSize, budgetMs, level, onProgress });
+  }
+
+  /**
+   * Two-sided permutation test of mean(sample1) - mean(sample2).
+   * Progress and the result carry pValue, its interval pLower..pUpper and
+   * decided (stopped before resamples because the test outcome at alpha was settled).
+   * @param {{ sample1: number[], sample2: number[], resamples?: number, alpha?: number, seed?: number,
+   *   budgetMs?: number, chunkSize?: number, onProgress?: Function }} options
+   * @returns {{ promise: Promise<object>, cancel: () => void }}
+   */
+  static runPermutation({
+    sample1, sample2, resamples = DEFAULT_RESAMPLES, alpha = 0.05, seed = Date.now(),
+    budgetMs = DEFAULT_BUDGET_MS, chunkSize = DEFAULT_CHUNK, onProgress
+  } = {}) {
+    validateSample(sample1, 'sample1');
+    validateSample(sample2, 'sample2');
+    validateResamples(resamples);
+    if (typeof alpha !== 'number' || !(alpha > 0 && alpha < 1)) throw new RangeError('Invalid significance level');
+
+    return run('permutation', { sample1, sample2, maxResamples: resamples, alpha, seed },
+      { chunkSize, budgetMs, onProgress });
+  }
+}
+
+export default ResamplingEngine;
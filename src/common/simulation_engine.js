@@ -0,0 +1,195 @@
+import { createNativeCoinSimulation, createNativePokerSimulation } from './cache/bridge.js';
+
+/**
+ * Chunked Monte Carlo runs for the coin and poker simulation pages.
+ * With a native provider registered (cache/bridge.js) the trials run in
+ * legacy/calc/simulation/monte_carlo.c; the JS steppers below are the fallback.
+ * Each chunk yields to the event loop and reports progress, so pages can
+ * animate while a long run is in flight.
+ */
+
+export const POKER_CATEGORIES = [
+  'high_card',
+  'pair',
+  'two_pair',
+  'three_of_a_kind',
+  'straight',
+  'flush',
+  'full_house',
+  'four_of_a_kind',
+  'straight_flush'
+];
+
+const DEFAULT_COIN_CHUNK = 1 << 16;
+const DEFAULT_POKER_CHUNK = 1 << 12;
+const DECK_SIZE = 52;
+
+function popcount13(mask) {
+  let count = 0;
+  for (let m = mask; m; m &= m - 1) count++;
+  return count;
+}
+
+/**
+ * Whether a 13-bit rank mask holds five consecutive ranks (ace also low).
+ * @param {number} mask
+ * @returns {boolean}
+ */
+function hasStraight(mask) {
+  const ranks = (mask << 1) | ((mask >> 12) & 1);
+  return (ranks & (ranks >> 1) & (ranks >> 2) & (ranks >> 3) & (ranks >> 4)) !== 0;
+}
+
+/**
+ * Category index (into POKER_CATEGORIES) of the best hand among cards,
+ * each rank * 4 + suit. Mirrors poker_evaluate.
+ * @param {number[]} cards
+ * @param {number} count
+ * @returns {number}
+ */
+export function evaluatePokerHand(cards, count = cards.length) {
+  const suitMasks = [0, 0, 0, 0];
+  let seen = 0;
+  let twice = 0;
+  let thrice = 0;
+  let four = 0;
+
+  for (let i = 0; i < count; i++) {
+    const bit = 1 << (cards[i] >> 2);
+    suitMasks[cards[i] & 3] |= bit;
+    four |= thrice & bit;
+    thrice |= twice & bit;
+    twice |= seen & bit;
+    seen |= bit;
+  }
+
+  const flushMask = suitMasks.find(mask => popcount13(mask) >= 5);
+  if (flushMask !== undefined && hasStraight(flushMask)) return 8;
+  if (four) return 7;
+  if (thrice && popcount13(twice) >= 2) return 6;
+  if (flushMask !== undefined) return 5;
+  if (hasStraight(seen)) return 4;
+  if (thrice) return 3;
+  if (popcount13(twice) >= 2) return 2;
+  if (twice) return 1;
+  return 0;
+}
+
+function createJsCoinSimulation(p, trials) {
+  const state = { done: 0, total: trials, heads: 0, longestHeadsRun: 0, longestTailsRun: 0, finished: trials === 0 };
+  let runFace = -1;
+  let runLength = 0;
+
+  return {
+    step(maxTrials) {
+      const end = Math.min(state.total, state.done + maxTrials);
+      for (; state.done < end; state.done++) {
+        const face = Math.random() < p ? 1 : 0;
+        runLength = face === runFace ? runLength + 1 : 1;
+        runFace = face;
+        if (face) {
+          state.heads++;
+          if (runLength > state.longestHeadsRun) state.longestHeadsRun = runLength;
+        } else if (runLength > state.longestTailsRun) {
+          state.longestTailsRun = runLength;
+        }
+      }
+      state.finished = state.done >= state.total;
+      return { ...state };
+    }
+  };
+}
+
+function createJsPokerSimulation(handSize, trials) {
+  const deck = Array.from({ length: DECK_SIZE }, (_, i) => i);
+  const categoryCounts = new Array(POKER_CATEGORIES.length).fill(0);
+  let done = 0;
+
+  return {
+    step(maxTrials) {
+      const end = Math.min(trials, done + maxTrials);
+      for (; done < end; done++) {
+        for (let i = 0; i < handSize; i++) {
+          const j = i + Math.floor(Math.random() * (DECK_SIZE - i));
+          const card = deck[i];
+          deck[i] = deck[j];
+          deck[j] = card;
+        }
+        categoryCounts[evaluatePokerHand(deck, handSize)]++;
+      }
+      const counts = {};
+      POKER_CATEGORIES.forEach((name, i) => { counts[name] = categoryCounts[i]; });
+      return { done, total: trials, counts, finished: done >= trials };
+    }
+  };
+}
+
+function validateTrials(trials) {
+  if (!Number.isInteger(trials) || trials < 0 || trials > Number.MAX_SAFE_INTEGER) {
+    throw new RangeError('Invalid trial count');
+  }
+}
+
+/**
+ * Drive a stepper chunk by chunk, yielding between chunks.
+ * Shared with resampling_engine.js.
+ * @returns {{ promise: Promise<object>, cancel: () => void }}
+ */
+export function runChunked(simulation, chunkSize, onProgress) {
+  let cancelled = false;
+
+  const promise = new Promise((resolve, reject) => {
+    const tick = () => {
+      if (cancelled) {
+        resolve(null);
+        return;
+      }
+      try {
+        const progress = simulation.step(chunkSize);
+        if (onProgress) onProgress(progress);
+        if (progress.finished) {
+          resolve(progress);
+        } else {
+          setTimeout(tick, 0);
+        }
+      } catch (e) {
+        reject(e);
+      }
+    };
+    setTimeout(tick, 0);
+  });
+
+  return { promise, cancel: () => { cancelled = true; } };
+}
+
+class SimulationEngine {
+  /**
+   * Flip trials coins with heads probability p.
+   * The promise resolves with the final totals (null if cancelled); onProgress
+   * receives the same shape after every chunk.
+   * @param {{ p?: number, trials: number, seed?: number, chunkSize?: number, onProgress?: Function }} options
+   * @returns {{ promise: Promise<object>, cancel: () => void }}
+   */
+  static runCoin({ p = 0.5, trials, seed = Date.now(), chunkSize = DEFAULT_COIN_CHUNK, onProgress } = {}) {
+    if (typeof p !== 'number' || !(p >= 0 && p <= 1)) throw new RangeError('Invalid probability');
+    validateTrials(trials);
+
+    const simulation = createNativeCoinSimulation(p, trials, seed) || createJsCoinSimulation(p, trials);
+    return runChunked(simulation, chunkSize, onProgress);
+  }
+
+  /**
+   * Deal trials hands of handSize cards (5 to 7) and count the best category of each.
+   * @param {{ handSize?: number, trials: number, seed?: number, chunkSize?: number, onProgress?: Function }} options
+   * @returns {{ promise: Promise<object>, cancel: () => void }}
+   */
+  static runPoker({ handSize = 5, trials, seed = Date.now(), chunkSize = DEFAULT_POKER_CHUNK, onProgress } = {}) {
+    if (!Number.isInteger(handSize) || handSize < 5 || handSize > 7) throw new RangeError('Invalid hand size');
+    validateTrials(trials);
+
+    const simulation = createNativePokerSimulation(handSize, trials, seed) || createJsPokerSimulation(handSize, trials);
+    return runChunked(simulation, chunkSize, onProgress);
+  }
+}
+
+export default SimulationEngine;